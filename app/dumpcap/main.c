@@ -66,6 +66,16 @@ static const char *lcore_arg;
 static bool dump_bpf;
 static bool show_interfaces;
 static bool print_stats;
+static uint32_t sample_rate;
+static uint64_t capture_bytes;
+static bool zero_copy;
+static bool per_queue_rings;
+
+/* capture rings drained by the main loop; one per queue and direction
+ * with --per-queue-rings, otherwise a single shared ring.
+ */
+static struct rte_ring **cap_rings;
+static unsigned int nb_cap_rings;
 
 /* capture limit options */
 static struct {
@@ -350,6 +360,10 @@ static void parse_opts(int argc, char **argv)
 		{ "list-interfaces", no_argument,       NULL, 'D' },
 		{ "no-promiscuous-mode", no_argument,   NULL, 'p' },
 		{ "output-file",     required_argument, NULL, 'w' },
+		{ "per-queue-rings", no_argument,       NULL, 0 },
+		{ "sample-rate",     required_argument, NULL, 0 },
+		{ "capture-bytes",   required_argument, NULL, 0 },
+		{ "zero-copy",       no_argument,       NULL, 0 },
 		{ "ring-buffer",     required_argument, NULL, 'b' },
 		{ "snapshot-length", required_argument, NULL, 's' },
 		{ "temp-dir",        required_argument, NULL, 0 },
@@ -389,6 +403,14 @@ static void parse_opts(int argc, char **argv)
 					rte_exit(EXIT_FAILURE,
 						 "--ifname must be specified after a -i option\n");
 				last_intf->ifname = optarg;
+			} else if (!strcmp(longopt, "sample-rate")) {
+				sample_rate = get_uint(optarg, "sample_rate", 0);
+			} else if (!strcmp(longopt, "capture-bytes")) {
+				capture_bytes = get_uint(optarg, "capture_bytes", 0);
+			} else if (!strcmp(longopt, "zero-copy")) {
+				zero_copy = true;
+			} else if (!strcmp(longopt, "per-queue-rings")) {
+				per_queue_rings = true;
 			} else {
 				usage();
 				exit(1);
@@ -476,6 +498,10 @@ static void parse_opts(int argc, char **argv)
 			exit(1);
 		}
 	}
+
+	if (zero_copy && use_pcapng)
+		rte_exit(EXIT_FAILURE,
+			 "--zero-copy requires libpcap format output (-P)\n");
 }
 
 static void
@@ -669,10 +695,9 @@ static void dpdk_init(void)
 }
 
 /* Create packet ring shared between callbacks and process */
-static struct rte_ring *create_ring(void)
+static struct rte_ring *create_ring(const char *ring_name, unsigned int flags)
 {
 	struct rte_ring *ring;
-	char ring_name[RTE_RING_NAMESIZE];
 	size_t size, log2;
 
 	/* Find next power of 2 >= size. */
@@ -686,12 +711,8 @@ static struct rte_ring *create_ring(void)
 		ring_size = size;
 	}
 
-	/* Want one ring per invocation of program */
-	snprintf(ring_name, sizeof(ring_name),
-		 "dumpcap-%d", getpid());
-
 	ring = rte_ring_create(ring_name, ring_size,
-			       rte_socket_id(), 0);
+			       rte_socket_id(), flags);
 	if (ring == NULL)
 		rte_exit(EXIT_FAILURE, "Could not create ring :%s\n",
 			 rte_strerror(rte_errno));
@@ -699,11 +720,51 @@ static struct rte_ring *create_ring(void)
 	return ring;
 }
 
+/* Number of capture rings that will be created */
+static unsigned int count_capture_rings(void)
+{
+	const struct interface *intf;
+	unsigned int count = 0;
+
+	if (!per_queue_rings)
+		return 1;
+
+	/* one single-producer ring per queue and direction */
+	TAILQ_FOREACH(intf, &interfaces, next) {
+		struct rte_eth_dev_info dev_info;
+
+		if (rte_eth_dev_info_get(intf->port, &dev_info) != 0)
+			rte_exit(EXIT_FAILURE,
+				 "Could not get info for %u:%s\n",
+				 intf->port, intf->name);
+		count += dev_info.nb_rx_queues + dev_info.nb_tx_queues;
+	}
+	return count;
+}
+
+static void create_capture_rings(void)
+{
+	char ring_name[RTE_RING_NAMESIZE];
+
+	nb_cap_rings = count_capture_rings();
+	cap_rings = calloc(nb_cap_rings, sizeof(*cap_rings));
+	if (cap_rings == NULL)
+		rte_exit(EXIT_FAILURE, "Could not allocate ring table\n");
+
+	if (!per_queue_rings) {
+		/* Want one ring per invocation of program */
+		snprintf(ring_name, sizeof(ring_name),
+			 "dumpcap-%d", getpid());
+		cap_rings[0] = create_ring(ring_name, 0);
+	}
+	/* with --per-queue-rings the rings are created at pdump enable */
+}
+
 static struct rte_mempool *create_mempool(void)
 {
 	const struct interface *intf;
 	char pool_name[RTE_MEMPOOL_NAMESIZE];
-	size_t num_mbufs = 2 * ring_size;
+	size_t num_mbufs = 2 * (size_t)ring_size * nb_cap_rings;
 	struct rte_mempool *mp;
 	uint32_t data_size = 128;
 
@@ -823,21 +884,71 @@ static dumpcap_out_t create_output(void)
 	return ret;
 }
 
-static void enable_pdump(struct rte_ring *r, struct rte_mempool *mp)
+/*
+ * Enable capture of a single queue and direction onto its own
+ * single-producer/single-consumer ring.
+ */
+static int enable_pdump_queue(struct interface *intf, uint16_t queue,
+			      uint32_t flags, unsigned int ring_idx,
+			      struct rte_mempool *mp)
+{
+	char ring_name[RTE_RING_NAMESIZE];
+	struct rte_ring *ring;
+	int ret;
+
+	snprintf(ring_name, sizeof(ring_name), "dumpcap-%d-%u",
+		 getpid(), ring_idx);
+	ring = create_ring(ring_name, RING_F_SP_ENQ | RING_F_SC_DEQ);
+	cap_rings[ring_idx] = ring;
+
+	ret = rte_pdump_enable_bpf_sampled(intf->port, queue, flags,
+					   intf->opts.snap_len,
+					   sample_rate, capture_bytes,
+					   ring, mp, intf->bpf_prm);
+	if (ret < 0) {
+		rte_ring_free(ring);
+		cap_rings[ring_idx] = NULL;
+	}
+	return ret;
+}
+
+static void enable_pdump(struct rte_mempool *mp)
 {
 	struct interface *intf;
-	unsigned int count = 0;
+	unsigned int count = 0, ring_idx = 0;
 	uint32_t flags;
 	int ret;
 
-	flags = RTE_PDUMP_FLAG_RXTX;
+	flags = 0;
 	if (use_pcapng)
 		flags |= RTE_PDUMP_FLAG_PCAPNG;
+	if (zero_copy)
+		flags |= RTE_PDUMP_FLAG_ZEROCOPY;
 
 	TAILQ_FOREACH(intf, &interfaces, next) {
-		ret = rte_pdump_enable_bpf(intf->port, RTE_PDUMP_ALL_QUEUES,
-					   flags, intf->opts.snap_len,
-					   r, mp, intf->bpf_prm);
+		if (per_queue_rings) {
+			struct rte_eth_dev_info dev_info;
+			uint16_t qid;
+
+			ret = rte_eth_dev_info_get(intf->port, &dev_info);
+			for (qid = 0; ret == 0 &&
+					qid < dev_info.nb_rx_queues; qid++)
+				ret = enable_pdump_queue(intf, qid,
+						flags | RTE_PDUMP_FLAG_RX,
+						ring_idx++, mp);
+			for (qid = 0; ret == 0 &&
+					qid < dev_info.nb_tx_queues; qid++)
+				ret = enable_pdump_queue(intf, qid,
+						flags | RTE_PDUMP_FLAG_TX,
+						ring_idx++, mp);
+		} else {
+			ret = rte_pdump_enable_bpf_sampled(intf->port,
+					RTE_PDUMP_ALL_QUEUES,
+					flags | RTE_PDUMP_FLAG_RXTX,
+					intf->opts.snap_len,
+					sample_rate, capture_bytes,
+					cap_rings[0], mp, intf->bpf_prm);
+		}
 		if (ret < 0) {
 			const struct interface *intf2;
 
@@ -935,21 +1046,12 @@ static int process_ring(dumpcap_out_t out, struct rte_ring *r)
 {
 	struct rte_mbuf *pkts[BURST_SIZE];
 	unsigned int avail, n;
-	static unsigned int empty_count;
 	ssize_t written;
 
 	n = rte_ring_sc_dequeue_burst(r, (void **) pkts, BURST_SIZE,
 				      &avail);
-	if (n == 0) {
-		/* don't consume endless amounts of cpu if idle */
-		if (empty_count < SLEEP_THRESHOLD)
-			++empty_count;
-		else
-			usleep(10);
+	if (n == 0)
 		return 0;
-	}
-
-	empty_count = (avail == 0);
 
 	if (use_pcapng)
 		written = rte_pcapng_write_packets(out.pcapng, pkts, n);
@@ -966,12 +1068,12 @@ static int process_ring(dumpcap_out_t out, struct rte_ring *r)
 	if (!quiet)
 		show_count(packets_received);
 
-	return 0;
+	return n;
 }
 
 int main(int argc, char **argv)
 {
-	struct rte_ring *r;
+	unsigned int empty_count = 0;
 	struct rte_mempool *mp;
 	struct sigaction action = {
 		.sa_flags = SA_RESTART,
@@ -1018,12 +1120,12 @@ int main(int argc, char **argv)
 		exit(0);
 	}
 
-	r = create_ring();
+	create_capture_rings();
 	mp = create_mempool();
 	out = create_output();
 
 	start_time = time(NULL);
-	enable_pdump(r, mp);
+	enable_pdump(mp);
 
 	if (!quiet) {
 		fprintf(stderr, "Packets captured: ");
@@ -1031,12 +1133,31 @@ int main(int argc, char **argv)
 	}
 
 	while (!rte_atomic_load_explicit(&quit_signal, rte_memory_order_relaxed)) {
-		if (process_ring(out, r) < 0) {
+		unsigned int i, pkts = 0;
+		int n = 0;
+
+		for (i = 0; i < nb_cap_rings; i++) {
+			n = process_ring(out, cap_rings[i]);
+			if (n < 0)
+				break;
+			pkts += n;
+		}
+		if (n < 0) {
 			fprintf(stderr, "pcapng file write failed; %s\n",
 				strerror(errno));
 			break;
 		}
 
+		/* don't consume endless amounts of cpu if idle */
+		if (pkts == 0) {
+			if (empty_count < SLEEP_THRESHOLD)
+				++empty_count;
+			else
+				usleep(10);
+		} else {
+			empty_count = 0;
+		}
+
 		if (stop.size && file_size >= stop.size)
 			break;
 
@@ -1060,7 +1181,13 @@ int main(int argc, char **argv)
 
 	cleanup_pdump_resources();
 
-	rte_ring_free(r);
+	{
+		unsigned int i;
+
+		for (i = 0; i < nb_cap_rings; i++)
+			rte_ring_free(cap_rings[i]);
+		free(cap_rings);
+	}
 	rte_mempool_free(mp);
 
 	return rte_eal_cleanup() ? EXIT_FAILURE : 0;
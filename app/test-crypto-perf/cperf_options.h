@@ -23,7 +23,9 @@
 #define CPERF_BURST_SIZE	("burst-sz")
 #define CPERF_BUFFER_SIZE	("buffer-sz")
 #define CPERF_SEGMENT_SIZE	("segment-sz")
+#define CPERF_SEGMENT_SIZE_LIST	("segment-sz-list")
 #define CPERF_DESC_NB		("desc-nb")
+#define CPERF_INFLIGHT		("inflight")
 #define CPERF_IMIX		("imix")
 
 #define CPERF_DEVTYPE		("devtype")
@@ -110,6 +112,9 @@ struct cperf_options {
 	uint32_t headroom_sz;
 	uint32_t tailroom_sz;
 	uint32_t segment_sz;
+	uint32_t segment_sz_list[MAX_LIST];
+	uint8_t segment_sz_count;
+	uint32_t inflight;
 	uint32_t test_buffer_size;
 	uint32_t *imix_buffer_sizes;
 	uint32_t nb_descriptors;
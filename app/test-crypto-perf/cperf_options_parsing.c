@@ -35,7 +35,11 @@ usage(char *progname)
 		" --buffer-sz N: set the size of a single packet\n"
 		" --imix N: set the distribution of packet sizes\n"
 		" --segment-sz N: set the size of the segment to use\n"
+		" --segment-sz-list A,B,C: build segment chains cycling through"
+		" the given segment sizes\n"
 		" --desc-nb N: set number of descriptors for each crypto device\n"
+		" --inflight N: set the maximum outstanding ops per queue pair,"
+		" modelling per-SA anti-replay serialization (latency test only)\n"
 		" --devtype TYPE: set crypto device type to use\n"
 		" --low-prio-qp-mask mask: set low priority for queues set in mask(hex)\n"
 		" --optype cipher-only / auth-only / cipher-then-auth / auth-then-cipher /\n"
@@ -432,6 +436,39 @@ parse_segment_sz(struct cperf_options *opts, const char *arg)
 	return 0;
 }
 
+static int
+parse_segment_sz_list(struct cperf_options *opts, const char *arg)
+{
+	int ret = parse_list(arg, opts->segment_sz_list, NULL, NULL);
+
+	if (ret < 0) {
+		RTE_LOG(ERR, USER1, "failed to parse segment size list\n");
+		return -1;
+	}
+
+	opts->segment_sz_count = ret;
+
+	return 0;
+}
+
+static int
+parse_inflight(struct cperf_options *opts, const char *arg)
+{
+	int ret = parse_uint32_t(&opts->inflight, arg);
+
+	if (ret) {
+		RTE_LOG(ERR, USER1, "failed to parse inflight ops count\n");
+		return -1;
+	}
+
+	if (opts->inflight == 0) {
+		RTE_LOG(ERR, USER1, "Inflight ops count has to be bigger than 0\n");
+		return -1;
+	}
+
+	return 0;
+}
+
 static int
 parse_imix(struct cperf_options *opts, const char *arg)
 {
@@ -1026,7 +1063,9 @@ static struct option lgopts[] = {
 	{ CPERF_BURST_SIZE, required_argument, 0, 0 },
 	{ CPERF_BUFFER_SIZE, required_argument, 0, 0 },
 	{ CPERF_SEGMENT_SIZE, required_argument, 0, 0 },
+	{ CPERF_SEGMENT_SIZE_LIST, required_argument, 0, 0 },
 	{ CPERF_DESC_NB, required_argument, 0, 0 },
+	{ CPERF_INFLIGHT, required_argument, 0, 0 },
 
 	{ CPERF_LOW_PRIO_QP_MASK, required_argument, 0, 0 },
 
@@ -1105,6 +1144,8 @@ cperf_options_default(struct cperf_options *opts)
 	 * maximum buffer size + digest, later
 	 */
 	opts->segment_sz = 0;
+	opts->segment_sz_count = 0;
+	opts->inflight = 0;
 
 	opts->imix_distribution_count = 0;
 	strncpy(opts->device_type, "crypto_aesni_mb",
@@ -1169,7 +1210,9 @@ cperf_opts_parse_long(int opt_idx, struct cperf_options *opts)
 		{ CPERF_BURST_SIZE,	parse_burst_sz },
 		{ CPERF_BUFFER_SIZE,	parse_buffer_sz },
 		{ CPERF_SEGMENT_SIZE,	parse_segment_sz },
+		{ CPERF_SEGMENT_SIZE_LIST, parse_segment_sz_list },
 		{ CPERF_DESC_NB,	parse_desc_nb },
+		{ CPERF_INFLIGHT,	parse_inflight },
 		{ CPERF_LOW_PRIO_QP_MASK,	parse_low_prio_qp_mask },
 		{ CPERF_DEVTYPE,	parse_device_type },
 		{ CPERF_OPTYPE,		parse_op_type },
@@ -1367,6 +1410,54 @@ cperf_options_check(struct cperf_options *options)
 			options->op_type == CPERF_DOCSIS)
 		options->digest_sz = 0;
 
+	if (options->inflight != 0 &&
+			options->test != CPERF_TEST_TYPE_LATENCY) {
+		RTE_LOG(ERR, USER1, "Inflight ops limit is only "
+					"supported in latency test\n");
+		return -EINVAL;
+	}
+
+	if (options->segment_sz_count != 0) {
+		uint32_t min_segment_sz;
+		uint8_t i;
+
+		if (options->segment_sz != 0) {
+			RTE_LOG(ERR, USER1, "Segment size and segment size "
+						"list are mutually exclusive\n");
+			return -EINVAL;
+		}
+
+		if (options->out_of_place) {
+			RTE_LOG(ERR, USER1, "Out of place mode cannot use "
+						"a segment size list\n");
+			return -EINVAL;
+		}
+
+		min_segment_sz = options->segment_sz_list[0];
+		for (i = 0; i < options->segment_sz_count; i++) {
+			if (options->segment_sz_list[i] <=
+					options->headroom_sz +
+					options->tailroom_sz) {
+				RTE_LOG(ERR, USER1, "Segment sizes should be "
+							"bigger than headroom "
+							"and tailroom\n");
+				return -EINVAL;
+			}
+			min_segment_sz = RTE_MIN(min_segment_sz,
+					options->segment_sz_list[i]);
+			/* Largest segment drives buffer capacity checks */
+			options->segment_sz = RTE_MAX(options->segment_sz,
+					options->segment_sz_list[i]);
+		}
+
+		if (min_segment_sz < options->digest_sz) {
+			RTE_LOG(ERR, USER1,
+					"Segment sizes should be at least "
+					"the size of the digest\n");
+			return -EINVAL;
+		}
+	}
+
 	if (options->out_of_place &&
 			options->segment_sz <= options->max_buffer_size) {
 		RTE_LOG(ERR, USER1, "Out of place mode can only work "
@@ -1669,6 +1760,14 @@ cperf_options_dump(struct cperf_options *opts)
 		printf("\n");
 	}
 	printf("\n# segment size: %u\n", opts->segment_sz);
+	if (opts->segment_sz_count != 0) {
+		printf("# segment size list: ");
+		for (size_idx = 0; size_idx < opts->segment_sz_count; size_idx++)
+			printf("%u ", opts->segment_sz_list[size_idx]);
+		printf("\n");
+	}
+	if (opts->inflight != 0)
+		printf("# inflight ops limit: %u\n", opts->inflight);
 	printf("#\n");
 	printf("# cryptodev type: %s\n", opts->device_type);
 	printf("#\n");
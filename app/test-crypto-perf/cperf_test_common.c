@@ -12,8 +12,11 @@ struct obj_params {
 	uint32_t dst_buf_offset;
 	uint16_t segment_sz;
 	uint16_t headroom_sz;
+	uint16_t tailroom_sz;
 	uint16_t data_len;
 	uint16_t segments_nb;
+	const uint32_t *segment_sz_list;
+	uint8_t segment_sz_count;
 };
 
 static void
@@ -44,32 +47,40 @@ fill_single_seg_mbuf(struct rte_mbuf *m, struct rte_mempool *mp,
 
 static void
 fill_multi_seg_mbuf(struct rte_mbuf *m, struct rte_mempool *mp,
-		void *obj, uint32_t mbuf_offset, uint16_t segment_sz,
-		uint16_t headroom, uint16_t data_len, uint16_t segments_nb)
+		void *obj, uint32_t mbuf_offset,
+		const struct obj_params *params)
 {
 	uint16_t mbuf_hdr_size = sizeof(struct rte_mbuf);
-	uint16_t remaining_segments = segments_nb;
+	uint16_t remaining_segments = params->segments_nb;
+	uint16_t segment_sz = params->segment_sz;
+	uint16_t seg_idx = 0;
 	rte_iova_t next_seg_phys_addr = rte_mempool_virt2iova(obj) +
 			 mbuf_offset + mbuf_hdr_size;
 
 	do {
+		if (params->segment_sz_count != 0)
+			segment_sz = params->segment_sz_list[seg_idx %
+					params->segment_sz_count];
+
 		/* start of buffer is after mbuf structure and priv data */
 		m->priv_size = 0;
 		m->buf_addr = (char *)m + mbuf_hdr_size;
 		rte_mbuf_iova_set(m, next_seg_phys_addr);
 		next_seg_phys_addr += mbuf_hdr_size + segment_sz;
 		m->buf_len = segment_sz;
-		m->data_len = data_len;
+		m->data_len = segment_sz - params->headroom_sz -
+				params->tailroom_sz;
 
 		/* Use headroom specified for the buffer */
-		m->data_off = headroom;
+		m->data_off = params->headroom_sz;
 
 		/* init some constant fields */
 		m->pool = mp;
-		m->nb_segs = segments_nb;
+		m->nb_segs = params->segments_nb;
 		m->port = 0xff;
 		rte_mbuf_refcnt_set(m, 1);
 
+		seg_idx++;
 		remaining_segments--;
 		if (remaining_segments > 0) {
 			m->next = (struct rte_mbuf *)((uint8_t *) m + mbuf_hdr_size + segment_sz);
@@ -119,8 +130,7 @@ mempool_obj_init(struct rte_mempool *mp,
 				params->data_len);
 	else
 		fill_multi_seg_mbuf(m, mp, obj, params->src_buf_offset,
-				params->segment_sz, params->headroom_sz,
-				params->data_len, params->segments_nb);
+				params);
 
 
 	/* Set destination buffer */
@@ -196,15 +206,40 @@ cperf_alloc_common_memory(const struct cperf_options *options,
 				crypto_op_private_size;
 	uint16_t crypto_op_total_size_padded =
 				RTE_CACHE_LINE_ROUNDUP(crypto_op_total_size);
-	uint32_t mbuf_size = sizeof(struct rte_mbuf) + options->segment_sz;
 	uint32_t max_size = options->max_buffer_size + options->digest_sz;
 	uint32_t segment_data_len = options->segment_sz - options->headroom_sz -
 				    options->tailroom_sz;
-	uint16_t segments_nb = (max_size % segment_data_len) ?
-				(max_size / segment_data_len) + 1 :
-				(max_size / segment_data_len);
-	uint32_t obj_size = crypto_op_total_size_padded +
-				(mbuf_size * segments_nb);
+	uint32_t mbufs_size;
+	uint16_t segments_nb;
+
+	if (options->segment_sz_count != 0) {
+		uint32_t remaining_bytes = max_size;
+
+		/* Chain segments cycling through the size list */
+		segments_nb = 0;
+		mbufs_size = 0;
+		while (remaining_bytes > 0) {
+			uint32_t seg_sz = options->segment_sz_list[
+					segments_nb %
+					options->segment_sz_count];
+			uint32_t seg_data_len = seg_sz -
+					options->headroom_sz -
+					options->tailroom_sz;
+
+			remaining_bytes -= RTE_MIN(remaining_bytes,
+					seg_data_len);
+			mbufs_size += sizeof(struct rte_mbuf) + seg_sz;
+			segments_nb++;
+		}
+	} else {
+		segments_nb = (max_size % segment_data_len) ?
+					(max_size / segment_data_len) + 1 :
+					(max_size / segment_data_len);
+		mbufs_size = (sizeof(struct rte_mbuf) +
+				options->segment_sz) * segments_nb;
+	}
+
+	uint32_t obj_size = crypto_op_total_size_padded + mbufs_size;
 
 	snprintf(pool_name, sizeof(pool_name), "pool_cdev_%u_qp_%u",
 			dev_id, qp_id);
@@ -214,18 +249,20 @@ cperf_alloc_common_memory(const struct cperf_options *options,
 	struct obj_params params = {
 		.segment_sz = options->segment_sz,
 		.headroom_sz = options->headroom_sz,
+		.tailroom_sz = options->tailroom_sz,
 		/* Data len = segment size - (headroom + tailroom) */
 		.data_len = options->segment_sz -
 			    options->headroom_sz -
 			    options->tailroom_sz,
 		.segments_nb = segments_nb,
+		.segment_sz_list = options->segment_sz_list,
+		.segment_sz_count = options->segment_sz_count,
 		.src_buf_offset = crypto_op_total_size_padded,
 		.dst_buf_offset = 0
 	};
 
 	if (options->out_of_place) {
-		*dst_buf_offset = *src_buf_offset +
-				(mbuf_size * segments_nb);
+		*dst_buf_offset = *src_buf_offset + mbufs_size;
 		params.dst_buf_offset = *dst_buf_offset;
 		/* Destination buffer will be one segment only */
 		obj_size += max_size + sizeof(struct rte_mbuf) +
@@ -271,7 +308,7 @@ cperf_mbuf_set(struct rte_mbuf *mbuf,
 		const struct cperf_options *options,
 		const struct cperf_test_vector *test_vector)
 {
-	uint32_t segment_sz = options->segment_sz - options->headroom_sz - options->tailroom_sz;
+	uint32_t segment_sz;
 	uint8_t *mbuf_data;
 	uint8_t *test_data;
 	uint32_t remaining_bytes = options->max_buffer_size;
@@ -288,6 +325,9 @@ cperf_mbuf_set(struct rte_mbuf *mbuf,
 	}
 
 	while (remaining_bytes) {
+		/* Segment capacity, sizes may differ within a chain */
+		segment_sz = mbuf->buf_len - options->headroom_sz -
+				options->tailroom_sz;
 		mbuf_data = rte_pktmbuf_mtod(mbuf, uint8_t *);
 
 		if (remaining_bytes <= segment_sz) {
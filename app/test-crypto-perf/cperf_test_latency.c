@@ -261,30 +261,49 @@ cperf_latency_test_runner(void *arg)
 							ctx->options->total_ops -
 							enqd_tot;
 
-			/* Allocate objects containing crypto operations and mbufs */
-			if (rte_mempool_get_bulk(ctx->pool, (void **)ops,
-						burst_size) != 0) {
-				RTE_LOG(ERR, USER1,
-					"Failed to allocate more crypto operations "
-					"from the crypto operation pool.\n"
-					"Consider increasing the pool size "
-					"with --pool-sz\n");
-				return -1;
+			/*
+			 * Cap the outstanding operations to model the
+			 * per-session serialization window: a new op is
+			 * only enqueued once the device completed enough
+			 * of the previous ones.
+			 */
+			if (ctx->options->inflight != 0) {
+				uint64_t inflight_now = enqd_tot - deqd_tot;
+
+				if (inflight_now >= ctx->options->inflight)
+					burst_size = 0;
+				else
+					burst_size = RTE_MIN((uint32_t)burst_size,
+						ctx->options->inflight -
+						inflight_now);
 			}
 
-			/* Setup crypto op, attach mbuf etc */
-			(ctx->populate_ops)(ops, ctx->src_buf_offset,
-					ctx->dst_buf_offset,
-					burst_size, ctx->sess, ctx->options,
-					ctx->test_vector, iv_offset,
-					&imix_idx, &tsc_start);
+			if (burst_size != 0) {
+				/* Allocate objects containing crypto operations and mbufs */
+				if (rte_mempool_get_bulk(ctx->pool, (void **)ops,
+							burst_size) != 0) {
+					RTE_LOG(ERR, USER1,
+						"Failed to allocate more crypto operations "
+						"from the crypto operation pool.\n"
+						"Consider increasing the pool size "
+						"with --pool-sz\n");
+					return -1;
+				}
 
-			/* Populate the mbuf with the test vector */
-			if (!cperf_is_asym_test(ctx->options))
-				for (i = 0; i < burst_size; i++)
-					cperf_mbuf_set(ops[i]->sym->m_src,
-						ctx->options,
-						ctx->test_vector);
+				/* Setup crypto op, attach mbuf etc */
+				(ctx->populate_ops)(ops, ctx->src_buf_offset,
+						ctx->dst_buf_offset,
+						burst_size, ctx->sess, ctx->options,
+						ctx->test_vector, iv_offset,
+						&imix_idx, &tsc_start);
+
+				/* Populate the mbuf with the test vector */
+				if (!cperf_is_asym_test(ctx->options))
+					for (i = 0; i < burst_size; i++)
+						cperf_mbuf_set(ops[i]->sym->m_src,
+							ctx->options,
+							ctx->test_vector);
+			}
 
 			tsc_start = rte_rdtsc_precise();
 
@@ -300,8 +319,11 @@ cperf_latency_test_runner(void *arg)
 #endif /* CPERF_LINEARIZATION_ENABLE */
 
 			/* Enqueue burst of ops on crypto device */
-			ops_enqd = rte_cryptodev_enqueue_burst(ctx->dev_id, ctx->qp_id,
-					ops, burst_size);
+			if (burst_size != 0)
+				ops_enqd = rte_cryptodev_enqueue_burst(ctx->dev_id,
+						ctx->qp_id, ops, burst_size);
+			else
+				ops_enqd = 0;
 
 			/* Dequeue processed burst of ops from crypto device */
 			ops_deqd = rte_cryptodev_dequeue_burst(ctx->dev_id, ctx->qp_id,
@@ -8,8 +8,10 @@
 #include <unistd.h>
 
 #include <rte_time.h>
+#include <rte_bitops.h>
 #include <rte_mbuf.h>
 #include <rte_dmadev.h>
+#include <rte_dma_mbuf.h>
 #include <rte_malloc.h>
 #include <rte_lcore.h>
 #include <rte_random.h>
@@ -21,6 +23,21 @@
 #define TEST_WAIT_U_SECOND 10000
 #define POLL_MAX 1000
 
+#define DMA_OP_COPY 0
+#define DMA_OP_FILL 1
+
+#define FILL_PATTERN 0xA5A5A5A5A5A5A5A5ULL
+
+#define CPU_BASELINE_LOOPS 10000
+
+/* HDR-style latency histogram: one power-of-two major bucket per leading
+ * bit position, each split into linear sub-buckets, which bounds the
+ * relative quantization error to 1/LAT_HIST_SUB_NB at any magnitude.
+ */
+#define LAT_HIST_SUB_BITS 4
+#define LAT_HIST_SUB_NB (1 << LAT_HIST_SUB_BITS)
+#define LAT_HIST_NB_BUCKETS ((64 - LAT_HIST_SUB_BITS + 1) * LAT_HIST_SUB_NB)
+
 #define CSV_LINE_DMA_FMT "Scenario %u,%u,%s,%u,%u,%u,%u,%.2lf,%" PRIu64 ",%.3lf,%.3lf\n"
 #define CSV_LINE_CPU_FMT "Scenario %u,%u,NA,NA,NA,%u,%u,%.2lf,%" PRIu64 ",%.3lf,%.3lf\n"
 
@@ -41,6 +58,12 @@ struct sge_info {
 	uint8_t nb_dsts;
 };
 
+struct lat_hist {
+	uint64_t nb_ops;
+	uint64_t cycles_sum;
+	uint64_t bucket[LAT_HIST_NB_BUCKETS];
+};
+
 struct lcore_params {
 	uint8_t scenario_id;
 	unsigned int lcore_id;
@@ -54,12 +77,24 @@ struct lcore_params {
 	struct rte_mbuf **srcs;
 	struct rte_mbuf **dsts;
 	struct sge_info sge;
+	uint16_t ring_size;
+	uint8_t nb_size_classes;
+	uint32_t *buf_sizes;	/* per-buffer copy length, NULL for fixed size */
+	uint8_t *buf_classes;	/* per-buffer size class, NULL for fixed size */
+	uint8_t *buf_ops;	/* per-buffer DMA_OP_*, NULL for copy only */
+	struct lat_hist *lat_hists;	/* one per size class, NULL if latency off */
+	uint64_t *enq_ts;	/* per-ring-slot enqueue timestamp */
+	uint8_t *enq_class;	/* per-ring-slot size class */
 	volatile struct worker_info worker_info;
 };
 
 static struct rte_mempool *src_pool;
 static struct rte_mempool *dst_pool;
 
+static uint32_t *distr_buf_sizes;
+static uint8_t *distr_buf_classes;
+static uint8_t *distr_buf_ops;
+
 static struct lcore_params *lcores[MAX_WORKER_NB];
 
 #define PRINT_ERR(...) print_err(__func__, __LINE__, __VA_ARGS__)
@@ -93,6 +128,142 @@ calc_result(uint32_t buf_size, uint32_t nr_buf, uint16_t nb_workers, uint16_t te
 	*bandwidth = (ops * buf_size * 8) / (1000 * 1000 * 1000);
 }
 
+static inline uint32_t
+lat_hist_bucket(uint64_t cycles)
+{
+	uint32_t msb;
+
+	if (cycles < LAT_HIST_SUB_NB)
+		return cycles;
+
+	msb = 63 - rte_clz64(cycles);
+	return ((msb - LAT_HIST_SUB_BITS + 1) << LAT_HIST_SUB_BITS) +
+		((cycles >> (msb - LAT_HIST_SUB_BITS)) & (LAT_HIST_SUB_NB - 1));
+}
+
+/* Lower edge of a bucket, the inverse of lat_hist_bucket(). */
+static uint64_t
+lat_hist_bucket_value(uint32_t bucket)
+{
+	uint32_t msb, sub;
+
+	if (bucket < LAT_HIST_SUB_NB)
+		return bucket;
+
+	msb = (bucket >> LAT_HIST_SUB_BITS) + LAT_HIST_SUB_BITS - 1;
+	sub = bucket & (LAT_HIST_SUB_NB - 1);
+	return (1ULL << msb) | ((uint64_t)sub << (msb - LAT_HIST_SUB_BITS));
+}
+
+static inline void
+lat_hist_record(struct lat_hist *hist, uint64_t cycles)
+{
+	hist->nb_ops++;
+	hist->cycles_sum += cycles;
+	hist->bucket[lat_hist_bucket(cycles)]++;
+}
+
+static uint64_t
+lat_hist_percentile(const struct lat_hist *hist, double percentile)
+{
+	uint64_t rank = (uint64_t)(hist->nb_ops * percentile / 100.0);
+	uint64_t acc = 0;
+	uint32_t b;
+
+	for (b = 0; b < LAT_HIST_NB_BUCKETS; b++) {
+		acc += hist->bucket[b];
+		if (acc > rank)
+			return lat_hist_bucket_value(b);
+	}
+
+	return 0;
+}
+
+/* Cache-hot memcpy cost of one size class, the CPU side of the
+ * CPU-vs-DMA crossover report.
+ */
+static uint64_t
+cpu_baseline_cycles(uint32_t buf_size)
+{
+	uint8_t *src, *dst;
+	uint64_t cycles = 0;
+	uint32_t i;
+
+	src = rte_malloc(NULL, buf_size, RTE_CACHE_LINE_SIZE);
+	dst = rte_malloc(NULL, buf_size, RTE_CACHE_LINE_SIZE);
+	if (src != NULL && dst != NULL) {
+		memset(src, 0x5A, buf_size);
+		rte_memcpy(dst, src, buf_size);	/* warm up */
+
+		cycles = rte_rdtsc();
+		for (i = 0; i < CPU_BASELINE_LOOPS; i++)
+			rte_memcpy(dst, src, buf_size);
+		cycles = (rte_rdtsc() - cycles) / CPU_BASELINE_LOOPS;
+	}
+
+	rte_free(src);
+	rte_free(dst);
+	return cycles;
+}
+
+static void
+output_latency_report(struct test_configure *cfg, struct lcore_params **workers,
+		      uint16_t nb_workers)
+{
+	uint8_t nb_classes = cfg->use_size_distr ? cfg->nb_size_classes : 1;
+	double hz = rte_get_timer_hz();
+	struct lat_hist *agg;
+	uint32_t c, b;
+	uint16_t w;
+
+	agg = rte_zmalloc(NULL, nb_classes * sizeof(*agg), RTE_CACHE_LINE_SIZE);
+	if (agg == NULL) {
+		PRINT_ERR("Error with latency report allocation.\n");
+		return;
+	}
+
+	for (w = 0; w < nb_workers; w++) {
+		const struct lat_hist *hists = workers[w]->lat_hists;
+
+		if (hists == NULL)
+			continue;
+
+		for (c = 0; c < nb_classes; c++) {
+			agg[c].nb_ops += hists[c].nb_ops;
+			agg[c].cycles_sum += hists[c].cycles_sum;
+			for (b = 0; b < LAT_HIST_NB_BUCKETS; b++)
+				agg[c].bucket[b] += hists[c].bucket[b];
+		}
+	}
+
+	printf("\nPer-op completion latency (cycles):\n");
+	for (c = 0; c < nb_classes; c++) {
+		uint32_t class_size = cfg->use_size_distr ?
+			cfg->size_class_len[c] : cfg->buf_size.cur;
+		uint64_t p50, p99, p999;
+
+		if (agg[c].nb_ops == 0)
+			continue;
+
+		p50 = lat_hist_percentile(&agg[c], 50.0);
+		p99 = lat_hist_percentile(&agg[c], 99.0);
+		p999 = lat_hist_percentile(&agg[c], 99.9);
+		printf("Size %u B: %" PRIu64 " ops, avg %" PRIu64 ", p50 %" PRIu64 ", p99 %" PRIu64 ", p999 %" PRIu64 " (%.3lf us)\n",
+			class_size, agg[c].nb_ops,
+			agg[c].cycles_sum / agg[c].nb_ops,
+			p50, p99, p999, p999 * 1000000.0 / hz);
+
+		if (cfg->is_dma) {
+			uint64_t cpu_cycles = cpu_baseline_cycles(class_size);
+
+			printf("    CPU memcpy baseline (cache-hot): %" PRIu64 " cycles/op, DMA completion is %s at this size\n",
+				cpu_cycles, (p50 > cpu_cycles) ? "slower" : "faster");
+		}
+	}
+
+	rte_free(agg);
+}
+
 static void
 output_result(struct test_configure *cfg, struct lcore_params *para,
 			uint16_t kick_batch, uint64_t ave_cycle, uint32_t buf_size,
@@ -109,6 +280,8 @@ output_result(struct test_configure *cfg, struct lcore_params *para,
 		if (cfg->is_sg)
 			printf(" DMA src sges: %u, dst sges: %u",
 			       para->sge.nb_srcs, para->sge.nb_dsts);
+		if (cfg->use_mbuf_api)
+			printf(" mbuf helper API");
 		printf(".\n");
 	} else {
 		printf("lcore %u\n", lcore_id);
@@ -336,6 +509,58 @@ dma_copy:
 	return 0;
 }
 
+static inline int
+do_dma_mbuf_mem_copy(void *p)
+{
+	struct lcore_params *para = (struct lcore_params *)p;
+	volatile struct worker_info *worker_info = &(para->worker_info);
+	const uint16_t dev_id = para->dev_id;
+	const uint32_t nr_buf = para->nr_buf;
+	const uint16_t kick_batch = para->kick_batch;
+	struct rte_mbuf **srcs = para->srcs;
+	struct rte_mbuf **dsts = para->dsts;
+	uint16_t nr_cpl;
+	uint64_t async_cnt = 0;
+	uint32_t i;
+	uint32_t poll_cnt = 0;
+	int ret;
+
+	worker_info->stop_flag = false;
+	worker_info->ready_flag = true;
+
+	while (!worker_info->start_flag)
+		;
+
+	while (1) {
+		for (i = 0; i < nr_buf; i++) {
+dma_copy:
+			ret = rte_dma_copy_mbuf(dev_id, 0, srcs[i], dsts[i], 0);
+			if (unlikely(ret < 0)) {
+				if (ret == -ENOSPC) {
+					do_dma_submit_and_poll(dev_id, &async_cnt, worker_info);
+					goto dma_copy;
+				} else
+					error_exit(dev_id);
+			}
+			async_cnt++;
+
+			if ((async_cnt % kick_batch) == 0)
+				do_dma_submit_and_poll(dev_id, &async_cnt, worker_info);
+		}
+
+		if (worker_info->stop_flag)
+			break;
+	}
+
+	rte_dma_submit(dev_id, 0);
+	while ((async_cnt > 0) && (poll_cnt++ < POLL_MAX)) {
+		nr_cpl = rte_dma_completed(dev_id, 0, MAX_DMA_CPL_NB, NULL, NULL);
+		async_cnt -= nr_cpl;
+	}
+
+	return 0;
+}
+
 static inline int
 do_dma_sg_mem_copy(void *p)
 {
@@ -395,6 +620,148 @@ dma_copy:
 	return 0;
 }
 
+static inline void
+do_dma_adv_submit_and_poll(struct lcore_params *para, uint64_t *async_cnt,
+				uint16_t *next_cpl_idx)
+{
+	volatile struct worker_info *worker_info = &(para->worker_info);
+	const uint16_t mask = para->ring_size - 1;
+	uint16_t nr_cpl, k, slot;
+	uint64_t now;
+	int ret;
+
+	ret = rte_dma_submit(para->dev_id, 0);
+	if (ret < 0)
+		error_exit(para->dev_id);
+
+	nr_cpl = rte_dma_completed(para->dev_id, 0, MAX_DMA_CPL_NB, NULL, NULL);
+	if (para->lat_hists != NULL) {
+		now = rte_rdtsc();
+		for (k = 0; k < nr_cpl; k++) {
+			slot = (uint16_t)(*next_cpl_idx + k) & mask;
+			lat_hist_record(&para->lat_hists[para->enq_class[slot]],
+					now - para->enq_ts[slot]);
+		}
+	}
+	*next_cpl_idx += nr_cpl;
+	*async_cnt -= nr_cpl;
+	worker_info->total_cpl += nr_cpl;
+}
+
+/* Plain memory copy worker extended with per-buffer sizes, a copy/fill
+ * op mix and per-op completion latency sampling. Kept separate so the
+ * fixed-size fast path above stays free of the extra loads.
+ */
+static inline int
+do_dma_adv_mem_copy(void *p)
+{
+	struct lcore_params *para = (struct lcore_params *)p;
+	volatile struct worker_info *worker_info = &(para->worker_info);
+	const uint16_t dev_id = para->dev_id;
+	const uint32_t nr_buf = para->nr_buf;
+	const uint16_t kick_batch = para->kick_batch;
+	const uint16_t mask = para->ring_size - 1;
+	struct rte_mbuf **srcs = para->srcs;
+	struct rte_mbuf **dsts = para->dsts;
+	uint16_t nr_cpl, next_cpl_idx = 0;
+	uint64_t async_cnt = 0;
+	uint32_t poll_cnt = 0;
+	uint32_t i, buf_size;
+	int ret;
+
+	worker_info->stop_flag = false;
+	worker_info->ready_flag = true;
+
+	while (!worker_info->start_flag)
+		;
+
+	while (1) {
+		for (i = 0; i < nr_buf; i++) {
+			buf_size = (para->buf_sizes != NULL) ?
+				para->buf_sizes[i] : para->buf_size;
+dma_copy:
+			if (para->buf_ops != NULL && para->buf_ops[i] == DMA_OP_FILL)
+				ret = rte_dma_fill(dev_id, 0, FILL_PATTERN,
+					rte_mbuf_data_iova(dsts[i]), buf_size, 0);
+			else
+				ret = rte_dma_copy(dev_id, 0,
+					rte_mbuf_data_iova(srcs[i]),
+					rte_mbuf_data_iova(dsts[i]), buf_size, 0);
+			if (unlikely(ret < 0)) {
+				if (ret == -ENOSPC) {
+					do_dma_adv_submit_and_poll(para, &async_cnt,
+								   &next_cpl_idx);
+					goto dma_copy;
+				} else
+					error_exit(dev_id);
+			}
+			if (para->lat_hists != NULL) {
+				para->enq_ts[ret & mask] = rte_rdtsc();
+				para->enq_class[ret & mask] =
+					(para->buf_classes != NULL) ? para->buf_classes[i] : 0;
+			}
+			async_cnt++;
+
+			if ((async_cnt % kick_batch) == 0)
+				do_dma_adv_submit_and_poll(para, &async_cnt, &next_cpl_idx);
+		}
+
+		if (worker_info->stop_flag)
+			break;
+	}
+
+	rte_dma_submit(dev_id, 0);
+	while ((async_cnt > 0) && (poll_cnt++ < POLL_MAX)) {
+		nr_cpl = rte_dma_completed(dev_id, 0, MAX_DMA_CPL_NB, NULL, NULL);
+		async_cnt -= nr_cpl;
+	}
+
+	return 0;
+}
+
+static inline int
+do_cpu_adv_mem_copy(void *p)
+{
+	struct lcore_params *para = (struct lcore_params *)p;
+	volatile struct worker_info *worker_info = &(para->worker_info);
+	const uint32_t nr_buf = para->nr_buf;
+	struct rte_mbuf **srcs = para->srcs;
+	struct rte_mbuf **dsts = para->dsts;
+	uint32_t i, buf_size;
+	uint64_t start;
+	uint8_t cls;
+
+	worker_info->stop_flag = false;
+	worker_info->ready_flag = true;
+
+	while (!worker_info->start_flag)
+		;
+
+	while (1) {
+		for (i = 0; i < nr_buf; i++) {
+			const void *src = rte_pktmbuf_mtod(srcs[i], void *);
+			void *dst = rte_pktmbuf_mtod(dsts[i], void *);
+
+			buf_size = (para->buf_sizes != NULL) ?
+				para->buf_sizes[i] : para->buf_size;
+			if (para->lat_hists != NULL) {
+				cls = (para->buf_classes != NULL) ? para->buf_classes[i] : 0;
+				start = rte_rdtsc();
+				rte_memcpy(dst, src, (size_t)buf_size);
+				lat_hist_record(&para->lat_hists[cls],
+						rte_rdtsc() - start);
+			} else {
+				rte_memcpy(dst, src, (size_t)buf_size);
+			}
+			worker_info->total_cpl++;
+		}
+		if (worker_info->stop_flag)
+			break;
+	}
+
+	return 0;
+}
+
 static inline int
 do_cpu_mem_copy(void *p)
 {
@@ -505,6 +872,53 @@ setup_memory_env(struct test_configure *cfg,
 	for (i = 0; i < nr_buf; i++) {
 		memset(rte_pktmbuf_mtod((*srcs)[i], void *), rte_rand(), cur_buf_size);
 		memset(rte_pktmbuf_mtod((*dsts)[i], void *), 0, cur_buf_size);
+
+		/* The mbuf helper API takes the copy length from the mbuf */
+		if (cfg->use_mbuf_api) {
+			(*srcs)[i]->data_len = (*srcs)[i]->pkt_len = cur_buf_size;
+			(*dsts)[i]->data_len = (*dsts)[i]->pkt_len = cur_buf_size;
+		}
+	}
+
+	if (cfg->use_size_distr) {
+		uint32_t tot_weight = 0, w, c, r;
+
+		for (c = 0; c < cfg->nb_size_classes; c++)
+			tot_weight += cfg->size_class_weight[c];
+
+		distr_buf_sizes = rte_malloc(NULL, nr_buf * sizeof(uint32_t), 0);
+		distr_buf_classes = rte_malloc(NULL, nr_buf * sizeof(uint8_t), 0);
+		if (distr_buf_sizes == NULL || distr_buf_classes == NULL) {
+			PRINT_ERR("Error with size distribution array allocation.\n");
+			return -1;
+		}
+
+		/* Deterministic interleaving which honours the exact weights,
+		 * so repeated runs see the same per-buffer size sequence.
+		 */
+		for (i = 0; i < nr_buf; i++) {
+			r = i % tot_weight;
+			w = 0;
+			for (c = 0; c < cfg->nb_size_classes; c++) {
+				w += cfg->size_class_weight[c];
+				if (r < w)
+					break;
+			}
+			distr_buf_classes[i] = c;
+			distr_buf_sizes[i] = cfg->size_class_len[c];
+		}
+	}
+
+	if (cfg->fill_ratio > 0) {
+		distr_buf_ops = rte_malloc(NULL, nr_buf * sizeof(uint8_t), 0);
+		if (distr_buf_ops == NULL) {
+			PRINT_ERR("Error with op mix array allocation.\n");
+			return -1;
+		}
+
+		for (i = 0; i < nr_buf; i++)
+			distr_buf_ops[i] = ((i % 100) < cfg->fill_ratio) ?
+				DMA_OP_FILL : DMA_OP_COPY;
 	}
 
 	if (cfg->is_sg) {
@@ -580,12 +994,19 @@ get_work_function(struct test_configure *cfg)
 	lcore_function_t *fn;
 
 	if (cfg->is_dma) {
-		if (!cfg->is_sg)
+		if (cfg->use_size_distr || cfg->measure_latency || cfg->fill_ratio > 0)
+			fn = do_dma_adv_mem_copy;
+		else if (cfg->use_mbuf_api)
+			fn = do_dma_mbuf_mem_copy;
+		else if (!cfg->is_sg)
 			fn = do_dma_plain_mem_copy;
 		else
 			fn = do_dma_sg_mem_copy;
 	} else {
-		fn = do_cpu_mem_copy;
+		if (cfg->use_size_distr || cfg->measure_latency)
+			fn = do_cpu_adv_mem_copy;
+		else
+			fn = do_cpu_mem_copy;
 	}
 
 	return fn;
@@ -690,9 +1111,24 @@ mem_copy_benchmark(struct test_configure *cfg)
 	float mops, mops_total;
 	float bandwidth, bandwidth_total;
 	uint32_t nr_sgsrc = 0, nr_sgdst = 0;
+	uint32_t avg_buf_size = buf_size;
 	uint32_t nr_buf;
 	int ret = 0;
 
+	/* With a size distribution, the throughput figures are computed over
+	 * the weighted average operation size.
+	 */
+	if (cfg->use_size_distr) {
+		uint64_t len_sum = 0, tot_weight = 0;
+
+		for (i = 0; i < cfg->nb_size_classes; i++) {
+			len_sum += (uint64_t)cfg->size_class_len[i] *
+				cfg->size_class_weight[i];
+			tot_weight += cfg->size_class_weight[i];
+		}
+		avg_buf_size = len_sum / tot_weight;
+	}
+
 	nr_buf = align_buffer_count(cfg, &nr_sgsrc, &nr_sgdst);
 	cfg->nr_buf = nr_buf;
 
@@ -736,6 +1172,40 @@ mem_copy_benchmark(struct test_configure *cfg)
 		lcores[i]->dsts = dsts + offset;
 		lcores[i]->scenario_id = cfg->scenario_id;
 		lcores[i]->lcore_id = lcore_id;
+		lcores[i]->ring_size = cfg->ring_size.cur;
+		lcores[i]->nb_size_classes = cfg->use_size_distr ? cfg->nb_size_classes : 1;
+		lcores[i]->buf_sizes = (distr_buf_sizes != NULL) ?
+			distr_buf_sizes + offset : NULL;
+		lcores[i]->buf_classes = (distr_buf_classes != NULL) ?
+			distr_buf_classes + offset : NULL;
+		lcores[i]->buf_ops = (distr_buf_ops != NULL) ?
+			distr_buf_ops + offset : NULL;
+		lcores[i]->lat_hists = NULL;
+		lcores[i]->enq_ts = NULL;
+		lcores[i]->enq_class = NULL;
+
+		if (cfg->measure_latency) {
+			lcores[i]->lat_hists = rte_zmalloc(NULL,
+				lcores[i]->nb_size_classes * sizeof(struct lat_hist),
+				RTE_CACHE_LINE_SIZE);
+			if (lcores[i]->lat_hists == NULL) {
+				printf("latency histogram malloc failure for lcore %d\n",
+					lcore_id);
+				goto out;
+			}
+			if (cfg->is_dma) {
+				lcores[i]->enq_ts = rte_zmalloc(NULL,
+					cfg->ring_size.cur * sizeof(uint64_t),
+					RTE_CACHE_LINE_SIZE);
+				lcores[i]->enq_class = rte_zmalloc(NULL,
+					cfg->ring_size.cur, RTE_CACHE_LINE_SIZE);
+				if (lcores[i]->enq_ts == NULL || lcores[i]->enq_class == NULL) {
+					printf("latency ring malloc failure for lcore %d\n",
+						lcore_id);
+					goto out;
+				}
+			}
+		}
 
 		if (cfg->is_sg) {
 			lcores[i]->sge.nb_srcs = cfg->nb_src_sges;
@@ -793,9 +1263,26 @@ mem_copy_benchmark(struct test_configure *cfg)
 
 		if (vchan_dev->tdir == RTE_DMA_DIR_MEM_TO_MEM && !cfg->is_sg) {
 			for (i = 0; i < nr_buf_pt; i++) {
-				if (memcmp(rte_pktmbuf_mtod(src_buf[i], void *),
+				uint32_t len = (distr_buf_sizes != NULL) ?
+					distr_buf_sizes[offset + i] : cfg->buf_size.cur;
+
+				if (distr_buf_ops != NULL &&
+				    distr_buf_ops[offset + i] == DMA_OP_FILL) {
+					const uint8_t *data = rte_pktmbuf_mtod(dst_buf[i],
+									const uint8_t *);
+
+					for (j = 0; j < len; j++)
+						if (data[j] != (uint8_t)FILL_PATTERN)
+							break;
+					if (j != len) {
+						printf("Fill validation fails for buffer number %d\n",
+							i);
+						ret = -1;
+						goto out;
+					}
+				} else if (memcmp(rte_pktmbuf_mtod(src_buf[i], void *),
 							    rte_pktmbuf_mtod(dst_buf[i], void *),
-							    cfg->buf_size.cur) != 0) {
+							    len) != 0) {
 					printf("Copy validation fails for buffer number %d\n", i);
 					ret = -1;
 					goto out;
@@ -850,12 +1337,12 @@ mem_copy_benchmark(struct test_configure *cfg)
 	avg_cycles_total = 0;
 	for (i = 0; i < nb_workers; i++) {
 		vchan_dev = &cfg->dma_config[i].vchan_dev;
-		calc_result(buf_size, nr_buf, nb_workers, test_secs,
+		calc_result(avg_buf_size, nr_buf, nb_workers, test_secs,
 			lcores[i]->worker_info.test_cpl,
 			&memory, &avg_cycles, &bandwidth, &mops);
 		printf("Direction: %s\n", vchan_dev->tdir == 0 ? "mem2mem" :
 			vchan_dev->tdir == 1 ? "mem2dev" : "dev2mem");
-		output_result(cfg, lcores[i], kick_batch, avg_cycles, buf_size,
+		output_result(cfg, lcores[i], kick_batch, avg_cycles, avg_buf_size,
 			nr_buf / nb_workers, memory, bandwidth, mops);
 		mops_total += mops;
 		bandwidth_total += bandwidth;
@@ -867,6 +1354,9 @@ mem_copy_benchmark(struct test_configure *cfg)
 			cfg->scenario_id, nr_buf, memory * nb_workers,
 			(avg_cycles_total * (float) 1.0) / nb_workers, bandwidth_total, mops_total);
 
+	if (cfg->measure_latency)
+		output_latency_report(cfg, lcores, nb_workers);
+
 out:
 
 	for (k = 0; k < nb_workers; k++) {
@@ -916,8 +1406,23 @@ out:
 	rte_free(dst_sges);
 	dst_sges = NULL;
 
+	/* free the per-buffer size distribution and op mix */
+	rte_free(distr_buf_sizes);
+	distr_buf_sizes = NULL;
+
+	rte_free(distr_buf_classes);
+	distr_buf_classes = NULL;
+
+	rte_free(distr_buf_ops);
+	distr_buf_ops = NULL;
+
 	/* free the worker parameters */
 	for (i = 0; i < nb_workers; i++) {
+		if (lcores[i] != NULL) {
+			rte_free(lcores[i]->lat_hists);
+			rte_free(lcores[i]->enq_ts);
+			rte_free(lcores[i]->enq_class);
+		}
 		rte_free(lcores[i]);
 		lcores[i] = NULL;
 	}
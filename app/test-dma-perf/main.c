@@ -254,6 +254,49 @@ out:
 	return args_nr;
 }
 
+static int
+parse_size_distr(const char *value, struct test_configure *test_case)
+{
+	char input[255] = {0};
+	char *args[MAX_SIZE_CLASSES + 1];
+	char *weight_str;
+	uint32_t max_size = 0;
+	int nb_classes, i;
+
+	strncpy(input, value, 254);
+	if (*input == '\0')
+		return -1;
+
+	nb_classes = rte_strsplit(input, strlen(input), args, MAX_SIZE_CLASSES + 1, ',');
+	if (nb_classes <= 0 || nb_classes > MAX_SIZE_CLASSES)
+		return -1;
+
+	for (i = 0; i < nb_classes; i++) {
+		weight_str = strchr(args[i], ':');
+		if (weight_str == NULL)
+			return -1;
+		*weight_str++ = '\0';
+
+		test_case->size_class_len[i] = (uint32_t)atoi(args[i]);
+		test_case->size_class_weight[i] = (uint16_t)atoi(weight_str);
+		if (test_case->size_class_len[i] == 0 || test_case->size_class_weight[i] == 0)
+			return -1;
+
+		max_size = RTE_MAX(max_size, test_case->size_class_len[i]);
+	}
+
+	test_case->nb_size_classes = nb_classes;
+	test_case->use_size_distr = true;
+
+	/* The memory pools are sized for the largest class. */
+	test_case->buf_size.cur = test_case->buf_size.first = max_size;
+	test_case->buf_size.last = 0;
+	test_case->buf_size.incr = 0;
+	test_case->buf_size.op = OP_NONE;
+
+	return 0;
+}
+
 static int populate_dma_dev_config(const char *key, const char *value, void *test)
 {
 	struct lcore_dma_config *dma_config = (struct lcore_dma_config *)test;
@@ -298,7 +341,8 @@ load_configs(const char *path)
 	const char *case_type;
 	const char *lcore_dma;
 	const char *mem_size_str, *buf_size_str, *ring_size_str, *kick_batch_str,
-		*src_sges_str, *dst_sges_str;
+		*src_sges_str, *dst_sges_str, *mbuf_api_str, *size_distr_str,
+		*latency_str, *fill_ratio_str;
 	const char *skip;
 	struct rte_kvargs *kvlist;
 	int args_nr, nb_vp;
@@ -373,6 +417,24 @@ load_configs(const char *path)
 		} else if (args_nr == 4)
 			nb_vp++;
 
+		size_distr_str = rte_cfgfile_get_entry(cfgfile, section_name, "buf_size_distr");
+		if (size_distr_str != NULL) {
+			if (test_case->buf_size.incr != 0) {
+				printf("buf_size_distr can not be combined with a variable buf_size in case %d.\n",
+					i + 1);
+				test_case->is_valid = false;
+				continue;
+			}
+			if (parse_size_distr(size_distr_str, test_case) < 0) {
+				printf("parse buf_size_distr error in case %d.\n", i + 1);
+				test_case->is_valid = false;
+				continue;
+			}
+		}
+
+		latency_str = rte_cfgfile_get_entry(cfgfile, section_name, "latency_report");
+		test_case->measure_latency = (latency_str != NULL && atoi(latency_str) == 1);
+
 		if (is_dma) {
 			ring_size_str = rte_cfgfile_get_entry(cfgfile, section_name,
 								"dma_ring_size");
@@ -417,6 +479,40 @@ load_configs(const char *path)
 				test_case->is_sg = false;
 			}
 
+			mbuf_api_str = rte_cfgfile_get_entry(cfgfile, section_name,
+								"dma_mbuf_api");
+			test_case->use_mbuf_api = (mbuf_api_str != NULL &&
+						atoi(mbuf_api_str) == 1);
+			if (test_case->use_mbuf_api && test_case->is_sg) {
+				printf("dma_mbuf_api can not be combined with dma_src_sge/dma_dst_sge in case %d.\n",
+					i + 1);
+				test_case->is_valid = false;
+				continue;
+			}
+
+			fill_ratio_str = rte_cfgfile_get_entry(cfgfile, section_name,
+								"dma_fill_ratio");
+			if (fill_ratio_str != NULL) {
+				int fill_ratio = atoi(fill_ratio_str);
+
+				if (fill_ratio < 0 || fill_ratio > 100) {
+					printf("dma_fill_ratio must be within [0, 100] in case %d.\n",
+						i + 1);
+					test_case->is_valid = false;
+					continue;
+				}
+				test_case->fill_ratio = fill_ratio;
+			}
+
+			if ((test_case->is_sg || test_case->use_mbuf_api) &&
+			    (test_case->use_size_distr || test_case->measure_latency ||
+			     test_case->fill_ratio > 0)) {
+				printf("buf_size_distr/latency_report/dma_fill_ratio are only supported on the plain copy path in case %d.\n",
+					i + 1);
+				test_case->is_valid = false;
+				continue;
+			}
+
 			kick_batch_str = rte_cfgfile_get_entry(cfgfile, section_name, "kick_batch");
 			args_nr = parse_entry(kick_batch_str, &test_case->kick_batch);
 			if (args_nr < 0) {
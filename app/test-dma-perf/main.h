@@ -15,6 +15,8 @@
 
 #define MAX_DMA_NB 128
 
+#define MAX_SIZE_CLASSES 8
+
 extern char output_str[MAX_WORKER_NB + 1][MAX_OUTPUT_STR_LEN];
 
 typedef enum {
@@ -58,6 +60,13 @@ struct test_configure {
 	uint16_t opcode;
 	bool is_dma;
 	bool is_sg;
+	bool use_mbuf_api;
+	bool use_size_distr;
+	bool measure_latency;
+	uint8_t nb_size_classes;
+	uint8_t fill_ratio;
+	uint32_t size_class_len[MAX_SIZE_CLASSES];
+	uint16_t size_class_weight[MAX_SIZE_CLASSES];
 	struct lcore_dma_config dma_config[MAX_WORKER_NB];
 	struct test_configure_entry mem_size;
 	struct test_configure_entry buf_size;
@@ -67,7 +67,9 @@ struct evt_options {
 	uint8_t per_port_pool;
 	uint8_t preschedule;
 	uint8_t preschedule_opted;
+	uint8_t nb_stage_cycles;
 	uint8_t sched_type_list[EVT_MAX_STAGES];
+	uint32_t stage_cycles[EVT_MAX_STAGES];
 	uint16_t mbuf_sz;
 	uint16_t wkr_deq_dep;
 	uint16_t vector_size;
@@ -90,6 +92,7 @@ struct evt_options {
 	uint64_t vector_tmo_nsec;
 	uint64_t timer_tick_nsec;
 	uint64_t optm_timer_tick_nsec;
+	uint64_t slo_p99_nsec;
 	enum evt_prod_type prod_type;
 	enum rte_event_dma_adapter_mode dma_adptr_mode;
 	enum rte_event_crypto_adapter_mode crypto_adptr_mode;
@@ -168,7 +168,7 @@ main(int argc, char **argv)
 	rte_eal_mp_wait_lcore();
 
 	if (test->ops.test_result)
-		test->ops.test_result(test, &opt);
+		ret = test->ops.test_result(test, &opt);
 
 	if (test->ops.ethdev_destroy)
 		test->ops.ethdev_destroy(test, &opt);
@@ -474,6 +474,44 @@ evt_parse_prod_enq_burst_sz(struct evt_options *opt, const char *arg)
 	return ret;
 }
 
+static int
+evt_parse_stage_cycles(struct evt_options *opt, const char *arg)
+{
+	const char *s = arg;
+	char *end = NULL;
+	int i = 0;
+
+	while (*s != '\0') {
+		if (i == EVT_MAX_STAGES) {
+			evt_err("stage_cycles list is beyond EVT_MAX_STAGES=%d",
+				EVT_MAX_STAGES);
+			return -EINVAL;
+		}
+
+		opt->stage_cycles[i] = strtoul(s, &end, 0);
+		if (end == s || (*end != ',' && *end != '\0')) {
+			evt_err("invalid stage_cycles list %s", arg);
+			return -EINVAL;
+		}
+
+		i++;
+		s = (*end == ',') ? end + 1 : end;
+	}
+
+	opt->nb_stage_cycles = i;
+	return 0;
+}
+
+static int
+evt_parse_slo_p99_ns(struct evt_options *opt, const char *arg)
+{
+	int ret;
+
+	ret = parser_read_uint64(&(opt->slo_p99_nsec), arg);
+
+	return ret;
+}
+
 static void
 usage(char *program)
 {
@@ -533,6 +571,10 @@ usage(char *program)
 		"                       0 - disable pre-schedule\n"
 		"                       1 - pre-schedule\n"
 		"                       2 - pre-schedule adaptive (Default)\n"
+		"\t--stage_cycles     : list of per stage worker cycle costs,\n"
+		"                       one entry per stage in --stlist.\n"
+		"\t--slo_p99_ns       : fail the test if the measured p99\n"
+		"                       pipeline latency exceeds given ns.\n"
 		);
 	printf("available tests:\n");
 	evt_test_dump_names();
@@ -623,6 +665,8 @@ static struct option lgopts[] = {
 	{ EVT_TX_FIRST,            1, 0, 0 },
 	{ EVT_TX_PKT_SZ,           1, 0, 0 },
 	{ EVT_PRESCHEDULE,         1, 0, 0 },
+	{ EVT_STAGE_CYCLES,        1, 0, 0 },
+	{ EVT_SLO_P99_NS,          1, 0, 0 },
 	{ NULL,                    0, 0, 0 }
 };
 
@@ -674,6 +718,8 @@ evt_opts_parse_long(int opt_idx, struct evt_options *opt)
 		{ EVT_TX_FIRST, evt_parse_tx_first},
 		{ EVT_TX_PKT_SZ, evt_parse_tx_pkt_sz},
 		{ EVT_PRESCHEDULE, evt_parse_preschedule},
+		{ EVT_STAGE_CYCLES, evt_parse_stage_cycles},
+		{ EVT_SLO_P99_NS, evt_parse_slo_p99_ns},
 	};
 
 	for (i = 0; i < RTE_DIM(parsermap); i++) {
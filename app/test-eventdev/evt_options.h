@@ -61,6 +61,8 @@
 #define EVT_TX_FIRST		 ("tx_first")
 #define EVT_TX_PKT_SZ		 ("tx_pkt_sz")
 #define EVT_PRESCHEDULE          ("preschedule")
+#define EVT_STAGE_CYCLES         ("stage_cycles")
+#define EVT_SLO_P99_NS           ("slo_p99_ns")
 #define EVT_HELP                 ("help")
 
 void evt_options_default(struct evt_options *opt);
@@ -5,10 +5,106 @@
 
 #include "test_pipeline_common.h"
 
+int pipeline_ts_dyn_off = -1;
+
+static inline bool
+pipeline_stage_instr(struct evt_options *opt)
+{
+	return opt->nb_stage_cycles || opt->slo_p99_nsec;
+}
+
+/* Upper bound in cycles of a latency histogram bucket */
+static uint64_t
+pipeline_lat_hist_bound(uint32_t idx)
+{
+	const uint32_t group = idx >> PIPELINE_LAT_HIST_SUB_BITS;
+	const uint32_t rem = idx & ((1 << PIPELINE_LAT_HIST_SUB_BITS) - 1);
+
+	if (group == 0)
+		return rem + 1;
+
+	return ((1ULL << PIPELINE_LAT_HIST_SUB_BITS) + rem + 1) << (group - 1);
+}
+
+static uint64_t
+pipeline_lat_percentile(const uint64_t *hist, uint64_t total, double pct)
+{
+	const uint64_t target = (uint64_t)(total * pct / 100.0);
+	uint64_t seen = 0;
+	uint32_t i;
+
+	for (i = 0; i < PIPELINE_LAT_HIST_BUCKETS; i++) {
+		seen += hist[i];
+		if (seen > target)
+			return pipeline_lat_hist_bound(i);
+	}
+
+	return pipeline_lat_hist_bound(PIPELINE_LAT_HIST_BUCKETS - 1);
+}
+
+static void
+pipeline_stage_stats(struct test_pipeline *t, struct evt_options *opt)
+{
+	uint64_t hist[PIPELINE_LAT_HIST_BUCKETS];
+	const double ns_per_cyc = 1E9 / rte_get_tsc_hz();
+	uint64_t total = 0;
+	uint64_t p99_ns;
+	int i, s;
+
+	evt_info("Per stage hop latency (scheduling + previous stage work) :");
+	for (s = 1; s <= opt->nb_stages; s++) {
+		uint64_t cyc = 0, pkts = 0;
+
+		for (i = 0; i < t->nb_workers; i++) {
+			cyc += t->worker[i].stage_lat_cyc[s];
+			pkts += t->worker[i].stage_lat_pkts[s];
+		}
+		if (!pkts)
+			continue;
+		evt_info("Stage %d avg: "CLGRN"%.1f ns"CLNRM" over %"PRIu64
+				" packets", s,
+				((double)cyc / pkts) * ns_per_cyc, pkts);
+	}
+
+	memset(hist, 0, sizeof(hist));
+	for (i = 0; i < t->nb_workers; i++) {
+		uint32_t b;
+
+		for (b = 0; b < PIPELINE_LAT_HIST_BUCKETS; b++) {
+			hist[b] += t->worker[i].lat_hist[b];
+			total += t->worker[i].lat_hist[b];
+		}
+	}
+
+	if (!total) {
+		if (opt->slo_p99_nsec) {
+			evt_err("no latency samples collected, SLO check failed");
+			t->result = EVT_TEST_FAILED;
+		}
+		return;
+	}
+
+	p99_ns = pipeline_lat_percentile(hist, total, 99.0) * ns_per_cyc;
+	evt_info("Pipeline latency of %"PRIu64" packets, first dequeue to Tx :",
+			total);
+	evt_info("p50: "CLGRN"%"PRIu64" ns"CLNRM" p90: "CLGRN"%"PRIu64
+			" ns"CLNRM" p99: "CLGRN"%"PRIu64" ns"CLNRM,
+			(uint64_t)(pipeline_lat_percentile(hist, total, 50.0) *
+				   ns_per_cyc),
+			(uint64_t)(pipeline_lat_percentile(hist, total, 90.0) *
+				   ns_per_cyc),
+			p99_ns);
+
+	if (opt->slo_p99_nsec && p99_ns > opt->slo_p99_nsec) {
+		evt_err("p99 latency %"PRIu64" ns exceeds SLO %"PRIu64" ns",
+				p99_ns, opt->slo_p99_nsec);
+		t->result = EVT_TEST_FAILED;
+	}
+}
+
 int
 pipeline_test_result(struct evt_test *test, struct evt_options *opt)
 {
-	RTE_SET_USED(opt);
 	int i;
 	uint64_t total = 0;
 	struct test_pipeline *t = evt_test_priv(test);
@@ -22,6 +118,10 @@ pipeline_test_result(struct evt_test *test, struct evt_options *opt)
 				t->worker[i].processed_pkts,
 				(((double)t->worker[i].processed_pkts)/total)
 				* 100);
+
+	if (pipeline_stage_instr(opt))
+		pipeline_stage_stats(t, opt);
+
 	return t->result;
 }
 
@@ -42,6 +142,16 @@ pipeline_opt_dump(struct evt_options *opt, uint8_t nb_queues)
 		evt_dump("vector_size", "%d", opt->vector_size);
 		evt_dump("vector_tmo_ns", "%" PRIu64 "", opt->vector_tmo_nsec);
 	}
+	if (opt->nb_stage_cycles) {
+		int i;
+
+		evt_dump_begin("stage_cycles");
+		for (i = 0; i < opt->nb_stage_cycles; i++)
+			printf("%d ", opt->stage_cycles[i]);
+		evt_dump_end;
+	}
+	if (opt->slo_p99_nsec)
+		evt_dump("slo_p99_ns", "%" PRIu64 "", opt->slo_p99_nsec);
 }
 
 static inline uint64_t
@@ -237,6 +347,8 @@ pipeline_launch_lcores(struct evt_test *test, struct evt_options *opt,
 		}
 	}
 	printf("\n");
+	/* The test ran to completion, any SLO check happens in test_result */
+	t->result = EVT_TEST_SUCCESS;
 	return 0;
 }
 
@@ -299,6 +411,19 @@ pipeline_opt_check(struct evt_options *opt, uint64_t nb_queues)
 	if (evt_has_invalid_sched_type(opt))
 		return -1;
 
+	if (pipeline_stage_instr(opt)) {
+		if (opt->ena_vector) {
+			evt_err("stage_cycles/slo_p99_ns not supported with event vector");
+			return -1;
+		}
+		if (opt->nb_stage_cycles &&
+		    opt->nb_stage_cycles != opt->nb_stages) {
+			evt_err("stage_cycles needs one entry per stage, got %d for %d stages",
+				opt->nb_stage_cycles, opt->nb_stages);
+			return -1;
+		}
+	}
+
 	return 0;
 }
 
@@ -840,6 +965,21 @@ pipeline_test_setup(struct evt_test *test, struct evt_options *opt)
 	opt->prod_type = EVT_PROD_TYPE_ETH_RX_ADPTR;
 	memcpy(t->sched_type_list, opt->sched_type_list,
 			sizeof(opt->sched_type_list));
+
+	if (pipeline_stage_instr(opt)) {
+		static const struct rte_mbuf_dynfield ts_dynfield = {
+			.name = "test_event_dynfield_pipeline_ts",
+			.size = sizeof(struct pipeline_pkt_ts),
+			.align = alignof(uint64_t),
+		};
+
+		pipeline_ts_dyn_off = rte_mbuf_dynfield_register(&ts_dynfield);
+		if (pipeline_ts_dyn_off < 0) {
+			evt_err("failed to register pipeline timestamp dynfield");
+			rte_free(test->test_priv);
+			return -rte_errno;
+		}
+	}
 	return 0;
 nomem:
 	return -ENOMEM;
@@ -10,6 +10,7 @@
 #include <stdbool.h>
 #include <unistd.h>
 
+#include <rte_bitops.h>
 #include <rte_cycles.h>
 #include <rte_ethdev.h>
 #include <rte_ether.h>
@@ -18,6 +19,7 @@
 #include <rte_eventdev.h>
 #include <rte_lcore.h>
 #include <rte_malloc.h>
+#include <rte_mbuf_dyn.h>
 #include <rte_mempool.h>
 #include <rte_prefetch.h>
 #include <rte_service.h>
@@ -31,11 +33,25 @@
 
 struct test_pipeline;
 
+/* Log-linear latency histogram, 16 linear sub-buckets per power of two of
+ * TSC cycles. Group 25 tops out beyond 2^28 cycles i.e. >100ms on most CPUs.
+ */
+#define PIPELINE_LAT_HIST_SUB_BITS 4
+#define PIPELINE_LAT_HIST_GROUPS 26
+#define PIPELINE_LAT_HIST_BUCKETS \
+	(PIPELINE_LAT_HIST_GROUPS << PIPELINE_LAT_HIST_SUB_BITS)
+
 struct __rte_cache_aligned worker_data {
 	uint64_t processed_pkts;
 	uint8_t dev_id;
 	uint8_t port_id;
 	struct test_pipeline *t;
+	/* Stage instrumentation, written only by the owning worker. Index
+	 * nb_stages holds the final hop into the Tx queue where applicable.
+	 */
+	uint64_t stage_lat_cyc[EVT_MAX_STAGES + 1];
+	uint64_t stage_lat_pkts[EVT_MAX_STAGES + 1];
+	uint64_t lat_hist[PIPELINE_LAT_HIST_BUCKETS];
 };
 
 struct __rte_cache_aligned test_pipeline {
@@ -95,6 +111,43 @@ struct __rte_cache_aligned test_pipeline {
 	const uint8_t nb_stages = t->opt->nb_stages + 1;	 \
 	alignas(RTE_CACHE_LINE_SIZE) struct rte_event ev[BURST_SIZE + 1]
 
+/* Per packet dequeue timestamps carried in a mbuf dynfield across stages. */
+struct pipeline_pkt_ts {
+	uint64_t first;
+	uint64_t prev;
+};
+
+extern int pipeline_ts_dyn_off;
+
+#define pipeline_pkt_ts(m) \
+	RTE_MBUF_DYNFIELD((m), pipeline_ts_dyn_off, struct pipeline_pkt_ts *)
+
+static __rte_always_inline void
+pipeline_stage_work(uint64_t cycles)
+{
+	const uint64_t start = rte_rdtsc();
+
+	while (rte_rdtsc() - start < cycles)
+		rte_pause();
+}
+
+static __rte_always_inline uint32_t
+pipeline_lat_hist_idx(uint64_t cycles)
+{
+	uint32_t group;
+
+	if (cycles < (1ULL << PIPELINE_LAT_HIST_SUB_BITS))
+		return cycles;
+
+	group = (63 - rte_clz64(cycles)) - PIPELINE_LAT_HIST_SUB_BITS + 1;
+	if (group >= PIPELINE_LAT_HIST_GROUPS)
+		return PIPELINE_LAT_HIST_BUCKETS - 1;
+
+	return (group << PIPELINE_LAT_HIST_SUB_BITS) |
+	       ((cycles >> (group - 1)) &
+		((1 << PIPELINE_LAT_HIST_SUB_BITS) - 1));
+}
+
 static __rte_always_inline void
 pipeline_fwd_event(struct rte_event *ev, uint8_t sched)
 {
@@ -562,6 +562,77 @@ pipeline_queue_worker_multi_stage_burst_fwd_vector(void *arg)
 	return 0;
 }
 
+static __rte_noinline int
+pipeline_queue_worker_stage_instr(void *arg)
+{
+	struct worker_data *w  = arg;
+	struct test_pipeline *t = w->t;
+	const uint8_t dev = w->dev_id;
+	const uint8_t port = w->port_id;
+	const uint8_t last_queue = t->opt->nb_stages - 1;
+	uint8_t *const sched_type_list = &t->sched_type_list[0];
+	const uint8_t nb_slots = t->opt->nb_stages + 1;
+	const uint8_t *tx_queue = t->tx_evqueue_id;
+	const uint32_t *stage_cycles = t->opt->stage_cycles;
+	const uint8_t internal_port = t->internal_port;
+	alignas(RTE_CACHE_LINE_SIZE) struct rte_event ev;
+	uint8_t enq = 0, deq = 0;
+	uint8_t cq_id;
+
+	while (t->done == false) {
+		deq = rte_event_dequeue_burst(dev, port, &ev, 1, 0);
+
+		if (!deq) {
+			rte_pause();
+			continue;
+		}
+
+		const uint64_t now = rte_rdtsc();
+		struct pipeline_pkt_ts *ts = pipeline_pkt_ts(ev.mbuf);
+
+		cq_id = ev.queue_id % nb_slots;
+
+		if (internal_port && ev.queue_id == tx_queue[ev.mbuf->port]) {
+			w->stage_lat_cyc[cq_id] += now - ts->prev;
+			w->stage_lat_pkts[cq_id]++;
+			w->lat_hist[pipeline_lat_hist_idx(now - ts->first)]++;
+			enq = pipeline_event_tx(dev, port, &ev, t);
+			ev.op = RTE_EVENT_OP_RELEASE;
+			w->processed_pkts++;
+			continue;
+		}
+
+		if (cq_id == 0) {
+			ts->first = now;
+		} else {
+			w->stage_lat_cyc[cq_id] += now - ts->prev;
+			w->stage_lat_pkts[cq_id]++;
+		}
+
+		pipeline_stage_work(stage_cycles[cq_id]);
+		ts->prev = rte_rdtsc();
+
+		if (!internal_port && cq_id == last_queue) {
+			w->lat_hist[pipeline_lat_hist_idx(ts->prev -
+							  ts->first)]++;
+			ev.queue_id = tx_queue[ev.mbuf->port];
+			rte_event_eth_tx_adapter_txq_set(ev.mbuf, 0);
+			pipeline_fwd_event(&ev, RTE_SCHED_TYPE_ATOMIC);
+			enq = pipeline_event_enqueue(dev, port, &ev, t);
+			w->processed_pkts++;
+		} else {
+			ev.queue_id++;
+			pipeline_fwd_event(&ev, cq_id != last_queue ?
+					sched_type_list[cq_id] :
+					RTE_SCHED_TYPE_ATOMIC);
+			enq = pipeline_event_enqueue(dev, port, &ev, t);
+		}
+	}
+	pipeline_worker_cleanup(dev, port, &ev, enq, deq);
+
+	return 0;
+}
+
 static int
 worker_wrapper(void *arg)
 {
@@ -594,6 +665,9 @@ worker_wrapper(void *arg)
 		[1][1][1] = pipeline_queue_worker_multi_stage_burst_tx_vector,
 	};
 
+	if (opt->nb_stage_cycles || opt->slo_p99_nsec)
+		return pipeline_queue_worker_stage_instr(arg);
+
 	if (nb_stages == 1)
 		return (pipeline_queue_worker_single_stage[opt->ena_vector]
 							  [burst]
@@ -0,0 +1,236 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright 2025 Mellanox Technologies, Ltd
+ *
+ * The file contains the implementations of the template
+ * (asynchronous) flow API helpers.
+ *
+ * The pattern and actions templates are built from the same
+ * items/actions generators as the synchronous path, so both
+ * insertion modes benchmark identical rules. The template
+ * table is created with the full rule-count capacity, which
+ * makes the PMD pre-allocate its resources before the first
+ * rule is enqueued.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <rte_ethdev.h>
+#include <rte_flow.h>
+
+#include "async_gen.h"
+#include "items_gen.h"
+#include "actions_gen.h"
+#include "flow_gen.h"
+#include "config.h"
+
+/* Max completions taken from a flow queue in one pull. */
+#define ASYNC_PULL_BURST 64
+
+struct port_template {
+	struct rte_flow_pattern_template *pattern_template;
+	struct rte_flow_actions_template *actions_template;
+	struct rte_flow_template_table *table;
+};
+
+static struct port_template port_templates[MAX_PORTS];
+
+int
+async_setup_queues(uint16_t port_id,
+	uint16_t nb_queues,
+	uint32_t queue_size,
+	struct rte_flow_error *error)
+{
+	const struct rte_flow_queue_attr *attr_list[RTE_MAX_LCORE];
+	const struct rte_flow_queue_attr queue_attr = {
+		.size = queue_size,
+	};
+	const struct rte_flow_port_attr port_attr = { 0 };
+	uint16_t i;
+
+	if (nb_queues > RTE_DIM(attr_list))
+		nb_queues = RTE_DIM(attr_list);
+	for (i = 0; i < nb_queues; i++)
+		attr_list[i] = &queue_attr;
+
+	return rte_flow_configure(port_id, &port_attr,
+			nb_queues, attr_list, error);
+}
+
+int
+async_create_table(uint16_t port_id,
+	uint32_t nb_flows,
+	uint16_t group,
+	uint64_t *flow_attrs,
+	uint64_t *flow_items,
+	uint64_t *flow_actions,
+	uint16_t dst_port,
+	uint8_t rx_queues_count,
+	bool unique_data,
+	struct rte_flow_error *error)
+{
+	struct port_template *pt = &port_templates[port_id];
+	struct rte_flow_item items[MAX_ITEMS_NUM];
+	struct rte_flow_action actions[MAX_ACTIONS_NUM];
+	struct rte_flow_pattern_template_attr pattern_attr = { 0 };
+	struct rte_flow_actions_template_attr actions_attr = { 0 };
+	struct rte_flow_template_table_attr table_attr = {
+		.nb_flows = nb_flows,
+	};
+	uint8_t i;
+
+	for (i = 0; i < MAX_ATTRS_NUM; i++) {
+		if (flow_attrs[i] == 0)
+			break;
+		if (flow_attrs[i] & INGRESS) {
+			pattern_attr.ingress = 1;
+			actions_attr.ingress = 1;
+			table_attr.flow_attr.ingress = 1;
+		} else if (flow_attrs[i] & EGRESS) {
+			pattern_attr.egress = 1;
+			actions_attr.egress = 1;
+			table_attr.flow_attr.egress = 1;
+		} else if (flow_attrs[i] & TRANSFER) {
+			pattern_attr.transfer = 1;
+			actions_attr.transfer = 1;
+			table_attr.flow_attr.transfer = 1;
+		}
+	}
+	table_attr.flow_attr.group = group;
+
+	memset(items, 0, sizeof(items));
+	fill_items(items, flow_items, 0, 0);
+	pt->pattern_template = rte_flow_pattern_template_create(port_id,
+			&pattern_attr, items, error);
+	if (pt->pattern_template == NULL)
+		return -1;
+
+	/*
+	 * The actions array doubles as the masks list: all action
+	 * fields are then template constants, values passed at the
+	 * rule enqueue time only override the per-rule ones.
+	 */
+	memset(actions, 0, sizeof(actions));
+	fill_actions(actions, flow_actions, 0, JUMP_ACTION_TABLE, 0,
+			0, 0, 0, unique_data, rx_queues_count, dst_port);
+	pt->actions_template = rte_flow_actions_template_create(port_id,
+			&actions_attr, actions, actions, error);
+	if (pt->actions_template == NULL)
+		goto out_pattern;
+
+	pt->table = rte_flow_template_table_create(port_id, &table_attr,
+			&pt->pattern_template, 1, &pt->actions_template, 1,
+			error);
+	if (pt->table == NULL)
+		goto out_actions;
+
+	return 0;
+
+out_actions:
+	rte_flow_actions_template_destroy(port_id,
+			pt->actions_template, NULL);
+	pt->actions_template = NULL;
+out_pattern:
+	rte_flow_pattern_template_destroy(port_id,
+			pt->pattern_template, NULL);
+	pt->pattern_template = NULL;
+	return -1;
+}
+
+void
+async_destroy_table(uint16_t port_id)
+{
+	struct port_template *pt = &port_templates[port_id];
+
+	if (pt->table != NULL)
+		rte_flow_template_table_destroy(port_id, pt->table, NULL);
+	if (pt->actions_template != NULL)
+		rte_flow_actions_template_destroy(port_id,
+				pt->actions_template, NULL);
+	if (pt->pattern_template != NULL)
+		rte_flow_pattern_template_destroy(port_id,
+				pt->pattern_template, NULL);
+	memset(pt, 0, sizeof(*pt));
+}
+
+struct rte_flow *
+async_gen_flow(uint16_t port_id,
+	uint32_t queue_id,
+	bool postpone,
+	uint64_t *flow_items,
+	uint64_t *flow_actions,
+	uint32_t counter,
+	uint16_t dst_port,
+	uint8_t core_idx,
+	uint8_t rx_queues_count,
+	bool unique_data,
+	struct rte_flow_error *error)
+{
+	struct rte_flow_item items[MAX_ITEMS_NUM];
+	struct rte_flow_action actions[MAX_ACTIONS_NUM];
+	const struct rte_flow_op_attr op_attr = {
+		.postpone = postpone,
+	};
+
+	memset(items, 0, sizeof(items));
+	memset(actions, 0, sizeof(actions));
+
+	fill_items(items, flow_items, counter, core_idx);
+	fill_actions(actions, flow_actions, counter, JUMP_ACTION_TABLE, 0,
+			0, 0, core_idx, unique_data, rx_queues_count,
+			dst_port);
+
+	return rte_flow_async_create(port_id, queue_id, &op_attr,
+			port_templates[port_id].table, items, 0,
+			actions, 0, NULL, error);
+}
+
+int
+async_flow_destroy(uint16_t port_id,
+	uint32_t queue_id,
+	bool postpone,
+	struct rte_flow *flow,
+	struct rte_flow_error *error)
+{
+	const struct rte_flow_op_attr op_attr = {
+		.postpone = postpone,
+	};
+
+	return rte_flow_async_destroy(port_id, queue_id, &op_attr,
+			flow, NULL, error);
+}
+
+/*
+ * Push any postponed operations and wait for @p pending completions.
+ * Returns the count of failed operations, or a negative errno value
+ * if push/pull itself failed.
+ */
+int
+async_drain_queue(uint16_t port_id,
+	uint32_t queue_id,
+	uint32_t pending,
+	struct rte_flow_error *error)
+{
+	struct rte_flow_op_result res[ASYNC_PULL_BURST];
+	uint32_t failed = 0;
+	int ret, i;
+
+	ret = rte_flow_push(port_id, queue_id, error);
+	if (ret < 0)
+		return ret;
+
+	while (pending > 0) {
+		ret = rte_flow_pull(port_id, queue_id, res,
+				RTE_MIN(pending, (uint32_t)ASYNC_PULL_BURST),
+				error);
+		if (ret < 0)
+			return ret;
+		for (i = 0; i < ret; i++) {
+			if (res[i].status != RTE_FLOW_OP_SUCCESS)
+				failed++;
+		}
+		pending -= ret;
+	}
+	return failed;
+}
@@ -0,0 +1,64 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright 2025 Mellanox Technologies, Ltd
+ *
+ * This file contains the methods to benchmark the template
+ * (asynchronous) flow API: flow queue configuration, template
+ * table pre-allocation and the enqueue/drain helpers.
+ */
+
+#ifndef FLOW_PERF_ASYNC_GEN
+#define FLOW_PERF_ASYNC_GEN
+
+#include <stdint.h>
+#include <rte_flow.h>
+
+#include "config.h"
+
+int
+async_setup_queues(uint16_t port_id,
+	uint16_t nb_queues,
+	uint32_t queue_size,
+	struct rte_flow_error *error);
+
+int
+async_create_table(uint16_t port_id,
+	uint32_t nb_flows,
+	uint16_t group,
+	uint64_t *flow_attrs,
+	uint64_t *flow_items,
+	uint64_t *flow_actions,
+	uint16_t dst_port,
+	uint8_t rx_queues_count,
+	bool unique_data,
+	struct rte_flow_error *error);
+
+void
+async_destroy_table(uint16_t port_id);
+
+struct rte_flow *
+async_gen_flow(uint16_t port_id,
+	uint32_t queue_id,
+	bool postpone,
+	uint64_t *flow_items,
+	uint64_t *flow_actions,
+	uint32_t counter,
+	uint16_t dst_port,
+	uint8_t core_idx,
+	uint8_t rx_queues_count,
+	bool unique_data,
+	struct rte_flow_error *error);
+
+int
+async_flow_destroy(uint16_t port_id,
+	uint32_t queue_id,
+	bool postpone,
+	struct rte_flow *flow,
+	struct rte_flow_error *error);
+
+int
+async_drain_queue(uint16_t port_id,
+	uint32_t queue_id,
+	uint32_t pending,
+	struct rte_flow_error *error);
+
+#endif /* FLOW_PERF_ASYNC_GEN */
@@ -40,11 +40,13 @@
 #include "config.h"
 #include "actions_gen.h"
 #include "flow_gen.h"
+#include "async_gen.h"
 
 #define MAX_BATCHES_COUNT          100
 #define DEFAULT_RULES_COUNT    4000000
 #define DEFAULT_RULES_BATCH     100000
 #define DEFAULT_GROUP                0
+#define DEFAULT_FLOW_QUEUE_SIZE    128
 
 #define HAIRPIN_RX_CONF_FORCE_MEMORY  (0x0001)
 #define HAIRPIN_TX_CONF_FORCE_MEMORY  (0x0002)
@@ -80,6 +82,12 @@ static bool enable_fwd;
 static bool unique_data;
 static bool policy_mtr;
 static bool packet_mode;
+static bool async_mode;
+
+static uint16_t flow_queues_count;
+static uint32_t flow_queue_size;
+static uint32_t postpone_batch;
+static uint32_t churn_count;
 
 static uint8_t rx_queues_count;
 static uint8_t tx_queues_count;
@@ -502,6 +510,21 @@ usage(char *progname)
 		" profile, default values are %d,%d,%d\n", METER_CIR,
 		METER_CIR / 8, 0);
 	printf("  --packet-mode: to enable packet mode for meter profile\n");
+	printf("  --async: use the template (async) flow API for"
+		" insertion and deletion, the template table is"
+		" pre-allocated with rules-count capacity\n");
+	printf("  --flow-queues=N: set the count of flow queues for"
+		" async insertion, default is 1, raised to the cores"
+		" count so each core owns a queue\n");
+	printf("  --flow-queue-size=N: set the number of operations"
+		" a flow queue can hold, default is %d\n",
+		DEFAULT_FLOW_QUEUE_SIZE);
+	printf("  --postpone-batch=N: enqueue N postponed operations"
+		" before pushing them to hardware, default is 1"
+		" (push on every operation)\n");
+	printf("  --churn=N: after insertion, replace N rules per core"
+		" (delete + re-create) while keeping the rule count at"
+		" steady state, async mode only\n");
 
 	printf("To set flow attributes:\n");
 	printf("  --ingress: set ingress attribute in flows\n");
@@ -671,6 +694,11 @@ args_parse(int argc, char **argv)
 		{ "mbuf-size",                  1, 0, 0 },
 		{ "mbuf-cache-size",            1, 0, 0 },
 		{ "total-mbuf-count",           1, 0, 0 },
+		{ "async",                      0, 0, 0 },
+		{ "flow-queues",                1, 0, 0 },
+		{ "flow-queue-size",            1, 0, 0 },
+		{ "postpone-batch",             1, 0, 0 },
+		{ "churn",                      1, 0, 0 },
 		/* Attributes */
 		{ "ingress",                    0, 0, 0 },
 		{ "egress",                     0, 0, 0 },
@@ -944,6 +972,41 @@ args_parse(int argc, char **argv)
 				n = atoi(optarg);
 				total_mbuf_num = (uint32_t) n;
 			}
+			if (strcmp(lgopts[opt_idx].name, "async") == 0)
+				async_mode = true;
+			if (strcmp(lgopts[opt_idx].name, "flow-queues") == 0) {
+				n = atoi(optarg);
+				if (n > 0 && n <= RTE_MAX_LCORE)
+					flow_queues_count = (uint16_t) n;
+				else
+					rte_exit(EXIT_FAILURE,
+						"flow-queues should be > 0 and <= %d\n",
+						RTE_MAX_LCORE);
+			}
+			if (strcmp(lgopts[opt_idx].name, "flow-queue-size") == 0) {
+				n = atoi(optarg);
+				if (n > 0)
+					flow_queue_size = (uint32_t) n;
+				else
+					rte_exit(EXIT_FAILURE,
+						"flow-queue-size should be > 0\n");
+			}
+			if (strcmp(lgopts[opt_idx].name, "postpone-batch") == 0) {
+				n = atoi(optarg);
+				if (n > 0)
+					postpone_batch = (uint32_t) n;
+				else
+					rte_exit(EXIT_FAILURE,
+						"postpone-batch should be > 0\n");
+			}
+			if (strcmp(lgopts[opt_idx].name, "churn") == 0) {
+				n = atoi(optarg);
+				if (n > 0)
+					churn_count = (uint32_t) n;
+				else
+					rte_exit(EXIT_FAILURE,
+						"churn should be > 0\n");
+			}
 			if (strcmp(lgopts[opt_idx].name, "cores") == 0) {
 				n = atoi(optarg);
 				if ((int) rte_lcore_count() <= n) {
@@ -991,6 +1054,19 @@ args_parse(int argc, char **argv)
 			 "rules_count / rules_batch should be <= %d\n",
 			 MAX_BATCHES_COUNT);
 	}
+	if (!async_mode && (flow_queues_count > 1 || postpone_batch > 1 ||
+			churn_count != 0))
+		rte_exit(EXIT_FAILURE,
+			 "flow-queues, postpone-batch and churn need --async\n");
+	if (postpone_batch > flow_queue_size)
+		rte_exit(EXIT_FAILURE,
+			 "postpone-batch should be <= flow-queue-size\n");
+	if (async_mode && flow_queues_count < mc_pool.cores_count) {
+		/* Flow queues are not thread safe, one per core at least. */
+		flow_queues_count = mc_pool.cores_count;
+		printf(":: Raised flow queues count to %d, one per core\n",
+			flow_queues_count);
+	}
 
 	printf("end_flow\n");
 }
@@ -1326,12 +1402,13 @@ destroy_flows(int port_id, uint8_t core_id, struct rte_flow **flows_list)
 	double cpu_time_per_batch[MAX_BATCHES_COUNT] = { 0 };
 	double delta;
 	uint32_t i;
+	uint32_t pending = 0;
 	int rules_batch_idx;
 	int rules_count_per_core;
 
 	rules_count_per_core = rules_count / mc_pool.cores_count;
 	/* If group > 0 , should add 1 flow which created in group 0 */
-	if (flow_group > 0 && core_id == 0)
+	if (flow_group > 0 && core_id == 0 && !async_mode)
 		rules_count_per_core++;
 
 	start_batch = rte_get_timer_cycles();
@@ -1340,7 +1417,24 @@ destroy_flows(int port_id, uint8_t core_id, struct rte_flow **flows_list)
 			break;
 
 		memset(&error, 0x33, sizeof(error));
-		if (rte_flow_destroy(port_id, flows_list[i], &error)) {
+		if (async_mode) {
+			if (async_flow_destroy(port_id, core_id,
+					postpone_batch > 1, flows_list[i],
+					&error)) {
+				print_flow_error(error);
+				rte_exit(EXIT_FAILURE, "Error in deleting flow\n");
+			}
+			pending++;
+			if (pending >= postpone_batch) {
+				if (async_drain_queue(port_id, core_id,
+						pending, &error) != 0) {
+					print_flow_error(error);
+					rte_exit(EXIT_FAILURE,
+						"Error in deleting flow\n");
+				}
+				pending = 0;
+			}
+		} else if (rte_flow_destroy(port_id, flows_list[i], &error)) {
 			print_flow_error(error);
 			rte_exit(EXIT_FAILURE, "Error in deleting flow\n");
 		}
@@ -1361,6 +1455,12 @@ destroy_flows(int port_id, uint8_t core_id, struct rte_flow **flows_list)
 		}
 	}
 
+	if (pending != 0 &&
+	    async_drain_queue(port_id, core_id, pending, &error) != 0) {
+		print_flow_error(error);
+		rte_exit(EXIT_FAILURE, "Error in deleting flow\n");
+	}
+
 	/* Print deletion rates for all batches */
 	if (dump_iterations)
 		print_rules_batches(cpu_time_per_batch);
@@ -1387,6 +1487,7 @@ insert_flows(int port_id, uint8_t core_id, uint16_t dst_port_id)
 	double cpu_time_per_batch[MAX_BATCHES_COUNT] = { 0 };
 	double delta;
 	uint32_t flow_index;
+	uint32_t pending;
 	uint32_t counter, start_counter = 0, end_counter;
 	uint64_t global_items[MAX_ITEMS_NUM] = { 0 };
 	uint64_t global_actions[MAX_ACTIONS_NUM] = { 0 };
@@ -1411,36 +1512,65 @@ insert_flows(int port_id, uint8_t core_id, uint16_t dst_port_id)
 	cpu_time_used = 0;
 	flow_index = 0;
 	if (flow_group > 0 && core_id == 0) {
-		/*
-		 * Create global rule to jump into flow_group,
-		 * this way the app will avoid the default rules.
-		 *
-		 * This rule will be created only once.
-		 *
-		 * Global rule:
-		 * group 0 eth / end actions jump group <flow_group>
-		 */
-		flow = generate_flow(port_id, 0, flow_attrs,
-			global_items, global_actions,
-			flow_group, 0, 0, 0, 0, dst_port_id, core_id,
-			rx_queues_count, unique_data, max_priority, &error);
-
-		if (flow == NULL) {
-			print_flow_error(error);
-			rte_exit(EXIT_FAILURE, "Error in creating flow\n");
+		if (async_mode) {
+			/* Async rules go to flow_group via the table. */
+			printf(":: Skipping the global jump rule,"
+				" async rules go directly to group %d\n",
+				flow_group);
+		} else {
+			/*
+			 * Create global rule to jump into flow_group,
+			 * this way the app will avoid the default rules.
+			 *
+			 * This rule will be created only once.
+			 *
+			 * Global rule:
+			 * group 0 eth / end actions jump group <flow_group>
+			 */
+			flow = generate_flow(port_id, 0, flow_attrs,
+				global_items, global_actions,
+				flow_group, 0, 0, 0, 0, dst_port_id, core_id,
+				rx_queues_count, unique_data, max_priority,
+				&error);
+
+			if (flow == NULL) {
+				print_flow_error(error);
+				rte_exit(EXIT_FAILURE, "Error in creating flow\n");
+			}
+			flows_list[flow_index++] = flow;
 		}
-		flows_list[flow_index++] = flow;
 	}
 
+	pending = 0;
 	start_batch = rte_get_timer_cycles();
 	for (counter = start_counter; counter < end_counter; counter++) {
-		flow = generate_flow(port_id, flow_group,
-			flow_attrs, flow_items, flow_actions,
-			JUMP_ACTION_TABLE, counter,
-			hairpin_queues_num, encap_data,
-			decap_data, dst_port_id,
-			core_id, rx_queues_count,
-			unique_data, max_priority, &error);
+		if (async_mode)
+			flow = async_gen_flow(port_id, core_id,
+				postpone_batch > 1, flow_items,
+				flow_actions, counter, dst_port_id,
+				core_id, rx_queues_count,
+				unique_data, &error);
+		else
+			flow = generate_flow(port_id, flow_group,
+				flow_attrs, flow_items, flow_actions,
+				JUMP_ACTION_TABLE, counter,
+				hairpin_queues_num, encap_data,
+				decap_data, dst_port_id,
+				core_id, rx_queues_count,
+				unique_data, max_priority, &error);
+
+		if (async_mode && flow != NULL) {
+			pending++;
+			if (!counter || pending >= postpone_batch) {
+				if (async_drain_queue(port_id, core_id,
+						pending, &error) != 0) {
+					print_flow_error(error);
+					rte_exit(EXIT_FAILURE,
+						"Error in creating flow\n");
+				}
+				pending = 0;
+			}
+		}
 
 		if (!counter) {
 			first_flow_latency = (double) (rte_get_timer_cycles() - start_batch);
@@ -1478,6 +1608,12 @@ insert_flows(int port_id, uint8_t core_id, uint16_t dst_port_id)
 		}
 	}
 
+	if (pending != 0 &&
+	    async_drain_queue(port_id, core_id, pending, &error) != 0) {
+		print_flow_error(error);
+		rte_exit(EXIT_FAILURE, "Error in creating flow\n");
+	}
+
 	/* Print insertion rates for all batches */
 	if (dump_iterations)
 		print_rules_batches(cpu_time_per_batch);
@@ -1496,6 +1632,74 @@ insert_flows(int port_id, uint8_t core_id, uint16_t dst_port_id)
 	return flows_list;
 }
 
+/*
+ * Replace rules in place: enqueue a destruction and a re-creation
+ * for rules already installed by this core, so the rule count stays
+ * at the steady-state target while the hardware handles the churn.
+ */
+static void
+churn_handler(int port_id, uint8_t core_id,
+	struct rte_flow **flows_list, uint16_t dst_port_id)
+{
+	struct rte_flow_error error;
+	struct rte_flow *flow;
+	double cpu_time_used, churn_rate;
+	uint64_t start_cycles;
+	uint32_t counter, idx, i;
+	uint32_t pending = 0;
+	uint32_t rules_count_per_core;
+	bool postpone = postpone_batch > 1;
+
+	rules_count_per_core = rules_count / mc_pool.cores_count;
+
+	start_cycles = rte_get_timer_cycles();
+	for (i = 0; i < churn_count && !force_quit; i++) {
+		idx = i % rules_count_per_core;
+		counter = core_id * rules_count_per_core + idx;
+
+		memset(&error, 0x33, sizeof(error));
+		if (async_flow_destroy(port_id, core_id, postpone,
+				flows_list[idx], &error)) {
+			print_flow_error(error);
+			rte_exit(EXIT_FAILURE, "Error in deleting flow\n");
+		}
+
+		flow = async_gen_flow(port_id, core_id, postpone,
+				flow_items, flow_actions, counter,
+				dst_port_id, core_id, rx_queues_count,
+				unique_data, &error);
+		if (flow == NULL) {
+			print_flow_error(error);
+			rte_exit(EXIT_FAILURE, "Error in creating flow\n");
+		}
+		flows_list[idx] = flow;
+
+		pending += 2;
+		if (pending >= postpone_batch) {
+			if (async_drain_queue(port_id, core_id,
+					pending, &error) != 0) {
+				print_flow_error(error);
+				rte_exit(EXIT_FAILURE,
+					"Error in replacing flow\n");
+			}
+			pending = 0;
+		}
+	}
+
+	if (pending != 0 &&
+	    async_drain_queue(port_id, core_id, pending, &error) != 0) {
+		print_flow_error(error);
+		rte_exit(EXIT_FAILURE, "Error in replacing flow\n");
+	}
+
+	cpu_time_used = ((double)(rte_get_timer_cycles() - start_cycles))
+		/ rte_get_timer_hz();
+	churn_rate = ((double)(i / cpu_time_used) / 1000);
+	printf(":: Port %d :: Core %d :: Churn rate -> %f K Replacements/Sec"
+		" [%d replacements @ %d steady-state rules]\n",
+		port_id, core_id, churn_rate, i, rules_count_per_core);
+}
+
 static void
 flows_handler(uint8_t core_id)
 {
@@ -1526,6 +1730,11 @@ flows_handler(uint8_t core_id)
 			rte_exit(EXIT_FAILURE, "Error: Insertion Failed!\n");
 		mc_pool.current_alloc[core_id] = (int64_t)dump_socket_mem(stdout);
 
+		/* Churn part, async mode only. */
+		if (churn_count != 0)
+			churn_handler(port_id, core_id, flows_list,
+						dst_ports[port_idx - 1]);
+
 		/* Deletion part. */
 		if (delete_flag) {
 			destroy_flows(port_id, core_id, flows_list);
@@ -2038,6 +2247,17 @@ init_port(void)
 					ret, port_id);
 		}
 
+		if (async_mode) {
+			struct rte_flow_error flow_error;
+
+			ret = async_setup_queues(port_id, flow_queues_count,
+					flow_queue_size, &flow_error);
+			if (ret < 0)
+				rte_exit(EXIT_FAILURE,
+					":: Flow queues setup failed: err=%d, port=%u\n",
+					ret, port_id);
+		}
+
 		/* Catch all packets from traffic generator. */
 		ret = rte_eth_promiscuous_enable(port_id);
 		if (ret != 0)
@@ -2123,6 +2343,11 @@ main(int argc, char **argv)
 	dump_socket_mem_flag = false;
 	flow_group = DEFAULT_GROUP;
 	unique_data = false;
+	async_mode = false;
+	flow_queues_count = 1;
+	flow_queue_size = DEFAULT_FLOW_QUEUE_SIZE;
+	postpone_batch = 1;
+	churn_count = 0;
 
 	rx_queues_count = (uint8_t) RXQ_NUM;
 	tx_queues_count = (uint8_t) TXQ_NUM;
@@ -2153,6 +2378,28 @@ main(int argc, char **argv)
 
 	rte_srand(rand_seed);
 
+	if (async_mode) {
+		struct rte_flow_error flow_error;
+		uint16_t port_idx = 0;
+
+		/*
+		 * Pre-allocate the template tables with the full
+		 * rule-count capacity before any rule is enqueued.
+		 */
+		RTE_ETH_FOREACH_DEV(port) {
+			if (!((ports_mask >> port) & 0x1))
+				continue;
+			if (async_create_table(port, rules_count, flow_group,
+					flow_attrs, flow_items, flow_actions,
+					dst_ports[port_idx++], rx_queues_count,
+					unique_data, &flow_error) < 0) {
+				print_flow_error(flow_error);
+				rte_exit(EXIT_FAILURE,
+					"Error: Template table creation Failed!\n");
+			}
+		}
+	}
+
 	if (has_meter()) {
 		create_meter_profile();
 		if (policy_mtr)
@@ -2169,6 +2416,13 @@ main(int argc, char **argv)
 		if (policy_mtr)
 			destroy_meter_policy();
 	}
+	if (async_mode && delete_flag) {
+		RTE_ETH_FOREACH_DEV(port) {
+			if (!((ports_mask >> port) & 0x1))
+				continue;
+			async_destroy_table(port);
+		}
+	}
 
 	RTE_ETH_FOREACH_DEV(port) {
 		rte_flow_flush(port, &error);
@@ -0,0 +1,341 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2025 Intel Corporation
+ */
+
+#include <stdarg.h>
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <inttypes.h>
+
+#include <sys/queue.h>
+#include <sys/stat.h>
+
+#include <rte_common.h>
+#include <rte_byteorder.h>
+#include <rte_bitops.h>
+#include <rte_log.h>
+#include <rte_debug.h>
+#include <rte_cycles.h>
+#include <rte_malloc.h>
+#include <rte_memory.h>
+#include <rte_memcpy.h>
+#include <rte_launch.h>
+#include <rte_eal.h>
+#include <rte_per_lcore.h>
+#include <rte_lcore.h>
+#include <rte_branch_prediction.h>
+#include <rte_mempool.h>
+#include <rte_mbuf.h>
+#include <rte_mbuf_dyn.h>
+#include <rte_interrupts.h>
+#include <rte_ether.h>
+#include <rte_ethdev.h>
+#include <rte_ip.h>
+#include <rte_udp.h>
+#include <rte_string_fns.h>
+#include <rte_flow.h>
+
+#include "testpmd.h"
+
+static uint32_t cfg_ip_src	= RTE_IPV4(10, 252, 0, 1);
+static uint32_t cfg_ip_dst	= RTE_IPV4(10, 251, 0, 1);
+static uint16_t cfg_udp_src	= 1024;
+static uint16_t cfg_udp_dst	= 1025;
+
+#define IP_DEFTTL  64   /* from RFC 1340. */
+
+/* In-packet probe carried through the DUT loop. */
+struct __rte_packed_begin lat_probe {
+	uint64_t magic;
+	uint64_t ts;
+} __rte_packed_end;
+
+#define LAT_MAGIC UINT64_C(0x4c41544657442121) /* "LATFWD!!" */
+
+#define LAT_PKT_MIN_LEN (sizeof(struct rte_ether_hdr) + \
+		sizeof(struct rte_ipv4_hdr) + sizeof(struct rte_udp_hdr) + \
+		sizeof(struct lat_probe))
+
+/* Log-linear (HDR style) histogram of latencies in nanoseconds:
+ * LAT_HIST_SUB linear sub-buckets per power-of-two group, covering
+ * [0, ~4s) with a relative error bounded by 1/LAT_HIST_SUB.
+ */
+#define LAT_HIST_SUB_BITS 4
+#define LAT_HIST_SUB (1 << LAT_HIST_SUB_BITS)
+#define LAT_HIST_GROUPS 28
+#define LAT_HIST_BUCKETS (LAT_HIST_GROUPS * LAT_HIST_SUB)
+
+struct lat_queue_stats {
+	uint64_t count;
+	uint64_t sum_ns;
+	uint64_t min_ns;
+	uint64_t max_ns;
+	uint64_t hist[LAT_HIST_BUCKETS];
+};
+
+struct lat_port_cfg {
+	bool hw_clock; /* use the device clock and Rx timestamp offload */
+	uint64_t clock_hz;
+	struct lat_queue_stats *q; /* one per Rx queue */
+};
+
+static struct lat_port_cfg *lat_cfg[RTE_MAX_ETHPORTS];
+
+/* Rx timestamp dynamic field, registered when the offload is enabled */
+static int lat_hwts_off = -1;
+static uint64_t lat_hwts_flag;
+
+static inline unsigned int
+lat_hist_idx(uint64_t v)
+{
+	unsigned int msb, group;
+
+	if (v < LAT_HIST_SUB)
+		return v;
+	msb = 63 - rte_clz64(v);
+	group = msb - LAT_HIST_SUB_BITS + 1;
+	if (group >= LAT_HIST_GROUPS)
+		return LAT_HIST_BUCKETS - 1;
+	return group * LAT_HIST_SUB +
+		((v >> (msb - LAT_HIST_SUB_BITS)) & (LAT_HIST_SUB - 1));
+}
+
+/* Lower bound of a histogram bucket, used as its reported value. */
+static uint64_t
+lat_hist_bound(unsigned int idx)
+{
+	unsigned int group = idx / LAT_HIST_SUB;
+	unsigned int sub = idx % LAT_HIST_SUB;
+
+	if (group == 0)
+		return sub;
+	return (uint64_t)(LAT_HIST_SUB + sub) << (group - 1);
+}
+
+static uint64_t
+lat_hist_percentile(const struct lat_queue_stats *qs, double pct)
+{
+	uint64_t target = (uint64_t)(qs->count * pct);
+	uint64_t acc = 0;
+	unsigned int i;
+
+	for (i = 0; i < LAT_HIST_BUCKETS; i++) {
+		acc += qs->hist[i];
+		if (acc > target)
+			return lat_hist_bound(i);
+	}
+	return qs->max_ns;
+}
+
+static inline void
+lat_record(struct lat_queue_stats *qs, uint64_t ns)
+{
+	qs->count++;
+	qs->sum_ns += ns;
+	if (ns < qs->min_ns)
+		qs->min_ns = ns;
+	if (ns > qs->max_ns)
+		qs->max_ns = ns;
+	qs->hist[lat_hist_idx(ns)]++;
+}
+
+static inline uint64_t
+lat_clock_now(const struct lat_port_cfg *cfg, portid_t pi)
+{
+	uint64_t clk;
+
+	if (cfg->hw_clock) {
+		if (rte_eth_read_clock(pi, &clk) == 0)
+			return clk;
+		return 0;
+	}
+	return rte_rdtsc();
+}
+
+/*
+ * Latency measurement mode.
+ *
+ * Originate UDP packets carrying a timestamp probe in their payload,
+ * expect them back from an external DUT loop, and record the round trip
+ * time of each matched packet into a per-stream histogram. Uses the
+ * device clock and the Rx timestamp offload when enabled on the port,
+ * the TSC otherwise.
+ */
+static bool
+pkt_burst_latency(struct fwd_stream *fs)
+{
+	uint16_t pkt_size = RTE_MAX((unsigned int)tx_pkt_length - 4,
+			LAT_PKT_MIN_LEN);	/* Adjust FCS */
+	struct rte_mbuf *pkts_burst[MAX_PKT_BURST];
+	struct lat_port_cfg *cfg = lat_cfg[fs->rx_port];
+	struct lat_queue_stats *qs = &cfg->q[fs->rx_queue];
+	struct rte_ether_hdr *eth_hdr;
+	struct rte_ipv4_hdr *ip_hdr;
+	struct rte_udp_hdr *udp_hdr;
+	struct lat_probe *probe;
+	struct rte_mempool *mbp;
+	struct rte_mbuf *pkt;
+	uint64_t now, ticks, ns;
+	uint16_t nb_rx, nb_pkt;
+	uint16_t i;
+
+	/* Receive returning probes and record their round trip time. */
+	nb_rx = common_fwd_stream_receive(fs, pkts_burst, nb_pkt_per_burst);
+
+	now = lat_clock_now(cfg, fs->rx_port);
+	for (i = 0; i < nb_rx; i++) {
+		pkt = pkts_burst[i];
+		if (rte_pktmbuf_data_len(pkt) < LAT_PKT_MIN_LEN)
+			continue;
+		probe = rte_pktmbuf_mtod_offset(pkt, struct lat_probe *,
+				LAT_PKT_MIN_LEN - sizeof(*probe));
+		if (probe->magic != LAT_MAGIC)
+			continue;
+
+		if (cfg->hw_clock && (pkt->ol_flags & lat_hwts_flag))
+			ticks = *RTE_MBUF_DYNFIELD(pkt, lat_hwts_off,
+					uint64_t *) - probe->ts;
+		else
+			ticks = now - probe->ts;
+
+		ns = (ticks * NS_PER_S) / cfg->clock_hz;
+		lat_record(qs, ns);
+	}
+	rte_pktmbuf_free_bulk(pkts_burst, nb_rx);
+
+	/* Originate a fresh burst of probes. */
+	mbp = current_fwd_lcore()->mbp;
+	for (nb_pkt = 0; nb_pkt < nb_pkt_per_burst; nb_pkt++) {
+		pkt = rte_mbuf_raw_alloc(mbp);
+		if (pkt == NULL)
+			break;
+
+		pkt->data_len = pkt_size;
+		pkt->next = NULL;
+
+		eth_hdr = rte_pktmbuf_mtod(pkt, struct rte_ether_hdr *);
+		rte_ether_addr_copy(&peer_eth_addrs[fs->peer_addr],
+				&eth_hdr->dst_addr);
+		rte_ether_addr_copy(&ports[fs->tx_port].eth_addr,
+				&eth_hdr->src_addr);
+		eth_hdr->ether_type = rte_cpu_to_be_16(RTE_ETHER_TYPE_IPV4);
+
+		ip_hdr = (struct rte_ipv4_hdr *)(eth_hdr + 1);
+		memset(ip_hdr, 0, sizeof(*ip_hdr));
+		ip_hdr->version_ihl	= RTE_IPV4_VHL_DEF;
+		ip_hdr->time_to_live	= IP_DEFTTL;
+		ip_hdr->next_proto_id	= IPPROTO_UDP;
+		ip_hdr->src_addr	= rte_cpu_to_be_32(cfg_ip_src);
+		ip_hdr->dst_addr	= rte_cpu_to_be_32(cfg_ip_dst);
+		ip_hdr->total_length	= RTE_CPU_TO_BE_16(pkt_size -
+							   sizeof(*eth_hdr));
+		ip_hdr->hdr_checksum	= rte_ipv4_cksum(ip_hdr);
+
+		udp_hdr = (struct rte_udp_hdr *)(ip_hdr + 1);
+		udp_hdr->src_port	= rte_cpu_to_be_16(cfg_udp_src +
+							   fs->rx_queue);
+		udp_hdr->dst_port	= rte_cpu_to_be_16(cfg_udp_dst);
+		udp_hdr->dgram_cksum	= 0; /* No UDP checksum. */
+		udp_hdr->dgram_len	= RTE_CPU_TO_BE_16(pkt_size -
+							   sizeof(*eth_hdr) -
+							   sizeof(*ip_hdr));
+
+		probe = (struct lat_probe *)(udp_hdr + 1);
+		probe->magic = LAT_MAGIC;
+		probe->ts = lat_clock_now(cfg, fs->tx_port);
+
+		pkt->nb_segs	= 1;
+		pkt->pkt_len	= pkt_size;
+		pkt->ol_flags	&= RTE_MBUF_F_EXTERNAL;
+		pkt->l2_len	= sizeof(struct rte_ether_hdr);
+		pkt->l3_len	= sizeof(struct rte_ipv4_hdr);
+
+		pkts_burst[nb_pkt] = pkt;
+	}
+
+	common_fwd_stream_transmit(fs, pkts_burst, nb_pkt);
+
+	return true;
+}
+
+static int
+latency_fwd_begin(portid_t pi)
+{
+	struct lat_port_cfg *cfg;
+	queueid_t q;
+
+	cfg = rte_zmalloc("latfwd", sizeof(*cfg) +
+			(size_t)nb_rxq * sizeof(*cfg->q), RTE_CACHE_LINE_SIZE);
+	if (cfg == NULL) {
+		fprintf(stderr, "latfwd: no memory for port %u stats\n", pi);
+		return -ENOMEM;
+	}
+	cfg->q = (struct lat_queue_stats *)(cfg + 1);
+	for (q = 0; q < nb_rxq; q++)
+		cfg->q[q].min_ns = UINT64_MAX;
+
+	/* Prefer the device clock when Rx timestamping is enabled. */
+	if ((ports[pi].dev_conf.rxmode.offloads &
+	     RTE_ETH_RX_OFFLOAD_TIMESTAMP) &&
+	    rte_mbuf_dyn_rx_timestamp_register(&lat_hwts_off,
+			&lat_hwts_flag) == 0) {
+		uint64_t c0, c1;
+
+		if (rte_eth_read_clock(pi, &c0) == 0) {
+			rte_delay_ms(10);
+			if (rte_eth_read_clock(pi, &c1) == 0 && c1 > c0) {
+				cfg->hw_clock = true;
+				cfg->clock_hz = (c1 - c0) * 100;
+			}
+		}
+	}
+	if (!cfg->hw_clock)
+		cfg->clock_hz = rte_get_tsc_hz();
+
+	printf("  latfwd port %u: %s clock at %" PRIu64 " Hz\n", pi,
+	       cfg->hw_clock ? "device" : "TSC", cfg->clock_hz);
+
+	lat_cfg[pi] = cfg;
+	return 0;
+}
+
+static void
+latency_fwd_end(portid_t pi)
+{
+	struct lat_port_cfg *cfg = lat_cfg[pi];
+	struct lat_queue_stats *qs;
+	queueid_t q;
+
+	if (cfg == NULL)
+		return;
+
+	for (q = 0; q < nb_rxq; q++) {
+		qs = &cfg->q[q];
+		if (qs->count == 0)
+			continue;
+		printf("  latfwd port %u queue %u: %" PRIu64 " samples\n"
+		       "    min/avg/max: %" PRIu64 "/%" PRIu64 "/%" PRIu64 " ns\n"
+		       "    p50/p90/p99/p99.9: %" PRIu64 "/%" PRIu64
+		       "/%" PRIu64 "/%" PRIu64 " ns\n",
+		       pi, q, qs->count,
+		       qs->min_ns, qs->sum_ns / qs->count, qs->max_ns,
+		       lat_hist_percentile(qs, 0.50),
+		       lat_hist_percentile(qs, 0.90),
+		       lat_hist_percentile(qs, 0.99),
+		       lat_hist_percentile(qs, 0.999));
+	}
+
+	lat_cfg[pi] = NULL;
+	rte_free(cfg);
+}
+
+struct fwd_engine latency_fwd_engine = {
+	.fwd_mode_name  = "latfwd",
+	.port_fwd_begin = latency_fwd_begin,
+	.port_fwd_end   = latency_fwd_end,
+	.stream_init    = common_fwd_stream_init,
+	.packet_fwd     = pkt_burst_latency,
+};
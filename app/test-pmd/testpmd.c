@@ -193,6 +193,7 @@ struct fwd_engine * fwd_engines[] = {
 	&mac_fwd_engine,
 	&mac_swap_engine,
 	&flow_gen_engine,
+	&latency_fwd_engine,
 	&rx_only_engine,
 	&tx_only_engine,
 	&csum_fwd_engine,
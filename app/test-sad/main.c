@@ -55,6 +55,7 @@ static struct {
 	int		verbose;
 	int		parallel_lookup;
 	int		concurrent_rw;
+	int		spi_only;
 } config = {
 	.rules_file = NULL,
 	.tuples_file = NULL,
@@ -72,7 +73,8 @@ static struct {
 	.ipv6 = 0,
 	.verbose = 0,
 	.parallel_lookup = 0,
-	.concurrent_rw = 0
+	.concurrent_rw = 0,
+	.spi_only = 0
 };
 
 enum {
@@ -148,7 +150,8 @@ print_usage(void)
 		"[-b <lookup burst size: 1-64 >]\n"
 		"[-v <verbose, print results on lookup>]\n"
 		"[-p <parallel lookup on all available cores>]\n"
-		"[-c <init sad supporting read/write concurrency>]\n",
+		"[-c <init sad supporting read/write concurrency>]\n"
+		"[-s <init sad in SPI_ONLY mode, implies -d 100/0/0>]\n",
 		config.prgname);
 
 }
@@ -356,7 +359,7 @@ parse_opts(int argc, char **argv)
 	int opt, ret;
 	char *endptr;
 
-	while ((opt = getopt(argc, argv, "f:t:n:d:l:r:6b:vpc")) != -1) {
+	while ((opt = getopt(argc, argv, "f:t:n:d:l:r:6b:vpcs")) != -1) {
 		switch (opt) {
 		case 'f':
 			config.rules_file = optarg;
@@ -421,6 +424,9 @@ parse_opts(int argc, char **argv)
 		case 'c':
 			config.concurrent_rw = 1;
 			break;
+		case 's':
+			config.spi_only = 1;
+			break;
 		default:
 			print_usage();
 			rte_exit(-EINVAL, "Invalid options\n");
@@ -627,6 +633,12 @@ main(int argc, char **argv)
 	config.prgname = argv[0];
 
 	parse_opts(argc, argv);
+	if (config.spi_only) {
+		/* SPI_ONLY table accepts 32-bit rules exclusively */
+		config.fract_32 = 100;
+		config.fract_64 = 0;
+		config.fract_96 = 0;
+	}
 	tbl_init(&rules_tbl, &config.nb_rules, config.rules_file, 1);
 	tbl_init(&tuples_tbl, &config.nb_tuples, config.tuples_file, 0);
 	if (config.rules_file != NULL) {
@@ -646,6 +658,12 @@ main(int argc, char **argv)
 		conf.flags |= RTE_IPSEC_SAD_FLAG_IPV6;
 	if (config.concurrent_rw)
 		conf.flags |= RTE_IPSEC_SAD_FLAG_RW_CONCURRENCY;
+	if (config.spi_only) {
+		if (config.fract_64 != 0 || config.fract_96 != 0)
+			rte_exit(-EINVAL,
+				"SPI_ONLY mode takes SPI-only rules exclusively\n");
+		conf.flags |= RTE_IPSEC_SAD_FLAG_SPI_ONLY;
+	}
 	sad = rte_ipsec_sad_create("test", &conf);
 	if (sad == NULL)
 		rte_exit(-rte_errno, "can not allocate SAD table\n");
@@ -0,0 +1,254 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2025 Intel Corporation
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rte_common.h>
+#include <rte_cycles.h>
+#include <rte_string_fns.h>
+#ifdef RTE_LIB_PMU
+#include <rte_pmu.h>
+#endif
+
+#include "bench_harness.h"
+
+struct bench_sample {
+	uint64_t cycles;
+	uint64_t pmu[BENCH_MAX_PMU_EVENTS];
+};
+
+static unsigned int nb_pmu_events;
+static const char *pmu_name[BENCH_MAX_PMU_EVENTS];
+static int pmu_event[BENCH_MAX_PMU_EVENTS];
+static bool pmu_setup_done;
+
+static void
+bench_pmu_setup(void)
+{
+	if (pmu_setup_done)
+		return;
+	pmu_setup_done = true;
+
+#ifdef RTE_LIB_PMU
+	const char *env = getenv("DPDK_BENCH_PMU");
+	static char names[128];
+	char *ev, *sp = NULL;
+
+	if (env == NULL)
+		return;
+
+	if (rte_pmu_init() < 0) {
+		printf("bench: PMU init failed, counters disabled\n");
+		return;
+	}
+
+	strlcpy(names, env, sizeof(names));
+	for (ev = strtok_r(names, ",", &sp); ev != NULL;
+	     ev = strtok_r(NULL, ",", &sp)) {
+		int idx;
+
+		if (nb_pmu_events == BENCH_MAX_PMU_EVENTS) {
+			printf("bench: ignoring PMU events beyond %d\n",
+			       BENCH_MAX_PMU_EVENTS);
+			break;
+		}
+		idx = rte_pmu_add_event(ev);
+		if (idx < 0) {
+			printf("bench: cannot add PMU event %s\n", ev);
+			continue;
+		}
+		pmu_event[nb_pmu_events] = idx;
+		pmu_name[nb_pmu_events] = ev;
+		nb_pmu_events++;
+	}
+#endif
+}
+
+static void
+bench_pmu_read(uint64_t vals[])
+{
+	unsigned int i;
+
+	for (i = 0; i < nb_pmu_events; i++) {
+#ifdef RTE_LIB_PMU
+		vals[i] = rte_pmu_read(pmu_event[i]);
+#else
+		vals[i] = 0;
+#endif
+	}
+}
+
+static int
+cmp_u64(const void *a, const void *b)
+{
+	const uint64_t va = *(const uint64_t *)a;
+	const uint64_t vb = *(const uint64_t *)b;
+
+	return (va > vb) - (va < vb);
+}
+
+static uint64_t
+median_u64(uint64_t *vals, unsigned int n)
+{
+	qsort(vals, n, sizeof(*vals), cmp_u64);
+	return (vals[(n - 1) / 2] + vals[n / 2]) / 2;
+}
+
+static int
+bench_emit(const char *group, const char *name,
+	   const struct bench_stats *st)
+{
+	const char *path;
+	FILE *f;
+	unsigned int i;
+
+	path = getenv("DPDK_BENCH_JSON");
+	if (path != NULL) {
+		f = fopen(path, "a");
+		if (f == NULL)
+			return -errno;
+		fprintf(f, "{\"group\": \"%s\", \"name\": \"%s\", "
+			"\"iterations\": %"PRIu64", \"reps\": %u, "
+			"\"cycles\": {\"min\": %.3f, \"median\": %.3f, "
+			"\"avg\": %.3f, \"max\": %.3f, \"stddev\": %.3f}",
+			group, name, st->iterations, st->reps,
+			st->min_cycles, st->median_cycles, st->avg_cycles,
+			st->max_cycles, st->stddev_cycles);
+		for (i = 0; i < st->nb_pmu_events; i++)
+			fprintf(f, ", \"%s\": %.3f", st->pmu_name[i],
+				st->pmu_median[i]);
+		fprintf(f, "}\n");
+		fclose(f);
+	}
+
+	path = getenv("DPDK_BENCH_CSV");
+	if (path != NULL) {
+		f = fopen(path, "a");
+		if (f == NULL)
+			return -errno;
+		fprintf(f, "%s,%s,%"PRIu64",%u,%.3f,%.3f,%.3f,%.3f,%.3f",
+			group, name, st->iterations, st->reps,
+			st->min_cycles, st->median_cycles, st->avg_cycles,
+			st->max_cycles, st->stddev_cycles);
+		for (i = 0; i < st->nb_pmu_events; i++)
+			fprintf(f, ",%.3f", st->pmu_median[i]);
+		fprintf(f, "\n");
+		fclose(f);
+	}
+
+	return 0;
+}
+
+void
+bench_print_header(void)
+{
+	printf("%-16s %-32s %12s %12s %12s %8s\n",
+	       "Group", "Benchmark", "median cy/op", "avg cy/op",
+	       "stddev", "reps");
+}
+
+int
+bench_run(const char *group, const char *name, bench_fn_t fn, void *arg,
+	  uint64_t iterations, struct bench_stats *stats)
+{
+	struct bench_sample samples[BENCH_REPS];
+	uint64_t cycles[BENCH_REPS], scratch[BENCH_REPS];
+	uint64_t med, mad;
+	struct bench_stats st;
+	double var = 0.0;
+	unsigned int r, i;
+	int ret;
+
+	bench_pmu_setup();
+
+	/* warm up caches, branch predictors and lazy initialization */
+	fn(arg, RTE_MAX(iterations / 8, UINT64_C(1)));
+
+	for (r = 0; r < BENCH_REPS; r++) {
+		uint64_t pmu_start[BENCH_MAX_PMU_EVENTS];
+		uint64_t pmu_end[BENCH_MAX_PMU_EVENTS];
+		uint64_t start;
+
+		bench_pmu_read(pmu_start);
+		start = rte_rdtsc();
+		fn(arg, iterations);
+		samples[r].cycles = rte_rdtsc() - start;
+		bench_pmu_read(pmu_end);
+
+		for (i = 0; i < nb_pmu_events; i++)
+			samples[r].pmu[i] = pmu_end[i] - pmu_start[i];
+	}
+
+	/* Reject repetitions disturbed by interrupts or migration: keep
+	 * samples within 8 median absolute deviations of the median.
+	 */
+	for (r = 0; r < BENCH_REPS; r++)
+		scratch[r] = samples[r].cycles;
+	med = median_u64(scratch, BENCH_REPS);
+	for (r = 0; r < BENCH_REPS; r++) {
+		const uint64_t c = samples[r].cycles;
+
+		scratch[r] = c > med ? c - med : med - c;
+	}
+	mad = median_u64(scratch, BENCH_REPS);
+
+	memset(&st, 0, sizeof(st));
+	st.iterations = iterations;
+	st.min_cycles = HUGE_VAL;
+	for (r = 0; r < BENCH_REPS; r++) {
+		const uint64_t c = samples[r].cycles;
+		const uint64_t dev = c > med ? c - med : med - c;
+		const double per_op = (double)c / iterations;
+
+		if (mad != 0 && dev > 8 * mad)
+			continue;
+
+		cycles[st.reps++] = c;
+		st.avg_cycles += per_op;
+		st.min_cycles = RTE_MIN(st.min_cycles, per_op);
+		st.max_cycles = RTE_MAX(st.max_cycles, per_op);
+	}
+	st.avg_cycles /= st.reps;
+	st.median_cycles = (double)median_u64(cycles, st.reps) / iterations;
+
+	for (r = 0; r < st.reps; r++) {
+		const double d = (double)cycles[r] / iterations -
+			st.avg_cycles;
+
+		var += d * d;
+	}
+	st.stddev_cycles = st.reps > 1 ? sqrt(var / (st.reps - 1)) : 0.0;
+
+	st.nb_pmu_events = nb_pmu_events;
+	for (i = 0; i < nb_pmu_events; i++) {
+		for (r = 0; r < BENCH_REPS; r++)
+			scratch[r] = samples[r].pmu[i];
+		st.pmu_name[i] = pmu_name[i];
+		st.pmu_median[i] =
+			(double)median_u64(scratch, BENCH_REPS) / iterations;
+	}
+
+	printf("%-16s %-32s %12.2f %12.2f %12.2f %8u\n",
+	       group, name, st.median_cycles, st.avg_cycles,
+	       st.stddev_cycles, st.reps);
+	for (i = 0; i < nb_pmu_events; i++)
+		printf("%-16s %-32s %12.2f %s/op\n", "", "",
+		       st.pmu_median[i], st.pmu_name[i]);
+
+	ret = bench_emit(group, name, &st);
+	if (ret < 0)
+		printf("bench: failed to emit record for %s/%s: %s\n",
+		       group, name, strerror(-ret));
+
+	if (stats != NULL)
+		*stats = st;
+
+	return ret;
+}
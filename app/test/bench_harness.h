@@ -0,0 +1,53 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2025 Intel Corporation
+ */
+
+#ifndef BENCH_HARNESS_H
+#define BENCH_HARNESS_H
+
+#include <stdint.h>
+
+/*
+ * Shared measurement loop for the perf tests. The harness times repeated
+ * invocations of a benchmark body, rejects outlier repetitions, optionally
+ * samples hardware counters (when the PMU library is available) and can
+ * emit machine readable records next to the human readable summary:
+ *
+ *   DPDK_BENCH_JSON=<path> append one JSON object per measurement
+ *   DPDK_BENCH_CSV=<path>  append one CSV row per measurement
+ *   DPDK_BENCH_PMU=<ev,..> PMU event names to sample per repetition
+ */
+
+/* Repetitions measured per benchmark before outlier rejection */
+#define BENCH_REPS 16
+
+#define BENCH_MAX_PMU_EVENTS 4
+
+struct bench_stats {
+	uint64_t iterations;     /* iterations per repetition */
+	unsigned int reps;       /* repetitions kept after outlier rejection */
+	double min_cycles;       /* all cycle figures are per iteration */
+	double median_cycles;
+	double avg_cycles;
+	double max_cycles;
+	double stddev_cycles;
+	unsigned int nb_pmu_events;
+	const char *pmu_name[BENCH_MAX_PMU_EVENTS];
+	double pmu_median[BENCH_MAX_PMU_EVENTS]; /* per iteration */
+};
+
+/* Benchmark body, must execute the measured operation 'iterations' times */
+typedef void (*bench_fn_t)(void *arg, uint64_t iterations);
+
+/*
+ * Measure 'fn' and print a one line summary prefixed by 'group'/'name'.
+ * 'stats' may be NULL when the caller does not post-process the figures.
+ * Returns 0 on success, negative errno on setup or emission failure.
+ */
+int bench_run(const char *group, const char *name, bench_fn_t fn, void *arg,
+	      uint64_t iterations, struct bench_stats *stats);
+
+/* Print the summary header once before a series of bench_run() calls */
+void bench_print_header(void);
+
+#endif /* BENCH_HARNESS_H */
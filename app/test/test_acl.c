@@ -334,6 +334,68 @@ test_classify_alg(struct rte_acl_ctx *acx, struct ipv4_7tuple test_data[],
 	return rte_acl_set_ctx_classify(acx, RTE_ACL_CLASSIFY_DEFAULT);
 }
 
+/*
+ * Test classification for a subset of categories selected by bitmask.
+ */
+static int
+test_classify_categories(struct rte_acl_ctx *acx,
+	struct ipv4_7tuple test_data[], const uint8_t *data[], size_t dim)
+{
+	int32_t ret;
+	uint32_t i, results[dim];
+
+	/* allow category only: mask is a prefix of the category range */
+	ret = rte_acl_classify_categories(acx, data, results, dim,
+		ACL_ALLOW_MASK);
+	if (ret != 0) {
+		printf("Line %i: classify_categories failed, errno=%d!\n",
+			__LINE__, -ret);
+		return ret;
+	}
+	for (i = 0; i < dim; i++) {
+		if (results[i] != test_data[i].allow) {
+			printf("Line %i: Error in allow results at %i "
+				"(expected %"PRIu32" got %"PRIu32")!\n",
+				__LINE__, i, test_data[i].allow, results[i]);
+			return -EINVAL;
+		}
+	}
+
+	/* deny category only: sparse mask, results are compacted */
+	ret = rte_acl_classify_categories(acx, data, results, dim,
+		ACL_DENY_MASK);
+	if (ret != 0) {
+		printf("Line %i: classify_categories failed, errno=%d!\n",
+			__LINE__, -ret);
+		return ret;
+	}
+	for (i = 0; i < dim; i++) {
+		if (results[i] != test_data[i].deny) {
+			printf("Line %i: Error in deny results at %i "
+				"(expected %"PRIu32" got %"PRIu32")!\n",
+				__LINE__, i, test_data[i].deny, results[i]);
+			return -EINVAL;
+		}
+	}
+
+	/* empty mask and mask above the built categories are invalid */
+	ret = rte_acl_classify_categories(acx, data, results, dim, 0);
+	if (ret != -EINVAL) {
+		printf("Line %i: classify_categories(0) returned %d!\n",
+			__LINE__, ret);
+		return -EINVAL;
+	}
+	ret = rte_acl_classify_categories(acx, data, results, dim,
+		UINT32_C(1) << RTE_ACL_MAX_CATEGORIES);
+	if (ret != -EINVAL) {
+		printf("Line %i: classify_categories(overflow) returned %d!\n",
+			__LINE__, ret);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
 /*
  * Test ACL lookup (all possible methods).
  */
@@ -372,6 +434,9 @@ test_classify_run(struct rte_acl_ctx *acx, struct ipv4_7tuple test_data[],
 		}
 	}
 
+	if (ret == 0)
+		ret = test_classify_categories(acx, test_data, data, dim);
+
 	/* swap data back to cpu order so that next time tests don't fail */
 	bswap_test_data(test_data, dim, 0);
 	return ret;
@@ -459,6 +524,90 @@ test_classify(void)
 	return ret;
 }
 
+/*
+ * Test incremental builds: add rules in two steps with an incremental
+ * build and classify run after each one, then make sure a context built
+ * incrementally classifies the same as one built in one go.
+ */
+static int
+test_classify_incremental(void)
+{
+	struct rte_acl_ctx *acx;
+	struct rte_acl_config cfg;
+	uint32_t num_first;
+	int ret;
+
+	acx = rte_acl_create(&acl_param);
+	if (acx == NULL) {
+		printf("Line %i: Error creating ACL context!\n", __LINE__);
+		return -1;
+	}
+
+	memset(&cfg, 0, sizeof(cfg));
+	acl_ipv4vlan_config(&cfg, ipv4_7tuple_layout, RTE_ACL_MAX_CATEGORIES);
+
+	/* add and build the first half of the rules */
+	num_first = RTE_DIM(acl_test_rules) / 2;
+	ret = rte_acl_ipv4vlan_add_rules(acx, acl_test_rules, num_first);
+	if (ret != 0) {
+		printf("Line %i: Adding rules to ACL context failed!\n",
+			__LINE__);
+		goto done;
+	}
+
+	ret = rte_acl_build_incremental(acx, &cfg);
+	if (ret != 0) {
+		printf("Line %i: Incremental build of ACL context failed!\n",
+			__LINE__);
+		goto done;
+	}
+
+	/* nothing new to build. */
+	ret = rte_acl_build_incremental(acx, &cfg);
+	if (ret != 0) {
+		printf("Line %i: Empty incremental build failed!\n", __LINE__);
+		goto done;
+	}
+
+	/* add the remaining rules and build just the delta */
+	ret = rte_acl_ipv4vlan_add_rules(acx, acl_test_rules + num_first,
+		RTE_DIM(acl_test_rules) - num_first);
+	if (ret != 0) {
+		printf("Line %i: Adding rules to ACL context failed!\n",
+			__LINE__);
+		goto done;
+	}
+
+	ret = rte_acl_build_incremental(acx, &cfg);
+	if (ret != 0) {
+		printf("Line %i: Incremental build of ACL context failed!\n",
+			__LINE__);
+		goto done;
+	}
+
+	/* classify should now match the results of a full build */
+	ret = test_classify_run(acx, acl_test_data, RTE_DIM(acl_test_data));
+	if (ret != 0) {
+		printf("Line %i: %s failed!\n", __LINE__, __func__);
+		goto done;
+	}
+
+	/* max_size is not supported by incremental builds */
+	cfg.max_size = 0x800000;
+	ret = rte_acl_build_incremental(acx, &cfg);
+	if (ret != -ENOTSUP) {
+		printf("Line %i: Incremental build with max_size "
+			"failed with ret=%d!\n", __LINE__, ret);
+		ret = -1;
+		goto done;
+	}
+	ret = 0;
+
+done:
+	rte_acl_free(acx);
+	return ret;
+}
+
 static int
 test_build_ports_range(void)
 {
@@ -1737,6 +1886,8 @@ test_acl(void)
 		return -1;
 	if (test_classify() < 0)
 		return -1;
+	if (test_classify_incremental() < 0)
+		return -1;
 	if (test_build_ports_range() < 0)
 		return -1;
 	if (test_convert() < 0)
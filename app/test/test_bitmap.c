@@ -105,6 +105,55 @@ test_bitmap_scan_operations(struct rte_bitmap *bmp)
 	return TEST_SUCCESS;
 }
 
+static int
+test_bitmap_scan_bulk_operations(struct rte_bitmap *bmp)
+{
+	uint32_t pos[MAX_BITS + RTE_BITMAP_SLAB_BIT_SIZE];
+	uint32_t expected = (MAX_BITS + 2) / 3;
+	bool seen[MAX_BITS] = {false};
+	uint32_t i, n;
+
+	rte_bitmap_reset(bmp);
+	for (i = 0; i < MAX_BITS; i += 3)
+		rte_bitmap_set(bmp, i);
+
+	if (rte_bitmap_popcount(bmp) != expected) {
+		printf("Wrong bitmap popcount.\n");
+		return TEST_FAILED;
+	}
+
+	/* Too small pos array for any slab to be reported. */
+	if (rte_bitmap_scan_bulk(bmp, pos, RTE_BITMAP_SLAB_BIT_SIZE - 1) != 0) {
+		printf("Bulk scan reported bits without room for a slab.\n");
+		return TEST_FAILED;
+	}
+
+	n = rte_bitmap_scan_bulk(bmp, pos, RTE_DIM(pos));
+	if (n != expected) {
+		printf("Bulk scan failed to find all set bits. "
+		       "Expected %u, found %u.\n", expected, n);
+		return TEST_FAILED;
+	}
+
+	for (i = 0; i < n; i++) {
+		if (pos[i] >= MAX_BITS || (pos[i] % 3) || seen[pos[i]]) {
+			printf("Bulk scan returned a wrong position %u.\n",
+			       pos[i]);
+			return TEST_FAILED;
+		}
+		seen[pos[i]] = true;
+	}
+
+	/* A second call continues round-robin and wraps around. */
+	n = rte_bitmap_scan_bulk(bmp, pos, RTE_BITMAP_SLAB_BIT_SIZE);
+	if (n == 0 || n > RTE_BITMAP_SLAB_BIT_SIZE) {
+		printf("Bulk scan wrap around failed.\n");
+		return TEST_FAILED;
+	}
+
+	return TEST_SUCCESS;
+}
+
 static int
 test_bitmap_slab_set_get(struct rte_bitmap *bmp)
 {
@@ -208,6 +257,9 @@ test_bitmap_all_clear(void)
 	if (test_bitmap_scan_operations(bmp) < 0)
 		return TEST_FAILED;
 
+	if (test_bitmap_scan_bulk_operations(bmp) < 0)
+		return TEST_FAILED;
+
 	rte_bitmap_free(bmp);
 	rte_free(mem);
 
@@ -375,6 +375,76 @@ test_find(void)
 	return TEST_SUCCESS;
 }
 
+static int
+test_find_bulk_size(size_t size)
+{
+	bool reference[RAND_SET_MAX_SIZE];
+	size_t found[RAND_SET_MAX_SIZE];
+	uint64_t *bitset;
+	size_t i;
+
+	bitset = alloc_bitset(size);
+
+	TEST_ASSERT(bitset != NULL, "Failed to allocate memory");
+
+	rte_bitset_init(bitset, size);
+
+	for (i = 0; i < size; i++) {
+		bool bit = rand_bool();
+
+		reference[i] = bit;
+		if (bit)
+			rte_bitset_set(bitset, i);
+	}
+
+	for (i = 0; i < FFS_ITERATIONS; i++) {
+		size_t start_bit = rte_rand_max(size + 1);
+		size_t num = rte_rand_max(size + 1);
+		size_t n, j, ref_idx;
+
+		n = rte_bitset_find_set_bulk(bitset, size, start_bit, found,
+			num);
+
+		ref_idx = start_bit;
+		for (j = 0; j < n; j++) {
+			while (ref_idx < size && !reference[ref_idx])
+				ref_idx++;
+
+			if (ref_idx >= size || found[j] != ref_idx)
+				return TEST_FAILED;
+
+			ref_idx++;
+		}
+
+		/* all remaining bits must be '0' unless num was exhausted */
+		if (n < num) {
+			for (; ref_idx < size; ref_idx++)
+				if (reference[ref_idx])
+					return TEST_FAILED;
+		}
+	}
+
+	TEST_ASSERT_EQUAL(free_bitset(bitset, size), TEST_SUCCESS,
+		"Buffer over- or underrun detected");
+
+	return TEST_SUCCESS;
+}
+
+static int
+test_find_bulk(void)
+{
+	size_t i;
+
+	for (i = 0; i < RAND_ITERATIONS; i++) {
+		size_t size = 2 + rte_rand_max(RAND_SET_MAX_SIZE - 2);
+
+		if (test_find_bulk_size(size) != TEST_SUCCESS)
+			return TEST_FAILED;
+	}
+
+	return TEST_SUCCESS;
+}
+
 static int
 record_match(ssize_t match_idx, size_t size, int *calls)
 {
@@ -887,6 +957,7 @@ static struct unit_test_suite bitset_tests = {
 		TEST_CASE_ST(NULL, NULL, test_atomic_set_clear),
 		TEST_CASE_ST(NULL, NULL, test_atomic_flip),
 		TEST_CASE_ST(NULL, NULL, test_find),
+		TEST_CASE_ST(NULL, NULL, test_find_bulk),
 		TEST_CASE_ST(NULL, NULL, test_foreach),
 		TEST_CASE_ST(NULL, NULL, test_count),
 		TEST_CASE_ST(NULL, NULL, test_define),
@@ -10,6 +10,7 @@
 #include <rte_malloc.h>
 #include <rte_random.h>
 
+#include "bench_harness.h"
 #include "test.h"
 
 #define NUM_BLOCKS 10
@@ -17,6 +18,13 @@
 
 static const size_t data_sizes[] = { 20, 21, 100, 101, 1500, 1501 };
 
+static volatile uint64_t vsum;
+
+struct cksum_bench {
+	char *blocks[NUM_BLOCKS];
+	size_t block_size;
+};
+
 static __rte_noinline uint16_t
 do_rte_raw_cksum(const void *buf, size_t len)
 {
@@ -32,18 +40,29 @@ init_block(char *buf, size_t len)
 		buf[i] = (char)rte_rand();
 }
 
+static void
+test_cksum_perf_fn(void *arg, uint64_t iterations)
+{
+	const struct cksum_bench *b = arg;
+	uint64_t sum = 0;
+	uint64_t i;
+
+	for (i = 0; i < iterations; i++)
+		sum += do_rte_raw_cksum(b->blocks[i % NUM_BLOCKS],
+					b->block_size);
+
+	vsum = sum;
+}
+
 static int
 test_cksum_perf_size_alignment(size_t block_size, bool aligned)
 {
 	char *data[NUM_BLOCKS];
-	char *blocks[NUM_BLOCKS];
+	struct cksum_bench b;
+	struct bench_stats stats;
+	char name[64];
 	unsigned int i;
-	uint64_t start;
-	uint64_t end;
-	/* Floating point to handle low (pseudo-)TSC frequencies */
-	double block_latency;
-	double byte_latency;
-	volatile __rte_unused uint64_t sum = 0;
+	int rc;
 
 	for (i = 0; i < NUM_BLOCKS; i++) {
 		data[i] = rte_malloc(NULL, block_size + 1, 0);
@@ -55,29 +74,22 @@ test_cksum_perf_size_alignment(size_t block_size, bool aligned)
 
 		init_block(data[i], block_size + 1);
 
-		blocks[i] = aligned ? data[i] : data[i] + 1;
-	}
-
-	start = rte_rdtsc();
-
-	for (i = 0; i < ITERATIONS; i++) {
-		unsigned int j;
-		for (j = 0; j < NUM_BLOCKS; j++)
-			sum += do_rte_raw_cksum(blocks[j], block_size);
+		b.blocks[i] = aligned ? data[i] : data[i] + 1;
 	}
+	b.block_size = block_size;
 
-	end = rte_rdtsc();
-
-	block_latency = (end - start) / (double)(ITERATIONS * NUM_BLOCKS);
-	byte_latency = block_latency / block_size;
-
-	printf("%-9s %10zd %19.1f %16.2f\n", aligned ? "Aligned" : "Unaligned",
-	       block_size, block_latency, byte_latency);
+	snprintf(name, sizeof(name), "%s %zd byte blocks",
+		 aligned ? "aligned" : "unaligned", block_size);
+	rc = bench_run("cksum", name, test_cksum_perf_fn, &b,
+		       ITERATIONS, &stats);
+	if (rc == 0)
+		printf("%-16s %-32s %12.2f cycles/byte\n", "", "",
+		       stats.median_cycles / block_size);
 
 	for (i = 0; i < NUM_BLOCKS; i++)
 		rte_free(data[i]);
 
-	return TEST_SUCCESS;
+	return rc == 0 ? TEST_SUCCESS : TEST_FAILED;
 }
 
 static int
@@ -100,7 +112,7 @@ test_cksum_perf(void)
 	uint16_t i;
 
 	printf("### rte_raw_cksum() performance ###\n");
-	printf("Alignment  Block size    TSC cycles/block  TSC cycles/byte\n");
+	bench_print_header();
 
 	for (i = 0; i < RTE_DIM(data_sizes); i++) {
 		int rc;
@@ -0,0 +1,159 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2025 Intel Corporation.
+ */
+
+#include "test.h"
+
+#include <rte_crypto.h>
+#include <rte_crypto_op_sorter.h>
+#include <rte_cycles.h>
+
+#define NB_BINS 8
+#define BIN_SIZE 4
+#define NB_SESSIONS 6
+#define NB_OPS (NB_SESSIONS * BIN_SIZE)
+#define POOL_OPS 64
+
+static struct rte_mempool *op_pool;
+
+/* the sorter only keys on the session pointer, dummy objects will do */
+static char sessions[NB_SESSIONS][RTE_CACHE_LINE_SIZE];
+
+static int
+testsuite_setup(void)
+{
+	op_pool = rte_crypto_op_pool_create("SORTER_OP_POOL",
+			RTE_CRYPTO_OP_TYPE_SYMMETRIC, POOL_OPS, 0, 0,
+			SOCKET_ID_ANY);
+	if (op_pool == NULL) {
+		printf("%s: Error creating op mempool\n", __func__);
+		return TEST_FAILED;
+	}
+
+	return TEST_SUCCESS;
+}
+
+static void
+testsuite_teardown(void)
+{
+	rte_mempool_free(op_pool);
+	op_pool = NULL;
+}
+
+static void *
+op_session(const struct rte_crypto_op *op)
+{
+	return op->sess_type == RTE_CRYPTO_OP_SESSIONLESS ? NULL :
+		op->sym->session;
+}
+
+static int
+test_op_sorter(void)
+{
+	struct rte_crypto_op_sorter *sorter;
+	struct rte_crypto_op *ops[NB_OPS], *out[NB_OPS];
+	uint64_t tms = rte_rdtsc();
+	uint16_t n;
+	int i, j, ret = TEST_FAILED;
+
+	/* number of bins must be a power of two */
+	sorter = rte_crypto_op_sorter_create(NB_BINS - 2, BIN_SIZE, 1000,
+			SOCKET_ID_ANY);
+	RTE_TEST_ASSERT(sorter == NULL,
+			"accepted non power-of-2 bin count\n");
+
+	sorter = rte_crypto_op_sorter_create(NB_BINS, BIN_SIZE, 1000,
+			SOCKET_ID_ANY);
+	RTE_TEST_ASSERT_NOT_NULL(sorter, "failed to create sorter\n");
+
+	if (rte_crypto_op_bulk_alloc(op_pool, RTE_CRYPTO_OP_TYPE_SYMMETRIC,
+			ops, NB_OPS) != NB_OPS) {
+		printf("failed to allocate ops\n");
+		rte_crypto_op_sorter_free(sorter);
+		return TEST_FAILED;
+	}
+
+	/* interleave the sessions across the burst */
+	for (i = 0; i != NB_OPS; i++)
+		rte_crypto_op_attach_sym_session(ops[i],
+			&sessions[i % NB_SESSIONS]);
+
+	n = rte_crypto_op_sorter_enqueue(sorter, ops, NB_OPS, tms);
+	if (n != NB_OPS) {
+		printf("enqueued %u of %u ops\n", n, NB_OPS);
+		goto exit;
+	}
+	if (rte_crypto_op_sorter_count(sorter) != NB_OPS) {
+		printf("bad op count %u\n",
+			rte_crypto_op_sorter_count(sorter));
+		goto exit;
+	}
+
+	/* all bins completed: everything session-coherent, no deadline */
+	n = rte_crypto_op_sorter_dequeue(sorter, out, NB_OPS, tms);
+	if (n != NB_OPS) {
+		printf("dequeued %u of %u ops\n", n, NB_OPS);
+		goto exit;
+	}
+	for (i = 0; i != NB_OPS; i += BIN_SIZE)
+		for (j = 1; j != BIN_SIZE; j++)
+			if (op_session(out[i + j]) != op_session(out[i])) {
+				printf("sub-burst at %d mixes sessions\n", i);
+				goto exit;
+			}
+
+	/* an incomplete bin is held back until its deadline passes */
+	n = rte_crypto_op_sorter_enqueue(sorter, ops, BIN_SIZE - 1, tms);
+	if (n != BIN_SIZE - 1) {
+		printf("partial enqueue failed\n");
+		goto exit;
+	}
+	if (rte_crypto_op_sorter_dequeue(sorter, out, NB_OPS, tms + 999)
+			!= 0) {
+		printf("incomplete bin released early\n");
+		goto exit;
+	}
+	n = rte_crypto_op_sorter_dequeue(sorter, out, NB_OPS, tms + 1000);
+	if (n != BIN_SIZE - 1) {
+		printf("deadline release returned %u ops\n", n);
+		goto exit;
+	}
+
+	/* flush drains regardless of age */
+	n = rte_crypto_op_sorter_enqueue(sorter, ops, BIN_SIZE - 1, tms);
+	if (n != BIN_SIZE - 1)
+		goto exit;
+	n = rte_crypto_op_sorter_flush(sorter, out, NB_OPS);
+	if (n != BIN_SIZE - 1 ||
+			rte_crypto_op_sorter_count(sorter) != 0) {
+		printf("flush returned %u ops\n", n);
+		goto exit;
+	}
+
+	ret = TEST_SUCCESS;
+exit:
+	for (i = 0; i != NB_OPS; i++)
+		rte_crypto_op_free(ops[i]);
+	rte_crypto_op_sorter_free(sorter);
+	return ret;
+}
+
+static struct unit_test_suite crypto_op_sorter_testsuite = {
+	.suite_name = "Crypto Op Sorter Unit Test Suite",
+	.setup = testsuite_setup,
+	.teardown = testsuite_teardown,
+	.unit_test_cases = {
+		TEST_CASE(test_op_sorter),
+
+		TEST_CASES_END() /**< NULL terminate unit test array */
+	}
+};
+
+static int
+test_crypto_op_sorter(void)
+{
+	return unit_test_suite_runner(&crypto_op_sorter_testsuite);
+}
+
+REGISTER_FAST_TEST(crypto_op_sorter_autotest, true, true,
+		test_crypto_op_sorter);
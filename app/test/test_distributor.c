@@ -734,6 +734,7 @@ int test_error_distributor_create_name(void)
 {
 	struct rte_distributor *d = NULL;
 	struct rte_distributor *db = NULL;
+	struct rte_distributor *dv2 = NULL;
 	char *name = NULL;
 
 	d = rte_distributor_create(name, rte_socket_id(),
@@ -752,6 +753,13 @@ int test_error_distributor_create_name(void)
 		return -1;
 	}
 
+	dv2 = rte_distributor_create_v2(name, rte_socket_id(),
+			rte_lcore_count() - 1, 0);
+	if (dv2 != NULL || rte_errno != EINVAL) {
+		printf("ERROR: No error on create_v2() with NULL name param\n");
+		return -1;
+	}
+
 	return 0;
 }
 
@@ -825,7 +833,8 @@ test_distributor(void)
 {
 	static struct rte_distributor *ds;
 	static struct rte_distributor *db;
-	static struct rte_distributor *dist[2];
+	static struct rte_distributor *dv2;
+	static struct rte_distributor *dist[3];
 	static struct rte_mempool *p;
 	int i;
 
@@ -873,6 +882,19 @@ test_distributor(void)
 		rte_distributor_clear_returns(ds);
 	}
 
+	if (dv2 == NULL) {
+		dv2 = rte_distributor_create_v2("Test_dist_burst_v2",
+				rte_socket_id(),
+				rte_lcore_count() - 1, 0);
+		if (dv2 == NULL) {
+			printf("Error creating burst v2 distributor\n");
+			return -1;
+		}
+	} else {
+		rte_distributor_flush(dv2);
+		rte_distributor_clear_returns(dv2);
+	}
+
 	const unsigned nb_bufs = (511 * rte_lcore_count()) < BIG_BATCH ?
 			(BIG_BATCH * 2) - 1 : (511 * rte_lcore_count());
 	if (p == NULL) {
@@ -886,11 +908,15 @@ test_distributor(void)
 
 	dist[0] = ds;
 	dist[1] = db;
+	dist[2] = dv2;
 
-	for (i = 0; i < 2; i++) {
+	for (i = 0; i < 3; i++) {
 
 		worker_params.dist = dist[i];
-		if (i)
+		if (i == 2)
+			strlcpy(worker_params.name, "burst_v2",
+					sizeof(worker_params.name));
+		else if (i == 1)
 			strlcpy(worker_params.name, "burst",
 					sizeof(worker_params.name));
 		else
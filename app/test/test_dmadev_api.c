@@ -619,6 +619,94 @@ test_dma_completed_status(void)
 	return TEST_SUCCESS;
 }
 
+static int
+test_dma_group(void)
+{
+	enum rte_dma_status_code status[4] = { 1, 1, 1, 1 };
+	int16_t dev_ids[1] = { test_dev_id };
+	uint16_t vchans[1] = { 0 };
+	struct rte_dma_group *group;
+	uint16_t last_idx = 1;
+	uint16_t cpl_ret, i;
+	int ret;
+
+	/* Check create with invalid parameters */
+	group = rte_dma_group_create(NULL, vchans, 1, 16, SOCKET_ID_ANY);
+	RTE_TEST_ASSERT(group == NULL, "Expected NULL for NULL dev_ids");
+	group = rte_dma_group_create(dev_ids, vchans, 0, 16, SOCKET_ID_ANY);
+	RTE_TEST_ASSERT(group == NULL, "Expected NULL for zero members");
+	group = rte_dma_group_create(dev_ids, vchans, 1, 15, SOCKET_ID_ANY);
+	RTE_TEST_ASSERT(group == NULL, "Expected NULL for non power of 2 ring");
+	dev_ids[0] = invalid_dev_id;
+	group = rte_dma_group_create(dev_ids, vchans, 1, 16, SOCKET_ID_ANY);
+	RTE_TEST_ASSERT(group == NULL, "Expected NULL for invalid dev_id");
+	dev_ids[0] = test_dev_id;
+
+	group = rte_dma_group_create(dev_ids, vchans, 1, 16, SOCKET_ID_ANY);
+	RTE_TEST_ASSERT(group != NULL, "Failed to create group");
+
+	/* Setup one vchan for later test */
+	ret = setup_vchan(1);
+	RTE_TEST_ASSERT_SUCCESS(ret, "Failed to setup one vchan, %d", ret);
+
+	ret = rte_dma_start(test_dev_id);
+	RTE_TEST_ASSERT_SUCCESS(ret, "Failed to start, %d", ret);
+
+	setup_memory();
+
+	/* Check enqueue without submit */
+	ret = rte_dma_group_copy(group,
+				 rte_malloc_virt2iova(src),
+				 rte_malloc_virt2iova(dst),
+				 TEST_MEMCPY_SIZE, 0);
+	RTE_TEST_ASSERT_EQUAL(ret, 0, "Failed to enqueue copy, %d", ret);
+	ret = rte_dma_group_copy(group,
+				 rte_malloc_virt2iova(src),
+				 rte_malloc_virt2iova(dst),
+				 TEST_MEMCPY_SIZE, 0);
+	RTE_TEST_ASSERT_EQUAL(ret, 1, "Failed to enqueue copy, %d", ret);
+	rte_delay_us_sleep(TEST_WAIT_US_VAL);
+	cpl_ret = rte_dma_group_completed_status(group, 4, &last_idx, status);
+	RTE_TEST_ASSERT_EQUAL(cpl_ret, 0, "Failed to get completed");
+
+	/* Check add submit */
+	ret = rte_dma_group_submit(group);
+	RTE_TEST_ASSERT_SUCCESS(ret, "Failed to submit, %d", ret);
+	rte_delay_us_sleep(TEST_WAIT_US_VAL);
+	cpl_ret = rte_dma_group_completed_status(group, 4, &last_idx, status);
+	RTE_TEST_ASSERT_EQUAL(cpl_ret, 2, "Failed to get completed");
+	RTE_TEST_ASSERT_EQUAL(last_idx, 1, "Last idx should be 1, %u",
+				last_idx);
+	for (i = 0; i < cpl_ret; i++)
+		RTE_TEST_ASSERT_EQUAL(status[i], 0,
+				"Failed to completed status, %d", status[i]);
+	ret = verify_memory();
+	RTE_TEST_ASSERT_SUCCESS(ret, "Failed to verify memory");
+
+	/* Check for enqueue with submit */
+	setup_memory();
+	ret = rte_dma_group_copy(group,
+				 rte_malloc_virt2iova(src),
+				 rte_malloc_virt2iova(dst),
+				 TEST_MEMCPY_SIZE, RTE_DMA_OP_FLAG_SUBMIT);
+	RTE_TEST_ASSERT_EQUAL(ret, 2, "Failed to enqueue copy, %d", ret);
+	rte_delay_us_sleep(TEST_WAIT_US_VAL);
+	cpl_ret = rte_dma_group_completed_status(group, 4, &last_idx, status);
+	RTE_TEST_ASSERT_EQUAL(cpl_ret, 1, "Failed to get completed");
+	RTE_TEST_ASSERT_EQUAL(last_idx, 2, "Last idx should be 2, %u",
+				last_idx);
+	ret = verify_memory();
+	RTE_TEST_ASSERT_SUCCESS(ret, "Failed to verify memory");
+
+	rte_dma_group_free(group);
+
+	/* Stop dmadev to make sure dmadev to a known state */
+	ret = rte_dma_stop(test_dev_id);
+	RTE_TEST_ASSERT_SUCCESS(ret, "Failed to stop, %d", ret);
+
+	return TEST_SUCCESS;
+}
+
 static int
 test_dma_sg(void)
 {
@@ -716,6 +804,7 @@ static struct unit_test_suite dma_api_testsuite = {
 		TEST_CASE(test_dma_dump),
 		TEST_CASE(test_dma_completed),
 		TEST_CASE(test_dma_completed_status),
+		TEST_CASE(test_dma_group),
 		TEST_CASE(test_dma_sg),
 		TEST_CASES_END()
 	}
@@ -206,6 +206,58 @@ static int test_add_update_delete(void)
 	return 0;
 }
 
+/*
+ * Same sequence as test_add_update_delete, but with the per-lcore
+ * hot-key cache enabled: the second lookup of each key is served from
+ * the cache and updates/deletes must invalidate it.
+ */
+static int test_add_update_delete_hotkey_cache(void)
+{
+	struct rte_efd_table *handle;
+	efd_value_t prev_value;
+	printf("Entering %s\n", __func__);
+	data[1] = mrand48() & VALUE_BITMASK;
+
+	handle = rte_efd_create("test_hotkey_cache", TABLE_SIZE,
+			sizeof(struct flow_key),
+			efd_get_all_sockets_bitmask(), test_socket_id);
+	TEST_ASSERT_NOT_NULL(handle, "Error creating the efd table\n");
+
+	TEST_ASSERT_SUCCESS(rte_efd_hotkey_cache_enable(handle, 256),
+			"Error enabling the hot-key cache");
+
+	TEST_ASSERT_SUCCESS(rte_efd_update(handle, test_socket_id, &keys[1],
+			data[1]), "Error inserting the key");
+	print_key_info("Add", &keys[1], data[1]);
+
+	/* first lookup populates the cache, second is served from it */
+	TEST_ASSERT_EQUAL(rte_efd_lookup(handle, test_socket_id, &keys[1]),
+			data[1], "failed to find key");
+	TEST_ASSERT_EQUAL(rte_efd_lookup(handle, test_socket_id, &keys[1]),
+			data[1], "failed to find cached key");
+	print_key_info("Lkp", &keys[1], data[1]);
+
+	/* the update must not leave the stale value visible */
+	data[1] = data[1] + 1;
+	TEST_ASSERT_SUCCESS(rte_efd_update(handle, test_socket_id, &keys[1],
+			data[1]), "Error re-inserting the key");
+	print_key_info("Add", &keys[1], data[1]);
+
+	TEST_ASSERT_EQUAL(rte_efd_lookup(handle, test_socket_id, &keys[1]),
+			data[1], "failed to find key after update");
+	print_key_info("Lkp", &keys[1], data[1]);
+
+	TEST_ASSERT_SUCCESS(rte_efd_delete(handle, test_socket_id, &keys[1],
+			&prev_value), "failed to delete key");
+	TEST_ASSERT_EQUAL(prev_value, data[1],
+			"failed to delete the expected value, got %d, "
+			"expected %d", prev_value, data[1]);
+	print_key_info("Del", &keys[1], data[1]);
+
+	rte_efd_free(handle);
+	return 0;
+}
+
 /*
  * Sequence of operations for find existing EFD table
  *
@@ -461,6 +513,8 @@ test_efd(void)
 		return -1;
 	if (test_add_update_delete() < 0)
 		return -1;
+	if (test_add_update_delete_hotkey_cache() < 0)
+		return -1;
 	if (test_five_keys() < 0)
 		return -1;
 	if (test_efd_creation_with_bad_parameters() < 0)
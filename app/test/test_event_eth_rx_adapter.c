@@ -431,6 +431,7 @@ adapter_create_with_params(void)
 	rx_p_conf.dequeue_depth = dev_info.max_event_port_dequeue_depth;
 	rx_p_conf.enqueue_depth = dev_info.max_event_port_enqueue_depth;
 
+	memset(&rxa_params, 0, sizeof(rxa_params));
 	rxa_params.use_queue_event_buf = false;
 	rxa_params.event_buf_size = 0;
 
@@ -447,6 +448,20 @@ adapter_create_with_params(void)
 
 	rxa_params.use_queue_event_buf = true;
 
+	/* Batching governor lower bound without an upper bound */
+	rxa_params.batch_min_nb_rx = 32;
+	err = rte_event_eth_rx_adapter_create_with_params(TEST_INST_ID,
+				TEST_DEV_ID, &rx_p_conf, &rxa_params);
+	TEST_ASSERT(err == -EINVAL, "Expected -EINVAL got %d", err);
+
+	/* Batching governor upper bound below the lower bound */
+	rxa_params.batch_max_nb_rx = 16;
+	err = rte_event_eth_rx_adapter_create_with_params(TEST_INST_ID,
+				TEST_DEV_ID, &rx_p_conf, &rxa_params);
+	TEST_ASSERT(err == -EINVAL, "Expected -EINVAL got %d", err);
+
+	rxa_params.batch_max_nb_rx = 128;
+
 	err = rte_event_eth_rx_adapter_create_with_params(TEST_INST_ID,
 				TEST_DEV_ID, &rx_p_conf, &rxa_params);
 	TEST_ASSERT(err == 0, "Expected 0 got %d", err);
@@ -523,6 +538,7 @@ adapter_create_ext_with_params(void)
 	err = rte_event_dev_info_get(TEST_DEV_ID, &dev_info);
 	TEST_ASSERT(err == 0, "Expected 0 got %d", err);
 
+	memset(&rxa_params, 0, sizeof(rxa_params));
 	rxa_params.use_queue_event_buf = false;
 	rxa_params.event_buf_size = 0;
 
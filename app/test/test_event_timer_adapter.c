@@ -405,6 +405,42 @@ timdev_setup_msec_periodic(void)
 	return _timdev_setup(max_tmo_ns, NSECPERSEC / 10, flags);
 }
 
+static int
+timdev_setup_usec_deferred(void)
+{
+	uint32_t caps = 0;
+	uint64_t flags = RTE_EVENT_TIMER_ADAPTER_F_ADJUST_RES |
+			 RTE_EVENT_TIMER_ADAPTER_F_DEFERRED_ARM;
+
+	TEST_ASSERT_SUCCESS(rte_event_timer_adapter_caps_get(evdev, &caps),
+				"failed to get adapter capabilities");
+
+	/* Deferred arm mode is only implemented by the software adapter */
+	if (caps & RTE_EVENT_TIMER_ADAPTER_CAP_INTERNAL_PORT)
+		return -ENOTSUP;
+
+	/* Max timeout is 10,000us and bucket interval is 100us */
+	return _timdev_setup(1E7, 1E5, flags);
+}
+
+static int
+timdev_setup_sec_deferred(void)
+{
+	uint32_t caps = 0;
+	uint64_t flags = RTE_EVENT_TIMER_ADAPTER_F_ADJUST_RES |
+			 RTE_EVENT_TIMER_ADAPTER_F_DEFERRED_ARM;
+
+	TEST_ASSERT_SUCCESS(rte_event_timer_adapter_caps_get(evdev, &caps),
+				"failed to get adapter capabilities");
+
+	/* Deferred arm mode is only implemented by the software adapter */
+	if (caps & RTE_EVENT_TIMER_ADAPTER_CAP_INTERNAL_PORT)
+		return -ENOTSUP;
+
+	/* Max timeout is 100sec and bucket interval is 1sec */
+	return _timdev_setup(1E11, 1E9, flags);
+}
+
 static int
 timdev_setup_sec(void)
 {
@@ -1981,6 +2017,10 @@ static struct unit_test_suite event_timer_adptr_functional_testsuite  = {
 				test_timer_cancel_periodic),
 		TEST_CASE_ST(timdev_setup_sec, timdev_teardown,
 				test_timer_cancel_random),
+		TEST_CASE_ST(timdev_setup_usec_deferred, timdev_teardown,
+				test_timer_arm),
+		TEST_CASE_ST(timdev_setup_sec_deferred, timdev_teardown,
+				test_timer_cancel),
 		TEST_CASE_ST(timdev_setup_usec_multicore, timdev_teardown,
 				test_timer_arm_multicore),
 		TEST_CASE_ST(timdev_setup_usec_multicore, timdev_teardown,
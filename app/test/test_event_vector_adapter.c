@@ -550,6 +550,114 @@ test_event_vector_adapter_enqueue_flush(void)
 	return TEST_SUCCESS;
 }
 
+static int
+test_event_vector_adapter_enqueue_flow(void)
+{
+	struct rte_event_vector_adapter_conf conf;
+	struct rte_event_vector_adapter_info info;
+	struct rte_event_vector_adapter *adapter;
+	uint32_t service_id;
+	struct rte_event ev;
+	int ret, i;
+
+	memset(&conf, 0, sizeof(conf));
+	memset(&info, 0, sizeof(info));
+
+	ret = rte_event_vector_adapter_info_get(evdev, &info);
+	TEST_ASSERT_SUCCESS(ret, "Failed to get event vector adapter info");
+
+	if (info.max_flow_slots < 4) {
+		printf("Flow aware aggregation not supported, skipping test\n");
+		return TEST_SKIPPED;
+	}
+
+	vector_mp = rte_event_vector_pool_create("vector_mp", MAX_EVENTS, 0, MAX_VECTOR_SIZE,
+						 rte_socket_id());
+	TEST_ASSERT(vector_mp != NULL, "Failed to create mempool");
+
+	conf.event_dev_id = evdev;
+	conf.socket_id = rte_socket_id();
+	conf.vector_sz = MAX_VECTOR_SIZE;
+	conf.vector_timeout_ns = info.max_vector_timeout_ns;
+	conf.vector_mp = vector_mp;
+	conf.nb_flow_slots = 4;
+
+	conf.ev.queue_id = 0;
+	conf.ev.event_type = RTE_EVENT_TYPE_VECTOR | RTE_EVENT_TYPE_CPU;
+	conf.ev.sched_type = RTE_SCHED_TYPE_PARALLEL;
+
+	conf.ev_fallback.event_type = RTE_EVENT_TYPE_CPU;
+	adapter = rte_event_vector_adapter_create(&conf);
+	TEST_ASSERT(adapter != NULL, "Failed to create event vector adapter");
+
+	vector_adptr_id = adapter->adapter_id;
+
+	if (rte_event_vector_adapter_service_id_get(adapter, &service_id) == 0) {
+		if (sw_slcore < 0) {
+			adapter_slcore = rte_get_next_lcore(sw_slcore, 1, 0);
+			TEST_ASSERT_SUCCESS(rte_service_lcore_add(adapter_slcore),
+					    "Failed to add service core");
+			TEST_ASSERT_SUCCESS(rte_service_lcore_start(adapter_slcore),
+					    "Failed to start service core");
+		} else
+			adapter_slcore = sw_slcore;
+		TEST_ASSERT(rte_service_map_lcore_set(service_id, adapter_slcore, 1) == 0,
+			    "Failed to map adapter service");
+		TEST_ASSERT(rte_service_runstate_set(service_id, 1) == 0,
+			    "Failed to start adapter service");
+	}
+
+	/* Interleave two flows, each vector must carry objects of one flow only. */
+	ret = rte_event_vector_adapter_enqueue(adapter, objs, 4, RTE_EVENT_VECTOR_ENQ_FLOW(1));
+	TEST_ASSERT((ret == 4), "Failed to enqueue event vector %d", ret);
+
+	ret = rte_event_vector_adapter_enqueue(adapter, &objs[4], 4, RTE_EVENT_VECTOR_ENQ_FLOW(2));
+	TEST_ASSERT((ret == 4), "Failed to enqueue event vector %d", ret);
+
+	ret = rte_event_vector_adapter_enqueue(adapter, objs, 4, RTE_EVENT_VECTOR_ENQ_FLOW(1));
+	TEST_ASSERT((ret == 4), "Failed to enqueue event vector %d", ret);
+
+	for (i = 0; i < MAX_RETRIES; i++) {
+		ret = rte_event_dequeue_burst(evdev, 0, &ev, 1, 0);
+		if (ret)
+			break;
+
+		rte_delay_ms(1);
+	}
+
+	TEST_ASSERT((ret == 1), "Failed to dequeue event vector %d", ret);
+	TEST_ASSERT((ev.vec->nb_elem == MAX_VECTOR_SIZE), "Incomplete event vector %d",
+		    ev.vec->nb_elem);
+	TEST_ASSERT((ev.flow_id == 1), "Invalid flow id %d", ev.flow_id);
+
+	for (i = 0; i < MAX_VECTOR_SIZE; i++)
+		TEST_ASSERT((ev.vec->u64s[i] == objs[i & 3]),
+			    "Invalid object in event vector %" PRIx64, ev.vec->u64s[i]);
+	rte_mempool_put(rte_mempool_from_obj(ev.vec), ev.vec);
+
+	ret = rte_event_vector_adapter_enqueue(adapter, NULL, 0, RTE_EVENT_VECTOR_ENQ_FLUSH);
+	TEST_ASSERT((ret == 0), "Failed to enqueue event vector %d", ret);
+
+	for (i = 0; i < MAX_RETRIES; i++) {
+		ret = rte_event_dequeue_burst(evdev, 0, &ev, 1, 0);
+		if (ret)
+			break;
+
+		rte_delay_ms(1);
+	}
+
+	TEST_ASSERT((ret == 1), "Failed to dequeue event vector %d", ret);
+	TEST_ASSERT((ev.vec->nb_elem == 4), "Incomplete event vector %d", ev.vec->nb_elem);
+	TEST_ASSERT((ev.flow_id == 2), "Invalid flow id %d", ev.flow_id);
+
+	for (i = 0; i < 4; i++)
+		TEST_ASSERT((ev.vec->u64s[i] == objs[4 + i]),
+			    "Invalid object in event vector %" PRIx64, ev.vec->u64s[i]);
+	rte_mempool_put(rte_mempool_from_obj(ev.vec), ev.vec);
+
+	return TEST_SUCCESS;
+}
+
 static inline int
 eventdev_setup(void)
 {
@@ -665,6 +773,8 @@ static struct unit_test_suite functional_testsuite = {
 			     test_event_vector_adapter_enqueue_sov_eov),
 		TEST_CASE_ST(test_event_vector_adapter_create, test_event_vector_adapter_free,
 			     test_event_vector_adapter_enqueue_flush),
+		TEST_CASE_ST(NULL, test_event_vector_adapter_free,
+			     test_event_vector_adapter_enqueue_flow),
 		TEST_CASES_END() /**< NULL terminate unit test array */
 	}
 };
@@ -868,6 +868,80 @@ static int test_lookbehind_mask(void)
 	return TEST_SUCCESS;
 }
 
+static int test_set_range(void)
+{
+	/* invalid parameters */
+	TEST_ASSERT(rte_fbarray_set_used_range(NULL, 0, 1) < 0,
+			"Call succeeded with invalid parameters\n");
+	TEST_ASSERT_EQUAL(rte_errno, EINVAL, "Wrong errno value\n");
+	TEST_ASSERT(rte_fbarray_set_used_range(&param.arr,
+			FBARRAY_TEST_LEN, 1) < 0,
+			"Call succeeded with invalid parameters\n");
+	TEST_ASSERT_EQUAL(rte_errno, EINVAL, "Wrong errno value\n");
+	TEST_ASSERT(rte_fbarray_set_free_range(&param.arr, 0,
+			FBARRAY_TEST_LEN + 1) < 0,
+			"Call succeeded with invalid parameters\n");
+	TEST_ASSERT_EQUAL(rte_errno, EINVAL, "Wrong errno value\n");
+
+	/* zero-length range is a no-op */
+	TEST_ASSERT_SUCCESS(rte_fbarray_set_used_range(&param.arr, 0, 0),
+			"Failed to set zero-length range\n");
+	TEST_ASSERT_EQUAL((int)param.arr.count, 0, "Wrong element count\n");
+
+	/* mark a range crossing several mask boundaries */
+	TEST_ASSERT_SUCCESS(rte_fbarray_set_used_range(&param.arr, 10, 150),
+			"Failed to set used range\n");
+	TEST_ASSERT_EQUAL((int)param.arr.count, 150, "Wrong element count\n");
+	TEST_ASSERT_EQUAL(rte_fbarray_find_next_used(&param.arr, 0), 10,
+			"Used space found in wrong place\n");
+	TEST_ASSERT_EQUAL(rte_fbarray_find_contig_used(&param.arr, 10), 150,
+			"Used space has wrong length\n");
+	TEST_ASSERT_EQUAL(rte_fbarray_find_next_free(&param.arr, 10), 160,
+			"Free space found in wrong place\n");
+
+	/* marking an already-used range must not corrupt the count */
+	TEST_ASSERT_SUCCESS(rte_fbarray_set_used_range(&param.arr, 20, 50),
+			"Failed to set already used range\n");
+	TEST_ASSERT_EQUAL((int)param.arr.count, 150, "Wrong element count\n");
+
+	/* free a hole covering exactly one mask in the middle */
+	TEST_ASSERT_SUCCESS(rte_fbarray_set_free_range(&param.arr, 64, 64),
+			"Failed to set free range\n");
+	TEST_ASSERT_EQUAL((int)param.arr.count, 86, "Wrong element count\n");
+	TEST_ASSERT_EQUAL(rte_fbarray_find_contig_used(&param.arr, 10), 54,
+			"Used space has wrong length\n");
+	TEST_ASSERT_EQUAL(rte_fbarray_find_contig_free(&param.arr, 64), 64,
+			"Free space has wrong length\n");
+	TEST_ASSERT_EQUAL(rte_fbarray_find_next_used(&param.arr, 64), 128,
+			"Used space found in wrong place\n");
+
+	/* clear everything back */
+	TEST_ASSERT_SUCCESS(rte_fbarray_set_free_range(&param.arr, 0,
+			FBARRAY_TEST_LEN),
+			"Failed to set free range\n");
+	TEST_ASSERT_EQUAL((int)param.arr.count, 0, "Wrong element count\n");
+
+	return TEST_SUCCESS;
+}
+
+static int test_set_range_unaligned(void)
+{
+	/* mark a range running up to the end of an unaligned array */
+	TEST_ASSERT_SUCCESS(rte_fbarray_set_used_range(&unaligned.arr, 5,
+			FBARRAY_UNALIGNED_TEST_LEN - 5),
+			"Failed to set used range\n");
+	TEST_ASSERT_EQUAL((int)unaligned.arr.count,
+			FBARRAY_UNALIGNED_TEST_LEN - 5,
+			"Wrong element count\n");
+	TEST_ASSERT_EQUAL(rte_fbarray_find_contig_used(&unaligned.arr, 5),
+			FBARRAY_UNALIGNED_TEST_LEN - 5,
+			"Used space has wrong length\n");
+	TEST_ASSERT_EQUAL(rte_fbarray_find_contig_free(&unaligned.arr, 0), 5,
+			"Free space has wrong length\n");
+
+	return TEST_SUCCESS;
+}
+
 static struct unit_test_suite fbarray_test_suite = {
 	.suite_name = "fbarray autotest",
 	.setup = autotest_setup,
@@ -888,6 +962,8 @@ static struct unit_test_suite fbarray_test_suite = {
 		TEST_CASE_ST(NULL, reset_aligned, test_lookahead_mask),
 		TEST_CASE_ST(NULL, reset_aligned, test_lookbehind_mask),
 		TEST_CASE_ST(unaligned_test_setup, reset_unaligned, test_find_unaligned),
+		TEST_CASE_ST(NULL, reset_aligned, test_set_range),
+		TEST_CASE_ST(NULL, reset_unaligned, test_set_range_unaligned),
 		TEST_CASES_END()
 	}
 };
@@ -9,6 +9,7 @@
 
 #include <rte_ip.h>
 #include <rte_log.h>
+#include <rte_rib.h>
 #include <rte_fib.h>
 #include <rte_malloc.h>
 
@@ -22,6 +23,7 @@ static int32_t test_free_null(void);
 static int32_t test_add_del_invalid(void);
 static int32_t test_get_invalid(void);
 static int32_t test_lookup(void);
+static int32_t test_import_rib(void);
 static int32_t test_invalid_rcu(void);
 static int32_t test_fib_rcu_sync_rw(void);
 
@@ -376,6 +378,83 @@ test_lookup(void)
 		"Check_fib fails for DIR24_8_8B type\n");
 	rte_fib_free(fib);
 
+	/* same checks with non-temporal route installation */
+	config.flags = RTE_FIB_F_NON_TEMPORAL_UPDATE;
+	config.dir24_8.nh_sz = RTE_FIB_DIR24_8_4B;
+	config.dir24_8.num_tbl8 = MAX_TBL8;
+	fib = rte_fib_create(__func__, SOCKET_ID_ANY, &config);
+	RTE_TEST_ASSERT(fib != NULL, "Failed to create FIB\n");
+	ret = check_fib(fib);
+	RTE_TEST_ASSERT(ret == TEST_SUCCESS,
+		"Check_fib fails for DIR24_8_4B type with NT updates\n");
+	rte_fib_free(fib);
+	config.flags = 0;
+
+	return TEST_SUCCESS;
+}
+
+/*
+ * Populate a standalone RIB, flatten it into a DIR24_8 FIB with
+ * rte_fib_import_rib and check lookups against the source routes
+ */
+int32_t
+test_import_rib(void)
+{
+	struct rte_fib *fib = NULL;
+	struct rte_rib *rib = NULL;
+	struct rte_fib_conf config = { 0 };
+	struct rte_rib_conf rib_config = { 0 };
+	struct rte_rib_node *node;
+	uint64_t def_nh = 100;
+	uint32_t ips[4] = {RTE_IPV4(10, 1, 1, 1), RTE_IPV4(10, 10, 0, 1),
+			RTE_IPV4(192, 0, 2, 5), RTE_IPV4(172, 16, 0, 1)};
+	uint64_t nh_arr[4];
+	int ret;
+
+	rib_config.max_nodes = MAX_ROUTES;
+	rib = rte_rib_create(__func__, SOCKET_ID_ANY, &rib_config);
+	RTE_TEST_ASSERT(rib != NULL, "Failed to create RIB\n");
+
+	node = rte_rib_insert(rib, RTE_IPV4(10, 0, 0, 0), 8);
+	RTE_TEST_ASSERT(node != NULL, "Failed to insert rule\n");
+	rte_rib_set_nh(node, 1);
+	node = rte_rib_insert(rib, RTE_IPV4(10, 10, 0, 0), 16);
+	RTE_TEST_ASSERT(node != NULL, "Failed to insert rule\n");
+	rte_rib_set_nh(node, 2);
+	node = rte_rib_insert(rib, RTE_IPV4(192, 0, 2, 0), 24);
+	RTE_TEST_ASSERT(node != NULL, "Failed to insert rule\n");
+	rte_rib_set_nh(node, 3);
+
+	config.max_routes = MAX_ROUTES;
+	config.rib_ext_sz = 0;
+	config.default_nh = def_nh;
+	config.type = RTE_FIB_DIR24_8;
+	config.dir24_8.nh_sz = RTE_FIB_DIR24_8_4B;
+	config.dir24_8.num_tbl8 = 127;
+
+	fib = rte_fib_create(__func__, SOCKET_ID_ANY, &config);
+	RTE_TEST_ASSERT(fib != NULL, "Failed to create FIB\n");
+
+	ret = rte_fib_import_rib(NULL, rib);
+	RTE_TEST_ASSERT(ret < 0,
+		"Call succeeded with invalid parameters\n");
+	ret = rte_fib_import_rib(fib, NULL);
+	RTE_TEST_ASSERT(ret < 0,
+		"Call succeeded with invalid parameters\n");
+
+	ret = rte_fib_import_rib(fib, rib);
+	RTE_TEST_ASSERT(ret == 0, "Failed to import RIB into FIB\n");
+
+	ret = rte_fib_lookup_bulk(fib, ips, nh_arr, RTE_DIM(ips));
+	RTE_TEST_ASSERT(ret == 0, "Failed to lookup\n");
+	RTE_TEST_ASSERT(nh_arr[0] == 1, "Failed to get proper nexthop\n");
+	RTE_TEST_ASSERT(nh_arr[1] == 2, "Failed to get proper nexthop\n");
+	RTE_TEST_ASSERT(nh_arr[2] == 3, "Failed to get proper nexthop\n");
+	RTE_TEST_ASSERT(nh_arr[3] == def_nh, "Failed to get proper nexthop\n");
+
+	rte_fib_free(fib);
+	rte_rib_free(rib);
+
 	return TEST_SUCCESS;
 }
 
@@ -598,6 +677,7 @@ static struct unit_test_suite fib_fast_tests = {
 	TEST_CASE(test_add_del_invalid),
 	TEST_CASE(test_get_invalid),
 	TEST_CASE(test_lookup),
+	TEST_CASE(test_import_rib),
 	TEST_CASE(test_invalid_rcu),
 	TEST_CASE(test_fib_rcu_sync_rw),
 	TEST_CASES_END()
@@ -886,6 +886,87 @@ test_graph_walk(void)
 	return 0;
 }
 
+static int
+test_graph_walk_deferred(void)
+{
+	struct rte_graph_param gconf = {
+		.socket_id = SOCKET_ID_ANY,
+		.nb_node_patterns = 5,
+		.node_patterns = node_patterns,
+		.rtc = {
+			.defer_watermark = 64,
+			.defer_flush_cycles = rte_get_timer_hz() / 10000,
+		},
+	};
+	struct rte_graph *graph;
+	rte_graph_t id;
+	int i;
+
+	id = rte_graph_create("worker_defer", &gconf);
+	if (id == RTE_GRAPH_ID_INVALID) {
+		printf("Deferred graph creation failed with error = %d\n", rte_errno);
+		return -1;
+	}
+
+	graph = rte_graph_lookup("worker_defer");
+	if (!graph) {
+		printf("Graph lookup failed\n");
+		rte_graph_destroy(id);
+		return -1;
+	}
+
+	/* Walk enough times for deferred streams to cross the flush bound */
+	for (i = 0; i < 32; i++)
+		rte_graph_walk(graph);
+
+	return rte_graph_destroy(id);
+}
+
+static int
+test_graph_backpressure(void)
+{
+	struct rte_graph *graph = rte_graph_lookup("worker0");
+	struct rte_node *node;
+
+	if (!graph) {
+		printf("Graph lookup failed\n");
+		return -1;
+	}
+
+	node = rte_graph_node_get_by_name("worker0", "test_node00");
+	if (!node) {
+		printf("Node lookup failed\n");
+		return -1;
+	}
+
+	if (rte_graph_has_backpressure(graph)) {
+		printf("Graph reports backpressure while no node is paused\n");
+		return -1;
+	}
+
+	rte_node_backpressure_set(graph, node);
+	if (!rte_graph_has_backpressure(graph)) {
+		printf("Graph missed the backpressure assertion\n");
+		return -1;
+	}
+
+	/* Re-asserting must not bump the pause count again */
+	rte_node_backpressure_set(graph, node);
+	if (node->total_pause != 1) {
+		printf("Unexpected pause count %" PRIu64 "\n",
+		       node->total_pause);
+		return -1;
+	}
+
+	rte_node_backpressure_clear(graph, node);
+	if (rte_graph_has_backpressure(graph)) {
+		printf("Graph still reports backpressure after clear\n");
+		return -1;
+	}
+
+	return 0;
+}
+
 static int
 test_graph_lookup_functions(void)
 {
@@ -1055,6 +1136,8 @@ static struct unit_test_suite graph_testsuite = {
 		TEST_CASE(test_graph_lookup_functions),
 		TEST_CASE(test_graph_walk),
 		TEST_CASE(test_print_stats),
+		TEST_CASE(test_graph_walk_deferred),
+		TEST_CASE(test_graph_backpressure),
 		TEST_CASES_END(), /**< NULL terminate unit test array */
 	},
 };
@@ -2324,6 +2324,181 @@ test_hash_rcu_qsbr_dq_reclaim(void)
 /*
  * Do all unit and performance tests.
  */
+/*
+ * Test resizing a table in place: fill a small table, grow it, verify all
+ * keys and data survived and that the extra capacity is usable.
+ */
+static int
+test_hash_resize(void)
+{
+	struct rte_hash_parameters params = {
+		.name = "test_hash_resize",
+		.entries = 64,
+		.key_len = sizeof(uint32_t),
+		.hash_func = rte_jhash,
+		.hash_func_init_val = 0,
+		.socket_id = 0,
+	};
+	struct rte_hash *handle;
+	uint32_t key;
+	void *data;
+	int ret;
+
+	handle = rte_hash_create(&params);
+	RETURN_IF_ERROR(handle == NULL, "hash creation failed");
+
+	for (key = 0; key < 64; key++) {
+		ret = rte_hash_add_key_data(handle, &key,
+				(void *)(uintptr_t)(key + 1));
+		RETURN_IF_ERROR(ret < 0, "add key %u failed", key);
+	}
+
+	/* shrinking below the stored keys must fail and leave data intact */
+	ret = rte_hash_resize(handle, 8);
+	RETURN_IF_ERROR(ret != -ENOSPC, "undersized resize returned %d", ret);
+
+	ret = rte_hash_resize(handle, 1024);
+	RETURN_IF_ERROR(ret != 0, "resize failed: %d", ret);
+
+	for (key = 0; key < 64; key++) {
+		ret = rte_hash_lookup_data(handle, &key, &data);
+		RETURN_IF_ERROR(ret < 0, "lookup of key %u failed after resize",
+				key);
+		RETURN_IF_ERROR(data != (void *)(uintptr_t)(key + 1),
+				"wrong data for key %u after resize", key);
+	}
+
+	/* the grown table must accept more keys than the original size */
+	for (key = 64; key < 512; key++) {
+		ret = rte_hash_add_key_data(handle, &key,
+				(void *)(uintptr_t)(key + 1));
+		RETURN_IF_ERROR(ret < 0, "add key %u failed after resize", key);
+	}
+
+	rte_hash_free(handle);
+	return 0;
+}
+
+/*
+ * Test freezing a table into the flat read-only layout: all keys must
+ * still be found, updates must be refused, and unfreezing must make the
+ * table writable again.
+ */
+static int
+test_hash_freeze(void)
+{
+	struct rte_hash_parameters params = {
+		.name = "test_hash_freeze",
+		.entries = 256,
+		.key_len = sizeof(uint32_t),
+		.hash_func = rte_jhash,
+		.hash_func_init_val = 0,
+		.socket_id = 0,
+	};
+	struct rte_hash *handle;
+	uint32_t key;
+	void *data;
+	int ret;
+
+	handle = rte_hash_create(&params);
+	RETURN_IF_ERROR(handle == NULL, "hash creation failed");
+
+	for (key = 0; key < 128; key++) {
+		ret = rte_hash_add_key_data(handle, &key,
+				(void *)(uintptr_t)(key + 1));
+		RETURN_IF_ERROR(ret < 0, "add key %u failed", key);
+	}
+
+	ret = rte_hash_freeze(handle);
+	RETURN_IF_ERROR(ret != 0, "freeze failed: %d", ret);
+
+	for (key = 0; key < 128; key++) {
+		ret = rte_hash_lookup_data(handle, &key, &data);
+		RETURN_IF_ERROR(ret < 0, "lookup of key %u failed when frozen",
+				key);
+		RETURN_IF_ERROR(data != (void *)(uintptr_t)(key + 1),
+				"wrong data for key %u when frozen", key);
+	}
+
+	key = 1024;
+	ret = rte_hash_lookup(handle, &key);
+	RETURN_IF_ERROR(ret != -ENOENT, "found a key never added");
+
+	ret = rte_hash_add_key(handle, &key);
+	RETURN_IF_ERROR(ret != -EBUSY, "add to frozen table returned %d", ret);
+	key = 0;
+	ret = rte_hash_del_key(handle, &key);
+	RETURN_IF_ERROR(ret != -EBUSY, "del on frozen table returned %d", ret);
+
+	ret = rte_hash_unfreeze(handle);
+	RETURN_IF_ERROR(ret != 0, "unfreeze failed: %d", ret);
+
+	key = 1024;
+	ret = rte_hash_add_key(handle, &key);
+	RETURN_IF_ERROR(ret < 0, "add after unfreeze failed: %d", ret);
+
+	rte_hash_free(handle);
+	return 0;
+}
+
+/*
+ * Test the bulk insert API: all keys of a batch larger than the internal
+ * chunk size must land in the table, with positions matching lookups.
+ */
+static int
+test_hash_add_bulk(void)
+{
+	struct rte_hash_parameters params = {
+		.name = "test_hash_add_bulk",
+		.entries = 512,
+		.key_len = sizeof(uint32_t),
+		.hash_func = rte_jhash,
+		.hash_func_init_val = 0,
+		.socket_id = 0,
+	};
+	struct rte_hash *handle;
+	uint32_t keys[200];
+	const void *key_ptrs[200];
+	int32_t positions[200];
+	void *data_ptrs[200];
+	void *data;
+	unsigned int i;
+	int ret;
+
+	handle = rte_hash_create(&params);
+	RETURN_IF_ERROR(handle == NULL, "hash creation failed");
+
+	for (i = 0; i < RTE_DIM(keys); i++) {
+		keys[i] = i;
+		key_ptrs[i] = &keys[i];
+		data_ptrs[i] = (void *)(uintptr_t)(i + 1);
+	}
+
+	ret = rte_hash_add_key_data_bulk(handle, key_ptrs, RTE_DIM(keys),
+			data_ptrs, positions);
+	RETURN_IF_ERROR(ret != (int)RTE_DIM(keys),
+			"bulk add inserted %d of %u keys", ret,
+			(unsigned int)RTE_DIM(keys));
+
+	for (i = 0; i < RTE_DIM(keys); i++) {
+		RETURN_IF_ERROR(positions[i] < 0, "bad position for key %u", i);
+		ret = rte_hash_lookup_data(handle, &keys[i], &data);
+		RETURN_IF_ERROR(ret != positions[i],
+				"lookup position mismatch for key %u", i);
+		RETURN_IF_ERROR(data != data_ptrs[i],
+				"wrong data for key %u", i);
+	}
+
+	/* re-adding the same batch must update in place, not fill the table */
+	ret = rte_hash_add_key_bulk(handle, key_ptrs, RTE_DIM(keys), positions);
+	RETURN_IF_ERROR(ret != (int)RTE_DIM(keys),
+			"bulk re-add updated %d of %u keys", ret,
+			(unsigned int)RTE_DIM(keys));
+
+	rte_hash_free(handle);
+	return 0;
+}
+
 static int
 test_hash(void)
 {
@@ -2402,6 +2577,15 @@ test_hash(void)
 	if (test_hash_rcu_qsbr_dq_reclaim() < 0)
 		return -1;
 
+	if (test_hash_resize() < 0)
+		return -1;
+
+	if (test_hash_freeze() < 0)
+		return -1;
+
+	if (test_hash_add_bulk() < 0)
+		return -1;
+
 	return 0;
 }
 
@@ -483,6 +483,104 @@ test_ip_frag(void)
 	return result;
 }
 
+static struct rte_mbuf *
+v4_make_first_fragment(uint16_t pktid)
+{
+	struct rte_mbuf *b = rte_pktmbuf_alloc(pkt_pool);
+	struct rte_ipv4_hdr *hdr;
+	uint16_t pyld_len = 64;
+
+	if (b == NULL)
+		return NULL;
+
+	hdr = (struct rte_ipv4_hdr *)rte_pktmbuf_append(b,
+			sizeof(*hdr) + pyld_len);
+	memset(hdr, 0, sizeof(*hdr) + pyld_len);
+	hdr->version_ihl = 0x45;
+	hdr->total_length = rte_cpu_to_be_16(sizeof(*hdr) + pyld_len);
+	hdr->packet_id = rte_cpu_to_be_16(pktid);
+	hdr->fragment_offset = rte_cpu_to_be_16(RTE_IPV4_HDR_MF_FLAG);
+	hdr->time_to_live = 64;
+	hdr->next_proto_id = IPPROTO_UDP;
+	hdr->src_addr = rte_cpu_to_be_32(0x0a000001);
+	hdr->dst_addr = rte_cpu_to_be_32(0x0a000002);
+
+	b->l2_len = 0;
+	b->l3_len = sizeof(*hdr);
+	return b;
+}
+
+static int
+test_ip_frag_sharded(void)
+{
+	struct rte_ip_frag_death_row dr;
+	struct rte_ip_frag_sharded_tbl *st;
+	struct rte_ip_frag_tbl *tbl;
+	struct rte_ipv4_hdr hdr_a, hdr_b;
+	uint64_t max_cycles = rte_get_timer_hz();
+	uint64_t tms = rte_rdtsc();
+	uint32_t i, hash_a, hash_b;
+
+	/* number of shards must be a power of two */
+	st = rte_ip_frag_sharded_table_create(3, 16, 8, 128, max_cycles,
+			SOCKET_ID_ANY);
+	RTE_TEST_ASSERT(st == NULL, "accepted non power-of-2 shard count\n");
+
+	st = rte_ip_frag_sharded_table_create(4, 16, 8, 128, max_cycles,
+			SOCKET_ID_ANY);
+	RTE_TEST_ASSERT_NOT_NULL(st, "failed to create sharded table\n");
+
+	/* shard hash must not depend on fields that differ per fragment */
+	memset(&hdr_a, 0, sizeof(hdr_a));
+	hdr_a.src_addr = rte_cpu_to_be_32(0x0a000001);
+	hdr_a.dst_addr = rte_cpu_to_be_32(0x0a000002);
+	hdr_b = hdr_a;
+	hdr_b.packet_id = rte_cpu_to_be_16(77);
+	hdr_b.fragment_offset = rte_cpu_to_be_16(8);
+	hash_a = rte_ipv4_frag_shard_hash(&hdr_a);
+	hash_b = rte_ipv4_frag_shard_hash(&hdr_b);
+	RTE_TEST_ASSERT_EQUAL(hash_a, hash_b,
+			"shard hash depends on per-fragment fields\n");
+
+	/* shard selection only uses the low bits of the hash */
+	RTE_TEST_ASSERT(rte_ip_frag_sharded_table_get(st, 0) !=
+			rte_ip_frag_sharded_table_get(st, 1),
+			"adjacent hashes map to the same shard\n");
+	RTE_TEST_ASSERT(rte_ip_frag_sharded_table_get(st, 0) ==
+			rte_ip_frag_sharded_table_get(st, 4),
+			"shard selection is not modulo the shard count\n");
+
+	/* park some incomplete datagrams in one shard, then bulk-evict */
+	memset(&dr, 0, sizeof(dr));
+	tbl = rte_ip_frag_sharded_table_get(st, hash_a);
+	for (i = 0; i != 3; i++) {
+		struct rte_mbuf *b = v4_make_first_fragment(i + 1);
+		struct rte_ipv4_hdr *ip_hdr;
+		struct rte_mbuf *res;
+
+		RTE_TEST_ASSERT_NOT_NULL(b, "failed to build fragment\n");
+		ip_hdr = rte_pktmbuf_mtod(b, struct rte_ipv4_hdr *);
+		res = rte_ipv4_frag_reassemble_packet(tbl, &dr, b, tms,
+				ip_hdr);
+		RTE_TEST_ASSERT(res == NULL,
+				"incomplete datagram was reassembled\n");
+	}
+
+	RTE_TEST_ASSERT_EQUAL(rte_ip_frag_sharded_table_del_expired(st, tms),
+			0, "evicted entries that have not expired\n");
+	RTE_TEST_ASSERT_EQUAL(rte_ip_frag_sharded_table_del_expired(st,
+			tms + 2 * max_cycles), 3,
+			"wrong number of expired entries evicted\n");
+	RTE_TEST_ASSERT_EQUAL(rte_ip_frag_table_evict_expired(tbl,
+			tms + 2 * max_cycles), 0,
+			"eviction did not drain the table\n");
+
+	rte_ip_frag_free_death_row(&dr, 0);
+	rte_ip_frag_sharded_table_destroy(st);
+
+	return TEST_SUCCESS;
+}
+
 static struct unit_test_suite ipfrag_testsuite  = {
 	.suite_name = "IP Frag Unit Test Suite",
 	.setup = testsuite_setup,
@@ -490,6 +588,8 @@ static struct unit_test_suite ipfrag_testsuite  = {
 	.unit_test_cases = {
 		TEST_CASE_ST(ut_setup, ut_teardown,
 			     test_ip_frag),
+		TEST_CASE_ST(ut_setup, ut_teardown,
+			     test_ip_frag_sharded),
 
 		TEST_CASES_END() /**< NULL terminate unit test array */
 	}
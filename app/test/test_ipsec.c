@@ -117,6 +117,13 @@ static const struct ipsec_test_cfg test_cfg[] = {
 	{REPLAY_WIN_128, ESN_ENABLED, RTE_IPSEC_SAFLAG_SQN_ATOM,
 		DATA_80_BYTES, 1, 0},
 	{REPLAY_WIN_256, ESN_DISABLED, 0, DATA_100_BYTES, 1, 0},
+	{REPLAY_WIN_64, ESN_ENABLED, RTE_IPSEC_SAFLAG_RWND_2LVL,
+		DATA_64_BYTES, 1, 0},
+	{REPLAY_WIN_256, ESN_DISABLED, RTE_IPSEC_SAFLAG_RWND_2LVL,
+		DATA_100_BYTES, BURST_SIZE, REORDER_PKTS},
+	{REPLAY_WIN_128, ESN_ENABLED,
+		RTE_IPSEC_SAFLAG_SQN_ATOM | RTE_IPSEC_SAFLAG_RWND_2LVL,
+		DATA_80_BYTES, 1, 0},
 };
 
 static const int num_cfg = RTE_DIM(test_cfg);
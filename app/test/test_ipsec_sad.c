@@ -33,6 +33,7 @@ static int32_t test_add_invalid(void);
 static int32_t test_delete_invalid(void);
 static int32_t test_lookup_invalid(void);
 static int32_t test_lookup_basic(void);
+static int32_t test_lookup_spi_only(void);
 static int32_t test_lookup_adv(void);
 static int32_t test_lookup_order(void);
 
@@ -423,6 +424,79 @@ test_lookup_basic(void)
 	return status;
 }
 
+/*
+ * Check SPI_ONLY mode: creation without the SPI_ONLY table fails,
+ * add/delete for more specific rule types fail, lookup hits the rule
+ * for any key with the installed SPI and misses other SPIs
+ */
+int32_t
+test_lookup_spi_only(void)
+{
+	int status;
+	struct rte_ipsec_sad *sad = NULL;
+	struct rte_ipsec_sad_conf config;
+	struct rte_ipsec_sadv4_key tuple_v4 = {SPI, DIP, SIP};
+	struct rte_ipsec_sadv4_key tuple_v4_1 = {SPI, BAD, BAD};
+	struct rte_ipsec_sadv4_key tuple_v4_2 = {BAD, DIP, SIP};
+	const union rte_ipsec_sad_key *key_arr[] = {
+		(union rte_ipsec_sad_key *)&tuple_v4,
+		(union rte_ipsec_sad_key *)&tuple_v4_1,
+		(union rte_ipsec_sad_key *)&tuple_v4_2,
+	};
+	uint64_t tmp;
+	void *sa[3];
+
+	config.max_sa[RTE_IPSEC_SAD_SPI_ONLY] = 0;
+	config.max_sa[RTE_IPSEC_SAD_SPI_DIP] = MAX_SA;
+	config.max_sa[RTE_IPSEC_SAD_SPI_DIP_SIP] = MAX_SA;
+	config.socket_id = SOCKET_ID_ANY;
+	config.flags = RTE_IPSEC_SAD_FLAG_SPI_ONLY;
+
+	/* SPI_ONLY mode requires the SPI_ONLY table */
+	sad = rte_ipsec_sad_create(__func__, &config);
+	RTE_TEST_ASSERT(sad == NULL,
+		"Call succeeded with invalid parameters\n");
+
+	config.max_sa[RTE_IPSEC_SAD_SPI_ONLY] = MAX_SA;
+	sad = rte_ipsec_sad_create(__func__, &config);
+	RTE_TEST_ASSERT_NOT_NULL(sad, "Failed to create SAD\n");
+
+	/* more specific rules are not allowed */
+	status = rte_ipsec_sad_add(sad, (union rte_ipsec_sad_key *)&tuple_v4,
+			RTE_IPSEC_SAD_SPI_DIP, &tmp);
+	RTE_TEST_ASSERT(status < 0,
+		"Call succeeded with invalid parameters\n");
+	status = rte_ipsec_sad_del(sad, (union rte_ipsec_sad_key *)&tuple_v4,
+			RTE_IPSEC_SAD_SPI_DIP_SIP);
+	RTE_TEST_ASSERT(status < 0,
+		"Call succeeded with invalid parameters\n");
+
+	status = rte_ipsec_sad_lookup(sad, key_arr, sa, 3);
+	RTE_TEST_ASSERT((status == 0) && (sa[0] == NULL) && (sa[1] == NULL) &&
+		(sa[2] == NULL), "Lookup returns an unexpected result\n");
+
+	status = rte_ipsec_sad_add(sad, (union rte_ipsec_sad_key *)&tuple_v4,
+			RTE_IPSEC_SAD_SPI_ONLY, &tmp);
+	RTE_TEST_ASSERT(status == 0, "Failed to add a rule\n");
+
+	/* any key with the installed SPI matches, other SPIs miss */
+	status = rte_ipsec_sad_lookup(sad, key_arr, sa, 3);
+	RTE_TEST_ASSERT((status == 2) && (sa[0] == &tmp) && (sa[1] == &tmp) &&
+		(sa[2] == NULL), "Lookup returns an unexpected result\n");
+
+	status = rte_ipsec_sad_del(sad, (union rte_ipsec_sad_key *)&tuple_v4,
+			RTE_IPSEC_SAD_SPI_ONLY);
+	RTE_TEST_ASSERT(status == 0, "Failed to delete a rule\n");
+
+	status = rte_ipsec_sad_lookup(sad, key_arr, sa, 3);
+	RTE_TEST_ASSERT((status == 0) && (sa[0] == NULL),
+		"Lookup returns an unexpected result\n");
+
+	rte_ipsec_sad_destroy(sad);
+
+	return TEST_SUCCESS;
+}
+
 static int32_t
 __test_lookup_adv(int ipv6, union rte_ipsec_sad_key *tuple,
 	const union rte_ipsec_sad_key **key_arr)
@@ -885,6 +959,7 @@ static struct unit_test_suite ipsec_sad_tests = {
 		TEST_CASE(test_delete_invalid),
 		TEST_CASE(test_lookup_invalid),
 		TEST_CASE(test_lookup_basic),
+		TEST_CASE(test_lookup_spi_only),
 		TEST_CASE(test_lookup_adv),
 		TEST_CASE(test_lookup_order),
 		TEST_CASES_END()
@@ -2,6 +2,7 @@
  * Copyright(c) 2024 Ericsson AB
  */
 
+#include <errno.h>
 #include <inttypes.h>
 #include <stdio.h>
 #include <string.h>
@@ -387,6 +388,74 @@ test_large_lvar(void)
 	return TEST_SUCCESS;
 }
 
+struct snapshot_record {
+	uint64_t counter;
+	uint64_t inverted_counter;
+};
+
+static RTE_LCORE_VAR_HANDLE(struct snapshot_record, test_snapshot_record);
+
+static struct rte_lcore_var_snapshot *test_snapshot;
+
+static int
+publish_record(void *arg __rte_unused)
+{
+	struct snapshot_record *record = RTE_LCORE_VAR(test_snapshot_record);
+
+	record->counter = rte_lcore_id();
+	record->inverted_counter = ~(uint64_t)rte_lcore_id();
+
+	rte_lcore_var_snapshot_publish(test_snapshot);
+
+	/* modify the live instance; readers must not observe this */
+	record->counter = 0;
+	record->inverted_counter = 0;
+
+	return 0;
+}
+
+static int
+test_snapshot_lvar(void)
+{
+	unsigned int lcore_id;
+	struct snapshot_record record;
+
+	RTE_LCORE_VAR_ALLOC(test_snapshot_record);
+
+	test_snapshot = rte_lcore_var_snapshot_create(test_snapshot_record,
+			sizeof(struct snapshot_record));
+	TEST_ASSERT(test_snapshot != NULL, "Failed to create snapshot");
+
+	TEST_ASSERT_EQUAL(-EINVAL,
+			rte_lcore_var_snapshot_read(test_snapshot, RTE_MAX_LCORE, &record),
+			"Read with invalid lcore id did not fail");
+
+	RTE_LCORE_FOREACH_WORKER(lcore_id)
+		TEST_ASSERT_EQUAL(-ENODATA,
+				rte_lcore_var_snapshot_read(test_snapshot, lcore_id, &record),
+				"Read of unpublished value did not fail on lcore %d",
+				lcore_id);
+
+	RTE_LCORE_FOREACH_WORKER(lcore_id)
+		rte_eal_remote_launch(publish_record, NULL, lcore_id);
+
+	rte_eal_mp_wait_lcore();
+
+	RTE_LCORE_FOREACH_WORKER(lcore_id) {
+		TEST_ASSERT_EQUAL(0,
+				rte_lcore_var_snapshot_read(test_snapshot, lcore_id, &record),
+				"Failed to read published value on lcore %d", lcore_id);
+		TEST_ASSERT_EQUAL((uint64_t)lcore_id, record.counter,
+				"Unexpected published value on lcore %d", lcore_id);
+		TEST_ASSERT_EQUAL(~(uint64_t)lcore_id, record.inverted_counter,
+				"Unexpected published value on lcore %d", lcore_id);
+	}
+
+	rte_lcore_var_snapshot_free(test_snapshot);
+
+	return TEST_SUCCESS;
+}
+
 static struct unit_test_suite lcore_var_testsuite = {
 	.suite_name = "lcore variable autotest",
 	.unit_test_cases = {
@@ -396,6 +465,7 @@ static struct unit_test_suite lcore_var_testsuite = {
 		TEST_CASE(test_array_lvar),
 		TEST_CASE(test_many_lvars),
 		TEST_CASE(test_large_lvar),
+		TEST_CASE(test_snapshot_lvar),
 		TEST_CASES_END()
 	},
 };
@@ -265,6 +265,71 @@ test_str_to_size(void)
 	return 0;
 }
 
+static int
+test_malloc_profile_and_frag(void)
+{
+	struct rte_malloc_frag_stats frag;
+	uint64_t total_count = 0, total_bytes = 0;
+	unsigned int b;
+	void *p;
+
+	/* profiler smoke test: record at least one allocation */
+	if (rte_malloc_profile_enable() != 0) {
+		printf("Failed to enable malloc profiler\n");
+		return -1;
+	}
+	p = rte_malloc("profile", 64, 0);
+	rte_free(p);
+	if (rte_malloc_profile_disable() != 0) {
+		printf("Failed to disable malloc profiler\n");
+		return -1;
+	}
+	rte_malloc_profile_dump(stdout);
+	rte_malloc_profile_reset();
+
+	if (p == NULL) {
+		printf("Failed to allocate with profiler enabled\n");
+		return -1;
+	}
+
+	/* frag map must agree with the aggregate stats */
+	struct rte_malloc_socket_stats sock_stats;
+	int socket = (int)rte_socket_id();
+
+	if (rte_malloc_get_frag_stats(socket, NULL) == 0) {
+		printf("Got frag stats with NULL output\n");
+		return -1;
+	}
+	if (rte_malloc_get_frag_stats(socket, &frag) != 0) {
+		printf("Failed to get frag stats\n");
+		return -1;
+	}
+	if (rte_malloc_get_socket_stats(socket, &sock_stats) != 0) {
+		printf("Failed to get socket stats\n");
+		return -1;
+	}
+
+	for (b = 0; b < RTE_MALLOC_FRAG_BUCKETS; b++) {
+		total_count += frag.free_count[b];
+		total_bytes += frag.free_bytes[b];
+	}
+	if (total_count != frag.free_elems) {
+		printf("Frag bucket counts do not sum up\n");
+		return -1;
+	}
+	/* the heap can change between the two snapshots, sanity only */
+	if (frag.free_elems != 0 && total_bytes == 0) {
+		printf("Frag buckets report elements but no bytes\n");
+		return -1;
+	}
+	if (frag.greatest_free_size > total_bytes) {
+		printf("Largest free block exceeds total free bytes\n");
+		return -1;
+	}
+
+	return 0;
+}
+
 static int
 test_multi_alloc_statistics(void)
 {
@@ -876,6 +941,59 @@ err_return:
 	return -1;
 }
 
+static int
+test_lcore_cache(void)
+{
+	char *p1 = NULL, *p2 = NULL;
+	size_t i;
+
+	/* bad parameters must be rejected */
+	if (rte_malloc_lcore_cache_enable(0, 8) == 0)
+		return -1;
+	if (rte_malloc_lcore_cache_enable(1024, 0) == 0)
+		return -1;
+
+	if (rte_malloc_lcore_cache_enable(1024, 8) < 0)
+		return -1;
+
+	/* double enable must fail */
+	if (rte_malloc_lcore_cache_enable(1024, 8) == 0)
+		goto err_return;
+
+	p1 = rte_malloc(NULL, 256, 0);
+	if (p1 == NULL)
+		goto err_return;
+	memset(p1, 0xa5, 256);
+	rte_free(p1);
+	p1 = NULL;
+
+	/* a cached block must still come back zeroed from rte_zmalloc() */
+	p2 = rte_zmalloc(NULL, 256, 0);
+	if (p2 == NULL)
+		goto err_return;
+	for (i = 0; i < 256; i++) {
+		if (p2[i] != 0)
+			goto err_return;
+	}
+	rte_free(p2);
+	p2 = NULL;
+
+	if (rte_malloc_lcore_cache_disable() < 0)
+		goto err_return;
+
+	/* double disable must fail */
+	if (rte_malloc_lcore_cache_disable() == 0)
+		return -1;
+
+	return 0;
+
+err_return:
+	rte_free(p1);
+	rte_free(p2);
+	rte_malloc_lcore_cache_disable();
+	return -1;
+}
+
 static int
 test_malloc_bad_params(void)
 {
@@ -1137,6 +1255,22 @@ test_malloc(void)
 	else
 		printf("test_multi_alloc_statistics() passed\n");
 
+	ret = test_malloc_profile_and_frag();
+	if (ret < 0) {
+		printf("test_malloc_profile_and_frag() failed\n");
+		return ret;
+	}
+	else
+		printf("test_malloc_profile_and_frag() passed\n");
+
+	ret = test_lcore_cache();
+	if (ret < 0) {
+		printf("test_lcore_cache() failed\n");
+		return ret;
+	}
+	else
+		printf("test_lcore_cache() passed\n");
+
 	return 0;
 }
 
@@ -422,6 +422,92 @@ fail:
 	return -1;
 }
 
+#define BULK_CLONE_COUNT 8
+
+static int
+testclone_bulk(struct rte_mempool *pktmbuf_pool,
+		struct rte_mempool *clone_pool)
+{
+	struct rte_mbuf *m = NULL;
+	struct rte_mbuf *clones[BULK_CLONE_COUNT];
+	unaligned_uint32_t *data;
+	unsigned int i;
+
+	memset(clones, 0, sizeof(clones));
+
+	/* alloc and fill an mbuf */
+	m = rte_pktmbuf_alloc(pktmbuf_pool);
+	if (m == NULL)
+		GOTO_FAIL("ooops not allocating mbuf");
+
+	rte_pktmbuf_append(m, sizeof(uint32_t));
+	data = rte_pktmbuf_mtod(m, unaligned_uint32_t *);
+	*data = MAGIC_DATA;
+
+	/* clone it in bulk */
+	if (rte_pktmbuf_clone_bulk(m, clone_pool, clones,
+			BULK_CLONE_COUNT) != 0)
+		GOTO_FAIL("cannot bulk clone data\n");
+
+	for (i = 0; i < BULK_CLONE_COUNT; i++) {
+		data = rte_pktmbuf_mtod(clones[i], unaligned_uint32_t *);
+		if (*data != MAGIC_DATA)
+			GOTO_FAIL("invalid data in clone[%u]\n", i);
+	}
+
+	if (testclone_refcnt_read(m) != BULK_CLONE_COUNT + 1)
+		GOTO_FAIL("invalid refcnt in m\n");
+
+	/* free the clones, source must become sole owner again */
+	rte_pktmbuf_free_bulk(clones, BULK_CLONE_COUNT);
+	memset(clones, 0, sizeof(clones));
+
+	if (testclone_refcnt_read(m) != 1)
+		GOTO_FAIL("invalid refcnt in m after freeing clones\n");
+
+	/* same test with a chained mbuf */
+	m->next = rte_pktmbuf_alloc(pktmbuf_pool);
+	if (m->next == NULL)
+		GOTO_FAIL("Next Pkt Null\n");
+	m->nb_segs = 2;
+
+	rte_pktmbuf_append(m->next, sizeof(uint32_t));
+	m->pkt_len = 2 * sizeof(uint32_t);
+
+	data = rte_pktmbuf_mtod(m->next, unaligned_uint32_t *);
+	*data = MAGIC_DATA;
+
+	if (rte_pktmbuf_clone_bulk(m, clone_pool, clones,
+			BULK_CLONE_COUNT) != 0)
+		GOTO_FAIL("cannot bulk clone chained data\n");
+
+	for (i = 0; i < BULK_CLONE_COUNT; i++) {
+		data = rte_pktmbuf_mtod(clones[i]->next, unaligned_uint32_t *);
+		if (*data != MAGIC_DATA)
+			GOTO_FAIL("invalid data in clone[%u]->next\n", i);
+	}
+
+	if (testclone_refcnt_read(m) != BULK_CLONE_COUNT + 1)
+		GOTO_FAIL("invalid refcnt in m\n");
+
+	if (testclone_refcnt_read(m->next) != BULK_CLONE_COUNT + 1)
+		GOTO_FAIL("invalid refcnt in m->next\n");
+
+	rte_pktmbuf_free_bulk(clones, BULK_CLONE_COUNT);
+	memset(clones, 0, sizeof(clones));
+
+	/* free mbuf */
+	rte_pktmbuf_free(m);
+	m = NULL;
+	printf("%s ok\n", __func__);
+	return 0;
+
+fail:
+	rte_pktmbuf_free(m);
+	rte_pktmbuf_free_bulk(clones, BULK_CLONE_COUNT);
+	return -1;
+}
+
 static int
 test_pktmbuf_copy(struct rte_mempool *pktmbuf_pool,
 		  struct rte_mempool *clone_pool)
@@ -2412,6 +2498,86 @@ fail:
 	return -1;
 }
 
+#define EXT_BULK_MBUF_NUM 4
+
+/*
+ * Test bulk attach/detach of the same external buffer
+ *  - Allocate a burst of mbufs and an external buffer.
+ *  - Attach the buffer to all mbufs in one call, check the refcount.
+ *  - Detach the whole burst in one call, the buffer must be freed via
+ *    the callback and the mbufs restored to their original buffers.
+ */
+static int
+test_pktmbuf_ext_bulk_attach_detach(struct rte_mempool *pktmbuf_pool)
+{
+	struct rte_mbuf *mbufs[EXT_BULK_MBUF_NUM];
+	struct rte_mbuf_ext_shared_info *ret_shinfo = NULL;
+	rte_iova_t buf_iova;
+	void *ext_buf_addr = NULL;
+	uint16_t buf_len = EXT_BUF_TEST_DATA_LEN +
+				sizeof(struct rte_mbuf_ext_shared_info);
+	bool freed = false;
+	int i;
+
+	memset(mbufs, 0, sizeof(mbufs));
+
+	for (i = 0; i < EXT_BULK_MBUF_NUM; i++) {
+		mbufs[i] = rte_pktmbuf_alloc(pktmbuf_pool);
+		if (mbufs[i] == NULL)
+			GOTO_FAIL("%s: mbuf allocation failed!\n", __func__);
+	}
+
+	ext_buf_addr = rte_malloc("External buffer", buf_len,
+			RTE_CACHE_LINE_SIZE);
+	if (ext_buf_addr == NULL)
+		GOTO_FAIL("%s: External buffer allocation failed\n", __func__);
+
+	ret_shinfo = rte_pktmbuf_ext_shinfo_init_helper(ext_buf_addr, &buf_len,
+		ext_buf_free_callback_fn, &freed);
+	if (ret_shinfo == NULL)
+		GOTO_FAIL("%s: Shared info initialization failed!\n", __func__);
+
+	/* attach the same buffer to the whole burst at once */
+	buf_iova = rte_mem_virt2iova(ext_buf_addr);
+	rte_pktmbuf_attach_extbuf_bulk(mbufs, EXT_BULK_MBUF_NUM, ext_buf_addr,
+		buf_iova, buf_len, ret_shinfo);
+
+	if (rte_mbuf_ext_refcnt_read(ret_shinfo) != EXT_BULK_MBUF_NUM)
+		GOTO_FAIL("%s: Invalid ext_buf ref_cnt\n", __func__);
+
+	for (i = 0; i < EXT_BULK_MBUF_NUM; i++) {
+		if (mbufs[i]->ol_flags != RTE_MBUF_F_EXTERNAL)
+			GOTO_FAIL("%s: External buffer is not attached to mbuf\n",
+					__func__);
+	}
+
+	/* detach the whole burst, the buffer must be freed via callback */
+	rte_pktmbuf_detach_extbuf_bulk(mbufs, EXT_BULK_MBUF_NUM);
+	if (!freed)
+		GOTO_FAIL("%s: extbuf should be freed\n", __func__);
+	ext_buf_addr = NULL;
+
+	for (i = 0; i < EXT_BULK_MBUF_NUM; i++) {
+		if (RTE_MBUF_HAS_EXTBUF(mbufs[i]))
+			GOTO_FAIL("%s: mbuf was not restored\n", __func__);
+		rte_pktmbuf_free(mbufs[i]);
+		mbufs[i] = NULL;
+	}
+
+	return 0;
+
+fail:
+	for (i = 0; i < EXT_BULK_MBUF_NUM; i++) {
+		rte_pktmbuf_free(mbufs[i]);
+		mbufs[i] = NULL;
+	}
+	if (ext_buf_addr != NULL) {
+		rte_free(ext_buf_addr);
+		ext_buf_addr = NULL;
+	}
+	return -1;
+}
+
 /*
  * Test the mbuf pool with pinned external data buffers
  *  - Allocate memory zone for external buffer
@@ -2563,7 +2729,25 @@ test_mbuf_dyn(struct rte_mempool *pktmbuf_pool)
 		.name = "test-dynfield",
 		.size = sizeof(uint8_t),
 		.align = alignof(uint8_t),
-		.flags = 1,
+		.flags = 1U << 31,
+	};
+	const struct rte_mbuf_dynfield dynfield_fail_class = {
+		.name = "test-dynfield-fail-class",
+		.size = sizeof(uint8_t),
+		.align = alignof(uint8_t),
+		.flags = RTE_MBUF_DYNFIELD_FLAG_HOT | RTE_MBUF_DYNFIELD_FLAG_COLD,
+	};
+	const struct rte_mbuf_dynfield dynfield_hot = {
+		.name = "test-dynfield-hot",
+		.size = sizeof(uint8_t),
+		.align = alignof(uint8_t),
+		.flags = RTE_MBUF_DYNFIELD_FLAG_HOT,
+	};
+	const struct rte_mbuf_dynfield dynfield_cold = {
+		.name = "test-dynfield-cold",
+		.size = sizeof(uint8_t),
+		.align = alignof(uint8_t),
+		.flags = RTE_MBUF_DYNFIELD_FLAG_COLD,
 	};
 	const struct rte_mbuf_dynflag dynflag_fail_flag = {
 		.name = "test-dynflag",
@@ -2634,6 +2818,26 @@ test_mbuf_dyn(struct rte_mempool *pktmbuf_pool)
 	if (ret != -1)
 		GOTO_FAIL("dynamic field creation should fail (invalid flag)");
 
+	ret = rte_mbuf_dynfield_register(&dynfield_fail_class);
+	if (ret != -1)
+		GOTO_FAIL("dynamic field creation should fail (hot and cold)");
+
+	ret = rte_mbuf_dynfield_register(&dynfield_cold);
+	if (ret == -1 || ret < RTE_CACHE_LINE_MIN_SIZE)
+		GOTO_FAIL("failed to register cold dynamic field, ret=%d: %s",
+			ret, strerror(errno));
+
+	ret = rte_mbuf_dynfield_register(&dynfield_hot);
+	if (ret == -1) {
+		if (rte_errno == ENOENT)
+			printf("mbuf test skipped: no free room in first cache line\n");
+		else
+			GOTO_FAIL("failed to register hot dynamic field: %s",
+				strerror(errno));
+	} else if (ret + dynfield_hot.size > RTE_CACHE_LINE_MIN_SIZE) {
+		GOTO_FAIL("hot dynamic field landed at offset %d", ret);
+	}
+
 	ret = rte_mbuf_dynflag_register(&dynflag_fail_flag);
 	if (ret != -1)
 		GOTO_FAIL("dynamic flag creation should fail (invalid flag)");
@@ -2842,6 +3046,11 @@ test_mbuf(void)
 		goto err;
 	}
 
+	if (testclone_bulk(pktmbuf_pool, pktmbuf_pool) < 0) {
+		printf("testclone_bulk() failed \n");
+		goto err;
+	}
+
 	if (test_pktmbuf_copy(pktmbuf_pool, pktmbuf_pool) < 0) {
 		printf("test_pktmbuf_copy() failed\n");
 		goto err;
@@ -2933,6 +3142,12 @@ test_mbuf(void)
 		goto err;
 	}
 
+	/* test bulk attach/detach of an external buffer */
+	if (test_pktmbuf_ext_bulk_attach_detach(pktmbuf_pool) < 0) {
+		printf("test_pktmbuf_ext_bulk_attach_detach() failed\n");
+		goto err;
+	}
+
 	/* test the mbuf pool with pinned external data buffers */
 	if (test_pktmbuf_ext_pinned_buffer(pktmbuf_pool) < 0) {
 		printf("test_pktmbuf_ext_pinned_buffer() failed\n");
@@ -951,6 +951,156 @@ test_member_sketch(void)
 	return 0;
 }
 
+static int
+test_member_sketch_bulk_merge(void)
+{
+	struct rte_member_setsum *bulk_ss, *scalar_ss;
+	uint32_t keys[256];
+	const void *key_ptrs[256];
+	uint64_t count_bulk, count_scalar;
+	uint32_t tmp_key;
+	unsigned int i;
+	int ret;
+
+	for (i = 0; i < RTE_DIM(keys); i++) {
+		keys[i] = i % 16;
+		key_ptrs[i] = &keys[i];
+	}
+
+	params.key_len = 4;
+	params.type = RTE_MEMBER_TYPE_SKETCH;
+	params.error_rate = SKETCH_ERROR_RATE;
+	params.sample_rate = 1;
+	params.extra_flag = 0;
+	params.top_k = TOP_K;
+	params.prim_hash_seed = 0x12345678;
+	params.sec_hash_seed = 0x87654321;
+
+	params.name = "test_sketch_bulk";
+	bulk_ss = rte_member_create(&params);
+	if (bulk_ss == NULL) {
+		printf("Creation of bulk sketch failed\n");
+		return -1;
+	}
+
+	params.name = "test_sketch_scalar";
+	scalar_ss = rte_member_create(&params);
+	if (scalar_ss == NULL) {
+		printf("Creation of scalar sketch failed\n");
+		rte_member_free(bulk_ss);
+		return -1;
+	}
+
+	/* the same key stream must produce the same counters either way */
+	ret = rte_member_add_bulk(bulk_ss, key_ptrs, RTE_DIM(keys), NULL);
+	if (ret < 0) {
+		printf("rte_member_add_bulk Failed! Error [%d]\n", ret);
+		goto fail;
+	}
+	for (i = 0; i < RTE_DIM(keys); i++)
+		rte_member_add(scalar_ss, &keys[i], 1);
+
+	tmp_key = 0;
+	rte_member_query_count(bulk_ss, &tmp_key, &count_bulk);
+	rte_member_query_count(scalar_ss, &tmp_key, &count_scalar);
+	if (count_bulk != count_scalar) {
+		printf("bulk count %"PRIu64" != scalar count %"PRIu64"\n",
+			count_bulk, count_scalar);
+		goto fail;
+	}
+
+	/* merging identically parameterized sketches doubles the counters */
+	ret = rte_member_merge(bulk_ss, scalar_ss);
+	if (ret < 0) {
+		printf("rte_member_merge Failed! Error [%d]\n", ret);
+		goto fail;
+	}
+	rte_member_query_count(bulk_ss, &tmp_key, &count_bulk);
+	if (count_bulk != 2 * count_scalar) {
+		printf("merged count %"PRIu64" != doubled count %"PRIu64"\n",
+			count_bulk, 2 * count_scalar);
+		goto fail;
+	}
+
+	rte_member_free(bulk_ss);
+	rte_member_free(scalar_ss);
+	return 0;
+
+fail:
+	rte_member_free(bulk_ss);
+	rte_member_free(scalar_ss);
+	return -1;
+}
+
+static int
+test_member_vbf_merge(void)
+{
+	struct rte_member_setsum *query_ss, *replica_ss, *odd_ss;
+	uint16_t set_vbf;
+	int ret, i;
+
+	params.key_len = sizeof(struct flow_key);
+	params.type = RTE_MEMBER_TYPE_VBF;
+
+	params.name = "test_vbf_query";
+	query_ss = rte_member_create(&params);
+	if (query_ss == NULL) {
+		printf("Creation of query vbf failed\n");
+		return -1;
+	}
+
+	params.name = "test_vbf_replica";
+	replica_ss = rte_member_create(&params);
+	if (replica_ss == NULL) {
+		printf("Creation of replica vbf failed\n");
+		rte_member_free(query_ss);
+		return -1;
+	}
+
+	/* writers insert only into their private replica */
+	for (i = 0; i < NUM_SAMPLES; i++)
+		rte_member_add(replica_ss, &keys[i], test_set[i]);
+
+	/* the union must report everything inserted into the replica */
+	ret = rte_member_merge(query_ss, replica_ss);
+	if (ret < 0) {
+		printf("rte_member_merge Failed! Error [%d]\n", ret);
+		goto fail;
+	}
+	for (i = 0; i < NUM_SAMPLES; i++) {
+		ret = rte_member_lookup(query_ss, &keys[i], &set_vbf);
+		if (ret <= 0 || set_vbf != test_set[i]) {
+			printf("Merged vbf misses replica key %d\n", i);
+			goto fail;
+		}
+	}
+
+	/* differently seeded vbfs must be rejected */
+	params.name = "test_vbf_odd_seed";
+	params.prim_hash_seed++;
+	odd_ss = rte_member_create(&params);
+	params.prim_hash_seed--;
+	if (odd_ss == NULL) {
+		printf("Creation of odd-seed vbf failed\n");
+		goto fail;
+	}
+	ret = rte_member_merge(query_ss, odd_ss);
+	rte_member_free(odd_ss);
+	if (ret != -EINVAL) {
+		printf("Merge of differently seeded vbfs not rejected\n");
+		goto fail;
+	}
+
+	rte_member_free(query_ss);
+	rte_member_free(replica_ss);
+	return 0;
+
+fail:
+	rte_member_free(query_ss);
+	rte_member_free(replica_ss);
+	return -1;
+}
+
 static int
 test_member(void)
 {
@@ -990,6 +1140,16 @@ test_member(void)
 		perform_free();
 		return -1;
 	}
+
+	if (test_member_sketch_bulk_merge() < 0) {
+		perform_free();
+		return -1;
+	}
+
+	if (test_member_vbf_merge() < 0) {
+		perform_free();
+		return -1;
+	}
 	perform_free();
 	return 0;
 }
@@ -2,6 +2,7 @@
  * Copyright(c) 2010-2014 Intel Corporation
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
@@ -44,7 +45,8 @@ static size_t buf_sizes[TEST_VALUE_RANGE];
  * changed.
  */
 static int
-test_single_memcpy(unsigned int off_src, unsigned int off_dst, size_t size)
+test_single_memcpy(unsigned int off_src, unsigned int off_dst, size_t size,
+		bool nt)
 {
 	unsigned int i;
 	uint8_t dest[SMALL_BUFFER_SIZE + ALIGNMENT_UNIT];
@@ -58,7 +60,11 @@ test_single_memcpy(unsigned int off_src, unsigned int off_dst, size_t size)
 	}
 
 	/* Do the copy */
-	ret = rte_memcpy(dest + off_dst, src + off_src, size);
+	if (nt)
+		ret = rte_memcpy_ex(dest + off_dst, src + off_src, size,
+				RTE_MEMCPY_F_DST_NT);
+	else
+		ret = rte_memcpy(dest + off_dst, src + off_src, size);
 	if (ret != (dest + off_dst)) {
 		printf("rte_memcpy() returned %p, not %p\n",
 		       ret, dest + off_dst);
@@ -100,7 +106,7 @@ test_single_memcpy(unsigned int off_src, unsigned int off_dst, size_t size)
  * Check functionality for various buffer sizes and data offsets/alignments.
  */
 static int
-func_test(void)
+func_test(bool nt)
 {
 	unsigned int off_src, off_dst, i;
 	int ret;
@@ -109,7 +115,7 @@ func_test(void)
 		for (off_dst = 0; off_dst < ALIGNMENT_UNIT; off_dst++) {
 			for (i = 0; i < RTE_DIM(buf_sizes); i++) {
 				ret = test_single_memcpy(off_src, off_dst,
-				                         buf_sizes[i]);
+				                         buf_sizes[i], nt);
 				if (ret != 0)
 					return -1;
 			}
@@ -123,7 +129,21 @@ test_memcpy(void)
 {
 	int ret;
 
-	ret = func_test();
+	ret = func_test(false);
+	if (ret != 0)
+		return -1;
+
+#ifdef RTE_ARCH_X86_64
+	/* Check the calibrated crossover does not break the copy */
+	rte_memcpy_nt_calibrate();
+
+	/* Force the streaming store path for all sizes */
+	rte_memcpy_nt_threshold = 0;
+#endif
+	ret = func_test(true);
+#ifdef RTE_ARCH_X86_64
+	rte_memcpy_nt_threshold = RTE_MEMCPY_NT_THRESHOLD_DEFAULT;
+#endif
 	if (ret != 0)
 		return -1;
 	return 0;
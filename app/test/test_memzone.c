@@ -1098,6 +1098,61 @@ test_memzone_basic(void)
 	return 0;
 }
 
+static int
+test_memzone_replicated(void)
+{
+	const struct rte_memzone *local, *lookup;
+	uint64_t pattern = 0xa5a5a5a5a5a5a5a5;
+	uint64_t zero = 0;
+
+	local = rte_memzone_reserve_replicated("tz_repl", 1024, 0, 0);
+	if (local == NULL) {
+		printf("cannot reserve replicated memzone\n");
+		return -1;
+	}
+
+	lookup = rte_memzone_lookup_local("tz_repl");
+	if (lookup == NULL) {
+		printf("cannot find local replica\n");
+		goto fail;
+	}
+
+	if (rte_memzone_replicated_update("tz_repl", 64, &pattern,
+			sizeof(pattern)) < 0) {
+		printf("cannot update replicated memzone\n");
+		goto fail;
+	}
+
+	if (memcmp(RTE_PTR_ADD(lookup->addr, 64), &pattern,
+			sizeof(pattern)) != 0) {
+		printf("update not visible in local replica\n");
+		goto fail;
+	}
+
+	/* out of bounds update must fail */
+	if (rte_memzone_replicated_update("tz_repl", 1024, &zero,
+			sizeof(zero)) == 0) {
+		printf("out of bounds update did not fail\n");
+		goto fail;
+	}
+
+	if (rte_memzone_free_replicated("tz_repl") < 0) {
+		printf("cannot free replicated memzone\n");
+		return -1;
+	}
+
+	if (rte_memzone_lookup_local("tz_repl") != NULL) {
+		printf("replica still present after free\n");
+		return -1;
+	}
+
+	return 0;
+
+fail:
+	rte_memzone_free_replicated("tz_repl");
+	return -1;
+}
+
 static int
 test_memzone(void)
 {
@@ -1149,6 +1204,10 @@ test_memzone(void)
 	if (test_memzone_reserve_max_aligned() < 0)
 		return -1;
 
+	printf("test replicated memzone\n");
+	if (test_memzone_replicated() < 0)
+		return -1;
+
 	printf("check memzone cleanup\n");
 	memzone_walk_cnt = 0;
 	test_memzones_left = 0;
@@ -312,6 +312,86 @@ tm_test_trtcm_color_blind_check(void)
 	return 0;
 }
 
+/**
+ * functional test for rte_meter_srtcm_color_blind_check_bulk
+ */
+static inline int
+tm_test_srtcm_color_blind_check_bulk(void)
+{
+#define SRTCM_BLIND_CHECK_BULK_MSG "srtcm_blind_check_bulk"
+	struct rte_meter_srtcm_profile sp;
+	struct rte_meter_srtcm sm1, sm2;
+	enum rte_color color[4];
+	uint32_t pkt_len[4];
+	uint64_t time;
+	uint64_t hz = rte_get_tsc_hz();
+	uint32_t i;
+
+	pkt_len[0] = TM_TEST_SRTCM_CBS_DF - 1;
+	pkt_len[1] = TM_TEST_SRTCM_CBS_DF + 1;
+	pkt_len[2] = TM_TEST_SRTCM_EBS_DF - 1;
+	pkt_len[3] = TM_TEST_SRTCM_EBS_DF + 1;
+
+	if (rte_meter_srtcm_profile_config(&sp, &sparams) != 0)
+		melog(SRTCM_BLIND_CHECK_BULK_MSG);
+	if (rte_meter_srtcm_config(&sm1, &sp) != 0)
+		melog(SRTCM_BLIND_CHECK_BULK_MSG);
+	if (rte_meter_srtcm_config(&sm2, &sp) != 0)
+		melog(SRTCM_BLIND_CHECK_BULK_MSG);
+
+	time = rte_get_tsc_cycles() + hz;
+	rte_meter_srtcm_color_blind_check_bulk(&sm1, &sp, time, pkt_len,
+		color, 4);
+
+	/* Must match the per packet checks sharing the burst time stamp */
+	for (i = 0; i < 4; i++)
+		if (rte_meter_srtcm_color_blind_check(
+			&sm2, &sp, time, pkt_len[i]) != color[i])
+			melog(SRTCM_BLIND_CHECK_BULK_MSG" %u", i);
+
+	return 0;
+}
+
+/**
+ * functional test for rte_meter_trtcm_color_blind_check_bulk
+ */
+static inline int
+tm_test_trtcm_color_blind_check_bulk(void)
+{
+#define TRTCM_BLIND_CHECK_BULK_MSG "trtcm_blind_check_bulk"
+	struct rte_meter_trtcm_profile tp;
+	struct rte_meter_trtcm tm1, tm2;
+	enum rte_color color[4];
+	uint32_t pkt_len[4];
+	uint64_t time;
+	uint64_t hz = rte_get_tsc_hz();
+	uint32_t i;
+
+	pkt_len[0] = TM_TEST_TRTCM_CBS_DF - 1;
+	pkt_len[1] = TM_TEST_TRTCM_CBS_DF + 1;
+	pkt_len[2] = TM_TEST_TRTCM_PBS_DF - 1;
+	pkt_len[3] = TM_TEST_TRTCM_PBS_DF + 1;
+
+	if (rte_meter_trtcm_profile_config(&tp, &tparams) != 0)
+		melog(TRTCM_BLIND_CHECK_BULK_MSG);
+	if (rte_meter_trtcm_config(&tm1, &tp) != 0)
+		melog(TRTCM_BLIND_CHECK_BULK_MSG);
+	if (rte_meter_trtcm_config(&tm2, &tp) != 0)
+		melog(TRTCM_BLIND_CHECK_BULK_MSG);
+
+	time = rte_get_tsc_cycles() + hz;
+	rte_meter_trtcm_color_blind_check_bulk(&tm1, &tp, time, pkt_len,
+		color, 4);
+
+	/* Must match the per packet checks sharing the burst time stamp */
+	for (i = 0; i < 4; i++)
+		if (rte_meter_trtcm_color_blind_check(
+			&tm2, &tp, time, pkt_len[i]) != color[i])
+			melog(TRTCM_BLIND_CHECK_BULK_MSG" %u", i);
+
+	return 0;
+}
+
 /**
  * functional test for rte_meter_trtcm_rfc4115_color_blind_check
  */
@@ -700,6 +780,12 @@ test_meter(void)
 	if (tm_test_trtcm_rfc4115_color_blind_check() != 0)
 		return -1;
 
+	if (tm_test_srtcm_color_blind_check_bulk() != 0)
+		return -1;
+
+	if (tm_test_trtcm_color_blind_check_bulk() != 0)
+		return -1;
+
 	if (tm_test_srtcm_color_aware_check() != 0)
 		return -1;
 
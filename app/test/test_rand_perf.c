@@ -9,11 +9,12 @@
 #include <rte_cycles.h>
 #include <rte_random.h>
 
+#include "bench_harness.h"
 #include "test.h"
 
 static volatile uint64_t vsum;
 
-#define ITERATIONS (100000000)
+#define ITERATIONS (10000000)
 
 #define BEST_CASE_BOUND (1<<16)
 #define WORST_CASE_BOUND (BEST_CASE_BOUND + 1)
@@ -30,30 +31,26 @@ rand_type_desc(enum rand_type rand_type)
 {
 	switch (rand_type) {
 	case rand_type_64:
-		return "Full 64-bit [rte_rand()]";
+		return "rte_rand";
 	case rand_type_float:
-		return "Floating point [rte_drand()]";
+		return "rte_drand";
 	case rand_type_bounded_best_case:
-		return "Bounded average best-case [rte_rand_max()]";
+		return "rte_rand_max best-case bound";
 	case rand_type_bounded_worst_case:
-		return "Bounded average worst-case [rte_rand_max()]";
+		return "rte_rand_max worst-case bound";
 	default:
 		return NULL;
 	}
 }
 
-static __rte_always_inline void
-test_rand_perf_type(enum rand_type rand_type)
+static void
+test_rand_perf_type(void *arg, uint64_t iterations)
 {
-	uint64_t start;
-	uint32_t i;
-	uint64_t end;
+	const enum rand_type rand_type = *(enum rand_type *)arg;
 	uint64_t sum = 0;
-	uint64_t op_latency;
+	uint64_t i;
 
-	start = rte_rdtsc();
-
-	for (i = 0; i < ITERATIONS; i++) {
+	for (i = 0; i < iterations; i++) {
 		switch (rand_type) {
 		case rand_type_64:
 			sum += rte_rand();
@@ -70,30 +67,29 @@ test_rand_perf_type(enum rand_type rand_type)
 		}
 	}
 
-	end = rte_rdtsc();
-
 	/* to avoid an optimizing compiler removing the whole loop */
 	vsum = sum;
-
-	op_latency = (end - start) / ITERATIONS;
-
-	printf("%s: %"PRId64" TSC cycles/op\n", rand_type_desc(rand_type),
-	       op_latency);
 }
 
 static int
 test_rand_perf(void)
 {
+	enum rand_type rand_type;
+
 	rte_srand(42);
 
 	printf("Pseudo-random number generation latencies:\n");
+	bench_print_header();
+
+	for (rand_type = rand_type_64; rand_type <= rand_type_bounded_worst_case;
+	     rand_type++) {
+		if (bench_run("rand", rand_type_desc(rand_type),
+			      test_rand_perf_type, &rand_type,
+			      ITERATIONS, NULL) < 0)
+			return TEST_FAILED;
+	}
 
-	test_rand_perf_type(rand_type_64);
-	test_rand_perf_type(rand_type_float);
-	test_rand_perf_type(rand_type_bounded_best_case);
-	test_rand_perf_type(rand_type_bounded_worst_case);
-
-	return 0;
+	return TEST_SUCCESS;
 }
 
 REGISTER_PERF_TEST(rand_perf_autotest, test_rand_perf);
@@ -621,6 +621,29 @@ test_rcu_qsbr_free_resource2(void *p, void *e, unsigned int n)
 	}
 }
 
+static unsigned int burst_freed;
+
+/* Batch capable free function. The resources are a contiguous array of
+ * counters enqueued in increasing order.
+ */
+static void
+test_rcu_qsbr_free_resource3(void *p, void *e, unsigned int n)
+{
+	const uint64_t *sc = (const uint64_t *)e;
+	unsigned int i;
+
+	if (p != NULL || e == NULL || n == 0) {
+		printf("%s: Test failed\n", __func__);
+		cb_failed = 1;
+	}
+	for (i = 0; i < n; i++)
+		if (sc[i] != burst_freed + i) {
+			printf("%s: Test failed\n", __func__);
+			cb_failed = 1;
+		}
+	burst_freed += n;
+}
+
 /*
  * rte_rcu_qsbr_dq_create: create a queue used to store the data structure
  * elements that can be freed later. This queue is referred to as 'defer queue'.
@@ -766,6 +789,102 @@ test_rcu_qsbr_dq_reclaim(void)
 	return 0;
 }
 
+/*
+ * rte_rcu_qsbr_dq_reclaim_burst: Reclaim resources from the defer queue,
+ * passing whole batches to the free function.
+ */
+static int
+test_rcu_qsbr_dq_reclaim_burst(void)
+{
+	int i, ret;
+	char rcu_dq_name[RTE_RCU_QSBR_DQ_NAMESIZE];
+	struct rte_rcu_qsbr_dq_parameters params;
+	struct rte_rcu_qsbr_dq *dq;
+	unsigned int freed, pending;
+	uint32_t service_id;
+	uint64_t e;
+
+	printf("\nTest rte_rcu_qsbr_dq_reclaim_burst()\n");
+
+	/* Pass invalid parameters */
+	ret = rte_rcu_qsbr_dq_reclaim_burst(NULL, 10, NULL, NULL, NULL);
+	TEST_RCU_QSBR_RETURN_IF_ERROR((ret != 1),
+		"dq reclaim burst invalid params");
+
+	ret = rte_rcu_qsbr_dq_service_register(NULL, NULL);
+	TEST_RCU_QSBR_RETURN_IF_ERROR((ret != 1),
+		"dq service register invalid params");
+
+	ret = rte_rcu_qsbr_dq_service_unregister(NULL);
+	TEST_RCU_QSBR_RETURN_IF_ERROR((ret != 1),
+		"dq service unregister invalid params");
+
+	/* Create a queue. No threads are registered on the RCU variable,
+	 * so every grace period is immediately over.
+	 */
+	memset(&params, 0, sizeof(struct rte_rcu_qsbr_dq_parameters));
+	snprintf(rcu_dq_name, sizeof(rcu_dq_name), "TEST_RCU");
+	params.name = rcu_dq_name;
+	params.free_fn = test_rcu_qsbr_free_resource3;
+	rte_rcu_qsbr_init(t[0], RTE_MAX_LCORE);
+	params.v = t[0];
+	params.size = 128;
+	params.esize = 8;
+	/* Keep automatic reclamation in enqueue out of the way */
+	params.trigger_reclaim_limit = params.size;
+	params.max_reclaim_size = params.size;
+	dq = rte_rcu_qsbr_dq_create(&params);
+	TEST_RCU_QSBR_RETURN_IF_ERROR((dq == NULL), "dq create valid params");
+
+	ret = rte_rcu_qsbr_dq_reclaim_burst(dq, 0, NULL, NULL, NULL);
+	TEST_RCU_QSBR_RETURN_IF_ERROR((ret != 1),
+		"dq reclaim burst invalid params");
+
+	/* Enqueue more entries than one internal burst, reclaim them all in
+	 * one call and validate that the free function saw every counter in
+	 * order, in batches larger than one.
+	 */
+	cb_failed = 0;
+	burst_freed = 0;
+	for (i = 0; i < 100; i++) {
+		e = i;
+		ret = rte_rcu_qsbr_dq_enqueue(dq, &e);
+		TEST_RCU_QSBR_RETURN_IF_ERROR((ret != 0),
+			"dq enqueue functional");
+	}
+
+	ret = rte_rcu_qsbr_dq_reclaim_burst(dq, ~0, &freed, &pending, NULL);
+	TEST_RCU_QSBR_RETURN_IF_ERROR((ret != 0),
+		"dq reclaim burst valid params");
+	TEST_RCU_QSBR_RETURN_IF_ERROR((freed != 100 || pending != 0),
+		"dq reclaim burst resource count");
+	TEST_RCU_QSBR_RETURN_IF_ERROR((burst_freed != 100 || cb_failed == 1),
+		"CB failed");
+
+	/* Register and unregister the reclamation service */
+	ret = rte_rcu_qsbr_dq_service_register(dq, &service_id);
+	TEST_RCU_QSBR_RETURN_IF_ERROR((ret != 0), "dq service register");
+
+	ret = rte_rcu_qsbr_dq_service_register(dq, NULL);
+	TEST_RCU_QSBR_RETURN_IF_ERROR((ret != 1), "dq service double register");
+
+	ret = rte_rcu_qsbr_dq_service_unregister(dq);
+	TEST_RCU_QSBR_RETURN_IF_ERROR((ret != 0), "dq service unregister");
+
+	ret = rte_rcu_qsbr_dq_service_unregister(dq);
+	TEST_RCU_QSBR_RETURN_IF_ERROR((ret != 1),
+		"dq service double unregister");
+
+	/* Delete must unregister a still registered service itself */
+	ret = rte_rcu_qsbr_dq_service_register(dq, NULL);
+	TEST_RCU_QSBR_RETURN_IF_ERROR((ret != 0), "dq service register");
+
+	ret = rte_rcu_qsbr_dq_delete(dq);
+	TEST_RCU_QSBR_RETURN_IF_ERROR((ret != 0), "dq delete valid params");
+
+	return 0;
+}
+
 /*
  * rte_rcu_qsbr_dq_delete: Delete a defer queue.
  */
@@ -1381,6 +1500,9 @@ test_rcu_qsbr_main(void)
 	if (test_rcu_qsbr_dq_reclaim() < 0)
 		goto test_fail;
 
+	if (test_rcu_qsbr_dq_reclaim_burst() < 0)
+		goto test_fail;
+
 	if (test_rcu_qsbr_dq_delete() < 0)
 		goto test_fail;
 
@@ -214,6 +214,80 @@ exit:
 	return ret;
 }
 
+static int
+test_reorder_insert_bulk(void)
+{
+#define BULK_NUM_BUFS 8u
+
+	struct rte_reorder_buffer *b = NULL;
+	struct rte_mempool *p = test_params->p;
+	const unsigned int size = BULK_NUM_BUFS;
+	static const uint32_t seqns[BULK_NUM_BUFS] = {3, 0, 6, 1, 7, 2, 5, 4};
+	struct rte_mbuf *bufs[BULK_NUM_BUFS];
+	struct rte_mbuf *robufs[BULK_NUM_BUFS];
+	int ret = 0;
+	unsigned int i, cnt;
+
+	memset(robufs, 0, sizeof(robufs));
+
+	b = rte_reorder_create("test_insert_bulk", rte_socket_id(), size);
+	TEST_ASSERT_NOT_NULL(b, "Failed to create reorder buffer");
+
+	/* insert an out-of-order burst in one call */
+	for (i = 0; i < BULK_NUM_BUFS; i++) {
+		bufs[i] = rte_pktmbuf_alloc(p);
+		TEST_ASSERT_NOT_NULL(bufs[i], "Packet allocation failed\n");
+		*rte_reorder_seqn(bufs[i]) = seqns[i];
+	}
+
+	cnt = rte_reorder_insert_bulk(b, bufs, BULK_NUM_BUFS);
+	if (cnt != BULK_NUM_BUFS) {
+		printf("%s:%d: inserted %u bufs, expected %u\n",
+				__func__, __LINE__, cnt, BULK_NUM_BUFS);
+		ret = -1;
+		goto exit;
+	}
+
+	/* the burst must have been sorted in place by sequence number */
+	for (i = 0; i < BULK_NUM_BUFS; i++) {
+		if (*rte_reorder_seqn(bufs[i]) != i) {
+			printf("%s:%d: burst not sorted at %u\n",
+					__func__, __LINE__, i);
+			ret = -1;
+		}
+		/* all mbufs are owned by the reorder buffer now */
+		bufs[i] = NULL;
+	}
+	if (ret != 0)
+		goto exit;
+
+	/* everything is in sequence, so all of it must drain in order */
+	cnt = rte_reorder_drain(b, robufs, BULK_NUM_BUFS);
+	if (cnt != BULK_NUM_BUFS) {
+		printf("%s:%d: drained %u bufs, expected %u\n",
+				__func__, __LINE__, cnt, BULK_NUM_BUFS);
+		ret = -1;
+		goto exit;
+	}
+	for (i = 0; i < BULK_NUM_BUFS; i++) {
+		if (*rte_reorder_seqn(robufs[i]) != i) {
+			printf("%s:%d: drain out of order at %u\n",
+					__func__, __LINE__, i);
+			ret = -1;
+			goto exit;
+		}
+	}
+
+exit:
+	rte_reorder_free(b);
+	for (i = 0; i < BULK_NUM_BUFS; i++) {
+		rte_pktmbuf_free(bufs[i]);
+		rte_pktmbuf_free(robufs[i]);
+	}
+
+	return ret;
+}
+
 static int
 test_reorder_drain(void)
 {
@@ -538,6 +612,7 @@ static struct unit_test_suite reorder_test_suite  = {
 		TEST_CASE(test_reorder_find_existing),
 		TEST_CASE(test_reorder_free),
 		TEST_CASE(test_reorder_insert),
+		TEST_CASE(test_reorder_insert_bulk),
 		TEST_CASE(test_reorder_drain),
 		TEST_CASE(test_reorder_drain_up_to_seqn),
 		TEST_CASE(test_reorder_set_seqn),
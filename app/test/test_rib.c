@@ -20,6 +20,7 @@ static int32_t test_free_null(void);
 static int32_t test_insert_invalid(void);
 static int32_t test_get_fn(void);
 static int32_t test_basic(void);
+static int32_t test_lookup_bulk(void);
 static int32_t test_tree_traversal(void);
 
 #define MAX_DEPTH 32
@@ -290,6 +291,71 @@ test_basic(void)
 	return TEST_SUCCESS;
 }
 
+/*
+ * Check that rte_rib_lookup_bulk returns the same nodes as
+ * per address rte_rib_lookup for a mix of hits and misses
+ */
+int32_t
+test_lookup_bulk(void)
+{
+	struct rte_rib *rib = NULL;
+	struct rte_rib_node *nodes[32];
+	struct rte_rib_conf config;
+	uint32_t ips[32];
+	uint32_t i;
+	int ret;
+
+	config.max_nodes = MAX_RULES;
+	config.ext_sz = 0;
+
+	rib = rte_rib_create(__func__, SOCKET_ID_ANY, &config);
+	RTE_TEST_ASSERT(rib != NULL, "Failed to create RIB\n");
+
+	/* invalid args */
+	ret = rte_rib_lookup_bulk(NULL, ips, nodes, RTE_DIM(ips));
+	RTE_TEST_ASSERT(ret < 0,
+		"Call succeeded with invalid parameters\n");
+	ret = rte_rib_lookup_bulk(rib, NULL, nodes, RTE_DIM(ips));
+	RTE_TEST_ASSERT(ret < 0,
+		"Call succeeded with invalid parameters\n");
+
+	RTE_TEST_ASSERT(rte_rib_insert(rib, RTE_IPV4(10, 0, 0, 0), 8) != NULL,
+		"Failed to insert rule\n");
+	RTE_TEST_ASSERT(rte_rib_insert(rib, RTE_IPV4(10, 10, 0, 0), 16) != NULL,
+		"Failed to insert rule\n");
+	RTE_TEST_ASSERT(rte_rib_insert(rib, RTE_IPV4(192, 0, 2, 0), 24) != NULL,
+		"Failed to insert rule\n");
+
+	/* mix covered addresses with misses, more than one internal chunk */
+	for (i = 0; i < RTE_DIM(ips); i++) {
+		switch (i % 4) {
+		case 0:
+			ips[i] = RTE_IPV4(10, 10, 0, i);
+			break;
+		case 1:
+			ips[i] = RTE_IPV4(10, 0, i, 1);
+			break;
+		case 2:
+			ips[i] = RTE_IPV4(192, 0, 2, i);
+			break;
+		default:
+			ips[i] = RTE_IPV4(172, 16, 0, i);
+			break;
+		}
+	}
+
+	ret = rte_rib_lookup_bulk(rib, ips, nodes, RTE_DIM(ips));
+	RTE_TEST_ASSERT(ret == 0, "Failed to lookup\n");
+
+	for (i = 0; i < RTE_DIM(ips); i++)
+		RTE_TEST_ASSERT(nodes[i] == rte_rib_lookup(rib, ips[i]),
+			"Bulk lookup result differs from scalar lookup\n");
+
+	rte_rib_free(rib);
+
+	return TEST_SUCCESS;
+}
+
 int32_t
 test_tree_traversal(void)
 {
@@ -333,6 +399,7 @@ static struct unit_test_suite rib_tests = {
 		TEST_CASE(test_insert_invalid),
 		TEST_CASE(test_get_fn),
 		TEST_CASE(test_basic),
+		TEST_CASE(test_lookup_bulk),
 		TEST_CASE(test_tree_traversal),
 		TEST_CASES_END()
 	}
@@ -40,6 +40,9 @@ test_ring_stress(void)
 	n += test_ring_mpmc_stress.nb_case;
 	k += run_test(&test_ring_mpmc_stress);
 
+	n += test_ring_mpmc_stress_zc.nb_case;
+	k += run_test(&test_ring_mpmc_stress_zc);
+
 	n += test_ring_rts_stress.nb_case;
 	k += run_test(&test_ring_rts_stress);
 
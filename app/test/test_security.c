@@ -1528,6 +1528,60 @@ test_set_pkt_metadata_success(void)
 	return TEST_SUCCESS;
 }
 
+/**
+ * Test execution of rte_security_set_pkt_metadata_bulk in successful
+ * execution path
+ */
+static int
+test_set_pkt_metadata_bulk_success(void)
+{
+	struct security_unittest_params *ut_params = &unittest_params;
+	struct rte_mbuf m;
+	struct rte_mbuf *mb[3] = {&m, &m, &m};
+	int params;
+
+	mock_set_pkt_metadata_exp.device = NULL;
+	mock_set_pkt_metadata_exp.sess = ut_params->sess;
+	mock_set_pkt_metadata_exp.m = &m;
+	mock_set_pkt_metadata_exp.params = &params;
+	mock_set_pkt_metadata_exp.ret = 0;
+
+	uint16_t ret = rte_security_set_pkt_metadata_bulk(&ut_params->ctx,
+			ut_params->sess, mb, RTE_DIM(mb), &params);
+	TEST_ASSERT_MOCK_FUNCTION_CALL_RET(rte_security_set_pkt_metadata_bulk,
+			ret, (uint16_t)RTE_DIM(mb), "%u");
+	TEST_ASSERT_MOCK_CALLS(mock_set_pkt_metadata_exp, (int)RTE_DIM(mb));
+
+	return TEST_SUCCESS;
+}
+
+/**
+ * Test execution of rte_security_set_pkt_metadata_bulk when PMD function
+ * fails: no further packets are processed after the failure
+ */
+static int
+test_set_pkt_metadata_bulk_ops_failure(void)
+{
+	struct security_unittest_params *ut_params = &unittest_params;
+	struct rte_mbuf m;
+	struct rte_mbuf *mb[3] = {&m, &m, &m};
+	int params;
+
+	mock_set_pkt_metadata_exp.device = NULL;
+	mock_set_pkt_metadata_exp.sess = ut_params->sess;
+	mock_set_pkt_metadata_exp.m = &m;
+	mock_set_pkt_metadata_exp.params = &params;
+	mock_set_pkt_metadata_exp.ret = -1;
+
+	uint16_t ret = rte_security_set_pkt_metadata_bulk(&ut_params->ctx,
+			ut_params->sess, mb, RTE_DIM(mb), &params);
+	TEST_ASSERT_MOCK_FUNCTION_CALL_RET(rte_security_set_pkt_metadata_bulk,
+			ret, 0, "%u");
+	TEST_ASSERT_MOCK_CALLS(mock_set_pkt_metadata_exp, 1);
+
+	return TEST_SUCCESS;
+}
+
 /**
  * rte_security_capabilities_get tests
  */
@@ -2256,6 +2310,10 @@ static struct unit_test_suite security_testsuite  = {
 				test_set_pkt_metadata_ops_failure),
 		TEST_CASE_ST(ut_setup_with_session, ut_teardown,
 				test_set_pkt_metadata_success),
+		TEST_CASE_ST(ut_setup_with_session, ut_teardown,
+				test_set_pkt_metadata_bulk_success),
+		TEST_CASE_ST(ut_setup_with_session, ut_teardown,
+				test_set_pkt_metadata_bulk_ops_failure),
 
 		TEST_CASE_ST(ut_setup_with_session, ut_teardown,
 				test_capabilities_get_inv_context),
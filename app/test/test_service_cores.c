@@ -280,6 +280,39 @@ service_name(void)
 	return unregister_all();
 }
 
+/* verify service weight and lcore backoff get/set */
+static int
+service_weight_backoff(void)
+{
+	const uint32_t sid = 0;
+
+	TEST_ASSERT_EQUAL(1, rte_service_weight_get(sid),
+			"Default service weight not 1");
+	TEST_ASSERT_EQUAL(-EINVAL, rte_service_weight_set(sid, 0),
+			"Zero weight not rejected");
+	TEST_ASSERT_EQUAL(0, rte_service_weight_set(sid, 4),
+			"Failed to set service weight");
+	TEST_ASSERT_EQUAL(4, rte_service_weight_get(sid),
+			"Service weight not updated");
+	TEST_ASSERT_EQUAL(-EINVAL, rte_service_weight_get(1000),
+			"Invalid service id not rejected");
+
+	TEST_ASSERT_EQUAL(-EINVAL, rte_service_lcore_backoff_set(slcore_id, 8),
+			"Backoff set on non-service core not rejected");
+	TEST_ASSERT_EQUAL(0, rte_service_lcore_add(slcore_id),
+			"Failed to add service core");
+	TEST_ASSERT_EQUAL(0, rte_service_lcore_backoff_set(slcore_id, 8),
+			"Failed to set lcore backoff");
+	TEST_ASSERT_EQUAL(8, rte_service_lcore_backoff_get(slcore_id),
+			"Lcore backoff not updated");
+	TEST_ASSERT_EQUAL(0, rte_service_lcore_backoff_set(slcore_id, 0),
+			"Failed to disable lcore backoff");
+	TEST_ASSERT_EQUAL(0, rte_service_lcore_del(slcore_id),
+			"Failed to delete service core");
+
+	return unregister_all();
+}
+
 /* verify service attr get */
 static int
 service_attr_get(void)
@@ -1071,6 +1104,7 @@ static struct unit_test_suite service_tests  = {
 		TEST_CASE_ST(dummy_register, NULL, service_mt_safe_poll),
 		TEST_CASE_ST(dummy_register, NULL, service_may_be_active),
 		TEST_CASE_ST(dummy_register, NULL, service_active_two_cores),
+		TEST_CASE_ST(dummy_register, NULL, service_weight_backoff),
 		TEST_CASES_END() /**< NULL terminate unit test array */
 	}
 };
@@ -144,6 +144,39 @@ test_soring_get_memsize(void)
 
 }
 
+static int
+test_soring_create_lookup(void)
+{
+	struct rte_soring *sor, *f;
+	struct rte_soring_param prm;
+
+	memset(&prm, 0, sizeof(prm));
+
+	set_soring_init_param(&prm, "invalid_elems", sizeof(uintptr_t),
+			RTE_SORING_ELEM_MAX + 1, 1, 4, RTE_RING_SYNC_MT,
+			RTE_RING_SYNC_MT);
+	sor = rte_soring_create(&prm, SOCKET_ID_ANY);
+	RTE_TEST_ASSERT_NULL(sor, "created soring with invalid num elements");
+
+	set_soring_init_param(&prm, "create_lookup", sizeof(uintptr_t),
+			4, 1, 4, RTE_RING_SYNC_MT, RTE_RING_SYNC_MT);
+	sor = rte_soring_create(&prm, SOCKET_ID_ANY);
+	RTE_TEST_ASSERT_NOT_NULL(sor, "could not create soring");
+
+	f = rte_soring_lookup("create_lookup");
+	RTE_TEST_ASSERT_EQUAL(f, sor, "lookup did not return created soring");
+
+	f = rte_soring_lookup("no_such_soring");
+	RTE_TEST_ASSERT_NULL(f, "lookup found non-existent soring");
+
+	rte_soring_free(sor);
+
+	f = rte_soring_lookup("create_lookup");
+	RTE_TEST_ASSERT_NULL(f, "lookup found freed soring");
+
+	return 0;
+}
+
 static int
 test_soring_stages(void)
 {
@@ -420,6 +453,10 @@ test_soring(void)
 	if (test_soring_get_memsize() < 0)
 		goto test_fail;
 
+	/* Create/lookup/free */
+	if (test_soring_create_lookup() < 0)
+		goto test_fail;
+
 	/* Basic enqueue/dequeue operations */
 	if (test_soring_enqueue_dequeue() < 0)
 		goto test_fail;
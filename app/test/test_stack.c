@@ -379,5 +379,16 @@ test_lf_stack(void)
 #endif
 }
 
+static int
+test_lf_bucket_stack(void)
+{
+#if defined(RTE_STACK_LF_SUPPORTED)
+	return __test_stack(RTE_STACK_F_LF | RTE_STACK_F_LF_BUCKETS);
+#else
+	return TEST_SKIPPED;
+#endif
+}
+
 REGISTER_FAST_TEST(stack_autotest, false, true, test_stack);
 REGISTER_FAST_TEST(stack_lf_autotest, false, true, test_lf_stack);
+REGISTER_FAST_TEST(stack_lf_buckets_autotest, false, true, test_lf_bucket_stack);
@@ -5,6 +5,7 @@
 #include <rte_common.h>
 #include <rte_eal.h>
 #include <rte_ip.h>
+#include <rte_mbuf.h>
 #include <rte_random.h>
 #include <rte_malloc.h>
 #include <rte_byteorder.h>
@@ -336,6 +337,79 @@ test_toeplitz_hash_gfni_bulk(void)
 	return TEST_SUCCESS;
 }
 
+#define MBUF_BULK_TUPLE_OFS	14
+
+static int
+test_thash_mbuf_bulk(void)
+{
+	uint64_t rss_key_matrixes[RTE_DIM(default_rss_key)];
+	struct rte_mbuf *mbufs[RTE_DIM(v4_tbl)];
+	uint32_t hashes[RTE_DIM(v4_tbl)] = { 0 };
+	union rte_thash_tuple tuple;
+	struct rte_mempool *mp;
+	int ret = TEST_SUCCESS;
+	uint32_t i;
+
+	mp = rte_pktmbuf_pool_create("thash_mbuf_pool", 2 * RTE_DIM(v4_tbl),
+		0, 0, RTE_MBUF_DEFAULT_BUF_SIZE, SOCKET_ID_ANY);
+	if (mp == NULL)
+		return -TEST_FAILED;
+
+	if (rte_pktmbuf_alloc_bulk(mp, mbufs, RTE_DIM(v4_tbl)) != 0) {
+		rte_mempool_free(mp);
+		return -TEST_FAILED;
+	}
+
+	for (i = 0; i < RTE_DIM(v4_tbl); i++) {
+		tuple.v4.src_addr = rte_cpu_to_be_32(v4_tbl[i].src_ip);
+		tuple.v4.dst_addr = rte_cpu_to_be_32(v4_tbl[i].dst_ip);
+		tuple.v4.sport = rte_cpu_to_be_16(v4_tbl[i].dst_port);
+		tuple.v4.dport = rte_cpu_to_be_16(v4_tbl[i].src_port);
+		rte_pktmbuf_append(mbufs[i],
+			MBUF_BULK_TUPLE_OFS + RTE_THASH_V4_L4_LEN * 4);
+		rte_memcpy(rte_pktmbuf_mtod_offset(mbufs[i], uint8_t *,
+			MBUF_BULK_TUPLE_OFS), &tuple, RTE_THASH_V4_L4_LEN * 4);
+	}
+
+	/* invalid tuple length */
+	if (rte_thash_mbuf_bulk(NULL, default_rss_key, MBUF_BULK_TUPLE_OFS,
+			RTE_THASH_V4_L4_LEN * 4 - 1, mbufs, hashes,
+			RTE_DIM(v4_tbl)) != -EINVAL)
+		ret = -TEST_FAILED;
+
+	/* scalar fallback */
+	if (rte_thash_mbuf_bulk(NULL, default_rss_key, MBUF_BULK_TUPLE_OFS,
+			RTE_THASH_V4_L4_LEN * 4, mbufs, hashes,
+			RTE_DIM(v4_tbl)) != 0)
+		ret = -TEST_FAILED;
+
+	for (i = 0; i < RTE_DIM(v4_tbl); i++) {
+		if (hashes[i] != v4_tbl[i].hash_l3l4)
+			ret = -TEST_FAILED;
+	}
+
+	if (rte_thash_gfni_supported()) {
+		rte_thash_complete_matrix(rss_key_matrixes, default_rss_key,
+			RTE_DIM(default_rss_key));
+
+		memset(hashes, 0, sizeof(hashes));
+		if (rte_thash_mbuf_bulk(rss_key_matrixes, NULL,
+				MBUF_BULK_TUPLE_OFS, RTE_THASH_V4_L4_LEN * 4,
+				mbufs, hashes, RTE_DIM(v4_tbl)) != 0)
+			ret = -TEST_FAILED;
+
+		for (i = 0; i < RTE_DIM(v4_tbl); i++) {
+			if (hashes[i] != v4_tbl[i].hash_l3l4)
+				ret = -TEST_FAILED;
+		}
+	}
+
+	rte_pktmbuf_free_bulk(mbufs, RTE_DIM(v4_tbl));
+	rte_mempool_free(mp);
+
+	return ret;
+}
+
 static int
 test_big_tuple_gfni(void)
 {
@@ -1038,6 +1112,7 @@ static struct unit_test_suite thash_tests = {
 	TEST_CASE(test_toeplitz_hash_gfni),
 	TEST_CASE(test_toeplitz_hash_rand_data),
 	TEST_CASE(test_toeplitz_hash_gfni_bulk),
+	TEST_CASE(test_thash_mbuf_bulk),
 	TEST_CASE(test_big_tuple_gfni),
 	TEST_CASE(test_create_invalid),
 	TEST_CASE(test_multiple_create),
@@ -497,6 +497,153 @@ timer_basic_main_loop(__rte_unused void *arg)
 	return 0;
 }
 
+/* counters for the timing wheel test */
+static unsigned int wheel_oneshot_fired;
+static unsigned int wheel_periodic_fired;
+static unsigned int wheel_stopped_fired;
+static unsigned int wheel_max_batch;
+
+static void
+timer_wheel_bulk_cb(struct rte_timer **tims, unsigned int nb_timers,
+		    void *arg)
+{
+	struct mytimerinfo *timinfo;
+	unsigned int i;
+
+	if (arg != &mytiminfo[0])
+		test_failed = 1;
+	if (nb_timers > wheel_max_batch)
+		wheel_max_batch = nb_timers;
+
+	for (i = 0; i < nb_timers; i++) {
+		timinfo = (struct mytimerinfo *)tims[i];
+		switch (timinfo->id) {
+		case 0:
+			wheel_oneshot_fired++;
+			break;
+		case 1:
+			wheel_periodic_fired++;
+			break;
+		default:
+			wheel_stopped_fired++;
+			break;
+		}
+	}
+}
+
+/* functional check of the timing wheel backend on the local lcore */
+static int
+timer_wheel_test(void)
+{
+	uint64_t hz = rte_get_timer_hz();
+	uint64_t cur_time, test_end;
+	unsigned int lcore_id = rte_lcore_id();
+	uint32_t timer_data_id;
+	unsigned int i;
+	int ret;
+
+	printf("\nStart timing wheel tests\n");
+
+	ret = rte_timer_data_alloc(&timer_data_id);
+	if (ret < 0) {
+		printf("Failed to allocate timer data instance\n");
+		return -1;
+	}
+
+	/* invalid parameters */
+	if (rte_timer_data_wheel_enable(timer_data_id, 0) != -EINVAL ||
+	    rte_timer_data_wheel_enable(0, hz / 10000) != -EINVAL) {
+		printf("Wheel enable accepted invalid parameters\n");
+		return -1;
+	}
+	if (rte_timer_alt_manage_bulk(timer_data_id, NULL, 0,
+			timer_wheel_bulk_cb, &mytiminfo[0]) != -ENOTSUP) {
+		printf("Bulk manage accepted a skiplist instance\n");
+		return -1;
+	}
+
+	/* resolution of ~100us */
+	ret = rte_timer_data_wheel_enable(timer_data_id, hz / 10000);
+	if (ret < 0) {
+		printf("Failed to enable the wheel backend: %d\n", ret);
+		return -1;
+	}
+	if (rte_timer_data_wheel_enable(timer_data_id, hz / 10000) !=
+			-EALREADY) {
+		printf("Wheel enable succeeded twice\n");
+		return -1;
+	}
+	if (rte_timer_alt_manage(timer_data_id, NULL, 0, NULL) != -ENOTSUP) {
+		printf("Non-bulk manage accepted a wheel instance\n");
+		return -1;
+	}
+
+	for (i = 0; i < NB_TIMER; i++) {
+		memset(&mytiminfo[i], 0, sizeof(struct mytimerinfo));
+		mytiminfo[i].id = i;
+		rte_timer_init(&mytiminfo[i].tim);
+	}
+
+	/* a one-shot timer, a periodic timer, and a timer stopped again
+	 * before it can fire
+	 */
+	ret = rte_timer_alt_reset(timer_data_id, &mytiminfo[0].tim, hz / 100,
+			SINGLE, lcore_id, NULL, NULL);
+	ret |= rte_timer_alt_reset(timer_data_id, &mytiminfo[1].tim, hz / 100,
+			PERIODICAL, lcore_id, NULL, NULL);
+	ret |= rte_timer_alt_reset(timer_data_id, &mytiminfo[2].tim, hz / 100,
+			SINGLE, lcore_id, NULL, NULL);
+	if (ret != 0) {
+		printf("Failed to arm timers on the wheel instance\n");
+		return -1;
+	}
+	if (rte_timer_alt_stop(timer_data_id, &mytiminfo[2].tim) != 0) {
+		printf("Failed to stop a pending wheel timer\n");
+		return -1;
+	}
+
+	cur_time = rte_get_timer_cycles();
+	test_end = cur_time + hz / 10;
+	while (rte_get_timer_cycles() < test_end) {
+		ret = rte_timer_alt_manage_bulk(timer_data_id, NULL, 0,
+				timer_wheel_bulk_cb, &mytiminfo[0]);
+		if (ret != 0) {
+			printf("Bulk manage failed: %d\n", ret);
+			return -1;
+		}
+		rte_delay_us(3);
+	}
+
+	/* ~100ms at a 10ms period: the one-shot timer fires exactly once,
+	 * the periodic timer keeps firing, the stopped timer never does
+	 */
+	if (wheel_oneshot_fired != 1 || wheel_periodic_fired < 5 ||
+	    wheel_stopped_fired != 0 || test_failed) {
+		printf("Wrong wheel callback counts: %u, %u, %u\n",
+				wheel_oneshot_fired, wheel_periodic_fired,
+				wheel_stopped_fired);
+		return -1;
+	}
+	printf("Wheel fired %u periodic callbacks, max batch %u\n",
+			wheel_periodic_fired, wheel_max_batch);
+
+	unsigned int walk_lcores[] = {lcore_id};
+
+	if (rte_timer_stop_all(timer_data_id, walk_lcores, 1, NULL,
+			NULL) != 0) {
+		printf("Failed to stop all wheel timers\n");
+		return -1;
+	}
+	for (i = 0; i < NB_TIMER; i++) {
+		if (rte_timer_pending(&mytiminfo[i].tim)) {
+			printf("Timer %u still pending after stop_all\n", i);
+			return -1;
+		}
+	}
+
+	return rte_timer_data_dealloc(timer_data_id);
+}
+
 static int
 timer_sanity_check(void)
 {
@@ -552,6 +699,12 @@ test_timer(void)
 		return TEST_FAILED;
 	}
 
+	/* functional check of the timing wheel backend */
+	if (timer_wheel_test() < 0) {
+		printf("Timing wheel tests failed\n");
+		return TEST_FAILED;
+	}
+
 	/* init timer */
 	for (i=0; i<NB_TIMER; i++) {
 		memset(&mytiminfo[i], 0, sizeof(struct mytimerinfo));
@@ -2,6 +2,8 @@
  * Copyright(C) 2020 Marvell International Ltd.
  */
 
+#include <errno.h>
+
 #include <rte_eal_trace.h>
 #include <rte_lcore.h>
 #include <rte_random.h>
@@ -126,6 +128,35 @@ failed:
 	return TEST_FAILED;
 }
 
+static int
+test_trace_stream(void)
+{
+	int rc;
+
+	rc = rte_trace_stream_enable();
+	if (rc == -EBUSY) {
+		/* Trace buffers have already been allocated, e.g., --trace */
+		printf("trace buffers already allocated, skipping stream test\n");
+		return TEST_SKIPPED;
+	}
+	if (rc != 0)
+		goto failed;
+
+	/* Emission goes to the ring-structured buffers from now on */
+	rte_eal_trace_generic_void();
+	rte_eal_trace_generic_u64(0x10000000000000);
+	rte_trace_stream_flush();
+
+	/* Nothing can have been dropped with empty rings */
+	if (rte_trace_stream_drops_get() != 0)
+		goto failed;
+
+	return TEST_SUCCESS;
+
+failed:
+	return TEST_FAILED;
+}
+
 static int
 test_trace_mode(void)
 {
@@ -229,6 +260,7 @@ static struct unit_test_suite trace_tests = {
 	.setup = NULL,
 	.teardown = NULL,
 	.unit_test_cases = {
+		TEST_CASE(test_trace_stream),
 		TEST_CASE(test_trace_mode),
 		TEST_CASE(test_generic_trace_points),
 		TEST_CASE(test_fp_trace_points),
@@ -750,6 +750,8 @@ pci_vfio_map_resource_primary(struct rte_pci_device *dev)
 	struct mapped_pci_resource *vfio_res = NULL;
 	struct mapped_pci_res_list *vfio_res_list =
 		RTE_TAILQ_CAST(rte_vfio_tailq.head, mapped_pci_res_list);
+	void *bar_resv = NULL;
+	size_t bar_resv_sz = 0;
 
 	struct pci_map *maps;
 
@@ -823,7 +825,6 @@ pci_vfio_map_resource_primary(struct rte_pci_device *dev)
 	}
 
 	for (i = 0; i < vfio_res->nb_maps; i++) {
-		void *bar_addr;
 		struct vfio_info_cap_header *hdr;
 		struct vfio_region_info_cap_sparse_mmap *sparse;
 
@@ -854,21 +855,13 @@ pci_vfio_map_resource_primary(struct rte_pci_device *dev)
 			continue;
 		}
 
-		/* try mapping somewhere close to the end of hugepages */
-		if (pci_map_addr == NULL)
-			pci_map_addr = pci_find_max_end_va();
-
-		bar_addr = pci_map_addr;
-		pci_map_addr = RTE_PTR_ADD(bar_addr, (size_t) reg->size);
-
-		pci_map_addr = RTE_PTR_ALIGN(pci_map_addr,
-					sysconf(_SC_PAGE_SIZE));
-
-		maps[i].addr = bar_addr;
 		maps[i].offset = reg->offset;
 		maps[i].size = reg->size;
 		maps[i].path = NULL; /* vfio doesn't have per-resource paths */
 
+		bar_resv_sz += RTE_ALIGN((size_t)reg->size,
+				rte_mem_page_size());
+
 		hdr = pci_vfio_info_cap(reg, VFIO_REGION_INFO_CAP_SPARSE_MMAP);
 
 		if (hdr != NULL) {
@@ -880,6 +873,7 @@ pci_vfio_map_resource_primary(struct rte_pci_device *dev)
 					sizeof(*maps[i].areas) * maps[i].nr_areas, 0);
 				if (maps[i].areas == NULL) {
 					PCI_LOG(ERR, "Cannot alloc memory for sparse map areas");
+					free(reg);
 					goto err_map;
 				}
 				memcpy(maps[i].areas, sparse->areas,
@@ -887,27 +881,65 @@ pci_vfio_map_resource_primary(struct rte_pci_device *dev)
 			}
 		}
 
+		free(reg);
+	}
+
+	/*
+	 * Reserve address space for all BARs of the device with a single
+	 * anonymous mapping close to the end of hugepages, and carve the
+	 * individual BARs out of it. This keeps the device mappings compact
+	 * and issues one address space search per device instead of one per
+	 * BAR.
+	 */
+	if (bar_resv_sz > 0) {
+		size_t resv_off = 0;
+
+		if (pci_map_addr == NULL)
+			pci_map_addr = pci_find_max_end_va();
+
+		bar_resv = mmap(pci_map_addr, bar_resv_sz, 0,
+				MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (bar_resv == MAP_FAILED) {
+			PCI_LOG(ERR, "%s cannot reserve %zu bytes for BARs: %s",
+				pci_addr, bar_resv_sz, strerror(errno));
+			bar_resv = NULL;
+			goto err_map;
+		}
+		pci_map_addr = RTE_PTR_ADD(bar_resv, bar_resv_sz);
+
+		for (i = 0; i < vfio_res->nb_maps; i++) {
+			if (maps[i].size == 0)
+				continue;
+			maps[i].addr = RTE_PTR_ADD(bar_resv, resv_off);
+			resv_off += RTE_ALIGN(maps[i].size,
+					rte_mem_page_size());
+		}
+	}
+
+	/* the BAR addresses are already reserved, so map with MAP_FIXED */
+	for (i = 0; i < vfio_res->nb_maps; i++) {
+		if (maps[i].size == 0)
+			continue;
+
 		if (maps[i].nr_areas > 0) {
-			ret = pci_vfio_sparse_mmap_bar(vfio_dev_fd, vfio_res, i, 0);
+			ret = pci_vfio_sparse_mmap_bar(vfio_dev_fd, vfio_res,
+					i, MAP_FIXED);
 			if (ret < 0) {
 				PCI_LOG(ERR, "%s sparse mapping BAR%i failed: %s",
 					pci_addr, i, strerror(errno));
-				free(reg);
 				goto err_map;
 			}
 		} else {
-			ret = pci_vfio_mmap_bar(vfio_dev_fd, vfio_res, i, 0);
+			ret = pci_vfio_mmap_bar(vfio_dev_fd, vfio_res, i,
+					MAP_FIXED);
 			if (ret < 0) {
 				PCI_LOG(ERR, "%s mapping BAR%i failed: %s",
 					pci_addr, i, strerror(errno));
-				free(reg);
 				goto err_map;
 			}
 		}
 
 		dev->mem_resource[i].addr = maps[i].addr;
-
-		free(reg);
 	}
 
 	if (pci_rte_vfio_setup_device(dev, vfio_dev_fd) < 0) {
@@ -926,9 +958,10 @@ pci_vfio_map_resource_primary(struct rte_pci_device *dev)
 
 	return 0;
 err_map:
-	for (j = 0; j < i; j++) {
-		if (maps[j].addr)
-			pci_unmap_resource(maps[j].addr, maps[j].size);
+	/* the reservation covers every BAR carved out of it */
+	if (bar_resv != NULL)
+		munmap(bar_resv, bar_resv_sz);
+	for (j = 0; j < vfio_res->nb_maps; j++) {
 		if (maps[j].nr_areas > 0)
 			rte_free(maps[j].areas);
 	}
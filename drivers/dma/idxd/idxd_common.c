@@ -2,6 +2,7 @@
  * Copyright 2021 Intel Corporation
  */
 
+#include <inttypes.h>
 #include <x86intrin.h>
 
 #include <rte_malloc.h>
@@ -78,6 +79,7 @@ __submit(struct idxd_dmadev *idxd)
 		idxd->batch_idx_write = 0;
 
 	idxd->stats.submitted += idxd->batch_size;
+	idxd->batches_submitted++;
 
 	idxd->batch_start += idxd->batch_size;
 	idxd->batch_size = 0;
@@ -100,12 +102,16 @@ __idxd_write_desc(struct idxd_dmadev *idxd,
 	/* we never wrap batches, so we only mask the start and allow start+size to overflow */
 	uint16_t write_idx = (idxd->batch_start & mask) + idxd->batch_size;
 
-	/* first check batch ring space then desc ring space */
+	/* check for batch ring space, then descriptor ring space, then that
+	 * the open batch does not exceed the device max batch size
+	 */
 	if ((idxd->batch_idx_read == 0 && idxd->batch_idx_write == idxd->max_batches) ||
 			idxd->batch_idx_write + 1 == idxd->batch_idx_read)
 		return -ENOSPC;
 	if (((write_idx + 1) & mask) == (idxd->ids_returned & mask))
 		return -ENOSPC;
+	if (idxd->batch_size >= idxd->max_batch_size)
+		return -ENOSPC;
 
 	/* write desc. Note: descriptors don't wrap, but the completion address does */
 	const uint64_t op_flags64 = (uint64_t)(op_flags | IDXD_FLAG_COMPLETION_ADDR_VALID) << 32;
@@ -451,6 +457,11 @@ idxd_dump(const struct rte_dma_dev *dev, FILE *f)
 
 	fprintf(f, "  Curr batch: start = %u, size = %u\n", idxd->batch_start, idxd->batch_size);
 	fprintf(f, "  IDS: avail = %u, returned: %u\n", idxd->ids_avail, idxd->ids_returned);
+	fprintf(f, "  Batches submitted: %"PRIu64", avg batch size: %.1f (max %u)\n",
+			idxd->batches_submitted,
+			idxd->batches_submitted == 0 ? 0.0 :
+				(double)idxd->stats.submitted / idxd->batches_submitted,
+			idxd->max_batch_size);
 	return 0;
 }
 
@@ -470,6 +481,7 @@ idxd_stats_reset(struct rte_dma_dev *dev, uint16_t vchan __rte_unused)
 {
 	struct idxd_dmadev *idxd = dev->fp_obj->dev_private;
 	idxd->stats = (struct rte_dma_stats){0};
+	idxd->batches_submitted = 0;
 	return 0;
 }
 
@@ -62,6 +62,7 @@ struct idxd_dmadev {
 	unsigned short *batch_idx_ring; /* store where each batch ends */
 
 	struct rte_dma_stats stats;
+	uint64_t batches_submitted; /* portal doorbells, for achieved batch size */
 
 	rte_iova_t batch_iova; /* base address of the batch comp ring */
 	rte_iova_t desc_iova; /* base address of desc ring, needed for completions */
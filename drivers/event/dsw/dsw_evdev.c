@@ -7,6 +7,7 @@
 #include <rte_cycles.h>
 #include <eventdev_pmd.h>
 #include <eventdev_pmd_vdev.h>
+#include <rte_kvargs.h>
 #include <rte_random.h>
 #include <rte_ring_elem.h>
 
@@ -14,6 +15,19 @@
 
 #define EVENTDEV_NAME_DSW_PMD event_dsw
 
+#define DSW_MIGRATION_INTERVAL_ARG "migration_interval"
+#define DSW_MIN_SOURCE_LOAD_ARG "min_source_load"
+#define DSW_MAX_TARGET_LOAD_ARG "max_target_load"
+#define DSW_FLOWS_PER_MIGRATION_ARG "flows_per_migration"
+
+static const char * const dsw_valid_args[] = {
+	DSW_MIGRATION_INTERVAL_ARG,
+	DSW_MIN_SOURCE_LOAD_ARG,
+	DSW_MAX_TARGET_LOAD_ARG,
+	DSW_FLOWS_PER_MIGRATION_ARG,
+	NULL
+};
+
 static int
 dsw_port_setup(struct rte_eventdev *dev, uint8_t port_id,
 	       const struct rte_event_port_conf *conf)
@@ -67,10 +81,11 @@ dsw_port_setup(struct rte_eventdev *dev, uint8_t port_id,
 	port->ctl_in_ring = ctl_in_ring;
 
 	port->load_update_interval =
-		(DSW_LOAD_UPDATE_INTERVAL * rte_get_timer_hz()) / US_PER_S;
+		((dsw->migration_interval / 4) * rte_get_timer_hz()) /
+		US_PER_S;
 
 	port->migration_interval =
-		(DSW_MIGRATION_INTERVAL * rte_get_timer_hz()) / US_PER_S;
+		(dsw->migration_interval * rte_get_timer_hz()) / US_PER_S;
 
 	dev->data->ports[port_id] = port;
 
@@ -438,6 +453,90 @@ static struct eventdev_ops dsw_evdev_ops = {
 	.xstats_get_by_name = dsw_xstats_get_by_name
 };
 
+static int
+dsw_set_interval(const char *key __rte_unused, const char *value, void *opaque)
+{
+	uint32_t *interval = opaque;
+	int i = atoi(value);
+
+	if (i <= 0)
+		return -1;
+	*interval = i;
+	return 0;
+}
+
+static int
+dsw_set_load_percent(const char *key __rte_unused, const char *value,
+		     void *opaque)
+{
+	int16_t *load = opaque;
+	int percent = atoi(value);
+
+	if (percent < 0 || percent > 100)
+		return -1;
+	*load = DSW_LOAD_FROM_PERCENT(percent);
+	return 0;
+}
+
+static int
+dsw_set_flows_per_migration(const char *key __rte_unused, const char *value,
+			    void *opaque)
+{
+	uint8_t *flows = opaque;
+	int i = atoi(value);
+
+	if (i <= 0 || i > DSW_MAX_FLOWS_PER_MIGRATION)
+		return -1;
+	*flows = i;
+	return 0;
+}
+
+static int
+dsw_parse_devargs(struct rte_vdev_device *vdev, struct dsw_evdev *dsw)
+{
+	const char *params = rte_vdev_device_args(vdev);
+	struct rte_kvargs *kvlist;
+	int ret;
+
+	dsw->migration_interval = DSW_MIGRATION_INTERVAL;
+	dsw->min_source_load =
+		DSW_LOAD_FROM_PERCENT(DSW_MIN_SOURCE_LOAD_FOR_MIGRATION_PERCENT);
+	dsw->max_target_load =
+		DSW_LOAD_FROM_PERCENT(DSW_MAX_TARGET_LOAD_FOR_MIGRATION_PERCENT);
+	dsw->flows_per_migration = DSW_DEFAULT_FLOWS_PER_MIGRATION;
+
+	if (params == NULL || params[0] == '\0')
+		return 0;
+
+	kvlist = rte_kvargs_parse(params, dsw_valid_args);
+	if (kvlist == NULL) {
+		RTE_LOG_LINE(ERR, EVENT_DSW, "Invalid device parameters");
+		return -EINVAL;
+	}
+
+	ret = rte_kvargs_process(kvlist, DSW_MIGRATION_INTERVAL_ARG,
+				 dsw_set_interval, &dsw->migration_interval);
+	if (ret == 0)
+		ret = rte_kvargs_process(kvlist, DSW_MIN_SOURCE_LOAD_ARG,
+					 dsw_set_load_percent,
+					 &dsw->min_source_load);
+	if (ret == 0)
+		ret = rte_kvargs_process(kvlist, DSW_MAX_TARGET_LOAD_ARG,
+					 dsw_set_load_percent,
+					 &dsw->max_target_load);
+	if (ret == 0)
+		ret = rte_kvargs_process(kvlist, DSW_FLOWS_PER_MIGRATION_ARG,
+					 dsw_set_flows_per_migration,
+					 &dsw->flows_per_migration);
+
+	rte_kvargs_free(kvlist);
+
+	if (ret != 0)
+		RTE_LOG_LINE(ERR, EVENT_DSW, "Error parsing device parameters");
+
+	return ret;
+}
+
 static int
 dsw_probe(struct rte_vdev_device *vdev)
 {
@@ -465,6 +564,9 @@ dsw_probe(struct rte_vdev_device *vdev)
 	dsw = dev->data->dev_private;
 	dsw->data = dev->data;
 
+	if (dsw_parse_devargs(vdev, dsw) != 0)
+		return -EINVAL;
+
 	event_dev_probing_finish(dev);
 	return 0;
 }
@@ -487,4 +589,9 @@ static struct rte_vdev_driver evdev_dsw_pmd_drv = {
 };
 
 RTE_PMD_REGISTER_VDEV(EVENTDEV_NAME_DSW_PMD, evdev_dsw_pmd_drv);
+RTE_PMD_REGISTER_PARAM_STRING(event_dsw,
+	DSW_MIGRATION_INTERVAL_ARG "=<int> "
+	DSW_MIN_SOURCE_LOAD_ARG "=<percent> "
+	DSW_MAX_TARGET_LOAD_ARG "=<percent> "
+	DSW_FLOWS_PER_MIGRATION_ARG "=<int>");
 RTE_LOG_REGISTER_DEFAULT(event_dsw_logtype, NOTICE);
@@ -94,13 +94,18 @@
  * an event burst.
  */
 #define DSW_MIGRATION_INTERVAL (1000)
-#define DSW_MIN_SOURCE_LOAD_FOR_MIGRATION (DSW_LOAD_FROM_PERCENT(70))
-#define DSW_MAX_TARGET_LOAD_FOR_MIGRATION (DSW_LOAD_FROM_PERCENT(95))
+#define DSW_MIN_SOURCE_LOAD_FOR_MIGRATION_PERCENT (70)
+#define DSW_MAX_TARGET_LOAD_FOR_MIGRATION_PERCENT (95)
 #define DSW_REBALANCE_THRESHOLD (DSW_LOAD_FROM_PERCENT(3))
 
 #define DSW_MAX_EVENTS_RECORDED (128)
 
-#define DSW_MAX_FLOWS_PER_MIGRATION (8)
+/* The maximum number of flows that may be moved in a single pause
+ * window. How many are actually moved is set by the
+ * "flows_per_migration" devarg.
+ */
+#define DSW_MAX_FLOWS_PER_MIGRATION (32)
+#define DSW_DEFAULT_FLOWS_PER_MIGRATION (8)
 
 /* Only one outstanding migration per port is allowed */
 #define DSW_MAX_PAUSED_FLOWS (DSW_MAX_PORTS*DSW_MAX_FLOWS_PER_MIGRATION)
@@ -256,6 +261,12 @@ struct dsw_evdev {
 	uint8_t num_queues;
 	int32_t max_inflight;
 
+	/* Migration tuning, set from devargs at probe time. */
+	uint32_t migration_interval;
+	int16_t min_source_load;
+	int16_t max_target_load;
+	uint8_t flows_per_migration;
+
 	alignas(RTE_CACHE_LINE_SIZE) RTE_ATOMIC(int32_t) credits_on_loan;
 };
 
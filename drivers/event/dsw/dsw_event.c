@@ -424,12 +424,12 @@ dsw_flow_load(uint16_t num_events, int16_t port_load)
 
 static int16_t
 dsw_evaluate_migration(int16_t source_load, int16_t target_load,
-		       int16_t flow_load)
+		       int16_t flow_load, int16_t max_target_load)
 {
 	int32_t res_target_load;
 	int32_t imbalance;
 
-	if (target_load > DSW_MAX_TARGET_LOAD_FOR_MIGRATION)
+	if (target_load > max_target_load)
 		return -1;
 
 	imbalance = source_load - target_load;
@@ -478,7 +478,7 @@ dsw_select_emigration_target(struct dsw_evdev *dsw,
 	int16_t candidate_flow_load = -1;
 	uint16_t i;
 
-	if (source_port_load < DSW_MIN_SOURCE_LOAD_FOR_MIGRATION)
+	if (source_port_load < dsw->min_source_load)
 		return false;
 
 	for (i = 0; i < num_bursts; i++) {
@@ -504,7 +504,8 @@ dsw_select_emigration_target(struct dsw_evdev *dsw,
 
 			weight = dsw_evaluate_migration(source_port_load,
 							port_loads[port_id],
-							flow_load);
+							flow_load,
+							dsw->max_target_load);
 
 			if (weight > candidate_weight) {
 				candidate_qf = qf;
@@ -551,7 +552,7 @@ dsw_select_emigration_targets(struct dsw_evdev *dsw,
 	uint8_t *targets_len = &source_port->emigration_targets_len;
 	uint16_t i;
 
-	for (i = 0; i < DSW_MAX_FLOWS_PER_MIGRATION; i++) {
+	for (i = 0; i < dsw->flows_per_migration; i++) {
 		bool found;
 
 		found = dsw_select_emigration_target(dsw, source_port,
@@ -890,11 +891,11 @@ dsw_port_consider_emigration(struct dsw_evdev *dsw,
 	source_port_load =
 		rte_atomic_load_explicit(&source_port->load,
 					 rte_memory_order_relaxed);
-	if (source_port_load < DSW_MIN_SOURCE_LOAD_FOR_MIGRATION) {
+	if (source_port_load < dsw->min_source_load) {
 		DSW_LOG_DP_PORT_LINE(DEBUG, source_port->id,
 		      "Load %d is below threshold level %d.",
 		      DSW_LOAD_TO_PERCENT(source_port_load),
-		      DSW_LOAD_TO_PERCENT(DSW_MIN_SOURCE_LOAD_FOR_MIGRATION));
+		      DSW_LOAD_TO_PERCENT(dsw->min_source_load));
 		return;
 	}
 
@@ -903,7 +904,7 @@ dsw_port_consider_emigration(struct dsw_evdev *dsw,
 	 */
 	any_port_below_limit =
 		dsw_retrieve_port_loads(dsw, port_loads,
-					DSW_MAX_TARGET_LOAD_FOR_MIGRATION);
+					dsw->max_target_load);
 	if (!any_port_below_limit) {
 		DSW_LOG_DP_PORT_LINE(DEBUG, source_port->id,
 				"Candidate target ports are all too highly "
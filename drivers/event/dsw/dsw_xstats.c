@@ -87,6 +87,14 @@ dsw_xstats_port_get_queue_dequeued(struct dsw_evdev *dsw, uint8_t port_id,
 DSW_GEN_PORT_ACCESS_FN(emigrations)
 DSW_GEN_PORT_ACCESS_FN(immigrations)
 
+static uint64_t
+dsw_xstats_port_get_migration_paused_cycles(struct dsw_evdev *dsw,
+					    uint8_t port_id,
+					    uint8_t queue_id __rte_unused)
+{
+	return dsw->ports[port_id].emigration_latency;
+}
+
 static uint64_t
 dsw_xstats_port_get_migration_latency(struct dsw_evdev *dsw, uint8_t port_id,
 				      uint8_t queue_id __rte_unused)
@@ -150,6 +158,8 @@ static struct dsw_xstats_port dsw_port_xstats[] = {
 	  false },
 	{ "port_%u_migration_latency", dsw_xstats_port_get_migration_latency,
 	  false },
+	{ "port_%u_migration_paused_cycles",
+	  dsw_xstats_port_get_migration_paused_cycles, false },
 	{ "port_%u_immigrations", dsw_xstats_port_get_immigrations,
 	  false },
 	{ "port_%u_event_proc_latency", dsw_xstats_port_get_event_proc_latency,
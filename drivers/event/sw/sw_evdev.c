@@ -24,6 +24,7 @@
 #define MIN_BURST_SIZE_ARG "min_burst"
 #define DEQ_BURST_SIZE_ARG "deq_burst"
 #define REFIL_ONCE_ARG "refill_once"
+#define SINGLE_LINK_BYPASS_ARG "single_link_bypass"
 
 static void
 sw_info_get(struct rte_eventdev *dev, struct rte_event_dev_info *info);
@@ -75,6 +76,9 @@ sw_port_link(struct rte_eventdev *dev, void *port, const uint8_t queues[],
 
 			p->is_directed = 1;
 			p->num_qids_mapped = 1;
+			/* NULL unless created by single_link_bypass */
+			p->bypass_ring = q->bypass_ring;
+			p->bypass_qid = q;
 		} else if (q->type == RTE_SCHED_TYPE_ORDERED) {
 			p->num_ordered_qids++;
 			p->num_qids_mapped++;
@@ -113,6 +117,10 @@ sw_port_unlink(struct rte_eventdev *dev, void *port, uint8_t queues[],
 
 				if (q->type == RTE_SCHED_TYPE_ORDERED)
 					p->num_ordered_qids--;
+				else if (q->type == SW_SCHED_TYPE_DIRECT) {
+					p->bypass_ring = NULL;
+					p->bypass_qid = NULL;
+				}
 
 				continue;
 			}
@@ -133,6 +141,55 @@ sw_port_unlinks_in_progress(struct rte_eventdev *dev, void *port)
 	return p->unlinks_in_progress;
 }
 
+static uint16_t
+sw_port_credits_reserve(struct rte_eventdev *dev, void *port, uint16_t nb_credits)
+{
+	struct sw_evdev *sw = sw_pmd_priv(dev);
+	uint32_t sw_inflights = rte_atomic32_read(&sw->inflights);
+	struct sw_port *p = port;
+	uint32_t headroom;
+	uint32_t nb;
+
+	/* reserved credits count as inflights, so cap the reservation at both
+	 * the instance new event limit and this port's new event threshold to
+	 * avoid the reservation blocking the port's own enqueues
+	 */
+	headroom = RTE_MIN((uint32_t)sw->nb_events_limit, (uint32_t)p->inflight_max);
+	if (sw_inflights >= headroom)
+		return 0;
+
+	nb = RTE_MIN((uint32_t)nb_credits, headroom - sw_inflights);
+	nb = RTE_MIN(nb, (uint32_t)UINT16_MAX - p->inflight_credits);
+	if (nb == 0)
+		return 0;
+
+	rte_atomic32_add(&sw->inflights, nb);
+	p->inflight_credits += nb;
+	p->reserved_credits += nb;
+
+	return nb;
+}
+
+static uint16_t
+sw_port_credits_release(struct rte_eventdev *dev, void *port, uint16_t nb_credits)
+{
+	struct sw_evdev *sw = sw_pmd_priv(dev);
+	struct sw_port *p = port;
+	uint16_t nb;
+
+	/* part of the reservation may have been spent on new events */
+	p->reserved_credits = RTE_MIN(p->reserved_credits, p->inflight_credits);
+	nb = RTE_MIN(nb_credits, p->reserved_credits);
+	if (nb == 0)
+		return 0;
+
+	rte_atomic32_sub(&sw->inflights, nb);
+	p->inflight_credits -= nb;
+	p->reserved_credits -= nb;
+
+	return nb;
+}
+
 static int
 sw_port_setup(struct rte_eventdev *dev, uint8_t port_id,
 		const struct rte_event_port_conf *conf)
@@ -291,6 +348,26 @@ qid_init(struct sw_evdev *sw, unsigned int idx, int type,
 		qid->cq_next_tx = 0;
 	}
 
+	if (qid->type == SW_SCHED_TYPE_DIRECT && sw->single_link_bypass) {
+		char buf[RTE_RING_NAMESIZE];
+
+		/* ring may exist from a previous configuration - free it so
+		 * it gets re-created, same as the port rings in port_setup()
+		 */
+		snprintf(buf, sizeof(buf), "sw%d_q%u_%s", sw->data->dev_id,
+				idx, "bypass_ring");
+		rte_event_ring_free(rte_event_ring_lookup(buf));
+
+		/* multi-producer: any port may enqueue to this queue */
+		qid->bypass_ring = rte_event_ring_create(buf,
+				MAX_SW_PROD_Q_DEPTH, socket_id,
+				RING_F_SC_DEQ | RING_F_EXACT_SZ);
+		if (qid->bypass_ring == NULL) {
+			SW_LOG_DBG("bypass ring create failed");
+			goto cleanup;
+		}
+	}
+
 	qid->initialized = 1;
 
 	return 0;
@@ -319,6 +396,7 @@ sw_queue_release(struct rte_eventdev *dev, uint8_t id)
 		rte_free(qid->reorder_buffer);
 		rob_ring_free(qid->reorder_buffer_freelist);
 	}
+	rte_event_ring_free(qid->bypass_ring);
 	memset(qid, 0, sizeof(*qid));
 }
 
@@ -387,6 +465,9 @@ sw_ports_empty(struct sw_evdev *sw)
 		if ((rte_event_ring_count(sw->ports[i].rx_worker_ring)) ||
 		     rte_event_ring_count(sw->ports[i].cq_worker_ring))
 			return 0;
+		if (sw->ports[i].bypass_ring &&
+		    rte_event_ring_count(sw->ports[i].bypass_ring))
+			return 0;
 	}
 
 	return 1;
@@ -701,6 +782,15 @@ sw_dump(struct rte_eventdev *dev, FILE *f)
 					PRIu64 COL_RESET"\n", col, used, space);
 		} else
 			fprintf(f, "\tcq ring not initialized.\n");
+
+		if (p->bypass_ring) {
+			uint64_t used = rte_event_ring_count(p->bypass_ring);
+			uint64_t space = rte_event_ring_free_count(
+					p->bypass_ring);
+			const char *col = (space == 0) ? COL_RED : COL_RESET;
+			fprintf(f, "\t%sbypass ring used: %4"PRIu64"\tfree: %4"
+					PRIu64 COL_RESET"\n", col, used, space);
+		}
 	}
 
 	for (i = 0; i < sw->qid_count; i++) {
@@ -932,6 +1022,17 @@ set_refill_once(const char *key __rte_unused, const char *value, void *opaque)
 	return 0;
 }
 
+static int
+set_single_link_bypass(const char *key __rte_unused, const char *value,
+		void *opaque)
+{
+	int *single_link_bypass = opaque;
+	*single_link_bypass = atoi(value);
+	if (*single_link_bypass < 0 || *single_link_bypass > 1)
+		return -1;
+	return 0;
+}
+
 static int32_t sw_sched_service_func(void *args)
 {
 	struct rte_eventdev *dev = args;
@@ -958,6 +1059,8 @@ sw_probe(struct rte_vdev_device *vdev)
 			.port_link = sw_port_link,
 			.port_unlink = sw_port_unlink,
 			.port_unlinks_in_progress = sw_port_unlinks_in_progress,
+			.port_credits_reserve = sw_port_credits_reserve,
+			.port_credits_release = sw_port_credits_release,
 
 			.eth_rx_adapter_caps_get = sw_eth_rx_adapter_caps_get,
 
@@ -980,6 +1083,7 @@ sw_probe(struct rte_vdev_device *vdev)
 		MIN_BURST_SIZE_ARG,
 		DEQ_BURST_SIZE_ARG,
 		REFIL_ONCE_ARG,
+		SINGLE_LINK_BYPASS_ARG,
 		NULL
 	};
 	const char *name;
@@ -992,6 +1096,7 @@ sw_probe(struct rte_vdev_device *vdev)
 	int min_burst_size = 1;
 	int deq_burst_size = SCHED_DEQUEUE_DEFAULT_BURST_SIZE;
 	int refill_once = 0;
+	int single_link_bypass = 0;
 
 	name = rte_vdev_device_name(vdev);
 	params = rte_vdev_device_args(vdev);
@@ -1063,6 +1168,17 @@ sw_probe(struct rte_vdev_device *vdev)
 				return ret;
 			}
 
+			ret = rte_kvargs_process(kvlist, SINGLE_LINK_BYPASS_ARG,
+					set_single_link_bypass,
+					&single_link_bypass);
+			if (ret != 0) {
+				SW_LOG_ERR(
+					"%s: Error parsing single link bypass switch",
+					name);
+				rte_kvargs_free(kvlist);
+				return ret;
+			}
+
 			rte_kvargs_free(kvlist);
 		}
 	}
@@ -1070,9 +1186,11 @@ sw_probe(struct rte_vdev_device *vdev)
 	SW_LOG_INFO(
 			"Creating eventdev sw device %s, numa_node=%d, "
 			"sched_quanta=%d, credit_quanta=%d "
-			"min_burst=%d, deq_burst=%d, refill_once=%d",
+			"min_burst=%d, deq_burst=%d, refill_once=%d, "
+			"single_link_bypass=%d",
 			name, socket_id, sched_quanta, credit_quanta,
-			min_burst_size, deq_burst_size, refill_once);
+			min_burst_size, deq_burst_size, refill_once,
+			single_link_bypass);
 
 	dev = rte_event_pmd_vdev_init(name,
 			sizeof(struct sw_evdev), socket_id, vdev);
@@ -1098,6 +1216,7 @@ sw_probe(struct rte_vdev_device *vdev)
 	sw->sched_min_burst_size = min_burst_size;
 	sw->sched_deq_burst_size = deq_burst_size;
 	sw->refill_once_per_iter = refill_once;
+	sw->single_link_bypass = single_link_bypass;
 
 	/* register service with EAL */
 	struct rte_service_spec service;
@@ -1146,5 +1265,5 @@ RTE_PMD_REGISTER_VDEV(EVENTDEV_NAME_SW_PMD, evdev_sw_pmd_drv);
 RTE_PMD_REGISTER_PARAM_STRING(event_sw, NUMA_NODE_ARG "=<int> "
 		SCHED_QUANTA_ARG "=<int>" CREDIT_QUANTA_ARG "=<int>"
 		MIN_BURST_SIZE_ARG "=<int>" DEQ_BURST_SIZE_ARG "=<int>"
-		REFIL_ONCE_ARG "=<int>");
+		REFIL_ONCE_ARG "=<int>" SINGLE_LINK_BYPASS_ARG "=<int>");
 RTE_LOG_REGISTER_DEFAULT(eventdev_sw_log_level, NOTICE);
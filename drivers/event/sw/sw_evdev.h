@@ -117,6 +117,9 @@ struct sw_qid {
 	uint32_t iq_pkt_mask; /* A mask to indicate packets in an IQ */
 	uint64_t iq_pkt_count[SW_IQS_MAX];
 
+	/* Direct ring to the consumer port when single-link bypass is on */
+	struct rte_event_ring *bypass_ring;
+
 	/* Information on what CQs are polling this IQ */
 	uint32_t cq_num_mapped_cqs;
 	uint32_t cq_next_tx; /* cq to write next (non-atomic) packet */
@@ -173,13 +176,19 @@ struct sw_port {
 	alignas(RTE_CACHE_LINE_SIZE) struct rte_event_ring *rx_worker_ring;
 	/** Ring and buffer for pushing packets to workers after scheduling */
 	struct rte_event_ring *cq_worker_ring;
-
-	/* hole */
+	/** Bypass ring of this port's directed QID, NULL when not bypassed */
+	struct rte_event_ring *bypass_ring;
+	/** The directed QID feeding bypass_ring, for stats accounting */
+	struct sw_qid *bypass_qid;
 
 	/* num releases yet to be completed on this port */
 	alignas(RTE_CACHE_LINE_SIZE) uint16_t outstanding_releases;
 	uint16_t inflight_max; /* app requested max inflights for this port */
 	uint16_t inflight_credits; /* num credits this port has right now */
+	uint16_t reserved_credits; /* credits the app reserved explicitly, not
+				    * returned to the pool by the automatic
+				    * credit replenish logic
+				    */
 	uint8_t implicit_release; /* release events before dequeuing */
 
 	uint16_t last_dequeue_burst_sz; /* how big the burst was */
@@ -226,6 +235,8 @@ struct sw_evdev {
 	uint32_t sched_deq_burst_size;
 	/* Refill pp buffers only once per scheduler call*/
 	uint32_t refill_once_per_iter;
+	/* Enqueue single-link queue events directly to consumer rings */
+	uint32_t single_link_bypass;
 	/* Current values */
 	uint32_t sched_flush_count;
 	uint32_t sched_min_burst;
@@ -533,6 +533,82 @@ test_single_directed_packet(struct test *t)
 	return 0;
 }
 
+static int
+test_single_link_bypass(struct test *t)
+{
+	struct sw_evdev *sw = sw_pmd_priv(&rte_eventdevs[evdev]);
+	const int rx_enq = 0;
+	const int wrk_deq = 1;
+	struct rte_event ev[4];
+	struct test_event_dev_stats stats;
+	uint32_t deq_pkts;
+	uint32_t i;
+	int err;
+
+	/* enable bypass as the vdev argument would, before queue setup */
+	sw->single_link_bypass = 1;
+
+	if (init(t, 1, 2) < 0 ||
+			create_ports(t, 2) < 0 ||
+			create_directed_qids(t, 1, &t->port[wrk_deq]) < 0)
+		goto fail;
+
+	if (rte_event_dev_start(evdev) < 0) {
+		printf("%d: Error with start call\n", __LINE__);
+		goto fail;
+	}
+
+	for (i = 0; i < RTE_DIM(ev); i++)
+		ev[i] = (struct rte_event) {
+			.op = RTE_EVENT_OP_NEW,
+			.queue_id = t->qid[0],
+			.flow_id = i,
+		};
+
+	err = rte_event_enqueue_burst(evdev, rx_enq, ev, RTE_DIM(ev));
+	if (err != (int)RTE_DIM(ev)) {
+		printf("%d: error failed to enqueue\n", __LINE__);
+		goto fail;
+	}
+
+	/* events must arrive in order WITHOUT running the scheduler */
+	deq_pkts = rte_event_dequeue_burst(evdev, wrk_deq, ev, RTE_DIM(ev), 0);
+	if (deq_pkts != RTE_DIM(ev)) {
+		printf("%d: error failed to deq bypassed events\n", __LINE__);
+		goto fail;
+	}
+
+	for (i = 0; i < RTE_DIM(ev); i++) {
+		if (ev[i].flow_id != i) {
+			printf("%d: error bypassed events out of order\n",
+					__LINE__);
+			goto fail;
+		}
+	}
+
+	err = test_event_dev_stats_get(evdev, &stats);
+	if (err) {
+		printf("%d: error failed to get stats\n", __LINE__);
+		goto fail;
+	}
+
+	if (stats.port_rx_pkts[rx_enq] != RTE_DIM(ev) ||
+			stats.port_tx_pkts[wrk_deq] != RTE_DIM(ev) ||
+			stats.qid_rx_pkts[0] != RTE_DIM(ev) ||
+			stats.qid_tx_pkts[0] != RTE_DIM(ev)) {
+		printf("%d: error bypass stats incorrect\n", __LINE__);
+		goto fail;
+	}
+
+	sw->single_link_bypass = 0;
+	cleanup(t);
+	return 0;
+
+fail:
+	sw->single_link_bypass = 0;
+	return -1;
+}
+
 static int
 test_directed_forward_credits(struct test *t)
 {
@@ -1289,6 +1365,76 @@ fail:
 	return -1;
 }
 
+static int
+credit_reserve(struct test *t)
+{
+	struct sw_evdev *sw = sw_pmd_priv(&rte_eventdevs[evdev]);
+	uint16_t credits;
+
+	if (init(t, 1, 1) < 0 ||
+	    create_ports(t, 1) < 0 ||
+	    create_atomic_qids(t, 1) < 0) {
+		printf("%d: Error initializing device\n", __LINE__);
+		return -1;
+	}
+
+	if (rte_event_port_link(evdev, t->port[0], NULL, NULL, 0) != 1) {
+		printf("%d: error mapping qid\n", __LINE__);
+		goto fail;
+	}
+	if (rte_event_dev_start(evdev) < 0) {
+		printf("%d: Error with start call\n", __LINE__);
+		goto fail;
+	}
+
+	/* a reservation is taken from the instance credit pool up front */
+	credits = rte_event_port_credits_reserve(evdev, t->port[0], 32);
+	if (credits != 32 || rte_atomic32_read(&sw->inflights) != 32) {
+		printf("%d: error reserving credits\n", __LINE__);
+		goto fail;
+	}
+
+	/* a new event spends a reserved credit without touching the pool */
+	struct rte_event ev = {
+		.op = RTE_EVENT_OP_NEW,
+		.queue_id = t->qid[0],
+	};
+	if (rte_event_enqueue_burst(evdev, t->port[0], &ev, 1) != 1) {
+		printf("%d: Failed to enqueue\n", __LINE__);
+		goto fail;
+	}
+	if (rte_atomic32_read(&sw->inflights) != 32 ||
+	    sw->ports[0].inflight_credits != 31) {
+		printf("%d: reserved credit not spent locally\n", __LINE__);
+		goto fail;
+	}
+
+	/* only the unspent part of the reservation can be released */
+	credits = rte_event_port_credits_release(evdev, t->port[0], 64);
+	if (credits != 31 || rte_atomic32_read(&sw->inflights) != 1) {
+		printf("%d: error releasing credits\n", __LINE__);
+		goto fail;
+	}
+
+	/* reservations are clamped to the port's new event threshold */
+	credits = rte_event_port_credits_reserve(evdev, t->port[0], 2048);
+	if (credits != 1023) {
+		printf("%d: reservation not clamped: %d\n", __LINE__, credits);
+		goto fail;
+	}
+	if (rte_event_port_credits_release(evdev, t->port[0], credits) !=
+			credits) {
+		printf("%d: error releasing credits\n", __LINE__);
+		goto fail;
+	}
+
+	cleanup(t);
+	return 0;
+fail:
+	cleanup(t);
+	return -1;
+}
+
 static int
 port_single_lb_reconfig(struct test *t)
 {
@@ -3364,6 +3510,12 @@ test_sw_eventdev(void)
 		printf("ERROR - Single Directed Packet test FAILED.\n");
 		goto test_fail;
 	}
+	printf("*** Running Single Link Bypass test...\n");
+	ret = test_single_link_bypass(t);
+	if (ret != 0) {
+		printf("ERROR - Single Link Bypass test FAILED.\n");
+		goto test_fail;
+	}
 	printf("*** Running Directed Forward Credit test...\n");
 	ret = test_directed_forward_credits(t);
 	if (ret != 0) {
@@ -3503,6 +3655,12 @@ test_sw_eventdev(void)
 		printf("ERROR - Port Reconfig Credits Reset test FAILED.\n");
 		goto test_fail;
 	}
+	printf("*** Running Credit Reserve test...\n");
+	ret = credit_reserve(t);
+	if (ret != 0) {
+		printf("ERROR - Credit Reserve test FAILED.\n");
+		goto test_fail;
+	}
 	printf("*** Running Head-of-line-blocking test...\n");
 	ret = holb(t);
 	if (ret != 0) {
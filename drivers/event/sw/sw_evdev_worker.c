@@ -11,24 +11,34 @@
 #define PORT_ENQUEUE_MAX_BURST_SIZE 64
 
 static inline void
-sw_event_release(struct sw_port *p, uint8_t index)
+sw_event_release_burst(struct sw_port *p, uint16_t num)
 {
 	/*
-	 * Drops the next outstanding event in our history. Used on dequeue
+	 * Drops the outstanding events in our history. Used on dequeue
 	 * to clear any history before dequeuing more events.
+	 * All drop messages of a chunk go to the ring as one burst, so the
+	 * producer head/tail is only updated once per chunk instead of per
+	 * event, and the credit accounting below stays a plain local add.
 	 */
-	RTE_SET_USED(index);
+	struct rte_event evs[PORT_ENQUEUE_MAX_BURST_SIZE];
+	uint16_t burst, i;
 
-	/* create drop message */
-	struct rte_event ev;
-	ev.op = sw_qe_flag_map[RTE_EVENT_OP_RELEASE];
+	burst = RTE_MIN(num, (uint16_t)PORT_ENQUEUE_MAX_BURST_SIZE);
+	for (i = 0; i < burst; i++)
+		evs[i].op = sw_qe_flag_map[RTE_EVENT_OP_RELEASE];
 
-	uint16_t free_count;
-	rte_event_ring_enqueue_burst(p->rx_worker_ring, &ev, 1, &free_count);
+	while (num != 0) {
+		uint16_t free_count;
 
-	/* each release returns one credit */
-	p->outstanding_releases--;
-	p->inflight_credits++;
+		burst = RTE_MIN(num, (uint16_t)PORT_ENQUEUE_MAX_BURST_SIZE);
+		rte_event_ring_enqueue_burst(p->rx_worker_ring, evs, burst,
+				&free_count);
+
+		/* each release returns one credit */
+		p->outstanding_releases -= burst;
+		p->inflight_credits += burst;
+		num -= burst;
+	}
 }
 
 /*
@@ -49,6 +59,50 @@ enqueue_burst_with_ops(struct rte_event_ring *r, const struct rte_event *events,
 	return rte_event_ring_enqueue_burst(r, tmp_evs, n, NULL);
 }
 
+/*
+ * Deliver a burst when single-link bypass is enabled. Events heading to a
+ * bypassed directed QID are written straight to the consumer port ring,
+ * everything else (including releases) takes the scheduler path via the
+ * rx worker ring. Events are delivered in order, in runs sharing a
+ * destination, stopping at the first destination that backpressures.
+ */
+static inline unsigned int
+sw_enqueue_burst_bypass(struct sw_port *p, struct sw_evdev *sw,
+		const struct rte_event ev[], unsigned int num, uint8_t *ops)
+{
+	unsigned int enq = 0;
+
+	while (enq < num) {
+		struct rte_event_ring *dest = (ops[enq] & QE_FLAG_VALID) ?
+			sw->qids[ev[enq].queue_id].bypass_ring : NULL;
+		unsigned int run = enq + 1;
+		unsigned int n;
+
+		while (run < num && dest == ((ops[run] & QE_FLAG_VALID) ?
+				sw->qids[ev[run].queue_id].bypass_ring : NULL))
+			run++;
+		run -= enq;
+
+		if (dest == NULL)
+			n = enqueue_burst_with_ops(p->rx_worker_ring, &ev[enq],
+					run, &ops[enq]);
+		else {
+			/* events are forwarded as-is: neither the scheduler
+			 * nor the consumer inspects the op flags on this path
+			 */
+			n = rte_event_ring_enqueue_burst(dest, &ev[enq], run,
+					NULL);
+			p->stats.rx_pkts += n;
+		}
+
+		enq += n;
+		if (n < run)
+			break;
+	}
+
+	return enq;
+}
+
 uint16_t
 sw_event_enqueue_burst(void *port, const struct rte_event ev[], uint16_t num)
 {
@@ -110,8 +164,13 @@ sw_event_enqueue_burst(void *port, const struct rte_event ev[], uint16_t num)
 	}
 
 	/* returns number of events actually enqueued */
-	uint32_t enq = enqueue_burst_with_ops(p->rx_worker_ring, ev, i,
-					     new_ops);
+	uint32_t enq;
+
+	if (likely(!sw->single_link_bypass))
+		enq = enqueue_burst_with_ops(p->rx_worker_ring, ev, i,
+				new_ops);
+	else
+		enq = sw_enqueue_burst_bypass(p, sw, ev, i, new_ops);
 	if (p->outstanding_releases == 0 && p->last_dequeue_burst_sz != 0) {
 		uint64_t burst_ticks = rte_get_timer_cycles() -
 				p->last_dequeue_ticks;
@@ -122,8 +181,11 @@ sw_event_enqueue_burst(void *port, const struct rte_event ev[], uint16_t num)
 		p->last_dequeue_ticks = 0;
 	}
 
-	/* Replenish credits if enough releases are performed */
-	if (p->inflight_credits >= credit_update_quanta * 2) {
+	/* Replenish credits if enough releases are performed, leaving any
+	 * explicitly reserved credits in the port
+	 */
+	p->reserved_credits = RTE_MIN(p->reserved_credits, p->inflight_credits);
+	if (p->inflight_credits >= credit_update_quanta * 2 + p->reserved_credits) {
 		rte_atomic32_sub(&sw->inflights, credit_update_quanta);
 		p->inflight_credits -= credit_update_quanta;
 	}
@@ -144,12 +206,15 @@ sw_event_dequeue_burst(void *port, struct rte_event *ev, uint16_t num,
 		struct sw_evdev *sw = (void *)p->sw;
 		uint32_t credit_update_quanta = sw->credit_update_quanta;
 		uint16_t out_rels = p->outstanding_releases;
-		uint16_t i;
-		for (i = 0; i < out_rels; i++)
-			sw_event_release(p, i);
 
-		/* Replenish credits if enough releases are performed */
-		if (p->inflight_credits >= credit_update_quanta * 2) {
+		if (out_rels != 0)
+			sw_event_release_burst(p, out_rels);
+
+		/* Replenish credits if enough releases are performed, leaving
+		 * any explicitly reserved credits in the port
+		 */
+		if (p->inflight_credits >= credit_update_quanta * 2 +
+				p->reserved_credits) {
 			rte_atomic32_sub(&sw->inflights, credit_update_quanta);
 			p->inflight_credits -= credit_update_quanta;
 		}
@@ -157,6 +222,18 @@ sw_event_dequeue_burst(void *port, struct rte_event *ev, uint16_t num,
 
 	/* returns number of events actually dequeued */
 	uint16_t ndeq = rte_event_ring_dequeue_burst(ring, ev, num, NULL);
+	if (p->bypass_ring != NULL && ndeq < num) {
+		/* top up from the directed QID bypass ring, accounting the
+		 * QID and port tx stats the scheduler is being skipped for
+		 */
+		uint16_t bdeq = rte_event_ring_dequeue_burst(p->bypass_ring,
+				&ev[ndeq], num - ndeq, NULL);
+
+		p->bypass_qid->stats.rx_pkts += bdeq;
+		p->bypass_qid->stats.tx_pkts += bdeq;
+		p->stats.tx_pkts += bdeq;
+		ndeq += bdeq;
+	}
 	if (unlikely(ndeq == 0)) {
 		p->zero_polls++;
 		p->total_polls++;
@@ -141,13 +141,54 @@ bucket_enqueue(struct rte_mempool *mp, void * const *obj_table,
 	       unsigned int n)
 {
 	struct bucket_data *bd = mp->pool_data;
-	struct bucket_stack *local_stack = bd->buckets[rte_lcore_id()];
-	unsigned int i;
+	unsigned int lcore_id = rte_lcore_id();
+	struct bucket_stack *local_stack = bd->buckets[lcore_id];
+	unsigned int i, run;
 	int rc = 0;
 
-	for (i = 0; i < n; i++) {
-		rc = bucket_enqueue_single(bd, obj_table[i]);
-		RTE_ASSERT(rc == 0);
+	for (i = 0; i < n; i += run) {
+		uintptr_t addr = (uintptr_t)obj_table[i] &
+			bd->bucket_page_mask;
+		struct bucket_header *hdr = (struct bucket_header *)addr;
+
+		/*
+		 * Objects freed back-to-back mostly belong to the same
+		 * bucket, in particular when the caller returns a sliced
+		 * contiguous block. Handle such a run with a single header
+		 * update instead of a read-modify-write per object.
+		 */
+		run = 1;
+		while (i + run < n &&
+		       ((uintptr_t)obj_table[i + run] &
+			bd->bucket_page_mask) == addr)
+			run++;
+
+		if (likely(hdr->lcore_id == lcore_id)) {
+			if (hdr->fill_cnt + run < bd->obj_per_bucket) {
+				hdr->fill_cnt += run;
+			} else {
+				hdr->fill_cnt = 0;
+				/* Stack is big enough to put all buckets */
+				bucket_stack_push(local_stack, hdr);
+			}
+		} else if (hdr->lcore_id != LCORE_ID_ANY) {
+			struct rte_ring *adopt_ring =
+				bd->adoption_buffer_rings[hdr->lcore_id];
+			unsigned int done;
+
+			done = rte_ring_enqueue_bulk(adopt_ring,
+						     &obj_table[i], run, NULL);
+			/* Ring is big enough to put all objects */
+			RTE_ASSERT(done == run);
+			rc = (done == run) ? 0 : -ENOBUFS;
+		} else if (hdr->fill_cnt + run < bd->obj_per_bucket) {
+			hdr->fill_cnt += run;
+		} else {
+			hdr->fill_cnt = 0;
+			rc = rte_ring_enqueue(bd->shared_bucket_ring, hdr);
+			/* Ring is big enough to put all buckets */
+			RTE_ASSERT(rc == 0);
+		}
 	}
 	if (local_stack->top > bd->bucket_stack_thresh) {
 		rte_ring_enqueue_bulk(bd->shared_bucket_ring,
@@ -25,6 +25,7 @@
 #include <rte_string_fns.h>
 #include <rte_branch_prediction.h>
 #include <rte_common.h>
+#include <rte_cycles.h>
 #include <dev_driver.h>
 #include <rte_eal.h>
 #include <rte_ether.h>
@@ -79,6 +80,12 @@ RTE_LOG_REGISTER_DEFAULT(af_xdp_logtype, NOTICE);
 #define ETH_AF_XDP_RX_BATCH_SIZE	XSK_RING_CONS__DEFAULT_NUM_DESCS
 #define ETH_AF_XDP_TX_BATCH_SIZE	XSK_RING_CONS__DEFAULT_NUM_DESCS
 
+/* Replenishment chunk for the fill ring in the zero-copy path. Sized to
+ * match the typical mempool per-lcore cache so one bulk allocation does
+ * not spill into the shared pool.
+ */
+#define ETH_AF_XDP_FQ_REFILL_CHUNK	64
+
 #define ETH_AF_XDP_ETH_OVERHEAD		(RTE_ETHER_HDR_LEN + RTE_ETHER_CRC_LEN)
 
 #define ETH_AF_XDP_MP_KEY "afxdp_mp_send_fds"
@@ -144,6 +151,7 @@ struct pkt_rx_queue {
 	struct pollfd fds[1];
 	int xsk_queue_idx;
 	int busy_budget;
+	uint32_t fq_deficit;
 };
 
 struct tx_stats {
@@ -160,6 +168,8 @@ struct pkt_tx_queue {
 
 	struct pkt_rx_queue *pair;
 	int xsk_queue_idx;
+	uint64_t kick_budget;
+	uint64_t last_kick;
 };
 
 struct pmd_internals {
@@ -194,6 +204,7 @@ struct pmd_process_private {
 #define ETH_AF_XDP_SHARED_UMEM_ARG		"shared_umem"
 #define ETH_AF_XDP_PROG_ARG			"xdp_prog"
 #define ETH_AF_XDP_BUDGET_ARG			"busy_budget"
+#define ETH_AF_XDP_KICK_BUDGET_ARG		"kick_budget"
 #define ETH_AF_XDP_FORCE_COPY_ARG		"force_copy"
 #define ETH_AF_XDP_USE_CNI_ARG			"use_cni"
 #define ETH_AF_XDP_USE_PINNED_MAP_ARG	"use_pinned_map"
@@ -206,6 +217,7 @@ static const char * const valid_arguments[] = {
 	ETH_AF_XDP_SHARED_UMEM_ARG,
 	ETH_AF_XDP_PROG_ARG,
 	ETH_AF_XDP_BUDGET_ARG,
+	ETH_AF_XDP_KICK_BUDGET_ARG,
 	ETH_AF_XDP_FORCE_COPY_ARG,
 	ETH_AF_XDP_USE_CNI_ARG,
 	ETH_AF_XDP_USE_PINNED_MAP_ARG,
@@ -316,15 +328,18 @@ af_xdp_rx_zc(void *queue, struct rte_mbuf **bufs, uint16_t nb_pkts)
 	struct xsk_ring_cons *rx = &rxq->rx;
 	struct xsk_ring_prod *fq = &rxq->fq;
 	struct xsk_umem_info *umem = rxq->umem;
+	struct rte_mbuf *first = NULL, *last = NULL;
 	uint32_t idx_rx = 0;
 	unsigned long rx_bytes = 0;
-	int i;
-	struct rte_mbuf *fq_bufs[ETH_AF_XDP_RX_BATCH_SIZE];
+	uint16_t count = 0;
+	uint32_t nb_desc;
+	uint32_t i;
+	struct rte_mbuf *fq_bufs[ETH_AF_XDP_FQ_REFILL_CHUNK];
 	struct rte_eth_dev *dev = &rte_eth_devices[rxq->port];
 
-	nb_pkts = xsk_ring_cons__peek(rx, nb_pkts, &idx_rx);
+	nb_desc = xsk_ring_cons__peek(rx, nb_pkts, &idx_rx);
 
-	if (nb_pkts == 0) {
+	if (nb_desc == 0) {
 		/* we can assume a kernel >= 5.11 is in use if busy polling is
 		 * enabled and thus we can safely use the recvfrom() syscall
 		 * which is only supported for AF_XDP sockets in kernels >=
@@ -340,21 +355,9 @@ af_xdp_rx_zc(void *queue, struct rte_mbuf **bufs, uint16_t nb_pkts)
 		return 0;
 	}
 
-	/* allocate bufs for fill queue replenishment after rx */
-	if (rte_pktmbuf_alloc_bulk(umem->mb_pool, fq_bufs, nb_pkts)) {
-		AF_XDP_LOG_LINE(DEBUG,
-			"Failed to get enough buffers for fq.");
-		/* rollback cached_cons which is added by
-		 * xsk_ring_cons__peek
-		 */
-		rx->cached_cons -= nb_pkts;
-		dev->data->rx_mbuf_alloc_failed += nb_pkts;
-
-		return 0;
-	}
-
-	for (i = 0; i < nb_pkts; i++) {
+	for (i = 0; i < nb_desc; i++) {
 		const struct xdp_desc *desc;
+		struct rte_mbuf *mbuf;
 		uint64_t addr;
 		uint32_t len;
 		uint64_t offset;
@@ -366,27 +369,79 @@ af_xdp_rx_zc(void *queue, struct rte_mbuf **bufs, uint16_t nb_pkts)
 		offset = xsk_umem__extract_offset(addr);
 		addr = xsk_umem__extract_addr(addr);
 
-		bufs[i] = (struct rte_mbuf *)
+		mbuf = (struct rte_mbuf *)
 				xsk_umem__get_data(umem->buffer, addr +
 					umem->mb_pool->header_size);
-		bufs[i]->data_off = offset - sizeof(struct rte_mbuf) -
+		mbuf->data_off = offset - sizeof(struct rte_mbuf) -
 			rte_pktmbuf_priv_size(umem->mb_pool) -
 			umem->mb_pool->header_size;
-		bufs[i]->port = rxq->port;
 
-		rte_pktmbuf_pkt_len(bufs[i]) = len;
-		rte_pktmbuf_data_len(bufs[i]) = len;
+		rte_pktmbuf_data_len(mbuf) = len;
 		rx_bytes += len;
+
+		if (first == NULL) {
+			first = mbuf;
+			last = mbuf;
+			first->nb_segs = 1;
+			first->port = rxq->port;
+			rte_pktmbuf_pkt_len(first) = len;
+		} else {
+			last->next = mbuf;
+			last = mbuf;
+			first->nb_segs++;
+			rte_pktmbuf_pkt_len(first) += len;
+		}
+
+#if defined(XDP_PKT_CONTD)
+		/* multi-buffer: the packet continues in the next desc */
+		if (desc->options & XDP_PKT_CONTD)
+			continue;
+#endif
+
+		bufs[count++] = first;
+		first = NULL;
 	}
 
-	xsk_ring_cons__release(rx, nb_pkts);
-	(void)reserve_fill_queue(umem, nb_pkts, fq_bufs, fq);
+#if defined(XDP_PKT_CONTD)
+	if (unlikely(first != NULL)) {
+		/* The last chain was cut short by the peek window. Leave
+		 * its descriptors in the ring for the next burst; like the
+		 * alloc-failure case this only adjusts cached_cons, which
+		 * xsk_ring_cons__peek bumped.
+		 */
+		nb_desc -= first->nb_segs;
+		rx->cached_cons -= first->nb_segs;
+		rx_bytes -= rte_pktmbuf_pkt_len(first);
+	}
+#endif
+
+	xsk_ring_cons__release(rx, nb_desc);
+
+	/* Replenish the fill ring in large aligned chunks: the bulk
+	 * allocation usually stays within the mempool per-lcore cache and
+	 * the fq producer index is published once per chunk rather than
+	 * once per burst. Failures just carry the deficit forward.
+	 */
+	rxq->fq_deficit += nb_desc;
+	while (rxq->fq_deficit >= ETH_AF_XDP_FQ_REFILL_CHUNK) {
+		if (rte_pktmbuf_alloc_bulk(umem->mb_pool, fq_bufs,
+					   ETH_AF_XDP_FQ_REFILL_CHUNK)) {
+			AF_XDP_LOG_LINE(DEBUG,
+				"Failed to get enough buffers for fq.");
+			dev->data->rx_mbuf_alloc_failed++;
+			break;
+		}
+		if (reserve_fill_queue(umem, ETH_AF_XDP_FQ_REFILL_CHUNK,
+				       fq_bufs, fq))
+			break;
+		rxq->fq_deficit -= ETH_AF_XDP_FQ_REFILL_CHUNK;
+	}
 
 	/* statistics */
-	rxq->stats.rx_pkts += nb_pkts;
+	rxq->stats.rx_pkts += count;
 	rxq->stats.rx_bytes += rx_bytes;
 
-	return nb_pkts;
+	return count;
 }
 #else
 static uint16_t
@@ -536,6 +591,34 @@ kick_tx(struct pkt_tx_queue *txq, struct xsk_ring_cons *cq)
 		}
 }
 
+/*
+ * Coalesced variant of kick_tx(): with a non-zero kick budget the kick
+ * syscall is deferred across bursts until either the budget (in TSC
+ * cycles) has elapsed since the last kick or the Tx ring runs low on
+ * free descriptors. The completion ring is drained either way.
+ */
+static void
+kick_tx_coalesced(struct pkt_tx_queue *txq, struct xsk_ring_cons *cq)
+{
+	uint32_t free_thresh = txq->tx.size >> 1;
+	uint64_t now;
+
+	if (txq->kick_budget == 0) {
+		kick_tx(txq, cq);
+		return;
+	}
+
+	now = rte_get_tsc_cycles();
+	if (now - txq->last_kick < txq->kick_budget &&
+	    xsk_prod_nb_free(&txq->tx, free_thresh) >= free_thresh) {
+		pull_umem_cq(txq->umem, XSK_RING_CONS__DEFAULT_NUM_DESCS, cq);
+		return;
+	}
+
+	txq->last_kick = now;
+	kick_tx(txq, cq);
+}
+
 static inline struct xdp_desc *
 reserve_and_fill(struct pkt_tx_queue *txq, struct rte_mbuf *mbuf,
 		 struct xsk_umem_info *umem, void **pkt_ptr)
@@ -549,6 +632,10 @@ reserve_and_fill(struct pkt_tx_queue *txq, struct rte_mbuf *mbuf,
 
 	desc = xsk_ring_prod__tx_desc(&txq->tx, idx_tx);
 	desc->len = mbuf->pkt_len;
+#if defined(XDP_PKT_CONTD)
+	/* ring slots are recycled; do not leak a stale continuation flag */
+	desc->options = 0;
+#endif
 
 	addr = (uint64_t)mbuf - (uint64_t)umem->buffer
 		- umem->mb_pool->header_size;
@@ -566,15 +653,45 @@ out:
 }
 
 #if defined(XDP_UMEM_UNALIGNED_CHUNK_FLAG)
+#if defined(XDP_PKT_CONTD)
+/*
+ * Transmit a segmented umem mbuf as a multi-buffer descriptor chain,
+ * with XDP_PKT_CONTD set on all but the last descriptor. All-or-nothing:
+ * either the whole chain is reserved or no descriptor is consumed.
+ */
+static inline int
+tx_multi_seg_zc(struct pkt_tx_queue *txq, struct xsk_umem_info *umem,
+		struct rte_mbuf *mbuf)
+{
+	struct rte_mbuf *seg;
+	struct xdp_desc *desc;
+
+	if (xsk_prod_nb_free(&txq->tx, mbuf->nb_segs) < mbuf->nb_segs)
+		return -1;
+
+	for (seg = mbuf; seg != NULL; seg = seg->next) {
+		/* cannot fail after the free-count check above */
+		desc = reserve_and_fill(txq, seg, umem, NULL);
+		desc->len = rte_pktmbuf_data_len(seg);
+		if (seg->next != NULL)
+			desc->options = XDP_PKT_CONTD;
+	}
+
+	return 0;
+}
+#endif
+
 static uint16_t
 af_xdp_tx_zc(void *queue, struct rte_mbuf **bufs, uint16_t nb_pkts)
 {
 	struct pkt_tx_queue *txq = queue;
 	struct xsk_umem_info *umem = txq->umem;
-	struct rte_mbuf *mbuf, *local_mbuf = NULL;
+	struct rte_mbuf *mbuf, *seg, *local_mbuf = NULL;
 	unsigned long tx_bytes = 0;
 	int i;
 	uint16_t count = 0;
+	uint16_t dropped = 0;
+	uint32_t nb_descs = 0;
 	struct xdp_desc *desc;
 	struct xsk_ring_cons *cq = &txq->pair->cq;
 	uint32_t free_thresh = cq->size >> 1;
@@ -587,6 +704,21 @@ af_xdp_tx_zc(void *queue, struct rte_mbuf **bufs, uint16_t nb_pkts)
 		mbuf = bufs[i];
 
 		if (mbuf->pool == umem->mb_pool) {
+#if defined(XDP_PKT_CONTD)
+			if (unlikely(mbuf->nb_segs > 1)) {
+				if (tx_multi_seg_zc(txq, umem, mbuf) < 0) {
+					kick_tx(txq, cq);
+					if (tx_multi_seg_zc(txq, umem,
+							    mbuf) < 0)
+						goto out;
+				}
+
+				tx_bytes += mbuf->pkt_len;
+				nb_descs += mbuf->nb_segs;
+				count++;
+				continue;
+			}
+#endif
 			desc = reserve_and_fill(txq, mbuf, umem, NULL);
 			if (!desc) {
 				kick_tx(txq, cq);
@@ -596,34 +728,52 @@ af_xdp_tx_zc(void *queue, struct rte_mbuf **bufs, uint16_t nb_pkts)
 			}
 
 			tx_bytes += desc->len;
+			nb_descs++;
 			count++;
 		} else {
 			local_mbuf = rte_pktmbuf_alloc(umem->mb_pool);
 			if (!local_mbuf)
 				goto out;
 
+			/* drop packets that cannot fit in one umem frame */
+			if (unlikely(mbuf->pkt_len >
+					rte_pktmbuf_tailroom(local_mbuf))) {
+				rte_pktmbuf_free(local_mbuf);
+				rte_pktmbuf_free(mbuf);
+				dropped++;
+				count++;
+				continue;
+			}
+
 			desc = reserve_and_fill(txq, local_mbuf, umem, &pkt);
 			if (!desc) {
 				rte_pktmbuf_free(local_mbuf);
 				goto out;
 			}
 
+			/* gather-copy a possibly segmented mbuf */
 			desc->len = mbuf->pkt_len;
-			rte_memcpy(pkt, rte_pktmbuf_mtod(mbuf, void *),
-				   desc->len);
+			for (seg = mbuf; seg != NULL; seg = seg->next) {
+				rte_memcpy(pkt,
+					   rte_pktmbuf_mtod(seg, void *),
+					   rte_pktmbuf_data_len(seg));
+				pkt = RTE_PTR_ADD(pkt,
+						  rte_pktmbuf_data_len(seg));
+			}
 			rte_pktmbuf_free(mbuf);
 			tx_bytes += desc->len;
+			nb_descs++;
 			count++;
 		}
 	}
 
 out:
-	xsk_ring_prod__submit(&txq->tx, count);
-	kick_tx(txq, cq);
+	xsk_ring_prod__submit(&txq->tx, nb_descs);
+	kick_tx_coalesced(txq, cq);
 
-	txq->stats.tx_pkts += count;
+	txq->stats.tx_pkts += count - dropped;
 	txq->stats.tx_bytes += tx_bytes;
-	txq->stats.tx_dropped += nb_pkts - count;
+	txq->stats.tx_dropped += nb_pkts - count + dropped;
 
 	return count;
 }
@@ -671,7 +821,7 @@ af_xdp_tx_cp(void *queue, struct rte_mbuf **bufs, uint16_t nb_pkts)
 
 	xsk_ring_prod__submit(&txq->tx, nb_pkts);
 
-	kick_tx(txq, cq);
+	kick_tx_coalesced(txq, cq);
 
 	txq->stats.tx_pkts += nb_pkts;
 	txq->stats.tx_bytes += tx_bytes;
@@ -1690,6 +1840,15 @@ xsk_configure(struct pmd_internals *internals, struct pkt_rx_queue *rxq,
 	cfg.bind_flags |= XDP_USE_NEED_WAKEUP;
 #endif
 
+#if defined(XDP_USE_SG)
+	/* Request multi-buffer support so frames larger than the umem
+	 * chunk size are delivered as descriptor chains rather than
+	 * truncated; the bind is retried without the flag on kernels
+	 * that do not support it.
+	 */
+	cfg.bind_flags |= XDP_USE_SG;
+#endif
+
 	/* Disable libbpf from loading XDP program */
 	if (internals->use_cni || internals->use_pinned_map)
 		cfg.libbpf_flags |= XSK_LIBBPF_FLAGS__INHIBIT_PROG_LOAD;
@@ -1718,6 +1877,25 @@ xsk_configure(struct pmd_internals *internals, struct pkt_rx_queue *rxq,
 				rxq->xsk_queue_idx, rxq->umem->umem, &rxq->rx,
 				&txq->tx, &cfg);
 
+#if defined(XDP_USE_SG)
+	if (ret && (cfg.bind_flags & XDP_USE_SG)) {
+		AF_XDP_LOG_LINE(DEBUG, "Multi-buffer not supported, retrying without.");
+		cfg.bind_flags &= ~XDP_USE_SG;
+
+		if (internals->shared_umem)
+			ret = create_shared_socket(&rxq->xsk,
+					internals->if_name,
+					rxq->xsk_queue_idx, rxq->umem->umem,
+					&rxq->rx, &txq->tx, &rxq->fq,
+					&rxq->cq, &cfg);
+		else
+			ret = xsk_socket__create(&rxq->xsk,
+					internals->if_name,
+					rxq->xsk_queue_idx, rxq->umem->umem,
+					&rxq->rx, &txq->tx, &cfg);
+	}
+#endif
+
 	if (ret) {
 		AF_XDP_LOG_LINE(ERR, "Failed to create xsk socket.");
 		goto out_umem;
@@ -2085,8 +2263,8 @@ xdp_get_channels_info(const char *if_name, int *max_queues,
 static int
 parse_parameters(struct rte_kvargs *kvlist, char *if_name, int *start_queue,
 		 int *queue_cnt, int *shared_umem, char *prog_path,
-		 int *busy_budget, int *force_copy, int *use_cni,
-		 int *use_pinned_map, char *dp_path)
+		 int *busy_budget, int *kick_budget, int *force_copy,
+		 int *use_cni, int *use_pinned_map, char *dp_path)
 {
 	int ret;
 
@@ -2122,6 +2300,11 @@ parse_parameters(struct rte_kvargs *kvlist, char *if_name, int *start_queue,
 	if (ret < 0)
 		goto free_kvlist;
 
+	ret = rte_kvargs_process(kvlist, ETH_AF_XDP_KICK_BUDGET_ARG,
+				&parse_integer_arg, kick_budget);
+	if (ret < 0)
+		goto free_kvlist;
+
 	ret = rte_kvargs_process(kvlist, ETH_AF_XDP_FORCE_COPY_ARG,
 				&parse_integer_arg, force_copy);
 	if (ret < 0)
@@ -2180,8 +2363,9 @@ error:
 static struct rte_eth_dev *
 init_internals(struct rte_vdev_device *dev, const char *if_name,
 	       int start_queue_idx, int queue_cnt, int shared_umem,
-	       const char *prog_path, int busy_budget, int force_copy,
-	       int use_cni, int use_pinned_map, const char *dp_path)
+	       const char *prog_path, int busy_budget, int kick_budget,
+	       int force_copy, int use_cni, int use_pinned_map,
+	       const char *dp_path)
 {
 	const char *name = rte_vdev_device_name(dev);
 	const unsigned int numa_node = dev->device.numa_node;
@@ -2248,6 +2432,7 @@ init_internals(struct rte_vdev_device *dev, const char *if_name,
 		internals->rx_queues[i].xsk_queue_idx = start_queue_idx + i;
 		internals->tx_queues[i].xsk_queue_idx = start_queue_idx + i;
 		internals->rx_queues[i].busy_budget = busy_budget;
+		internals->tx_queues[i].kick_budget = kick_budget;
 	}
 
 	ret = get_iface_info(if_name, &internals->eth_addr,
@@ -2401,6 +2586,7 @@ rte_pmd_af_xdp_probe(struct rte_vdev_device *dev)
 	int shared_umem = 0;
 	char prog_path[PATH_MAX] = {'\0'};
 	int busy_budget = -1, ret;
+	int kick_budget = 0;
 	int force_copy = 0;
 	int use_cni = 0;
 	int use_pinned_map = 0;
@@ -2447,8 +2633,8 @@ rte_pmd_af_xdp_probe(struct rte_vdev_device *dev)
 
 	if (parse_parameters(kvlist, if_name, &xsk_start_queue_idx,
 			     &xsk_queue_cnt, &shared_umem, prog_path,
-			     &busy_budget, &force_copy, &use_cni, &use_pinned_map,
-			     dp_path) < 0) {
+			     &busy_budget, &kick_budget, &force_copy,
+			     &use_cni, &use_pinned_map, dp_path) < 0) {
 		AF_XDP_LOG_LINE(ERR, "Invalid kvargs value");
 		return -EINVAL;
 	}
@@ -2515,8 +2701,8 @@ rte_pmd_af_xdp_probe(struct rte_vdev_device *dev)
 
 	eth_dev = init_internals(dev, if_name, xsk_start_queue_idx,
 				 xsk_queue_cnt, shared_umem, prog_path,
-				 busy_budget, force_copy, use_cni, use_pinned_map,
-				 dp_path);
+				 busy_budget, kick_budget, force_copy,
+				 use_cni, use_pinned_map, dp_path);
 	if (eth_dev == NULL) {
 		AF_XDP_LOG_LINE(ERR, "Failed to init internals");
 		return -1;
@@ -2576,6 +2762,7 @@ RTE_PMD_REGISTER_PARAM_STRING(net_af_xdp,
 			      "shared_umem=<int> "
 			      "xdp_prog=<string> "
 			      "busy_budget=<int> "
+			      "kick_budget=<int> "
 			      "force_copy=<int> "
 			      "use_cni=<int> "
 			      "use_pinned_map=<int> "
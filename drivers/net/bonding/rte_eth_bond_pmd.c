@@ -64,6 +64,7 @@ bond_ethdev_rx_burst(void *queue, struct rte_mbuf **bufs, uint16_t nb_pkts)
 	uint16_t num_rx_total = 0;
 	uint16_t member_count;
 	uint16_t active_member;
+	uint16_t quota;
 	int i;
 
 	/* Cast to structure, containing bonding device's port id and queue id */
@@ -72,6 +73,18 @@ bond_ethdev_rx_burst(void *queue, struct rte_mbuf **bufs, uint16_t nb_pkts)
 	member_count = internals->active_member_count;
 	active_member = bd_rx_q->active_member;
 
+	if (unlikely(member_count == 0))
+		return 0;
+
+	/*
+	 * First pass: poll every active member for an equal share of the
+	 * burst, so the first member polled cannot fill the whole burst and
+	 * starve the others of both bandwidth and latency.
+	 */
+	quota = nb_pkts / member_count;
+	if (quota == 0)
+		quota = 1;
+
 	for (i = 0; i < member_count && nb_pkts; i++) {
 		uint16_t num_rx_member;
 
@@ -79,6 +92,24 @@ bond_ethdev_rx_burst(void *queue, struct rte_mbuf **bufs, uint16_t nb_pkts)
 		 * Offset of pointer to *bufs increases as packets are received
 		 * from other members.
 		 */
+		num_rx_member =
+			rte_eth_rx_burst(internals->active_members[active_member],
+					 bd_rx_q->queue_id,
+					 bufs + num_rx_total,
+					 RTE_MIN(quota, nb_pkts));
+		num_rx_total += num_rx_member;
+		nb_pkts -= num_rx_member;
+		if (++active_member >= member_count)
+			active_member = 0;
+	}
+
+	/*
+	 * Second pass: hand the budget left over by idle members to members
+	 * which may still have packets queued.
+	 */
+	for (i = 0; i < member_count && nb_pkts; i++) {
+		uint16_t num_rx_member;
+
 		num_rx_member =
 			rte_eth_rx_burst(internals->active_members[active_member],
 					 bd_rx_q->queue_id,
@@ -1169,6 +1200,7 @@ tx_burst_balance(void *queue, struct rte_mbuf **bufs, uint16_t nb_bufs,
 
 	uint16_t member_tx_count;
 	uint16_t total_tx_count = 0, total_tx_fail_count = 0;
+	int spill_member_idx = -1;
 
 	uint16_t i;
 
@@ -1188,8 +1220,13 @@ tx_burst_balance(void *queue, struct rte_mbuf **bufs, uint16_t nb_bufs,
 
 	/* Send packet burst on each member device */
 	for (i = 0; i < member_count; i++) {
-		if (member_nb_bufs[i] == 0)
+		if (member_nb_bufs[i] == 0) {
+			/* An idle member is the best spillover target */
+			if (spill_member_idx < 0 ||
+			    member_nb_bufs[spill_member_idx] > 0)
+				spill_member_idx = i;
 			continue;
+		}
 
 		member_tx_count = rte_eth_tx_prepare(member_port_ids[i],
 				bd_tx_q->queue_id, member_bufs[i],
@@ -1208,9 +1245,44 @@ tx_burst_balance(void *queue, struct rte_mbuf **bufs, uint16_t nb_bufs,
 			memcpy(&bufs[nb_bufs - total_tx_fail_count],
 			       &member_bufs[i][member_tx_count],
 			       member_tx_fail_count * sizeof(bufs[0]));
+		} else if (spill_member_idx < 0 ||
+			   member_nb_bufs[i] < member_nb_bufs[spill_member_idx]) {
+			/*
+			 * Track the least loaded member which accepted its
+			 * whole share as a spillover target for packets a
+			 * congested member rejects.
+			 */
+			spill_member_idx = i;
 		}
 	}
 
+	/*
+	 * Hash distribution alone keeps hotspotting a member whose queue is
+	 * full. Retry rejected packets once on the least loaded member which
+	 * accepted its whole share before handing them back to the caller.
+	 */
+	if (unlikely(total_tx_fail_count > 0 && spill_member_idx >= 0)) {
+		struct rte_mbuf **fail_bufs =
+				&bufs[nb_bufs - total_tx_fail_count];
+
+		member_tx_count = rte_eth_tx_prepare(
+				member_port_ids[spill_member_idx],
+				bd_tx_q->queue_id, fail_bufs,
+				total_tx_fail_count);
+		member_tx_count = rte_eth_tx_burst(
+				member_port_ids[spill_member_idx],
+				bd_tx_q->queue_id, fail_bufs, member_tx_count);
+
+		total_tx_count += member_tx_count;
+		total_tx_fail_count -= member_tx_count;
+
+		/* Keep the still unsent packets at the very end of bufs */
+		if (member_tx_count > 0 && total_tx_fail_count > 0)
+			memmove(&bufs[nb_bufs - total_tx_fail_count],
+				&fail_bufs[member_tx_count],
+				total_tx_fail_count * sizeof(bufs[0]));
+	}
+
 	return total_tx_count;
 }
 
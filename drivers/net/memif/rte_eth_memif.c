@@ -67,6 +67,9 @@ static const struct rte_eth_link pmd_link = {
 
 #define MEMIF_MP_SEND_REGION		"memif_mp_send_region"
 
+/* Number of descriptors processed as one batch in the zero-copy Rx path. */
+#define MEMIF_RX_ZC_BATCH		16
+
 
 static int memif_region_init_zc(const struct rte_memseg_list *msl,
 				const struct rte_memseg *ms, void *arg);
@@ -552,6 +555,45 @@ eth_memif_rx_zc(void *queue, struct rte_mbuf **bufs, uint16_t nb_pkts)
 	n_slots = last_slot - cur_slot;
 
 	while (n_slots && n_rx_pkts < nb_pkts) {
+		uint16_t nb_batch, i;
+
+		/*
+		 * Scan a batch of descriptors for chained packets first, then
+		 * fill the mbuf headers for the unchained prefix back-to-back
+		 * without re-checking flags for each descriptor.
+		 */
+		nb_batch = RTE_MIN(n_slots, (uint16_t)MEMIF_RX_ZC_BATCH);
+		nb_batch = RTE_MIN(nb_batch, (uint16_t)(nb_pkts - n_rx_pkts));
+		rte_prefetch0(&ring->desc[(cur_slot + nb_batch) & mask]);
+		for (i = 0; i < nb_batch; i++) {
+			if (ring->desc[(cur_slot + i) & mask].flags &
+			    MEMIF_DESC_FLAG_NEXT)
+				break;
+		}
+
+		nb_batch = i;
+		for (i = 0; i < nb_batch; i++) {
+			s0 = (cur_slot + i) & mask;
+			d0 = &ring->desc[s0];
+			mbuf = mq->buffers[s0];
+
+			mbuf->port = mq->in_port;
+			rte_pktmbuf_data_len(mbuf) = d0->length;
+			rte_pktmbuf_pkt_len(mbuf) = d0->length;
+
+			mq->n_bytes += d0->length;
+			*bufs++ = mbuf;
+		}
+		cur_slot += nb_batch;
+		n_slots -= nb_batch;
+		n_rx_pkts += nb_batch;
+
+		if (likely(n_slots == 0 || n_rx_pkts == nb_pkts ||
+			   (ring->desc[cur_slot & mask].flags &
+			    MEMIF_DESC_FLAG_NEXT) == 0))
+			continue;
+
+		/* Chained packet: process its descriptors one by one. */
 		s0 = cur_slot & mask;
 
 		d0 = &ring->desc[s0];
@@ -559,10 +601,6 @@ eth_memif_rx_zc(void *queue, struct rte_mbuf **bufs, uint16_t nb_pkts)
 		mbuf = mbuf_head;
 
 next_slot:
-		/* prefetch next descriptor */
-		if (n_rx_pkts + 1 < nb_pkts)
-			rte_prefetch0(&ring->desc[(cur_slot + 1) & mask]);
-
 		mbuf->port = mq->in_port;
 		rte_pktmbuf_data_len(mbuf) = d0->length;
 		rte_pktmbuf_pkt_len(mbuf) = rte_pktmbuf_data_len(mbuf);
@@ -1643,6 +1681,39 @@ memif_stats_reset(struct rte_eth_dev *dev)
 	return 0;
 }
 
+/*
+ * Rings are created with interrupts masked. These ops clear or set
+ * MEMIF_RING_FLAG_MASK_INT on a single ring, so the peer only issues
+ * the eventfd write for queues the application actually sleeps on.
+ */
+static int
+memif_rx_queue_intr_enable(struct rte_eth_dev *dev, uint16_t qid)
+{
+	struct pmd_process_private *proc_private = dev->process_private;
+	struct memif_queue *mq = dev->data->rx_queues[qid];
+	memif_ring_t *ring = memif_get_ring_from_queue(proc_private, mq);
+
+	if (ring == NULL)
+		return -1;
+
+	ring->flags &= ~MEMIF_RING_FLAG_MASK_INT;
+	return 0;
+}
+
+static int
+memif_rx_queue_intr_disable(struct rte_eth_dev *dev, uint16_t qid)
+{
+	struct pmd_process_private *proc_private = dev->process_private;
+	struct memif_queue *mq = dev->data->rx_queues[qid];
+	memif_ring_t *ring = memif_get_ring_from_queue(proc_private, mq);
+
+	if (ring == NULL)
+		return -1;
+
+	ring->flags |= MEMIF_RING_FLAG_MASK_INT;
+	return 0;
+}
+
 static const struct eth_dev_ops ops = {
 	.dev_start = memif_dev_start,
 	.dev_stop = memif_dev_stop,
@@ -1653,6 +1724,8 @@ static const struct eth_dev_ops ops = {
 	.rx_queue_setup = memif_rx_queue_setup,
 	.rx_queue_release = memif_rx_queue_release,
 	.tx_queue_release = memif_tx_queue_release,
+	.rx_queue_intr_enable = memif_rx_queue_intr_enable,
+	.rx_queue_intr_disable = memif_rx_queue_intr_disable,
 	.link_update = memif_link_update,
 	.stats_get = memif_stats_get,
 	.stats_reset = memif_stats_reset,
@@ -34,9 +34,12 @@
 #define ETH_PCAP_IFACE_ARG    "iface"
 #define ETH_PCAP_PHY_MAC_ARG  "phy_mac"
 #define ETH_PCAP_INFINITE_RX_ARG  "infinite_rx"
+#define ETH_PCAP_REPLAY_TIMING_ARG  "replay_timing"
 
 #define ETH_PCAP_ARG_MAXLEN	64
 
+#define ETH_PCAP_REPLAY_BURST	32
+
 #define RTE_PMD_PCAP_MAX_QUEUES 16
 
 static char errbuf[PCAP_ERRBUF_SIZE];
@@ -75,6 +78,12 @@ struct pcap_rx_queue {
 
 	/* Contains pre-generated packets to be looped through */
 	struct rte_ring *pkts;
+
+	/* Replay pacing state, used when replay_timing is enabled. */
+	uint64_t *replay_tsc;
+	uint64_t replay_n_pkts;
+	uint64_t replay_idx;
+	uint64_t replay_start;
 };
 
 struct pcap_tx_queue {
@@ -94,6 +103,7 @@ struct pmd_internals {
 	int single_iface;
 	int phy_mac;
 	unsigned int infinite_rx;
+	unsigned int replay_timing;
 };
 
 struct pmd_process_private {
@@ -122,6 +132,7 @@ struct pmd_devargs_all {
 	unsigned int is_rx_pcap;
 	unsigned int is_rx_iface;
 	unsigned int infinite_rx;
+	unsigned int replay_timing;
 };
 
 static const char *valid_arguments[] = {
@@ -133,6 +144,7 @@ static const char *valid_arguments[] = {
 	ETH_PCAP_IFACE_ARG,
 	ETH_PCAP_PHY_MAC_ARG,
 	ETH_PCAP_INFINITE_RX_ARG,
+	ETH_PCAP_REPLAY_TIMING_ARG,
 	NULL
 };
 
@@ -233,41 +245,101 @@ eth_pcap_rx_jumbo(struct rte_mempool *mb_pool, struct rte_mbuf *mbuf,
 	return mbuf->nb_segs;
 }
 
+static uint16_t
+eth_pcap_rx_from_ring(struct pcap_rx_queue *pcap_q, struct rte_mbuf **bufs,
+		uint16_t nb_pkts)
+{
+	uint32_t rx_bytes = 0;
+	uint16_t i, nb_rx = 0;
+
+	if (rte_pktmbuf_alloc_bulk(pcap_q->mb_pool, bufs, nb_pkts) != 0)
+		return 0;
+
+	while (nb_rx < nb_pkts) {
+		struct rte_mbuf *pcap_bufs[ETH_PCAP_REPLAY_BURST];
+		uint16_t burst = RTE_MIN((uint16_t)(nb_pkts - nb_rx),
+				(uint16_t)ETH_PCAP_REPLAY_BURST);
+		unsigned int nb_deq;
+
+		/* Rotate a burst of pre-loaded packets through the ring. */
+		nb_deq = rte_ring_dequeue_burst(pcap_q->pkts,
+				(void **)pcap_bufs, burst, NULL);
+
+		for (i = 0; i < nb_deq; i++) {
+			struct rte_mbuf *pcap_buf = pcap_bufs[i];
+			struct rte_mbuf *mbuf = bufs[nb_rx + i];
+
+			rte_memcpy(rte_pktmbuf_mtod(mbuf, void *),
+					rte_pktmbuf_mtod(pcap_buf, void *),
+					pcap_buf->data_len);
+			mbuf->data_len = pcap_buf->data_len;
+			mbuf->pkt_len = pcap_buf->pkt_len;
+			mbuf->port = pcap_q->port_id;
+			rx_bytes += pcap_buf->data_len;
+		}
+
+		rte_ring_enqueue_burst(pcap_q->pkts, (void **)pcap_bufs,
+				nb_deq, NULL);
+		nb_rx += nb_deq;
+
+		if (nb_deq < burst)
+			break;
+	}
+
+	if (unlikely(nb_rx < nb_pkts))
+		rte_pktmbuf_free_bulk(&bufs[nb_rx], nb_pkts - nb_rx);
+
+	pcap_q->rx_stat.pkts += nb_rx;
+	pcap_q->rx_stat.bytes += rx_bytes;
+
+	return nb_rx;
+}
+
 static uint16_t
 eth_pcap_rx_infinite(void *queue, struct rte_mbuf **bufs, uint16_t nb_pkts)
 {
-	int i;
 	struct pcap_rx_queue *pcap_q = queue;
-	uint32_t rx_bytes = 0;
 
 	if (unlikely(nb_pkts == 0))
 		return 0;
 
-	if (rte_pktmbuf_alloc_bulk(pcap_q->mb_pool, bufs, nb_pkts) != 0)
+	return eth_pcap_rx_from_ring(pcap_q, bufs, nb_pkts);
+}
+
+static uint16_t
+eth_pcap_rx_replay(void *queue, struct rte_mbuf **bufs, uint16_t nb_pkts)
+{
+	struct pcap_rx_queue *pcap_q = queue;
+	uint64_t now = rte_rdtsc();
+	uint16_t n = 0;
+
+	if (unlikely(nb_pkts == 0 || pcap_q->replay_n_pkts == 0))
 		return 0;
 
-	for (i = 0; i < nb_pkts; i++) {
-		struct rte_mbuf *pcap_buf;
-		int err = rte_ring_dequeue(pcap_q->pkts, (void **)&pcap_buf);
-		if (err)
-			return i;
-
-		rte_memcpy(rte_pktmbuf_mtod(bufs[i], void *),
-				rte_pktmbuf_mtod(pcap_buf, void *),
-				pcap_buf->data_len);
-		bufs[i]->data_len = pcap_buf->data_len;
-		bufs[i]->pkt_len = pcap_buf->pkt_len;
-		bufs[i]->port = pcap_q->port_id;
-		rx_bytes += pcap_buf->data_len;
-
-		/* Enqueue packet back on ring to allow infinite rx. */
-		rte_ring_enqueue(pcap_q->pkts, pcap_buf);
+	/* The replay clock starts on the first poll. */
+	if (unlikely(pcap_q->replay_start == 0))
+		pcap_q->replay_start = now;
+
+	/* Serve only the packets whose capture time offset already elapsed. */
+	while (n < nb_pkts) {
+		if (pcap_q->replay_start +
+				pcap_q->replay_tsc[pcap_q->replay_idx] > now)
+			break;
+
+		n++;
+		if (++pcap_q->replay_idx == pcap_q->replay_n_pkts) {
+			/* Loop: restart the replay clock at end of file. */
+			pcap_q->replay_start +=
+				pcap_q->replay_tsc[pcap_q->replay_n_pkts - 1];
+			pcap_q->replay_idx = 0;
+			break;
+		}
 	}
 
-	pcap_q->rx_stat.pkts += i;
-	pcap_q->rx_stat.bytes += rx_bytes;
+	if (n == 0)
+		return 0;
 
-	return i;
+	return eth_pcap_rx_from_ring(pcap_q, bufs, n);
 }
 
 static uint16_t
@@ -826,6 +898,19 @@ infinite_rx_ring_free(struct rte_ring *pkts)
 	rte_ring_free(pkts);
 }
 
+/* Convert a capture timestamp to a TSC offset from the start of the file. */
+static uint64_t
+replay_offset_cycles(const struct timeval *first, const struct timeval *ts)
+{
+	int64_t delta_us = (int64_t)(ts->tv_sec - first->tv_sec) * US_PER_S +
+			(ts->tv_usec - first->tv_usec);
+
+	if (delta_us < 0)
+		delta_us = 0;
+
+	return (uint64_t)delta_us * rte_get_tsc_hz() / US_PER_S;
+}
+
 static int
 eth_dev_close(struct rte_eth_dev *dev)
 {
@@ -855,6 +940,8 @@ eth_dev_close(struct rte_eth_dev *dev)
 				continue;
 
 			infinite_rx_ring_free(pcap_q->pkts);
+			rte_free(pcap_q->replay_tsc);
+			pcap_q->replay_tsc = NULL;
 		}
 	}
 
@@ -893,7 +980,7 @@ eth_rx_queue_setup(struct rte_eth_dev *dev,
 		char ring_name[RTE_RING_NAMESIZE];
 		static uint32_t ring_number;
 		uint64_t pcap_pkt_count = 0;
-		struct rte_mbuf *bufs[1];
+		struct timeval replay_ts_first = {0, 0};
 		pcap_t **pcap;
 
 		pp = rte_eth_devices[pcap_q->port_id].process_private;
@@ -914,35 +1001,73 @@ eth_rx_queue_setup(struct rte_eth_dev *dev,
 		if (!pcap_q->pkts)
 			return -ENOENT;
 
+		if (internals->replay_timing) {
+			pcap_q->replay_tsc = rte_zmalloc_socket(NULL,
+					pcap_pkt_count * sizeof(uint64_t), 0,
+					dev->device->numa_node);
+			if (pcap_q->replay_tsc == NULL) {
+				infinite_rx_ring_free(pcap_q->pkts);
+				pcap_q->pkts = NULL;
+				return -ENOMEM;
+			}
+		}
+
 		/* Fill ring with packets from PCAP file one by one. */
-		while (eth_pcap_rx(pcap_q, bufs, 1)) {
-			/* Check for multiseg mbufs. */
-			if (bufs[0]->nb_segs != 1) {
+		while (1) {
+			struct pcap_pkthdr header;
+			const u_char *packet;
+			struct rte_mbuf *mbuf;
+
+			packet = pcap_next(*pcap, &header);
+			if (packet == NULL)
+				break;
+
+			mbuf = rte_pktmbuf_alloc(pcap_q->mb_pool);
+			if (mbuf == NULL)
+				break;
+
+			/* Multiseg packets are not supported. */
+			if (header.caplen > rte_pktmbuf_tailroom(mbuf)) {
+				rte_pktmbuf_free(mbuf);
 				infinite_rx_ring_free(pcap_q->pkts);
+				pcap_q->pkts = NULL;
+				rte_free(pcap_q->replay_tsc);
+				pcap_q->replay_tsc = NULL;
 				PMD_LOG(ERR,
 					"Multiseg mbufs are not supported in infinite_rx mode.");
 				return -EINVAL;
 			}
 
+			rte_memcpy(rte_pktmbuf_mtod(mbuf, void *), packet,
+					header.caplen);
+			mbuf->data_len = (uint16_t)header.caplen;
+			mbuf->pkt_len = mbuf->data_len;
+			mbuf->port = pcap_q->port_id;
+
+			/* Record the capture time offset for paced replay. */
+			if (pcap_q->replay_tsc != NULL) {
+				if (pcap_q->replay_n_pkts == 0)
+					replay_ts_first = header.ts;
+				pcap_q->replay_tsc[pcap_q->replay_n_pkts++] =
+					replay_offset_cycles(&replay_ts_first,
+							     &header.ts);
+			}
+
 			rte_ring_enqueue_bulk(pcap_q->pkts,
-					(void * const *)bufs, 1, NULL);
+					(void * const *)&mbuf, 1, NULL);
 		}
 
 		if (rte_ring_count(pcap_q->pkts) < pcap_pkt_count) {
 			infinite_rx_ring_free(pcap_q->pkts);
+			pcap_q->pkts = NULL;
+			rte_free(pcap_q->replay_tsc);
+			pcap_q->replay_tsc = NULL;
 			PMD_LOG(ERR,
 				"Not enough mbufs to accommodate packets in pcap file. "
 				"At least %" PRIu64 " mbufs per queue is required.",
 				pcap_pkt_count);
 			return -EINVAL;
 		}
-
-		/*
-		 * Reset the stats for this queue since eth_pcap_rx calls above
-		 * didn't result in the application receiving packets.
-		 */
-		pcap_q->rx_stat.pkts = 0;
-		pcap_q->rx_stat.bytes = 0;
 	}
 
 	return 0;
@@ -1353,9 +1478,11 @@ eth_from_pcaps(struct rte_vdev_device *vdev,
 	}
 
 	internals->infinite_rx = infinite_rx;
+	internals->replay_timing = devargs_all->replay_timing;
 	/* Assign rx ops. */
 	if (infinite_rx)
-		eth_dev->rx_pkt_burst = eth_pcap_rx_infinite;
+		eth_dev->rx_pkt_burst = devargs_all->replay_timing ?
+			eth_pcap_rx_replay : eth_pcap_rx_infinite;
 	else if (devargs_all->is_rx_pcap || devargs_all->is_rx_iface ||
 			single_iface)
 		eth_dev->rx_pkt_burst = eth_pcap_rx;
@@ -1417,6 +1544,7 @@ pmd_pcap_probe(struct rte_vdev_device *dev)
 		.is_tx_pcap = 0,
 		.is_tx_iface = 0,
 		.infinite_rx = 0,
+		.replay_timing = 0,
 	};
 
 	name = rte_vdev_device_name(dev);
@@ -1520,6 +1648,26 @@ pmd_pcap_probe(struct rte_vdev_device *dev)
 					"for %s", name);
 		}
 
+		if (rte_kvargs_count(kvlist, ETH_PCAP_REPLAY_TIMING_ARG) == 1) {
+			ret = rte_kvargs_process(kvlist,
+					ETH_PCAP_REPLAY_TIMING_ARG,
+					&get_infinite_rx_arg,
+					&devargs_all.replay_timing);
+			if (ret < 0)
+				goto free_kvlist;
+
+			if (devargs_all.replay_timing &&
+					!devargs_all.infinite_rx) {
+				PMD_LOG(ERR, "replay_timing requires infinite_rx for %s",
+						name);
+				ret = -EINVAL;
+				goto free_kvlist;
+			}
+			PMD_LOG(INFO, "replay_timing has been %s for %s",
+					devargs_all.replay_timing ? "enabled" : "disabled",
+					name);
+		}
+
 		ret = rte_kvargs_process(kvlist, ETH_PCAP_RX_PCAP_ARG,
 				&open_rx_pcap, &pcaps);
 	} else if (devargs_all.is_rx_iface) {
@@ -1660,4 +1808,5 @@ RTE_PMD_REGISTER_PARAM_STRING(net_pcap,
 	ETH_PCAP_TX_IFACE_ARG "=<ifc> "
 	ETH_PCAP_IFACE_ARG "=<ifc> "
 	ETH_PCAP_PHY_MAC_ARG "=<int>"
-	ETH_PCAP_INFINITE_RX_ARG "=<0|1>");
+	ETH_PCAP_INFINITE_RX_ARG "=<0|1> "
+	ETH_PCAP_REPLAY_TIMING_ARG "=<0|1>");
@@ -1164,7 +1164,7 @@ ipsec_event_port_flush(uint8_t eventdev_id __rte_unused, struct rte_event ev,
 }
 
 /* Workers registered */
-#define IPSEC_EVENTMODE_WORKERS		2
+#define IPSEC_EVENTMODE_WORKERS		4
 
 static void
 ipsec_ip_reassembly_dyn_offset_get(void)
@@ -1309,6 +1309,136 @@ ipsec_wrkr_non_burst_int_port_drv_mode(struct eh_event_link_info *links,
 			       ipsec_event_port_flush, NULL);
 }
 
+/*
+ * Event mode worker
+ * Operating parameters : burst - Tx internal port - driver mode
+ */
+static void
+ipsec_wrkr_burst_int_port_drv_mode(struct eh_event_link_info *links,
+		uint8_t nb_links)
+{
+	struct port_drv_mode_data data[RTE_MAX_ETHPORTS];
+	struct rte_event ev[MAX_PKT_BURST];
+	uint16_t nb_deq, nb_fwd, nb_tx, i;
+	struct rte_mbuf *pkt;
+	uint32_t lcore_id;
+	int32_t socket_id;
+	int16_t port_id;
+
+	/* Check if we have links registered for this lcore */
+	if (nb_links == 0) {
+		/* No links registered - exit */
+		return;
+	}
+
+	memset(&data, 0, sizeof(struct port_drv_mode_data));
+
+	/* Get core ID */
+	lcore_id = rte_lcore_id();
+
+	/* Get socket ID */
+	socket_id = rte_lcore_to_socket_id(lcore_id);
+
+	/*
+	 * Prepare security sessions table. In outbound driver mode
+	 * we always use first session configured for a given port
+	 */
+	prepare_out_sessions_tbl(socket_ctx[socket_id].sa_out, data,
+				 RTE_MAX_ETHPORTS);
+
+	RTE_LOG(INFO, IPSEC,
+		"Launching event mode worker (burst - Tx internal port - "
+		"driver mode) on lcore %d\n", lcore_id);
+
+	/* We have valid links */
+
+	/* Check if it's single link */
+	if (nb_links != 1) {
+		RTE_LOG(INFO, IPSEC,
+			"Multiple links not supported. Using first link\n");
+	}
+
+	RTE_LOG(INFO, IPSEC, " -- lcoreid=%u event_port_id=%u\n", lcore_id,
+			links[0].event_port_id);
+	while (!force_quit) {
+		/* Read packets from event queues */
+		nb_deq = rte_event_dequeue_burst(links[0].eventdev_id,
+				links[0].event_port_id,
+				ev,		/* events */
+				MAX_PKT_BURST,	/* nb_events */
+				0		/* timeout_ticks */);
+
+		if (nb_deq == 0)
+			continue;
+
+		/* Compact the events to be forwarded to the front */
+		nb_fwd = 0;
+		for (i = 0; i < nb_deq; i++) {
+			switch (ev[i].event_type) {
+			case RTE_EVENT_TYPE_ETH_RX_ADAPTER_VECTOR:
+			case RTE_EVENT_TYPE_ETHDEV_VECTOR:
+				ipsec_ev_vector_drv_mode_process(links, &ev[i],
+								 data);
+				continue;
+			case RTE_EVENT_TYPE_ETHDEV:
+				break;
+			default:
+				RTE_LOG(ERR, IPSEC, "Invalid event type %u",
+					ev[i].event_type);
+				continue;
+			}
+
+			pkt = ev[i].mbuf;
+			port_id = pkt->port;
+
+			rte_prefetch0(rte_pktmbuf_mtod(pkt, void *));
+
+			/* Process packet */
+			ipsec_event_pre_forward(pkt, port_id);
+
+			if (!is_unprotected_port(port_id)) {
+
+				if (unlikely(!data[port_id].sess)) {
+					rte_pktmbuf_free(pkt);
+					continue;
+				}
+
+				/* Save security session */
+				rte_security_set_pkt_metadata(data[port_id].ctx,
+							      data[port_id].sess,
+							      pkt, NULL);
+
+				/* Mark the packet for Tx security offload */
+				pkt->ol_flags |= RTE_MBUF_F_TX_SEC_OFFLOAD;
+
+				/* Provide L2 len for Outbound processing */
+				pkt->l2_len = RTE_ETHER_HDR_LEN;
+			}
+
+			ev[nb_fwd++] = ev[i];
+		}
+
+		if (nb_fwd == 0)
+			continue;
+
+		/*
+		 * Since tx internal port is available, events can be
+		 * directly enqueued to the adapter and it would be
+		 * internally submitted to the eth device.
+		 */
+		nb_tx = rte_event_eth_tx_adapter_enqueue(links[0].eventdev_id,
+							 links[0].event_port_id,
+							 ev,	 /* events */
+							 nb_fwd, /* nb_events */
+							 0	 /* flags */);
+		for (i = nb_tx; i < nb_fwd; i++)
+			rte_pktmbuf_free(ev[i].mbuf);
+	}
+
+	rte_event_port_quiesce(links[0].eventdev_id, links[0].event_port_id,
+			       ipsec_event_port_flush, NULL);
+}
+
 /*
  * Event mode worker
  * Operating parameters : non-burst - Tx internal port - app mode
@@ -1442,6 +1572,148 @@ ipsec_wrkr_non_burst_int_port_app_mode(struct eh_event_link_info *links,
 			       ipsec_event_port_flush, NULL);
 }
 
+/*
+ * Event mode worker
+ * Operating parameters : burst - Tx internal port - app mode
+ */
+static void
+ipsec_wrkr_burst_int_port_app_mode(struct eh_event_link_info *links,
+		uint8_t nb_links)
+{
+	struct lcore_conf_ev_tx_int_port_wrkr lconf;
+	struct rte_event ev[MAX_PKT_BURST];
+	uint16_t nb_deq, nb_fwd, nb_tx, i;
+	uint32_t lcore_id;
+	int32_t socket_id;
+	int ret;
+
+	/* Check if we have links registered for this lcore */
+	if (nb_links == 0) {
+		/* No links registered - exit */
+		return;
+	}
+
+	/* We have valid links */
+
+	/* Get core ID */
+	lcore_id = rte_lcore_id();
+
+	/* Get socket ID */
+	socket_id = rte_lcore_to_socket_id(lcore_id);
+
+	/* Save routing table */
+	lconf.rt.rt4_ctx = socket_ctx[socket_id].rt_ip4;
+	lconf.rt.rt6_ctx = socket_ctx[socket_id].rt_ip6;
+	lconf.inbound.sp4_ctx = socket_ctx[socket_id].sp_ip4_in;
+	lconf.inbound.sp6_ctx = socket_ctx[socket_id].sp_ip6_in;
+	lconf.inbound.sa_ctx = socket_ctx[socket_id].sa_in;
+	lconf.inbound.lcore_id = lcore_id;
+	lconf.outbound.sp4_ctx = socket_ctx[socket_id].sp_ip4_out;
+	lconf.outbound.sp6_ctx = socket_ctx[socket_id].sp_ip6_out;
+	lconf.outbound.sa_ctx = socket_ctx[socket_id].sa_out;
+	lconf.outbound.ipv4_offloads = tx_offloads.ipv4_offloads;
+	lconf.outbound.ipv6_offloads = tx_offloads.ipv6_offloads;
+	lconf.outbound.lcore_id = lcore_id;
+
+	RTE_LOG(INFO, IPSEC,
+		"Launching event mode worker (burst - Tx internal port - "
+		"app mode) on lcore %d\n", lcore_id);
+
+	ret = ipsec_sad_lcore_cache_init(app_sa_prm.cache_sz);
+	if (ret != 0) {
+		RTE_LOG(ERR, IPSEC,
+			"SAD cache init on lcore %u, failed with code: %d\n",
+			lcore_id, ret);
+		return;
+	}
+
+	/* Check if it's single link */
+	if (nb_links != 1) {
+		RTE_LOG(INFO, IPSEC,
+			"Multiple links not supported. Using first link\n");
+	}
+
+	RTE_LOG(INFO, IPSEC, " -- lcoreid=%u event_port_id=%u\n", lcore_id,
+		links[0].event_port_id);
+
+	ipsec_ip_reassembly_dyn_offset_get();
+
+	while (!force_quit) {
+		/* Read packets from event queues */
+		nb_deq = rte_event_dequeue_burst(links[0].eventdev_id,
+				links[0].event_port_id,
+				ev,		/* events */
+				MAX_PKT_BURST,	/* nb_events */
+				0		/* timeout_ticks */);
+
+		if (nb_deq == 0)
+			continue;
+
+		/* Compact the events to be forwarded to the front */
+		nb_fwd = 0;
+		for (i = 0; i < nb_deq; i++) {
+			switch (ev[i].event_type) {
+			case RTE_EVENT_TYPE_ETH_RX_ADAPTER_VECTOR:
+			case RTE_EVENT_TYPE_ETHDEV_VECTOR:
+				ipsec_ev_vector_process(&lconf, links, &ev[i]);
+				continue;
+			case RTE_EVENT_TYPE_ETHDEV:
+				core_stats_update_rx(1);
+				if (is_unprotected_port(ev[i].mbuf->port))
+					ret = process_ipsec_ev_inbound(
+							&lconf.inbound,
+							&lconf.rt, links,
+							&ev[i]);
+				else
+					ret = process_ipsec_ev_outbound(
+							&lconf.outbound,
+							&lconf.rt, links,
+							&ev[i]);
+				if (ret != 1)
+					/* The pkt has been dropped or posted */
+					continue;
+				break;
+			case RTE_EVENT_TYPE_CRYPTODEV:
+				ret = ipsec_ev_cryptodev_process(&lconf,
+								 &ev[i]);
+				if (unlikely(ret != PKT_FORWARDED))
+					continue;
+				break;
+			case RTE_EVENT_TYPE_CRYPTODEV_VECTOR:
+				ipsec_ev_cryptodev_vector_process(&lconf, links,
+								  &ev[i]);
+				continue;
+			default:
+				RTE_LOG(ERR, IPSEC, "Invalid event type %u",
+					ev[i].event_type);
+				continue;
+			}
+
+			core_stats_update_tx(1);
+			ev[nb_fwd++] = ev[i];
+		}
+
+		if (nb_fwd == 0)
+			continue;
+
+		/*
+		 * Since tx internal port is available, events can be
+		 * directly enqueued to the adapter and it would be
+		 * internally submitted to the eth device.
+		 */
+		nb_tx = rte_event_eth_tx_adapter_enqueue(links[0].eventdev_id,
+							 links[0].event_port_id,
+							 ev,	 /* events */
+							 nb_fwd, /* nb_events */
+							 0	 /* flags */);
+		for (i = nb_tx; i < nb_fwd; i++)
+			rte_pktmbuf_free(ev[i].mbuf);
+	}
+
+	rte_event_port_quiesce(links[0].eventdev_id, links[0].event_port_id,
+			       ipsec_event_port_flush, NULL);
+}
+
 static uint8_t
 ipsec_eventmode_populate_wrkr_params(struct eh_app_worker_params *wrkrs)
 {
@@ -1464,6 +1736,22 @@ ipsec_eventmode_populate_wrkr_params(struct eh_app_worker_params *wrkrs)
 	wrkr->cap.tx_internal_port = EH_TX_TYPE_INTERNAL_PORT;
 	wrkr->cap.ipsec_mode = EH_IPSEC_MODE_TYPE_APP;
 	wrkr->worker_thread = ipsec_wrkr_non_burst_int_port_app_mode;
+	wrkr++;
+	nb_wrkr_param++;
+
+	/* Burst - Tx internal port - driver mode */
+	wrkr->cap.burst = EH_RX_TYPE_BURST;
+	wrkr->cap.tx_internal_port = EH_TX_TYPE_INTERNAL_PORT;
+	wrkr->cap.ipsec_mode = EH_IPSEC_MODE_TYPE_DRIVER;
+	wrkr->worker_thread = ipsec_wrkr_burst_int_port_drv_mode;
+	wrkr++;
+	nb_wrkr_param++;
+
+	/* Burst - Tx internal port - app mode */
+	wrkr->cap.burst = EH_RX_TYPE_BURST;
+	wrkr->cap.tx_internal_port = EH_TX_TYPE_INTERNAL_PORT;
+	wrkr->cap.ipsec_mode = EH_IPSEC_MODE_TYPE_APP;
+	wrkr->worker_thread = ipsec_wrkr_burst_int_port_app_mode;
 	nb_wrkr_param++;
 
 	return nb_wrkr_param;
@@ -119,6 +119,10 @@ extern uint32_t max_pkt_len;
 extern uint32_t nb_pkt_per_burst;
 extern uint32_t mb_mempool_cache_size;
 
+/* FIB route-scale benchmark, 0 flows means disabled. */
+extern uint32_t fib_bench_nb_flows;
+extern double fib_bench_theta;
+
 /* Send burst of packets on an output interface */
 static inline int
 send_burst(struct lcore_conf *qconf, uint16_t n, uint16_t port)
@@ -235,6 +239,10 @@ setup_hash(const int socketid);
 void
 setup_fib(const int socketid);
 
+/* Run the FIB route-scale lookup benchmark instead of forwarding. */
+int
+fib_benchmark(const int socketid);
+
 int
 em_check_ptype(int portid);
 
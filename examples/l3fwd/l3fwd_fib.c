@@ -2,14 +2,22 @@
  * Copyright(c) 2021 Intel Corporation
  */
 
+#include <inttypes.h>
+#include <math.h>
 #include <stdio.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <sys/socket.h>
 #include <arpa/inet.h>
 
+#include <rte_cycles.h>
 #include <rte_fib.h>
 #include <rte_fib6.h>
+#include <rte_random.h>
+#ifdef RTE_LIB_PMU
+#include <rte_pmu.h>
+#endif
 
 #include "l3fwd.h"
 #if defined RTE_ARCH_X86
@@ -763,6 +771,130 @@ setup_fib(const int socketid)
 	}
 }
 
+/* Route-scale benchmark configuration, set from the command line. */
+uint32_t fib_bench_nb_flows;
+double fib_bench_theta = 0.99;
+
+#define FIB_BENCH_BURST 64
+#define FIB_BENCH_LOOKUPS (1u << 25)
+
+/* Draw a prefix rank from the Zipf CDF for a uniform sample in [0, sum). */
+static uint32_t
+fib_bench_pick_prefix(const double *cdf, uint32_t nb_prefixes, double r)
+{
+	uint32_t lo = 0, hi = nb_prefixes - 1, mid;
+
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		if (cdf[mid] < r)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return lo;
+}
+
+/* Run bulk lookups over a synthetic flow set drawn Zipf-distributed from
+ * the installed IPv4 prefixes and report the lookup rate, plus LLC misses
+ * when the PMU library is available.
+ */
+int
+fib_benchmark(const int socketid)
+{
+	struct rte_fib *fib = ipv4_l3fwd_fib_lookup_struct[socketid];
+	uint64_t hops[FIB_BENCH_BURST];
+	uint64_t start, cycles, n;
+	uint64_t misses = 0;
+	uint32_t i, idx, mask, pos = 0;
+	double *cdf, sum = 0.;
+	uint32_t *flows;
+	uint8_t depth;
+	int pmu_idx = -1;
+
+	if (fib == NULL)
+		fib = ipv4_l3fwd_fib_lookup_struct[0];
+	if (fib == NULL || route_num_v4 <= 0) {
+		fprintf(stderr, "fib-bench: no IPv4 FIB routes installed\n");
+		return -1;
+	}
+
+	if (fib_bench_nb_flows < FIB_BENCH_BURST)
+		fib_bench_nb_flows = FIB_BENCH_BURST;
+
+	cdf = malloc(route_num_v4 * sizeof(*cdf));
+	flows = malloc((size_t)fib_bench_nb_flows * sizeof(*flows));
+	if (cdf == NULL || flows == NULL) {
+		fprintf(stderr, "fib-bench: no memory for the flow set\n");
+		free(cdf);
+		free(flows);
+		return -1;
+	}
+
+	/* Zipf CDF over the installed prefixes: rank k weighs k^-theta, so
+	 * theta 0 spreads flows uniformly and larger values concentrate
+	 * them on the first prefixes of the route file.
+	 */
+	for (i = 0; i < (uint32_t)route_num_v4; i++) {
+		sum += pow(i + 1, -fib_bench_theta);
+		cdf[i] = sum;
+	}
+
+	/* each flow is a random host address within its drawn prefix */
+	for (i = 0; i < fib_bench_nb_flows; i++) {
+		idx = fib_bench_pick_prefix(cdf, route_num_v4,
+				rte_drand() * sum);
+		depth = route_base_v4[idx].depth;
+		mask = depth < 32 ? (uint32_t)((1ULL << (32 - depth)) - 1) : 0;
+		flows[i] = (route_base_v4[idx].ip & ~mask) |
+			((uint32_t)rte_rand() & mask);
+	}
+
+#ifdef RTE_LIB_PMU
+	if (rte_pmu_init() == 0) {
+		pmu_idx = rte_pmu_add_event("cache-misses");
+		if (pmu_idx >= 0)
+			misses = rte_pmu_read(pmu_idx);
+	}
+#endif
+
+	start = rte_get_tsc_cycles();
+	for (n = 0; n < FIB_BENCH_LOOKUPS; n += FIB_BENCH_BURST) {
+		rte_fib_lookup_bulk(fib, &flows[pos], hops, FIB_BENCH_BURST);
+		pos += FIB_BENCH_BURST;
+		if (pos + FIB_BENCH_BURST > fib_bench_nb_flows)
+			pos = 0;
+	}
+	cycles = rte_get_tsc_cycles() - start;
+
+#ifdef RTE_LIB_PMU
+	if (pmu_idx >= 0)
+		misses = rte_pmu_read(pmu_idx) - misses;
+#endif
+
+	printf("FIB benchmark: %d routes, %u flows, zipf theta %.2f\n",
+	       route_num_v4, fib_bench_nb_flows, fib_bench_theta);
+	printf("  %u lookups in %.3f s: %.2f Mlookups/s\n",
+	       FIB_BENCH_LOOKUPS,
+	       (double)cycles / rte_get_tsc_hz(),
+	       (double)FIB_BENCH_LOOKUPS * rte_get_tsc_hz() /
+	       ((double)cycles * 1e6));
+	if (pmu_idx >= 0)
+		printf("  LLC misses: %" PRIu64 " (%.3f per lookup)\n",
+		       misses, (double)misses / FIB_BENCH_LOOKUPS);
+	else
+		printf("  LLC misses: unavailable (PMU not usable)\n");
+
+#ifdef RTE_LIB_PMU
+	if (pmu_idx >= 0)
+		rte_pmu_fini();
+#endif
+	free(cdf);
+	free(flows);
+
+	return 0;
+}
+
 /* Return ipv4 fib lookup struct. */
 void *
 fib_get_ipv4_l3fwd_lookup_struct(const int socketid)
@@ -459,7 +459,12 @@ print_usage(const char *prgname)
 		"                    One is ACL entry at while line leads with character '%c',\n"
 		"                    another is route entry at while line leads with character '%c'.\n"
 		"  --rule_ipv6=FILE: Specify the ipv6 rules entries file.\n"
-		"  --alg: ACL classify method to use, one of: %s.\n\n",
+		"  --alg: ACL classify method to use, one of: %s.\n"
+		"  --fib-bench=FLOWS[,THETA]: Run a FIB route-scale lookup benchmark\n"
+		"                    instead of forwarding and exit. FLOWS synthetic\n"
+		"                    destinations are drawn Zipf-distributed over the\n"
+		"                    installed prefixes with exponent THETA (default 0.99).\n"
+		"                    Requires --lookup=fib.\n\n",
 		prgname, RX_DESC_DEFAULT, TX_DESC_DEFAULT, DEFAULT_PKT_BURST, MEMPOOL_CACHE_SIZE,
 		ACL_LEAD_CHAR, ROUTE_LEAD_CHAR, alg);
 }
@@ -694,6 +699,29 @@ parse_mbcache_size(const char *optarg)
 			 RTE_MEMPOOL_CACHE_MAX_SIZE);
 }
 
+static int
+parse_fib_bench(const char *optarg)
+{
+	unsigned long flows;
+	double theta;
+	char *end = NULL;
+
+	flows = strtoul(optarg, &end, 10);
+	if ((optarg[0] == '\0') || (end == NULL) || flows == 0 ||
+	    flows > (1u << 28))
+		return -1;
+	if (*end == ',') {
+		theta = strtod(end + 1, &end);
+		if (end == NULL || *end != '\0' || theta < 0.)
+			return -1;
+		fib_bench_theta = theta;
+	} else if (*end != '\0')
+		return -1;
+
+	fib_bench_nb_flows = (uint32_t)flows;
+	return 0;
+}
+
 static void
 parse_pkt_burst(const char *optarg)
 {
@@ -770,6 +798,7 @@ static const char short_options[] =
 #define CMD_LINE_OPT_ALG "alg"
 #define CMD_LINE_OPT_PKT_BURST "burst"
 #define CMD_LINE_OPT_MB_CACHE_SIZE "mbcache"
+#define CMD_LINE_OPT_FIB_BENCH "fib-bench"
 
 enum {
 	/* long options mapped to a short option */
@@ -801,6 +830,7 @@ enum {
 	CMD_LINE_OPT_VECTOR_TMO_NS_NUM,
 	CMD_LINE_OPT_PKT_BURST_NUM,
 	CMD_LINE_OPT_MB_CACHE_SIZE_NUM,
+	CMD_LINE_OPT_FIB_BENCH_NUM,
 };
 
 static const struct option lgopts[] = {
@@ -829,6 +859,7 @@ static const struct option lgopts[] = {
 	{CMD_LINE_OPT_ALG,   1, 0, CMD_LINE_OPT_ALG_NUM},
 	{CMD_LINE_OPT_PKT_BURST,   1, 0, CMD_LINE_OPT_PKT_BURST_NUM},
 	{CMD_LINE_OPT_MB_CACHE_SIZE,   1, 0, CMD_LINE_OPT_MB_CACHE_SIZE_NUM},
+	{CMD_LINE_OPT_FIB_BENCH,   1, 0, CMD_LINE_OPT_FIB_BENCH_NUM},
 	{NULL, 0, 0, 0}
 };
 
@@ -925,6 +956,14 @@ parse_args(int argc, char **argv)
 			parse_mbcache_size(optarg);
 			break;
 
+		case CMD_LINE_OPT_FIB_BENCH_NUM:
+			if (parse_fib_bench(optarg) != 0) {
+				fprintf(stderr, "Invalid fib-bench parameters\n");
+				print_usage(prgname);
+				return -1;
+			}
+			break;
+
 		case CMD_LINE_OPT_ETH_DEST_NUM:
 			parse_eth_dest(optarg);
 			break;
@@ -1727,8 +1766,16 @@ main(int argc, char **argv)
 	check_all_ports_link_status(enabled_port_mask);
 
 	ret = 0;
-	/* launch per-lcore init on every lcore */
-	rte_eal_mp_remote_launch(l3fwd_lkp.main_loop, NULL, CALL_MAIN);
+	if (fib_bench_nb_flows != 0) {
+		if (lookup_mode != L3FWD_LOOKUP_FIB)
+			rte_exit(EXIT_FAILURE,
+				"--fib-bench requires --lookup=fib\n");
+		/* route-scale benchmark run, no traffic is forwarded */
+		ret = fib_benchmark(rte_socket_id());
+	} else {
+		/* launch per-lcore init on every lcore */
+		rte_eal_mp_remote_launch(l3fwd_lkp.main_loop, NULL, CALL_MAIN);
+	}
 
 #ifdef RTE_LIB_EVENTDEV
 	if (evt_rsrc->enabled) {
@@ -164,6 +164,56 @@ app_pkt_handle(struct rte_mbuf *pkt, uint64_t time)
 	return action;
 }
 
+#ifdef FUNC_METER_BULK
+
+/* Meter a run of consecutive packets of the same flow with a single bulk
+ * call, so the meter time stamp read and token bucket update are amortized
+ * over the run. Returns the number of packets consumed from the burst.
+ */
+static inline int
+app_pkt_handle_bulk(struct rte_mbuf **pkts, int n_pkts, uint64_t time)
+{
+	uint32_t pkt_len[RTE_MBUF_F_RX_BURST_MAX];
+	enum rte_color output_color[RTE_MBUF_F_RX_BURST_MAX];
+	uint8_t *pkt_data = rte_pktmbuf_mtod(pkts[0], uint8_t *);
+	uint8_t flow_id = (uint8_t)(pkt_data[APP_PKT_FLOW_POS] & (APP_FLOWS_MAX - 1));
+	int i, n;
+
+	for (n = 0; n < n_pkts; n++) {
+		pkt_data = rte_pktmbuf_mtod(pkts[n], uint8_t *);
+
+		if ((uint8_t)(pkt_data[APP_PKT_FLOW_POS] & (APP_FLOWS_MAX - 1))
+				!= flow_id)
+			break;
+
+		pkt_len[n] = rte_pktmbuf_pkt_len(pkts[n]) -
+			sizeof(struct rte_ether_hdr);
+	}
+
+	FUNC_METER_BULK(&app_flows[flow_id], &PROFILE, time, pkt_len,
+		output_color, n);
+
+	/* Apply policing and set the output color */
+	for (i = 0; i < n; i++) {
+		uint8_t input_color;
+		enum policer_action action;
+
+		pkt_data = rte_pktmbuf_mtod(pkts[i], uint8_t *);
+		input_color = pkt_data[APP_PKT_COLOR_POS];
+		action = policer_table[input_color][output_color[i]];
+		app_set_pkt_color(pkt_data, action);
+
+		if (action == DROP)
+			rte_pktmbuf_free(pkts[i]);
+		else
+			rte_eth_tx_buffer(port_tx, NIC_TX_QUEUE, tx_buffer,
+				pkts[i]);
+	}
+
+	return n;
+}
+
+#endif /* FUNC_METER_BULK */
 
 static __rte_noreturn int
 main_loop(__rte_unused void *dummy)
@@ -190,6 +240,11 @@ main_loop(__rte_unused void *dummy)
 		nb_rx = rte_eth_rx_burst(port_rx, NIC_RX_QUEUE, pkts_rx, RTE_MBUF_F_RX_BURST_MAX);
 
 		/* Handle packets */
+#ifdef FUNC_METER_BULK
+		for (i = 0; i < nb_rx; )
+			i += app_pkt_handle_bulk(&pkts_rx[i], nb_rx - i,
+				current_time);
+#else
 		for (i = 0; i < nb_rx; i ++) {
 			struct rte_mbuf *pkt = pkts_rx[i];
 
@@ -199,6 +254,7 @@ main_loop(__rte_unused void *dummy)
 			else
 				rte_eth_tx_buffer(port_tx, NIC_TX_QUEUE, tx_buffer, pkt);
 		}
+#endif
 	}
 }
 
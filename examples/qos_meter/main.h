@@ -41,6 +41,9 @@ __extension__ ({					\
 
 #define FUNC_METER(m, p, time, pkt_len, pkt_color)	\
 	rte_meter_srtcm_color_blind_check(m, p, time, pkt_len)
+#define FUNC_METER_BULK(m, p, time, pkt_len, pkt_color, n_pkts)	\
+	rte_meter_srtcm_color_blind_check_bulk(m, p, time, pkt_len, \
+		pkt_color, n_pkts)
 #define FUNC_CONFIG   rte_meter_srtcm_config
 #define FLOW_METER    struct rte_meter_srtcm
 #define PROFILE       app_srtcm_profile
@@ -56,6 +59,9 @@ __extension__ ({					\
 
 #define FUNC_METER(m, p, time, pkt_len, pkt_color)	\
 	rte_meter_trtcm_color_blind_check(m, p, time, pkt_len)
+#define FUNC_METER_BULK(m, p, time, pkt_len, pkt_color, n_pkts)	\
+	rte_meter_trtcm_color_blind_check_bulk(m, p, time, pkt_len, \
+		pkt_color, n_pkts)
 #define FUNC_CONFIG  rte_meter_trtcm_config
 #define FLOW_METER   struct rte_meter_trtcm
 #define PROFILE      app_trtcm_profile
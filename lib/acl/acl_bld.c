@@ -1347,7 +1347,7 @@ build_one_trie(struct acl_build_context *context,
 
 static int
 acl_build_tries(struct acl_build_context *context,
-	struct rte_acl_build_rule *head)
+	struct rte_acl_build_rule *head, uint32_t first)
 {
 	uint32_t n, num_tries;
 	struct rte_acl_config *config;
@@ -1355,21 +1355,21 @@ acl_build_tries(struct acl_build_context *context,
 	struct rte_acl_build_rule *rule_sets[RTE_ACL_MAX_TRIES];
 
 	config = head->config;
-	rule_sets[0] = head;
+	rule_sets[first] = head;
 
-	/* initialize tries */
-	for (n = 0; n < RTE_DIM(context->tries); n++) {
+	/* initialize tries, keeping those built by previous invocations */
+	for (n = first; n < RTE_DIM(context->tries); n++) {
 		context->tries[n].type = RTE_ACL_UNUSED_TRIE;
 		context->bld_tries[n].trie = NULL;
 		context->tries[n].count = 0;
 	}
 
-	context->tries[0].type = RTE_ACL_FULL_TRIE;
+	context->tries[first].type = RTE_ACL_FULL_TRIE;
 
 	/* calc wildness of each field of each rule */
 	acl_calc_wildness(head, config);
 
-	for (n = 0;; n = num_tries) {
+	for (n = first;; n = num_tries) {
 
 		num_tries = n + 1;
 
@@ -1444,7 +1444,7 @@ acl_build_log(const struct acl_build_context *ctx)
 }
 
 static int
-acl_build_rules(struct acl_build_context *bcx)
+acl_build_rules(struct acl_build_context *bcx, uint32_t first)
 {
 	struct rte_acl_build_rule *br, *head;
 	const struct rte_acl_rule *rule;
@@ -1453,7 +1453,7 @@ acl_build_rules(struct acl_build_context *bcx)
 	size_t ofs, sz;
 
 	fn = bcx->cfg.num_fields;
-	n = bcx->acx->num_rules;
+	n = bcx->acx->num_rules - first;
 	ofs = n * sizeof(*br);
 	sz = ofs + n * fn * sizeof(*wp);
 
@@ -1465,7 +1465,8 @@ acl_build_rules(struct acl_build_context *bcx)
 
 	for (i = 0; i != n; i++) {
 		rule = (const struct rte_acl_rule *)
-			((uintptr_t)bcx->acx->rules + bcx->acx->rule_sz * i);
+			((uintptr_t)bcx->acx->rules +
+			bcx->acx->rule_sz * (first + i));
 		if ((rule->data.category_mask & bcx->category_mask) != 0) {
 			br[num].next = head;
 			br[num].config = &bcx->cfg;
@@ -1534,7 +1535,7 @@ acl_bld(struct acl_build_context *bcx, struct rte_acl_ctx *ctx,
 	}
 
 	/* Create a build rules copy. */
-	rc = acl_build_rules(bcx);
+	rc = acl_build_rules(bcx, 0);
 	if (rc != 0)
 		return rc;
 
@@ -1543,7 +1544,7 @@ acl_bld(struct acl_build_context *bcx, struct rte_acl_ctx *ctx,
 		rc = -EINVAL;
 	} else {
 		/* build internal trie representation. */
-		rc = acl_build_tries(bcx, bcx->build_rules);
+		rc = acl_build_tries(bcx, bcx->build_rules, 0);
 	}
 	return rc;
 }
@@ -1635,6 +1636,9 @@ rte_acl_build(struct rte_acl_ctx *ctx, const struct rte_acl_config *cfg)
 	if (rc != 0)
 		return rc;
 
+	/* a full rebuild invalidates any retained incremental build state */
+	acl_build_incr_cleanup(ctx);
+
 	acl_build_reset(ctx);
 
 	if (cfg->max_size == 0) {
@@ -1676,3 +1680,154 @@ rte_acl_build(struct rte_acl_ctx *ctx, const struct rte_acl_config *cfg)
 
 	return rc;
 }
+
+/*
+ * Free build state retained by rte_acl_build_incremental().
+ */
+void
+acl_build_incr_cleanup(struct rte_acl_ctx *ctx)
+{
+	struct acl_build_context *bcx = ctx->bld_ctx;
+
+	if (bcx == NULL)
+		return;
+	tb_free_pool(&bcx->pool);
+	rte_free(bcx);
+	ctx->bld_ctx = NULL;
+	ctx->bld_rules = 0;
+}
+
+/*
+ * Check that the build config matches the one the retained build state
+ * was created with, so that delta rules can share its field definitions.
+ */
+static int
+acl_incr_cfg_compatible(const struct rte_acl_config *a,
+	const struct rte_acl_config *b)
+{
+	return a->num_categories == b->num_categories &&
+		a->num_fields == b->num_fields &&
+		memcmp(a->defs, b->defs,
+			a->num_fields * sizeof(a->defs[0])) == 0;
+}
+
+/*
+ * Full build that retains the build context (tries and memory pool),
+ * so that follow-up rule additions can be built incrementally.
+ */
+static int
+acl_build_incr_full(struct rte_acl_ctx *ctx, const struct rte_acl_config *cfg)
+{
+	int32_t rc;
+	struct acl_build_context *bcx;
+
+	acl_build_incr_cleanup(ctx);
+
+	bcx = rte_zmalloc_socket(ctx->name, sizeof(*bcx),
+		RTE_CACHE_LINE_SIZE, ctx->socket_id);
+	if (bcx == NULL)
+		return -ENOMEM;
+
+	acl_build_reset(ctx);
+
+	rc = acl_bld(bcx, ctx, cfg, NODE_MIN);
+	if (rc == 0)
+		rc = rte_acl_gen(ctx, bcx->tries, bcx->bld_tries,
+			bcx->num_tries, bcx->cfg.num_categories,
+			ACL_MAX_INDEXES * RTE_DIM(bcx->tries) *
+			sizeof(ctx->data_indexes[0]), SIZE_MAX);
+
+	acl_build_log(bcx);
+
+	if (rc != 0) {
+		tb_free_pool(&bcx->pool);
+		rte_free(bcx);
+		return rc;
+	}
+
+	acl_set_data_indexes(ctx);
+	ctx->first_load_sz = get_first_load_size(cfg);
+	ctx->config = *cfg;
+	ctx->bld_ctx = bcx;
+	ctx->bld_rules = ctx->num_rules;
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_acl_build_incremental, 25.07)
+int
+rte_acl_build_incremental(struct rte_acl_ctx *ctx,
+	const struct rte_acl_config *cfg)
+{
+	int32_t rc;
+	struct acl_build_context *bcx;
+
+	rc = acl_check_bld_param(ctx, cfg);
+	if (rc != 0)
+		return rc;
+
+	/* RT size bound needs the node_max halving retry loop. */
+	if (cfg->max_size != 0)
+		return -ENOTSUP;
+
+	bcx = ctx->bld_ctx;
+
+	/*
+	 * Fall back to a full (state retaining) build when there is no
+	 * retained state, the config changed, rules were reset, or all
+	 * tries are already in use.
+	 */
+	if (bcx == NULL || ctx->bld_rules > ctx->num_rules ||
+			!acl_incr_cfg_compatible(&bcx->cfg, cfg) ||
+			bcx->num_tries == RTE_DIM(bcx->tries))
+		return acl_build_incr_full(ctx, cfg);
+
+	/* RT structures are up to date. */
+	if (ctx->bld_rules == ctx->num_rules)
+		return 0;
+
+	rc = sigsetjmp(bcx->pool.fail, 0);
+
+	/* build phase runs out of memory. */
+	if (rc != 0) {
+		ACL_LOG(ERR,
+			"ACL context: %s, %s() failed with error code: %d",
+			ctx->name, __func__, rc);
+		acl_build_incr_cleanup(ctx);
+		return rc;
+	}
+
+	/* copy only the rules added since the last build. */
+	rc = acl_build_rules(bcx, ctx->bld_rules);
+	if (rc != 0)
+		return rc;
+
+	/* all new rules are filtered out by the category mask. */
+	if (bcx->build_rules == NULL) {
+		ctx->bld_rules = ctx->num_rules;
+		return 0;
+	}
+
+	/* build the delta rules into fresh trie(s) after the retained ones. */
+	rc = acl_build_tries(bcx, bcx->build_rules, bcx->num_tries);
+	if (rc == 0) {
+		/* regenerate run-time structures from all tries. */
+		acl_build_reset(ctx);
+		rc = rte_acl_gen(ctx, bcx->tries, bcx->bld_tries,
+			bcx->num_tries, bcx->cfg.num_categories,
+			ACL_MAX_INDEXES * RTE_DIM(bcx->tries) *
+			sizeof(ctx->data_indexes[0]), SIZE_MAX);
+	}
+
+	acl_build_log(bcx);
+
+	if (rc != 0) {
+		acl_build_incr_cleanup(ctx);
+		return rc;
+	}
+
+	acl_set_data_indexes(ctx);
+	ctx->first_load_sz = get_first_load_size(cfg);
+	ctx->config = *cfg;
+	ctx->bld_rules = ctx->num_rules;
+	return 0;
+}
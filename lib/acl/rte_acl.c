@@ -3,6 +3,7 @@
  */
 
 #include <eal_export.h>
+#include <rte_bitops.h>
 #include <rte_eal_memconfig.h>
 #include <rte_string_fns.h>
 #include <rte_acl.h>
@@ -309,6 +310,61 @@ rte_acl_classify(const struct rte_acl_ctx *ctx, const uint8_t **data,
 		ctx->alg);
 }
 
+/* number of flows classified per iteration by rte_acl_classify_categories */
+#define ACL_CAT_BURST	32
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_acl_classify_categories, 25.07)
+int
+rte_acl_classify_categories(const struct rte_acl_ctx *ctx,
+	const uint8_t **data, uint32_t *results, uint32_t num,
+	uint32_t category_mask)
+{
+	uint32_t tmp[ACL_CAT_BURST * RTE_ACL_MAX_CATEGORIES];
+	uint32_t i, j, k, m, n, ncat, nres;
+	int rc;
+
+	if (ctx == NULL || data == NULL || results == NULL ||
+			category_mask == 0 ||
+			(category_mask & ~RTE_LEN2MASK(ctx->num_categories,
+			typeof(category_mask))) != 0)
+		return -EINVAL;
+
+	/*
+	 * Categories above the highest requested one are skipped by the
+	 * search entirely, that is where the cycles are saved.
+	 */
+	ncat = sizeof(category_mask) * CHAR_BIT - rte_clz32(category_mask);
+	if (ncat != 1)
+		ncat = RTE_ALIGN_CEIL(ncat, RTE_ACL_RESULTS_MULTIPLIER);
+
+	/* requested categories are exactly the first ncat ones. */
+	if (category_mask == RTE_LEN2MASK(ncat, typeof(category_mask)))
+		return rte_acl_classify_alg(ctx, data, results, num, ncat,
+			ctx->alg);
+
+	/*
+	 * Sparse mask: classify into a scratch buffer per burst and
+	 * compact the requested categories into the dense results array.
+	 */
+	nres = rte_popcount32(category_mask);
+
+	for (n = 0; n != num; n += i) {
+		i = RTE_MIN(num - n, (uint32_t)ACL_CAT_BURST);
+		rc = rte_acl_classify_alg(ctx, data + n, tmp, i, ncat,
+			ctx->alg);
+		if (rc != 0)
+			return rc;
+		for (j = 0; j != i; j++) {
+			k = 0;
+			for (m = category_mask; m != 0; m &= m - 1)
+				results[(n + j) * nres + k++] =
+					tmp[j * ncat + rte_ctz32(m)];
+		}
+	}
+
+	return 0;
+}
+
 RTE_EXPORT_SYMBOL(rte_acl_find_existing)
 struct rte_acl_ctx *
 rte_acl_find_existing(const char *name)
@@ -362,6 +418,7 @@ rte_acl_free(struct rte_acl_ctx *ctx)
 
 	rte_mcfg_tailq_write_unlock();
 
+	acl_build_incr_cleanup(ctx);
 	rte_free(ctx->mem);
 	rte_free(ctx);
 	rte_free(te);
@@ -498,8 +555,11 @@ RTE_EXPORT_SYMBOL(rte_acl_reset_rules)
 void
 rte_acl_reset_rules(struct rte_acl_ctx *ctx)
 {
-	if (ctx != NULL)
+	if (ctx != NULL) {
 		ctx->num_rules = 0;
+		/* retained build state no longer matches the rule set */
+		acl_build_incr_cleanup(ctx);
+	}
 }
 
 /*
@@ -225,6 +225,37 @@ rte_acl_reset_rules(struct rte_acl_ctx *ctx);
 int
 rte_acl_build(struct rte_acl_ctx *ctx, const struct rte_acl_config *cfg);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Analyze set of rules and build required internal run-time structures,
+ * retaining the internal build state so that a subsequent call after
+ * rte_acl_add_rules() only has to build the newly added rules.
+ * The delta rules are built into separate trie(s), so after many small
+ * additions the run-time structures can be slower to search than after
+ * one rte_acl_build(); rebuild with rte_acl_build() periodically to
+ * compact them. Retaining the build state can consume a significant
+ * amount of memory for big rule sets.
+ * This function is not multi-thread safe.
+ *
+ * @param ctx
+ *   ACL context to build.
+ * @param cfg
+ *   Pointer to struct rte_acl_config - defines build parameters.
+ *   Should not set max_size - RT size limitation requires a full build.
+ * @return
+ *   - -ENOMEM if couldn't allocate enough memory.
+ *   - -EINVAL if the parameters are invalid.
+ *   - -ENOTSUP if cfg->max_size is non-zero.
+ *   - Negative error code if operation failed.
+ *   - Zero if operation completed successfully.
+ */
+__rte_experimental
+int
+rte_acl_build_incremental(struct rte_acl_ctx *ctx,
+	const struct rte_acl_config *cfg);
+
 /**
  * Delete all rules from the ACL context and
  * destroy all internal run-time structures.
@@ -285,6 +316,46 @@ rte_acl_classify(const struct rte_acl_ctx *ctx,
 		 uint32_t *results, uint32_t num,
 		 uint32_t categories);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Perform search for a matching ACL rule for each input data buffer,
+ * for a subset of the configured categories only.
+ * Each set bit N in *category_mask* requests the match for category N;
+ * results for the requested categories are stored densely, so results
+ * array should be big enough to hold (popcount(category_mask) * num)
+ * elements. Categories above the highest requested one are skipped by
+ * the search, so masking out high-numbered categories saves classify
+ * cycles; for other masked-out categories only the result store is
+ * elided. If more than one rule is applicable for given input buffer
+ * and given category, then rule with highest priority will be returned
+ * as a match.
+ *
+ * @param ctx
+ *   ACL context to search with.
+ * @param data
+ *   Array of pointers to input data buffers to perform search.
+ *   Note that all fields in input data buffers supposed to be in network
+ *   byte order (MSB).
+ * @param results
+ *   Array of search results, popcount(category_mask) results per each
+ *   input data buffer, ordered by ascending category number.
+ * @param num
+ *   Number of elements in the input data buffers array.
+ * @param category_mask
+ *   Bitmask of categories to search, can't be zero and can't contain
+ *   bits above the number of categories the context was built with.
+ * @return
+ *   zero on successful completion.
+ *   -EINVAL for incorrect arguments.
+ */
+__rte_experimental
+int
+rte_acl_classify_categories(const struct rte_acl_ctx *ctx,
+	const uint8_t **data, uint32_t *results, uint32_t num,
+	uint32_t category_mask);
+
 /**
  * Perform search using specified algorithm for a matching ACL rule for
  * each input data buffer.
@@ -287,6 +287,15 @@ struct rte_bbdev_stats {
 	uint64_t acc_offload_cycles;
 	/** Available number of enqueue batch on that queue. */
 	uint16_t enqueue_depth_avail;
+	/** Number of LDPC decode operations dequeued which terminated early,
+	 *  i.e. converged before reaching the maximum iteration count.
+	 *  Collected by the library at dequeue time.
+	 */
+	uint64_t ldpc_dec_early_term_count;
+	/** Cumulative number of LDPC decoder iterations over dequeued
+	 *  operations. Collected by the library at dequeue time.
+	 */
+	uint64_t ldpc_dec_iter_count;
 };
 
 /**
@@ -870,9 +879,18 @@ rte_bbdev_dequeue_ldpc_dec_ops(uint16_t dev_id, uint16_t queue_id,
 	struct rte_bbdev *dev = &rte_bbdev_devices[dev_id];
 	struct rte_bbdev_queue_data *q_data = &dev->data->queues[queue_id];
 	uint16_t num_ops_dequeued = dev->dequeue_ldpc_dec_ops(q_data, ops, num_ops);
+	uint16_t i;
 	if (num_ops_dequeued > 0)
 		rte_bbdev_trace_dequeue(dev_id, queue_id, (void **)ops, num_ops,
 				num_ops_dequeued, rte_bbdev_op_type_str(RTE_BBDEV_OP_LDPC_DEC));
+	/* Account decoder early termination from the per-op iteration counts */
+	for (i = 0; i < num_ops_dequeued; i++) {
+		const struct rte_bbdev_op_ldpc_dec *ldpc_dec = &ops[i]->ldpc_dec;
+
+		q_data->queue_stats.ldpc_dec_iter_count += ldpc_dec->iter_count;
+		if (ldpc_dec->iter_max > 0 && ldpc_dec->iter_count < ldpc_dec->iter_max)
+			q_data->queue_stats.ldpc_dec_early_term_count++;
+	}
 	return num_ops_dequeued;
 }
 
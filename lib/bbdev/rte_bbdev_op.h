@@ -1120,6 +1120,71 @@ rte_bbdev_dec_op_alloc_bulk(struct rte_mempool *mempool,
 	return rte_mempool_get_bulk(mempool, (void **)ops, num_ops);
 }
 
+/** Per code block data for template based LDPC decode operation build.
+ *
+ * Compact form of the fields which differ between the code blocks of one
+ * transport block; everything else is shared and comes from the template.
+ */
+struct rte_bbdev_ldpc_dec_cb_data {
+	/** The Virtual Circular Buffer for this code block */
+	struct rte_bbdev_op_data input;
+	/** The hard decisions buffer for the decoded output of this code block */
+	struct rte_bbdev_op_data hard_output;
+	/** The HARQ combined LLR stream input buffer - optional */
+	struct rte_bbdev_op_data harq_combined_input;
+	/** The HARQ combined LLR stream output buffer - optional */
+	struct rte_bbdev_op_data harq_combined_output;
+	/** E, length after rate matching in bits for this code block.
+	 *  [3GPP TS38.212, section 5.4.2.1]
+	 */
+	uint32_t e;
+};
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Fill a burst of LDPC decode operations from one configuration template.
+ *
+ * For code blocks of the same transport block the decoder configuration is
+ * identical; only the data buffers and the rate matched length differ per
+ * code block. Copy the shared configuration from *tmpl* into every operation
+ * once and take the per code block fields from the compact *cbs* array,
+ * instead of building each operation field by field.
+ *
+ * The template must describe a code block mode operation
+ * (rte_bbdev_op_ldpc_dec::code_block_mode set to 1).
+ *
+ * @param ops
+ *   Array of allocated operations to fill.
+ * @param tmpl
+ *   Shared decoder configuration for all code blocks.
+ * @param cbs
+ *   Array of per code block data, one entry per operation.
+ * @param num_cbs
+ *   Number of code blocks, i.e. of entries in @p ops and @p cbs.
+ */
+__rte_experimental
+static inline void
+rte_bbdev_ldpc_dec_ops_fill(struct rte_bbdev_dec_op **ops,
+		const struct rte_bbdev_op_ldpc_dec *tmpl,
+		const struct rte_bbdev_ldpc_dec_cb_data *cbs,
+		uint16_t num_cbs)
+{
+	uint16_t i;
+
+	for (i = 0; i < num_cbs; i++) {
+		struct rte_bbdev_op_ldpc_dec *ldpc_dec = &ops[i]->ldpc_dec;
+
+		*ldpc_dec = *tmpl;
+		ldpc_dec->input = cbs[i].input;
+		ldpc_dec->hard_output = cbs[i].hard_output;
+		ldpc_dec->harq_combined_input = cbs[i].harq_combined_input;
+		ldpc_dec->harq_combined_output = cbs[i].harq_combined_output;
+		ldpc_dec->cb_params.e = cbs[i].e;
+	}
+}
+
 /**
  * Bulk allocate FFT operations from a mempool with default parameters.
  *
@@ -106,6 +106,7 @@ struct bpf_jit_state {
 	struct {
 		uint32_t stack_ofs;
 	} ldmb;
+	uint32_t burst_off;
 	uint32_t reguse;
 	int32_t *off;
 	uint8_t *ins;
@@ -1275,6 +1276,75 @@ emit_epilog(struct bpf_jit_state *st)
 	emit_ret(st);
 }
 
+/*
+ * Emit a separate burst entry point that invokes the JIT-ed program for
+ * each element of the input array:
+ *   void (*burst_func)(void *ctx[], uint64_t rc[], uint32_t num);
+ * The array pointers and the loop counter are kept in callee saved
+ * registers, so per packet all that remains is one near call - the
+ * prologue/epilogue and the indirect call cost are paid once per burst.
+ */
+static void
+emit_burst_wrapper(struct bpf_jit_state *st)
+{
+	int32_t joff;
+
+	static const uint8_t nop = 0x90;
+	/*
+	 * An odd number of pushes keeps %rsp 16-byte aligned at the
+	 * near call below, as the SysV ABI requires of a call site;
+	 * %r15 is pushed for the alignment only.
+	 */
+	static const uint8_t prologue[] = {
+		0x53,                   /* push %rbx */
+		0x41, 0x54,             /* push %r12 */
+		0x41, 0x55,             /* push %r13 */
+		0x41, 0x56,             /* push %r14 */
+		0x41, 0x57,             /* push %r15 */
+		0x49, 0x89, 0xfc,       /* mov %rdi,%r12 (ctx) */
+		0x49, 0x89, 0xf5,       /* mov %rsi,%r13 (rc) */
+		0x41, 0x89, 0xd6,       /* mov %edx,%r14d (num) */
+		0x31, 0xdb,             /* xor %ebx,%ebx (i) */
+		0x85, 0xd2,             /* test %edx,%edx */
+		0x74, 0x15,             /* jz .out */
+	};
+	static const uint8_t ld_ctx[] = {
+		0x49, 0x8b, 0x3c, 0xdc, /* .loop: mov (%r12,%rbx,8),%rdi */
+	};
+	static const uint8_t call_op = 0xe8;
+	static const uint8_t loop_end[] = {
+		0x49, 0x89, 0x44,
+		0xdd, 0x00,             /* mov %rax,0x0(%r13,%rbx,8) */
+		0xff, 0xc3,             /* inc %ebx */
+		0x44, 0x39, 0xf3,       /* cmp %r14d,%ebx */
+		0x72, 0xeb,             /* jb .loop */
+	};
+	static const uint8_t epilogue[] = {
+		0x41, 0x5f,             /* .out: pop %r15 */
+		0x41, 0x5e,             /* pop %r14 */
+		0x41, 0x5d,             /* pop %r13 */
+		0x41, 0x5c,             /* pop %r12 */
+		0x5b,                   /* pop %rbx */
+		0xc3,                   /* ret */
+	};
+
+	/* align the entry point */
+	while (st->sz % sizeof(uint64_t) != 0)
+		emit_bytes(st, &nop, sizeof(nop));
+
+	st->burst_off = st->sz;
+	emit_bytes(st, prologue, sizeof(prologue));
+	emit_bytes(st, ld_ctx, sizeof(ld_ctx));
+
+	/* near call to the per-packet entry point at the buffer start */
+	emit_bytes(st, &call_op, sizeof(call_op));
+	joff = -(int32_t)(st->sz + sizeof(joff));
+	emit_imm(st, joff, sizeof(joff));
+
+	emit_bytes(st, loop_end, sizeof(loop_end));
+	emit_bytes(st, epilogue, sizeof(epilogue));
+}
+
 /*
  * walk through bpf code and translate them x86_64 one.
  */
@@ -1483,6 +1553,8 @@ emit(struct bpf_jit_state *st, const struct rte_bpf *bpf)
 		}
 	}
 
+	emit_burst_wrapper(st);
+
 	return 0;
 }
 
@@ -1536,6 +1608,7 @@ __rte_bpf_jit_x86(struct rte_bpf *bpf)
 		munmap(st.ins, st.sz);
 	else {
 		bpf->jit.func = (void *)st.ins;
+		bpf->jit.burst_func = (void *)(st.ins + st.burst_off);
 		bpf->jit.sz = st.sz;
 	}
 
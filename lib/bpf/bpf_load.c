@@ -10,9 +10,62 @@
 #include <eal_export.h>
 #include <rte_log.h>
 #include <rte_errno.h>
+#include <rte_mbuf_dyn.h>
+#include <rte_spinlock.h>
 
 #include "bpf_impl.h"
 
+/* storage for dynfield offsets exposed to BPF programs as variables */
+#define BPF_MAX_DYNFIELD 64
+
+static int32_t dynfield_offs[BPF_MAX_DYNFIELD];
+static uint32_t nb_dynfield_offs;
+static rte_spinlock_t dynfield_lock = RTE_SPINLOCK_INITIALIZER;
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_bpf_mbuf_dynfield_xsym, 25.07)
+int
+rte_bpf_mbuf_dynfield_xsym(const char *dynfield_name, struct rte_bpf_xsym *xsym)
+{
+	int32_t off;
+	uint32_t i;
+
+	if (dynfield_name == NULL || xsym == NULL)
+		return -EINVAL;
+
+	off = rte_mbuf_dynfield_lookup(dynfield_name, NULL);
+	if (off < 0)
+		return off;
+
+	/*
+	 * the program reads the offset through the variable at run time,
+	 * so it needs storage that outlives this call - keep the offsets
+	 * in a static table, reusing entries with the same value.
+	 */
+	rte_spinlock_lock(&dynfield_lock);
+	for (i = 0; i != nb_dynfield_offs; i++) {
+		if (dynfield_offs[i] == off)
+			break;
+	}
+	if (i == nb_dynfield_offs) {
+		if (i == RTE_DIM(dynfield_offs)) {
+			rte_spinlock_unlock(&dynfield_lock);
+			return -ENOSPC;
+		}
+		dynfield_offs[i] = off;
+		nb_dynfield_offs++;
+	}
+	rte_spinlock_unlock(&dynfield_lock);
+
+	memset(xsym, 0, sizeof(*xsym));
+	xsym->name = dynfield_name;
+	xsym->type = RTE_BPF_XTYPE_VAR;
+	xsym->var.val = &dynfield_offs[i];
+	xsym->var.desc.type = RTE_BPF_ARG_PTR;
+	xsym->var.desc.size = sizeof(dynfield_offs[i]);
+
+	return 0;
+}
+
 static struct rte_bpf *
 bpf_load(const struct rte_bpf_prm *prm)
 {
@@ -101,6 +101,13 @@ struct rte_bpf_prm {
  */
 struct rte_bpf_jit {
 	uint64_t (*func)(void *); /**< JIT-ed native code */
+	/**
+	 * Burst-native entry point: executes the program for each element
+	 * of ctx[] and stores return values into rc[]. Amortizes the call
+	 * setup cost over the whole burst. NULL if the JIT for the current
+	 * ISA does not generate it.
+	 */
+	void (*burst_func)(void *ctx[], uint64_t rc[], uint32_t num);
 	size_t sz;                /**< size of JIT-ed code */
 };
 
@@ -153,6 +160,32 @@ rte_bpf_load(const struct rte_bpf_prm *prm);
 struct rte_bpf *
 rte_bpf_elf_load(const struct rte_bpf_prm *prm, const char *fname,
 		const char *sname);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Fill an external symbol definition exposing the offset of a registered
+ * mbuf dynamic field to BPF programs. The program declares an extern
+ * int32 variable named after the dynamic field and reads the offset from
+ * it at run time, so it does not need to be rebuilt when the field moves.
+ *
+ * @param dynfield_name
+ *   Name the dynamic field was registered under. Must remain valid for
+ *   as long as the filled xsym is used to load programs.
+ * @param xsym
+ *   External symbol definition to fill.
+ * @return
+ *   0 on success, negative errno otherwise:
+ *   - -EINVAL - invalid parameter passed to function
+ *   - -ENOENT - no dynamic field registered under that name
+ *   - -ENOSPC - too many distinct dynamic fields exposed already
+ */
+__rte_experimental
+int
+rte_bpf_mbuf_dynfield_xsym(const char *dynfield_name,
+		struct rte_bpf_xsym *xsym);
+
 /**
  * Execute given BPF bytecode.
  *
@@ -243,3 +243,81 @@ rte_comp_op_bulk_free(struct rte_comp_op **ops, uint16_t nb_ops)
 		ops[i] = NULL;
 	}
 }
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_comp_op_chunk_split, 25.07)
+int
+rte_comp_op_chunk_split(struct rte_comp_op **ops, uint16_t nb_ops,
+		struct rte_mbuf *m_src, struct rte_mbuf **m_dsts,
+		uint32_t chunk_size, void *private_xform)
+{
+	uint32_t total, offset;
+	uint32_t nb_chunks;
+	uint16_t i;
+
+	if (ops == NULL || m_src == NULL || m_dsts == NULL ||
+			chunk_size == 0 || private_xform == NULL)
+		return -EINVAL;
+
+	total = rte_pktmbuf_pkt_len(m_src);
+	if (total == 0)
+		return -EINVAL;
+
+	nb_chunks = (total + chunk_size - 1) / chunk_size;
+	if (nb_chunks > nb_ops)
+		return -ENOSPC;
+
+	for (i = 0, offset = 0; i < nb_chunks; i++, offset += chunk_size) {
+		if (ops[i] == NULL || m_dsts[i] == NULL)
+			return -EINVAL;
+
+		ops[i]->op_type = RTE_COMP_OP_STATELESS;
+		ops[i]->private_xform = private_xform;
+		ops[i]->m_src = m_src;
+		ops[i]->m_dst = m_dsts[i];
+		ops[i]->src.offset = offset;
+		ops[i]->src.length = RTE_MIN(chunk_size, total - offset);
+		ops[i]->dst.offset = 0;
+		/* Every chunk must decompress on its own */
+		ops[i]->flush_flag = RTE_COMP_FLUSH_FINAL;
+	}
+
+	return nb_chunks;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_comp_op_chunk_stitch, 25.07)
+int
+rte_comp_op_chunk_stitch(struct rte_comp_op **ops, uint16_t nb_ops,
+		struct rte_mbuf **m_out)
+{
+	struct rte_mbuf *head = NULL;
+	uint16_t i;
+
+	if (ops == NULL || nb_ops == 0 || m_out == NULL)
+		return -EINVAL;
+
+	/* Leave all outputs untouched unless the whole burst succeeded */
+	for (i = 0; i < nb_ops; i++) {
+		if (ops[i] == NULL || ops[i]->m_dst == NULL)
+			return -EINVAL;
+		if (ops[i]->status != RTE_COMP_OP_STATUS_SUCCESS)
+			return -EIO;
+		if (ops[i]->produced > UINT16_MAX)
+			return -EINVAL;
+	}
+
+	for (i = 0; i < nb_ops; i++) {
+		struct rte_mbuf *m = ops[i]->m_dst;
+
+		m->data_len = ops[i]->produced;
+		m->pkt_len = ops[i]->produced;
+
+		if (head == NULL)
+			head = m;
+		else if (rte_pktmbuf_chain(head, m) < 0)
+			return -EMSGSIZE;
+	}
+
+	*m_out = head;
+
+	return 0;
+}
@@ -561,6 +561,78 @@ rte_comp_op_bulk_alloc(struct rte_mempool *mempool,
 void
 rte_comp_op_bulk_free(struct rte_comp_op **ops, uint16_t nb_ops);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Split a large source buffer into a burst of independent stateless
+ * compression operations.
+ *
+ * The source is cut into chunks of *chunk_size* bytes (the last chunk may be
+ * shorter). All operations share *m_src* and select their chunk through the
+ * source offset and length, so no data is copied. Each operation is set up as
+ * RTE_COMP_STATELESS with RTE_COMP_FLUSH_FINAL, producing a self-contained
+ * stream per chunk, so the burst can be spread over any number of device
+ * queue pairs and processed in parallel. Larger chunks lose less compression
+ * ratio at the cut points, smaller chunks expose more parallelism.
+ *
+ * @param ops
+ *   Array of operations to set up, allocated from an operation pool.
+ * @param nb_ops
+ *   Number of operations in the *ops* array.
+ * @param m_src
+ *   Source buffer, possibly a chain of mbufs.
+ * @param m_dsts
+ *   One destination buffer per chunk, each a single segment sized for the
+ *   worst case output of one chunk.
+ * @param chunk_size
+ *   Source bytes per chunk, must not be 0.
+ * @param private_xform
+ *   Private xform handle to attach to every operation, created with
+ *   rte_compressdev_private_xform_create() on the target device.
+ *
+ * @return
+ *   - Number of operations set up on success
+ *   - -EINVAL on invalid input parameters
+ *   - -ENOSPC if the source needs more than nb_ops chunks
+ */
+__rte_experimental
+int
+rte_comp_op_chunk_split(struct rte_comp_op **ops, uint16_t nb_ops,
+		struct rte_mbuf *m_src, struct rte_mbuf **m_dsts,
+		uint32_t chunk_size, void *private_xform);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Stitch the output of a burst of chunked operations back together.
+ *
+ * To be called once all operations of a rte_comp_op_chunk_split() burst have
+ * been dequeued. Every destination buffer is trimmed to the bytes the device
+ * produced and the buffers are chained in chunk order into one output mbuf
+ * chain. No operation output is modified unless all operations of the burst
+ * completed successfully.
+ *
+ * @param ops
+ *   Array of dequeued operations, in the order produced by
+ *   rte_comp_op_chunk_split().
+ * @param nb_ops
+ *   Number of operations in the *ops* array.
+ * @param m_out
+ *   Output parameter for the head of the stitched chain.
+ *
+ * @return
+ *   - 0 on success, the total output size is rte_pktmbuf_pkt_len(*m_out)
+ *   - -EINVAL on invalid input parameters or oversized chunk output
+ *   - -EIO if any operation did not complete successfully
+ *   - -EMSGSIZE if the output chain would exceed the segment limit
+ */
+__rte_experimental
+int
+rte_comp_op_chunk_stitch(struct rte_comp_op **ops, uint16_t nb_ops,
+		struct rte_mbuf **m_out);
+
 /**
  * Get the name of a compress service feature flag
  *
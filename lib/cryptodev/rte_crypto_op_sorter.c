@@ -0,0 +1,276 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2025 Intel Corporation.
+ */
+
+#include <eal_export.h>
+#include <rte_common.h>
+#include <rte_malloc.h>
+
+#include "rte_cryptodev.h"
+#include "rte_crypto_op_sorter.h"
+
+/* number of bins probed before one is evicted for a new session */
+#define CRYPTO_OP_SORTER_PROBES	4
+
+struct crypto_op_bin {
+	void *session;     /* owning session, NULL when the bin is empty */
+	uint64_t deadline; /* timestamp after which the bin is released */
+	uint16_t cnt;      /* operations accumulated */
+};
+
+struct rte_crypto_op_sorter {
+	uint32_t bin_mask;     /* number of bins - 1 */
+	uint16_t bin_size;     /* operations per complete sub-burst */
+	uint32_t nb_held;      /* operations accumulating in bins */
+	uint64_t max_cycles;   /* maximum time an operation may wait */
+	uint64_t next_deadline; /* earliest deadline of any used bin */
+	/*
+	 * Ready operations, stored as back-to-back sub-bursts in a ring
+	 * sized to hold every bin plus one release in flight.
+	 */
+	uint32_t ready_mask;
+	uint32_t ready_head;
+	uint32_t ready_tail;
+	struct rte_crypto_op **ready;
+	struct crypto_op_bin *bins;
+	struct rte_crypto_op **bin_ops; /* bin_size ops per bin */
+};
+
+/* session an operation is binned by; NULL means "do not delay" */
+static inline void *
+crypto_op_session(const struct rte_crypto_op *op)
+{
+	if (op->sess_type == RTE_CRYPTO_OP_SESSIONLESS)
+		return NULL;
+	if (op->type == RTE_CRYPTO_OP_TYPE_ASYMMETRIC)
+		return op->asym->session;
+	return op->sym->session;
+}
+
+static inline uint32_t
+crypto_op_sorter_hash(const void *session)
+{
+	/* Fibonacci hash of the session pointer */
+	return (uint32_t)(((uintptr_t)session * UINT64_C(0x9e3779b97f4a7c15))
+			>> 32);
+}
+
+static inline uint32_t
+crypto_op_sorter_ready_cnt(const struct rte_crypto_op_sorter *sorter)
+{
+	return sorter->ready_tail - sorter->ready_head;
+}
+
+static inline uint32_t
+crypto_op_sorter_ready_room(const struct rte_crypto_op_sorter *sorter)
+{
+	return sorter->ready_mask + 1 - crypto_op_sorter_ready_cnt(sorter);
+}
+
+static inline void
+crypto_op_sorter_ready_push(struct rte_crypto_op_sorter *sorter,
+	struct rte_crypto_op *op)
+{
+	sorter->ready[sorter->ready_tail++ & sorter->ready_mask] = op;
+}
+
+/* move a bin's sub-burst to the ready ring and empty the bin */
+static void
+crypto_op_sorter_release(struct rte_crypto_op_sorter *sorter, uint32_t bin)
+{
+	struct crypto_op_bin *b = sorter->bins + bin;
+	struct rte_crypto_op **ops;
+	uint16_t i;
+
+	ops = sorter->bin_ops + (size_t)bin * sorter->bin_size;
+	for (i = 0; i != b->cnt; i++)
+		crypto_op_sorter_ready_push(sorter, ops[i]);
+
+	sorter->nb_held -= b->cnt;
+	b->session = NULL;
+	b->cnt = 0;
+}
+
+/* release every bin whose deadline passed, recompute the next deadline */
+static void
+crypto_op_sorter_expire(struct rte_crypto_op_sorter *sorter, uint64_t tms)
+{
+	uint64_t next;
+	uint32_t i;
+
+	next = UINT64_MAX;
+	for (i = 0; i <= sorter->bin_mask; i++) {
+		struct crypto_op_bin *b = sorter->bins + i;
+
+		if (b->session == NULL)
+			continue;
+		if (b->deadline <= tms &&
+				crypto_op_sorter_ready_room(sorter) >= b->cnt)
+			crypto_op_sorter_release(sorter, i);
+		else
+			next = RTE_MIN(next, b->deadline);
+	}
+	sorter->next_deadline = next;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_crypto_op_sorter_create, 25.07)
+struct rte_crypto_op_sorter *
+rte_crypto_op_sorter_create(uint32_t nb_bins, uint16_t bin_size,
+	uint64_t max_cycles, int socket_id)
+{
+	struct rte_crypto_op_sorter *sorter;
+	uint32_t ready_size;
+	size_t sz;
+
+	if (nb_bins == 0 || rte_is_power_of_2(nb_bins) == 0 ||
+			bin_size == 0) {
+		CDEV_LOG_ERR("Invalid sorter geometry %u x %u",
+			nb_bins, bin_size);
+		return NULL;
+	}
+
+	ready_size = rte_align32pow2((nb_bins + 1) * bin_size);
+
+	sz = sizeof(*sorter) +
+		ready_size * sizeof(sorter->ready[0]) +
+		nb_bins * sizeof(sorter->bins[0]) +
+		(size_t)nb_bins * bin_size * sizeof(sorter->bin_ops[0]);
+
+	sorter = rte_zmalloc_socket("crypto_op_sorter", sz,
+		RTE_CACHE_LINE_SIZE, socket_id);
+	if (sorter == NULL) {
+		CDEV_LOG_ERR("Failed to allocate %zu bytes for sorter", sz);
+		return NULL;
+	}
+
+	sorter->bin_mask = nb_bins - 1;
+	sorter->bin_size = bin_size;
+	sorter->max_cycles = max_cycles;
+	sorter->next_deadline = UINT64_MAX;
+	sorter->ready_mask = ready_size - 1;
+	sorter->ready = (struct rte_crypto_op **)(sorter + 1);
+	sorter->bins = (struct crypto_op_bin *)
+		(sorter->ready + ready_size);
+	sorter->bin_ops = (struct rte_crypto_op **)
+		(sorter->bins + nb_bins);
+
+	return sorter;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_crypto_op_sorter_free, 25.07)
+void
+rte_crypto_op_sorter_free(struct rte_crypto_op_sorter *sorter)
+{
+	rte_free(sorter);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_crypto_op_sorter_enqueue, 25.07)
+uint16_t
+rte_crypto_op_sorter_enqueue(struct rte_crypto_op_sorter *sorter,
+	struct rte_crypto_op **ops, uint16_t nb_ops, uint64_t tms)
+{
+	uint16_t i;
+
+	for (i = 0; i != nb_ops; i++) {
+		struct crypto_op_bin *b;
+		void *session;
+		uint32_t bin, empty, victim, j;
+
+		/*
+		 * Leave enough ready space for one forced bin release
+		 * plus the operation itself.
+		 */
+		if (crypto_op_sorter_ready_room(sorter) <
+				(uint32_t)sorter->bin_size + 1)
+			break;
+
+		session = crypto_op_session(ops[i]);
+		if (session == NULL) {
+			/* sessionless: pass straight through */
+			crypto_op_sorter_ready_push(sorter, ops[i]);
+			continue;
+		}
+
+		bin = crypto_op_sorter_hash(session) & sorter->bin_mask;
+		empty = UINT32_MAX;
+		victim = bin;
+		for (j = 0; j != CRYPTO_OP_SORTER_PROBES; j++) {
+			uint32_t idx = (bin + j) & sorter->bin_mask;
+
+			b = sorter->bins + idx;
+			if (b->session == session) {
+				bin = idx;
+				goto append;
+			}
+			if (b->session == NULL) {
+				if (empty == UINT32_MAX)
+					empty = idx;
+			} else if (b->deadline <
+					sorter->bins[victim].deadline ||
+					sorter->bins[victim].session == NULL) {
+				victim = idx;
+			}
+		}
+
+		if (empty == UINT32_MAX) {
+			/* all probed bins taken: release the oldest one */
+			crypto_op_sorter_release(sorter, victim);
+			empty = victim;
+		}
+
+		bin = empty;
+		b = sorter->bins + bin;
+		b->session = session;
+		b->deadline = tms + sorter->max_cycles;
+		sorter->next_deadline = RTE_MIN(sorter->next_deadline,
+			b->deadline);
+
+append:
+		b = sorter->bins + bin;
+		sorter->bin_ops[(size_t)bin * sorter->bin_size + b->cnt] =
+			ops[i];
+		b->cnt++;
+		sorter->nb_held++;
+		if (b->cnt == sorter->bin_size)
+			crypto_op_sorter_release(sorter, bin);
+	}
+
+	return i;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_crypto_op_sorter_dequeue, 25.07)
+uint16_t
+rte_crypto_op_sorter_dequeue(struct rte_crypto_op_sorter *sorter,
+	struct rte_crypto_op **ops, uint16_t nb_ops, uint64_t tms)
+{
+	uint32_t i, n;
+
+	if (sorter->nb_held != 0 && tms >= sorter->next_deadline)
+		crypto_op_sorter_expire(sorter, tms);
+
+	n = RTE_MIN((uint32_t)nb_ops, crypto_op_sorter_ready_cnt(sorter));
+	for (i = 0; i != n; i++)
+		ops[i] = sorter->ready[sorter->ready_head++ &
+			sorter->ready_mask];
+
+	return n;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_crypto_op_sorter_flush, 25.07)
+uint16_t
+rte_crypto_op_sorter_flush(struct rte_crypto_op_sorter *sorter,
+	struct rte_crypto_op **ops, uint16_t nb_ops)
+{
+	/* a timestamp in the infinite future expires every bin */
+	if (sorter->nb_held != 0)
+		crypto_op_sorter_expire(sorter, UINT64_MAX);
+
+	return rte_crypto_op_sorter_dequeue(sorter, ops, nb_ops, 0);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_crypto_op_sorter_count, 25.07)
+uint32_t
+rte_crypto_op_sorter_count(const struct rte_crypto_op_sorter *sorter)
+{
+	return sorter->nb_held + crypto_op_sorter_ready_cnt(sorter);
+}
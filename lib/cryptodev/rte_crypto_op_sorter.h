@@ -0,0 +1,176 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2025 Intel Corporation.
+ */
+
+#ifndef _RTE_CRYPTO_OP_SORTER_H_
+#define _RTE_CRYPTO_OP_SORTER_H_
+
+/**
+ * @file rte_crypto_op_sorter.h
+ *
+ * Session-coherent crypto operation sorter.
+ *
+ * Crypto PMDs commonly process a burst faster when all its operations
+ * share one session. The sorter bins operations by session across a
+ * small accumulation window and releases them as session-coherent
+ * sub-bursts, with a maximum latency after which incomplete sub-bursts
+ * are released anyway.
+ *
+ * All sorter operations are not thread safe: a sorter is meant to sit
+ * in front of one queue pair, used from one lcore.
+ */
+
+#include <stdint.h>
+
+#include <rte_compat.h>
+
+#include "rte_crypto.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Opaque crypto operation sorter handle. */
+struct rte_crypto_op_sorter;
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Create a crypto operation sorter.
+ *
+ * @param nb_bins
+ *   Number of sessions that can accumulate operations concurrently.
+ *   Must be a power of two.
+ * @param bin_size
+ *   Number of operations of one session that make a complete sub-burst.
+ *   A bin is released as soon as it holds this many operations.
+ * @param max_cycles
+ *   Maximum number of TSC cycles an operation may wait in a bin. A bin
+ *   older than this is released on the next dequeue, complete or not.
+ * @param socket_id
+ *   The *socket_id* argument is the socket identifier in the case of
+ *   NUMA. The value can be *SOCKET_ID_ANY* if there is no NUMA constraints.
+ * @return
+ *   The pointer to the new sorter, on success. NULL on error.
+ */
+__rte_experimental
+struct rte_crypto_op_sorter *
+rte_crypto_op_sorter_create(uint32_t nb_bins, uint16_t bin_size,
+	uint64_t max_cycles, int socket_id);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Free a crypto operation sorter.
+ *
+ * Any operations still held by the sorter are lost; drain it with
+ * rte_crypto_op_sorter_flush() first.
+ *
+ * @param sorter
+ *   Sorter to free.
+ */
+__rte_experimental
+void
+rte_crypto_op_sorter_free(struct rte_crypto_op_sorter *sorter);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Add operations to a sorter.
+ *
+ * Operations are binned by their session. Sessionless operations are
+ * not delayed and become ready for dequeue immediately. The call stops
+ * early when the sorter runs out of space; the remaining operations
+ * stay with the caller, who should dequeue and retry.
+ *
+ * @param sorter
+ *   Sorter to add the operations to.
+ * @param ops
+ *   Array of operations to add.
+ * @param nb_ops
+ *   Number of operations in *ops*.
+ * @param tms
+ *   Current timestamp (e.g. rte_rdtsc()), used to age the bins.
+ * @return
+ *   Number of operations actually added, in order from the start of *ops*.
+ */
+__rte_experimental
+uint16_t
+rte_crypto_op_sorter_enqueue(struct rte_crypto_op_sorter *sorter,
+	struct rte_crypto_op **ops, uint16_t nb_ops, uint64_t tms);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Retrieve session-coherent operations from a sorter.
+ *
+ * Returns completed sub-bursts, plus the sub-bursts of every bin that
+ * has exceeded the sorter's maximum latency. Operations of one session
+ * are returned back to back, so the result can be passed directly to
+ * rte_cryptodev_enqueue_burst(). To avoid splitting a sub-burst over
+ * two calls, *nb_ops* should be at least the sorter's bin size.
+ *
+ * @param sorter
+ *   Sorter to retrieve operations from.
+ * @param ops
+ *   Array to store the retrieved operations.
+ * @param nb_ops
+ *   Size of the *ops* array.
+ * @param tms
+ *   Current timestamp (e.g. rte_rdtsc()), checked against bin deadlines.
+ * @return
+ *   Number of operations stored in *ops*.
+ */
+__rte_experimental
+uint16_t
+rte_crypto_op_sorter_dequeue(struct rte_crypto_op_sorter *sorter,
+	struct rte_crypto_op **ops, uint16_t nb_ops, uint64_t tms);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Retrieve operations from a sorter regardless of age or completeness.
+ *
+ * Like rte_crypto_op_sorter_dequeue(), but releases every bin. Call
+ * repeatedly until it returns 0 to drain the sorter.
+ *
+ * @param sorter
+ *   Sorter to retrieve operations from.
+ * @param ops
+ *   Array to store the retrieved operations.
+ * @param nb_ops
+ *   Size of the *ops* array.
+ * @return
+ *   Number of operations stored in *ops*.
+ */
+__rte_experimental
+uint16_t
+rte_crypto_op_sorter_flush(struct rte_crypto_op_sorter *sorter,
+	struct rte_crypto_op **ops, uint16_t nb_ops);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Get the number of operations currently held by a sorter,
+ * both accumulating and ready for dequeue.
+ *
+ * @param sorter
+ *   Sorter to query.
+ * @return
+ *   Number of operations held.
+ */
+__rte_experimental
+uint32_t
+rte_crypto_op_sorter_count(const struct rte_crypto_op_sorter *sorter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTE_CRYPTO_OP_SORTER_H_ */
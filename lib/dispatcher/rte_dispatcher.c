@@ -61,23 +61,6 @@ struct rte_dispatcher {
 	struct rte_dispatcher_finalizer finalizers[EVD_MAX_FINALIZERS];
 };
 
-static int
-evd_lookup_handler_idx(struct rte_dispatcher_lcore *lcore,
-	const struct rte_event *event)
-{
-	uint16_t i;
-
-	for (i = 0; i < lcore->num_handlers; i++) {
-		struct rte_dispatcher_handler *handler =
-			&lcore->handlers[i];
-
-		if (handler->match_fun(event, handler->match_data))
-			return i;
-	}
-
-	return -1;
-}
-
 static void
 evd_prioritize_handler(struct rte_dispatcher_lcore *lcore,
 	int handler_idx)
@@ -120,40 +103,59 @@ evd_dispatch_events(struct rte_dispatcher *dispatcher,
 	struct rte_event *events, uint16_t num_events)
 {
 	int i;
-	struct rte_event bursts[EVD_MAX_HANDLERS][num_events];
+	uint16_t burst_idxs[EVD_MAX_HANDLERS][num_events];
 	uint16_t burst_lens[EVD_MAX_HANDLERS] = { 0 };
-	uint16_t drop_count = 0;
-	uint16_t dispatch_count;
+	struct rte_event burst[num_events];
+	bool matched[num_events];
+	uint16_t drop_count;
+	uint16_t dispatch_count = 0;
 	uint16_t dispatched = 0;
 
-	for (i = 0; i < num_events; i++) {
-		struct rte_event *event = &events[i];
-		int handler_idx;
-
-		handler_idx = evd_lookup_handler_idx(lcore, event);
+	memset(matched, 0, sizeof(matched));
 
-		if (unlikely(handler_idx < 0)) {
-			drop_count++;
-			continue;
+	/*
+	 * Match handler-major rather than event-major, so that each
+	 * match function is invoked back-to-back for the whole burst,
+	 * and only an index (not the event itself) needs to be
+	 * recorded per match.
+	 */
+	for (i = 0; i < lcore->num_handlers &&
+		 dispatch_count < num_events; i++) {
+		struct rte_dispatcher_handler *handler =
+			&lcore->handlers[i];
+		uint16_t j;
+
+		for (j = 0; j < num_events; j++) {
+			if (matched[j])
+				continue;
+
+			if (handler->match_fun(&events[j],
+					       handler->match_data)) {
+				burst_idxs[i][burst_lens[i]] = j;
+				burst_lens[i]++;
+				matched[j] = true;
+				dispatch_count++;
+			}
 		}
-
-		bursts[handler_idx][burst_lens[handler_idx]] = *event;
-		burst_lens[handler_idx]++;
 	}
 
-	dispatch_count = num_events - drop_count;
+	drop_count = num_events - dispatch_count;
 
 	for (i = 0; i < lcore->num_handlers &&
 		 dispatched < dispatch_count; i++) {
 		struct rte_dispatcher_handler *handler =
 			&lcore->handlers[i];
 		uint16_t len = burst_lens[i];
+		uint16_t j;
 
 		if (len == 0)
 			continue;
 
+		for (j = 0; j < len; j++)
+			burst[j] = events[burst_idxs[i][j]];
+
 		handler->process_fun(dispatcher->event_dev_id, port->port_id,
-				     bursts[i], len, handler->process_data);
+				     burst, len, handler->process_data);
 
 		dispatched += len;
 
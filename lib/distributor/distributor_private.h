@@ -99,6 +99,55 @@ struct rte_distributor_single {
 	struct rte_distributor_returned_pkts returns;
 };
 
+/*
+ * Defaults and limits for the v2 burst algorithm. Workers are fed through
+ * small SPSC rings rather than single cache-line mailboxes, so the queue
+ * depth is a creation-time parameter; dispatch batches up to
+ * RTE_DIST_V2_STAGE packets per worker before touching its ring.
+ */
+#define RTE_DIST_V2_DEF_QUEUE_DEPTH 64
+#define RTE_DIST_V2_STAGE 32
+
+/* Worker lifecycle states for the v2 algorithm, written by the worker and
+ * consumed by the distributor thread.
+ */
+#define RTE_DIST_V2_WS_OFF 0      /**< never started, or shutdown handled */
+#define RTE_DIST_V2_WS_ACTIVE 1   /**< worker is polling for packets */
+#define RTE_DIST_V2_WS_SHUTDOWN 2 /**< worker returned its packets and left */
+
+/*
+ * In-flight flow table entry for the v2 algorithm. Flows are identified by
+ * the full 32-bit mbuf tag (with the low bit forced, so zero means an empty
+ * slot) and stay pinned to a worker while any of their packets are
+ * outstanding. Entries whose count has dropped to zero are kept as hints so
+ * a returning flow lands on the same worker, and are recycled on demand.
+ */
+struct rte_distributor_v2_flow {
+	uint32_t tag;    /**< flow id, 0 for an empty slot */
+	uint32_t count;  /**< packets of this flow outstanding */
+	uint32_t wkr;    /**< worker the flow is pinned to */
+};
+
+struct rte_ring;
+
+/*
+ * Per-worker state for the v2 algorithm. The distributor enqueues packets
+ * to inq and drains completed packets from retq; both are single-producer,
+ * single-consumer rings. Only the state field is shared between the
+ * distributor and the worker threads, everything else is owned by the
+ * distributor thread (the stage array buffers packets so a worker's ring is
+ * touched once per batch).
+ */
+struct __rte_cache_aligned rte_distributor_v2_worker {
+	struct rte_ring *inq;        /**< distributor -> worker packets */
+	struct rte_ring *retq;       /**< worker -> distributor returns */
+	RTE_ATOMIC(uint32_t) state;  /**< RTE_DIST_V2_WS_* lifecycle */
+	unsigned int held;           /**< packets enqueued minus returned */
+	unsigned int stage_count;    /**< packets staged for the next burst */
+	struct rte_mbuf *stage[RTE_DIST_V2_STAGE];
+	struct rte_mbuf **drain;     /**< scratch for shutdown ring takeover */
+};
+
 /* All different signature compare functions */
 enum rte_distributor_match_function {
 	RTE_DIST_MATCH_SCALAR = 0,
@@ -156,6 +205,15 @@ struct rte_distributor {
 
 	uint8_t active[RTE_DISTRIB_MAX_WORKERS];
 	uint8_t activesum;
+
+	/* v2 algorithm state, only valid for RTE_DIST_ALG_BURST_V2 */
+	struct rte_distributor_v2_worker v2w[RTE_DISTRIB_MAX_WORKERS];
+	struct rte_distributor_v2_flow *v2_flows;   /**< open-addressed table */
+	struct rte_distributor_v2_flow *v2_flow_scratch; /**< rebuild buffer */
+	uint32_t v2_flow_mask;      /**< table size - 1, size a power of two */
+	uint32_t v2_flow_occupied;  /**< slots holding a live or stale entry */
+	unsigned int v2_queue_depth; /**< per-worker inq capacity */
+	unsigned int v2_next_wkr;    /**< round-robin hint for new flows */
 };
 
 void
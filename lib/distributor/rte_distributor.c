@@ -14,7 +14,9 @@
 #include <rte_errno.h>
 #include <rte_string_fns.h>
 #include <rte_eal_memconfig.h>
+#include <rte_malloc.h>
 #include <rte_pause.h>
+#include <rte_ring.h>
 #include <rte_tailq.h>
 
 #include "rte_distributor.h"
@@ -30,6 +32,27 @@ EAL_REGISTER_TAILQ(rte_dist_burst_tailq)
 
 /**** APIs called by workers ****/
 
+/* Enqueue completed packets on the worker's return ring (v2 algorithm).
+ * The ring is sized to hold everything the worker can have outstanding, so
+ * this only spins if the distributor has fallen behind draining returns.
+ */
+static void
+v2_worker_return(struct rte_distributor *d, unsigned int worker_id,
+		struct rte_mbuf **oldpkt, unsigned int count)
+{
+	struct rte_distributor_v2_worker *w = &d->v2w[worker_id];
+	unsigned int sent = 0;
+
+	while (sent < count) {
+		unsigned int n = rte_ring_enqueue_burst(w->retq,
+				(void **)&oldpkt[sent], count - sent, NULL);
+
+		if (n == 0)
+			rte_pause();
+		sent += n;
+	}
+}
+
 /**** Burst Packet APIs called by workers ****/
 
 RTE_EXPORT_SYMBOL(rte_distributor_request_pkt)
@@ -49,6 +72,20 @@ rte_distributor_request_pkt(struct rte_distributor *d,
 		return;
 	}
 
+	if (d->alg_type == RTE_DIST_ALG_BURST_V2) {
+		struct rte_distributor_v2_worker *w = &d->v2w[worker_id];
+
+		v2_worker_return(d, worker_id, oldpkt, count);
+		/* (Re)announce ourselves; the ring is push-based so there is
+		 * no per-burst request handshake.
+		 */
+		if (rte_atomic_load_explicit(&w->state, rte_memory_order_relaxed)
+				!= RTE_DIST_V2_WS_ACTIVE)
+			rte_atomic_store_explicit(&w->state,
+				RTE_DIST_V2_WS_ACTIVE, rte_memory_order_release);
+		return;
+	}
+
 	retptr64 = &(buf->retptr64[0]);
 	/* Spin while handshake bits are set (scheduler clears it).
 	 * Sync with worker on GET_BUF flag.
@@ -101,6 +138,12 @@ rte_distributor_poll_pkt(struct rte_distributor *d,
 		return (pkts[0]) ? 1 : 0;
 	}
 
+	if (d->alg_type == RTE_DIST_ALG_BURST_V2) {
+		count = rte_ring_dequeue_burst(d->v2w[worker_id].inq,
+				(void **)pkts, RTE_DIST_BURST_SIZE, NULL);
+		return count ? count : -1;
+	}
+
 	/* If any of below bits is set, return.
 	 * GET_BUF is set when distributor hasn't sent any packets yet
 	 * RETURN_BUF is set when distributor must retrieve in-flight packets
@@ -180,6 +223,21 @@ rte_distributor_return_pkt(struct rte_distributor *d,
 			return -EINVAL;
 	}
 
+	if (d->alg_type == RTE_DIST_ALG_BURST_V2) {
+		if (num < 0)
+			return -EINVAL;
+
+		v2_worker_return(d, worker_id, oldpkt, num);
+		/* Tell the distributor we are leaving; it will take over our
+		 * inbound ring and reassign anything still queued on it. We
+		 * must not touch the rings again until we re-announce
+		 * ourselves with a new request.
+		 */
+		rte_atomic_store_explicit(&d->v2w[worker_id].state,
+			RTE_DIST_V2_WS_SHUTDOWN, rte_memory_order_release);
+		return 0;
+	}
+
 	/* Spin while handshake bits are set (scheduler clears it).
 	 * Sync with worker on GET_BUF flag.
 	 */
@@ -235,6 +293,306 @@ store_return(uintptr_t oldbuf, struct rte_distributor *d,
 	*ret_count += (*ret_count != RTE_DISTRIB_RETURNS_MASK);
 }
 
+/**** v2 burst algorithm, distributor side ****/
+
+static void
+v2_handle_worker_shutdown(struct rte_distributor *d, unsigned int wkr);
+
+/* v2 flows are tracked in an open-addressed, linear-probed table. Slots are
+ * never emptied on the probe path (that would break probe chains); entries
+ * whose count dropped to zero are stale and get recycled by inserts or
+ * swept out by a rebuild once the table gets too full.
+ */
+static inline uint32_t
+v2_flow_hash(uint32_t tag)
+{
+	return tag * 0x9E3779B9;
+}
+
+/* Find the entry for a tag, or NULL if the flow is not tracked. */
+static struct rte_distributor_v2_flow *
+v2_flow_find(struct rte_distributor *d, uint32_t tag)
+{
+	uint32_t i = v2_flow_hash(tag) & d->v2_flow_mask;
+
+	for (;;) {
+		struct rte_distributor_v2_flow *e = &d->v2_flows[i];
+
+		if (e->tag == tag)
+			return e;
+		if (e->tag == 0)
+			return NULL;
+		i = (i + 1) & d->v2_flow_mask;
+	}
+}
+
+/* Drop one outstanding packet from a flow's count. */
+static void
+v2_flow_release(struct rte_distributor *d, uint32_t tag)
+{
+	struct rte_distributor_v2_flow *e = v2_flow_find(d, tag);
+
+	if (e != NULL && e->count > 0)
+		e->count--;
+}
+
+/* Sweep stale entries by reinserting only the live ones into a cleared
+ * table. The table is sized to twice the maximum number of packets that can
+ * be outstanding, so this always brings occupancy back below half.
+ */
+static void
+v2_flow_rebuild(struct rte_distributor *d)
+{
+	struct rte_distributor_v2_flow *live = d->v2_flow_scratch;
+	unsigned int n = 0;
+	uint32_t i;
+
+	for (i = 0; i <= d->v2_flow_mask; i++)
+		if (d->v2_flows[i].count != 0)
+			live[n++] = d->v2_flows[i];
+
+	memset(d->v2_flows, 0,
+		((size_t)d->v2_flow_mask + 1) * sizeof(*d->v2_flows));
+	d->v2_flow_occupied = n;
+
+	while (n-- > 0) {
+		i = v2_flow_hash(live[n].tag) & d->v2_flow_mask;
+		while (d->v2_flows[i].tag != 0)
+			i = (i + 1) & d->v2_flow_mask;
+		d->v2_flows[i] = live[n];
+	}
+}
+
+/* Return the entry for a tag, tracking the flow if it was not already. A
+ * freshly tracked (or recycled) entry has count == 0 and an out-of-range
+ * worker id.
+ */
+static struct rte_distributor_v2_flow *
+v2_flow_get(struct rte_distributor *d, uint32_t tag)
+{
+	struct rte_distributor_v2_flow *stale = NULL;
+	uint32_t i;
+
+	if (unlikely(d->v2_flow_occupied > (d->v2_flow_mask + 1) / 4 * 3))
+		v2_flow_rebuild(d);
+
+	i = v2_flow_hash(tag) & d->v2_flow_mask;
+	for (;;) {
+		struct rte_distributor_v2_flow *e = &d->v2_flows[i];
+
+		if (e->tag == tag)
+			return e;
+		if (e->tag == 0) {
+			if (stale != NULL)
+				e = stale;
+			else
+				d->v2_flow_occupied++;
+			e->tag = tag;
+			e->count = 0;
+			e->wkr = RTE_DISTRIB_MAX_WORKERS;
+			return e;
+		}
+		if (stale == NULL && e->count == 0)
+			stale = e;
+		i = (i + 1) & d->v2_flow_mask;
+	}
+}
+
+/*
+ * Drain a worker's return ring, releasing the flow counts of the completed
+ * packets, and act on worker lifecycle changes: activate workers that have
+ * announced themselves, and take over the queue of workers that have shut
+ * down.
+ */
+static unsigned int
+v2_handle_returns(struct rte_distributor *d, unsigned int wkr)
+{
+	struct rte_distributor_v2_worker *w = &d->v2w[wkr];
+	struct rte_mbuf *ret[RTE_DIST_BURST_SIZE * 2];
+	unsigned int ret_start = d->returns.start,
+			ret_count = d->returns.count;
+	unsigned int count = 0;
+	unsigned int i, n;
+	uint32_t state;
+
+	while ((n = rte_ring_dequeue_burst(w->retq, (void **)ret,
+			RTE_DIM(ret), NULL)) > 0) {
+		for (i = 0; i < n; i++) {
+			v2_flow_release(d, ret[i]->hash.usr | 1);
+			store_return((uintptr_t)ret[i], d,
+					&ret_start, &ret_count);
+		}
+		w->held -= RTE_MIN(w->held, n);
+		count += n;
+	}
+	d->returns.start = ret_start;
+	d->returns.count = ret_count;
+
+	state = rte_atomic_load_explicit(&w->state, rte_memory_order_acquire);
+	if (unlikely(state == RTE_DIST_V2_WS_SHUTDOWN)) {
+		uint32_t exp = RTE_DIST_V2_WS_SHUTDOWN;
+
+		/* The CAS can lose against the worker re-announcing itself;
+		 * in that case its rings stay valid and nothing is done.
+		 */
+		if (rte_atomic_compare_exchange_strong_explicit(&w->state,
+				&exp, RTE_DIST_V2_WS_OFF,
+				rte_memory_order_acq_rel,
+				rte_memory_order_acquire))
+			v2_handle_worker_shutdown(d, wkr);
+	} else if (state == RTE_DIST_V2_WS_ACTIVE && !d->active[wkr]) {
+		d->active[wkr] = 1;
+		d->activesum++;
+	}
+
+	return count;
+}
+
+/*
+ * A worker announced shutdown: it enqueued its last returns before setting
+ * the flag and no longer touches its rings, so the distributor becomes the
+ * consumer of its inbound ring. Queued packets are reassigned to the
+ * remaining workers; packets the worker took and never returned are
+ * forgotten, as with the burst algorithm.
+ */
+static void
+v2_handle_worker_shutdown(struct rte_distributor *d, unsigned int wkr)
+{
+	struct rte_distributor_v2_worker *w = &d->v2w[wkr];
+	unsigned int n;
+	uint32_t i;
+
+	d->activesum -= d->active[wkr];
+	d->active[wkr] = 0;
+
+	/* catch returns enqueued between the last drain and the flag */
+	v2_handle_returns(d, wkr);
+
+	n = rte_ring_dequeue_burst(w->inq, (void **)w->drain,
+			d->v2_queue_depth, NULL);
+	w->held = 0;
+
+	/* Unpin every flow assigned to this worker so the reassignment below
+	 * (and any future packets of those flows) picks a live worker.
+	 */
+	for (i = 0; i <= d->v2_flow_mask; i++)
+		if (d->v2_flows[i].count != 0 && d->v2_flows[i].wkr == wkr)
+			d->v2_flows[i].count = 0;
+
+	if (n > 0)
+		rte_distributor_process(d, w->drain, n);
+}
+
+/*
+ * Flush a worker's staged packets to its ring in one burst. If the ring is
+ * full, wait for the worker to drain it, picking up returns meanwhile so
+ * the worker cannot block on a full return ring, and watching for the
+ * worker shutting down.
+ */
+static void
+v2_flush_stage(struct rte_distributor *d, unsigned int wkr)
+{
+	struct rte_distributor_v2_worker *w = &d->v2w[wkr];
+	struct rte_mbuf *pend[RTE_DIST_V2_STAGE];
+	unsigned int n = w->stage_count;
+	unsigned int sent = 0, r;
+
+	if (n == 0)
+		return;
+
+	/* Work on a local copy: a shutdown of this worker mid-flush leads to
+	 * a recursive process() call which may stage packets here again.
+	 */
+	memcpy(pend, w->stage, n * sizeof(*pend));
+	w->stage_count = 0;
+
+	while (sent < n) {
+		r = rte_ring_enqueue_burst(w->inq, (void **)&pend[sent],
+				n - sent, NULL);
+		w->held += r;
+		sent += r;
+		if (r == 0) {
+			v2_handle_returns(d, wkr);
+			if (unlikely(!d->active[wkr])) {
+				/* Worker left; its flows were unpinned, so
+				 * redistribute the rest (dropped if no
+				 * worker remains, as with the burst alg).
+				 */
+				if (d->activesum)
+					rte_distributor_process(d, &pend[sent],
+							n - sent);
+				return;
+			}
+			rte_pause();
+		}
+	}
+}
+
+/* Stage a packet for a worker, flushing when a full burst has gathered. */
+static void
+v2_stage(struct rte_distributor *d, unsigned int wkr, struct rte_mbuf *mb)
+{
+	struct rte_distributor_v2_worker *w = &d->v2w[wkr];
+
+	w->stage[w->stage_count++] = mb;
+	if (w->stage_count == RTE_DIST_V2_STAGE)
+		v2_flush_stage(d, wkr);
+}
+
+/* Pick a worker for a new flow: simple round-robin over active workers.
+ * The caller must ensure at least one worker is active.
+ */
+static unsigned int
+v2_pick_worker(struct rte_distributor *d)
+{
+	unsigned int wkr = d->v2_next_wkr;
+
+	while (!d->active[wkr])
+		wkr = (wkr + 1) % d->num_workers;
+	d->v2_next_wkr = (wkr + 1) % d->num_workers;
+
+	return wkr;
+}
+
+/* v2 variant of rte_distributor_process() */
+static int
+v2_process(struct rte_distributor *d, struct rte_mbuf **mbufs,
+		unsigned int num_mbufs)
+{
+	unsigned int i, wid;
+
+	for (wid = 0; wid < d->num_workers; wid++)
+		v2_handle_returns(d, wid);
+
+	if (unlikely(num_mbufs == 0 || !d->activesum))
+		return 0;
+
+	for (i = 0; i < num_mbufs; i++) {
+		/* flows have to be non-zero */
+		uint32_t tag = mbufs[i]->hash.usr | 1;
+		struct rte_distributor_v2_flow *e;
+
+		if (unlikely(!d->activesum))
+			break;
+
+		e = v2_flow_get(d, tag);
+		/* A flow with packets outstanding stays on its worker; an
+		 * idle flow keeps its last worker as long as that worker is
+		 * still around, for cache locality.
+		 */
+		if (e->count == 0 && (e->wkr >= d->num_workers ||
+				!d->active[e->wkr]))
+			e->wkr = v2_pick_worker(d);
+		e->count++;
+		v2_stage(d, e->wkr, mbufs[i]);
+	}
+
+	for (wid = 0; wid < d->num_workers; wid++)
+		v2_flush_stage(d, wid);
+
+	return i;
+}
+
 /*
  * Match then flow_ids (tags) of the incoming packets to the flow_ids
  * of the inflight packets (both inflight on the workers and in each worker
@@ -463,6 +821,9 @@ rte_distributor_process(struct rte_distributor *d,
 			mbufs, num_mbufs);
 	}
 
+	if (d->alg_type == RTE_DIST_ALG_BURST_V2)
+		return v2_process(d, mbufs, num_mbufs);
+
 	for (wid = 0 ; wid < d->num_workers; wid++)
 		handle_returns(d, wid);
 
@@ -652,6 +1013,13 @@ total_outstanding(const struct rte_distributor *d)
 {
 	unsigned int wkr, total_outstanding = 0;
 
+	if (d->alg_type == RTE_DIST_ALG_BURST_V2) {
+		for (wkr = 0; wkr < d->num_workers; wkr++)
+			total_outstanding += d->v2w[wkr].held +
+					d->v2w[wkr].stage_count;
+		return total_outstanding;
+	}
+
 	for (wkr = 0; wkr < d->num_workers; wkr++)
 		total_outstanding += d->backlog[wkr].count + d->bufs[wkr].count;
 
@@ -674,6 +1042,22 @@ rte_distributor_flush(struct rte_distributor *d)
 		return rte_distributor_flush_single(d->d_single);
 	}
 
+	if (d->alg_type == RTE_DIST_ALG_BURST_V2) {
+		flushed = total_outstanding(d);
+
+		while (total_outstanding(d) > 0)
+			rte_distributor_process(d, NULL, 0);
+
+		/* With nothing in flight the affinity history is only stale
+		 * state; wipe it so future flows balance afresh.
+		 */
+		memset(d->v2_flows, 0,
+			((size_t)d->v2_flow_mask + 1) * sizeof(*d->v2_flows));
+		d->v2_flow_occupied = 0;
+
+		return flushed;
+	}
+
 	flushed = total_outstanding(d);
 
 	while (total_outstanding(d) > 0)
@@ -707,6 +1091,12 @@ rte_distributor_clear_returns(struct rte_distributor *d)
 		return;
 	}
 
+	if (d->alg_type == RTE_DIST_ALG_BURST_V2) {
+		/* no handshake to clear, just drop the gathered returns */
+		d->returns.start = d->returns.count = 0;
+		return;
+	}
+
 	/* throw away returns, so workers can exit */
 	for (wkr = 0; wkr < d->num_workers; wkr++)
 		/* Sync with worker. Release retptrs. */
@@ -716,6 +1106,113 @@ rte_distributor_clear_returns(struct rte_distributor *d)
 	d->returns.start = d->returns.count = 0;
 }
 
+/* creates a distributor instance using the v2 burst algorithm */
+static struct rte_distributor *
+distributor_create_v2(const char *name, unsigned int socket_id,
+		unsigned int num_workers, unsigned int queue_depth)
+{
+	struct rte_distributor *d;
+	struct rte_dist_burst_list *dist_burst_list;
+	char mz_name[RTE_MEMZONE_NAMESIZE];
+	char ring_name[RTE_RING_NAMESIZE];
+	const struct rte_memzone *mz;
+	struct rte_mbuf **drain;
+	unsigned int i, live_max;
+
+	if (name == NULL || num_workers >=
+		(unsigned int)RTE_MIN(RTE_DISTRIB_MAX_WORKERS, RTE_MAX_LCORE)) {
+		rte_errno = EINVAL;
+		return NULL;
+	}
+
+	if (queue_depth == 0)
+		queue_depth = RTE_DIST_V2_DEF_QUEUE_DEPTH;
+	queue_depth = RTE_MAX(queue_depth,
+			(unsigned int)RTE_DIST_BURST_SIZE);
+
+	snprintf(mz_name, sizeof(mz_name), RTE_DISTRIB_PREFIX"%s", name);
+	mz = rte_memzone_reserve(mz_name, sizeof(*d), socket_id, NO_FLAGS);
+	if (mz == NULL) {
+		rte_errno = ENOMEM;
+		return NULL;
+	}
+
+	d = mz->addr;
+	strlcpy(d->name, name, sizeof(d->name));
+	d->num_workers = num_workers;
+	d->alg_type = RTE_DIST_ALG_BURST_V2;
+	d->v2_queue_depth = queue_depth;
+
+	for (i = 0; i < num_workers; i++) {
+		struct rte_distributor_v2_worker *w = &d->v2w[i];
+
+		snprintf(ring_name, sizeof(ring_name), "DT2I_%s_%u", name, i);
+		w->inq = rte_ring_create(ring_name, queue_depth, socket_id,
+			RING_F_SP_ENQ | RING_F_SC_DEQ | RING_F_EXACT_SZ);
+		snprintf(ring_name, sizeof(ring_name), "DT2R_%s_%u", name, i);
+		/* sized for everything the worker can have outstanding */
+		w->retq = rte_ring_create(ring_name,
+			queue_depth + RTE_DIST_BURST_SIZE, socket_id,
+			RING_F_SP_ENQ | RING_F_SC_DEQ | RING_F_EXACT_SZ);
+		if (w->inq == NULL || w->retq == NULL)
+			goto err;
+	}
+
+	/* Upper bound on packets outstanding at once, and so on the number
+	 * of live flow entries; size the table at twice that so inserts
+	 * always terminate and rebuilds always make room.
+	 */
+	live_max = num_workers * (queue_depth + RTE_DIST_BURST_SIZE +
+			RTE_DIST_V2_STAGE);
+	d->v2_flow_mask = rte_align32pow2(2 * live_max) - 1;
+
+	d->v2_flows = rte_zmalloc_socket(NULL,
+		((size_t)d->v2_flow_mask + 1) * sizeof(*d->v2_flows),
+		RTE_CACHE_LINE_SIZE, socket_id);
+	d->v2_flow_scratch = rte_zmalloc_socket(NULL,
+		(size_t)live_max * sizeof(*d->v2_flow_scratch),
+		RTE_CACHE_LINE_SIZE, socket_id);
+	drain = rte_zmalloc_socket(NULL,
+		(size_t)num_workers * queue_depth * sizeof(*drain),
+		RTE_CACHE_LINE_SIZE, socket_id);
+	if (d->v2_flows == NULL || d->v2_flow_scratch == NULL || drain == NULL)
+		goto err;
+
+	for (i = 0; i < num_workers; i++)
+		d->v2w[i].drain = &drain[i * queue_depth];
+
+	dist_burst_list = RTE_TAILQ_CAST(rte_dist_burst_tailq.head,
+					  rte_dist_burst_list);
+
+	rte_mcfg_tailq_write_lock();
+	TAILQ_INSERT_TAIL(dist_burst_list, d, next);
+	rte_mcfg_tailq_write_unlock();
+
+	return d;
+
+err:
+	for (i = 0; i < num_workers; i++) {
+		rte_ring_free(d->v2w[i].inq);
+		rte_ring_free(d->v2w[i].retq);
+	}
+	rte_free(d->v2_flows);
+	rte_free(d->v2_flow_scratch);
+	rte_memzone_free(mz);
+	rte_errno = ENOMEM;
+	return NULL;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_distributor_create_v2, 25.07)
+struct rte_distributor *
+rte_distributor_create_v2(const char *name,
+		unsigned int socket_id,
+		unsigned int num_workers,
+		unsigned int queue_depth)
+{
+	return distributor_create_v2(name, socket_id, num_workers,
+			queue_depth);
+}
+
 /* creates a distributor instance */
 RTE_EXPORT_SYMBOL(rte_distributor_create)
 struct rte_distributor *
@@ -742,6 +1239,10 @@ rte_distributor_create(const char *name,
 		return NULL;
 	}
 
+	if (alg_type == RTE_DIST_ALG_BURST_V2)
+		return distributor_create_v2(name, socket_id, num_workers,
+				RTE_DIST_V2_DEF_QUEUE_DEPTH);
+
 	if (alg_type == RTE_DIST_ALG_SINGLE) {
 		d = malloc(sizeof(struct rte_distributor));
 		if (d == NULL) {
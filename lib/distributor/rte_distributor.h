@@ -13,6 +13,8 @@
  * one-at-a-time to workers, with dynamic load balancing.
  */
 
+#include <rte_compat.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -21,6 +23,7 @@ extern "C" {
 enum rte_distributor_alg_type {
 	RTE_DIST_ALG_BURST = 0,
 	RTE_DIST_ALG_SINGLE,
+	RTE_DIST_ALG_BURST_V2,
 	RTE_DIST_NUM_ALG_TYPES
 };
 
@@ -44,6 +47,9 @@ struct rte_mbuf;
  *   Call the legacy API, or use the new burst API. legacy uses 32-bit
  *   flow ID, and works on a single packet at a time. Latest uses 15-
  *   bit flow ID and works on up to 8 packets at a time to workers.
+ *   RTE_DIST_ALG_BURST_V2 uses the full 32-bit flow ID and feeds workers
+ *   through per-worker rings of a default depth; use
+ *   rte_distributor_create_v2() to choose the depth.
  * @return
  *   The newly created distributor instance
  */
@@ -52,6 +58,40 @@ rte_distributor_create(const char *name, unsigned int socket_id,
 		unsigned int num_workers,
 		unsigned int alg_type);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Create a new distributor instance using the v2 burst algorithm.
+ *
+ * The v2 algorithm matches flows on the full 32-bit mbuf tag and passes
+ * packets to each worker through a ring of *queue_depth* entries instead of
+ * a single-burst mailbox, so a worker can have more than one burst
+ * outstanding. All packets of a flow present in a processed burst are
+ * handed to the flow's worker together. Flow-to-worker affinity is kept
+ * while packets of the flow are in flight and, as a hint, until
+ * rte_distributor_flush() is called.
+ *
+ * @param name
+ *   The name to be given to the distributor instance.
+ * @param socket_id
+ *   The NUMA node on which the memory is to be allocated
+ * @param num_workers
+ *   The maximum number of workers that will request packets from this
+ *   distributor
+ * @param queue_depth
+ *   The number of packets each worker's queue can hold. Pass 0 to use the
+ *   default depth.
+ * @return
+ *   The newly created distributor instance, or NULL on error with rte_errno
+ *   set appropriately.
+ */
+__rte_experimental
+struct rte_distributor *
+rte_distributor_create_v2(const char *name, unsigned int socket_id,
+		unsigned int num_workers,
+		unsigned int queue_depth);
+
 /*  *** APIS to be called on the distributor lcore ***  */
 /*
  * The following APIs are the public APIs which are designed for use on a
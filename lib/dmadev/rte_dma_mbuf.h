@@ -0,0 +1,181 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2025 Intel Corporation
+ */
+
+#ifndef RTE_DMA_MBUF_H
+#define RTE_DMA_MBUF_H
+
+/**
+ * @file rte_dma_mbuf.h
+ *
+ * DMA device mbuf helpers.
+ *
+ * Convenience wrappers that translate packet mbuf chains into the
+ * scatter-gather entries consumed by the DMA device enqueue API, so that
+ * applications copying packet data with DMA engines do not have to carry
+ * their own flattening glue code on every burst.
+ */
+
+#include <stdint.h>
+
+#include <rte_mbuf.h>
+
+#include "rte_dmadev.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum number of segments per mbuf chain supported by the copy helpers.
+ *
+ * @see rte_dma_copy_mbuf
+ */
+#define RTE_DMA_MBUF_MAX_SGE 32
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Translate an mbuf chain into an array of scatter-gather entries, one per
+ * segment, covering the data area of each segment.
+ *
+ * @param mb
+ *   The mbuf chain to translate.
+ * @param sge
+ *   Output array of scatter-gather entries.
+ * @param nb_sge
+ *   The size of the sge array.
+ *
+ * @return
+ *   - >0: number of scatter-gather entries filled in.
+ *   - -ENOSPC: if the chain has more segments than nb_sge.
+ */
+__rte_experimental
+static inline int
+rte_dma_mbuf_to_sge(const struct rte_mbuf *mb, struct rte_dma_sge *sge,
+		    uint16_t nb_sge)
+{
+	uint16_t n = 0;
+
+	do {
+		if (n == nb_sge)
+			return -ENOSPC;
+
+		sge[n].addr = rte_mbuf_data_iova(mb);
+		sge[n].length = rte_pktmbuf_data_len(mb);
+		n++;
+		mb = mb->next;
+	} while (mb != NULL);
+
+	return n;
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Enqueue a copy of the data of an mbuf chain into another mbuf chain onto
+ * the virtual DMA channel.
+ *
+ * When both chains are single segment, this maps to rte_dma_copy() with the
+ * source data length; otherwise both chains are translated into
+ * scatter-gather entries and the operation is enqueued with
+ * rte_dma_copy_sg(). The destination chain must provide at least as much
+ * data room as the source chain carries data; the helper does not resize
+ * the destination segments.
+ *
+ * @param dev_id
+ *   The identifier of the device.
+ * @param vchan
+ *   The identifier of virtual DMA channel.
+ * @param src
+ *   The source mbuf chain.
+ * @param dst
+ *   The destination mbuf chain.
+ * @param flags
+ *   An flags for this operation.
+ *   @see RTE_DMA_OP_FLAG_*
+ *
+ * @return
+ *   - 0..UINT16_MAX: index of enqueued job.
+ *   - -EINVAL: if a chain has more than RTE_DMA_MBUF_MAX_SGE segments.
+ *   - -ENOSPC: if no space left to enqueue.
+ *   - other values < 0 on failure.
+ */
+__rte_experimental
+static inline int
+rte_dma_copy_mbuf(int16_t dev_id, uint16_t vchan, const struct rte_mbuf *src,
+		  const struct rte_mbuf *dst, uint64_t flags)
+{
+	struct rte_dma_sge src_sge[RTE_DMA_MBUF_MAX_SGE];
+	struct rte_dma_sge dst_sge[RTE_DMA_MBUF_MAX_SGE];
+	int nb_src, nb_dst;
+
+	/* Single segment on both sides maps to a plain copy */
+	if (likely(src->nb_segs == 1 && dst->nb_segs == 1))
+		return rte_dma_copy(dev_id, vchan, rte_mbuf_data_iova(src),
+			rte_mbuf_data_iova(dst), rte_pktmbuf_data_len(src),
+			flags);
+
+	/* Chain longer than the helper limit is a parameter problem, not a
+	 * transient ring full condition, hence -EINVAL instead of -ENOSPC.
+	 */
+	nb_src = rte_dma_mbuf_to_sge(src, src_sge, RTE_DMA_MBUF_MAX_SGE);
+	if (unlikely(nb_src < 0))
+		return -EINVAL;
+
+	nb_dst = rte_dma_mbuf_to_sge(dst, dst_sge, RTE_DMA_MBUF_MAX_SGE);
+	if (unlikely(nb_dst < 0))
+		return -EINVAL;
+
+	return rte_dma_copy_sg(dev_id, vchan, src_sge, dst_sge, nb_src, nb_dst,
+		flags);
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Enqueue copies for a burst of mbuf chain pairs onto the virtual DMA
+ * channel. Stops at the first chain pair that cannot be enqueued; the most
+ * common cause is the descriptor ring running full, in which case the
+ * caller submits, polls completions and retries the remainder of the burst.
+ *
+ * @param dev_id
+ *   The identifier of the device.
+ * @param vchan
+ *   The identifier of virtual DMA channel.
+ * @param srcs
+ *   Array of source mbuf chains.
+ * @param dsts
+ *   Array of destination mbuf chains, one per source entry.
+ * @param nb_mbufs
+ *   Number of mbuf chain pairs in the burst.
+ * @param flags
+ *   An flags applied to every operation of the burst.
+ *   @see RTE_DMA_OP_FLAG_*
+ *
+ * @return
+ *   The number of chain pairs successfully enqueued.
+ */
+__rte_experimental
+static inline uint16_t
+rte_dma_copy_mbuf_burst(int16_t dev_id, uint16_t vchan,
+			struct rte_mbuf **srcs, struct rte_mbuf **dsts,
+			uint16_t nb_mbufs, uint64_t flags)
+{
+	uint16_t i;
+
+	for (i = 0; i < nb_mbufs; i++)
+		if (rte_dma_copy_mbuf(dev_id, vchan, srcs[i], dsts[i],
+				flags) < 0)
+			break;
+
+	return i;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RTE_DMA_MBUF_H */
@@ -9,6 +9,7 @@
 
 #include <eal_export.h>
 #include <rte_eal.h>
+#include <rte_errno.h>
 #include <rte_lcore.h>
 #include <rte_log.h>
 #include <rte_malloc.h>
@@ -950,6 +951,188 @@ dma_fp_object_dummy(struct rte_dma_fp_object *obj)
 	obj->burst_capacity   = dummy_burst_capacity;
 }
 
+/* Number of completion statuses fetched from a group member in one go */
+#define RTE_DMA_GROUP_STATUS_BURST 32
+
+struct rte_dma_group_member {
+	int16_t dev_id;
+	uint16_t vchan;
+	/* Number of operations enqueued but not yet submitted to hardware */
+	uint16_t n_unsubmitted;
+	/* Completion statuses fetched from this member but not yet reported,
+	 * buffered until the group order reaches them
+	 */
+	uint16_t buf_read;
+	uint16_t buf_avail;
+	enum rte_dma_status_code status_buf[RTE_DMA_GROUP_STATUS_BURST];
+};
+
+struct rte_dma_group {
+	uint16_t n_members;
+	/* Round-robin enqueue cursor */
+	uint16_t next_member;
+	/* Order ring: free running group indices, member ID per entry */
+	uint16_t ring_mask;
+	uint16_t head;
+	uint16_t tail;
+	struct rte_dma_group_member members[RTE_DMA_GROUP_MAX_MEMBERS];
+	uint8_t order[0];
+};
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_dma_group_create, 25.07)
+struct rte_dma_group *
+rte_dma_group_create(const int16_t dev_ids[], const uint16_t vchans[],
+		     uint16_t n_members, uint16_t ring_size, int socket)
+{
+	struct rte_dma_group *group;
+	uint16_t i;
+
+	if (dev_ids == NULL || vchans == NULL || n_members == 0 ||
+	    n_members > RTE_DMA_GROUP_MAX_MEMBERS) {
+		RTE_DMA_LOG(ERR, "Invalid group member parameters");
+		rte_errno = EINVAL;
+		return NULL;
+	}
+
+	if (ring_size == 0 || !rte_is_power_of_2(ring_size)) {
+		RTE_DMA_LOG(ERR, "Group ring size must be a power of 2");
+		rte_errno = EINVAL;
+		return NULL;
+	}
+
+	for (i = 0; i < n_members; i++) {
+		if (!rte_dma_is_valid(dev_ids[i])) {
+			RTE_DMA_LOG(ERR, "Invalid dev_id=%d for group member %u",
+				dev_ids[i], i);
+			rte_errno = EINVAL;
+			return NULL;
+		}
+	}
+
+	group = rte_zmalloc_socket("dma_group",
+		sizeof(struct rte_dma_group) + ring_size * sizeof(uint8_t),
+		RTE_CACHE_LINE_SIZE, socket);
+	if (group == NULL) {
+		RTE_DMA_LOG(ERR, "Cannot allocate group object");
+		rte_errno = ENOMEM;
+		return NULL;
+	}
+
+	group->n_members = n_members;
+	group->ring_mask = ring_size - 1;
+	for (i = 0; i < n_members; i++) {
+		group->members[i].dev_id = dev_ids[i];
+		group->members[i].vchan = vchans[i];
+	}
+
+	return group;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_dma_group_free, 25.07)
+void
+rte_dma_group_free(struct rte_dma_group *group)
+{
+	rte_free(group);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_dma_group_copy, 25.07)
+int
+rte_dma_group_copy(struct rte_dma_group *group, rte_iova_t src, rte_iova_t dst,
+		   uint32_t length, uint64_t flags)
+{
+	struct rte_dma_group_member *member;
+	uint16_t idx = group->head;
+	uint16_t mi, i;
+	int ret = -ENOSPC;
+
+	if ((uint16_t)(idx - group->tail) > group->ring_mask)
+		return -ENOSPC;
+
+	/* Round-robin load balancing, falling over to the next member when
+	 * the preferred one has no descriptor ring space left
+	 */
+	mi = group->next_member;
+	for (i = 0; i < group->n_members; i++) {
+		member = &group->members[mi];
+		ret = rte_dma_copy(member->dev_id, member->vchan, src, dst,
+			length, flags);
+		if (ret != -ENOSPC)
+			break;
+
+		if (++mi == group->n_members)
+			mi = 0;
+	}
+	if (ret < 0)
+		return ret;
+
+	if (!(flags & RTE_DMA_OP_FLAG_SUBMIT))
+		member->n_unsubmitted++;
+
+	group->order[idx & group->ring_mask] = (uint8_t)mi;
+	group->head = idx + 1;
+	group->next_member = (mi + 1 == group->n_members) ? 0 : mi + 1;
+
+	return idx;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_dma_group_submit, 25.07)
+int
+rte_dma_group_submit(struct rte_dma_group *group)
+{
+	struct rte_dma_group_member *member;
+	uint16_t i;
+	int ret;
+
+	for (i = 0; i < group->n_members; i++) {
+		member = &group->members[i];
+		if (member->n_unsubmitted == 0)
+			continue;
+
+		ret = rte_dma_submit(member->dev_id, member->vchan);
+		if (ret != 0)
+			return ret;
+
+		member->n_unsubmitted = 0;
+	}
+
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_dma_group_completed_status, 25.07)
+uint16_t
+rte_dma_group_completed_status(struct rte_dma_group *group,
+			       const uint16_t nb_cpls, uint16_t *last_idx,
+			       enum rte_dma_status_code *status)
+{
+	struct rte_dma_group_member *member;
+	uint16_t n = 0;
+
+	while (n < nb_cpls && group->tail != group->head) {
+		member = &group->members[group->order[group->tail &
+			group->ring_mask]];
+
+		if (member->buf_avail == 0) {
+			member->buf_read = 0;
+			member->buf_avail = rte_dma_completed_status(
+				member->dev_id, member->vchan,
+				RTE_DMA_GROUP_STATUS_BURST, NULL,
+				member->status_buf);
+			/* Oldest outstanding operation not completed yet */
+			if (member->buf_avail == 0)
+				break;
+		}
+
+		status[n++] = member->status_buf[member->buf_read++];
+		member->buf_avail--;
+		group->tail++;
+	}
+
+	if (last_idx != NULL)
+		*last_idx = group->tail - 1;
+
+	return n;
+}
+
 static int
 dmadev_handle_dev_list(const char *cmd __rte_unused,
 		const char *params __rte_unused,
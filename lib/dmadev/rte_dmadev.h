@@ -1153,6 +1153,146 @@ rte_dma_burst_capacity(int16_t dev_id, uint16_t vchan)
 	return ret;
 }
 
+/** Maximum number of (device, virtual DMA channel) members per submission
+ * group.
+ *
+ * @see rte_dma_group_create
+ */
+#define RTE_DMA_GROUP_MAX_MEMBERS 8
+
+/**
+ * DMA submission group: load-balances copy operations across a set of
+ * (device, virtual DMA channel) members and aggregates their completions
+ * into a single poll that reports per-operation status in submission order.
+ */
+struct rte_dma_group;
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Create a DMA submission group.
+ *
+ * All member virtual DMA channels must be configured and started before any
+ * operation is enqueued through the group, and must not be used directly
+ * while the group is in use, as the group tracks the completion order of its
+ * members. Silent mode devices cannot be group members.
+ *
+ * @param dev_ids
+ *   Array of member device identifiers.
+ * @param vchans
+ *   Array of member virtual DMA channel identifiers, one per device entry.
+ * @param n_members
+ *   Number of members, between 1 and RTE_DMA_GROUP_MAX_MEMBERS.
+ * @param ring_size
+ *   Maximum number of outstanding operations tracked by the group. Must be a
+ *   power of 2, and should cover the summed descriptor ring sizes of the
+ *   member channels.
+ * @param socket
+ *   The socket identifier where the group object is allocated.
+ *
+ * @return
+ *   Handle to the submission group, or NULL on error with rte_errno set.
+ */
+__rte_experimental
+struct rte_dma_group *
+rte_dma_group_create(const int16_t dev_ids[], const uint16_t vchans[],
+		     uint16_t n_members, uint16_t ring_size, int socket);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Free a DMA submission group. The member virtual DMA channels are not
+ * affected. The caller must have drained all outstanding operations first.
+ *
+ * @param group
+ *   Handle to the submission group.
+ */
+__rte_experimental
+void
+rte_dma_group_free(struct rte_dma_group *group);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Enqueue a copy operation onto one of the group members, selected round
+ * robin with fall-over to the next member when the preferred one has no
+ * descriptor ring space left.
+ *
+ * @param group
+ *   Handle to the submission group.
+ * @param src
+ *   The address of the source buffer.
+ * @param dst
+ *   The address of the destination buffer.
+ * @param length
+ *   The length of the data to be copied.
+ * @param flags
+ *   An flags for this operation.
+ *   @see RTE_DMA_OP_FLAG_*
+ *
+ * @return
+ *   - 0..UINT16_MAX: group-level index of the enqueued job, increasing in
+ *     submission order and independent of the member ring indices.
+ *   - -ENOSPC: if neither the group order ring nor any member has space.
+ *   - other values < 0 on failure.
+ */
+__rte_experimental
+int
+rte_dma_group_copy(struct rte_dma_group *group, rte_iova_t src, rte_iova_t dst,
+		   uint32_t length, uint64_t flags);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Trigger the doorbell of every group member holding operations enqueued
+ * through the group but not yet submitted to hardware.
+ *
+ * @param group
+ *   Handle to the submission group.
+ *
+ * @return
+ *   0 on success. Otherwise negative value is returned.
+ */
+__rte_experimental
+int
+rte_dma_group_submit(struct rte_dma_group *group);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Return the number of operations enqueued through the group that have been
+ * completed, with per-operation status, in group submission order. A single
+ * call polls all members, interleaving their completions back into the order
+ * in which the operations were enqueued; an operation is only reported once
+ * all operations enqueued before it have completed.
+ *
+ * @param group
+ *   Handle to the submission group.
+ * @param nb_cpls
+ *   Indicates the size of status array.
+ * @param[out] last_idx
+ *   The group-level index of the last completed operation.
+ *   If not required, NULL can be passed in.
+ * @param[out] status
+ *   Array of length 'nb_cpls' filled with the completion status code of each
+ *   operation, in submission order.
+ *   @see enum rte_dma_status_code
+ *
+ * @return
+ *   The number of operations that completed. This return value must be less
+ *   than or equal to the value of nb_cpls.
+ */
+__rte_experimental
+uint16_t
+rte_dma_group_completed_status(struct rte_dma_group *group,
+			       const uint16_t nb_cpls, uint16_t *last_idx,
+			       enum rte_dma_status_code *status);
+
 #ifdef __cplusplus
 }
 #endif
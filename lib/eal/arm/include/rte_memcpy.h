@@ -11,4 +11,24 @@
 #include <rte_memcpy_32.h>
 #endif
 
+/** Bypass the cache for the destination of rte_memcpy_ex(). */
+#define RTE_MEMCPY_F_DST_NT (1u << 0)
+
+/*
+ * No streaming store primitive is wired up on this architecture, so the
+ * non-temporal variants resolve to the plain copy.
+ */
+static inline void *
+rte_memcpy_nt(void *dst, const void *src, size_t n)
+{
+	return rte_memcpy(dst, src, n);
+}
+
+static inline void *
+rte_memcpy_ex(void *dst, const void *src, size_t n, unsigned int flags)
+{
+	(void)flags;
+	return rte_memcpy(dst, src, n);
+}
+
 #endif /* _RTE_MEMCPY_ARM_H_ */
@@ -0,0 +1,282 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2025 Intel Corporation
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/queue.h>
+
+#include <eal_export.h>
+#include <rte_dispatch.h>
+#include <rte_spinlock.h>
+#include <rte_vect.h>
+#ifndef RTE_EXEC_ENV_WINDOWS
+#include <rte_telemetry.h>
+#endif
+
+#include "eal_private.h"
+
+/* Benchmark runs per variant, the minimum is kept. */
+#define DISPATCH_BENCH_RUNS 3
+
+static TAILQ_HEAD(, rte_dispatch_kernel) dispatch_list =
+	TAILQ_HEAD_INITIALIZER(dispatch_list);
+static rte_spinlock_t dispatch_lock = RTE_SPINLOCK_INITIALIZER;
+
+static int
+variant_eligible(const struct rte_dispatch_variant *variant)
+{
+	if (variant->simd_width > rte_vect_get_max_simd_bitwidth())
+		return 0;
+	if (variant->supported != NULL && variant->supported() == 0)
+		return 0;
+	return 1;
+}
+
+static int
+dispatch_select(const struct rte_dispatch_variant *variants,
+	uint16_t nb_variants, rte_dispatch_bench_t bench, void *bench_arg,
+	uint64_t *cycles)
+{
+	uint64_t best_cycles = UINT64_MAX;
+	int best = -ENOTSUP;
+	uint16_t i;
+	int j;
+
+	/* Without a calibration hook the widest eligible variant wins. */
+	if (bench == NULL) {
+		for (i = 0; i < nb_variants; i++) {
+			if (!variant_eligible(&variants[i]))
+				continue;
+			if (best < 0 || variants[i].simd_width >
+					variants[best].simd_width)
+				best = i;
+		}
+		return best;
+	}
+
+	for (i = 0; i < nb_variants; i++) {
+		uint64_t min_cycles = UINT64_MAX;
+
+		if (!variant_eligible(&variants[i]))
+			continue;
+		/*
+		 * Take the minimum over a few runs to shed warm-up
+		 * effects (cold caches, AVX-512 frequency ramp).
+		 */
+		for (j = 0; j < DISPATCH_BENCH_RUNS; j++) {
+			uint64_t c = bench(variants[i].func, bench_arg);
+
+			min_cycles = RTE_MIN(min_cycles, c);
+		}
+		cycles[i] = min_cycles;
+		if (min_cycles < best_cycles) {
+			best_cycles = min_cycles;
+			best = i;
+		}
+	}
+
+	return best;
+}
+
+static struct rte_dispatch_kernel *
+dispatch_lookup(const char *name)
+{
+	struct rte_dispatch_kernel *kernel;
+
+	TAILQ_FOREACH(kernel, &dispatch_list, next) {
+		if (strcmp(kernel->name, name) == 0)
+			return kernel;
+	}
+	return NULL;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_dispatch_register, 25.07)
+int
+rte_dispatch_register(struct rte_dispatch_kernel *kernel)
+{
+	int ret = 0;
+
+	if (kernel == NULL || kernel->name == NULL ||
+			kernel->variants == NULL ||
+			kernel->nb_variants == 0 ||
+			kernel->nb_variants > RTE_DISPATCH_MAX_VARIANTS)
+		return -EINVAL;
+
+	rte_spinlock_lock(&dispatch_lock);
+	if (dispatch_lookup(kernel->name) != NULL) {
+		ret = -EEXIST;
+	} else {
+		kernel->selected = NULL;
+		memset(kernel->cycles, 0, sizeof(kernel->cycles));
+		TAILQ_INSERT_TAIL(&dispatch_list, kernel, next);
+	}
+	rte_spinlock_unlock(&dispatch_lock);
+
+	if (ret == 0)
+		EAL_LOG(DEBUG, "Registered dispatch kernel [%s]",
+			kernel->name);
+	return ret;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_dispatch_unregister, 25.07)
+void
+rte_dispatch_unregister(struct rte_dispatch_kernel *kernel)
+{
+	if (kernel == NULL)
+		return;
+
+	rte_spinlock_lock(&dispatch_lock);
+	TAILQ_REMOVE(&dispatch_list, kernel, next);
+	rte_spinlock_unlock(&dispatch_lock);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_dispatch_bind, 25.07)
+const void *
+rte_dispatch_bind(struct rte_dispatch_kernel *kernel)
+{
+	int best;
+
+	if (kernel == NULL)
+		return NULL;
+
+	best = dispatch_select(kernel->variants, kernel->nb_variants,
+		kernel->bench, kernel->bench_arg, kernel->cycles);
+	if (best < 0) {
+		EAL_LOG(WARNING, "No eligible variant for dispatch kernel [%s]",
+			kernel->name);
+		kernel->selected = NULL;
+		return NULL;
+	}
+
+	kernel->selected = &kernel->variants[best];
+	EAL_LOG(DEBUG, "Dispatch kernel [%s] bound to [%s]",
+		kernel->name, kernel->selected->name);
+	return kernel->selected->func;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_dispatch_func, 25.07)
+const void *
+rte_dispatch_func(struct rte_dispatch_kernel *kernel)
+{
+	if (kernel == NULL)
+		return NULL;
+	if (kernel->selected != NULL)
+		return kernel->selected->func;
+	return rte_dispatch_bind(kernel);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_dispatch_override, 25.07)
+int
+rte_dispatch_override(const char *kernel_name, const char *variant_name)
+{
+	struct rte_dispatch_kernel *kernel;
+	uint16_t i;
+	int ret = -ENOENT;
+
+	if (kernel_name == NULL || variant_name == NULL)
+		return -EINVAL;
+
+	rte_spinlock_lock(&dispatch_lock);
+	kernel = dispatch_lookup(kernel_name);
+	if (kernel != NULL) {
+		for (i = 0; i < kernel->nb_variants; i++) {
+			if (strcmp(kernel->variants[i].name, variant_name) != 0)
+				continue;
+			if (!variant_eligible(&kernel->variants[i])) {
+				ret = -ENOTSUP;
+				break;
+			}
+			kernel->selected = &kernel->variants[i];
+			ret = 0;
+			break;
+		}
+	}
+	rte_spinlock_unlock(&dispatch_lock);
+
+	return ret;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_dispatch_calibrate, 25.07)
+int
+rte_dispatch_calibrate(const struct rte_dispatch_variant *variants,
+	uint16_t nb_variants, rte_dispatch_bench_t bench, void *bench_arg)
+{
+	uint64_t cycles[RTE_DISPATCH_MAX_VARIANTS];
+
+	if (variants == NULL || nb_variants == 0 ||
+			nb_variants > RTE_DISPATCH_MAX_VARIANTS)
+		return -EINVAL;
+
+	return dispatch_select(variants, nb_variants, bench, bench_arg,
+		cycles);
+}
+
+#ifndef RTE_EXEC_ENV_WINDOWS
+
+static int
+handle_dispatch_list(const char *cmd __rte_unused,
+	const char *params __rte_unused, struct rte_tel_data *d)
+{
+	struct rte_dispatch_kernel *kernel;
+
+	rte_tel_data_start_dict(d);
+	rte_spinlock_lock(&dispatch_lock);
+	TAILQ_FOREACH(kernel, &dispatch_list, next)
+		rte_tel_data_add_dict_string(d, kernel->name,
+			kernel->selected != NULL ?
+			kernel->selected->name : "(unbound)");
+	rte_spinlock_unlock(&dispatch_lock);
+
+	return 0;
+}
+
+static int
+handle_dispatch_info(const char *cmd __rte_unused, const char *params,
+	struct rte_tel_data *d)
+{
+	struct rte_dispatch_kernel *kernel;
+	uint16_t i;
+
+	if (params == NULL || strlen(params) == 0)
+		return -EINVAL;
+
+	rte_tel_data_start_dict(d);
+	rte_spinlock_lock(&dispatch_lock);
+	kernel = dispatch_lookup(params);
+	if (kernel == NULL) {
+		rte_spinlock_unlock(&dispatch_lock);
+		return -ENOENT;
+	}
+	rte_tel_data_add_dict_string(d, "selected",
+		kernel->selected != NULL ? kernel->selected->name :
+		"(unbound)");
+	for (i = 0; i < kernel->nb_variants; i++) {
+		struct rte_tel_data *var = rte_tel_data_alloc();
+
+		if (var == NULL)
+			break;
+		rte_tel_data_start_dict(var);
+		rte_tel_data_add_dict_int(var, "simd_width",
+			kernel->variants[i].simd_width);
+		rte_tel_data_add_dict_int(var, "eligible",
+			variant_eligible(&kernel->variants[i]));
+		rte_tel_data_add_dict_uint(var, "cycles",
+			kernel->cycles[i]);
+		rte_tel_data_add_dict_container(d, kernel->variants[i].name,
+			var, 0);
+	}
+	rte_spinlock_unlock(&dispatch_lock);
+
+	return 0;
+}
+
+RTE_INIT(dispatch_telemetry)
+{
+	rte_telemetry_register_cmd("/eal/dispatch/list", handle_dispatch_list,
+		"Bound variant of each dispatch kernel. Takes no parameters");
+	rte_telemetry_register_cmd("/eal/dispatch/info", handle_dispatch_info,
+		"Returns variant details of a dispatch kernel. Parameters: kernel name");
+}
+#endif /* !RTE_EXEC_ENV_WINDOWS */
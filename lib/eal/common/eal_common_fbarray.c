@@ -9,6 +9,7 @@
 #include <string.h>
 #include <unistd.h>
 
+#include <rte_bitops.h>
 #include <rte_common.h>
 #include <rte_eal_paging.h>
 #include <rte_errno.h>
@@ -46,6 +47,15 @@ static rte_spinlock_t mem_area_lock = RTE_SPINLOCK_INITIALIZER;
 /*
  * This is a mask that is always stored at the end of array, to provide fast
  * way of finding free/used spots without looping through each element.
+ *
+ * The mask itself is followed by a two-level rollup index, one per search
+ * type. Each bit in a level-1 rollup word summarizes one mask word, and each
+ * bit in a level-2 rollup word summarizes one level-1 word. A set rollup bit
+ * always means "nothing to find here": for free searches it marks mask words
+ * that are fully used, for used searches it marks mask words that are fully
+ * free. This way, searches over large but mostly occupied (or mostly empty)
+ * arrays skip up to MASK_ALIGN * MASK_ALIGN mask words per rollup lookup
+ * instead of reading every mask word.
  */
 
 struct used_mask {
@@ -53,15 +63,28 @@ struct used_mask {
 	uint64_t data[];
 };
 
+/* how many rollup words are needed to cover n lower-level words */
+static unsigned int
+calc_rollup_len(unsigned int n)
+{
+	return MASK_LEN_TO_IDX(RTE_ALIGN_CEIL(n, MASK_ALIGN));
+}
+
 static size_t
 calc_mask_size(unsigned int len)
 {
+	unsigned int n_masks, n_l1, n_l2;
+
 	/* mask must be multiple of MASK_ALIGN, even though length of array
 	 * itself may not be aligned on that boundary.
 	 */
 	len = RTE_ALIGN_CEIL(len, MASK_ALIGN);
+	n_masks = MASK_LEN_TO_IDX(len);
+	n_l1 = calc_rollup_len(n_masks);
+	n_l2 = calc_rollup_len(n_l1);
+	/* two rollup levels for each of the two search types */
 	return sizeof(struct used_mask) +
-			sizeof(uint64_t) * MASK_LEN_TO_IDX(len);
+			sizeof(uint64_t) * (n_masks + 2 * (n_l1 + n_l2));
 }
 
 static size_t
@@ -78,6 +101,132 @@ get_used_mask(void *data, unsigned int elt_sz, unsigned int len)
 	return (struct used_mask *) RTE_PTR_ADD(data, elt_sz * len);
 }
 
+/*
+ * Get rollup level 1 or 2 for given search type. The rollup words are stored
+ * right after the mask words, free search rollups first.
+ */
+static uint64_t *
+get_skip_rollup(const struct used_mask *msk, bool used, unsigned int lvl)
+{
+	unsigned int n_l1 = calc_rollup_len(msk->n_masks);
+	unsigned int n_l2 = calc_rollup_len(n_l1);
+	uint64_t *base = (uint64_t *)(uintptr_t)&msk->data[msk->n_masks];
+
+	if (used)
+		base += n_l1 + n_l2;
+	return lvl == 1 ? base : base + n_l1;
+}
+
+static void
+rollup_bit_update(uint64_t *rollup, unsigned int idx, bool skip)
+{
+	uint64_t bit = 1ULL << MASK_LEN_TO_MOD(idx);
+	unsigned int word = MASK_LEN_TO_IDX(idx);
+
+	if (skip)
+		rollup[word] |= bit;
+	else
+		rollup[word] &= ~bit;
+}
+
+static void
+rollup_update_one(struct used_mask *msk, unsigned int msk_idx, bool used)
+{
+	uint64_t *l1 = get_skip_rollup(msk, used, 1);
+	uint64_t *l2 = get_skip_rollup(msk, used, 2);
+	unsigned int l1_idx = MASK_LEN_TO_IDX(msk_idx);
+	uint64_t word = msk->data[msk_idx];
+	bool skip = used ? word == 0 : word == UINT64_MAX;
+
+	rollup_bit_update(l1, msk_idx, skip);
+	rollup_bit_update(l2, l1_idx, l1[l1_idx] == UINT64_MAX);
+}
+
+/* resync both rollups after mask word at msk_idx has changed */
+static void
+rollup_update(struct used_mask *msk, unsigned int msk_idx)
+{
+	rollup_update_one(msk, msk_idx, false);
+	rollup_update_one(msk, msk_idx, true);
+}
+
+/*
+ * Rollup words cover the mask area rounded up to MASK_ALIGN words, so mark
+ * bits covering nonexistent mask words as "skip" to keep searches away from
+ * them. A new array is fully free, so for used searches everything is
+ * skippable to begin with.
+ */
+static void
+rollup_init(struct used_mask *msk)
+{
+	unsigned int n_l1 = calc_rollup_len(msk->n_masks);
+	unsigned int n_l2 = calc_rollup_len(n_l1);
+	uint64_t *l1, *l2;
+	unsigned int i;
+
+	l1 = get_skip_rollup(msk, true, 1);
+	l2 = get_skip_rollup(msk, true, 2);
+	memset(l1, 0xff, sizeof(uint64_t) * n_l1);
+	memset(l2, 0xff, sizeof(uint64_t) * n_l2);
+
+	l1 = get_skip_rollup(msk, false, 1);
+	l2 = get_skip_rollup(msk, false, 2);
+	for (i = msk->n_masks; i < n_l1 * MASK_ALIGN; i++)
+		rollup_bit_update(l1, i, true);
+	for (i = 0; i < n_l1; i++)
+		rollup_bit_update(l2, i, l1[i] == UINT64_MAX);
+	for (i = n_l1; i < n_l2 * MASK_ALIGN; i++)
+		rollup_bit_update(l2, i, true);
+}
+
+/*
+ * Find the first mask word at or after msk_idx that the rollup index does not
+ * rule out for this search type. Returns n_masks when the rollup rules out
+ * everything from msk_idx onwards.
+ */
+static unsigned int
+rollup_next_candidate(const struct used_mask *msk, unsigned int msk_idx,
+		bool used)
+{
+	const uint64_t *l1 = get_skip_rollup(msk, used, 1);
+	const uint64_t *l2 = get_skip_rollup(msk, used, 2);
+	unsigned int n_l1 = calc_rollup_len(msk->n_masks);
+	unsigned int l1_idx, l2_idx;
+	uint64_t cur;
+
+	if (msk_idx >= msk->n_masks)
+		return msk->n_masks;
+
+	/* check remainder of the level-1 word covering msk_idx first */
+	l1_idx = MASK_LEN_TO_IDX(msk_idx);
+	cur = ~l1[l1_idx] & (UINT64_MAX << MASK_LEN_TO_MOD(msk_idx));
+	if (cur != 0)
+		return MASK_GET_IDX(l1_idx, rte_ctz64(cur));
+
+	/* no candidates under this level-1 word, use level 2 to skip ahead */
+	l1_idx++;
+	for (l2_idx = MASK_LEN_TO_IDX(l1_idx); l2_idx < calc_rollup_len(n_l1);
+			l2_idx++) {
+		uint64_t cur2 = ~l2[l2_idx];
+
+		if (l2_idx == MASK_LEN_TO_IDX(l1_idx))
+			cur2 &= UINT64_MAX << MASK_LEN_TO_MOD(l1_idx);
+
+		while (cur2 != 0) {
+			unsigned int i = MASK_GET_IDX(l2_idx, rte_ctz64(cur2));
+
+			/* padding bits are always set, so a clear level-2 bit
+			 * guarantees a candidate within a valid mask word.
+			 */
+			cur = ~l1[i];
+			if (cur != 0)
+				return MASK_GET_IDX(i, rte_ctz64(cur));
+			cur2 &= cur2 - 1;
+		}
+	}
+	return msk->n_masks;
+}
+
 static int
 resize_and_map(int fd, const char *path, void *addr, size_t len)
 {
@@ -165,6 +314,16 @@ find_next_n(const struct rte_fbarray *arr, unsigned int start, unsigned int n,
 		 * we either run out of masks, lose the run, or find what we
 		 * were looking for.
 		 */
+
+		/* unless we need to resume a partial scan with an ignore mask,
+		 * let the rollup index skip words with nothing to find.
+		 */
+		if (ignore_msk == 0) {
+			msk_idx = rollup_next_candidate(msk, msk_idx, used);
+			if (msk_idx >= msk->n_masks)
+				break;
+		}
+
 		cur_msk = msk->data[msk_idx];
 		left = n;
 
@@ -295,9 +454,16 @@ find_next(const struct rte_fbarray *arr, unsigned int start, bool used)
 	last_msk = ~(-(1ULL) << last_mod);
 
 	for (idx = first; idx < msk->n_masks; idx++) {
-		uint64_t cur = msk->data[idx];
+		uint64_t cur;
 		int found;
 
+		/* let the rollup index skip words with nothing to find */
+		idx = rollup_next_candidate(msk, idx, used);
+		if (idx >= msk->n_masks)
+			break;
+
+		cur = msk->data[idx];
+
 		/* if we're looking for free entries, invert mask */
 		if (!used)
 			cur = ~cur;
@@ -369,8 +535,21 @@ find_contig(const struct rte_fbarray *arr, unsigned int start, bool used)
 		cur = ~cur;
 
 		/* if mask is zero, we have a complete run */
-		if (cur == 0)
+		if (cur == 0) {
+			unsigned int next_idx;
+
+			/* use the rollup index to skip over words that only
+			 * continue the run, stopping short of the last word as
+			 * its padding bits need to be masked off.
+			 */
+			next_idx = rollup_next_candidate(msk, idx + 1, !used);
+			next_idx = RTE_MIN(next_idx, last);
+			if (next_idx > idx + 1) {
+				need_len += MASK_ALIGN * (next_idx - idx - 1);
+				idx = next_idx - 1;
+			}
 			continue;
+		}
 
 		/*
 		 * see if current run ends before mask end.
@@ -695,12 +874,68 @@ set_used(struct rte_fbarray *arr, unsigned int idx, bool used)
 		msk->data[msk_idx] &= ~msk_bit;
 		arr->count--;
 	}
+	rollup_update(msk, msk_idx);
 out:
 	rte_rwlock_write_unlock(&arr->rwlock);
 
 	return ret;
 }
 
+static int
+set_used_range(struct rte_fbarray *arr, unsigned int start, unsigned int len,
+		bool used)
+{
+	struct used_mask *msk;
+	unsigned int first, last, i;
+
+	if (arr == NULL || start >= arr->len || len > arr->len - start) {
+		rte_errno = EINVAL;
+		return -1;
+	}
+	/* nothing to be done */
+	if (len == 0)
+		return 0;
+
+	msk = get_used_mask(arr->data, arr->elt_sz, arr->len);
+	first = MASK_LEN_TO_IDX(start);
+	last = MASK_LEN_TO_IDX(start + len - 1);
+
+	/* prevent array from changing under us */
+	rte_rwlock_write_lock(&arr->rwlock);
+
+	for (i = first; i <= last; i++) {
+		uint64_t old = msk->data[i];
+		uint64_t bits = UINT64_MAX;
+		uint64_t new;
+
+		/* mask off everything before start and after end of range */
+		if (i == first)
+			bits &= UINT64_MAX << MASK_LEN_TO_MOD(start);
+		if (i == last) {
+			unsigned int last_mod = MASK_LEN_TO_MOD(start + len - 1);
+
+			if (last_mod != MASK_ALIGN - 1)
+				bits &= ~(UINT64_MAX << (last_mod + 1));
+		}
+
+		new = used ? old | bits : old & ~bits;
+		if (new == old)
+			continue;
+
+		msk->data[i] = new;
+		/* adjust count by however many bits have actually flipped */
+		if (used)
+			arr->count += rte_popcount64(new ^ old);
+		else
+			arr->count -= rte_popcount64(new ^ old);
+		rollup_update(msk, i);
+	}
+
+	rte_rwlock_write_unlock(&arr->rwlock);
+
+	return 0;
+}
+
 static int
 fully_validate(const char *name, unsigned int elt_sz, unsigned int len)
 {
@@ -826,6 +1061,7 @@ rte_fbarray_init(struct rte_fbarray *arr, const char *name, unsigned int len,
 
 	msk = get_used_mask(data, elt_sz, len);
 	msk->n_masks = MASK_LEN_TO_IDX(RTE_ALIGN_CEIL(len, MASK_ALIGN));
+	rollup_init(msk);
 
 	rte_rwlock_init(&arr->rwlock);
 
@@ -1107,6 +1343,22 @@ rte_fbarray_set_free(struct rte_fbarray *arr, unsigned int idx)
 	return set_used(arr, idx, false);
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_fbarray_set_used_range, 25.07)
+int
+rte_fbarray_set_used_range(struct rte_fbarray *arr, unsigned int start,
+		unsigned int len)
+{
+	return set_used_range(arr, start, len, true);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_fbarray_set_free_range, 25.07)
+int
+rte_fbarray_set_free_range(struct rte_fbarray *arr, unsigned int start,
+		unsigned int len)
+{
+	return set_used_range(arr, start, len, false);
+}
+
 RTE_EXPORT_SYMBOL(rte_fbarray_is_used)
 int
 rte_fbarray_is_used(struct rte_fbarray *arr, unsigned int idx)
@@ -2,8 +2,10 @@
  * Copyright(c) 2024 Ericsson AB
  */
 
+#include <errno.h>
 #include <inttypes.h>
 #include <stdlib.h>
+#include <string.h>
 
 #ifdef RTE_EXEC_ENV_WINDOWS
 #include <malloc.h>
@@ -12,6 +14,7 @@
 #include <rte_common.h>
 #include <rte_debug.h>
 #include <rte_log.h>
+#include <rte_stdatomic.h>
 
 #include <rte_lcore_var.h>
 
@@ -103,6 +106,153 @@ rte_lcore_var_alloc(size_t size, size_t align)
 	return lcore_var_alloc(size, align);
 }
 
+/*
+ * Each lcore id's shadow region starts with a cache line holding the
+ * publication generation counter, followed by the two shadow buffers.
+ * A generation of zero means nothing has been published yet; the
+ * buffer exposed to readers is selected by the generation's low bit.
+ */
+struct rte_lcore_var_snapshot {
+	void *handle;
+	size_t size;
+	/* size of one shadow buffer, cache line aligned */
+	size_t buf_size;
+	char *shadows;
+};
+
+static RTE_ATOMIC(uint32_t) *
+snapshot_gen(const struct rte_lcore_var_snapshot *snapshot, unsigned int lcore_id)
+{
+	size_t stride = RTE_CACHE_LINE_SIZE + 2 * snapshot->buf_size;
+
+	return (RTE_ATOMIC(uint32_t) *)(uintptr_t)
+		&snapshot->shadows[lcore_id * stride];
+}
+
+static void *
+snapshot_buf(const struct rte_lcore_var_snapshot *snapshot, unsigned int lcore_id,
+		uint32_t gen)
+{
+	size_t stride = RTE_CACHE_LINE_SIZE + 2 * snapshot->buf_size;
+
+	return (void *)(uintptr_t)&snapshot->shadows[lcore_id * stride +
+		RTE_CACHE_LINE_SIZE + (gen & 1) * snapshot->buf_size];
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_lcore_var_snapshot_create, 25.07)
+struct rte_lcore_var_snapshot *
+rte_lcore_var_snapshot_create(void *handle, size_t size)
+{
+	struct rte_lcore_var_snapshot *snapshot;
+	size_t shadows_size;
+
+	RTE_VERIFY(handle != NULL);
+	RTE_VERIFY(size > 0 && size <= RTE_MAX_LCORE_VAR);
+
+	snapshot = malloc(sizeof(*snapshot));
+	if (snapshot == NULL)
+		return NULL;
+
+	snapshot->handle = handle;
+	snapshot->size = size;
+	snapshot->buf_size = RTE_ALIGN_CEIL(size, RTE_CACHE_LINE_SIZE);
+
+	shadows_size = RTE_MAX_LCORE *
+		(RTE_CACHE_LINE_SIZE + 2 * snapshot->buf_size);
+#ifdef RTE_EXEC_ENV_WINDOWS
+	snapshot->shadows = _aligned_malloc(shadows_size, RTE_CACHE_LINE_SIZE);
+#else
+	snapshot->shadows = aligned_alloc(RTE_CACHE_LINE_SIZE, shadows_size);
+#endif
+	if (snapshot->shadows == NULL) {
+		free(snapshot);
+		return NULL;
+	}
+
+	/* all generation counters start out at zero (i.e., unpublished) */
+	memset(snapshot->shadows, 0, shadows_size);
+
+	return snapshot;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_lcore_var_snapshot_free, 25.07)
+void
+rte_lcore_var_snapshot_free(struct rte_lcore_var_snapshot *snapshot)
+{
+	if (snapshot == NULL)
+		return;
+
+#ifdef RTE_EXEC_ENV_WINDOWS
+	_aligned_free(snapshot->shadows);
+#else
+	free(snapshot->shadows);
+#endif
+	free(snapshot);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_lcore_var_snapshot_publish, 25.07)
+void
+rte_lcore_var_snapshot_publish(struct rte_lcore_var_snapshot *snapshot)
+{
+	unsigned int lcore_id = rte_lcore_id();
+	RTE_ATOMIC(uint32_t) *gen_addr;
+	uint32_t gen;
+
+	RTE_ASSERT(lcore_id < RTE_MAX_LCORE);
+
+	gen_addr = snapshot_gen(snapshot, lcore_id);
+
+	/* only the owner advances the generation counter */
+	gen = rte_atomic_load_explicit(gen_addr, rte_memory_order_relaxed) + 1;
+
+	memcpy(snapshot_buf(snapshot, lcore_id, gen),
+		rte_lcore_var_lcore(lcore_id, snapshot->handle),
+		snapshot->size);
+
+	/* expose the new copy to readers */
+	rte_atomic_store_explicit(gen_addr, gen, rte_memory_order_release);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_lcore_var_snapshot_read, 25.07)
+int
+rte_lcore_var_snapshot_read(const struct rte_lcore_var_snapshot *snapshot,
+		unsigned int lcore_id, void *dst)
+{
+	RTE_ATOMIC(uint32_t) *gen_addr;
+	uint32_t gen, new_gen;
+
+	if (lcore_id >= RTE_MAX_LCORE)
+		return -EINVAL;
+
+	gen_addr = snapshot_gen(snapshot, lcore_id);
+
+	gen = rte_atomic_load_explicit(gen_addr, rte_memory_order_acquire);
+	if (gen == 0)
+		return -ENODATA;
+
+	for (;;) {
+		memcpy(dst, snapshot_buf(snapshot, lcore_id, gen),
+			snapshot->size);
+
+		/* ensure the copy is complete before rechecking */
+		rte_atomic_thread_fence(rte_memory_order_acquire);
+
+		new_gen = rte_atomic_load_explicit(gen_addr,
+			rte_memory_order_relaxed);
+
+		/*
+		 * With two buffers, the copied buffer has only been
+		 * overwritten if the owner published at least twice
+		 * since the generation was sampled.
+		 */
+		if (new_gen - gen < 2)
+			return 0;
+
+		gen = new_gen;
+		rte_atomic_thread_fence(rte_memory_order_acquire);
+	}
+}
+
 void
 eal_lcore_var_cleanup(void)
 {
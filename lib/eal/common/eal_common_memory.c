@@ -17,6 +17,10 @@
 #include <rte_eal_paging.h>
 #include <rte_errno.h>
 #include <rte_log.h>
+#include <rte_pause.h>
+#include <rte_service_component.h>
+#include <rte_stdatomic.h>
+#include <rte_string_fns.h>
 #ifndef RTE_EXEC_ENV_WINDOWS
 #include <rte_telemetry.h>
 #endif
@@ -782,6 +786,98 @@ rte_memseg_walk(rte_memseg_walk_t func, void *arg)
 	return ret;
 }
 
+/* pre-fault state: 0 = not started, 1 = in progress, 2 = complete */
+static RTE_ATOMIC(uint32_t) mem_prefault_state;
+static uint32_t mem_prefault_service_id;
+
+static int
+mem_prefault_seg(const struct rte_memseg_list *msl,
+		const struct rte_memseg *ms, void *arg __rte_unused)
+{
+	size_t off;
+
+	if (msl->external)
+		return 0;
+
+	/*
+	 * A plain read is enough to fault the page in; a write-back
+	 * would race with application stores to live segments.
+	 */
+	for (off = 0; off < ms->len; off += msl->page_sz) {
+		volatile const int *p = RTE_PTR_ADD(ms->addr, off);
+		(void)*p;
+	}
+
+	return 0;
+}
+
+static int32_t
+mem_prefault_service_run(void *arg __rte_unused)
+{
+	rte_memseg_walk(mem_prefault_seg, NULL);
+	rte_atomic_store_explicit(&mem_prefault_state, 2,
+			rte_memory_order_release);
+
+	/* one-shot service, stop being scheduled once done */
+	rte_service_component_runstate_set(mem_prefault_service_id, 0);
+
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_mem_prefault_start, 25.07)
+int
+rte_mem_prefault_start(uint32_t *service_id)
+{
+	struct rte_service_spec spec;
+	uint32_t expected = 0;
+	int ret;
+
+	if (service_id == NULL)
+		return -EINVAL;
+
+	if (!rte_atomic_compare_exchange_strong_explicit(&mem_prefault_state,
+			&expected, 1, rte_memory_order_acquire,
+			rte_memory_order_relaxed))
+		return -EALREADY;
+
+	memset(&spec, 0, sizeof(spec));
+	strlcpy(spec.name, "mem_prefault", sizeof(spec.name));
+	spec.callback = mem_prefault_service_run;
+
+	ret = rte_service_component_register(&spec, &mem_prefault_service_id);
+	if (ret != 0) {
+		rte_atomic_store_explicit(&mem_prefault_state, 0,
+				rte_memory_order_release);
+		return ret;
+	}
+	rte_service_component_runstate_set(mem_prefault_service_id, 1);
+
+	*service_id = mem_prefault_service_id;
+
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_mem_prefault_wait, 25.07)
+void
+rte_mem_prefault_wait(void)
+{
+	uint32_t expected = 0;
+
+	/* not started in the background, fault everything from here */
+	if (rte_atomic_compare_exchange_strong_explicit(&mem_prefault_state,
+			&expected, 1, rte_memory_order_acquire,
+			rte_memory_order_relaxed)) {
+		rte_memseg_walk(mem_prefault_seg, NULL);
+		rte_atomic_store_explicit(&mem_prefault_state, 2,
+				rte_memory_order_release);
+		return;
+	}
+
+	while (rte_atomic_load_explicit(&mem_prefault_state,
+			rte_memory_order_acquire) != 2)
+		rte_pause();
+}
+
 RTE_EXPORT_SYMBOL(rte_memseg_list_walk_thread_unsafe)
 int
 rte_memseg_list_walk_thread_unsafe(rte_memseg_list_walk_t func, void *arg)
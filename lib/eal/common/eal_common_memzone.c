@@ -15,6 +15,7 @@
 #include <rte_memzone.h>
 #include <rte_eal.h>
 #include <rte_errno.h>
+#include <rte_lcore.h>
 #include <rte_string_fns.h>
 #include <rte_common.h>
 
@@ -367,6 +368,153 @@ rte_memzone_lookup(const char *name)
 	return memzone;
 }
 
+/* per-socket replicas share the user name with a socket id suffix */
+static int
+memzone_replica_name(char *buf, size_t buflen, const char *name, int socket_id)
+{
+	int ret;
+
+	ret = snprintf(buf, buflen, "%s#%d", name, socket_id);
+	if (ret < 0 || ret >= (int)buflen) {
+		rte_errno = ENAMETOOLONG;
+		return -1;
+	}
+
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_memzone_reserve_replicated, 25.07)
+const struct rte_memzone *
+rte_memzone_reserve_replicated(const char *name, size_t len,
+		unsigned int flags, unsigned int align)
+{
+	char rname[RTE_MEMZONE_NAMESIZE];
+	const struct rte_memzone *local = NULL;
+	unsigned int i, j;
+	int socket_id;
+
+	for (i = 0; i < rte_socket_count(); i++) {
+		const struct rte_memzone *mz;
+
+		socket_id = rte_socket_id_by_idx(i);
+		if (memzone_replica_name(rname, sizeof(rname), name,
+				socket_id) < 0)
+			goto rollback;
+
+		mz = rte_memzone_reserve_aligned(rname, len, socket_id,
+				flags, align);
+		if (mz == NULL)
+			goto rollback;
+
+		if (local == NULL ||
+				(unsigned int)socket_id == rte_socket_id())
+			local = mz;
+	}
+
+	return local;
+
+rollback:
+	for (j = 0; j < i; j++) {
+		socket_id = rte_socket_id_by_idx(j);
+		if (memzone_replica_name(rname, sizeof(rname), name,
+				socket_id) == 0)
+			rte_memzone_free(rte_memzone_lookup(rname));
+	}
+	return NULL;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_memzone_lookup_local, 25.07)
+const struct rte_memzone *
+rte_memzone_lookup_local(const char *name)
+{
+	char rname[RTE_MEMZONE_NAMESIZE];
+	const struct rte_memzone *mz;
+	unsigned int i;
+
+	if (memzone_replica_name(rname, sizeof(rname), name,
+			rte_socket_id()) == 0) {
+		mz = rte_memzone_lookup(rname);
+		if (mz != NULL)
+			return mz;
+	}
+
+	/* no replica on the caller's socket, fall back to any */
+	for (i = 0; i < rte_socket_count(); i++) {
+		if (memzone_replica_name(rname, sizeof(rname), name,
+				rte_socket_id_by_idx(i)) < 0)
+			continue;
+		mz = rte_memzone_lookup(rname);
+		if (mz != NULL)
+			return mz;
+	}
+
+	return NULL;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_memzone_replicated_update, 25.07)
+int
+rte_memzone_replicated_update(const char *name, size_t offset,
+		const void *src, size_t len)
+{
+	char rname[RTE_MEMZONE_NAMESIZE];
+	const struct rte_memzone *mz;
+	unsigned int i, nb_updated = 0;
+
+	for (i = 0; i < rte_socket_count(); i++) {
+		if (memzone_replica_name(rname, sizeof(rname), name,
+				rte_socket_id_by_idx(i)) < 0)
+			return -1;
+
+		mz = rte_memzone_lookup(rname);
+		if (mz == NULL)
+			continue;
+
+		if (offset > mz->len || len > mz->len - offset) {
+			rte_errno = EINVAL;
+			return -1;
+		}
+
+		memcpy(RTE_PTR_ADD(mz->addr, offset), src, len);
+		nb_updated++;
+	}
+
+	if (nb_updated == 0) {
+		rte_errno = ENOENT;
+		return -1;
+	}
+
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_memzone_free_replicated, 25.07)
+int
+rte_memzone_free_replicated(const char *name)
+{
+	char rname[RTE_MEMZONE_NAMESIZE];
+	const struct rte_memzone *mz;
+	unsigned int i, nb_freed = 0;
+
+	for (i = 0; i < rte_socket_count(); i++) {
+		if (memzone_replica_name(rname, sizeof(rname), name,
+				rte_socket_id_by_idx(i)) < 0)
+			return -1;
+
+		mz = rte_memzone_lookup(rname);
+		if (mz == NULL)
+			continue;
+
+		rte_memzone_free(mz);
+		nb_freed++;
+	}
+
+	if (nb_freed == 0) {
+		rte_errno = ENOENT;
+		return -1;
+	}
+
+	return 0;
+}
+
 struct memzone_info {
 	FILE *f;
 	uint64_t total_size;
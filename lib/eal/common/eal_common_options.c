@@ -106,6 +106,7 @@ eal_long_options[] = {
 	{OPT_NO_TELEMETRY,      0, NULL, OPT_NO_TELEMETRY_NUM     },
 	{OPT_FORCE_MAX_SIMD_BITWIDTH, 1, NULL, OPT_FORCE_MAX_SIMD_BITWIDTH_NUM},
 	{OPT_HUGE_WORKER_STACK, 2, NULL, OPT_HUGE_WORKER_STACK_NUM     },
+	{OPT_DEFER_PREFAULT,    0, NULL, OPT_DEFER_PREFAULT_NUM   },
 
 	{0,                     0, NULL, 0                        }
 };
@@ -2062,6 +2063,16 @@ eal_check_common_options(struct internal_config *internal_cfg)
 				"with --"OPT_MATCH_ALLOCATIONS);
 		return -1;
 	}
+	if (internal_cfg->legacy_mem && internal_cfg->defer_prefault) {
+		EAL_LOG(ERR, "Option --"OPT_LEGACY_MEM" is not compatible "
+				"with --"OPT_DEFER_PREFAULT);
+		return -1;
+	}
+	if (internal_cfg->no_hugetlbfs && internal_cfg->defer_prefault) {
+		EAL_LOG(ERR, "Option --"OPT_NO_HUGE" is not compatible "
+				"with --"OPT_DEFER_PREFAULT);
+		return -1;
+	}
 	if (internal_cfg->legacy_mem && internal_cfg->memory == 0) {
 		EAL_LOG(NOTICE, "Static memory layout is selected, "
 			"amount of reserved memory can be adjusted with "
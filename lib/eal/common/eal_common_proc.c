@@ -26,6 +26,8 @@
 #include <rte_errno.h>
 #include <rte_lcore.h>
 #include <rte_log.h>
+#include <rte_memzone.h>
+#include <rte_pause.h>
 #include <rte_thread.h>
 
 #include <eal_export.h>
@@ -53,6 +55,61 @@ TAILQ_HEAD(action_entry_list, action_entry);
 static struct action_entry_list action_entry_list =
 	TAILQ_HEAD_INITIALIZER(action_entry_list);
 
+/* Shared-memory fast request queue.
+ *
+ * High-frequency secondary-to-primary requests can bypass the socket
+ * channel: requests are submitted into preallocated slots of a shared
+ * memzone and served by a dedicated thread in the primary process, so
+ * they neither allocate memory nor contend with the mp thread. Messages
+ * carrying file descriptors still go through the socket.
+ */
+#define MP_FASTQ_MZ "mp_fastq"
+#define MP_FASTQ_SLOTS 64
+
+/* slot life cycle: FREE -> FILL -> READY -> PROC -> DONE/ERR -> FREE */
+enum mp_fastq_state {
+	MP_FASTQ_FREE,  /* slot available to requesters */
+	MP_FASTQ_FILL,  /* a requester is writing the request */
+	MP_FASTQ_READY, /* request complete, waiting for the primary */
+	MP_FASTQ_PROC,  /* the primary is handling the request */
+	MP_FASTQ_DONE,  /* reply available */
+	MP_FASTQ_ERR,   /* handler failed or is missing, no reply */
+};
+
+/* like struct rte_mp_msg, minus the fd array that cannot cross processes */
+struct mp_fastq_msg {
+	char name[RTE_MP_MAX_NAME_LEN];
+	int len_param;
+	uint8_t param[RTE_MP_MAX_PARAM_LEN];
+};
+
+struct __rte_cache_aligned mp_fastq_slot {
+	RTE_ATOMIC(uint32_t) state;
+	struct mp_fastq_msg req;
+	struct mp_fastq_msg rep;
+};
+
+struct mp_fastq {
+	struct mp_fastq_slot slots[MP_FASTQ_SLOTS];
+};
+
+struct fast_action_entry {
+	TAILQ_ENTRY(fast_action_entry) next;
+	char action_name[RTE_MP_MAX_NAME_LEN];
+	rte_mp_fast_t action;
+};
+
+/** Double linked list of fast actions. */
+TAILQ_HEAD(fast_action_entry_list, fast_action_entry);
+
+static struct fast_action_entry_list fast_action_entry_list =
+	TAILQ_HEAD_INITIALIZER(fast_action_entry_list);
+
+/* created by the primary, looked up once by each secondary */
+static struct mp_fastq *mp_fastq;
+static rte_thread_t mp_fastq_tid;
+static RTE_ATOMIC(bool) mp_fastq_run;
+
 enum mp_type {
 	MP_MSG, /* Share message with peers, will not block */
 	MP_REQ, /* Request for information, Will block for a reply */
@@ -107,6 +164,9 @@ static struct {
 static int
 mp_send(struct rte_mp_msg *msg, const char *peer, int type);
 
+static void
+mp_fastq_cleanup(void);
+
 /* for use with alarm callback */
 static void
 async_reply_handle(void *arg);
@@ -672,6 +732,8 @@ rte_mp_channel_cleanup(void)
 {
 	int fd;
 
+	mp_fastq_cleanup();
+
 	fd = rte_atomic_exchange_explicit(&mp_fd, -1, rte_memory_order_relaxed);
 	if (fd < 0)
 		return;
@@ -1270,6 +1332,336 @@ rte_mp_reply(struct rte_mp_msg *msg, const char *peer)
 	return mp_send(msg, peer, MP_REP);
 }
 
+static struct fast_action_entry *
+find_fast_action_entry_by_name(const char *name)
+{
+	struct fast_action_entry *entry;
+
+	TAILQ_FOREACH(entry, &fast_action_entry_list, next) {
+		if (strncmp(entry->action_name, name, RTE_MP_MAX_NAME_LEN) == 0)
+			break;
+	}
+
+	return entry;
+}
+
+/* serve one slot; returns 1 if a request was handled */
+static int
+mp_fastq_process(struct mp_fastq_slot *slot)
+{
+	struct fast_action_entry *entry;
+	struct rte_mp_msg req, rep;
+	rte_mp_fast_t action = NULL;
+	uint32_t expected = MP_FASTQ_READY;
+
+	/* CAS because a timed out requester may reclaim a READY slot */
+	if (!rte_atomic_compare_exchange_strong_explicit(&slot->state,
+			&expected, MP_FASTQ_PROC,
+			rte_memory_order_acquire, rte_memory_order_relaxed))
+		return 0;
+
+	memset(&req, 0, sizeof(req));
+	memcpy(req.name, slot->req.name, RTE_MP_MAX_NAME_LEN);
+	req.len_param = slot->req.len_param;
+	memcpy(req.param, slot->req.param, RTE_MP_MAX_PARAM_LEN);
+	memset(&rep, 0, sizeof(rep));
+
+	pthread_mutex_lock(&mp_mutex_action);
+	entry = find_fast_action_entry_by_name(req.name);
+	if (entry != NULL)
+		action = entry->action;
+	pthread_mutex_unlock(&mp_mutex_action);
+
+	if (action == NULL) {
+		EAL_LOG(ERR, "Cannot find fast action: %s", req.name);
+		rte_atomic_store_explicit(&slot->state, MP_FASTQ_ERR,
+				rte_memory_order_release);
+		return 1;
+	}
+
+	if (action(&req, &rep) < 0 || rep.num_fds != 0) {
+		EAL_LOG(ERR, "Fail to handle fast request: %s", req.name);
+		rte_atomic_store_explicit(&slot->state, MP_FASTQ_ERR,
+				rte_memory_order_release);
+		return 1;
+	}
+
+	memcpy(slot->rep.name, rep.name, RTE_MP_MAX_NAME_LEN);
+	slot->rep.len_param = rep.len_param;
+	memcpy(slot->rep.param, rep.param, RTE_MP_MAX_PARAM_LEN);
+	rte_atomic_store_explicit(&slot->state, MP_FASTQ_DONE,
+			rte_memory_order_release);
+
+	return 1;
+}
+
+static uint32_t
+mp_fastq_handle(void *arg __rte_unused)
+{
+	unsigned int i, idle = 0;
+	int busy;
+
+	while (rte_atomic_load_explicit(&mp_fastq_run,
+			rte_memory_order_relaxed)) {
+		busy = 0;
+		for (i = 0; i < MP_FASTQ_SLOTS; i++)
+			busy += mp_fastq_process(&mp_fastq->slots[i]);
+
+		if (busy != 0) {
+			idle = 0;
+			continue;
+		}
+		/* back off to 100us sleeps while the queue stays empty */
+		if (idle < 100)
+			idle++;
+		usleep(idle);
+	}
+
+	return 0;
+}
+
+/* create the shared queue and its serving thread, mp_mutex_action held */
+static int
+mp_fastq_start(void)
+{
+	const struct rte_memzone *mz;
+
+	mz = rte_memzone_reserve(MP_FASTQ_MZ, sizeof(struct mp_fastq),
+			SOCKET_ID_ANY, 0);
+	if (mz == NULL) {
+		EAL_LOG(ERR, "Failed to reserve memzone for fast requests");
+		rte_errno = ENOMEM;
+		return -1;
+	}
+	memset(mz->addr, 0, sizeof(struct mp_fastq));
+	mp_fastq = mz->addr;
+
+	rte_atomic_store_explicit(&mp_fastq_run, true,
+			rte_memory_order_relaxed);
+	if (rte_thread_create_internal_control(&mp_fastq_tid, "mp-fastq",
+			mp_fastq_handle, NULL) < 0) {
+		EAL_LOG(ERR, "failed to create mp-fastq thread: %s",
+			strerror(errno));
+		rte_errno = errno;
+		rte_atomic_store_explicit(&mp_fastq_run, false,
+				rte_memory_order_relaxed);
+		mp_fastq = NULL;
+		rte_memzone_free(mz);
+		return -1;
+	}
+
+	return 0;
+}
+
+static void
+mp_fastq_cleanup(void)
+{
+	if (!rte_atomic_exchange_explicit(&mp_fastq_run, false,
+			rte_memory_order_relaxed))
+		return;
+
+	rte_thread_join(mp_fastq_tid, NULL);
+	rte_memzone_free(rte_memzone_lookup(MP_FASTQ_MZ));
+	mp_fastq = NULL;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_mp_fast_action_register, 25.07)
+int
+rte_mp_fast_action_register(const char *name, rte_mp_fast_t action)
+{
+	struct fast_action_entry *entry;
+	const struct internal_config *internal_conf =
+		eal_get_internal_configuration();
+
+	if (validate_action_name(name) != 0)
+		return -1;
+
+	if (action == NULL) {
+		rte_errno = EINVAL;
+		return -1;
+	}
+
+	if (rte_eal_process_type() != RTE_PROC_PRIMARY) {
+		EAL_LOG(ERR, "Fast actions are served by the primary process only");
+		rte_errno = ENOTSUP;
+		return -1;
+	}
+
+	if (internal_conf->no_shconf) {
+		EAL_LOG(DEBUG, "No shared files mode enabled, IPC is disabled");
+		rte_errno = ENOTSUP;
+		return -1;
+	}
+
+	entry = malloc(sizeof(struct fast_action_entry));
+	if (entry == NULL) {
+		rte_errno = ENOMEM;
+		return -1;
+	}
+	strlcpy(entry->action_name, name, sizeof(entry->action_name));
+	entry->action = action;
+
+	pthread_mutex_lock(&mp_mutex_action);
+	if (mp_fastq == NULL && mp_fastq_start() != 0) {
+		pthread_mutex_unlock(&mp_mutex_action);
+		free(entry);
+		return -1;
+	}
+	if (find_fast_action_entry_by_name(name) != NULL) {
+		pthread_mutex_unlock(&mp_mutex_action);
+		rte_errno = EEXIST;
+		free(entry);
+		return -1;
+	}
+	TAILQ_INSERT_TAIL(&fast_action_entry_list, entry, next);
+	pthread_mutex_unlock(&mp_mutex_action);
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_mp_fast_action_unregister, 25.07)
+void
+rte_mp_fast_action_unregister(const char *name)
+{
+	struct fast_action_entry *entry;
+
+	if (validate_action_name(name) != 0)
+		return;
+
+	pthread_mutex_lock(&mp_mutex_action);
+	entry = find_fast_action_entry_by_name(name);
+	if (entry == NULL) {
+		pthread_mutex_unlock(&mp_mutex_action);
+		return;
+	}
+	TAILQ_REMOVE(&fast_action_entry_list, entry, next);
+	pthread_mutex_unlock(&mp_mutex_action);
+	free(entry);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_mp_request_fast, 25.07)
+int
+rte_mp_request_fast(struct rte_mp_msg *req, struct rte_mp_reply *reply,
+		const struct timespec *ts)
+{
+	struct mp_fastq_slot *slot = NULL;
+	struct rte_mp_msg *rep;
+	struct timespec now, end;
+	uint32_t state, expected;
+	unsigned int i, spins = 0;
+
+	EAL_LOG(DEBUG, "fast request: %s", req->name);
+
+	if (check_input(req) != 0)
+		return -1;
+
+	/* fd passing and primary-to-secondary broadcast keep the socket */
+	if (req->num_fds > 0 || rte_eal_process_type() != RTE_PROC_SECONDARY)
+		return rte_mp_request_sync(req, reply, ts);
+
+	if (mp_fastq == NULL) {
+		const struct rte_memzone *mz = rte_memzone_lookup(MP_FASTQ_MZ);
+
+		/* the primary has no fast queue, use the socket channel */
+		if (mz == NULL)
+			return rte_mp_request_sync(req, reply, ts);
+		mp_fastq = mz->addr;
+	}
+
+	reply->nb_sent = 0;
+	reply->nb_received = 0;
+	reply->msgs = NULL;
+
+	/* lock-free slot claim, any number of requesters may race here */
+	for (i = 0; i < MP_FASTQ_SLOTS; i++) {
+		expected = MP_FASTQ_FREE;
+		if (rte_atomic_compare_exchange_strong_explicit(
+				&mp_fastq->slots[i].state, &expected,
+				MP_FASTQ_FILL, rte_memory_order_acquire,
+				rte_memory_order_relaxed)) {
+			slot = &mp_fastq->slots[i];
+			break;
+		}
+	}
+	/* all slots taken, fall back on the socket channel */
+	if (slot == NULL)
+		return rte_mp_request_sync(req, reply, ts);
+
+	if (clock_gettime(CLOCK_MONOTONIC, &now) < 0) {
+		EAL_LOG(ERR, "Failed to get current time");
+		rte_errno = errno;
+		rte_atomic_store_explicit(&slot->state, MP_FASTQ_FREE,
+				rte_memory_order_release);
+		return -1;
+	}
+	end.tv_nsec = (now.tv_nsec + ts->tv_nsec) % 1000000000;
+	end.tv_sec = now.tv_sec + ts->tv_sec +
+			(now.tv_nsec + ts->tv_nsec) / 1000000000;
+
+	memcpy(slot->req.name, req->name, RTE_MP_MAX_NAME_LEN);
+	slot->req.len_param = req->len_param;
+	memcpy(slot->req.param, req->param, RTE_MP_MAX_PARAM_LEN);
+	rte_atomic_store_explicit(&slot->state, MP_FASTQ_READY,
+			rte_memory_order_release);
+	reply->nb_sent = 1;
+
+	for (;;) {
+		state = rte_atomic_load_explicit(&slot->state,
+				rte_memory_order_acquire);
+		if (state == MP_FASTQ_DONE || state == MP_FASTQ_ERR)
+			break;
+
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		if (state == MP_FASTQ_READY && timespec_cmp(&now, &end) >= 0) {
+			/* reclaim unless the primary took the slot already */
+			expected = MP_FASTQ_READY;
+			if (rte_atomic_compare_exchange_strong_explicit(
+					&slot->state, &expected, MP_FASTQ_FREE,
+					rte_memory_order_acq_rel,
+					rte_memory_order_relaxed)) {
+				EAL_LOG(ERR, "Fail to recv reply for fast request %s",
+					req->name);
+				rte_errno = ETIMEDOUT;
+				return -1;
+			}
+		}
+		/* spin briefly for the common case, then sleep-poll */
+		if (++spins > 1000) {
+			struct timespec idle = { .tv_sec = 0,
+					.tv_nsec = 1000 };
+
+			nanosleep(&idle, NULL);
+		} else
+			rte_pause();
+	}
+
+	if (state == MP_FASTQ_ERR) {
+		rte_atomic_store_explicit(&slot->state, MP_FASTQ_FREE,
+				rte_memory_order_release);
+		EAL_LOG(ERR, "Primary failed to handle fast request %s",
+			req->name);
+		rte_errno = ENOMSG;
+		return -1;
+	}
+
+	rep = malloc(sizeof(*rep));
+	if (rep == NULL) {
+		rte_atomic_store_explicit(&slot->state, MP_FASTQ_FREE,
+				rte_memory_order_release);
+		rte_errno = ENOMEM;
+		return -1;
+	}
+	memset(rep, 0, sizeof(*rep));
+	memcpy(rep->name, slot->rep.name, RTE_MP_MAX_NAME_LEN);
+	rep->len_param = slot->rep.len_param;
+	memcpy(rep->param, slot->rep.param, RTE_MP_MAX_PARAM_LEN);
+	rte_atomic_store_explicit(&slot->state, MP_FASTQ_FREE,
+			rte_memory_order_release);
+
+	reply->msgs = rep;
+	reply->nb_received = 1;
+	return 0;
+}
+
 /* Internally, the status of the mp feature is represented as a three-state:
  * - "unknown" as long as no secondary process attached to a primary process
  *   and there was no call to rte_mp_disable yet,
@@ -18,6 +18,10 @@
 /* The frequency of the RDTSC timer resolution */
 static uint64_t eal_tsc_resolution_hz;
 
+/* Precomputed cycles to nanoseconds conversion: ns = cycles * mult >> shift */
+static uint32_t eal_tsc_mult;
+static uint32_t eal_tsc_shift;
+
 /* Pointer to user delay function */
 RTE_EXPORT_SYMBOL(rte_delay_us)
 void (*rte_delay_us)(unsigned int) = NULL;
@@ -39,6 +43,48 @@ rte_get_tsc_hz(void)
 	return eal_tsc_resolution_hz;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_time_ns, 25.07)
+uint64_t
+rte_time_ns(void)
+{
+	const uint64_t cycles = rte_get_tsc_cycles();
+
+#if defined(RTE_ARCH_64) && !defined(RTE_TOOLCHAIN_MSVC)
+	return (uint64_t)(((__uint128_t)cycles * eal_tsc_mult) >>
+			eal_tsc_shift);
+#else
+	const uint64_t hi = cycles >> 32;
+	const uint64_t lo = cycles & UINT32_MAX;
+
+	return ((hi * eal_tsc_mult) << (32 - eal_tsc_shift)) +
+		((lo * eal_tsc_mult) >> eal_tsc_shift);
+#endif
+}
+
+static void
+set_tsc_ns_conversion(uint64_t hz)
+{
+	uint32_t shift = 32;
+	uint64_t mult;
+
+	if (hz == 0)
+		return;
+
+	/*
+	 * Use the largest shift for which the nanoseconds per cycle
+	 * multiplier still fits into 32 bits, to lose as little precision
+	 * as possible.
+	 */
+	mult = ((uint64_t)NS_PER_S << shift) / hz;
+	while (mult > UINT32_MAX) {
+		mult >>= 1;
+		shift--;
+	}
+
+	eal_tsc_mult = mult;
+	eal_tsc_shift = shift;
+}
+
 static uint64_t
 estimate_tsc_freq(void)
 {
@@ -66,6 +112,7 @@ set_tsc_freq(void)
 		 * available.
 		 */
 		eal_tsc_resolution_hz = mcfg->tsc_hz;
+		set_tsc_ns_conversion(mcfg->tsc_hz);
 		return;
 	}
 
@@ -76,6 +123,7 @@ set_tsc_freq(void)
 
 	EAL_LOG(DEBUG, "TSC frequency is ~%" PRIu64 " KHz", freq / 1000);
 	eal_tsc_resolution_hz = freq;
+	set_tsc_ns_conversion(freq);
 	mcfg->tsc_hz = freq;
 }
 
@@ -2,11 +2,13 @@
  * Copyright(C) 2020 Marvell International Ltd.
  */
 
+#include <inttypes.h>
 #include <stdlib.h>
 #include <fnmatch.h>
 #include <pthread.h>
 #include <sys/queue.h>
 #include <regex.h>
+#include <unistd.h>
 
 #include <rte_common.h>
 #include <rte_errno.h>
@@ -134,6 +136,56 @@ rte_trace_mode rte_trace_mode_get(void)
 	return trace.mode;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_trace_stream_enable, 25.07)
+int
+rte_trace_stream_enable(void)
+{
+	int rc = 0;
+
+	rte_spinlock_lock(&trace.lock);
+	/* Buffers already laid out in the default format cannot be converted */
+	if (trace.nb_trace_mem_list != 0)
+		rc = -EBUSY;
+	else
+		trace.stream = 1;
+	rte_spinlock_unlock(&trace.lock);
+
+	return rc;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_trace_stream_flush, 25.07)
+void
+rte_trace_stream_flush(void)
+{
+	struct __rte_trace_header *header = RTE_PER_LCORE(trace_mem);
+
+	if (header == NULL || header->stream == 0)
+		return;
+
+	rte_atomic_store_explicit(&header->prod, header->reserved,
+		rte_memory_order_release);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_trace_stream_drops_get, 25.07)
+uint64_t
+rte_trace_stream_drops_get(void)
+{
+	struct __rte_trace_header *header;
+	uint64_t drops = 0;
+	uint32_t count;
+
+	rte_spinlock_lock(&trace.lock);
+	for (count = 0; count < trace.nb_trace_mem_list; count++) {
+		header = trace.lcore_meta[count].mem;
+		if (header->stream)
+			drops += rte_atomic_load_explicit(&header->drops,
+				rte_memory_order_relaxed);
+	}
+	rte_spinlock_unlock(&trace.lock);
+
+	return drops;
+}
+
 static bool
 trace_point_is_invalid(rte_trace_point_t *t)
 {
@@ -286,6 +338,10 @@ trace_lcore_mem_dump(FILE *f)
 		trace_area_to_string(trace->lcore_meta[count].area),
 		header->stream_header.lcore_id,
 		header->stream_header.thread_name);
+		if (header->stream)
+			fprintf(f, "\t\tstream drops=%" PRIu64 "\n",
+			rte_atomic_load_explicit(&header->drops,
+				rte_memory_order_relaxed));
 	}
 out:
 	rte_spinlock_unlock(&trace->lock);
@@ -304,6 +360,8 @@ rte_trace_dump(FILE *f)
 		rte_trace_is_enabled() ? "enabled" : "disabled");
 	fprintf(f, "mode = %s\n",
 		trace_mode_to_string(rte_trace_mode_get()));
+	fprintf(f, "stream = %s\n",
+		trace->stream ? "enabled" : "disabled");
 	fprintf(f, "dir = %s\n", trace->dir);
 	fprintf(f, "buffer len = %d\n", trace->buff_len);
 	fprintf(f, "number of trace points = %d\n", trace->nb_trace_points);
@@ -333,6 +391,7 @@ __rte_trace_mem_per_thread_alloc(void)
 {
 	struct trace *trace = trace_obj_get();
 	struct __rte_trace_header *header;
+	uint32_t buff_len;
 	uint32_t count;
 
 	if (!rte_trace_is_enabled())
@@ -345,6 +404,11 @@ __rte_trace_mem_per_thread_alloc(void)
 
 	count = trace->nb_trace_mem_list;
 
+	/* The ring arithmetic of the streaming mode needs a power of two */
+	buff_len = trace->buff_len;
+	if (trace->stream)
+		buff_len = rte_align32pow2(buff_len);
+
 	/* Allocate room for storing the thread trace mem meta */
 	trace->lcore_meta = realloc(trace->lcore_meta,
 		sizeof(trace->lcore_meta[0]) * (count + 1));
@@ -357,14 +421,14 @@ __rte_trace_mem_per_thread_alloc(void)
 	}
 
 	/* First attempt from huge page */
-	header = eal_malloc_no_trace(NULL, trace_mem_sz(trace->buff_len), 8);
+	header = eal_malloc_no_trace(NULL, trace_mem_sz(buff_len), 8);
 	if (header) {
 		trace->lcore_meta[count].area = TRACE_AREA_HUGEPAGE;
 		goto found;
 	}
 
 	/* Second attempt from heap */
-	header = malloc(trace_mem_sz(trace->buff_len));
+	header = malloc(trace_mem_sz(buff_len));
 	if (header == NULL) {
 		trace_crit("trace mem malloc attempt failed");
 		header = NULL;
@@ -378,7 +442,12 @@ __rte_trace_mem_per_thread_alloc(void)
 	/* Initialize the trace header */
 found:
 	header->offset = 0;
-	header->len = trace->buff_len;
+	header->len = buff_len;
+	header->stream = trace->stream;
+	header->prod = 0;
+	header->cons = 0;
+	header->drops = 0;
+	header->reserved = 0;
 	header->stream_header.magic = TRACE_CTF_MAGIC;
 	rte_uuid_copy(header->stream_header.uuid, trace->uuid);
 	header->stream_header.lcore_id = rte_lcore_id();
@@ -390,6 +459,7 @@ found:
 		__RTE_TRACE_EMIT_STRING_LEN_MAX);
 
 	trace->lcore_meta[count].mem = header;
+	trace->lcore_meta[count].stream_fd = -1;
 	trace->nb_trace_mem_list++;
 fail:
 	RTE_PER_LCORE(trace_mem) = header;
@@ -399,6 +469,17 @@ fail:
 static void
 trace_mem_per_thread_free_unlocked(struct thread_mem_meta *meta)
 {
+	struct __rte_trace_header *header = meta->mem;
+
+	/* Drain any events not yet picked up by the collector */
+	if (header->stream && meta->stream_fd >= 0) {
+		rte_atomic_store_explicit(&header->prod, header->reserved,
+			rte_memory_order_release);
+		trace_stream_drain(trace_obj_get(), meta);
+		close(meta->stream_fd);
+		meta->stream_fd = -1;
+	}
+
 	if (meta->area == TRACE_AREA_HUGEPAGE)
 		eal_free_no_trace(meta->mem);
 	else if (meta->area == TRACE_AREA_HEAP)
@@ -2,10 +2,14 @@
  * Copyright(C) 2020 Marvell International Ltd.
  */
 
+#include <fcntl.h>
 #include <fnmatch.h>
+#include <limits.h>
 #include <pwd.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <time.h>
+#include <unistd.h>
 
 #include <rte_common.h>
 #include <rte_errno.h>
@@ -433,6 +437,9 @@ rte_trace_save(void)
 	rte_spinlock_lock(&trace->lock);
 	for (count = 0; count < trace->nb_trace_mem_list; count++) {
 		header = trace->lcore_meta[count].mem;
+		/* Streaming buffers are saved with rte_trace_stream_save() */
+		if (header->stream)
+			continue;
 		rc =  trace_mem_save(trace, header, count);
 		if (rc)
 			break;
@@ -440,3 +447,211 @@ rte_trace_save(void)
 	rte_spinlock_unlock(&trace->lock);
 	return rc;
 }
+
+/* Size of each event, including its header, indexed by tracepoint id */
+static uint16_t *stream_ev_sz;
+
+#define TRACE_STREAM_IOV_MAX 64
+
+static int
+trace_stream_ev_sz_setup(struct trace *trace)
+{
+	struct trace_point_head *tp_list = trace_list_head_get();
+	struct trace_point *tp;
+
+	stream_ev_sz = calloc(trace->nb_trace_points, sizeof(*stream_ev_sz));
+	if (stream_ev_sz == NULL)
+		return -ENOMEM;
+
+	STAILQ_FOREACH(tp, tp_list, next)
+		stream_ev_sz[trace_id_get(tp->handle)] =
+			*tp->handle & __RTE_TRACE_FIELD_SIZE_MASK;
+
+	return 0;
+}
+
+static int
+trace_stream_open(struct trace *trace, struct thread_mem_meta *meta)
+{
+	struct __rte_trace_header *hdr = meta->mem;
+	char file_name[PATH_MAX];
+	ssize_t sz;
+	int fd, rc;
+
+	rc = snprintf(file_name, PATH_MAX, "%s/channel0_%u", trace->dir,
+		trace->stream_file_seq);
+	if (rc < 0)
+		return rc;
+
+	fd = open(file_name, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+	if (fd < 0)
+		return -errno;
+
+	sz = write(fd, &hdr->stream_header, sizeof(hdr->stream_header));
+	if (sz != (ssize_t)sizeof(hdr->stream_header)) {
+		close(fd);
+		return sz < 0 ? -errno : -EIO;
+	}
+
+	trace->stream_file_seq++;
+	meta->stream_fd = fd;
+	return 0;
+}
+
+static ssize_t
+trace_stream_writev(int fd, struct iovec *iov, int nb_iov)
+{
+	ssize_t total = 0, sz;
+
+	while (nb_iov > 0) {
+		sz = writev(fd, iov, nb_iov);
+		if (sz < 0)
+			return -errno;
+		total += sz;
+		/* Skip over the fully and partially written entries */
+		while (nb_iov > 0 && (size_t)sz >= iov->iov_len) {
+			sz -= iov->iov_len;
+			iov++;
+			nb_iov--;
+		}
+		if (nb_iov > 0) {
+			iov->iov_base = RTE_PTR_ADD(iov->iov_base, sz);
+			iov->iov_len -= sz;
+		}
+	}
+
+	return total;
+}
+
+ssize_t
+trace_stream_drain(struct trace *trace, struct thread_mem_meta *meta)
+{
+	struct __rte_trace_header *hdr = meta->mem;
+	struct iovec iov[TRACE_STREAM_IOV_MAX];
+	const uint32_t mask = hdr->len - 1;
+	uint64_t pos, prod, ev_hdr;
+	ssize_t total = 0, sz;
+	int nb_iov = 0;
+	uint32_t offset, ext;
+	uint16_t id;
+	void *ev;
+
+	pos = rte_atomic_load_explicit(&hdr->cons, rte_memory_order_relaxed);
+	prod = rte_atomic_load_explicit(&hdr->prod, rte_memory_order_acquire);
+
+	while (true) {
+		pos = RTE_ALIGN_CEIL(pos, __RTE_TRACE_EVENT_HEADER_SZ);
+		if (pos >= prod)
+			break;
+
+		offset = (uint32_t)pos & mask;
+		ev = RTE_PTR_ADD(&hdr->mem[0], offset);
+
+		ev_hdr = *(uint64_t *)ev;
+		if (ev_hdr == __RTE_TRACE_STREAM_PAD) {
+			/* Tail skipped by the emitter; not part of the stream */
+			pos += hdr->len - offset;
+			continue;
+		}
+
+		id = ev_hdr >> __RTE_TRACE_EVENT_HEADER_ID_SHIFT;
+		if (id >= trace->nb_trace_points)
+			return -EIO;
+
+		/* Include the alignment gap up to the next event */
+		ext = RTE_ALIGN_CEIL(stream_ev_sz[id], __RTE_TRACE_EVENT_HEADER_SZ);
+		if (offset + ext > hdr->len)
+			ext = hdr->len - offset;
+
+		if (nb_iov > 0 &&
+				RTE_PTR_ADD(iov[nb_iov - 1].iov_base, iov[nb_iov - 1].iov_len) == ev) {
+			iov[nb_iov - 1].iov_len += ext;
+		} else {
+			if (nb_iov == TRACE_STREAM_IOV_MAX) {
+				sz = trace_stream_writev(meta->stream_fd, iov, nb_iov);
+				if (sz < 0)
+					return sz;
+				total += sz;
+				nb_iov = 0;
+			}
+			iov[nb_iov].iov_base = ev;
+			iov[nb_iov].iov_len = ext;
+			nb_iov++;
+		}
+
+		pos += stream_ev_sz[id];
+	}
+
+	if (nb_iov > 0) {
+		sz = trace_stream_writev(meta->stream_fd, iov, nb_iov);
+		if (sz < 0)
+			return sz;
+		total += sz;
+	}
+
+	/* Release the drained space back to the emitter */
+	rte_atomic_store_explicit(&hdr->cons, pos, rte_memory_order_release);
+	return total;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_trace_stream_save, 25.07)
+int
+rte_trace_stream_save(void)
+{
+	struct trace *trace = trace_obj_get();
+	static bool meta_saved;
+	ssize_t total = 0, sz;
+	uint32_t count;
+	int rc;
+
+	if (trace->stream == 0)
+		return -ENOTSUP;
+
+	if (trace->nb_trace_mem_list == 0)
+		return 0;
+
+	rc = trace_mkdir();
+	if (rc < 0)
+		return rc;
+
+	rte_spinlock_lock(&trace->lock);
+
+	if (!meta_saved) {
+		rc = trace_meta_save(trace);
+		if (rc < 0)
+			goto out;
+		meta_saved = true;
+	}
+
+	if (stream_ev_sz == NULL) {
+		rc = trace_stream_ev_sz_setup(trace);
+		if (rc < 0)
+			goto out;
+	}
+
+	for (count = 0; count < trace->nb_trace_mem_list; count++) {
+		struct thread_mem_meta *meta = &trace->lcore_meta[count];
+		struct __rte_trace_header *hdr = meta->mem;
+
+		if (hdr->stream == 0)
+			continue;
+
+		if (meta->stream_fd < 0) {
+			rc = trace_stream_open(trace, meta);
+			if (rc < 0)
+				goto out;
+		}
+
+		sz = trace_stream_drain(trace, meta);
+		if (sz < 0) {
+			rc = sz;
+			goto out;
+		}
+		total += sz;
+	}
+
+	rc = total > INT_MAX ? INT_MAX : (int)total;
+out:
+	rte_spinlock_unlock(&trace->lock);
+	return rc;
+}
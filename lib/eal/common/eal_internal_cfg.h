@@ -80,6 +80,10 @@ struct internal_config {
 	 */
 	volatile unsigned match_allocations;
 	/**< true to free hugepages exactly as allocated */
+	volatile unsigned defer_prefault;
+	/**< true to map hugepages without pre-faulting them at allocation,
+	 * leaving population to rte_mem_prefault_wait() or first touch.
+	 */
 	volatile unsigned single_file_segments;
 	/**< true if storing all pages within single files (per-page-size,
 	 * per-node) non-legacy mode only.
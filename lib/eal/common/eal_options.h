@@ -93,6 +93,8 @@ enum {
 	OPT_FORCE_MAX_SIMD_BITWIDTH_NUM,
 #define OPT_HUGE_WORKER_STACK  "huge-worker-stack"
 	OPT_HUGE_WORKER_STACK_NUM,
+#define OPT_DEFER_PREFAULT    "defer-prefault"
+	OPT_DEFER_PREFAULT_NUM,
 
 	OPT_LONG_MAX_NUM
 };
@@ -40,6 +40,7 @@ enum trace_area_e {
 struct thread_mem_meta {
 	void *mem;
 	enum trace_area_e area;
+	int stream_fd;
 };
 
 struct trace_arg {
@@ -54,6 +55,8 @@ struct trace {
 	enum rte_trace_mode mode;
 	rte_uuid_t uuid;
 	uint32_t buff_len;
+	uint32_t stream;
+	uint32_t stream_file_seq;
 	STAILQ_HEAD(, trace_arg) args;
 	uint32_t nb_trace_points;
 	uint32_t nb_trace_mem_list;
@@ -103,6 +106,7 @@ char *trace_metadata_fixup_field(const char *field);
 int trace_epoch_time_save(void);
 void trace_mem_free(void);
 void trace_mem_per_thread_free(void);
+ssize_t trace_stream_drain(struct trace *trace, struct thread_mem_meta *meta);
 
 /* EAL interface */
 int eal_trace_init(void);
@@ -1130,6 +1130,41 @@ malloc_heap_get_stats(struct malloc_heap *heap,
 	return 0;
 }
 
+/*
+ * Function to retrieve the free-element size distribution of a heap
+ */
+int
+malloc_heap_get_frag_stats(struct malloc_heap *heap,
+		struct rte_malloc_frag_stats *frag_stats)
+{
+	size_t idx;
+	unsigned int bucket;
+	struct malloc_elem *elem;
+
+	memset(frag_stats, 0, sizeof(*frag_stats));
+
+	rte_spinlock_lock(&heap->lock);
+
+	/* Iterate through free list */
+	for (idx = 0; idx < RTE_HEAP_NUM_FREELISTS; idx++) {
+		for (elem = LIST_FIRST(&heap->free_head[idx]);
+			!!elem; elem = LIST_NEXT(elem, free_list))
+		{
+			bucket = rte_log2_u64(elem->size);
+			if (bucket >= RTE_MALLOC_FRAG_BUCKETS)
+				bucket = RTE_MALLOC_FRAG_BUCKETS - 1;
+			frag_stats->free_count[bucket]++;
+			frag_stats->free_bytes[bucket] += elem->size;
+			frag_stats->free_elems++;
+			if (elem->size > frag_stats->greatest_free_size)
+				frag_stats->greatest_free_size = elem->size;
+		}
+	}
+
+	rte_spinlock_unlock(&heap->lock);
+	return 0;
+}
+
 /*
  * Function to retrieve data for a given heap
  */
@@ -75,6 +75,10 @@ int
 malloc_heap_get_stats(struct malloc_heap *heap,
 		struct rte_malloc_socket_stats *socket_stats);
 
+int
+malloc_heap_get_frag_stats(struct malloc_heap *heap,
+		struct rte_malloc_frag_stats *frag_stats);
+
 void
 malloc_heap_dump(struct malloc_heap *heap, FILE *f);
 
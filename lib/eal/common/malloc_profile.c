@@ -0,0 +1,246 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2025 Intel Corporation
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <eal_export.h>
+#include <rte_malloc.h>
+#include <rte_stdatomic.h>
+#ifndef RTE_EXEC_ENV_WINDOWS
+#include <rte_telemetry.h>
+#endif
+
+#include "malloc_profile.h"
+
+/* Number of callsite slots, must be a power of two. */
+#define MALLOC_PROFILE_SITES 256
+
+/*
+ * One profiled callsite. Slots are claimed with a compare-exchange on
+ * the address and never released, so readers can walk the table without
+ * synchronization; the counters are updated with relaxed atomics.
+ */
+struct malloc_profile_site {
+	RTE_ATOMIC(uintptr_t) addr; /* return address, 0 if slot is free */
+	RTE_ATOMIC(uint64_t) allocs;
+	RTE_ATOMIC(uint64_t) failures;
+	RTE_ATOMIC(uint64_t) bytes;
+};
+
+static struct malloc_profile_site profile_sites[MALLOC_PROFILE_SITES];
+
+bool malloc_profile_enabled;
+
+static struct malloc_profile_site *
+profile_site_get(uintptr_t addr)
+{
+	uint32_t idx, i;
+	uintptr_t cur;
+
+	/* low bits of return addresses barely vary, mix them */
+	idx = (uint32_t)((addr >> 2) * 0x9E3779B9u) &
+		(MALLOC_PROFILE_SITES - 1);
+
+	for (i = 0; i < MALLOC_PROFILE_SITES; i++) {
+		struct malloc_profile_site *site = &profile_sites[idx];
+
+		cur = rte_atomic_load_explicit(&site->addr,
+			rte_memory_order_relaxed);
+		if (cur == addr)
+			return site;
+		if (cur == 0) {
+			if (rte_atomic_compare_exchange_strong_explicit(
+					&site->addr, &cur, addr,
+					rte_memory_order_relaxed,
+					rte_memory_order_relaxed))
+				return site;
+			/* lost the race, maybe to the same callsite */
+			if (cur == addr)
+				return site;
+		}
+		idx = (idx + 1) & (MALLOC_PROFILE_SITES - 1);
+	}
+
+	/* table is full, drop the sample */
+	return NULL;
+}
+
+void
+malloc_profile_record(const void *site_addr, size_t size, bool failed)
+{
+	struct malloc_profile_site *site;
+
+	site = profile_site_get((uintptr_t)site_addr);
+	if (site == NULL)
+		return;
+
+	rte_atomic_fetch_add_explicit(&site->allocs, 1,
+		rte_memory_order_relaxed);
+	rte_atomic_fetch_add_explicit(&site->bytes, size,
+		rte_memory_order_relaxed);
+	if (failed)
+		rte_atomic_fetch_add_explicit(&site->failures, 1,
+			rte_memory_order_relaxed);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_malloc_profile_enable, 25.07)
+int
+rte_malloc_profile_enable(void)
+{
+	malloc_profile_enabled = true;
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_malloc_profile_disable, 25.07)
+int
+rte_malloc_profile_disable(void)
+{
+	malloc_profile_enabled = false;
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_malloc_profile_reset, 25.07)
+void
+rte_malloc_profile_reset(void)
+{
+	unsigned int i;
+
+	for (i = 0; i < MALLOC_PROFILE_SITES; i++) {
+		struct malloc_profile_site *site = &profile_sites[i];
+
+		rte_atomic_store_explicit(&site->allocs, 0,
+			rte_memory_order_relaxed);
+		rte_atomic_store_explicit(&site->failures, 0,
+			rte_memory_order_relaxed);
+		rte_atomic_store_explicit(&site->bytes, 0,
+			rte_memory_order_relaxed);
+		rte_atomic_store_explicit(&site->addr, 0,
+			rte_memory_order_relaxed);
+	}
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_malloc_profile_dump, 25.07)
+void
+rte_malloc_profile_dump(FILE *f)
+{
+	unsigned int i;
+
+	if (f == NULL)
+		return;
+
+	fprintf(f, "Malloc profile (%s):\n",
+		malloc_profile_enabled ? "enabled" : "disabled");
+	for (i = 0; i < MALLOC_PROFILE_SITES; i++) {
+		struct malloc_profile_site *site = &profile_sites[i];
+		uintptr_t addr = rte_atomic_load_explicit(&site->addr,
+			rte_memory_order_relaxed);
+
+		if (addr == 0)
+			continue;
+		fprintf(f,
+			"  site 0x%" PRIxPTR ": allocs=%" PRIu64
+			", failures=%" PRIu64 ", bytes=%" PRIu64 "\n",
+			addr,
+			rte_atomic_load_explicit(&site->allocs,
+				rte_memory_order_relaxed),
+			rte_atomic_load_explicit(&site->failures,
+				rte_memory_order_relaxed),
+			rte_atomic_load_explicit(&site->bytes,
+				rte_memory_order_relaxed));
+	}
+}
+
+#ifndef RTE_EXEC_ENV_WINDOWS
+
+static int
+handle_malloc_profile(const char *cmd __rte_unused,
+	const char *params __rte_unused, struct rte_tel_data *d)
+{
+	char addr_str[32];
+	unsigned int i;
+
+	rte_tel_data_start_dict(d);
+	for (i = 0; i < MALLOC_PROFILE_SITES; i++) {
+		struct malloc_profile_site *site = &profile_sites[i];
+		uintptr_t addr = rte_atomic_load_explicit(&site->addr,
+			rte_memory_order_relaxed);
+		struct rte_tel_data *entry;
+
+		if (addr == 0)
+			continue;
+		entry = rte_tel_data_alloc();
+		if (entry == NULL)
+			break;
+		rte_tel_data_start_dict(entry);
+		rte_tel_data_add_dict_uint(entry, "allocs",
+			rte_atomic_load_explicit(&site->allocs,
+				rte_memory_order_relaxed));
+		rte_tel_data_add_dict_uint(entry, "failures",
+			rte_atomic_load_explicit(&site->failures,
+				rte_memory_order_relaxed));
+		rte_tel_data_add_dict_uint(entry, "bytes",
+			rte_atomic_load_explicit(&site->bytes,
+				rte_memory_order_relaxed));
+		snprintf(addr_str, sizeof(addr_str), "0x%" PRIxPTR, addr);
+		rte_tel_data_add_dict_container(d, addr_str, entry, 0);
+	}
+
+	return 0;
+}
+
+static int
+handle_malloc_frag(const char *cmd __rte_unused, const char *params,
+	struct rte_tel_data *d)
+{
+	struct rte_malloc_frag_stats frag;
+	char bucket[32];
+	unsigned int b;
+	int socket;
+
+	if (params == NULL || strlen(params) == 0)
+		return -EINVAL;
+
+	socket = (int)strtol(params, NULL, 10);
+	if (rte_malloc_get_frag_stats(socket, &frag) < 0)
+		return -EINVAL;
+
+	rte_tel_data_start_dict(d);
+	rte_tel_data_add_dict_uint(d, "free_elems", frag.free_elems);
+	rte_tel_data_add_dict_uint(d, "greatest_free_size",
+		frag.greatest_free_size);
+	for (b = 0; b < RTE_MALLOC_FRAG_BUCKETS; b++) {
+		struct rte_tel_data *entry;
+
+		if (frag.free_count[b] == 0)
+			continue;
+		entry = rte_tel_data_alloc();
+		if (entry == NULL)
+			break;
+		rte_tel_data_start_dict(entry);
+		rte_tel_data_add_dict_uint(entry, "count",
+			frag.free_count[b]);
+		rte_tel_data_add_dict_uint(entry, "bytes",
+			frag.free_bytes[b]);
+		snprintf(bucket, sizeof(bucket), "2^%u", b);
+		rte_tel_data_add_dict_container(d, bucket, entry, 0);
+	}
+
+	return 0;
+}
+
+RTE_INIT(malloc_profile_telemetry)
+{
+	rte_telemetry_register_cmd("/eal/malloc/profile",
+		handle_malloc_profile,
+		"Per-callsite allocation statistics. Takes no parameters");
+	rte_telemetry_register_cmd("/eal/malloc/frag",
+		handle_malloc_frag,
+		"Free-element size distribution of a heap. Parameters: socket id");
+}
+#endif /* !RTE_EXEC_ENV_WINDOWS */
@@ -0,0 +1,28 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2025 Intel Corporation
+ */
+
+#ifndef MALLOC_PROFILE_H
+#define MALLOC_PROFILE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @file
+ * Opt-in malloc allocation profiler, internal side.
+ *
+ * When enabled through rte_malloc_profile_enable(), the allocation
+ * entry points account every request to its callsite in a fixed-size
+ * lock-free table. The fast-path cost while disabled is a single
+ * predicted branch on the flag below.
+ */
+
+/* Set by rte_malloc_profile_enable()/_disable(), read on alloc path. */
+extern bool malloc_profile_enabled;
+
+/* Account one allocation of @size bytes to @site (a return address). */
+void
+malloc_profile_record(const void *site, size_t size, bool failed);
+
+#endif /* MALLOC_PROFILE_H */
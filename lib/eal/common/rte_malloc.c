@@ -9,6 +9,7 @@
 #include <sys/queue.h>
 
 #include <rte_errno.h>
+#include <rte_lcore.h>
 #include <rte_memcpy.h>
 #include <rte_memory.h>
 #include <rte_eal.h>
@@ -22,11 +23,172 @@
 #include <rte_malloc.h>
 #include "malloc_elem.h"
 #include "malloc_heap.h"
+#include "malloc_profile.h"
 #include "eal_memalloc.h"
 #include "eal_memcfg.h"
 #include "eal_private.h"
 
 
+/*
+ * Per-lcore cache of freed blocks, consulted before taking the heap lock.
+ * Each cache is only ever touched by its owning thread, so local alloc and
+ * free need no synchronization at all. Enabled explicitly per thread via
+ * rte_malloc_lcore_cache_enable().
+ */
+struct malloc_lcore_cache_entry {
+	void *addr;
+	size_t data_len;
+	unsigned int socket_id;
+};
+
+struct malloc_lcore_cache {
+	unsigned int len;
+	unsigned int count;
+	size_t max_size;
+	struct malloc_lcore_cache_entry *entries;
+};
+
+static struct malloc_lcore_cache malloc_lcore_caches[RTE_MAX_LCORE];
+
+static void *
+malloc_lcore_cache_get(size_t size, unsigned int align, int socket_arg)
+{
+	struct malloc_lcore_cache *cache;
+	unsigned int lcore_id = rte_lcore_id();
+	unsigned int i;
+
+	if (lcore_id == LCORE_ID_ANY)
+		return NULL;
+
+	cache = &malloc_lcore_caches[lcore_id];
+	if (cache->len == 0 || size > cache->max_size)
+		return NULL;
+
+	for (i = 0; i < cache->len; i++) {
+		struct malloc_lcore_cache_entry *entry = &cache->entries[i];
+
+		/* avoid wasting blocks much larger than the request */
+		if (entry->data_len < size || entry->data_len > size * 2)
+			continue;
+		if (((uintptr_t)entry->addr & (align - 1)) != 0)
+			continue;
+		if (socket_arg != SOCKET_ID_ANY &&
+				entry->socket_id != (unsigned int)socket_arg)
+			continue;
+
+		void *addr = entry->addr;
+
+		cache->entries[i] = cache->entries[--cache->len];
+		return addr;
+	}
+
+	return NULL;
+}
+
+static bool
+malloc_lcore_cache_put(void *addr)
+{
+	struct malloc_lcore_cache *cache;
+	struct malloc_lcore_cache_entry *entry;
+	struct malloc_elem *elem;
+	unsigned int lcore_id = rte_lcore_id();
+	size_t data_len;
+
+	if (lcore_id == LCORE_ID_ANY)
+		return false;
+
+	cache = &malloc_lcore_caches[lcore_id];
+	if (cache->entries == NULL || cache->len == cache->count)
+		return false;
+
+	elem = malloc_elem_from_data(addr);
+	data_len = old_malloc_size(elem);
+	if (data_len > cache->max_size)
+		return false;
+
+	/* contents are preserved, let rte_zmalloc() know it must zero */
+	elem->dirty = 1;
+
+	entry = &cache->entries[cache->len++];
+	entry->addr = addr;
+	entry->data_len = data_len;
+	entry->socket_id = elem->heap->socket_id;
+
+	return true;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_malloc_lcore_cache_enable, 25.07)
+int
+rte_malloc_lcore_cache_enable(size_t max_size, unsigned int count)
+{
+	struct malloc_lcore_cache *cache;
+	struct malloc_lcore_cache_entry *entries;
+	unsigned int lcore_id = rte_lcore_id();
+
+	if (max_size == 0 || count == 0) {
+		rte_errno = EINVAL;
+		return -1;
+	}
+
+	if (lcore_id == LCORE_ID_ANY) {
+		rte_errno = ENOTSUP;
+		return -1;
+	}
+
+	cache = &malloc_lcore_caches[lcore_id];
+	if (cache->entries != NULL) {
+		rte_errno = EEXIST;
+		return -1;
+	}
+
+	entries = rte_calloc("malloc_lcore_cache", count, sizeof(*entries), 0);
+	if (entries == NULL) {
+		rte_errno = ENOMEM;
+		return -1;
+	}
+
+	cache->len = 0;
+	cache->count = count;
+	cache->max_size = max_size;
+	cache->entries = entries;
+
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_malloc_lcore_cache_disable, 25.07)
+int
+rte_malloc_lcore_cache_disable(void)
+{
+	struct malloc_lcore_cache *cache;
+	struct malloc_lcore_cache_entry *entries;
+	unsigned int lcore_id = rte_lcore_id();
+	unsigned int i;
+
+	if (lcore_id == LCORE_ID_ANY) {
+		rte_errno = ENOTSUP;
+		return -1;
+	}
+
+	cache = &malloc_lcore_caches[lcore_id];
+	if (cache->entries == NULL) {
+		rte_errno = ENOENT;
+		return -1;
+	}
+
+	for (i = 0; i < cache->len; i++) {
+		if (malloc_heap_free(malloc_elem_from_data(
+				cache->entries[i].addr)) < 0)
+			EAL_LOG(ERR, "Error: Invalid memory");
+	}
+
+	/* detach first so freeing the entry array cannot re-enter the cache */
+	entries = cache->entries;
+	memset(cache, 0, sizeof(*cache));
+	rte_free(entries);
+
+	return 0;
+}
+
 /* Free the memory space back to heap */
 static void
 mem_free(void *addr, const bool trace_ena)
@@ -35,6 +197,8 @@ mem_free(void *addr, const bool trace_ena)
 		rte_eal_trace_mem_free(addr);
 
 	if (addr == NULL) return;
+	if (malloc_lcore_cache_put(addr))
+		return;
 	if (malloc_heap_free(malloc_elem_from_data(addr)) < 0)
 		EAL_LOG(ERR, "Error: Invalid memory");
 }
@@ -54,7 +218,7 @@ eal_free_no_trace(void *addr)
 
 static void *
 malloc_socket(const char *type, size_t size, unsigned int align,
-		int socket_arg, const bool trace_ena)
+		int socket_arg, const bool trace_ena, const void *site)
 {
 	void *ptr;
 
@@ -71,8 +235,13 @@ malloc_socket(const char *type, size_t size, unsigned int align,
 				!rte_eal_has_hugepages())
 		socket_arg = SOCKET_ID_ANY;
 
-	ptr = malloc_heap_alloc(size, socket_arg, 0,
-			align == 0 ? 1 : align, 0, false);
+	ptr = malloc_lcore_cache_get(size, align == 0 ? 1 : align, socket_arg);
+	if (ptr == NULL)
+		ptr = malloc_heap_alloc(size, socket_arg, 0,
+				align == 0 ? 1 : align, 0, false);
+
+	if (unlikely(malloc_profile_enabled))
+		malloc_profile_record(site, size, ptr == NULL);
 
 	if (trace_ena)
 		rte_eal_trace_mem_malloc(type, size, align, socket_arg, ptr);
@@ -87,13 +256,15 @@ void *
 rte_malloc_socket(const char *type, size_t size, unsigned int align,
 		int socket_arg)
 {
-	return malloc_socket(type, size, align, socket_arg, true);
+	return malloc_socket(type, size, align, socket_arg, true,
+			__builtin_return_address(0));
 }
 
 void *
 eal_malloc_no_trace(const char *type, size_t size, unsigned int align)
 {
-	return malloc_socket(type, size, align, SOCKET_ID_ANY, false);
+	return malloc_socket(type, size, align, SOCKET_ID_ANY, false,
+			__builtin_return_address(0));
 }
 
 /*
@@ -113,7 +284,8 @@ RTE_EXPORT_SYMBOL(rte_zmalloc_socket)
 void *
 rte_zmalloc_socket(const char *type, size_t size, unsigned align, int socket)
 {
-	void *ptr = rte_malloc_socket(type, size, align, socket);
+	void *ptr = malloc_socket(type, size, align, socket, true,
+			__builtin_return_address(0));
 
 	if (ptr != NULL) {
 		struct malloc_elem *elem = malloc_elem_from_data(ptr);
@@ -259,6 +431,28 @@ rte_malloc_get_socket_stats(int socket,
 			socket_stats);
 }
 
+/*
+ * Function to retrieve the free-element size distribution of a heap
+ */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_malloc_get_frag_stats, 25.07)
+int
+rte_malloc_get_frag_stats(int socket,
+		struct rte_malloc_frag_stats *frag_stats)
+{
+	struct rte_mem_config *mcfg = rte_eal_get_configuration()->mem_config;
+	int heap_idx;
+
+	if (frag_stats == NULL)
+		return -1;
+
+	heap_idx = malloc_socket_to_heap_id(socket);
+	if (heap_idx < 0)
+		return -1;
+
+	return malloc_heap_get_frag_stats(&mcfg->malloc_heaps[heap_idx],
+			frag_stats);
+}
+
 /*
  * Function to dump contents of all heaps
  */
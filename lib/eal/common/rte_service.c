@@ -2,6 +2,7 @@
  * Copyright(c) 2017 Intel Corporation
  */
 
+#include <stdbool.h>
 #include <stdio.h>
 #include <inttypes.h>
 #include <string.h>
@@ -17,6 +18,7 @@
 #include <rte_branch_prediction.h>
 #include <rte_common.h>
 #include <rte_cycles.h>
+#include <rte_alarm.h>
 #include <rte_atomic.h>
 #include <rte_malloc.h>
 #include <rte_spinlock.h>
@@ -49,6 +51,12 @@ struct __rte_cache_aligned rte_service_spec_impl {
 	RTE_ATOMIC(int8_t) app_runstate;
 	RTE_ATOMIC(int8_t) comp_runstate;
 	uint8_t internal_flags;
+	/* number of invocations per scheduling round on a service lcore */
+	RTE_ATOMIC(uint8_t) weight;
+	/* interrupt thread invocation period in us, 0 when disabled */
+	RTE_ATOMIC(uint32_t) alarm_period_us;
+	/* max callback invocations per alarm expiry */
+	uint32_t alarm_batch;
 
 	/* per service statistics */
 	/* Indicates how many cores the service is mapped to run on.
@@ -73,6 +81,8 @@ struct __rte_cache_aligned core_state {
 	RTE_ATOMIC(uint8_t) thread_active; /* indicates when thread is in service_run() */
 	uint8_t is_service_core; /* set if core is currently a service core */
 	RTE_BITSET_DECLARE(service_active_on_lcore, RTE_SERVICE_NUM_MAX);
+	/* max pause iterations of idle backoff, 0 disables backoff */
+	RTE_ATOMIC(uint16_t) backoff_max;
 	RTE_ATOMIC(uint64_t) loops;
 	RTE_ATOMIC(uint64_t) cycles;
 	struct service_stats service_stats[RTE_SERVICE_NUM_MAX];
@@ -191,6 +201,184 @@ rte_service_set_stats_enable(uint32_t id, int32_t enabled)
 	return 0;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_service_weight_set, 25.07)
+int32_t
+rte_service_weight_set(uint32_t id, uint8_t weight)
+{
+	struct rte_service_spec_impl *s;
+	SERVICE_VALID_GET_OR_ERR_RET(id, s, -EINVAL);
+
+	if (weight == 0)
+		return -EINVAL;
+
+	rte_atomic_store_explicit(&s->weight, weight, rte_memory_order_relaxed);
+
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_service_weight_get, 25.07)
+int32_t
+rte_service_weight_get(uint32_t id)
+{
+	struct rte_service_spec_impl *s;
+	SERVICE_VALID_GET_OR_ERR_RET(id, s, -EINVAL);
+
+	return rte_atomic_load_explicit(&s->weight, rte_memory_order_relaxed);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_service_lcore_backoff_set, 25.07)
+int32_t
+rte_service_lcore_backoff_set(uint32_t lcore, uint16_t max_pauses)
+{
+	struct core_state *cs;
+
+	if (lcore >= RTE_MAX_LCORE)
+		return -EINVAL;
+
+	cs = RTE_LCORE_VAR_LCORE(lcore, lcore_states);
+	if (!cs->is_service_core)
+		return -EINVAL;
+
+	rte_atomic_store_explicit(&cs->backoff_max, max_pauses,
+			rte_memory_order_relaxed);
+
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_service_lcore_backoff_get, 25.07)
+int32_t
+rte_service_lcore_backoff_get(uint32_t lcore)
+{
+	struct core_state *cs;
+
+	if (lcore >= RTE_MAX_LCORE)
+		return -EINVAL;
+
+	cs = RTE_LCORE_VAR_LCORE(lcore, lcore_states);
+	if (!cs->is_service_core)
+		return -EINVAL;
+
+	return rte_atomic_load_explicit(&cs->backoff_max,
+			rte_memory_order_relaxed);
+}
+
+/* Runs in the interrupt thread: invoke the service callback up to the
+ * configured batch and re-arm. Per-lcore statistics are not collected as
+ * the interrupt thread has no core_state of its own.
+ */
+static void
+service_alarm_cb(void *arg)
+{
+	uint32_t id = (uint32_t)(uintptr_t)arg;
+	struct rte_service_spec_impl *s = &rte_services[id];
+	uint32_t period, i;
+
+	period = rte_atomic_load_explicit(&s->alarm_period_us,
+			rte_memory_order_relaxed);
+	if (period == 0 || !service_registered(id))
+		return;
+
+	/* same guard variables as service_run(), see there for ordering */
+	if (rte_atomic_load_explicit(&s->comp_runstate,
+				rte_memory_order_acquire) == RUNSTATE_RUNNING &&
+	    rte_atomic_load_explicit(&s->app_runstate,
+				rte_memory_order_acquire) == RUNSTATE_RUNNING) {
+		for (i = 0; i < s->alarm_batch; i++) {
+			int rc;
+
+			if (!service_mt_safe(s)) {
+				if (!rte_spinlock_trylock(&s->execute_lock))
+					break;
+				rc = s->spec.callback(s->spec.callback_userdata);
+				rte_spinlock_unlock(&s->execute_lock);
+			} else
+				rc = s->spec.callback(s->spec.callback_userdata);
+
+			/* service is out of work, end the batch early */
+			if (rc == -EAGAIN)
+				break;
+		}
+	}
+
+	/* reload the period, the mode may have been disabled meanwhile */
+	period = rte_atomic_load_explicit(&s->alarm_period_us,
+			rte_memory_order_relaxed);
+	if (period != 0)
+		rte_eal_alarm_set(period, service_alarm_cb, arg);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_service_alarm_mode_set, 25.07)
+int32_t
+rte_service_alarm_mode_set(uint32_t id, uint32_t period_us, uint32_t max_batch)
+{
+	struct rte_service_spec_impl *s;
+	uint32_t prev;
+	int ret;
+
+	SERVICE_VALID_GET_OR_ERR_RET(id, s, -EINVAL);
+
+	prev = rte_atomic_load_explicit(&s->alarm_period_us,
+			rte_memory_order_relaxed);
+
+	if (period_us == 0) {
+		if (prev == 0)
+			return 0;
+		rte_atomic_store_explicit(&s->alarm_period_us, 0,
+				rte_memory_order_relaxed);
+		rte_eal_alarm_cancel(service_alarm_cb, (void *)(uintptr_t)id);
+		rte_atomic_fetch_sub_explicit(&s->num_mapped_cores, 1,
+				rte_memory_order_relaxed);
+		return 0;
+	}
+
+	if (max_batch == 0)
+		return -EINVAL;
+
+	s->alarm_batch = max_batch;
+	rte_atomic_store_explicit(&s->alarm_period_us, period_us,
+			rte_memory_order_relaxed);
+	/* already enabled, the running alarm picks up the new parameters */
+	if (prev != 0)
+		return 0;
+
+	/* as in rte_service_run_iter_on_app_lcore(), reflect that another
+	 * context is now capable of running the service
+	 */
+	rte_atomic_fetch_add_explicit(&s->num_mapped_cores, 1,
+			rte_memory_order_relaxed);
+	ret = rte_eal_alarm_set(period_us, service_alarm_cb,
+			(void *)(uintptr_t)id);
+	if (ret != 0) {
+		rte_atomic_store_explicit(&s->alarm_period_us, 0,
+				rte_memory_order_relaxed);
+		rte_atomic_fetch_sub_explicit(&s->num_mapped_cores, 1,
+				rte_memory_order_relaxed);
+		return ret;
+	}
+
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_service_alarm_mode_get, 25.07)
+int32_t
+rte_service_alarm_mode_get(uint32_t id, uint32_t *period_us,
+		uint32_t *max_batch)
+{
+	struct rte_service_spec_impl *s;
+	uint32_t period;
+
+	SERVICE_VALID_GET_OR_ERR_RET(id, s, -EINVAL);
+
+	period = rte_atomic_load_explicit(&s->alarm_period_us,
+			rte_memory_order_relaxed);
+	if (period_us != NULL)
+		*period_us = period;
+	if (max_batch != NULL)
+		*max_batch = s->alarm_batch;
+
+	return period != 0;
+}
+
 RTE_EXPORT_SYMBOL(rte_service_set_runstate_mapped_check)
 int32_t
 rte_service_set_runstate_mapped_check(uint32_t id, int32_t enabled)
@@ -274,6 +462,7 @@ rte_service_component_register(const struct rte_service_spec *spec,
 	struct rte_service_spec_impl *s = &rte_services[free_slot];
 	s->spec = *spec;
 	s->internal_flags |= SERVICE_F_REGISTERED | SERVICE_F_START_CHECK;
+	s->weight = 1;
 
 	rte_service_count++;
 
@@ -296,6 +485,13 @@ rte_service_component_unregister(uint32_t id)
 
 	s->internal_flags &= ~(SERVICE_F_REGISTERED);
 
+	if (rte_atomic_load_explicit(&s->alarm_period_us,
+			rte_memory_order_relaxed) != 0) {
+		rte_atomic_store_explicit(&s->alarm_period_us, 0,
+				rte_memory_order_relaxed);
+		rte_eal_alarm_cancel(service_alarm_cb, (void *)(uintptr_t)id);
+	}
+
 	unsigned int lcore_id;
 	struct core_state *cs;
 	/* clear the run-bit in all cores */
@@ -391,16 +587,17 @@ service_counter_add(RTE_ATOMIC(uint64_t) *counter, uint64_t operand)
 				  rte_memory_order_relaxed);
 }
 
-static inline void
+static inline int
 service_runner_do_callback(struct rte_service_spec_impl *s,
 			   struct core_state *cs, uint32_t service_idx)
 {
 	rte_eal_trace_service_run_begin(service_idx, rte_lcore_id());
 	void *userdata = s->spec.callback_userdata;
+	int rc;
 
 	if (service_stats_enabled(s)) {
 		uint64_t start = rte_rdtsc();
-		int rc = s->spec.callback(userdata);
+		rc = s->spec.callback(userdata);
 
 		struct service_stats *service_stats =
 			&cs->service_stats[service_idx];
@@ -420,16 +617,19 @@ service_runner_do_callback(struct rte_service_spec_impl *s,
 			service_counter_add(&service_stats->cycles, cycles);
 		}
 	} else {
-		s->spec.callback(userdata);
+		rc = s->spec.callback(userdata);
 	}
 	rte_eal_trace_service_run_end(service_idx, rte_lcore_id());
+
+	return rc;
 }
 
 
 /* Expects the service 's' is valid. */
 static int32_t
 service_run(uint32_t i, struct core_state *cs, const uint64_t *mapped_services,
-	    struct rte_service_spec_impl *s, uint32_t serialize_mt_unsafe)
+	    struct rte_service_spec_impl *s, uint32_t serialize_mt_unsafe,
+	    int *cb_rc)
 {
 	if (!s)
 		return -EINVAL;
@@ -449,14 +649,19 @@ service_run(uint32_t i, struct core_state *cs, const uint64_t *mapped_services,
 
 	rte_bitset_set(cs->service_active_on_lcore, i);
 
+	int rc;
+
 	if ((service_mt_safe(s) == 0) && (serialize_mt_unsafe == 1)) {
 		if (!rte_spinlock_trylock(&s->execute_lock))
 			return -EBUSY;
 
-		service_runner_do_callback(s, cs, i);
+		rc = service_runner_do_callback(s, cs, i);
 		rte_spinlock_unlock(&s->execute_lock);
 	} else
-		service_runner_do_callback(s, cs, i);
+		rc = service_runner_do_callback(s, cs, i);
+
+	if (cb_rc != NULL)
+		*cb_rc = rc;
 
 	return 0;
 }
@@ -499,7 +704,7 @@ rte_service_run_iter_on_app_lcore(uint32_t id, uint32_t serialize_mt_unsafe)
 
 	RTE_BITSET_DECLARE(all_services, RTE_SERVICE_NUM_MAX);
 	rte_bitset_set_all(all_services, RTE_SERVICE_NUM_MAX);
-	int ret = service_run(id, cs, all_services, s, serialize_mt_unsafe);
+	int ret = service_run(id, cs, all_services, s, serialize_mt_unsafe, NULL);
 
 	rte_atomic_fetch_sub_explicit(&s->num_mapped_cores, 1, rte_memory_order_relaxed);
 
@@ -518,13 +723,45 @@ service_runner_func(void *arg)
 	 * memory order here to synchronize with store-release
 	 * in runstate update functions.
 	 */
+	uint32_t idle_loops = 0;
+
 	while (rte_atomic_load_explicit(&cs->runstate, rte_memory_order_acquire) ==
 			RUNSTATE_RUNNING) {
+		bool did_work = false;
 		ssize_t id;
 
 		RTE_BITSET_FOREACH_SET(id, cs->mapped_services, RTE_SERVICE_NUM_MAX) {
-			/* return value ignored as no change to code flow */
-			service_run(id, cs, cs->mapped_services, service_get(id), 1);
+			struct rte_service_spec_impl *s = service_get(id);
+			uint8_t weight = rte_atomic_load_explicit(&s->weight,
+					rte_memory_order_relaxed);
+			uint8_t w;
+
+			for (w = 0; w < weight; w++) {
+				int cb_rc = 0;
+
+				/* return value ignored as no change to code flow */
+				service_run(id, cs, cs->mapped_services, s, 1, &cb_rc);
+
+				/* services signal an empty iteration with -EAGAIN */
+				if (cb_rc != -EAGAIN) {
+					did_work = true;
+					continue;
+				}
+				break;
+			}
+		}
+
+		/* back off progressively while all services report no work */
+		uint16_t backoff_max = rte_atomic_load_explicit(&cs->backoff_max,
+				rte_memory_order_relaxed);
+		if (backoff_max != 0 && !did_work) {
+			uint32_t pauses = RTE_MIN(++idle_loops, (uint32_t)backoff_max);
+			uint32_t p;
+
+			for (p = 0; p < pauses; p++)
+				rte_pause();
+		} else {
+			idle_loops = 0;
 		}
 
 		rte_atomic_store_explicit(&cs->loops, cs->loops + 1, rte_memory_order_relaxed);
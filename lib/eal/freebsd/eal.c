@@ -1053,6 +1053,16 @@ rte_vfio_container_dma_map(__rte_unused int container_fd,
 	return -1;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_vfio_container_dma_map_bulk, 25.07)
+int
+rte_vfio_container_dma_map_bulk(__rte_unused int container_fd,
+			__rte_unused const struct rte_vfio_dma_region *regions,
+			__rte_unused uint32_t n_regions)
+{
+	rte_errno = ENOTSUP;
+	return -1;
+}
+
 RTE_EXPORT_SYMBOL(rte_vfio_container_dma_unmap)
 int
 rte_vfio_container_dma_unmap(__rte_unused int container_fd,
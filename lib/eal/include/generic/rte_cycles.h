@@ -39,6 +39,24 @@ extern enum timer_source eal_timer_source;
 uint64_t
 rte_get_tsc_hz(void);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Get the current monotonic time in nanoseconds.
+ *
+ * The value is derived from the TSC with a shift/multiplier conversion
+ * precomputed at EAL initialization time, and is therefore cheap enough
+ * for data path rate limiting and latency arithmetic.
+ * Before rte_eal_init() the conversion is not set up and 0 is returned.
+ *
+ * @return
+ *   The number of nanoseconds since the TSC epoch (machine boot).
+ */
+__rte_experimental
+uint64_t
+rte_time_ns(void);
+
 /**
  * Return the number of TSC cycles since boot
  *
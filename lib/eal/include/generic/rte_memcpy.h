@@ -115,6 +115,49 @@ rte_mov256(uint8_t *dst, const uint8_t *src);
 static void *
 rte_memcpy(void *dst, const void *src, size_t n);
 
+/**
+ * Copy bytes from one location to another, bypassing the cache for the
+ * destination when the copy is large enough for streaming stores to pay
+ * off. The locations must not overlap.
+ *
+ * Intended for destinations that are not re-read by the CPU, such as DMA
+ * staging regions, to avoid evicting useful cache content. On x86, copies
+ * of at least ``rte_memcpy_nt_threshold`` bytes use streaming stores; the
+ * crossover size can be measured on the running machine with
+ * ``rte_memcpy_nt_calibrate()``. Architectures without a streaming store
+ * primitive fall back to rte_memcpy().
+ *
+ * @param dst
+ *   Pointer to the destination of the data.
+ * @param src
+ *   Pointer to the source data.
+ * @param n
+ *   Number of bytes to copy.
+ * @return
+ *   Pointer to the destination data.
+ */
+static void *
+rte_memcpy_nt(void *dst, const void *src, size_t n);
+
+/**
+ * Copy bytes from one location to another, with extra hints.
+ * The locations must not overlap.
+ *
+ * @param dst
+ *   Pointer to the destination of the data.
+ * @param src
+ *   Pointer to the source data.
+ * @param n
+ *   Number of bytes to copy.
+ * @param flags
+ *   ``RTE_MEMCPY_F_DST_NT`` to bypass the cache for the destination,
+ *   as rte_memcpy_nt() does.
+ * @return
+ *   Pointer to the destination data.
+ */
+static void *
+rte_memcpy_ex(void *dst, const void *src, size_t n, unsigned int flags);
+
 #endif /* __DOXYGEN__ */
 
 #ifdef __cplusplus
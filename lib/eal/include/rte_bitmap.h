@@ -582,6 +582,73 @@ rte_bitmap_scan(struct rte_bitmap *bmp, uint32_t *pos, uint64_t *slab)
 	return 0;
 }
 
+/**
+ * Bitmap bulk scan (with automatic wrap-around)
+ *
+ * Gathers the positions of multiple set bits in one call, amortizing the
+ * two-level scan overhead across them. Positions are gathered a whole slab
+ * at a time, so the function returns once fewer than
+ * RTE_BITMAP_SLAB_BIT_SIZE free slots remain in the pos array, or once
+ * every set bit has been reported. Like with rte_bitmap_scan(), the
+ * internal pointers of the bitmap advance past the returned slabs, so
+ * consecutive calls continue the scan round-robin.
+ *
+ * @param bmp
+ *   Handle to bitmap instance
+ * @param pos
+ *   Array where to store the positions of the set bits. Must have room for
+ *   at least RTE_BITMAP_SLAB_BIT_SIZE entries for any bit to be reported.
+ * @param num
+ *   Number of entries in the pos array.
+ * @return
+ *   Number of positions stored in the pos array.
+ */
+static inline uint32_t
+rte_bitmap_scan_bulk(struct rte_bitmap *bmp, uint32_t pos[], uint32_t num)
+{
+	uint32_t first_slab_pos = UINT32_MAX;
+	uint32_t slab_pos, n = 0;
+	uint64_t slab;
+
+	while (num - n >= RTE_BITMAP_SLAB_BIT_SIZE) {
+		if (!rte_bitmap_scan(bmp, &slab_pos, &slab))
+			break;
+
+		/* Stop after one full wrap-around, so that each set bit is
+		 * reported at most once per call.
+		 */
+		if (slab_pos == first_slab_pos)
+			break;
+		if (first_slab_pos == UINT32_MAX)
+			first_slab_pos = slab_pos;
+
+		for ( ; slab != 0; slab &= slab - 1)
+			pos[n++] = slab_pos + rte_bsf64(slab);
+	}
+
+	return n;
+}
+
+/**
+ * Count the number of bits set in the bitmap
+ *
+ * @param bmp
+ *   Handle to bitmap instance
+ * @return
+ *   Number of bits set in the bitmap
+ */
+static inline uint64_t
+rte_bitmap_popcount(struct rte_bitmap *bmp)
+{
+	uint64_t count = 0;
+	uint32_t i;
+
+	for (i = 0; i < bmp->array2_size; i++)
+		count += rte_popcount64(bmp->array2[i]);
+
+	return count;
+}
+
 #ifdef __cplusplus
 }
 #endif
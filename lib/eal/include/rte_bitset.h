@@ -852,6 +852,75 @@ rte_bitset_find_set_wrap(const uint64_t *bitset, size_t size, size_t start_bit,
 #endif
 }
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Find multiple set bits.
+ *
+ * Scans the bitset in the forward direction (i.e., starting at the
+ * least significant bit), starting at an offset @c start_bit into the
+ * bitset, and records the index of each '1' encountered, until @c num
+ * indices have been recorded or the end of the bitset is reached.
+ * Gathering many indices in one call amortizes the scan overhead
+ * across multiple set bits.
+ *
+ * @param bitset
+ *   A pointer to the array of words making up the bitset.
+ * @param size
+ *   The size of the bitset (in bits).
+ * @param start_bit
+ *   The index of the first bit to check. Must be less than or equal
+ *   to @c size.
+ * @param found_bits
+ *   An array where to record the indices of the set bits.
+ * @param num
+ *   The maximum number of indices to record.
+ * @return
+ *   Returns the number of indices recorded.
+ */
+__rte_experimental
+static inline size_t
+rte_bitset_find_set_bulk(const uint64_t *bitset, size_t size, size_t start_bit,
+		size_t found_bits[], size_t num)
+{
+#ifdef ALLOW_EXPERIMENTAL_API
+	size_t word_idx;
+	size_t n = 0;
+
+	RTE_ASSERT(start_bit <= size);
+
+	if (unlikely(size == 0))
+		return 0;
+
+	for (word_idx = __RTE_BITSET_WORD_IDX(start_bit);
+			word_idx < RTE_BITSET_NUM_WORDS(size); word_idx++) {
+		size_t word_base = word_idx * RTE_BITSET_WORD_BITS;
+		uint64_t word = bitset[word_idx];
+
+		if (word_base < start_bit)
+			word &= UINT64_MAX << __RTE_BITSET_BIT_OFFSET(start_bit);
+		if (word_idx == RTE_BITSET_NUM_WORDS(size) - 1)
+			word &= __RTE_BITSET_USED_MASK(size);
+
+		for ( ; word != 0; word &= word - 1) {
+			if (n == num)
+				return n;
+			found_bits[n++] = word_base + rte_bsf64(word);
+		}
+	}
+
+	return n;
+#else
+	RTE_SET_USED(bitset);
+	RTE_SET_USED(size);
+	RTE_SET_USED(start_bit);
+	RTE_SET_USED(found_bits);
+	RTE_SET_USED(num);
+	RTE_VERIFY(false);
+#endif
+}
+
 /**
  * @warning
  * @b EXPERIMENTAL: this API may change without prior notice.
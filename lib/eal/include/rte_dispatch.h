@@ -0,0 +1,211 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2025 Intel Corporation
+ */
+
+#ifndef _RTE_DISPATCH_H_
+#define _RTE_DISPATCH_H_
+
+/**
+ * @file
+ *
+ * Runtime kernel dispatch.
+ *
+ * Libraries and drivers that implement the same operation with several
+ * ISA-specific kernels (scalar, SSE, AVX2, AVX-512, NEON, ...) can
+ * register the variants here instead of open-coding the CPU flag and
+ * SIMD bitwidth checks at every selection site.
+ *
+ * A kernel is bound to one of its variants on first use. Eligibility is
+ * decided from the variant's required SIMD bitwidth against
+ * rte_vect_get_max_simd_bitwidth() plus an optional per-variant check
+ * callback. When two or more eligible variants provide a benchmark
+ * callback, a short micro-calibration is run and the fastest measured
+ * variant wins; otherwise the widest eligible variant is chosen. This
+ * catches parts where the nominally widest ISA is not the fastest one.
+ *
+ * The chosen binding of every registered kernel is reported through the
+ * /eal/dispatch telemetry command and can be overridden per kernel with
+ * rte_dispatch_override().
+ */
+
+#include <stdint.h>
+#include <sys/queue.h>
+
+#include <rte_compat.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum number of variants a kernel may register. */
+#define RTE_DISPATCH_MAX_VARIANTS 8
+
+/**
+ * Benchmark callback of a kernel variant.
+ *
+ * Runs a short fixed workload with the variant implementation and
+ * returns its cost. The same callback is shared by all variants of a
+ * kernel; the implementation under test is passed as the first
+ * argument.
+ *
+ * @param func
+ *   Implementation to be measured, the func field of the variant.
+ * @param arg
+ *   Kernel benchmark argument, the bench_arg field of the kernel.
+ * @return
+ *   Workload cost in TSC cycles, lower is better.
+ */
+typedef uint64_t (*rte_dispatch_bench_t)(const void *func, void *arg);
+
+/**
+ * Support check callback of a kernel variant, used for requirements the
+ * SIMD bitwidth does not express (e.g. a particular CPU flag subset).
+ *
+ * @return
+ *   Non-zero if the variant can run on this CPU, 0 otherwise.
+ */
+typedef int (*rte_dispatch_supported_t)(void);
+
+/** One implementation of a kernel. */
+struct rte_dispatch_variant {
+	const char *name;           /**< Variant name, e.g. "avx512". */
+	const void *func;           /**< Implementation entry point. */
+	uint16_t simd_width;        /**< Required width, RTE_VECT_SIMD_*. */
+	rte_dispatch_supported_t supported; /**< Extra check, may be NULL. */
+};
+
+/**
+ * A dispatched kernel. The structure is owned by the registering
+ * library and must stay valid until rte_dispatch_unregister().
+ * Fill in the first four fields before registering; the remaining
+ * fields are managed by the dispatch framework.
+ */
+struct rte_dispatch_kernel {
+	const char *name;           /**< Unique kernel name. */
+	const struct rte_dispatch_variant *variants; /**< Variant array. */
+	uint16_t nb_variants;       /**< Number of variants. */
+	rte_dispatch_bench_t bench; /**< Calibration hook, may be NULL. */
+	void *bench_arg;            /**< Passed to the bench callback. */
+
+	/* Fields below are set by the dispatch framework. */
+	const struct rte_dispatch_variant *selected; /**< Bound variant. */
+	uint64_t cycles[RTE_DISPATCH_MAX_VARIANTS];  /**< Measured cost. */
+	TAILQ_ENTRY(rte_dispatch_kernel) next;       /**< Registry entry. */
+};
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Register a kernel with the dispatch framework. The kernel is not
+ * bound to a variant yet; binding happens on the first
+ * rte_dispatch_func() call or explicitly via rte_dispatch_bind().
+ *
+ * @param kernel
+ *   Kernel to register, with name, variants, nb_variants and optionally
+ *   bench/bench_arg filled in
+ * @return
+ *   0 on success, negative errno otherwise (-EEXIST if a kernel with
+ *   the same name is already registered).
+ */
+__rte_experimental
+int
+rte_dispatch_register(struct rte_dispatch_kernel *kernel);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Remove a kernel from the dispatch framework.
+ *
+ * @param kernel
+ *   Kernel previously passed to rte_dispatch_register()
+ */
+__rte_experimental
+void
+rte_dispatch_unregister(struct rte_dispatch_kernel *kernel);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Bind a kernel to a variant, re-running eligibility checks and, when a
+ * benchmark callback is provided, the micro-calibration.
+ *
+ * @param kernel
+ *   Kernel to bind
+ * @return
+ *   The implementation entry point of the chosen variant, or NULL if no
+ *   variant is eligible on this CPU.
+ */
+__rte_experimental
+const void *
+rte_dispatch_bind(struct rte_dispatch_kernel *kernel);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Return the implementation a kernel is bound to, binding it first if
+ * needed.
+ *
+ * @param kernel
+ *   Kernel to query
+ * @return
+ *   The implementation entry point of the bound variant, or NULL if no
+ *   variant is eligible on this CPU.
+ */
+__rte_experimental
+const void *
+rte_dispatch_func(struct rte_dispatch_kernel *kernel);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Force a registered kernel to use a particular variant, e.g. to apply
+ * a known-good per-platform profile or to rule the dispatcher out while
+ * debugging. The variant must still be eligible on this CPU.
+ *
+ * @param kernel_name
+ *   Name of a registered kernel
+ * @param variant_name
+ *   Name of one of its variants
+ * @return
+ *   0 on success, -ENOENT if the kernel or variant is not found,
+ *   -ENOTSUP if the variant is not eligible on this CPU.
+ */
+__rte_experimental
+int
+rte_dispatch_override(const char *kernel_name, const char *variant_name);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Pick the best eligible variant out of an array without registering a
+ * kernel, using the same rules as rte_dispatch_bind(). Intended for
+ * selection sites that are instance-specific and so do not fit the
+ * named kernel registry.
+ *
+ * @param variants
+ *   Array of candidate variants
+ * @param nb_variants
+ *   Number of candidates
+ * @param bench
+ *   Calibration hook, may be NULL to select on SIMD width only
+ * @param bench_arg
+ *   Passed to the bench callback
+ * @return
+ *   Index of the chosen variant, or -ENOTSUP if none is eligible.
+ */
+__rte_experimental
+int
+rte_dispatch_calibrate(const struct rte_dispatch_variant *variants,
+	uint16_t nb_variants, rte_dispatch_bench_t bench, void *bench_arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTE_DISPATCH_H_ */
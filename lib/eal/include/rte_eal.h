@@ -341,6 +341,99 @@ rte_mp_request_async(struct rte_mp_msg *req, const struct timespec *ts,
 int
 rte_mp_reply(struct rte_mp_msg *msg, const char *peer);
 
+/**
+ * Fast action function typedef used by other components.
+ *
+ * Fast actions are executed by the primary process to serve requests
+ * submitted by secondary processes through the shared-memory request queue
+ * (see rte_mp_request_fast()). Unlike regular actions, the reply is filled
+ * in directly by the callback instead of being sent with rte_mp_reply().
+ *
+ * @note The reply cannot carry file descriptors; use the socket based
+ *   channel for fd passing.
+ *
+ * @note No memory allocations should take place inside the callback.
+ */
+typedef int (*rte_mp_fast_t)(const struct rte_mp_msg *req,
+		struct rte_mp_msg *reply);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Register a fast action function for primary/secondary communication.
+ *
+ * Fast actions are served from a shared-memory request queue by a dedicated
+ * thread in the primary process, bypassing the socket based mp channel and
+ * its per-message allocations. Only the primary process can register fast
+ * actions; the queue is created on the first registration.
+ *
+ * @note IPC may be unsupported in certain circumstances, so caller should
+ *    check for ENOTSUP error.
+ *
+ * @param name
+ *   The name argument plays as the nonredundant key to find the action.
+ *
+ * @param action
+ *   The action argument is the function pointer to the action function.
+ *
+ * @return
+ *  - 0 on success.
+ *  - (<0) on failure.
+ */
+__rte_experimental
+int
+rte_mp_fast_action_register(const char *name, rte_mp_fast_t action);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Unregister a fast action function for primary/secondary communication.
+ *
+ * @param name
+ *   The name argument plays as the nonredundant key to find the action.
+ */
+__rte_experimental
+void
+rte_mp_fast_action_unregister(const char *name);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Send a request to the primary process through the shared-memory queue
+ * and expect a reply.
+ *
+ * The request is written into a preallocated slot of the shared-memory
+ * queue and served by the fast action registered under the same name in
+ * the primary process, avoiding the socket round trip and the primary's
+ * mp thread entirely. The call transparently falls back to
+ * rte_mp_request_sync() when the request carries file descriptors, when
+ * the caller is the primary process, or when the primary has not created
+ * the queue, so it is always safe to use in place of the latter.
+ *
+ * @note The caller is responsible to free reply->msgs.
+ *
+ * @param req
+ *   The req argument contains the customized request message.
+ *
+ * @param reply
+ *   The reply argument will be for storing the replied message;
+ *   the caller is responsible for free reply->msgs.
+ *
+ * @param ts
+ *   The ts argument specifies how long we can wait for the peer to reply.
+ *
+ * @return
+ *  - On success, return 0.
+ *  - On failure, return -1, and the reason will be stored in rte_errno.
+ */
+__rte_experimental
+int
+rte_mp_request_fast(struct rte_mp_msg *req, struct rte_mp_reply *reply,
+		const struct timespec *ts);
+
 /**
  * Usage function typedef used by the application usage function.
  *
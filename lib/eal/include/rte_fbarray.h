@@ -32,6 +32,7 @@
 
 #include <stdio.h>
 
+#include <rte_compat.h>
 #include <rte_rwlock.h>
 
 #ifdef __cplusplus
@@ -206,6 +207,64 @@ int
 rte_fbarray_set_free(struct rte_fbarray *arr, unsigned int idx);
 
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Mark a contiguous range of elements as used.
+ *
+ * This is equivalent to calling ``rte_fbarray_set_used()`` on each element of
+ * the range in turn, but marks whole 64-element blocks at once, so it is the
+ * preferred way of marking large ranges.
+ *
+ * @param arr
+ *   Valid pointer to allocated and correctly set up ``rte_fbarray`` structure.
+ *
+ * @param start
+ *   Element index of start of range.
+ *
+ * @param len
+ *   Length of range (zero-length ranges are allowed).
+ *
+ * @return
+ *  - 0 on success.
+ *  - -1 on failure, with ``rte_errno`` indicating reason for failure.
+ */
+__rte_experimental
+int
+rte_fbarray_set_used_range(struct rte_fbarray *arr, unsigned int start,
+		unsigned int len);
+
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Mark a contiguous range of elements as free.
+ *
+ * This is equivalent to calling ``rte_fbarray_set_free()`` on each element of
+ * the range in turn, but marks whole 64-element blocks at once, so it is the
+ * preferred way of marking large ranges.
+ *
+ * @param arr
+ *   Valid pointer to allocated and correctly set up ``rte_fbarray`` structure.
+ *
+ * @param start
+ *   Element index of start of range.
+ *
+ * @param len
+ *   Length of range (zero-length ranges are allowed).
+ *
+ * @return
+ *  - 0 on success.
+ *  - -1 on failure, with ``rte_errno`` indicating reason for failure.
+ */
+__rte_experimental
+int
+rte_fbarray_set_free_range(struct rte_fbarray *arr, unsigned int start,
+		unsigned int len);
+
+
 /**
  * Check whether element at specified index is marked as used.
  *
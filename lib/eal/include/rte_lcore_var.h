@@ -204,6 +204,105 @@ void *
 rte_lcore_var_alloc(size_t size, size_t align)
 	__rte_alloc_size(1) __rte_alloc_align(2);
 
+/**
+ * Double-buffered shadow copies of an lcore variable's values.
+ *
+ * A snapshot decouples readers (e.g., telemetry or statistics
+ * collectors) from the owning threads: owners periodically publish
+ * their value instance into a shadow buffer, and collectors read the
+ * shadows without ever touching the live, owner-private cache lines.
+ */
+struct rte_lcore_var_snapshot;
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Create a snapshot for an lcore variable.
+ *
+ * Two shadow buffers are allocated per lcore id, so a publication may
+ * proceed concurrently with readers of the previously published copy.
+ *
+ * @param handle
+ *   The lcore variable handle.
+ * @param size
+ *   The size (in bytes) of the variable's per-lcore id value.
+ *   Must be > 0 and equal to or less than @c RTE_MAX_LCORE_VAR.
+ * @return
+ *   The snapshot, or NULL on memory allocation failure.
+ */
+__rte_experimental
+struct rte_lcore_var_snapshot *
+rte_lcore_var_snapshot_create(void *handle, size_t size);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Free a snapshot created by rte_lcore_var_snapshot_create().
+ *
+ * The caller must make sure no thread publishes to or reads from the
+ * snapshot after this function has been called.
+ *
+ * @param snapshot
+ *   The snapshot to free. May be NULL, in which case nothing is done.
+ */
+__rte_experimental
+void
+rte_lcore_var_snapshot_free(struct rte_lcore_var_snapshot *snapshot);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Publish the calling thread's lcore variable value into the snapshot.
+ *
+ * The current contents of the caller's value instance are copied into
+ * the shadow buffer not being exposed to readers, which is then made
+ * the buffer retrieved by rte_lcore_var_snapshot_read().
+ *
+ * May only be called by EAL threads and registered non-EAL threads.
+ * Different lcore ids may publish concurrently.
+ *
+ * @param snapshot
+ *   The snapshot to publish into.
+ */
+__rte_experimental
+void
+rte_lcore_var_snapshot_publish(struct rte_lcore_var_snapshot *snapshot);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Retrieve the most recently published value for the specified lcore id.
+ *
+ * The shadow buffer contents are copied into the caller-provided
+ * destination. Only the shadow buffers are accessed; the live value
+ * instance owned by the lcore id's thread is left untouched. In the
+ * unlikely case the owner publishes twice during the copy, the copy is
+ * transparently retried.
+ *
+ * May be called by any thread, including unregistered threads.
+ *
+ * @param snapshot
+ *   The snapshot to read from.
+ * @param lcore_id
+ *   The lcore id specifying which of the @c RTE_MAX_LCORE value
+ *   instances should be retrieved.
+ * @param dst
+ *   A buffer of at least the size specified at snapshot creation,
+ *   receiving the published value.
+ * @return
+ *   - 0: Success.
+ *   - -EINVAL: Invalid lcore id.
+ *   - -ENODATA: The lcore id has not yet published any value.
+ */
+__rte_experimental
+int
+rte_lcore_var_snapshot_read(const struct rte_lcore_var_snapshot *snapshot,
+		unsigned int lcore_id, void *dst);
+
 #ifdef __cplusplus
 }
 #endif
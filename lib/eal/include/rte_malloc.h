@@ -31,6 +31,24 @@ struct rte_malloc_socket_stats {
 	size_t heap_allocsz_bytes; /**< Total allocated bytes on heap */
 };
 
+/** Number of log2 size buckets in struct rte_malloc_frag_stats. */
+#define RTE_MALLOC_FRAG_BUCKETS 32
+
+/**
+ * Free-element size distribution of a heap, obtained from
+ * rte_malloc_get_frag_stats(). Bucket *b* covers free elements whose
+ * size in bytes is in [2^b, 2^(b+1)); elements larger than the last
+ * bucket are counted in the last bucket.
+ */
+struct rte_malloc_frag_stats {
+	uint64_t free_count[RTE_MALLOC_FRAG_BUCKETS];
+	/**< Number of free elements per size bucket */
+	uint64_t free_bytes[RTE_MALLOC_FRAG_BUCKETS];
+	/**< Total bytes of free elements per size bucket */
+	size_t greatest_free_size; /**< Size in bytes of largest free block */
+	uint64_t free_elems;       /**< Total number of free elements */
+};
+
 /**
  * Functions that expect return value to be freed with rte_free()
  */
@@ -311,6 +329,93 @@ int
 rte_malloc_get_socket_stats(int socket,
 		struct rte_malloc_socket_stats *socket_stats);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Get the free-element size distribution of the specified heap.
+ *
+ * While rte_malloc_get_socket_stats() reports aggregate free space,
+ * this function shows how that space is fragmented across free
+ * elements, which is what decides whether a large allocation can still
+ * succeed.
+ *
+ * @note This function is not thread-safe with respect to
+ *    ``rte_malloc_heap_create()``/``rte_malloc_heap_destroy()`` functions.
+ *
+ * @param socket
+ *   An unsigned integer specifying the socket to get the distribution for
+ * @param frag_stats
+ *   A structure which provides memory to store the distribution
+ * @return
+ *   0 on success, -1 on error
+ */
+__rte_experimental
+int
+rte_malloc_get_frag_stats(int socket,
+		struct rte_malloc_frag_stats *frag_stats);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Enable the malloc allocation profiler.
+ *
+ * While enabled, every allocation is accounted to its callsite (keyed
+ * by the return address of the rte_malloc()/rte_zmalloc() family entry
+ * point used), counting allocations, failures and requested bytes.
+ * Samples are recorded without locks into a fixed-size table, so the
+ * overhead per allocation is a few atomic additions; counters are
+ * approximate under heavy contention. Once the table is full,
+ * allocations from further new callsites are not recorded.
+ *
+ * @return
+ *   0 on success
+ */
+__rte_experimental
+int
+rte_malloc_profile_enable(void);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Disable the malloc allocation profiler. Already recorded statistics
+ * are kept and can still be dumped.
+ *
+ * @return
+ *   0 on success
+ */
+__rte_experimental
+int
+rte_malloc_profile_disable(void);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Reset all statistics recorded by the malloc allocation profiler.
+ * Concurrent allocations may leave a few samples behind.
+ */
+__rte_experimental
+void
+rte_malloc_profile_reset(void);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Dump the statistics recorded by the malloc allocation profiler,
+ * one line per callsite. Addresses can be resolved to function names
+ * with addr2line or a debugger against the running binary.
+ *
+ * @param f
+ *   A pointer to a file for output
+ */
+__rte_experimental
+void
+rte_malloc_profile_dump(FILE *f);
+
 /**
  * Add memory chunk to a heap with specified name.
  *
@@ -474,6 +579,58 @@ rte_malloc_heap_create(const char *heap_name);
 int
 rte_malloc_heap_destroy(const char *heap_name);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Enable a malloc cache for the calling lcore.
+ *
+ * Blocks freed by this thread whose usable size does not exceed
+ * ``max_size`` are kept in a per-lcore cache of up to ``count`` entries
+ * instead of being returned to the heap, and subsequent allocations from
+ * this thread are served from the cache when a suitable block is found.
+ * Cache hits and cached frees do not take the heap lock, which removes
+ * allocation jitter caused by other threads contending on the same socket
+ * heap.
+ *
+ * Cached blocks still count as allocated from the heap's perspective.
+ * Call rte_malloc_lcore_cache_disable() to flush them back, in particular
+ * before destroying a heap they may have been allocated from.
+ *
+ * @param max_size
+ *   Largest usable block size, in bytes, that may be cached.
+ * @param count
+ *   Maximum number of blocks kept in the cache.
+ * @return
+ *   - 0 on success
+ *   - -1 in case of error, with rte_errno set to one of the following:
+ *     EINVAL - ``max_size`` or ``count`` was zero
+ *     ENOTSUP - the calling thread has no lcore ID
+ *     EEXIST - a cache is already enabled for this lcore
+ *     ENOMEM - not enough memory for the cache bookkeeping
+ */
+__rte_experimental
+int
+rte_malloc_lcore_cache_enable(size_t max_size, unsigned int count);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Disable the malloc cache of the calling lcore.
+ *
+ * All cached blocks are returned to their heaps.
+ *
+ * @return
+ *   - 0 on success
+ *   - -1 in case of error, with rte_errno set to one of the following:
+ *     ENOTSUP - the calling thread has no lcore ID
+ *     ENOENT - no cache is enabled for this lcore
+ */
+__rte_experimental
+int
+rte_malloc_lcore_cache_disable(void);
+
 /**
  * Find socket ID corresponding to a named heap.
  *
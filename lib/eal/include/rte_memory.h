@@ -211,6 +211,43 @@ typedef int (*rte_memseg_list_walk_t)(const struct rte_memseg_list *msl,
 int
 rte_memseg_walk(rte_memseg_walk_t func, void *arg);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Start pre-faulting all internal memory segments in the background.
+ *
+ * This is intended for use with the ``--defer-prefault`` EAL option, which
+ * maps hugepages at init without populating them. A one-shot service named
+ * ``mem_prefault`` is registered; the application must map it to a service
+ * lcore and set its runstate for the pre-touch to make progress. Call
+ * rte_mem_prefault_wait() before entering the data path to guarantee all
+ * memory is resident.
+ *
+ * @param service_id
+ *   Updated with the id of the registered pre-fault service.
+ * @return
+ *   0 on success, -EALREADY if pre-faulting already ran or is running,
+ *   or a negative error code from service registration.
+ */
+__rte_experimental
+int
+rte_mem_prefault_start(uint32_t *service_id);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Block until all internal memory segments have been pre-faulted.
+ *
+ * If rte_mem_prefault_start() was not called, the calling thread performs
+ * the pre-touch itself. Otherwise the call returns once the background
+ * service has finished.
+ */
+__rte_experimental
+void
+rte_mem_prefault_wait(void);
+
 /**
  * Walk each VA-contiguous area.
  *
@@ -307,6 +307,92 @@ int rte_memzone_free(const struct rte_memzone *mz);
  */
 const struct rte_memzone *rte_memzone_lookup(const char *name);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Reserve one replica of a memory zone on every socket.
+ *
+ * This is intended for read-mostly tables shared by lcores on multiple
+ * sockets: each socket gets its own copy, so no reader pays remote memory
+ * latency. Replicas are regular memzones named after ``name`` with a
+ * socket id suffix, so ``name`` must be short enough to leave room for it.
+ * Use rte_memzone_replicated_update() to keep the copies coherent and
+ * rte_memzone_lookup_local() to retrieve the caller's local copy.
+ *
+ * @param name
+ *   The name of the memzone, common to all replicas.
+ * @param len
+ *   The size of each replica, in bytes.
+ * @param flags
+ *   Memzone flags, as for rte_memzone_reserve_aligned().
+ * @param align
+ *   Alignment of each replica (must be a power of two, or zero).
+ * @return
+ *   A pointer to the replica local to the calling thread's socket, or NULL
+ *   on error with rte_errno set. On failure no replica is left allocated.
+ */
+__rte_experimental
+const struct rte_memzone *rte_memzone_reserve_replicated(const char *name,
+			size_t len, unsigned int flags, unsigned int align);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Find the replica of a replicated memzone local to the caller's socket.
+ *
+ * If no replica exists on the calling thread's socket, the first replica
+ * found on any socket is returned.
+ *
+ * @param name
+ *   The name passed to rte_memzone_reserve_replicated().
+ * @return
+ *   A pointer to a read-only memzone descriptor, or NULL if not found.
+ */
+__rte_experimental
+const struct rte_memzone *rte_memzone_lookup_local(const char *name);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Write data through to all replicas of a replicated memzone.
+ *
+ * The copies are updated one after the other without synchronizing
+ * readers; this matches read-mostly usage where individual entry updates
+ * are independently consistent.
+ *
+ * @param name
+ *   The name passed to rte_memzone_reserve_replicated().
+ * @param offset
+ *   Byte offset into the zone at which to write.
+ * @param src
+ *   Data to write.
+ * @param len
+ *   Number of bytes to write.
+ * @return
+ *   0 on success, -1 on error with rte_errno set (ENOENT if no replica
+ *   was found, EINVAL if the range is out of bounds).
+ */
+__rte_experimental
+int rte_memzone_replicated_update(const char *name, size_t offset,
+			const void *src, size_t len);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Free all replicas of a replicated memzone.
+ *
+ * @param name
+ *   The name passed to rte_memzone_reserve_replicated().
+ * @return
+ *   0 on success, -1 on error with rte_errno set.
+ */
+__rte_experimental
+int rte_memzone_free_replicated(const char *name);
+
 /**
  * Dump all reserved memzones to a file.
  *
@@ -132,6 +132,127 @@ int32_t rte_service_map_lcore_set(uint32_t service_id, uint32_t lcore,
  */
 int32_t rte_service_map_lcore_get(uint32_t service_id, uint32_t lcore);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Set the scheduling weight of a service.
+ *
+ * A service lcore invokes each mapped service up to *weight* times per
+ * scheduling round, so a service with weight 4 gets four times the
+ * invocations of a weight 1 service mapped to the same lcore. A service
+ * reporting no work (returning -EAGAIN from its callback) is not invoked
+ * again within the same round. The default weight is 1.
+ *
+ * @param id The id of the service
+ * @param weight Invocations per scheduling round, must be non-zero
+ * @retval 0 Weight updated successfully
+ * @retval -EINVAL An invalid service id or a zero weight was provided
+ */
+__rte_experimental
+int32_t rte_service_weight_set(uint32_t id, uint8_t weight);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Retrieve the scheduling weight of a service.
+ *
+ * @param id The id of the service
+ * @retval >0 The weight of the service
+ * @retval -EINVAL An invalid service id was provided
+ */
+__rte_experimental
+int32_t rte_service_weight_get(uint32_t id);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Configure idle backoff for a service lcore.
+ *
+ * When enabled, a service lcore whose mapped services all report no work
+ * (callbacks returning -EAGAIN) pauses progressively between scheduling
+ * rounds, one additional pause iteration per consecutive idle round up to
+ * *max_pauses*, instead of spinning at full rate. Any service doing work
+ * resets the backoff. Services that never return -EAGAIN keep the lcore
+ * polling at full rate. Backoff is disabled by default.
+ *
+ * @param lcore The service core to configure
+ * @param max_pauses Upper bound of pause iterations per round, 0 disables
+ *                   backoff
+ * @retval 0 Backoff updated successfully
+ * @retval -EINVAL The lcore is not a service core
+ */
+__rte_experimental
+int32_t rte_service_lcore_backoff_set(uint32_t lcore, uint16_t max_pauses);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Retrieve the idle backoff limit of a service lcore.
+ *
+ * @param lcore The service core to query
+ * @retval >=0 The configured maximum pause iterations
+ * @retval -EINVAL The lcore is not a service core
+ */
+__rte_experimental
+int32_t rte_service_lcore_backoff_get(uint32_t lcore);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Run a service periodically from the EAL interrupt thread.
+ *
+ * When enabled, the service callback is invoked from the interrupt thread
+ * every *period_us* microseconds, up to *max_batch* times per period or
+ * until the callback reports no work (returns -EAGAIN), whichever comes
+ * first. This allows slow-path services with periodic semantics to run
+ * without dedicating a service lcore to them. The service still honours
+ * its component and application runstates, and multi-thread unsafe
+ * services are serialized against service lcores through the usual
+ * execute lock.
+ *
+ * Per-lcore service statistics are not collected for invocations made
+ * from the interrupt thread.
+ *
+ * Passing *period_us* of zero disables the mode and cancels the pending
+ * alarm. Updating the period or batch of an already enabled service takes
+ * effect from the next expiry.
+ *
+ * @param id The id of the service
+ * @param period_us Invocation period in microseconds, 0 to disable
+ * @param max_batch Maximum callback invocations per period, must be
+ *                  non-zero when enabling
+ * @retval 0 Alarm mode updated successfully
+ * @retval -EINVAL An invalid service id or a zero batch was provided
+ * @retval -ENOTSUP Alarm mode is not supported in this configuration
+ */
+__rte_experimental
+int32_t rte_service_alarm_mode_set(uint32_t id, uint32_t period_us,
+		uint32_t max_batch);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Retrieve the interrupt thread execution parameters of a service.
+ *
+ * @param id The id of the service
+ * @param period_us Filled with the invocation period, 0 when disabled.
+ *                  Can be NULL.
+ * @param max_batch Filled with the maximum invocations per period.
+ *                  Can be NULL.
+ * @retval 1 Alarm mode is enabled for this service
+ * @retval 0 Alarm mode is disabled for this service
+ * @retval -EINVAL An invalid service id was provided
+ */
+__rte_experimental
+int32_t rte_service_alarm_mode_get(uint32_t id, uint32_t *period_us,
+		uint32_t *max_batch);
+
 /**
  * Set the runstate of the service.
  *
@@ -17,6 +17,7 @@
  */
 
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 
 #include <rte_common.h>
@@ -133,6 +134,81 @@ int rte_trace_regexp(const char *regex, bool enable);
 __rte_experimental
 int rte_trace_save(void);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Enable the trace streaming mode.
+ *
+ * In streaming mode, the per-thread trace buffers are ring-structured:
+ * instead of wrapping over or discarding events when a buffer fills up,
+ * the emitting threads stop at the last drained position and account the
+ * dropped events. A collector thread drains the rings continuously to the
+ * trace directory with rte_trace_stream_save(), making sustained
+ * high-rate tracing lossless as long as the collector keeps up.
+ *
+ * Must be called before any trace event has been emitted, i.e., before
+ * the per-thread trace buffers are allocated. The buffer size configured
+ * with the --trace-bufsz EAL parameter is rounded up to a power of two.
+ *
+ * @return
+ *   - 0: Success.
+ *   - (-EBUSY): Trace buffers have already been allocated.
+ */
+__rte_experimental
+int rte_trace_stream_enable(void);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Drain all streaming mode trace buffers to the trace directory.
+ *
+ * Events drained from a given per-thread buffer are appended to that
+ * buffer's ``channel`` file, so repeated calls build up contiguous trace
+ * streams. Intended to be called periodically from a collector thread.
+ *
+ * The last event emitted by a thread only becomes visible to the
+ * collector on that thread's next emission, or when the emitting thread
+ * calls rte_trace_stream_flush().
+ *
+ * @return
+ *   - >=0: Number of bytes drained.
+ *   - (-ENOTSUP): Streaming mode is not enabled.
+ *   - <0 : Failure.
+ */
+__rte_experimental
+int rte_trace_stream_save(void);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Make all trace events emitted by the calling thread visible to the
+ * collector.
+ *
+ * A no-op unless streaming mode is enabled. May be called from the fast
+ * path, e.g., on an empty poll.
+ */
+__rte_experimental
+void rte_trace_stream_flush(void);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Get the total number of trace events dropped in streaming mode.
+ *
+ * Events are dropped when an emitting thread finds no free space in its
+ * trace ring, i.e., when the collector does not keep up. Per-thread drop
+ * counts are included in the rte_trace_dump() output.
+ *
+ * @return
+ *   Number of events dropped since streaming mode was enabled.
+ */
+__rte_experimental
+uint64_t rte_trace_stream_drops_get(void);
+
 /**
  * Dump the trace metadata to a file.
  *
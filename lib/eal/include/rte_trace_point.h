@@ -310,12 +310,56 @@ struct __rte_trace_stream_header {
 struct __rte_trace_header {
 	uint32_t offset;
 	uint32_t len;
+	/* Ring mode state; see rte_trace_stream_enable() */
+	uint32_t stream;
+	RTE_ATOMIC(uint64_t) prod;
+	RTE_ATOMIC(uint64_t) cons;
+	RTE_ATOMIC(uint64_t) drops;
+	uint64_t reserved;
 	struct __rte_trace_stream_header stream_header;
 	uint8_t mem[];
 };
 
+/* Marker placed on an unusable buffer tail in stream mode */
+#define __RTE_TRACE_STREAM_PAD UINT64_MAX
+
 RTE_DECLARE_PER_LCORE(void *, trace_mem);
 
+static __rte_always_inline void *
+__rte_trace_stream_mem_get(struct __rte_trace_header *trace, const uint16_t sz)
+{
+	uint64_t pos = RTE_ALIGN_CEIL(trace->reserved, __RTE_TRACE_EVENT_HEADER_SZ);
+	uint32_t offset = (uint32_t)pos & (trace->len - 1);
+	uint64_t need = sz;
+	uint64_t cons;
+
+	/* An event must not wrap; skip the buffer tail when it is too short */
+	if (unlikely((offset + sz) >= trace->len))
+		need += trace->len - offset;
+
+	cons = rte_atomic_load_explicit(&trace->cons, rte_memory_order_acquire);
+	if (unlikely(pos + need - cons > trace->len)) {
+		/* Only this thread updates the drop counter */
+		rte_atomic_store_explicit(&trace->drops,
+			rte_atomic_load_explicit(&trace->drops, rte_memory_order_relaxed) + 1,
+			rte_memory_order_relaxed);
+		return NULL;
+	}
+
+	if (unlikely(need != sz)) {
+		/* Mark the skipped tail so the collector can step over it */
+		*(uint64_t *)RTE_PTR_ADD(&trace->mem[0], offset) = __RTE_TRACE_STREAM_PAD;
+		pos += trace->len - offset;
+		offset = 0;
+	}
+
+	/* Publish all fully written events preceding this reservation */
+	rte_atomic_store_explicit(&trace->prod, pos, rte_memory_order_release);
+
+	trace->reserved = pos + sz;
+	return RTE_PTR_ADD(&trace->mem[0], offset);
+}
+
 static __rte_always_inline void *
 __rte_trace_mem_get(uint64_t in)
 {
@@ -330,6 +374,8 @@ __rte_trace_mem_get(uint64_t in)
 		if (unlikely(trace == NULL))
 			return NULL;
 	}
+	if (unlikely(trace->stream != 0))
+		return __rte_trace_stream_mem_get(trace, sz);
 	/* Check the wrap around case */
 	uint32_t offset = RTE_ALIGN_CEIL(trace->offset, __RTE_TRACE_EVENT_HEADER_SZ);
 	if (unlikely((offset + sz) >= trace->len)) {
@@ -383,6 +383,50 @@ int
 rte_vfio_container_dma_map(int container_fd, uint64_t vaddr,
 		uint64_t iova, uint64_t len);
 
+/**
+ * Memory region to be DMA mapped with rte_vfio_container_dma_map_bulk().
+ */
+struct rte_vfio_dma_region {
+	uint64_t vaddr; /**< starting virtual address of the region */
+	uint64_t iova;  /**< starting IOVA address of the region */
+	uint64_t len;   /**< length of the region */
+};
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Perform DMA mapping for a set of memory regions in a container.
+ *
+ * Adjacent regions that are both virtually and IOVA-contiguous are merged
+ * and mapped with a single IOMMU mapping, reducing the number of map
+ * operations and the number of IOTLB entries compared to mapping each
+ * region individually. The container's mapping list is locked once for the
+ * whole batch, and the resulting mappings are shared by all devices
+ * attached to the container.
+ *
+ * The batch is applied atomically: if mapping any region fails, all
+ * regions already mapped by this call are unmapped before returning.
+ *
+ * @param container_fd
+ *   the specified container fd. Use RTE_VFIO_DEFAULT_CONTAINER_FD to
+ *   use the default container.
+ *
+ * @param regions
+ *   Array of memory regions to be mapped.
+ *
+ * @param n_regions
+ *   Number of entries in the regions array.
+ *
+ * @return
+ *    0 if successful
+ *   <0 if failed
+ */
+__rte_experimental
+int
+rte_vfio_container_dma_map_bulk(int container_fd,
+		const struct rte_vfio_dma_region *regions, uint32_t n_regions);
+
 /**
  * Perform DMA unmapping for devices in a container.
  *
@@ -0,0 +1,401 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2025 Intel Corporation
+ */
+
+#ifndef _RTE_WAIT_BACKOFF_H_
+#define _RTE_WAIT_BACKOFF_H_
+
+/**
+ * @file
+ *
+ * Adaptive wait/backoff primitives.
+ *
+ * The rte_wait_until_equal_*() family and most spin loops in DPDK
+ * re-poll with a single rte_pause() between loads. Under heavy
+ * contention this keeps the waiting hardware thread at full poll rate,
+ * stealing issue slots from its SMT sibling and burning power without
+ * making progress.
+ *
+ * The helpers here implement a three-stage wait policy that individual
+ * callsites can opt into:
+ *
+ * 1. spin: poll with a single rte_pause() per load for the first
+ *    cfg->spin polls, so the uncontended latency is unchanged;
+ * 2. backoff: double the number of rte_pause() calls between loads,
+ *    up to cfg->max_pause;
+ * 3. sleep: once the ramp saturates, enter a monitor-based sleep on the
+ *    waited-on word via rte_power_monitor() where the CPU supports it
+ *    (UMWAIT/MWAITX/WFE); where it does not, stay in stage 2.
+ *
+ * Every wait owns a struct rte_wait_backoff on its stack and points it
+ * at a struct rte_wait_backoff_cfg, so each callsite tunes its own
+ * ramp: latency-critical waits can disable the sleep stage or shorten
+ * the ramp, while throughput-oriented waits can yield the core early.
+ * Passing a NULL config selects conservative defaults.
+ */
+
+#include <assert.h>
+#include <stdint.h>
+
+#include <rte_compat.h>
+#include <rte_cpuflags.h>
+#include <rte_cycles.h>
+#include <rte_pause.h>
+#include <rte_power_intrinsics.h>
+#include <rte_spinlock.h>
+#include <rte_stdatomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Default number of plain polls before the backoff ramp starts. */
+#define RTE_WAIT_BACKOFF_SPIN_DEFAULT 64
+/** Default cap on the number of pauses per backoff round. */
+#define RTE_WAIT_BACKOFF_MAX_PAUSE_DEFAULT 64
+/** Default upper bound on one monitor-based sleep, in TSC cycles. */
+#define RTE_WAIT_BACKOFF_SLEEP_TSC_DEFAULT (1ULL << 16)
+
+/**
+ * Per-callsite wait tuning. The structure is read-only to the wait
+ * helpers and may be shared by any number of concurrent waits.
+ */
+struct rte_wait_backoff_cfg {
+	uint16_t spin;      /**< Plain polls before the ramp starts. */
+	uint16_t max_pause; /**< Pause cap of the exponential ramp. */
+	uint8_t sleep;      /**< Allow monitor-based sleep after the ramp. */
+	uint64_t sleep_tsc; /**< Max TSC cycles per sleep, 0 for default. */
+};
+
+/** Default wait tuning, also used when a NULL config is passed. */
+#define RTE_WAIT_BACKOFF_CFG_INITIALIZER {			\
+	.spin = RTE_WAIT_BACKOFF_SPIN_DEFAULT,			\
+	.max_pause = RTE_WAIT_BACKOFF_MAX_PAUSE_DEFAULT,	\
+	.sleep = 1,						\
+	.sleep_tsc = RTE_WAIT_BACKOFF_SLEEP_TSC_DEFAULT,	\
+}
+
+/**
+ * State of one wait. Lives on the waiter's stack and must be
+ * re-initialized with rte_wait_backoff_init() for every new wait.
+ */
+struct rte_wait_backoff {
+	const struct rte_wait_backoff_cfg *cfg; /**< Callsite tuning. */
+	uint32_t polls; /**< Polls done in the spin stage. */
+	uint32_t pause; /**< Current pauses per backoff round. */
+};
+
+/** @internal Lazily cached rte_power_monitor() support, per unit. */
+static inline int
+__rte_wait_backoff_monitor_ok(void)
+{
+	static int ok = -1;
+
+	if (unlikely(ok < 0)) {
+		struct rte_cpu_intrinsics intrinsics;
+
+		rte_cpu_get_intrinsics_support(&intrinsics);
+		ok = intrinsics.power_monitor;
+	}
+	return ok;
+}
+
+/** @internal Abort sleeping once the masked value equals the target. */
+static inline int
+__rte_wait_backoff_clb_eq(const uint64_t val,
+	const uint64_t opaque[RTE_POWER_MONITOR_OPAQUE_SZ])
+{
+	return (val & opaque[1]) == opaque[0] ? -1 : 0;
+}
+
+/** @internal Abort sleeping once the masked value left the old one. */
+static inline int
+__rte_wait_backoff_clb_ne(const uint64_t val,
+	const uint64_t opaque[RTE_POWER_MONITOR_OPAQUE_SZ])
+{
+	return (val & opaque[1]) != opaque[0] ? -1 : 0;
+}
+
+/** @internal One monitor-based sleep, best effort. */
+static inline void
+__rte_wait_backoff_sleep(const struct rte_wait_backoff *wb,
+	volatile void *addr, uint64_t val, uint64_t mask, uint8_t size,
+	rte_power_monitor_clb_t clb)
+{
+	struct rte_power_monitor_cond pmc = {
+		.addr = addr,
+		.size = size,
+		.fn = clb,
+		.opaque = { val, mask, },
+	};
+	uint64_t sleep_tsc = wb->cfg->sleep_tsc;
+
+	if (sleep_tsc == 0)
+		sleep_tsc = RTE_WAIT_BACKOFF_SLEEP_TSC_DEFAULT;
+	rte_power_monitor(&pmc, rte_rdtsc() + sleep_tsc);
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Initialize a wait, binding it to a callsite tuning.
+ *
+ * @param wb
+ *   Wait state to initialize.
+ * @param cfg
+ *   Callsite tuning, or NULL for the defaults. Must stay valid for the
+ *   duration of the wait.
+ */
+__rte_experimental
+static inline void
+rte_wait_backoff_init(struct rte_wait_backoff *wb,
+	const struct rte_wait_backoff_cfg *cfg)
+{
+	static const struct rte_wait_backoff_cfg wait_backoff_cfg_default =
+		RTE_WAIT_BACKOFF_CFG_INITIALIZER;
+
+	wb->cfg = cfg != NULL ? cfg : &wait_backoff_cfg_default;
+	wb->polls = 0;
+	wb->pause = 1;
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Perform one wait round without a monitorable address: plain pauses
+ * first, then the exponential ramp. For waits on a predicate over a
+ * single word prefer rte_wait_backoff_until_equal() or
+ * rte_wait_backoff_until_change(), which add the sleep stage.
+ *
+ * @param wb
+ *   Wait state.
+ */
+__rte_experimental
+static inline void
+rte_wait_backoff_pause(struct rte_wait_backoff *wb)
+{
+	const struct rte_wait_backoff_cfg *cfg = wb->cfg;
+	uint32_t i;
+
+	if (likely(wb->polls < cfg->spin)) {
+		wb->polls++;
+		rte_pause();
+		return;
+	}
+	for (i = 0; i < wb->pause; i++)
+		rte_pause();
+	if (wb->pause < cfg->max_pause)
+		wb->pause *= 2;
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Perform one wait round for *addr & mask to become equal to expected:
+ * pauses and ramp first, then, once the ramp is saturated, a
+ * monitor-based sleep on addr where supported. The caller re-checks its
+ * wait condition after every round; this helper gives no ordering
+ * guarantees of its own.
+ *
+ * @param wb
+ *   Wait state.
+ * @param addr
+ *   Word being waited on, 1, 2, 4 or 8 bytes wide.
+ * @param expected
+ *   Masked value ending the wait.
+ * @param mask
+ *   Mask applied to the loaded value before comparing.
+ * @param size
+ *   Width of the word in bytes.
+ */
+__rte_experimental
+static inline void
+rte_wait_backoff_until_equal(struct rte_wait_backoff *wb, volatile void *addr,
+	uint64_t expected, uint64_t mask, uint8_t size)
+{
+	rte_wait_backoff_pause(wb);
+	if (wb->pause >= wb->cfg->max_pause && wb->cfg->sleep &&
+			__rte_wait_backoff_monitor_ok())
+		__rte_wait_backoff_sleep(wb, addr, expected, mask, size,
+			__rte_wait_backoff_clb_eq);
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Perform one wait round for *addr & mask to leave a previously
+ * observed value, for waits whose wake-up value is not known in advance
+ * (e.g. a tail counter catching up with a head). Otherwise identical to
+ * rte_wait_backoff_until_equal().
+ *
+ * @param wb
+ *   Wait state.
+ * @param addr
+ *   Word being waited on, 1, 2, 4 or 8 bytes wide.
+ * @param old
+ *   Masked value observed by the caller's last load.
+ * @param mask
+ *   Mask applied to the loaded value before comparing.
+ * @param size
+ *   Width of the word in bytes.
+ */
+__rte_experimental
+static inline void
+rte_wait_backoff_until_change(struct rte_wait_backoff *wb, volatile void *addr,
+	uint64_t old, uint64_t mask, uint8_t size)
+{
+	rte_wait_backoff_pause(wb);
+	if (wb->pause >= wb->cfg->max_pause && wb->cfg->sleep &&
+			__rte_wait_backoff_monitor_ok())
+		__rte_wait_backoff_sleep(wb, addr, old, mask, size,
+			__rte_wait_backoff_clb_ne);
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Adaptive drop-in for rte_wait_until_equal_16().
+ *
+ * @param addr
+ *   A pointer to the memory location.
+ * @param expected
+ *   A 16-bit expected value to be in the memory location.
+ * @param memorder
+ *   Two different memory orders that can be specified:
+ *   rte_memory_order_acquire and rte_memory_order_relaxed.
+ * @param cfg
+ *   Callsite tuning, or NULL for the defaults.
+ */
+__rte_experimental
+static inline void
+rte_wait_until_equal_16_backoff(volatile uint16_t *addr, uint16_t expected,
+	rte_memory_order memorder, const struct rte_wait_backoff_cfg *cfg)
+{
+	struct rte_wait_backoff wb;
+
+	assert(memorder == rte_memory_order_acquire ||
+		memorder == rte_memory_order_relaxed);
+
+	rte_wait_backoff_init(&wb, cfg);
+	while (rte_atomic_load_explicit((volatile __rte_atomic uint16_t *)addr,
+			memorder) != expected)
+		rte_wait_backoff_until_equal(&wb, addr, expected, UINT16_MAX,
+			sizeof(*addr));
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Adaptive drop-in for rte_wait_until_equal_32().
+ *
+ * @param addr
+ *   A pointer to the memory location.
+ * @param expected
+ *   A 32-bit expected value to be in the memory location.
+ * @param memorder
+ *   Two different memory orders that can be specified:
+ *   rte_memory_order_acquire and rte_memory_order_relaxed.
+ * @param cfg
+ *   Callsite tuning, or NULL for the defaults.
+ */
+__rte_experimental
+static inline void
+rte_wait_until_equal_32_backoff(volatile uint32_t *addr, uint32_t expected,
+	rte_memory_order memorder, const struct rte_wait_backoff_cfg *cfg)
+{
+	struct rte_wait_backoff wb;
+
+	assert(memorder == rte_memory_order_acquire ||
+		memorder == rte_memory_order_relaxed);
+
+	rte_wait_backoff_init(&wb, cfg);
+	while (rte_atomic_load_explicit((volatile __rte_atomic uint32_t *)addr,
+			memorder) != expected)
+		rte_wait_backoff_until_equal(&wb, addr, expected, UINT32_MAX,
+			sizeof(*addr));
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Adaptive drop-in for rte_wait_until_equal_64().
+ *
+ * @param addr
+ *   A pointer to the memory location.
+ * @param expected
+ *   A 64-bit expected value to be in the memory location.
+ * @param memorder
+ *   Two different memory orders that can be specified:
+ *   rte_memory_order_acquire and rte_memory_order_relaxed.
+ * @param cfg
+ *   Callsite tuning, or NULL for the defaults.
+ */
+__rte_experimental
+static inline void
+rte_wait_until_equal_64_backoff(volatile uint64_t *addr, uint64_t expected,
+	rte_memory_order memorder, const struct rte_wait_backoff_cfg *cfg)
+{
+	struct rte_wait_backoff wb;
+
+	assert(memorder == rte_memory_order_acquire ||
+		memorder == rte_memory_order_relaxed);
+
+	rte_wait_backoff_init(&wb, cfg);
+	while (rte_atomic_load_explicit((volatile __rte_atomic uint64_t *)addr,
+			memorder) != expected)
+		rte_wait_backoff_until_equal(&wb, addr, expected, UINT64_MAX,
+			sizeof(*addr));
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Take a spinlock, waiting adaptively while it is contended. The lock
+ * is interchangeable with rte_spinlock_lock()/rte_spinlock_unlock();
+ * only the waiting policy differs. It lives here rather than in
+ * rte_spinlock.h because the power monitor headers themselves depend on
+ * the spinlock.
+ *
+ * @param sl
+ *   A pointer to the spinlock.
+ * @param cfg
+ *   Callsite tuning, or NULL for the defaults.
+ */
+__rte_experimental
+static inline void
+rte_spinlock_lock_backoff(rte_spinlock_t *sl,
+	const struct rte_wait_backoff_cfg *cfg)
+	__rte_acquire_capability(sl);
+
+__rte_experimental
+static inline void
+rte_spinlock_lock_backoff(rte_spinlock_t *sl,
+	const struct rte_wait_backoff_cfg *cfg)
+	__rte_no_thread_safety_analysis
+{
+	struct rte_wait_backoff wb;
+	int exp = 0;
+
+	rte_wait_backoff_init(&wb, cfg);
+	while (!rte_atomic_compare_exchange_strong_explicit(&sl->locked,
+			&exp, 1, rte_memory_order_acquire,
+			rte_memory_order_relaxed)) {
+		rte_wait_backoff_until_equal(&wb, &sl->locked, 0, UINT32_MAX,
+			sizeof(uint32_t));
+		exp = 0;
+	}
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTE_WAIT_BACKOFF_H_ */
@@ -456,6 +456,8 @@ eal_usage(const char *prgname)
 	       "  --"OPT_LEGACY_MEM"        Legacy memory mode (no dynamic allocation, contiguous segments)\n"
 	       "  --"OPT_SINGLE_FILE_SEGMENTS" Put all hugepage memory in single files\n"
 	       "  --"OPT_MATCH_ALLOCATIONS" Free hugepages exactly as allocated\n"
+	       "  --"OPT_DEFER_PREFAULT"    Map hugepages without pre-faulting them;\n"
+	       "                      populate later via rte_mem_prefault_wait()\n"
 	       "  --"OPT_HUGE_WORKER_STACK"[=size]\n"
 	       "                      Allocate worker thread stacks from hugepage memory.\n"
 	       "                      Size is in units of kbytes and defaults to system\n"
@@ -723,6 +725,10 @@ eal_parse_args(int argc, char **argv)
 			internal_conf->match_allocations = 1;
 			break;
 
+		case OPT_DEFER_PREFAULT_NUM:
+			internal_conf->defer_prefault = 1;
+			break;
+
 		case OPT_HUGE_WORKER_STACK_NUM:
 			if (eal_parse_huge_worker_stack(optarg) < 0) {
 				EAL_LOG(ERR, "invalid parameter for --"
@@ -1082,6 +1088,14 @@ rte_eal_init(int argc, char **argv)
 		return -1;
 	}
 
+	/* deferred faulting needs IOVA resolution to not touch pagemap */
+	if (internal_conf->defer_prefault &&
+			rte_eal_iova_mode() != RTE_IOVA_VA) {
+		rte_eal_init_alert("Cannot use --"OPT_DEFER_PREFAULT" when IOVA mode is 'PA'");
+		rte_errno = EINVAL;
+		return -1;
+	}
+
 	EAL_LOG(INFO, "Selected IOVA mode '%s'",
 		rte_eal_iova_mode() == RTE_IOVA_PA ? "PA" : "VA");
 
@@ -38,16 +38,40 @@
 #define CLOCK_TYPE_ID CLOCK_MONOTONIC
 #endif
 
+/*
+ * Alarms are kept in a timing wheel instead of one sorted list, so that
+ * setting an alarm is O(1) regardless of how many alarms are pending.
+ * The wheel is a power-of-two ring of unsorted per-slot lists, each slot
+ * covering ALARM_WHEEL_SLOT_US of absolute time; alarms beyond the wheel
+ * horizon sit in an overflow list and are pulled in as the wheel turns.
+ * The timer interrupt drains every slot between the last drained position
+ * and the current time, dispatching all due callbacks in one pass.
+ */
+#define ALARM_WHEEL_SLOT_US 64
+#define ALARM_WHEEL_SLOTS 4096 /* horizon: 4096 * 64us = ~262ms */
+#define ALARM_WHEEL_MASK (ALARM_WHEEL_SLOTS - 1)
+
 struct alarm_entry {
 	LIST_ENTRY(alarm_entry) next;
-	struct timeval time;
+	uint64_t deadline_us;
 	rte_eal_alarm_callback cb_fn;
 	void *cb_arg;
 	volatile uint8_t executing;
 	volatile pthread_t executing_id;
 };
 
-static LIST_HEAD(alarm_list, alarm_entry) alarm_list = LIST_HEAD_INITIALIZER();
+LIST_HEAD(alarm_list, alarm_entry);
+
+static struct alarm_list alarm_wheel[ALARM_WHEEL_SLOTS];
+static struct alarm_list alarm_overflow = LIST_HEAD_INITIALIZER();
+/* due alarms being dispatched; cancel must still find them here */
+static struct alarm_list alarm_dispatch = LIST_HEAD_INITIALIZER();
+/* slot index (deadline / slot width) of the next slot to drain */
+static uint64_t alarm_drain_tick;
+/* lower bound on the earliest deadline in the overflow list */
+static uint64_t alarm_overflow_min_us = UINT64_MAX;
+/* deadline the timerfd is currently programmed for */
+static uint64_t alarm_armed_us = UINT64_MAX;
 static rte_spinlock_t alarm_list_lk = RTE_SPINLOCK_INITIALIZER;
 
 static struct rte_intr_handle *intr_handle;
@@ -67,6 +91,15 @@ rte_eal_alarm_cleanup(void)
 	}
 }
 
+static uint64_t
+eal_alarm_now_us(void)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_TYPE_ID, &now);
+	return (uint64_t)now.tv_sec * US_PER_S + now.tv_nsec / NS_PER_US;
+}
+
 int
 rte_eal_alarm_init(void)
 {
@@ -87,6 +120,8 @@ rte_eal_alarm_init(void)
 
 	if (rte_intr_fd_get(intr_handle) == -1)
 		goto error;
+
+	alarm_drain_tick = eal_alarm_now_us() / ALARM_WHEEL_SLOT_US;
 	return 0;
 
 error:
@@ -95,17 +130,145 @@ error:
 	return -1;
 }
 
+/* insert an entry into the wheel slot of its deadline, with lock held */
+static void
+alarm_wheel_insert(struct alarm_entry *ap)
+{
+	uint64_t tick = ap->deadline_us / ALARM_WHEEL_SLOT_US;
+
+	if (tick >= alarm_drain_tick + ALARM_WHEEL_SLOTS) {
+		LIST_INSERT_HEAD(&alarm_overflow, ap, next);
+		if (ap->deadline_us < alarm_overflow_min_us)
+			alarm_overflow_min_us = ap->deadline_us;
+		return;
+	}
+
+	/* overdue entries go to the next slot to be drained */
+	if (tick < alarm_drain_tick)
+		tick = alarm_drain_tick;
+	LIST_INSERT_HEAD(&alarm_wheel[tick & ALARM_WHEEL_MASK], ap, next);
+}
+
+/* pull overflow entries that now fit in the wheel, with lock held */
+static void
+alarm_overflow_pull(void)
+{
+	uint64_t horizon_us = (alarm_drain_tick + ALARM_WHEEL_SLOTS) *
+			ALARM_WHEEL_SLOT_US;
+	struct alarm_entry *ap, *next_ap;
+
+	if (alarm_overflow_min_us >= horizon_us)
+		return;
+
+	alarm_overflow_min_us = UINT64_MAX;
+	for (ap = LIST_FIRST(&alarm_overflow); ap != NULL; ap = next_ap) {
+		next_ap = LIST_NEXT(ap, next);
+		if (ap->deadline_us < horizon_us) {
+			LIST_REMOVE(ap, next);
+			alarm_wheel_insert(ap);
+		} else if (ap->deadline_us < alarm_overflow_min_us) {
+			alarm_overflow_min_us = ap->deadline_us;
+		}
+	}
+}
+
+/* move a slot's due entries to the dispatch list, with lock held */
+static void
+alarm_slot_drain(struct alarm_list *slot, uint64_t now)
+{
+	struct alarm_entry *ap, *next_ap;
+
+	for (ap = LIST_FIRST(slot); ap != NULL; ap = next_ap) {
+		next_ap = LIST_NEXT(ap, next);
+		if (ap->deadline_us <= now) {
+			LIST_REMOVE(ap, next);
+			LIST_INSERT_HEAD(&alarm_dispatch, ap, next);
+		}
+	}
+}
+
+/* collect every due alarm onto the dispatch list, with lock held */
+static void
+alarm_wheel_advance(uint64_t now)
+{
+	uint64_t now_tick = now / ALARM_WHEEL_SLOT_US;
+	uint32_t i;
+
+	alarm_overflow_pull();
+
+	if (now_tick - alarm_drain_tick >= ALARM_WHEEL_SLOTS) {
+		/* the whole wheel went by: every slot may hold due alarms */
+		for (i = 0; i < ALARM_WHEEL_SLOTS; i++)
+			alarm_slot_drain(&alarm_wheel[i], now);
+		alarm_drain_tick = now_tick;
+		alarm_overflow_pull();
+		return;
+	}
+
+	while (alarm_drain_tick <= now_tick) {
+		alarm_slot_drain(
+			&alarm_wheel[alarm_drain_tick & ALARM_WHEEL_MASK],
+			now);
+		/* the current slot may still hold alarms due later in it */
+		if (alarm_drain_tick == now_tick)
+			break;
+		alarm_drain_tick++;
+	}
+}
+
+/* find the earliest pending deadline, with lock held */
+static uint64_t
+alarm_next_deadline(void)
+{
+	struct alarm_entry *ap;
+	uint64_t next = alarm_overflow_min_us;
+	uint64_t tick;
+
+	for (tick = alarm_drain_tick;
+			tick < alarm_drain_tick + ALARM_WHEEL_SLOTS; tick++) {
+		struct alarm_list *slot = &alarm_wheel[tick & ALARM_WHEEL_MASK];
+
+		if (LIST_EMPTY(slot))
+			continue;
+		LIST_FOREACH(ap, slot, next) {
+			if (ap->deadline_us < next)
+				next = ap->deadline_us;
+		}
+		break;
+	}
+
+	return next;
+}
+
+/* program the timerfd for a deadline, with lock held */
+static int
+alarm_timerfd_arm(uint64_t deadline_us, uint64_t now)
+{
+	uint64_t delta_us = deadline_us > now ? deadline_us - now : 1;
+	struct itimerspec atime = {
+		.it_interval = { 0, 0 },
+		.it_value = {
+			.tv_sec = delta_us / US_PER_S,
+			.tv_nsec = (delta_us % US_PER_S) * NS_PER_US,
+		},
+	};
+
+	alarm_armed_us = deadline_us;
+	return timerfd_settime(rte_intr_fd_get(intr_handle), 0, &atime, NULL);
+}
+
 static void
 eal_alarm_callback(void *arg __rte_unused)
 {
-	struct timespec now;
 	struct alarm_entry *ap;
+	uint64_t now, next;
 
 	rte_spinlock_lock(&alarm_list_lk);
-	while ((ap = LIST_FIRST(&alarm_list)) !=NULL &&
-			clock_gettime(CLOCK_TYPE_ID, &now) == 0 &&
-			(ap->time.tv_sec < now.tv_sec || (ap->time.tv_sec == now.tv_sec &&
-						(ap->time.tv_usec * NS_PER_US) <= now.tv_nsec))) {
+	alarm_armed_us = UINT64_MAX;
+	now = eal_alarm_now_us();
+	alarm_wheel_advance(now);
+
+	while ((ap = LIST_FIRST(&alarm_dispatch)) != NULL) {
 		ap->executing = 1;
 		ap->executing_id = pthread_self();
 		rte_spinlock_unlock(&alarm_list_lk);
@@ -116,22 +279,17 @@ eal_alarm_callback(void *arg __rte_unused)
 
 		LIST_REMOVE(ap, next);
 		free(ap);
-	}
 
-	if (!LIST_EMPTY(&alarm_list)) {
-		struct itimerspec atime = { .it_interval = { 0, 0 } };
-
-		ap = LIST_FIRST(&alarm_list);
-		atime.it_value.tv_sec = ap->time.tv_sec;
-		atime.it_value.tv_nsec = ap->time.tv_usec * NS_PER_US;
-		/* perform borrow for subtraction if necessary */
-		if (now.tv_nsec > (ap->time.tv_usec * NS_PER_US))
-			atime.it_value.tv_sec--, atime.it_value.tv_nsec += US_PER_S * NS_PER_US;
-
-		atime.it_value.tv_sec -= now.tv_sec;
-		atime.it_value.tv_nsec -= now.tv_nsec;
-		timerfd_settime(rte_intr_fd_get(intr_handle), 0, &atime, NULL);
+		if (LIST_EMPTY(&alarm_dispatch)) {
+			/* pick up alarms that became due meanwhile */
+			now = eal_alarm_now_us();
+			alarm_wheel_advance(now);
+		}
 	}
+
+	next = alarm_next_deadline();
+	if (next != UINT64_MAX)
+		alarm_timerfd_arm(next, eal_alarm_now_us());
 	rte_spinlock_unlock(&alarm_list_lk);
 }
 
@@ -139,9 +297,9 @@ RTE_EXPORT_SYMBOL(rte_eal_alarm_set)
 int
 rte_eal_alarm_set(uint64_t us, rte_eal_alarm_callback cb_fn, void *cb_arg)
 {
-	struct timespec now;
+	struct alarm_entry *new_alarm;
+	uint64_t now;
 	int ret = 0;
-	struct alarm_entry *ap, *new_alarm;
 
 	/* Check parameters, including that us won't cause a uint64_t overflow */
 	if (us < 1 || us > (UINT64_MAX - US_PER_S) || cb_fn == NULL)
@@ -152,12 +310,11 @@ rte_eal_alarm_set(uint64_t us, rte_eal_alarm_callback cb_fn, void *cb_arg)
 		return -ENOMEM;
 
 	/* use current time to calculate absolute time of alarm */
-	clock_gettime(CLOCK_TYPE_ID, &now);
+	now = eal_alarm_now_us();
 
 	new_alarm->cb_fn = cb_fn;
 	new_alarm->cb_arg = cb_arg;
-	new_alarm->time.tv_usec = ((now.tv_nsec / NS_PER_US) + us) % US_PER_S;
-	new_alarm->time.tv_sec = now.tv_sec + (((now.tv_nsec / NS_PER_US) + us) / US_PER_S);
+	new_alarm->deadline_us = now + us;
 
 	rte_spinlock_lock(&alarm_list_lk);
 	if (!handler_registered) {
@@ -167,47 +324,58 @@ rte_eal_alarm_set(uint64_t us, rte_eal_alarm_callback cb_fn, void *cb_arg)
 			handler_registered = 1;
 	}
 
-	if (LIST_EMPTY(&alarm_list))
-		LIST_INSERT_HEAD(&alarm_list, new_alarm, next);
-	else {
-		LIST_FOREACH(ap, &alarm_list, next) {
-			if (ap->time.tv_sec > new_alarm->time.tv_sec ||
-					(ap->time.tv_sec == new_alarm->time.tv_sec &&
-							ap->time.tv_usec > new_alarm->time.tv_usec)){
-				LIST_INSERT_BEFORE(ap, new_alarm, next);
-				break;
-			}
-			if (LIST_NEXT(ap, next) == NULL) {
-				LIST_INSERT_AFTER(ap, new_alarm, next);
-				break;
-			}
-		}
-	}
+	alarm_wheel_insert(new_alarm);
 
-	if (LIST_FIRST(&alarm_list) == new_alarm) {
-		struct itimerspec alarm_time = {
-			.it_interval = {0, 0},
-			.it_value = {
-				.tv_sec = us / US_PER_S,
-				.tv_nsec = (us % US_PER_S) * NS_PER_US,
-			},
-		};
-		ret |= timerfd_settime(rte_intr_fd_get(intr_handle), 0, &alarm_time, NULL);
-	}
+	/* only reprogram the timerfd when this alarm is the new earliest */
+	if (new_alarm->deadline_us < alarm_armed_us)
+		ret |= alarm_timerfd_arm(new_alarm->deadline_us, now);
 	rte_spinlock_unlock(&alarm_list_lk);
 
 	rte_eal_trace_alarm_set(us, cb_fn, cb_arg, ret);
 	return ret;
 }
 
+/* remove matching entries from one list, with lock held */
+static int
+alarm_cancel_in_list(struct alarm_list *list, rte_eal_alarm_callback cb_fn,
+		void *cb_arg, int *executing, int *err)
+{
+	struct alarm_entry *ap, *next_ap;
+	int count = 0;
+
+	for (ap = LIST_FIRST(list); ap != NULL; ap = next_ap) {
+		next_ap = LIST_NEXT(ap, next);
+
+		if (cb_fn != ap->cb_fn ||
+				(cb_arg != (void *)-1 && cb_arg != ap->cb_arg))
+			continue;
+
+		if (ap->executing == 0) {
+			LIST_REMOVE(ap, next);
+			free(ap);
+			count++;
+		} else if (pthread_equal(ap->executing_id, pthread_self()) == 0) {
+			/* If calling from other context, mark that alarm is executing
+			 * so loop can spin till it finish. Otherwise we are trying to
+			 * cancel our self - mark it by EINPROGRESS.
+			 */
+			(*executing)++;
+		} else {
+			*err = EINPROGRESS;
+		}
+	}
+
+	return count;
+}
+
 RTE_EXPORT_SYMBOL(rte_eal_alarm_cancel)
 int
 rte_eal_alarm_cancel(rte_eal_alarm_callback cb_fn, void *cb_arg)
 {
-	struct alarm_entry *ap, *ap_prev;
 	int count = 0;
 	int err = 0;
 	int executing;
+	uint32_t i;
 
 	if (!cb_fn) {
 		rte_errno = EINVAL;
@@ -217,47 +385,14 @@ rte_eal_alarm_cancel(rte_eal_alarm_callback cb_fn, void *cb_arg)
 	do {
 		executing = 0;
 		rte_spinlock_lock(&alarm_list_lk);
-		/* remove any matches at the start of the list */
-		while ((ap = LIST_FIRST(&alarm_list)) != NULL &&
-				cb_fn == ap->cb_fn &&
-				(cb_arg == (void *)-1 || cb_arg == ap->cb_arg)) {
-
-			if (ap->executing == 0) {
-				LIST_REMOVE(ap, next);
-				free(ap);
-				count++;
-			} else {
-				/* If calling from other context, mark that alarm is executing
-				 * so loop can spin till it finish. Otherwise we are trying to
-				 * cancel our self - mark it by EINPROGRESS */
-				if (pthread_equal(ap->executing_id, pthread_self()) == 0)
-					executing++;
-				else
-					err = EINPROGRESS;
-
-				break;
-			}
-		}
-		ap_prev = ap;
-
-		/* now go through list, removing entries not at start */
-		LIST_FOREACH(ap, &alarm_list, next) {
-			/* this won't be true first time through */
-			if (cb_fn == ap->cb_fn &&
-					(cb_arg == (void *)-1 || cb_arg == ap->cb_arg)) {
-
-				if (ap->executing == 0) {
-					LIST_REMOVE(ap, next);
-					free(ap);
-					count++;
-					ap = ap_prev;
-				} else if (pthread_equal(ap->executing_id, pthread_self()) == 0)
-					executing++;
-				else
-					err = EINPROGRESS;
-			}
-			ap_prev = ap;
-		}
+
+		for (i = 0; i < ALARM_WHEEL_SLOTS; i++)
+			count += alarm_cancel_in_list(&alarm_wheel[i],
+					cb_fn, cb_arg, &executing, &err);
+		count += alarm_cancel_in_list(&alarm_overflow,
+				cb_fn, cb_arg, &executing, &err);
+		count += alarm_cancel_in_list(&alarm_dispatch,
+				cb_fn, cb_arg, &executing, &err);
 
 		rte_spinlock_unlock(&alarm_list_lk);
 
@@ -600,6 +600,10 @@ alloc_seg(struct rte_memseg *ms, void *addr, int socket_id,
 		mmap_flags = MAP_SHARED | MAP_POPULATE | MAP_FIXED;
 	}
 
+	/* defer population to rte_mem_prefault_wait() or first touch */
+	if (internal_conf->defer_prefault)
+		mmap_flags &= ~MAP_POPULATE;
+
 	huge_register_sigbus();
 
 	/*
@@ -623,6 +627,20 @@ alloc_seg(struct rte_memseg *ms, void *addr, int socket_id,
 		goto resized;
 	}
 
+	if (internal_conf->defer_prefault) {
+		/*
+		 * Faulting may later happen on a thread with a different
+		 * memory policy, so bind the range to the requested node
+		 * now. Limits (e.g. cgroup) are enforced at fault time, so
+		 * SIGBUS detection is deferred along with the fault.
+		 */
+#ifdef RTE_EAL_NUMA_AWARE_HUGEPAGES
+		if (check_numa())
+			numa_tonode_memory(addr, alloc_sz, socket_id);
+#endif
+		goto populated;
+	}
+
 	/* In linux, hugetlb limitations, like cgroup, are
 	 * enforced at fault time instead of mmap(), even
 	 * with the option of MAP_POPULATE. Kernel will send
@@ -643,6 +661,7 @@ alloc_seg(struct rte_memseg *ms, void *addr, int socket_id,
 	 */
 	*(volatile int *)addr = *(volatile int *)addr;
 
+populated:
 	iova = rte_mem_virt2iova(addr);
 	if (iova == RTE_BAD_PHYS_ADDR) {
 		EAL_LOG(DEBUG, "%s(): can't get IOVA addr",
@@ -657,7 +676,8 @@ alloc_seg(struct rte_memseg *ms, void *addr, int socket_id,
 	 * allocation is not NUMA aware and the socket_id should not be
 	 * checked.
 	 */
-	if (check_numa()) {
+	/* cannot verify placement of pages that have not been faulted yet */
+	if (!internal_conf->defer_prefault && check_numa()) {
 		ret = get_mempolicy(&cur_socket_id, NULL, 0, addr,
 					MPOL_F_NODE | MPOL_F_ADDR);
 		if (ret < 0) {
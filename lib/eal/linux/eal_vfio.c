@@ -1936,6 +1936,89 @@ out:
 	return ret;
 }
 
+static int
+container_dma_map_bulk(struct vfio_config *vfio_cfg,
+		const struct rte_vfio_dma_region *regions, uint32_t n_regions)
+{
+	struct user_mem_map *new_map;
+	struct user_mem_maps *user_mem_maps;
+	uint64_t span_vaddr, span_iova, span_len;
+	bool has_partial_unmap;
+	int first_new, i, ret = 0;
+	uint32_t r;
+
+	user_mem_maps = &vfio_cfg->mem_maps;
+	rte_spinlock_recursive_lock(&user_mem_maps->lock);
+
+	/* remember where this batch starts, in case we need to roll back */
+	first_new = user_mem_maps->n_maps;
+
+	/*
+	 * walk the region list, coalescing adjacent regions that are both
+	 * virtually and IOVA-contiguous into a single span, and map each
+	 * completed span with one IOMMU mapping.
+	 */
+	span_vaddr = regions[0].vaddr;
+	span_iova = regions[0].iova;
+	span_len = regions[0].len;
+
+	for (r = 1; r <= n_regions; r++) {
+		/* extend the current span while regions are contiguous */
+		if (r < n_regions &&
+				regions[r].vaddr == span_vaddr + span_len &&
+				regions[r].iova == span_iova + span_len) {
+			span_len += regions[r].len;
+			continue;
+		}
+		/* current span is complete, map it */
+		if (user_mem_maps->n_maps == VFIO_MAX_USER_MEM_MAPS) {
+			EAL_LOG(ERR, "No more space for user mem maps");
+			rte_errno = ENOMEM;
+			ret = -1;
+			break;
+		}
+		if (vfio_dma_mem_map(vfio_cfg, span_vaddr, span_iova,
+				span_len, 1)) {
+			EAL_LOG(ERR, "Couldn't map new region for DMA");
+			ret = -1;
+			break;
+		}
+		/* do we have partial unmap support? */
+		has_partial_unmap = vfio_cfg->vfio_iommu_type->partial_unmap;
+
+		/* create new user mem map entry */
+		new_map = &user_mem_maps->maps[user_mem_maps->n_maps++];
+		new_map->addr = span_vaddr;
+		new_map->iova = span_iova;
+		new_map->len = span_len;
+		/* for IOMMU types supporting partial unmap, no chunking */
+		new_map->chunk = has_partial_unmap ? 0 : span_len;
+
+		if (r < n_regions) {
+			span_vaddr = regions[r].vaddr;
+			span_iova = regions[r].iova;
+			span_len = regions[r].len;
+		}
+	}
+
+	if (ret < 0) {
+		/* undo spans already mapped by this call */
+		for (i = user_mem_maps->n_maps - 1; i >= first_new; i--) {
+			new_map = &user_mem_maps->maps[i];
+			if (vfio_dma_mem_map(vfio_cfg, new_map->addr,
+					new_map->iova, new_map->len, 0))
+				EAL_LOG(ERR, "Couldn't unmap region for DMA");
+			memset(new_map, 0, sizeof(*new_map));
+			user_mem_maps->n_maps--;
+		}
+	} else {
+		compact_user_maps(user_mem_maps);
+	}
+
+	rte_spinlock_recursive_unlock(&user_mem_maps->lock);
+	return ret;
+}
+
 static int
 container_dma_unmap(struct vfio_config *vfio_cfg, uint64_t vaddr, uint64_t iova,
 		uint64_t len)
@@ -2207,6 +2290,34 @@ rte_vfio_container_dma_map(int container_fd, uint64_t vaddr, uint64_t iova,
 	return container_dma_map(vfio_cfg, vaddr, iova, len);
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_vfio_container_dma_map_bulk, 25.07)
+int
+rte_vfio_container_dma_map_bulk(int container_fd,
+		const struct rte_vfio_dma_region *regions, uint32_t n_regions)
+{
+	struct vfio_config *vfio_cfg;
+	uint32_t i;
+
+	if (regions == NULL || n_regions == 0) {
+		rte_errno = EINVAL;
+		return -1;
+	}
+	for (i = 0; i < n_regions; i++) {
+		if (regions[i].len == 0) {
+			rte_errno = EINVAL;
+			return -1;
+		}
+	}
+
+	vfio_cfg = get_vfio_cfg_by_container_fd(container_fd);
+	if (vfio_cfg == NULL) {
+		EAL_LOG(ERR, "Invalid VFIO container fd");
+		return -1;
+	}
+
+	return container_dma_map_bulk(vfio_cfg, regions, n_regions);
+}
+
 RTE_EXPORT_SYMBOL(rte_vfio_container_dma_unmap)
 int
 rte_vfio_container_dma_unmap(int container_fd, uint64_t vaddr, uint64_t iova,
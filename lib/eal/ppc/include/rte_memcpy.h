@@ -203,6 +203,26 @@ rte_memcpy_func(void *dst, const void *src, size_t n)
 	return ret;
 }
 
+/** Bypass the cache for the destination of rte_memcpy_ex(). */
+#define RTE_MEMCPY_F_DST_NT (1u << 0)
+
+/*
+ * No streaming store primitive is wired up on this architecture, so the
+ * non-temporal variants resolve to the plain copy.
+ */
+static inline void *
+rte_memcpy_nt(void *dst, const void *src, size_t n)
+{
+	return rte_memcpy(dst, src, n);
+}
+
+static inline void *
+rte_memcpy_ex(void *dst, const void *src, size_t n, unsigned int flags)
+{
+	(void)flags;
+	return rte_memcpy(dst, src, n);
+}
+
 #if defined(RTE_TOOLCHAIN_GCC) && (GCC_VERSION >= 100000)
 #pragma GCC diagnostic pop
 #endif
@@ -759,6 +759,148 @@ rte_memcpy(void *dst, const void *src, size_t n)
 
 #undef ALIGNMENT_MASK
 
+/** Bypass the cache for the destination of rte_memcpy_ex(). */
+#define RTE_MEMCPY_F_DST_NT (1u << 0)
+
+/** Default rte_memcpy_nt() crossover size, in bytes. */
+#define RTE_MEMCPY_NT_THRESHOLD_DEFAULT 512
+
+/**
+ * Crossover size below which rte_memcpy_nt() falls back to rte_memcpy().
+ *
+ * Streaming stores only pay off once a copy is large enough for the
+ * saved cache evictions to outweigh the write-combining overhead.
+ * The crossover can be tuned directly, or measured on the running
+ * machine with rte_memcpy_nt_calibrate().
+ */
+extern size_t rte_memcpy_nt_threshold;
+
+/**
+ * @internal
+ * Copy bytes using non-temporal stores, regardless of the crossover
+ * threshold. The locations must not overlap.
+ */
+static __rte_always_inline void *
+__rte_memcpy_nt(void *dst, const void *src, size_t n)
+{
+	const uint8_t *s = (const uint8_t *)src;
+	uint8_t *d = (uint8_t *)dst;
+
+	/* Streaming stores require an aligned destination */
+	if (n >= 16 && ((uintptr_t)d & 15) != 0) {
+		const size_t head = 16 - ((uintptr_t)d & 15);
+
+		rte_memcpy(d, s, head);
+		d += head;
+		s += head;
+		n -= head;
+	}
+
+#if defined RTE_MEMCPY_AVX
+	if (n >= 32 && ((uintptr_t)d & 31) != 0) {
+		_mm_stream_si128((__m128i *)(void *)d,
+			_mm_loadu_si128((const __m128i *)(const void *)s));
+		d += 16;
+		s += 16;
+		n -= 16;
+	}
+
+	while (n >= 32) {
+		_mm256_stream_si256((__m256i *)(void *)d,
+			_mm256_loadu_si256((const __m256i *)(const void *)s));
+		d += 32;
+		s += 32;
+		n -= 32;
+	}
+#endif
+
+	while (n >= 16) {
+		_mm_stream_si128((__m128i *)(void *)d,
+			_mm_loadu_si128((const __m128i *)(const void *)s));
+		d += 16;
+		s += 16;
+		n -= 16;
+	}
+
+	if (n != 0)
+		rte_memcpy(d, s, n);
+
+	/* Commit the weakly ordered streaming stores before any subsequent
+	 * store, e.g., a doorbell write or a ring index update.
+	 */
+	_mm_sfence();
+
+	return dst;
+}
+
+/**
+ * Copy bytes from one location to another, bypassing the cache for the
+ * destination when the copy is large enough for streaming stores to pay
+ * off. The locations must not overlap.
+ *
+ * Intended for destinations that are not re-read by the CPU, such as
+ * DMA staging regions, to avoid evicting useful cache content.
+ *
+ * @param dst
+ *   Pointer to the destination of the data.
+ * @param src
+ *   Pointer to the source data.
+ * @param n
+ *   Number of bytes to copy.
+ * @return
+ *   Pointer to the destination data.
+ */
+static __rte_always_inline void *
+rte_memcpy_nt(void *dst, const void *src, size_t n)
+{
+	if (n < rte_memcpy_nt_threshold)
+		return rte_memcpy(dst, src, n);
+
+	return __rte_memcpy_nt(dst, src, n);
+}
+
+/**
+ * Copy bytes from one location to another, with extra hints.
+ * The locations must not overlap.
+ *
+ * @param dst
+ *   Pointer to the destination of the data.
+ * @param src
+ *   Pointer to the source data.
+ * @param n
+ *   Number of bytes to copy.
+ * @param flags
+ *   RTE_MEMCPY_F_DST_NT to bypass the cache for the destination.
+ * @return
+ *   Pointer to the destination data.
+ */
+static __rte_always_inline void *
+rte_memcpy_ex(void *dst, const void *src, size_t n, unsigned int flags)
+{
+	if (flags & RTE_MEMCPY_F_DST_NT)
+		return rte_memcpy_nt(dst, src, n);
+
+	return rte_memcpy(dst, src, n);
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Measure the rte_memcpy_nt() crossover size on the running machine.
+ *
+ * Benchmarks the temporal and non-temporal copy paths over a range of
+ * sizes and stores the smallest size for which the non-temporal path is
+ * not slower in @ref rte_memcpy_nt_threshold, shared by all lcores.
+ * Intended to be called once at application startup.
+ *
+ * @return
+ *   The new crossover size, or the previous one when the measurement
+ *   could not be run.
+ */
+__rte_experimental
+size_t rte_memcpy_nt_calibrate(void);
+
 #if defined(RTE_TOOLCHAIN_GCC) && (GCC_VERSION >= 100000)
 #pragma GCC diagnostic pop
 #endif
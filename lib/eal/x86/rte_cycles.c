@@ -15,8 +15,34 @@
 	 (t2 == 0x444d4163) && /* DMAc */   \
 	 (t3 == 0x69746e65))   /* itne */
 
+/* ECX bit of CPUID leaf 0x1 set when running under a hypervisor */
+#ifndef bit_HYPERVISOR
+#define bit_HYPERVISOR (1u << 31)
+#endif
+
+/* Hypervisor vendor and maximum leaf */
+#define HYPERVISOR_INFO_LEAF 0x40000000
+/* Hypervisor timing information, EAX is the virtual TSC frequency in kHz */
+#define HYPERVISOR_TIMING_LEAF 0x40000010
+
 #include "eal_private.h"
 
+static void
+x86_cpuid(uint32_t leaf, uint32_t *a, uint32_t *b, uint32_t *c, uint32_t *d)
+{
+#ifdef RTE_TOOLCHAIN_MSVC
+	int cpuinfo[4];
+
+	__cpuid(cpuinfo, leaf);
+	*a = cpuinfo[0];
+	*b = cpuinfo[1];
+	*c = cpuinfo[2];
+	*d = cpuinfo[3];
+#else
+	__cpuid(leaf, *a, *b, *c, *d);
+#endif
+}
+
 static unsigned int
 rte_cpu_get_model(uint32_t fam_mod_step)
 {
@@ -103,26 +129,42 @@ __get_cpuid_max(unsigned int e, unsigned int *s)
 }
 #endif
 
+/*
+ * Under a hypervisor the TSC is virtualized, so the frequency advertised
+ * by the hypervisor is the authoritative one; host CPU crystal leaves and
+ * MSRs do not apply to the guest.
+ */
+static uint64_t
+get_tsc_freq_hypervisor(void)
+{
+	uint32_t a, b, c, d;
+
+	x86_cpuid(0x1, &a, &b, &c, &d);
+	if (!(c & bit_HYPERVISOR))
+		return 0;
+
+	x86_cpuid(HYPERVISOR_INFO_LEAF, &a, &b, &c, &d);
+	if (a < HYPERVISOR_TIMING_LEAF)
+		return 0;
+
+	x86_cpuid(HYPERVISOR_TIMING_LEAF, &a, &b, &c, &d);
+
+	return (uint64_t)a * 1000;
+}
+
 uint64_t
 get_tsc_freq_arch(void)
 {
-#ifdef RTE_TOOLCHAIN_MSVC
-	int cpuinfo[4];
-#endif
 	uint64_t tsc_hz = 0;
 	uint32_t a, b, c, d, maxleaf;
 	uint8_t mult, model;
 	int32_t ret;
 
-#ifdef RTE_TOOLCHAIN_MSVC
-	__cpuid(cpuinfo, 0);
-	a = cpuinfo[0];
-	b = cpuinfo[1];
-	c = cpuinfo[2];
-	d = cpuinfo[3];
-#else
-	__cpuid(0, a, b, c, d);
-#endif
+	tsc_hz = get_tsc_freq_hypervisor();
+	if (tsc_hz != 0)
+		return tsc_hz;
+
+	x86_cpuid(0, &a, &b, &c, &d);
 	if (x86_vendor_amd(b, c, d))
 		return 0;
 
@@ -133,30 +175,14 @@ get_tsc_freq_arch(void)
 	maxleaf = __get_cpuid_max(0, NULL);
 
 	if (maxleaf >= 0x15) {
-#ifdef RTE_TOOLCHAIN_MSVC
-		__cpuid(cpuinfo, 0x15);
-		a = cpuinfo[0];
-		b = cpuinfo[1];
-		c = cpuinfo[2];
-		d = cpuinfo[3];
-#else
-		__cpuid(0x15, a, b, c, d);
-#endif
+		x86_cpuid(0x15, &a, &b, &c, &d);
 
-		/* EBX : TSC/Crystal ratio, ECX : Crystal Hz */
-		if (b && c)
-			return c * (b / a);
+		/* EAX/EBX : TSC/Crystal ratio, ECX : Crystal Hz */
+		if (a && b && c)
+			return (uint64_t)c * b / a;
 	}
 
-#ifdef RTE_TOOLCHAIN_MSVC
-	__cpuid(cpuinfo, 0x1);
-	a = cpuinfo[0];
-	b = cpuinfo[1];
-	c = cpuinfo[2];
-	d = cpuinfo[3];
-#else
-	__cpuid(0x1, a, b, c, d);
-#endif
+	x86_cpuid(0x1, &a, &b, &c, &d);
 	model = rte_cpu_get_model(a);
 
 	if (check_model_wsm_nhm(model))
@@ -0,0 +1,90 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2025 Intel Corporation
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rte_common.h>
+#include <rte_cycles.h>
+#include <rte_memcpy.h>
+
+#include <eal_export.h>
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_memcpy_nt_threshold, 25.07)
+size_t rte_memcpy_nt_threshold = RTE_MEMCPY_NT_THRESHOLD_DEFAULT;
+
+#define CALIBRATE_ITERATIONS 128
+#define CALIBRATE_BUF_SIZE (8 * 1024 * 1024)
+
+static const size_t calibrate_sizes[] = {
+	64, 128, 256, 512, 1024, 2048, 4096,
+};
+
+static uint64_t
+calibrate_run(uint8_t *dst, const uint8_t *src, size_t size, bool nt)
+{
+	size_t offset = 0;
+	uint64_t start;
+	unsigned int i;
+
+	start = rte_rdtsc_precise();
+	for (i = 0; i < CALIBRATE_ITERATIONS; i++) {
+		if (nt)
+			__rte_memcpy_nt(dst + offset, src + offset, size);
+		else
+			rte_memcpy(dst + offset, src + offset, size);
+
+		/* Stride through the buffers so the destination is not cache
+		 * resident, as a staging region would not be.
+		 */
+		offset += RTE_ALIGN_CEIL(size, RTE_CACHE_LINE_SIZE);
+		if (offset + size > CALIBRATE_BUF_SIZE)
+			offset = 0;
+	}
+
+	return rte_rdtsc_precise() - start;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_memcpy_nt_calibrate, 25.07)
+size_t
+rte_memcpy_nt_calibrate(void)
+{
+	size_t threshold = SIZE_MAX;
+	uint8_t *dst, *src;
+	unsigned int i;
+
+	dst = malloc(CALIBRATE_BUF_SIZE);
+	src = malloc(CALIBRATE_BUF_SIZE);
+	if (dst == NULL || src == NULL)
+		goto out;
+
+	memset(src, 0xa5, CALIBRATE_BUF_SIZE);
+	memset(dst, 0, CALIBRATE_BUF_SIZE);
+
+	for (i = 0; i < RTE_DIM(calibrate_sizes); i++) {
+		const size_t size = calibrate_sizes[i];
+		uint64_t temporal, non_temporal;
+
+		/* Warm up both code paths */
+		calibrate_run(dst, src, size, false);
+		calibrate_run(dst, src, size, true);
+
+		temporal = calibrate_run(dst, src, size, false);
+		non_temporal = calibrate_run(dst, src, size, true);
+
+		/* Pick the smallest size at which streaming stores win */
+		if (non_temporal <= temporal) {
+			threshold = size;
+			break;
+		}
+	}
+
+	rte_memcpy_nt_threshold = threshold;
+out:
+	free(dst);
+	free(src);
+	return rte_memcpy_nt_threshold;
+}
@@ -22,6 +22,8 @@
 #include <rte_ring.h>
 #include <rte_jhash.h>
 #include <rte_hash_crc.h>
+#include <rte_lcore.h>
+#include <rte_stdatomic.h>
 #include <rte_tailq.h>
 
 #include "rte_efd.h"
@@ -264,8 +266,44 @@ struct rte_efd_table {
 	/**< Ring that stores all indexes of the free slots in the key table */
 
 	uint8_t *keys; /**< Dynamic array of size max_num_rules of keys */
+
+	struct efd_hotkey_cache *hot_cache[RTE_MAX_LCORE];
+	/**< Optional per-lcore hot-key caches, NULL unless enabled with
+	 * rte_efd_hotkey_cache_enable().
+	 */
+
+	RTE_ATOMIC(uint32_t) hot_cache_gen;
+	/**< Bumped on every update/delete; hot-key cache entries tagged with
+	 * an older generation are treated as misses.
+	 */
+
+	uint8_t hot_cache_enabled;
+	/**< Set once the per-lcore hot-key caches are allocated. */
+};
+
+/** An entry of the per-lcore hot-key cache. */
+struct efd_hotkey_entry {
+	uint32_t gen;		/**< Generation the entry was filled at. */
+	efd_value_t value;	/**< Memoized lookup result. */
+	uint8_t key[];		/**< Copy of the key, table->key_len bytes. */
+};
+
+/** Per-lcore direct-mapped cache of recently looked up keys. */
+struct efd_hotkey_cache {
+	uint32_t mask;		/**< Number of entries minus one. */
+	uint32_t entry_size;	/**< Size of one entry, cache line multiple. */
+	alignas(RTE_CACHE_LINE_SIZE) uint8_t entries[];
 };
 
+/* Invalidate all hot-key cache entries after a table modification */
+static inline void
+efd_hotkey_cache_invalidate(struct rte_efd_table *table)
+{
+	if (table->hot_cache_enabled)
+		rte_atomic_fetch_add_explicit(&table->hot_cache_gen, 1,
+				rte_memory_order_release);
+}
+
 /**
  * Computes the chunk ID for a given key hash
  *
@@ -754,6 +792,7 @@ void
 rte_efd_free(struct rte_efd_table *table)
 {
 	uint8_t socket_id;
+	unsigned int i;
 	struct rte_efd_list *efd_list;
 	struct rte_tailq_entry *te, *temp;
 
@@ -778,9 +817,59 @@ rte_efd_free(struct rte_efd_table *table)
 	rte_ring_free(table->free_slots);
 	rte_free(table->offline_chunks);
 	rte_free(table->keys);
+	for (i = 0; i < RTE_MAX_LCORE; i++)
+		rte_free(table->hot_cache[i]);
 	rte_free(table);
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_efd_hotkey_cache_enable, 25.07)
+int
+rte_efd_hotkey_cache_enable(struct rte_efd_table *table, uint32_t num_entries)
+{
+	struct efd_hotkey_cache *hc;
+	unsigned int lcore_id;
+	uint32_t entry_size;
+	size_t size;
+
+	if (table == NULL || num_entries == 0 ||
+			!rte_is_power_of_2(num_entries))
+		return -EINVAL;
+
+	if (table->hot_cache_enabled)
+		return 0;
+
+	entry_size = RTE_ALIGN(sizeof(struct efd_hotkey_entry) +
+			table->key_len, RTE_CACHE_LINE_SIZE);
+	size = sizeof(struct efd_hotkey_cache) +
+			(size_t)num_entries * entry_size;
+
+	RTE_LCORE_FOREACH(lcore_id) {
+		hc = rte_zmalloc_socket(NULL, size, RTE_CACHE_LINE_SIZE,
+				rte_lcore_to_socket_id(lcore_id));
+		if (hc == NULL)
+			goto free_caches;
+		hc->mask = num_entries - 1;
+		hc->entry_size = entry_size;
+		table->hot_cache[lcore_id] = hc;
+	}
+
+	/*
+	 * Zeroed entries carry generation 0, so starting at 1 makes every
+	 * slot an initial miss.
+	 */
+	rte_atomic_store_explicit(&table->hot_cache_gen, 1,
+			rte_memory_order_relaxed);
+	table->hot_cache_enabled = 1;
+	return 0;
+
+free_caches:
+	for (lcore_id = 0; lcore_id < RTE_MAX_LCORE; lcore_id++) {
+		rte_free(table->hot_cache[lcore_id]);
+		table->hot_cache[lcore_id] = NULL;
+	}
+	return -ENOMEM;
+}
+
 /**
  * Applies a previously computed table entry to the specified table for all
  * socket-local copies of the online table.
@@ -1187,6 +1276,7 @@ rte_efd_update(struct rte_efd_table * const table, const unsigned int socket_id,
 
 	efd_apply_update(table, socket_id, chunk_id, group_id, bin_id,
 			new_bin_choice, &entry);
+	efd_hotkey_cache_invalidate(table);
 	return status;
 }
 
@@ -1243,6 +1333,7 @@ rte_efd_delete(struct rte_efd_table * const table, const unsigned int socket_id,
 	if (not_found == 0) {
 		table->num_rules--;
 		current_group->num_rules--;
+		efd_hotkey_cache_invalidate(table);
 	}
 
 	return not_found;
@@ -1316,6 +1407,27 @@ rte_efd_lookup(const struct rte_efd_table * const table,
 	uint8_t bin_choice;
 	const struct efd_online_group_entry *group;
 	const struct efd_online_chunk * const chunks = table->chunks[socket_id];
+	struct efd_hotkey_entry *he = NULL;
+	uint32_t gen = 0;
+	efd_value_t value;
+
+	if (table->hot_cache_enabled) {
+		const unsigned int lcore_id = rte_lcore_id();
+		struct efd_hotkey_cache *hc;
+
+		if (lcore_id != LCORE_ID_ANY &&
+				(hc = table->hot_cache[lcore_id]) != NULL) {
+			const uint32_t h = EFD_HASH(key, table);
+
+			he = (struct efd_hotkey_entry *)&hc->entries[
+				(size_t)(h & hc->mask) * hc->entry_size];
+			gen = rte_atomic_load_explicit(&table->hot_cache_gen,
+					rte_memory_order_acquire);
+			if (he->gen == gen && memcmp(he->key, key,
+					table->key_len) == 0)
+				return he->value;
+		}
+	}
 
 	/* Determine the chunk and group location for the given key */
 	efd_compute_ids(table, key, &chunk_id, &bin_id);
@@ -1323,10 +1435,23 @@ rte_efd_lookup(const struct rte_efd_table * const table,
 	group_id = efd_bin_to_group[bin_choice][bin_id];
 	group = &chunks[chunk_id].groups[group_id];
 
-	return efd_lookup_internal(group,
+	value = efd_lookup_internal(group,
 			EFD_HASHFUNCA(key, table),
 			EFD_HASHFUNCB(key, table),
 			table->lookup_fn);
+
+	/* Memoize for the next time this flow is seen on this lcore. The
+	 * cache is private to the lcore, so the fill cannot race with other
+	 * readers; a concurrent table update only makes the generation tag
+	 * stale, turning the entry into a miss.
+	 */
+	if (he != NULL) {
+		memcpy(he->key, key, table->key_len);
+		he->value = value;
+		he->gen = gen;
+	}
+
+	return value;
 }
 
 RTE_EXPORT_SYMBOL(rte_efd_lookup_bulk)
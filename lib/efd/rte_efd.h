@@ -13,6 +13,8 @@
 
 #include <stdint.h>
 
+#include <rte_compat.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -223,6 +225,33 @@ int
 rte_efd_delete(struct rte_efd_table *table, unsigned int socket_id,
 	const void *key, efd_value_t *prev_value);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Enable a per-lcore hot-key cache in front of the EFD computation.
+ *
+ * Each lcore gets a private direct-mapped cache of recently looked up
+ * keys, so with a skewed key distribution most rte_efd_lookup() calls
+ * resolve from a single cache line instead of recomputing the group and
+ * perfect-hash function. The caches are invalidated as a whole by
+ * rte_efd_update() and rte_efd_delete().
+ *
+ * @param table
+ *   EFD table to attach the caches to
+ * @param num_entries
+ *   Number of keys each per-lcore cache can hold, must be a power of two
+ *
+ * @return
+ *   0 - caches are enabled (or were already enabled)
+ *   -EINVAL - invalid parameters
+ *   -ENOMEM - cache allocation failed
+ */
+__rte_experimental
+int
+rte_efd_hotkey_cache_enable(struct rte_efd_table *table,
+		uint32_t num_entries);
+
 /**
  * Looks up the value associated with a key
  * This operation is multi-thread safe.
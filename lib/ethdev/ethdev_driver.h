@@ -66,6 +66,20 @@ struct __rte_cache_aligned rte_eth_dev {
 	eth_recycle_tx_mbufs_reuse_t recycle_tx_mbufs_reuse;
 	/** Pointer to PMD receive descriptors refill function */
 	eth_recycle_rx_descriptors_refill_t recycle_rx_descriptors_refill;
+	/** Pointer to PMD multi-queue receive function (optional) */
+	eth_rx_burst_multi_t rx_pkt_burst_multi;
+	/**
+	 * Per-queue PMD receive functions, indexed by queue id (optional).
+	 * When set, lets the PMD pick a receive function specialized for
+	 * each queue's actual configuration (e.g. no-offload, checksum
+	 * only, scatter) instead of one device-wide function covering the
+	 * union of all queue offloads. Every entry for a configured queue
+	 * must be valid; use the device-wide function for queues without a
+	 * specialized variant. Only update while the port is stopped.
+	 */
+	const eth_rx_burst_t *rx_queue_burst;
+	/** Per-queue PMD transmit functions (optional), see rx_queue_burst */
+	const eth_tx_burst_t *tx_queue_burst;
 
 	/**
 	 * Device data that is shared between primary and secondary processes
@@ -169,6 +183,13 @@ struct __rte_cache_aligned rte_eth_dev_data {
 	/** Queues state: HAIRPIN(2) / STARTED(1) / STOPPED(0) */
 	uint8_t tx_queue_state[RTE_MAX_QUEUES_PER_PORT];
 
+	/** Per-queue Tx mbuf lease pools. @see rte_eth_tx_mbuf_alloc_bulk() */
+	struct rte_mempool *tx_lease_pools[RTE_MAX_QUEUES_PER_PORT];
+	/** Number of mbufs leased from the per-queue Tx pools */
+	uint64_t tx_lease_allocs[RTE_MAX_QUEUES_PER_PORT];
+	/** Number of Tx mbufs that violated the lease contract */
+	uint64_t tx_lease_violations[RTE_MAX_QUEUES_PER_PORT];
+
 	uint32_t dev_flags;             /**< Capabilities */
 	int numa_node;                  /**< NUMA node connection */
 
@@ -621,6 +642,16 @@ typedef int (*eth_fw_version_get_t)(struct rte_eth_dev *dev,
 /** @internal Force mbufs to be from Tx ring. */
 typedef int (*eth_tx_done_cleanup_t)(void *txq, uint32_t free_cnt);
 
+/**
+ * @internal
+ * Reclaim completed Tx descriptors and hand the freed mbufs back to the
+ * caller instead of returning them to their pools. Drivers advertising
+ * RTE_ETH_DEV_CAPA_TX_DONE_POLL allow this to run concurrently with the
+ * transmit function on the same queue.
+ */
+typedef int (*eth_tx_done_poll_t)(void *txq, struct rte_mbuf **pkts,
+				  uint16_t nb_pkts);
+
 typedef void (*eth_rxq_info_get_t)(struct rte_eth_dev *dev,
 	uint16_t rx_queue_id, struct rte_eth_rxq_info *qinfo);
 
@@ -1464,6 +1495,7 @@ struct eth_dev_ops {
 	eth_tx_queue_setup_t       tx_queue_setup;/**< Set up device Tx queue */
 	eth_queue_release_t        tx_queue_release; /**< Release Tx queue */
 	eth_tx_done_cleanup_t      tx_done_cleanup;/**< Free Tx ring mbufs */
+	eth_tx_done_poll_t         tx_done_poll;   /**< Poll Tx completions */
 
 	eth_dev_led_on_t           dev_led_on;    /**< Turn on LED */
 	eth_dev_led_off_t          dev_led_off;   /**< Turn off LED */
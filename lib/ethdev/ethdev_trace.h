@@ -1918,6 +1918,16 @@ RTE_TRACE_POINT(
 	rte_trace_point_emit_int(ret);
 )
 
+RTE_TRACE_POINT(
+	rte_tm_trace_node_batch_apply,
+	RTE_TRACE_POINT_ARGS(uint16_t port_id,
+		const struct rte_tm_node_op *ops, uint32_t n_ops, int ret),
+	rte_trace_point_emit_u16(port_id);
+	rte_trace_point_emit_ptr(ops);
+	rte_trace_point_emit_u32(n_ops);
+	rte_trace_point_emit_int(ret);
+)
+
 RTE_TRACE_POINT(
 	rte_tm_trace_node_suspend,
 	RTE_TRACE_POINT_ARGS(uint16_t port_id, uint32_t node_id, int ret),
@@ -2221,6 +2231,16 @@ RTE_TRACE_POINT_FP(
 	rte_trace_point_emit_int(ret);
 )
 
+RTE_TRACE_POINT_FP(
+	rte_flow_trace_destroy_bulk,
+	RTE_TRACE_POINT_ARGS(uint16_t port_id,
+		struct rte_flow * const *flows, unsigned int n, int ret),
+	rte_trace_point_emit_u16(port_id);
+	rte_trace_point_emit_ptr(flows);
+	rte_trace_point_emit_u32(n);
+	rte_trace_point_emit_int(ret);
+)
+
 /* Called in loop in app/test-flow-perf */
 RTE_TRACE_POINT_FP(
 	rte_flow_trace_actions_update,
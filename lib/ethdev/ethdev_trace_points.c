@@ -509,6 +509,9 @@ RTE_TRACE_POINT_REGISTER(rte_flow_trace_create,
 RTE_TRACE_POINT_REGISTER(rte_flow_trace_destroy,
 	lib.ethdev.flow.destroy)
 
+RTE_TRACE_POINT_REGISTER(rte_flow_trace_destroy_bulk,
+	lib.ethdev.flow.destroy_bulk)
+
 RTE_TRACE_POINT_REGISTER(rte_flow_trace_actions_update,
 	lib.ethdev.flow.update)
 
@@ -728,6 +731,9 @@ RTE_TRACE_POINT_REGISTER(rte_tm_trace_node_cman_update,
 RTE_TRACE_POINT_REGISTER(rte_tm_trace_node_delete,
 	lib.ethdev.tm.node_delete)
 
+RTE_TRACE_POINT_REGISTER(rte_tm_trace_node_batch_apply,
+	lib.ethdev.tm.node_batch_apply)
+
 RTE_TRACE_POINT_REGISTER(rte_tm_trace_node_parent_update,
 	lib.ethdev.tm.node_parent_update)
 
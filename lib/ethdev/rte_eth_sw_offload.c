@@ -0,0 +1,451 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2025 Intel Corporation
+ */
+
+#include <eal_export.h>
+#include <rte_errno.h>
+#include <rte_malloc.h>
+#include <rte_ip4.h>
+#include <rte_ip6.h>
+#include <rte_net.h>
+#include <rte_tcp.h>
+#include <rte_udp.h>
+
+#include "rte_ethdev.h"
+#include "rte_eth_sw_offload.h"
+
+#define SW_OFFLOAD_RX_CAPA (RTE_ETH_RX_OFFLOAD_IPV4_CKSUM | \
+		RTE_ETH_RX_OFFLOAD_UDP_CKSUM | \
+		RTE_ETH_RX_OFFLOAD_TCP_CKSUM)
+
+#define SW_OFFLOAD_TX_CAPA (RTE_ETH_TX_OFFLOAD_IPV4_CKSUM | \
+		RTE_ETH_TX_OFFLOAD_UDP_CKSUM | \
+		RTE_ETH_TX_OFFLOAD_TCP_CKSUM)
+
+static const struct rte_eth_rxtx_callback
+	*sw_offload_rx_cbs[RTE_MAX_ETHPORTS][RTE_MAX_QUEUES_PER_PORT];
+static const struct rte_eth_rxtx_callback
+	*sw_offload_tx_cbs[RTE_MAX_ETHPORTS][RTE_MAX_QUEUES_PER_PORT];
+
+/* Header mbufs allocated per inner loop of the split callback. */
+#define SW_OFFLOAD_SPLIT_BURST 32
+
+struct sw_offload_rx_split_ctx {
+	struct rte_mempool *hdr_pool;
+	uint16_t split_len;
+};
+
+static struct sw_offload_rx_split_ctx
+	*sw_offload_rx_split_ctxs[RTE_MAX_ETHPORTS][RTE_MAX_QUEUES_PER_PORT];
+static const struct rte_eth_rxtx_callback
+	*sw_offload_rx_split_cbs[RTE_MAX_ETHPORTS][RTE_MAX_QUEUES_PER_PORT];
+
+static inline bool
+sw_offload_is_ipv4(uint32_t ptype)
+{
+	uint32_t l3 = ptype & RTE_PTYPE_L3_MASK;
+
+	return l3 == RTE_PTYPE_L3_IPV4 || l3 == RTE_PTYPE_L3_IPV4_EXT ||
+			l3 == RTE_PTYPE_L3_IPV4_EXT_UNKNOWN;
+}
+
+static inline bool
+sw_offload_is_ipv6(uint32_t ptype)
+{
+	uint32_t l3 = ptype & RTE_PTYPE_L3_MASK;
+
+	return l3 == RTE_PTYPE_L3_IPV6 || l3 == RTE_PTYPE_L3_IPV6_EXT ||
+			l3 == RTE_PTYPE_L3_IPV6_EXT_UNKNOWN;
+}
+
+static uint16_t
+sw_offload_rx_cb(uint16_t port_id __rte_unused, uint16_t queue_id __rte_unused,
+		struct rte_mbuf **pkts, uint16_t nb_pkts,
+		uint16_t max_pkts __rte_unused, void *user_param)
+{
+	uint64_t offloads = (uintptr_t)user_param;
+	struct rte_net_hdr_lens hdr_lens;
+	uint16_t i;
+
+	for (i = 0; i < nb_pkts; i++) {
+		struct rte_mbuf *pkt = pkts[i];
+		uint32_t ptype = rte_net_get_ptype(pkt, &hdr_lens,
+				RTE_PTYPE_L2_MASK | RTE_PTYPE_L3_MASK |
+				RTE_PTYPE_L4_MASK);
+		uint32_t l4 = ptype & RTE_PTYPE_L4_MASK;
+		uint16_t l4_off = hdr_lens.l2_len + hdr_lens.l3_len;
+		uint64_t wanted;
+
+		if (l4 == RTE_PTYPE_L4_TCP)
+			wanted = offloads & RTE_ETH_RX_OFFLOAD_TCP_CKSUM;
+		else if (l4 == RTE_PTYPE_L4_UDP)
+			wanted = offloads & RTE_ETH_RX_OFFLOAD_UDP_CKSUM;
+		else
+			wanted = 0;
+
+		if (sw_offload_is_ipv4(ptype)) {
+			const struct rte_ipv4_hdr *ipv4_hdr =
+				rte_pktmbuf_mtod_offset(pkt,
+					const struct rte_ipv4_hdr *,
+					hdr_lens.l2_len);
+
+			if (offloads & RTE_ETH_RX_OFFLOAD_IPV4_CKSUM)
+				pkt->ol_flags |= rte_ipv4_cksum(ipv4_hdr) == 0 ?
+					RTE_MBUF_F_RX_IP_CKSUM_GOOD :
+					RTE_MBUF_F_RX_IP_CKSUM_BAD;
+
+			if (wanted == 0)
+				continue;
+
+			if (l4 == RTE_PTYPE_L4_UDP) {
+				const struct rte_udp_hdr *udp_hdr =
+					rte_pktmbuf_mtod_offset(pkt,
+						const struct rte_udp_hdr *,
+						l4_off);
+
+				/* no checksum in the packet */
+				if (udp_hdr->dgram_cksum == 0) {
+					pkt->ol_flags |=
+						RTE_MBUF_F_RX_L4_CKSUM_NONE;
+					continue;
+				}
+			}
+			pkt->ol_flags |= rte_ipv4_udptcp_cksum_mbuf_verify(pkt,
+					ipv4_hdr, l4_off) == 0 ?
+				RTE_MBUF_F_RX_L4_CKSUM_GOOD :
+				RTE_MBUF_F_RX_L4_CKSUM_BAD;
+		} else if (sw_offload_is_ipv6(ptype) && wanted != 0) {
+			const struct rte_ipv6_hdr *ipv6_hdr =
+				rte_pktmbuf_mtod_offset(pkt,
+					const struct rte_ipv6_hdr *,
+					hdr_lens.l2_len);
+
+			pkt->ol_flags |= rte_ipv6_udptcp_cksum_mbuf_verify(pkt,
+					ipv6_hdr, l4_off) == 0 ?
+				RTE_MBUF_F_RX_L4_CKSUM_GOOD :
+				RTE_MBUF_F_RX_L4_CKSUM_BAD;
+		}
+	}
+
+	return nb_pkts;
+}
+
+static uint16_t
+sw_offload_tx_cb(uint16_t port_id __rte_unused, uint16_t queue_id __rte_unused,
+		struct rte_mbuf **pkts, uint16_t nb_pkts, void *user_param)
+{
+	uint64_t offloads = (uintptr_t)user_param;
+	uint16_t i;
+
+	for (i = 0; i < nb_pkts; i++) {
+		struct rte_mbuf *pkt = pkts[i];
+		uint64_t ol_flags = pkt->ol_flags;
+		uint64_t l4_req = ol_flags & RTE_MBUF_F_TX_L4_MASK;
+		uint16_t l4_off = pkt->l2_len + pkt->l3_len;
+
+		if ((ol_flags & (RTE_MBUF_F_TX_IP_CKSUM |
+				RTE_MBUF_F_TX_L4_MASK)) == 0)
+			continue;
+
+		if (ol_flags & RTE_MBUF_F_TX_IPV4) {
+			struct rte_ipv4_hdr *ipv4_hdr =
+				rte_pktmbuf_mtod_offset(pkt,
+					struct rte_ipv4_hdr *, pkt->l2_len);
+
+			if ((ol_flags & RTE_MBUF_F_TX_IP_CKSUM) &&
+					(offloads &
+					RTE_ETH_TX_OFFLOAD_IPV4_CKSUM)) {
+				ipv4_hdr->hdr_checksum = 0;
+				ipv4_hdr->hdr_checksum =
+					rte_ipv4_cksum(ipv4_hdr);
+				pkt->ol_flags &= ~RTE_MBUF_F_TX_IP_CKSUM;
+			}
+
+			if (l4_req == RTE_MBUF_F_TX_TCP_CKSUM &&
+					(offloads &
+					RTE_ETH_TX_OFFLOAD_TCP_CKSUM)) {
+				struct rte_tcp_hdr *tcp_hdr =
+					rte_pktmbuf_mtod_offset(pkt,
+						struct rte_tcp_hdr *, l4_off);
+
+				tcp_hdr->cksum = 0;
+				tcp_hdr->cksum = rte_ipv4_udptcp_cksum_mbuf(
+						pkt, ipv4_hdr, l4_off);
+				pkt->ol_flags &= ~RTE_MBUF_F_TX_L4_MASK;
+			} else if (l4_req == RTE_MBUF_F_TX_UDP_CKSUM &&
+					(offloads &
+					RTE_ETH_TX_OFFLOAD_UDP_CKSUM)) {
+				struct rte_udp_hdr *udp_hdr =
+					rte_pktmbuf_mtod_offset(pkt,
+						struct rte_udp_hdr *, l4_off);
+
+				udp_hdr->dgram_cksum = 0;
+				udp_hdr->dgram_cksum =
+					rte_ipv4_udptcp_cksum_mbuf(pkt,
+						ipv4_hdr, l4_off);
+				pkt->ol_flags &= ~RTE_MBUF_F_TX_L4_MASK;
+			}
+		} else if (ol_flags & RTE_MBUF_F_TX_IPV6) {
+			const struct rte_ipv6_hdr *ipv6_hdr =
+				rte_pktmbuf_mtod_offset(pkt,
+					const struct rte_ipv6_hdr *,
+					pkt->l2_len);
+
+			if (l4_req == RTE_MBUF_F_TX_TCP_CKSUM &&
+					(offloads &
+					RTE_ETH_TX_OFFLOAD_TCP_CKSUM)) {
+				struct rte_tcp_hdr *tcp_hdr =
+					rte_pktmbuf_mtod_offset(pkt,
+						struct rte_tcp_hdr *, l4_off);
+
+				tcp_hdr->cksum = 0;
+				tcp_hdr->cksum = rte_ipv6_udptcp_cksum_mbuf(
+						pkt, ipv6_hdr, l4_off);
+				pkt->ol_flags &= ~RTE_MBUF_F_TX_L4_MASK;
+			} else if (l4_req == RTE_MBUF_F_TX_UDP_CKSUM &&
+					(offloads &
+					RTE_ETH_TX_OFFLOAD_UDP_CKSUM)) {
+				struct rte_udp_hdr *udp_hdr =
+					rte_pktmbuf_mtod_offset(pkt,
+						struct rte_udp_hdr *, l4_off);
+
+				udp_hdr->dgram_cksum = 0;
+				udp_hdr->dgram_cksum =
+					rte_ipv6_udptcp_cksum_mbuf(pkt,
+						ipv6_hdr, l4_off);
+				pkt->ol_flags &= ~RTE_MBUF_F_TX_L4_MASK;
+			}
+		}
+	}
+
+	return nb_pkts;
+}
+
+static uint16_t
+sw_offload_rx_split_cb(uint16_t port_id __rte_unused,
+		uint16_t queue_id __rte_unused, struct rte_mbuf **pkts,
+		uint16_t nb_pkts, uint16_t max_pkts __rte_unused,
+		void *user_param)
+{
+	const struct sw_offload_rx_split_ctx *ctx = user_param;
+	const uint16_t split_len = ctx->split_len;
+	struct rte_mbuf *hdrs[SW_OFFLOAD_SPLIT_BURST];
+	uint16_t base, i;
+
+	for (base = 0; base < nb_pkts; base += SW_OFFLOAD_SPLIT_BURST) {
+		uint16_t end = RTE_MIN((uint16_t)(base + SW_OFFLOAD_SPLIT_BURST),
+				nb_pkts);
+		uint16_t need = 0, k = 0;
+
+		for (i = base; i < end; i++)
+			need += pkts[i]->data_len > split_len;
+		if (need == 0)
+			continue;
+		/* On pool exhaustion leave the rest of the burst unsplit. */
+		if (unlikely(rte_pktmbuf_alloc_bulk(ctx->hdr_pool, hdrs,
+				need) != 0))
+			break;
+
+		for (i = base; i < end; i++) {
+			struct rte_mbuf *pkt = pkts[i];
+			struct rte_mbuf *hdr;
+
+			if (pkt->data_len <= split_len)
+				continue;
+
+			hdr = hdrs[k++];
+			rte_memcpy(rte_pktmbuf_mtod(hdr, void *),
+					rte_pktmbuf_mtod(pkt, const void *),
+					split_len);
+			hdr->data_len = split_len;
+			hdr->pkt_len = split_len;
+
+			/* The header mbuf takes over the packet metadata. */
+			hdr->port = pkt->port;
+			hdr->packet_type = pkt->packet_type;
+			hdr->vlan_tci = pkt->vlan_tci;
+			hdr->vlan_tci_outer = pkt->vlan_tci_outer;
+			hdr->hash = pkt->hash;
+			hdr->ol_flags = pkt->ol_flags &
+				~(RTE_MBUF_F_INDIRECT | RTE_MBUF_F_EXTERNAL);
+
+			rte_pktmbuf_adj(pkt, split_len);
+			hdr->pkt_len += pkt->pkt_len;
+			hdr->nb_segs = pkt->nb_segs + 1;
+			hdr->next = pkt;
+			pkts[i] = hdr;
+		}
+	}
+
+	return nb_pkts;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_eth_sw_offload_rx_capa, 25.07)
+uint64_t
+rte_eth_sw_offload_rx_capa(void)
+{
+	return SW_OFFLOAD_RX_CAPA;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_eth_sw_offload_tx_capa, 25.07)
+uint64_t
+rte_eth_sw_offload_tx_capa(void)
+{
+	return SW_OFFLOAD_TX_CAPA;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_eth_sw_offload_rx_enable, 25.07)
+int
+rte_eth_sw_offload_rx_enable(uint16_t port_id, uint16_t queue_id,
+		uint64_t offloads)
+{
+	const struct rte_eth_rxtx_callback *cb;
+
+	RTE_ETH_VALID_PORTID_OR_ERR_RET(port_id, -ENODEV);
+
+	if (queue_id >= RTE_MAX_QUEUES_PER_PORT)
+		return -EINVAL;
+	if (offloads == 0 || (offloads & ~SW_OFFLOAD_RX_CAPA) != 0)
+		return -EINVAL;
+	if (sw_offload_rx_cbs[port_id][queue_id] != NULL)
+		return -EINVAL;
+
+	cb = rte_eth_add_rx_callback(port_id, queue_id, sw_offload_rx_cb,
+			(void *)(uintptr_t)offloads);
+	if (cb == NULL)
+		return -rte_errno;
+	sw_offload_rx_cbs[port_id][queue_id] = cb;
+
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_eth_sw_offload_rx_disable, 25.07)
+int
+rte_eth_sw_offload_rx_disable(uint16_t port_id, uint16_t queue_id)
+{
+	const struct rte_eth_rxtx_callback *cb;
+	int ret;
+
+	RTE_ETH_VALID_PORTID_OR_ERR_RET(port_id, -ENODEV);
+
+	if (queue_id >= RTE_MAX_QUEUES_PER_PORT)
+		return -EINVAL;
+	cb = sw_offload_rx_cbs[port_id][queue_id];
+	if (cb == NULL)
+		return -EINVAL;
+
+	ret = rte_eth_remove_rx_callback(port_id, queue_id, cb);
+	if (ret == 0)
+		sw_offload_rx_cbs[port_id][queue_id] = NULL;
+
+	return ret;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_eth_sw_offload_rx_split_enable, 25.07)
+int
+rte_eth_sw_offload_rx_split_enable(uint16_t port_id, uint16_t queue_id,
+		struct rte_mempool *hdr_pool, uint16_t split_len)
+{
+	const struct rte_eth_rxtx_callback *cb;
+	struct sw_offload_rx_split_ctx *ctx;
+
+	RTE_ETH_VALID_PORTID_OR_ERR_RET(port_id, -ENODEV);
+
+	if (queue_id >= RTE_MAX_QUEUES_PER_PORT)
+		return -EINVAL;
+	if (hdr_pool == NULL || split_len == 0 ||
+			rte_pktmbuf_data_room_size(hdr_pool) <
+			split_len + RTE_PKTMBUF_HEADROOM)
+		return -EINVAL;
+	if (sw_offload_rx_split_cbs[port_id][queue_id] != NULL)
+		return -EINVAL;
+
+	ctx = rte_zmalloc(NULL, sizeof(*ctx), 0);
+	if (ctx == NULL)
+		return -ENOMEM;
+	ctx->hdr_pool = hdr_pool;
+	ctx->split_len = split_len;
+
+	cb = rte_eth_add_rx_callback(port_id, queue_id,
+			sw_offload_rx_split_cb, ctx);
+	if (cb == NULL) {
+		rte_free(ctx);
+		return -rte_errno;
+	}
+	sw_offload_rx_split_ctxs[port_id][queue_id] = ctx;
+	sw_offload_rx_split_cbs[port_id][queue_id] = cb;
+
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_eth_sw_offload_rx_split_disable, 25.07)
+int
+rte_eth_sw_offload_rx_split_disable(uint16_t port_id, uint16_t queue_id)
+{
+	const struct rte_eth_rxtx_callback *cb;
+	int ret;
+
+	RTE_ETH_VALID_PORTID_OR_ERR_RET(port_id, -ENODEV);
+
+	if (queue_id >= RTE_MAX_QUEUES_PER_PORT)
+		return -EINVAL;
+	cb = sw_offload_rx_split_cbs[port_id][queue_id];
+	if (cb == NULL)
+		return -EINVAL;
+
+	ret = rte_eth_remove_rx_callback(port_id, queue_id, cb);
+	if (ret == 0) {
+		rte_free(sw_offload_rx_split_ctxs[port_id][queue_id]);
+		sw_offload_rx_split_ctxs[port_id][queue_id] = NULL;
+		sw_offload_rx_split_cbs[port_id][queue_id] = NULL;
+	}
+
+	return ret;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_eth_sw_offload_tx_enable, 25.07)
+int
+rte_eth_sw_offload_tx_enable(uint16_t port_id, uint16_t queue_id,
+		uint64_t offloads)
+{
+	const struct rte_eth_rxtx_callback *cb;
+
+	RTE_ETH_VALID_PORTID_OR_ERR_RET(port_id, -ENODEV);
+
+	if (queue_id >= RTE_MAX_QUEUES_PER_PORT)
+		return -EINVAL;
+	if (offloads == 0 || (offloads & ~SW_OFFLOAD_TX_CAPA) != 0)
+		return -EINVAL;
+	if (sw_offload_tx_cbs[port_id][queue_id] != NULL)
+		return -EINVAL;
+
+	cb = rte_eth_add_tx_callback(port_id, queue_id, sw_offload_tx_cb,
+			(void *)(uintptr_t)offloads);
+	if (cb == NULL)
+		return -rte_errno;
+	sw_offload_tx_cbs[port_id][queue_id] = cb;
+
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_eth_sw_offload_tx_disable, 25.07)
+int
+rte_eth_sw_offload_tx_disable(uint16_t port_id, uint16_t queue_id)
+{
+	const struct rte_eth_rxtx_callback *cb;
+	int ret;
+
+	RTE_ETH_VALID_PORTID_OR_ERR_RET(port_id, -ENODEV);
+
+	if (queue_id >= RTE_MAX_QUEUES_PER_PORT)
+		return -EINVAL;
+	cb = sw_offload_tx_cbs[port_id][queue_id];
+	if (cb == NULL)
+		return -EINVAL;
+
+	ret = rte_eth_remove_tx_callback(port_id, queue_id, cb);
+	if (ret == 0)
+		sw_offload_tx_cbs[port_id][queue_id] = NULL;
+
+	return ret;
+}
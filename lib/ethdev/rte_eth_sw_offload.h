@@ -0,0 +1,229 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2025 Intel Corporation
+ */
+
+#ifndef RTE_ETH_SW_OFFLOAD_H
+#define RTE_ETH_SW_OFFLOAD_H
+
+/**
+ * @file
+ * Software offload emulation for feature-poor drivers
+ *
+ * Some drivers (af_packet, memif, virtio without host support) advertise
+ * neither Rx checksum validation nor Tx checksum computation, pushing
+ * every application into a private scalar fallback. This shim installs
+ * shared software implementations, built on the checksum core of the net
+ * library, as Rx/Tx callbacks on a queue, so marked packets behave as if
+ * the device had the offload:
+ *
+ * - On Rx, the callback parses each packet and sets the
+ *   RTE_MBUF_F_RX_IP_CKSUM_* and RTE_MBUF_F_RX_L4_CKSUM_* flags from a
+ *   software verification of the IPv4 header and TCP/UDP checksums.
+ * - On Tx, the callback honors RTE_MBUF_F_TX_IP_CKSUM and the
+ *   RTE_MBUF_F_TX_L4_MASK requests by writing the checksums into the
+ *   packet and clearing the request flags before the driver sees them.
+ *   Packets must be writable and carry valid l2_len/l3_len, as for a
+ *   hardware checksum offload. The L3 and L4 headers must reside in the
+ *   first segment; the checksummed payload may span segments.
+ *
+ * TSO is out of scope for a Tx callback since segmentation grows the
+ * burst beyond the caller's array; applications needing software TSO
+ * should use the GSO library explicitly.
+ *
+ * The shim can also emulate RTE_ETH_RX_OFFLOAD_BUFFER_SPLIT: an Rx
+ * callback copies the first bytes of every packet into a compact mbuf
+ * from a dedicated header pool and chains the original, now
+ * payload-only, mbuf behind it. The pipeline then walks dense header
+ * objects instead of striding through full-size buffers, which keeps
+ * the hot header working set cache resident on devices without the
+ * hardware offload.
+ *
+ * The shim does not rewrite the capabilities reported by the driver:
+ * applications opt in per queue and can combine
+ * rte_eth_sw_offload_rx_capa()/rte_eth_sw_offload_tx_capa() with the
+ * device capability set.
+ */
+
+#include <stdint.h>
+
+#include <rte_compat.h>
+
+struct rte_mempool;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Get the Rx offloads that can be emulated in software.
+ *
+ * @return
+ *   RTE_ETH_RX_OFFLOAD_* bits supported by rte_eth_sw_offload_rx_enable().
+ */
+__rte_experimental
+uint64_t rte_eth_sw_offload_rx_capa(void);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Get the Tx offloads that can be emulated in software.
+ *
+ * @return
+ *   RTE_ETH_TX_OFFLOAD_* bits supported by rte_eth_sw_offload_tx_enable().
+ */
+__rte_experimental
+uint64_t rte_eth_sw_offload_tx_capa(void);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Install software Rx offload emulation on a receive queue.
+ *
+ * @param port_id
+ *   The port identifier of the Ethernet device.
+ * @param queue_id
+ *   The index of the receive queue.
+ * @param offloads
+ *   Offloads to emulate, a subset of rte_eth_sw_offload_rx_capa().
+ * @return
+ *   - 0: Success.
+ *   - (-ENODEV) if @p port_id is invalid.
+ *   - (-EINVAL) if @p offloads requests an offload that cannot be
+ *     emulated, or the queue already has the emulation installed.
+ *   - Negative error code from rte_eth_add_rx_callback() otherwise.
+ */
+__rte_experimental
+int rte_eth_sw_offload_rx_enable(uint16_t port_id, uint16_t queue_id,
+		uint64_t offloads);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Remove software Rx offload emulation from a receive queue.
+ *
+ * As with rte_eth_remove_rx_callback(), the callback memory is reclaimed
+ * only after no data plane thread can still be inside the callback.
+ *
+ * @param port_id
+ *   The port identifier of the Ethernet device.
+ * @param queue_id
+ *   The index of the receive queue.
+ * @return
+ *   - 0: Success.
+ *   - (-ENODEV) if @p port_id is invalid.
+ *   - (-EINVAL) if the queue has no emulation installed.
+ */
+__rte_experimental
+int rte_eth_sw_offload_rx_disable(uint16_t port_id, uint16_t queue_id);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Install software header-data split on a receive queue.
+ *
+ * For every received packet longer than @p split_len, the first
+ * @p split_len bytes are copied into an mbuf allocated from
+ * @p hdr_pool, the original mbuf is trimmed to the payload and chained
+ * behind the header mbuf, and the header mbuf (carrying the packet
+ * metadata) replaces the original in the receive burst. Packets not
+ * longer than @p split_len are passed through unchanged, as are all
+ * packets of a burst remainder for which the header pool is exhausted.
+ *
+ * @param port_id
+ *   The port identifier of the Ethernet device.
+ * @param queue_id
+ *   The index of the receive queue.
+ * @param hdr_pool
+ *   Pool to allocate the header mbufs from. Sizing its data room just
+ *   above @p split_len keeps the header objects dense.
+ * @param split_len
+ *   Number of bytes to split off into the header mbuf.
+ * @return
+ *   - 0: Success.
+ *   - (-ENODEV) if @p port_id is invalid.
+ *   - (-EINVAL) if @p split_len is zero or does not fit the data room
+ *     of @p hdr_pool, or the queue already has the split installed.
+ *   - (-ENOMEM) if the per-queue state cannot be allocated.
+ *   - Negative error code from rte_eth_add_rx_callback() otherwise.
+ */
+__rte_experimental
+int rte_eth_sw_offload_rx_split_enable(uint16_t port_id, uint16_t queue_id,
+		struct rte_mempool *hdr_pool, uint16_t split_len);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Remove software header-data split from a receive queue.
+ *
+ * As with rte_eth_remove_rx_callback(), the callback memory is reclaimed
+ * only after no data plane thread can still be inside the callback.
+ *
+ * @param port_id
+ *   The port identifier of the Ethernet device.
+ * @param queue_id
+ *   The index of the receive queue.
+ * @return
+ *   - 0: Success.
+ *   - (-ENODEV) if @p port_id is invalid.
+ *   - (-EINVAL) if the queue has no split installed.
+ */
+__rte_experimental
+int rte_eth_sw_offload_rx_split_disable(uint16_t port_id, uint16_t queue_id);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Install software Tx offload emulation on a transmit queue.
+ *
+ * @param port_id
+ *   The port identifier of the Ethernet device.
+ * @param queue_id
+ *   The index of the transmit queue.
+ * @param offloads
+ *   Offloads to emulate, a subset of rte_eth_sw_offload_tx_capa().
+ * @return
+ *   - 0: Success.
+ *   - (-ENODEV) if @p port_id is invalid.
+ *   - (-EINVAL) if @p offloads requests an offload that cannot be
+ *     emulated, or the queue already has the emulation installed.
+ *   - Negative error code from rte_eth_add_tx_callback() otherwise.
+ */
+__rte_experimental
+int rte_eth_sw_offload_tx_enable(uint16_t port_id, uint16_t queue_id,
+		uint64_t offloads);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Remove software Tx offload emulation from a transmit queue.
+ *
+ * As with rte_eth_remove_tx_callback(), the callback memory is reclaimed
+ * only after no data plane thread can still be inside the callback.
+ *
+ * @param port_id
+ *   The port identifier of the Ethernet device.
+ * @param queue_id
+ *   The index of the transmit queue.
+ * @return
+ *   - 0: Success.
+ *   - (-ENODEV) if @p port_id is invalid.
+ *   - (-EINVAL) if the queue has no emulation installed.
+ */
+__rte_experimental
+int rte_eth_sw_offload_tx_disable(uint16_t port_id, uint16_t queue_id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RTE_ETH_SW_OFFLOAD_H */
@@ -158,6 +158,8 @@ static const struct {
 	{RTE_ETH_DEV_CAPA_RXQ_SHARE, "RXQ_SHARE"},
 	{RTE_ETH_DEV_CAPA_FLOW_RULE_KEEP, "FLOW_RULE_KEEP"},
 	{RTE_ETH_DEV_CAPA_FLOW_SHARED_OBJECT_KEEP, "FLOW_SHARED_OBJECT_KEEP"},
+	{RTE_ETH_DEV_CAPA_TX_DONE_POLL, "TX_DONE_POLL"},
+	{RTE_ETH_DEV_CAPA_RX_REFILL_CACHE, "RX_REFILL_CACHE"},
 };
 
 enum {
@@ -2299,8 +2301,7 @@ rte_eth_rx_queue_setup(uint16_t port_id, uint16_t rx_queue_id,
 	if (rx_conf != NULL &&
 	   (rx_conf->reserved_64s[0] != 0 ||
 	    rx_conf->reserved_64s[1] != 0 ||
-	    rx_conf->reserved_ptrs[0] != NULL ||
-	    rx_conf->reserved_ptrs[1] != NULL)) {
+	    rx_conf->reserved_ptrs[0] != NULL)) {
 		RTE_ETHDEV_LOG_LINE(ERR, "Rx conf reserved fields not zero");
 		return -EINVAL;
 	}
@@ -2321,6 +2322,14 @@ rte_eth_rx_queue_setup(uint16_t port_id, uint16_t rx_queue_id,
 		return -ENOTSUP;
 	}
 
+	/* Dedicated Rx refill cache requires driver support */
+	if (rx_conf != NULL && rx_conf->refill_cache != NULL &&
+	    (dev_info.dev_capa & RTE_ETH_DEV_CAPA_RX_REFILL_CACHE) == 0) {
+		RTE_ETHDEV_LOG_LINE(ERR,
+			    "Rx refill cache requested, but driver does not support it");
+		return -ENOTSUP;
+	}
+
 	/* Ensure that we have one and only one source of Rx buffers */
 	if ((mp != NULL) +
 	    (rx_conf != NULL && rx_conf->rx_nseg > 0) +
@@ -2602,6 +2611,73 @@ rte_eth_rx_hairpin_queue_setup(uint16_t port_id, uint16_t rx_queue_id,
 	return ret;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_eth_rx_queue_reconfigure, 25.07)
+int
+rte_eth_rx_queue_reconfigure(uint16_t port_id, uint16_t rx_queue_id,
+		uint16_t nb_rx_desc)
+{
+	struct rte_eth_dev *dev;
+	struct rte_eth_dev_info dev_info;
+	struct rte_eth_rxq_info qinfo;
+	int socket_id;
+	bool started;
+	int ret;
+
+	RTE_ETH_VALID_PORTID_OR_ERR_RET(port_id, -ENODEV);
+	dev = &rte_eth_devices[port_id];
+
+	ret = rte_eth_dev_info_get(port_id, &dev_info);
+	if (ret != 0)
+		return ret;
+
+	if (dev->data->dev_started &&
+		!(dev_info.dev_capa &
+			RTE_ETH_DEV_CAPA_RUNTIME_RX_QUEUE_SETUP)) {
+		RTE_ETHDEV_LOG_LINE(ERR,
+			"Port %u does not support Rx queue setup on a running port",
+			port_id);
+		return -ENOTSUP;
+	}
+
+	ret = rte_eth_rx_queue_info_get(port_id, rx_queue_id, &qinfo);
+	if (ret != 0)
+		return ret;
+
+	socket_id = rte_eth_dev_socket_id(port_id);
+	if (socket_id < 0)
+		socket_id = SOCKET_ID_ANY;
+
+	started = qinfo.queue_state == RTE_ETH_QUEUE_STATE_STARTED;
+	if (started) {
+		ret = rte_eth_dev_rx_queue_stop(port_id, rx_queue_id);
+		if (ret != 0)
+			return ret;
+	}
+
+	ret = rte_eth_rx_queue_setup(port_id, rx_queue_id, nb_rx_desc,
+			socket_id, &qinfo.conf, qinfo.mp);
+	if (ret != 0) {
+		/* Try to bring the queue back with its previous ring size. */
+		if (rte_eth_rx_queue_setup(port_id, rx_queue_id,
+				qinfo.nb_desc, socket_id, &qinfo.conf,
+				qinfo.mp) != 0) {
+			RTE_ETHDEV_LOG_LINE(ERR,
+				"Port %u Rx queue %u left unconfigured after failed reconfigure",
+				port_id, rx_queue_id);
+			return ret;
+		}
+	}
+
+	if (started) {
+		int rc = rte_eth_dev_rx_queue_start(port_id, rx_queue_id);
+
+		if (ret == 0)
+			ret = rc;
+	}
+
+	return ret;
+}
+
 RTE_EXPORT_SYMBOL(rte_eth_tx_queue_setup)
 int
 rte_eth_tx_queue_setup(uint16_t port_id, uint16_t tx_queue_id,
@@ -2627,8 +2703,7 @@ rte_eth_tx_queue_setup(uint16_t port_id, uint16_t tx_queue_id,
 	if (tx_conf != NULL &&
 	   (tx_conf->reserved_64s[0] != 0 ||
 	    tx_conf->reserved_64s[1] != 0 ||
-	    tx_conf->reserved_ptrs[0] != NULL ||
-	    tx_conf->reserved_ptrs[1] != NULL)) {
+	    tx_conf->reserved_ptrs[0] != NULL)) {
 		RTE_ETHDEV_LOG_LINE(ERR, "Tx conf reserved fields not zero");
 		return -EINVAL;
 	}
@@ -2709,9 +2784,111 @@ rte_eth_tx_queue_setup(uint16_t port_id, uint16_t tx_queue_id,
 		return -EINVAL;
 	}
 
+	if (local_conf.lease_pool != NULL) {
+		if (local_conf.lease_pool->private_data_size <
+				sizeof(struct rte_pktmbuf_pool_private)) {
+			RTE_ETHDEV_LOG_LINE(ERR, "%s private_data_size %u < %u",
+				local_conf.lease_pool->name,
+				local_conf.lease_pool->private_data_size,
+				(unsigned int)
+				sizeof(struct rte_pktmbuf_pool_private));
+			return -ENOSPC;
+		}
+		if ((dev_info.tx_offload_capa &
+				RTE_ETH_TX_OFFLOAD_MBUF_FAST_FREE) == 0) {
+			RTE_ETHDEV_LOG_LINE(ERR,
+				"Ethdev port_id=%d tx_queue_id=%d: lease pool requested, but driver does not support mbuf fast free",
+				port_id, tx_queue_id);
+			return -ENOTSUP;
+		}
+		/* The queue-private pool is what makes fast free safe on
+		 * this queue, so turn it on unless already enabled port-wide.
+		 */
+		if (((dev->data->dev_conf.txmode.offloads |
+				local_conf.offloads) &
+				RTE_ETH_TX_OFFLOAD_MBUF_FAST_FREE) == 0) {
+			if ((dev_info.tx_queue_offload_capa &
+					RTE_ETH_TX_OFFLOAD_MBUF_FAST_FREE) == 0) {
+				RTE_ETHDEV_LOG_LINE(ERR,
+					"Ethdev port_id=%d tx_queue_id=%d: mbuf fast free is not a per-queue offload, enable it in rte_eth_dev_configure()",
+					port_id, tx_queue_id);
+				return -EINVAL;
+			}
+			local_conf.offloads |= RTE_ETH_TX_OFFLOAD_MBUF_FAST_FREE;
+		}
+	}
+
 	rte_ethdev_trace_txq_setup(port_id, tx_queue_id, nb_tx_desc, tx_conf);
-	return eth_err(port_id, dev->dev_ops->tx_queue_setup(dev,
-		       tx_queue_id, nb_tx_desc, socket_id, &local_conf));
+	ret = eth_err(port_id, dev->dev_ops->tx_queue_setup(dev,
+		      tx_queue_id, nb_tx_desc, socket_id, &local_conf));
+	if (ret == 0) {
+		dev->data->tx_lease_pools[tx_queue_id] = local_conf.lease_pool;
+		dev->data->tx_lease_allocs[tx_queue_id] = 0;
+		dev->data->tx_lease_violations[tx_queue_id] = 0;
+	}
+	return ret;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_eth_tx_mbuf_alloc_bulk, 25.07)
+int
+rte_eth_tx_mbuf_alloc_bulk(uint16_t port_id, uint16_t queue_id,
+		struct rte_mbuf **tx_pkts, uint16_t nb_pkts)
+{
+	struct rte_eth_dev *dev;
+	struct rte_mempool *pool;
+	int ret;
+
+	RTE_ETH_VALID_PORTID_OR_ERR_RET(port_id, -ENODEV);
+	dev = &rte_eth_devices[port_id];
+
+	if (queue_id >= dev->data->nb_tx_queues) {
+		RTE_ETHDEV_LOG_LINE(ERR, "Invalid Tx queue_id=%u", queue_id);
+		return -EINVAL;
+	}
+
+	pool = dev->data->tx_lease_pools[queue_id];
+	if (pool == NULL)
+		return -ENOTSUP;
+
+	ret = rte_pktmbuf_alloc_bulk(pool, tx_pkts, nb_pkts);
+	if (ret == 0)
+		dev->data->tx_lease_allocs[queue_id] += nb_pkts;
+
+	return ret;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_eth_tx_lease_audit, 25.07)
+int
+rte_eth_tx_lease_audit(uint16_t port_id, uint16_t queue_id,
+		struct rte_mbuf **tx_pkts, uint16_t nb_pkts)
+{
+	struct rte_eth_dev *dev;
+	struct rte_mempool *pool;
+	unsigned int nb_viol = 0;
+	uint16_t i;
+
+	RTE_ETH_VALID_PORTID_OR_ERR_RET(port_id, -ENODEV);
+	dev = &rte_eth_devices[port_id];
+
+	if (queue_id >= dev->data->nb_tx_queues) {
+		RTE_ETHDEV_LOG_LINE(ERR, "Invalid Tx queue_id=%u", queue_id);
+		return -EINVAL;
+	}
+
+	pool = dev->data->tx_lease_pools[queue_id];
+	if (pool == NULL)
+		return -ENOTSUP;
+
+	for (i = 0; i < nb_pkts; i++) {
+		struct rte_mbuf *m = tx_pkts[i];
+
+		if (m->pool != pool || rte_mbuf_refcnt_read(m) != 1 ||
+				RTE_MBUF_CLONED(m) || RTE_MBUF_HAS_EXTBUF(m))
+			nb_viol++;
+	}
+	dev->data->tx_lease_violations[queue_id] += nb_viol;
+
+	return nb_viol;
 }
 
 RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_eth_tx_hairpin_queue_setup, 19.11)
@@ -2814,6 +2991,75 @@ rte_eth_tx_hairpin_queue_setup(uint16_t port_id, uint16_t tx_queue_id,
 	return ret;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_eth_tx_queue_reconfigure, 25.07)
+int
+rte_eth_tx_queue_reconfigure(uint16_t port_id, uint16_t tx_queue_id,
+		uint16_t nb_tx_desc)
+{
+	struct rte_eth_dev *dev;
+	struct rte_eth_dev_info dev_info;
+	struct rte_eth_txq_info qinfo;
+	int socket_id;
+	bool started;
+	int ret;
+
+	RTE_ETH_VALID_PORTID_OR_ERR_RET(port_id, -ENODEV);
+	dev = &rte_eth_devices[port_id];
+
+	ret = rte_eth_dev_info_get(port_id, &dev_info);
+	if (ret != 0)
+		return ret;
+
+	if (dev->data->dev_started &&
+		!(dev_info.dev_capa &
+			RTE_ETH_DEV_CAPA_RUNTIME_TX_QUEUE_SETUP)) {
+		RTE_ETHDEV_LOG_LINE(ERR,
+			"Port %u does not support Tx queue setup on a running port",
+			port_id);
+		return -ENOTSUP;
+	}
+
+	ret = rte_eth_tx_queue_info_get(port_id, tx_queue_id, &qinfo);
+	if (ret != 0)
+		return ret;
+
+	/* Drivers do not report the lease pool, carry it over explicitly. */
+	qinfo.conf.lease_pool = dev->data->tx_lease_pools[tx_queue_id];
+
+	socket_id = rte_eth_dev_socket_id(port_id);
+	if (socket_id < 0)
+		socket_id = SOCKET_ID_ANY;
+
+	started = qinfo.queue_state == RTE_ETH_QUEUE_STATE_STARTED;
+	if (started) {
+		ret = rte_eth_dev_tx_queue_stop(port_id, tx_queue_id);
+		if (ret != 0)
+			return ret;
+	}
+
+	ret = rte_eth_tx_queue_setup(port_id, tx_queue_id, nb_tx_desc,
+			socket_id, &qinfo.conf);
+	if (ret != 0) {
+		/* Try to bring the queue back with its previous ring size. */
+		if (rte_eth_tx_queue_setup(port_id, tx_queue_id,
+				qinfo.nb_desc, socket_id, &qinfo.conf) != 0) {
+			RTE_ETHDEV_LOG_LINE(ERR,
+				"Port %u Tx queue %u left unconfigured after failed reconfigure",
+				port_id, tx_queue_id);
+			return ret;
+		}
+	}
+
+	if (started) {
+		int rc = rte_eth_dev_tx_queue_start(port_id, tx_queue_id);
+
+		if (ret == 0)
+			ret = rc;
+	}
+
+	return ret;
+}
+
 RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_eth_hairpin_bind, 20.11)
 int
 rte_eth_hairpin_bind(uint16_t tx_port, uint16_t rx_port)
@@ -3001,6 +3247,36 @@ rte_eth_tx_done_cleanup(uint16_t port_id, uint16_t queue_id, uint32_t free_cnt)
 	return ret;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_eth_tx_done_poll, 25.07)
+int
+rte_eth_tx_done_poll(uint16_t port_id, uint16_t queue_id,
+		     struct rte_mbuf **pkts, uint16_t nb_pkts)
+{
+	struct rte_eth_dev *dev;
+	int ret;
+
+	RTE_ETH_VALID_PORTID_OR_ERR_RET(port_id, -ENODEV);
+	dev = &rte_eth_devices[port_id];
+
+#ifdef RTE_ETHDEV_DEBUG_TX
+	ret = eth_dev_validate_tx_queue(dev, queue_id);
+	if (ret != 0)
+		return ret;
+#endif
+
+	if (pkts == NULL && nb_pkts != 0)
+		return -EINVAL;
+
+	if (dev->dev_ops->tx_done_poll == NULL)
+		return -ENOTSUP;
+
+	/* Call driver to reclaim completed descriptors. */
+	ret = dev->dev_ops->tx_done_poll(dev->data->tx_queues[queue_id],
+					 pkts, nb_pkts);
+
+	return eth_err(port_id, ret);
+}
+
 RTE_EXPORT_SYMBOL(rte_eth_promiscuous_enable)
 int
 rte_eth_promiscuous_enable(uint16_t port_id)
@@ -3742,6 +4018,50 @@ eth_xtats_get_by_id(struct rte_eth_dev *dev, const uint64_t *ids,
 	return m;
 }
 
+/*
+ * Retrieve the values of all extended statistics of a port directly into a
+ * caller-provided flat array, without allocating an intermediate
+ * rte_eth_xstat array. Xstats ids are stable between port configurations,
+ * so collectors resolve names once and then scrape values only.
+ */
+static int
+eth_xstats_get_all_values(struct rte_eth_dev *dev, uint16_t port_id,
+	uint64_t *values, unsigned int expected_entries)
+{
+	struct rte_eth_xstat basic_xstats[RTE_NB_STATS +
+		RTE_ETHDEV_QUEUE_STAT_CNTRS *
+		(RTE_NB_RXQ_STATS + RTE_NB_TXQ_STATS)];
+	uint64_t ids_copy[ETH_XSTATS_ITER_NUM];
+	unsigned int basic_count, xcount, i, k, m, n;
+	int ret;
+
+	ret = eth_basic_stats_get(port_id, basic_xstats);
+	if (ret < 0)
+		return ret;
+	basic_count = (unsigned int)ret;
+
+	for (i = 0; i < basic_count; i++)
+		values[i] = basic_xstats[i].value;
+
+	/* the driver-specific stats follow the basic ones */
+	xcount = expected_entries - basic_count;
+	m = 0;
+	for (n = 0; n != xcount; n += k) {
+		k = RTE_MIN(xcount - n, (unsigned int)RTE_DIM(ids_copy));
+
+		for (i = 0; i < k; i++)
+			ids_copy[i] = n + i;
+
+		ret = dev->dev_ops->xstats_get_by_id(dev, ids_copy,
+				values + basic_count + m, k);
+		if (ret < 0)
+			return ret;
+		m += ret;
+	}
+
+	return (int)(basic_count + m);
+}
+
 /* retrieve ethdev extended statistics */
 RTE_EXPORT_SYMBOL(rte_eth_xstats_get_by_id)
 int
@@ -3777,6 +4097,18 @@ rte_eth_xstats_get_by_id(uint16_t port_id, const uint64_t *ids,
 	if (ids && !values)
 		return -EINVAL;
 
+	/* full value-only snapshot, no intermediate xstat array needed */
+	if (ids == NULL && dev->dev_ops->xstats_get_by_id != NULL) {
+		ret = eth_xstats_get_all_values(dev, port_id, values,
+				expected_entries);
+		if (ret < 0)
+			return ret;
+
+		rte_eth_trace_xstats_get_by_id(port_id, ids, values, size);
+
+		return expected_entries;
+	}
+
 	nb_basic_stats = 0;
 	if (ids != NULL) {
 		for (i = 0; i < size; i++)
@@ -5710,6 +6042,45 @@ int rte_eth_rx_avail_thresh_query(uint16_t port_id, uint16_t *queue_id,
 	return ret;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_eth_rx_queue_count_all, 25.07)
+int rte_eth_rx_queue_count_all(uint16_t port_id, int *counts, uint16_t size)
+{
+	struct rte_eth_dev *dev;
+	uint16_t nb_queues;
+	uint16_t queue_id;
+
+	RTE_ETH_VALID_PORTID_OR_ERR_RET(port_id, -ENODEV);
+	dev = &rte_eth_devices[port_id];
+
+	if (counts == NULL) {
+		RTE_ETHDEV_LOG_LINE(ERR,
+			"Cannot get port %u Rx queue counts to NULL",
+			port_id);
+		return -EINVAL;
+	}
+
+	nb_queues = dev->data->nb_rx_queues;
+	if (size < nb_queues) {
+		RTE_ETHDEV_LOG_LINE(ERR,
+			"Get Rx queue counts: port %u: array of size %u holds less than %u queues.",
+			port_id, size, nb_queues);
+		return -EINVAL;
+	}
+
+	if (rte_eth_fp_ops[port_id].rx_queue_count == NULL)
+		return -ENOTSUP;
+
+	for (queue_id = 0; queue_id < nb_queues; queue_id++) {
+		if (rte_eth_fp_ops[port_id].rxq.data[queue_id] == NULL)
+			counts[queue_id] = -EINVAL;
+		else
+			counts[queue_id] = rte_eth_rx_queue_count(port_id,
+								  queue_id);
+	}
+
+	return nb_queues;
+}
+
 RTE_INIT(eth_dev_init_fp_ops)
 {
 	uint32_t i;
@@ -5985,6 +6356,66 @@ rte_eth_dev_rx_intr_ctl_q(uint16_t port_id, uint16_t queue_id,
 	return 0;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_eth_rx_intr_ctl_q_add, 25.07)
+int
+rte_eth_rx_intr_ctl_q_add(uint16_t port_id, uint16_t queue_id, int epfd)
+{
+	uintptr_t data = ((uintptr_t)port_id << 16) | queue_id;
+
+	return rte_eth_dev_rx_intr_ctl_q(port_id, queue_id, epfd,
+			RTE_INTR_EVENT_ADD, (void *)data);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_eth_rx_intr_wait, 25.07)
+int
+rte_eth_rx_intr_wait(int epfd, struct rte_eth_rx_intr_event *events,
+		uint16_t nb_events, int timeout_ms)
+{
+	struct rte_epoll_event ep_events[RTE_ETH_RX_INTR_WAIT_MAX_EVENTS];
+	int nb_ready;
+	int i;
+
+	if (events == NULL || nb_events == 0)
+		return -EINVAL;
+	if (nb_events > RTE_ETH_RX_INTR_WAIT_MAX_EVENTS)
+		nb_events = RTE_ETH_RX_INTR_WAIT_MAX_EVENTS;
+
+	nb_ready = rte_epoll_wait(epfd, ep_events, nb_events, timeout_ms);
+	if (nb_ready < 0)
+		return nb_ready;
+
+	for (i = 0; i < nb_ready; i++) {
+		uintptr_t data = (uintptr_t)ep_events[i].epdata.data;
+
+		events[i].port_id = data >> 16;
+		events[i].queue_id = data & 0xffff;
+	}
+
+	return nb_ready;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_eth_rx_intr_enable_bulk, 25.07)
+int
+rte_eth_rx_intr_enable_bulk(const struct rte_eth_rx_intr_event *events,
+		uint16_t nb_events)
+{
+	int ret = 0;
+	uint16_t i;
+
+	if (events == NULL && nb_events != 0)
+		return -EINVAL;
+
+	for (i = 0; i < nb_events; i++) {
+		int rc = rte_eth_dev_rx_intr_enable(events[i].port_id,
+				events[i].queue_id);
+
+		if (rc != 0 && ret == 0)
+			ret = rc;
+	}
+
+	return ret;
+}
+
 RTE_EXPORT_SYMBOL(rte_eth_dev_rx_intr_enable)
 int
 rte_eth_dev_rx_intr_enable(uint16_t port_id,
@@ -6394,6 +6825,95 @@ rte_eth_recycle_rx_queue_info_get(uint16_t port_id, uint16_t queue_id,
 	return 0;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_eth_recycle_cache_init, 25.07)
+int
+rte_eth_recycle_cache_init(struct rte_eth_recycle_cache *cache, uint16_t size,
+		uint16_t rx_port_id, uint16_t rx_queue_id,
+		uint16_t tx_port_id, uint16_t tx_queue_id)
+{
+	struct rte_eth_recycle_rxq_info *rxq_info;
+	struct rte_eth_txq_info txq_info;
+	uint16_t tx_rs_thresh;
+	int ret;
+
+	RTE_ETH_VALID_PORTID_OR_ERR_RET(tx_port_id, -ENODEV);
+
+	if (cache == NULL) {
+		RTE_ETHDEV_LOG_LINE(ERR, "Cannot initialize NULL recycle cache");
+		return -EINVAL;
+	}
+
+	if (!rte_is_power_of_2(size)) {
+		RTE_ETHDEV_LOG_LINE(ERR,
+			"Recycle cache size %u is not a power of two", size);
+		return -EINVAL;
+	}
+
+	rxq_info = &cache->rxq_info;
+	ret = rte_eth_recycle_rx_queue_info_get(rx_port_id, rx_queue_id,
+			rxq_info);
+	if (ret != 0)
+		return ret;
+
+	if (rte_eth_fp_ops[rx_port_id].recycle_rx_descriptors_refill == NULL ||
+			rte_eth_fp_ops[tx_port_id].recycle_tx_mbufs_reuse == NULL)
+		return -ENOTSUP;
+
+	/* The masked index arithmetic of the inject stage and the chunked
+	 * refilling of the Rx driver rely on the Rx mbuf ring geometry.
+	 */
+	if (!rte_is_power_of_2(rxq_info->mbuf_ring_size) ||
+			(rxq_info->refill_requirement != 0 &&
+			rxq_info->mbuf_ring_size %
+			rxq_info->refill_requirement != 0)) {
+		RTE_ETHDEV_LOG_LINE(ERR,
+			"Rx queue_id=%u of port_id=%u has an unsupported mbuf ring geometry",
+			rx_queue_id, rx_port_id);
+		return -ENOTSUP;
+	}
+
+	if (rxq_info->refill_requirement >= size) {
+		RTE_ETHDEV_LOG_LINE(ERR,
+			"Recycle cache size %u cannot hold a refill chunk of %u mbufs",
+			size, rxq_info->refill_requirement);
+		return -EINVAL;
+	}
+
+	/* The Tx driver extracts tx_rs_thresh mbufs at a time and relies on
+	 * the cache ring not wrapping around within one extraction.
+	 */
+	ret = rte_eth_tx_queue_info_get(tx_port_id, tx_queue_id, &txq_info);
+	if (ret != 0 && ret != -ENOTSUP)
+		return ret;
+	tx_rs_thresh = ret == 0 ? txq_info.conf.tx_rs_thresh : 0;
+	if (tx_rs_thresh != 0 &&
+			(size % tx_rs_thresh != 0 || size < 2 * tx_rs_thresh)) {
+		RTE_ETHDEV_LOG_LINE(ERR,
+			"Recycle cache size %u does not fit Tx free threshold %u",
+			size, tx_rs_thresh);
+		return -EINVAL;
+	}
+
+	cache->size = size;
+	cache->head = 0;
+	cache->tail = size - 1;
+	cache->nb_mbufs = 0;
+
+	/* The Tx driver fills the cache ring as if it were the mbuf ring of
+	 * an Rx queue owning the whole free space, with no refill chunking.
+	 */
+	cache->cache_info = (struct rte_eth_recycle_rxq_info) {
+		.mbuf_ring = cache->mbuf_ring,
+		.mp = rxq_info->mp,
+		.refill_head = &cache->head,
+		.receive_tail = &cache->tail,
+		.mbuf_ring_size = size,
+		.refill_requirement = 0,
+	};
+
+	return 0;
+}
+
 RTE_EXPORT_SYMBOL(rte_eth_rx_burst_mode_get)
 int
 rte_eth_rx_burst_mode_get(uint16_t port_id, uint16_t queue_id,
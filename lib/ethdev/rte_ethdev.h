@@ -1176,8 +1176,29 @@ struct rte_eth_rxconf {
 	struct rte_mempool **rx_mempools;
 	uint16_t rx_nmempool; /** < Number of Rx mempools */
 
+	/**
+	 * Dedicated mempool cache for the Rx buffer refill path of this
+	 * queue, created with rte_mempool_cache_create().
+	 *
+	 * By default the refill path allocates through the per-lcore
+	 * cache of the mempool, which it shares with every other user
+	 * of the pool on that lcore; with Rx refill and Tx buffer free
+	 * running at diverging rates, the shared cache alternates
+	 * between spills and refills against the backing ring. A
+	 * dedicated cache keeps the refill traffic isolated.
+	 *
+	 * The cache must be used by this queue only and must remain
+	 * valid until the queue is released; flushing and freeing it
+	 * afterwards is the responsibility of the application.
+	 *
+	 * Supported when the driver advertises the
+	 * RTE_ETH_DEV_CAPA_RX_REFILL_CACHE capability, ignored with
+	 * multi-mempool configurations (rx_nmempool > 0).
+	 */
+	struct rte_mempool_cache *refill_cache;
+
 	uint64_t reserved_64s[2]; /**< Reserved for future fields */
-	void *reserved_ptrs[2];   /**< Reserved for future fields */
+	void *reserved_ptrs[1];   /**< Reserved for future fields */
 };
 
 /**
@@ -1197,8 +1218,20 @@ struct rte_eth_txconf {
 	 */
 	uint64_t offloads;
 
+	/**
+	 * Mbuf lease pool for this queue (optional, can be NULL).
+	 *
+	 * When set, the queue takes ownership of the pool: the application
+	 * leases Tx mbufs from it with rte_eth_tx_mbuf_alloc_bulk() and must
+	 * not send mbufs from other pools on this queue. As all mbufs of the
+	 * queue then come from one pool with a reference count of one,
+	 * RTE_ETH_TX_OFFLOAD_MBUF_FAST_FREE is enabled on the queue even
+	 * when it cannot be guaranteed port- or application-wide.
+	 */
+	struct rte_mempool *lease_pool;
+
 	uint64_t reserved_64s[2]; /**< Reserved for future fields */
-	void *reserved_ptrs[2];   /**< Reserved for future fields */
+	void *reserved_ptrs[1];   /**< Reserved for future fields */
 };
 
 /**
@@ -1668,6 +1701,18 @@ struct rte_eth_conf {
 #define RTE_ETH_DEV_CAPA_FLOW_RULE_KEEP         RTE_BIT64(3)
 /** Device supports keeping shared flow objects across restart. */
 #define RTE_ETH_DEV_CAPA_FLOW_SHARED_OBJECT_KEEP RTE_BIT64(4)
+/**
+ * Device supports polling Tx completions from a thread other than the
+ * one calling rte_eth_tx_burst() on the queue.
+ * @see rte_eth_tx_done_poll()
+ */
+#define RTE_ETH_DEV_CAPA_TX_DONE_POLL           RTE_BIT64(5)
+/**
+ * Device supports a dedicated Rx buffer refill cache per queue,
+ * passed through the refill_cache field of the Rx queue configuration.
+ * @see struct rte_eth_rxconf
+ */
+#define RTE_ETH_DEV_CAPA_RX_REFILL_CACHE        RTE_BIT64(6)
 /**@}*/
 
 /*
@@ -1913,6 +1958,37 @@ struct __rte_cache_min_aligned rte_eth_recycle_rxq_info {
 	uint16_t refill_requirement;
 };
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this structure may change without prior notice.
+ *
+ * Per-lcore cache of recycled mbufs.
+ * Used to decouple reusing mbufs from a Tx queue from refilling the mbuf
+ * ring of an Rx queue, when the two bursts are separated by intermediate
+ * pipeline stages and rte_eth_recycle_mbufs() cannot be used directly.
+ */
+struct __rte_cache_min_aligned rte_eth_recycle_cache {
+	/** View of the cache ring presented to the Tx driver. */
+	struct rte_eth_recycle_rxq_info cache_info;
+	/** Information of the Rx queue the cached mbufs are injected into. */
+	struct rte_eth_recycle_rxq_info rxq_info;
+	uint16_t size;     /**< Number of cache ring entries, power of two. */
+	uint16_t head;     /**< Index of the first free cache ring entry. */
+	uint16_t tail;     /**< Index of the last free cache ring entry. */
+	uint16_t nb_mbufs; /**< Number of cached mbufs. */
+	/** Cache ring of recycled mbufs, @p size entries. */
+	struct rte_mbuf *mbuf_ring[];
+};
+
+/**
+ * Calculate the size of the recycle cache.
+ *
+ * @param sz
+ *   Number of cache ring entries.
+ */
+#define RTE_ETH_RECYCLE_CACHE_SIZE(sz) \
+	(sizeof(struct rte_eth_recycle_cache) + (sz) * sizeof(struct rte_mbuf *))
+
 /* Generic Burst mode flag definition, values can be ORed. */
 
 /**
@@ -2489,6 +2565,39 @@ int rte_eth_rx_queue_setup(uint16_t port_id, uint16_t rx_queue_id,
 		const struct rte_eth_rxconf *rx_conf,
 		struct rte_mempool *mb_pool);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Resize the descriptor ring of a receive queue without stopping the port.
+ *
+ * The current queue configuration and mempool are preserved; only the ring
+ * size changes. The queue is drained and stopped, set up again with
+ * @p nb_rx_desc descriptors and restarted, while the other queues of the
+ * port keep running. On a running port this requires the
+ * RTE_ETH_DEV_CAPA_RUNTIME_RX_QUEUE_SETUP capability; drivers without it
+ * still need a full port stop to resize a ring.
+ *
+ * If setting up the queue with the new ring size fails, an attempt is made
+ * to restore the previous size before returning the error.
+ *
+ * @param port_id
+ *   The port identifier of the Ethernet device.
+ * @param rx_queue_id
+ *   The index of the receive queue to reconfigure.
+ * @param nb_rx_desc
+ *   The new number of receive descriptors. 0 means the driver default.
+ * @return
+ *   - 0: Success, the queue uses the new ring size.
+ *   - (-ENODEV) if @p port_id is invalid.
+ *   - (-EINVAL) if @p rx_queue_id is invalid or the queue is not set up.
+ *   - (-ENOTSUP) if the device cannot set up a queue at runtime.
+ *   - Negative error code from queue stop, setup or start otherwise.
+ */
+__rte_experimental
+int rte_eth_rx_queue_reconfigure(uint16_t port_id, uint16_t rx_queue_id,
+		uint16_t nb_rx_desc);
+
 /**
  * @warning
  * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
@@ -2573,6 +2682,104 @@ int rte_eth_tx_queue_setup(uint16_t port_id, uint16_t tx_queue_id,
 		uint16_t nb_tx_desc, unsigned int socket_id,
 		const struct rte_eth_txconf *tx_conf);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Resize the descriptor ring of a transmit queue without stopping the port.
+ *
+ * The current queue configuration is preserved; only the ring size changes.
+ * The queue is drained and stopped, set up again with @p nb_tx_desc
+ * descriptors and restarted, while the other queues of the port keep
+ * running. On a running port this requires the
+ * RTE_ETH_DEV_CAPA_RUNTIME_TX_QUEUE_SETUP capability; drivers without it
+ * still need a full port stop to resize a ring.
+ *
+ * If setting up the queue with the new ring size fails, an attempt is made
+ * to restore the previous size before returning the error.
+ *
+ * @param port_id
+ *   The port identifier of the Ethernet device.
+ * @param tx_queue_id
+ *   The index of the transmit queue to reconfigure.
+ * @param nb_tx_desc
+ *   The new number of transmit descriptors. 0 means the driver default.
+ * @return
+ *   - 0: Success, the queue uses the new ring size.
+ *   - (-ENODEV) if @p port_id is invalid.
+ *   - (-EINVAL) if @p tx_queue_id is invalid or the queue is not set up.
+ *   - (-ENOTSUP) if the device cannot set up a queue at runtime.
+ *   - Negative error code from queue stop, setup or start otherwise.
+ */
+__rte_experimental
+int rte_eth_tx_queue_reconfigure(uint16_t port_id, uint16_t tx_queue_id,
+		uint16_t nb_tx_desc);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Lease a bulk of Tx mbufs from the pool owned by a transmit queue.
+ *
+ * The queue must have been set up with a lease pool
+ * (@see rte_eth_txconf::lease_pool). Mbufs sent on the queue must be
+ * allocated with this function and must not be referenced elsewhere when
+ * transmitted, so that the driver can free them with the mbuf fast free
+ * path.
+ *
+ * @param port_id
+ *   The port identifier of the Ethernet device.
+ * @param queue_id
+ *   The index of the transmit queue owning the lease pool.
+ * @param tx_pkts
+ *   The address of an array where to store pointers to the allocated mbufs.
+ * @param nb_pkts
+ *   The number of mbufs to allocate.
+ * @return
+ *   - 0: Success, @p nb_pkts mbufs were allocated.
+ *   - (-ENODEV) if @p port_id is invalid.
+ *   - (-EINVAL) if @p queue_id is invalid.
+ *   - (-ENOTSUP) if the queue has no lease pool.
+ *   - (-ENOENT) if the lease pool is exhausted.
+ */
+__rte_experimental
+int rte_eth_tx_mbuf_alloc_bulk(uint16_t port_id, uint16_t queue_id,
+		struct rte_mbuf **tx_pkts, uint16_t nb_pkts);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Check a burst of packets against the lease contract of a transmit queue.
+ *
+ * A packet violates the lease when it does not come from the queue lease
+ * pool, is referenced more than once, or carries a clone or external
+ * buffer: such an mbuf is not safe to free through the mbuf fast free
+ * path. Detected violations are added to a per-queue counter reported by
+ * the "/ethdev/tx_lease" telemetry command.
+ *
+ * This is a diagnostic helper: it is not called from the transmit path,
+ * where the per-packet checks would defeat the purpose of fast free.
+ * A typical use is from a Tx callback in debug deployments.
+ *
+ * @param port_id
+ *   The port identifier of the Ethernet device.
+ * @param queue_id
+ *   The index of the transmit queue owning the lease pool.
+ * @param tx_pkts
+ *   The burst of packets about to be sent on the queue.
+ * @param nb_pkts
+ *   The number of packets in the burst.
+ * @return
+ *   - >= 0: The number of packets violating the lease.
+ *   - (-ENODEV) if @p port_id is invalid.
+ *   - (-EINVAL) if @p queue_id is invalid.
+ *   - (-ENOTSUP) if the queue has no lease pool.
+ */
+__rte_experimental
+int rte_eth_tx_lease_audit(uint16_t port_id, uint16_t queue_id,
+		struct rte_mbuf **tx_pkts, uint16_t nb_pkts);
+
 /**
  * @warning
  * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
@@ -3862,6 +4069,36 @@ __rte_experimental
 int rte_eth_rx_avail_thresh_query(uint16_t port_id, uint16_t *queue_id,
 				 uint8_t *avail_thresh);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Get the number of used descriptors of all Rx queues of a port
+ * in a single call.
+ *
+ * Intended for congestion monitoring across many queues, e.g. combined
+ * with RTE_ETH_EVENT_RX_AVAIL_THRESH, where calling
+ * rte_eth_rx_queue_count() per queue does not scale.
+ *
+ * @param port_id
+ *  The port identifier of the Ethernet device.
+ * @param[out] counts
+ *  Array to store the number of used descriptors, indexed by Rx queue ID.
+ *  Entries of queues for which the count cannot be obtained are set to
+ *  a negative errno value (-EINVAL or -ENOTSUP).
+ * @param size
+ *  Number of entries in @p counts.
+ *  Must be at least the number of configured Rx queues.
+ *
+ * @return
+ *   - Number of Rx queues of the port if successful.
+ *   - (-ENODEV) if @p port_id is invalid.
+ *   - (-EINVAL) if @p counts is NULL or @p size is too small.
+ *   - (-ENOTSUP) if the driver does not report used descriptor counts.
+ */
+__rte_experimental
+int rte_eth_rx_queue_count_all(uint16_t port_id, int *counts, uint16_t size);
+
 typedef void (*buffer_tx_error_fn)(struct rte_mbuf **unsent, uint16_t count,
 		void *userdata);
 
@@ -4009,6 +4246,50 @@ rte_eth_tx_buffer_count_callback(struct rte_mbuf **pkts, uint16_t unsent,
 int
 rte_eth_tx_done_cleanup(uint16_t port_id, uint16_t queue_id, uint32_t free_cnt);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Reclaim completed Tx descriptors of a queue and return the freed mbufs
+ * to the caller instead of their pools.
+ *
+ * Unlike rte_eth_tx_done_cleanup(), which is a hint processed inside the
+ * transmit path, this function performs the descriptor cleanup itself, so
+ * a housekeeping or service core can take over completion processing and
+ * the enqueueing lcore never stalls on it. The caller becomes the owner
+ * of the returned mbufs and typically frees them in bulk or reuses them
+ * for further transmissions.
+ *
+ * It must only be called concurrently with rte_eth_tx_burst() on the same
+ * queue when the driver advertises RTE_ETH_DEV_CAPA_TX_DONE_POLL;
+ * otherwise the caller has to provide its own serialization with the
+ * transmitting lcore.
+ *
+ * @param port_id
+ *   The port identifier of the Ethernet device.
+ * @param queue_id
+ *   The index of the transmit queue to reclaim completions from.
+ *   The value must be in the range [0, nb_tx_queue - 1] previously supplied
+ *   to rte_eth_dev_configure().
+ * @param pkts
+ *   The address of an array where to store pointers to the reclaimed mbufs.
+ * @param nb_pkts
+ *   The maximum number of mbufs to reclaim.
+ * @return
+ *   Failure: < 0
+ *     -ENODEV: Invalid interface
+ *     -EINVAL: @p pkts is NULL while @p nb_pkts is not zero
+ *     -EIO: device is removed
+ *     -ENOTSUP: Driver does not support function
+ *   Success: >= 0
+ *     0-n: Number of mbufs reclaimed and stored in @p pkts. More completed
+ *     descriptors may still remain in the ring.
+ */
+__rte_experimental
+int
+rte_eth_tx_done_poll(uint16_t port_id, uint16_t queue_id,
+		struct rte_mbuf **pkts, uint16_t nb_pkts);
+
 /**
  * Subtypes for MACsec offload event (@ref RTE_ETH_EVENT_MACSEC)
  * raised by Ethernet device.
@@ -4399,6 +4680,95 @@ int rte_eth_dev_rx_intr_ctl_q(uint16_t port_id, uint16_t queue_id,
 int
 rte_eth_dev_rx_intr_ctl_q_get_fd(uint16_t port_id, uint16_t queue_id);
 
+/** Ready queue reported by rte_eth_rx_intr_wait(). */
+struct rte_eth_rx_intr_event {
+	uint16_t port_id;  /**< Port of the ready Rx queue. */
+	uint16_t queue_id; /**< Index of the ready Rx queue. */
+};
+
+/** Maximum number of events one rte_eth_rx_intr_wait() call returns. */
+#define RTE_ETH_RX_INTR_WAIT_MAX_EVENTS 64
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Register an Rx queue interrupt with an epoll instance for batched
+ * collection through rte_eth_rx_intr_wait().
+ *
+ * This is rte_eth_dev_rx_intr_ctl_q() with RTE_INTR_EVENT_ADD and the
+ * (port, queue) pair as event data, so the wait helper can decode which
+ * queues are ready.
+ *
+ * @param port_id
+ *   The port identifier of the Ethernet device.
+ * @param queue_id
+ *   The index of the receive queue.
+ * @param epfd
+ *   Epoll instance fd to register with.
+ *   Using RTE_EPOLL_PER_THREAD allows to use per thread epoll instance.
+ * @return
+ *   - On success, zero.
+ *   - On failure, a negative value.
+ */
+__rte_experimental
+int rte_eth_rx_intr_ctl_q_add(uint16_t port_id, uint16_t queue_id, int epfd);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Wait for Rx queue interrupts and collect all ready queues in one wake.
+ *
+ * A single call returns every (port, queue) pair with a pending
+ * interrupt, up to RTE_ETH_RX_INTR_WAIT_MAX_EVENTS per call, so a wake
+ * after idle can service all queues in one pass instead of taking one
+ * wake per queue. Only queues registered with
+ * rte_eth_rx_intr_ctl_q_add() are decoded.
+ *
+ * The usual cycle is: disable interrupts-free polling, wait here, poll
+ * every returned queue until empty, then re-arm them together with
+ * rte_eth_rx_intr_enable_bulk().
+ *
+ * @param epfd
+ *   Epoll instance fd the queues are registered with.
+ *   Using RTE_EPOLL_PER_THREAD allows to use per thread epoll instance.
+ * @param events
+ *   Array of at least @p nb_events entries filled with the ready queues.
+ * @param nb_events
+ *   Maximum number of events to return.
+ * @param timeout_ms
+ *   Timeout in milliseconds, -1 to wait indefinitely.
+ * @return
+ *   - The number of ready queues stored in @p events.
+ *   - A negative value on error.
+ */
+__rte_experimental
+int rte_eth_rx_intr_wait(int epfd, struct rte_eth_rx_intr_event *events,
+		uint16_t nb_events, int timeout_ms);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Re-enable the Rx interrupt of a batch of queues.
+ *
+ * Typically called with the array filled by rte_eth_rx_intr_wait() once
+ * all returned queues have been polled empty. All queues are re-armed
+ * even when one of them fails.
+ *
+ * @param events
+ *   Array of (port, queue) pairs to re-arm.
+ * @param nb_events
+ *   Number of entries in @p events.
+ * @return
+ *   - 0 when every queue was re-armed.
+ *   - The first error returned by rte_eth_dev_rx_intr_enable() otherwise.
+ */
+__rte_experimental
+int rte_eth_rx_intr_enable_bulk(const struct rte_eth_rx_intr_event *events,
+		uint16_t nb_events);
+
 /**
  * Turn on the LED on the Ethernet device.
  * This function turns on the LED on the Ethernet device.
@@ -5144,6 +5514,53 @@ int rte_eth_recycle_rx_queue_info_get(uint16_t port_id,
 		uint16_t queue_id,
 		struct rte_eth_recycle_rxq_info *recycle_rxq_info);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Initialize a recycle cache feeding the given Rx queue with mbufs
+ * recycled from the given Tx queue.
+ *
+ * The conformance of the queue pair for mbuf recycling is checked here,
+ * once, so that rte_eth_recycle_tx_mbufs_extract() and
+ * rte_eth_recycle_rx_mbufs_inject() stay free of per-burst checks.
+ * The Tx queue must still only carry mbufs suitable for the Rx queue
+ * mempool; unsuitable mbufs are detected by the driver and freed
+ * through the mempool instead of being cached.
+ *
+ * The caller must allocate the cache with a memory size of at least
+ * RTE_ETH_RECYCLE_CACHE_SIZE(@p size) bytes. The cache must not be
+ * relocated after initialization, since the Tx driver keeps pointers
+ * into it.
+ *
+ * @param cache
+ *   The recycle cache to be initialized.
+ * @param size
+ *   Number of cache ring entries. Must be a power of two, a multiple of
+ *   the Tx free threshold of the transmit queue and at least twice that
+ *   threshold. The cache holds at most @p size - 1 mbufs.
+ * @param rx_port_id
+ *   Port identifying the receive side.
+ * @param rx_queue_id
+ *   The index of the receive queue identifying the receive side.
+ * @param tx_port_id
+ *   Port identifying the transmit side.
+ * @param tx_queue_id
+ *   The index of the transmit queue identifying the transmit side.
+ * @return
+ *   - 0: Success
+ *   - -ENODEV:  If *rx_port_id* or *tx_port_id* is invalid.
+ *   - -ENOTSUP: The Rx or Tx driver does not support mbuf recycling,
+ *               or the Rx queue geometry cannot be cached.
+ *   - -EINVAL:  The queue_id is out of range, or @p cache is NULL,
+ *               or @p size does not meet the constraints above.
+ */
+__rte_experimental
+int rte_eth_recycle_cache_init(struct rte_eth_recycle_cache *cache,
+		uint16_t size,
+		uint16_t rx_port_id, uint16_t rx_queue_id,
+		uint16_t tx_port_id, uint16_t tx_queue_id);
+
 /**
  * Retrieve information about the Rx packet burst mode.
  *
@@ -6332,7 +6749,11 @@ rte_eth_rx_burst(uint16_t port_id, uint16_t queue_id,
 	}
 #endif
 
-	nb_rx = p->rx_pkt_burst(qd, rx_pkts, nb_pkts);
+	/* a PMD may provide a receive function specialized per queue */
+	if (p->rx_queue_burst != NULL)
+		nb_rx = p->rx_queue_burst[queue_id](qd, rx_pkts, nb_pkts);
+	else
+		nb_rx = p->rx_pkt_burst(qd, rx_pkts, nb_pkts);
 
 #ifdef RTE_ETHDEV_RXTX_CALLBACKS
 	{
@@ -6479,6 +6900,268 @@ rte_eth_rx_descriptor_status(uint16_t port_id, uint16_t queue_id,
 	return p->rx_descriptor_status(qd, offset);
 }
 
+/**
+ * A (port, queue) pair designating one Rx queue for rte_eth_rx_burst_multi().
+ */
+struct rte_eth_rxq_id {
+	uint16_t port_id;  /**< The port identifier of the Ethernet device. */
+	uint16_t queue_id; /**< The index of the receive queue on the port. */
+};
+
+/**
+ * Maximum number of Rx queues passed to a PMD multi-queue receive function
+ * in one call; longer runs of queues on the same port are split.
+ */
+#define RTE_ETH_RX_BURST_MULTI_MAX 8
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Retrieve a burst of input packets from multiple receive queues of one or
+ * more Ethernet devices.
+ *
+ * The queues are polled in the order given in the @p queues array and the
+ * retrieved packets are stored back to back in the @p rx_pkts array, so a
+ * queue is only guaranteed to be polled when the preceding queues did not
+ * fill the array. Size @p nb_pkts for the expected aggregate burst when all
+ * queues must be served on every call.
+ *
+ * Compared with calling rte_eth_rx_burst() per queue in a round-robin loop,
+ * this function avoids most of the per-queue PMD entry cost when queues are
+ * empty, which dominates the receive path at low load:
+ *
+ * - When a driver provides a multi-queue receive function, consecutive
+ *   queues of the same port are passed to the PMD in one call, letting it
+ *   check descriptor status for all of them before committing to a full
+ *   burst receive on any.
+ *
+ * - Otherwise, the status of the next Rx descriptor is peeked via the
+ *   driver descriptor status callback, and the receive function is only
+ *   entered when it reports a completed descriptor.
+ *
+ * Queues with an installed Rx callback always go through the full
+ * single-queue receive path, as callbacks run on empty polls too.
+ *
+ * @param queues
+ *   The array of (port, queue) pairs to retrieve input packets from.
+ * @param nb_queues
+ *   The number of elements in the @p queues array.
+ * @param rx_pkts
+ *   The address of an array of pointers to *rte_mbuf* structures that
+ *   must be large enough to store *nb_pkts* pointers in it.
+ * @param nb_pkts
+ *   The maximum total number of packets to retrieve across all queues.
+ * @return
+ *   The number of packets actually retrieved, which is the number
+ *   of pointers to *rte_mbuf* structures effectively supplied to the
+ *   *rx_pkts* array.
+ */
+__rte_experimental
+static inline uint16_t
+rte_eth_rx_burst_multi(const struct rte_eth_rxq_id *queues, uint16_t nb_queues,
+		struct rte_mbuf **rx_pkts, const uint16_t nb_pkts)
+{
+	uint16_t nb_rx = 0;
+	uint16_t i = 0;
+
+	while (i < nb_queues && nb_rx < nb_pkts) {
+		uint16_t port_id = queues[i].port_id;
+		uint16_t queue_id = queues[i].queue_id;
+		struct rte_eth_fp_ops *p;
+		void *cb = NULL;
+		void *qd;
+		uint16_t n;
+
+#ifdef RTE_ETHDEV_DEBUG_RX
+		if (port_id >= RTE_MAX_ETHPORTS ||
+				queue_id >= RTE_MAX_QUEUES_PER_PORT) {
+			RTE_ETHDEV_LOG_LINE(ERR,
+				"Invalid port_id=%u or queue_id=%u",
+				port_id, queue_id);
+			i++;
+			continue;
+		}
+#endif
+
+		/* fetch pointer to queue data */
+		p = &rte_eth_fp_ops[port_id];
+		qd = p->rxq.data[queue_id];
+
+#ifdef RTE_ETHDEV_DEBUG_RX
+		if (!rte_eth_dev_is_valid_port(port_id) || qd == NULL) {
+			RTE_ETHDEV_LOG_LINE(ERR,
+				"Invalid Rx queue_id=%u for port_id=%u",
+				queue_id, port_id);
+			i++;
+			continue;
+		}
+#endif
+
+		if (p->rx_pkt_burst_multi != NULL && i + 1 < nb_queues &&
+				queues[i + 1].port_id == port_id) {
+			void *qds[RTE_ETH_RX_BURST_MULTI_MAX];
+			uint16_t nb_rxq[RTE_ETH_RX_BURST_MULTI_MAX];
+			uint16_t nq, j, off;
+
+			/* gather the run of queues on the same port */
+			for (nq = 0; nq < RTE_DIM(qds) &&
+					i + nq < nb_queues &&
+					queues[i + nq].port_id == port_id;
+					nq++) {
+				uint16_t qid = queues[i + nq].queue_id;
+
+#ifdef RTE_ETHDEV_DEBUG_RX
+				if (qid >= RTE_MAX_QUEUES_PER_PORT ||
+						p->rxq.data[qid] == NULL)
+					break;
+#endif
+#ifdef RTE_ETHDEV_RXTX_CALLBACKS
+				/* queues with Rx callbacks go through the
+				 * single-queue path below
+				 */
+				if (rte_atomic_load_explicit(
+						&p->rxq.clbk[qid],
+						rte_memory_order_relaxed) != NULL)
+					break;
+#endif
+				qds[nq] = p->rxq.data[qid];
+			}
+
+			if (nq > 1) {
+				n = p->rx_pkt_burst_multi(qds, nq,
+						rx_pkts + nb_rx,
+						nb_pkts - nb_rx, nb_rxq);
+				off = nb_rx;
+				for (j = 0; j < nq; j++) {
+					uint16_t qid = queues[i + j].queue_id;
+
+					if (unlikely(nb_rxq[j]))
+						rte_ethdev_trace_rx_burst_nonempty(
+							port_id, qid,
+							(void **)(rx_pkts + off),
+							nb_rxq[j]);
+					else
+						rte_ethdev_trace_rx_burst_empty(
+							port_id, qid,
+							(void **)(rx_pkts + off));
+					off += nb_rxq[j];
+				}
+				nb_rx += n;
+				i += nq;
+				continue;
+			}
+		}
+
+#ifdef RTE_ETHDEV_RXTX_CALLBACKS
+		cb = rte_atomic_load_explicit(&p->rxq.clbk[queue_id],
+				rte_memory_order_relaxed);
+#endif
+
+		/* Peek at the ring before committing to the full PMD receive
+		 * path. Skipped when a callback is installed, as callbacks
+		 * run on empty polls too.
+		 */
+		if (cb == NULL && p->rx_descriptor_status != NULL &&
+				p->rx_descriptor_status(qd, 0) !=
+					RTE_ETH_RX_DESC_DONE) {
+			rte_ethdev_trace_rx_burst_empty(port_id, queue_id,
+					(void **)(rx_pkts + nb_rx));
+			i++;
+			continue;
+		}
+
+		n = p->rx_pkt_burst(qd, rx_pkts + nb_rx, nb_pkts - nb_rx);
+
+#ifdef RTE_ETHDEV_RXTX_CALLBACKS
+		if (unlikely(cb != NULL))
+			n = rte_eth_call_rx_callbacks(port_id, queue_id,
+					rx_pkts + nb_rx, n, nb_pkts - nb_rx,
+					cb);
+#endif
+
+		if (unlikely(n))
+			rte_ethdev_trace_rx_burst_nonempty(port_id, queue_id,
+					(void **)(rx_pkts + nb_rx), n);
+		else
+			rte_ethdev_trace_rx_burst_empty(port_id, queue_id,
+					(void **)(rx_pkts + nb_rx));
+		nb_rx += n;
+		i++;
+	}
+
+	return nb_rx;
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Retrieve a burst of input packets and classify the burst as a whole.
+ *
+ * This works like rte_eth_rx_burst() and additionally accumulates the
+ * packet types of the received packets into two masks:
+ *
+ * - @p ptype_and is the bitwise AND of the mbuf packet_type fields, so a
+ *   layer is set in it only when every packet of the burst carries it
+ *   (e.g. (*ptype_and & RTE_PTYPE_L3_MASK) == RTE_PTYPE_L3_IPV4 means the
+ *   whole burst is plain IPv4 and an application can take a burst-wide
+ *   fast path without touching the packet headers);
+ * - @p ptype_or is the bitwise OR, so a layer is set in it when any
+ *   packet of the burst carries it (e.g. *ptype_or & RTE_PTYPE_L4_FRAG
+ *   or *ptype_or & RTE_PTYPE_TUNNEL_MASK flag bursts that need the slow
+ *   path for fragments or tunnels).
+ *
+ * The masks are computed from the packet types just written by the
+ * driver while the mbufs are still cache hot, in one branch-free pass.
+ * They are only meaningful when the driver fills mbuf->packet_type for
+ * the layers of interest: check rte_eth_dev_get_supported_ptypes() and
+ * enable them with rte_eth_dev_set_ptypes().
+ *
+ * An empty burst yields 0 in both masks.
+ *
+ * @param port_id
+ *   The port identifier of the Ethernet device.
+ * @param queue_id
+ *   The index of the receive queue from which to retrieve input packets.
+ * @param rx_pkts
+ *   The address of an array of pointers to *rte_mbuf* structures that
+ *   must be large enough to store *nb_pkts* pointers in it.
+ * @param nb_pkts
+ *   The maximum number of packets to retrieve.
+ * @param ptype_and
+ *   Where to store the AND-accumulated packet type mask of the burst.
+ * @param ptype_or
+ *   Where to store the OR-accumulated packet type mask of the burst.
+ * @return
+ *   The number of packets actually retrieved.
+ */
+__rte_experimental
+static inline uint16_t
+rte_eth_rx_burst_ptype(uint16_t port_id, uint16_t queue_id,
+		struct rte_mbuf **rx_pkts, const uint16_t nb_pkts,
+		uint32_t *ptype_and, uint32_t *ptype_or)
+{
+	uint32_t pt_and = UINT32_MAX;
+	uint32_t pt_or = 0;
+	uint16_t nb_rx;
+	uint16_t i;
+
+	nb_rx = rte_eth_rx_burst(port_id, queue_id, rx_pkts, nb_pkts);
+
+	for (i = 0; i < nb_rx; i++) {
+		uint32_t ptype = rx_pkts[i]->packet_type;
+
+		pt_and &= ptype;
+		pt_or |= ptype;
+	}
+
+	*ptype_and = nb_rx != 0 ? pt_and : 0;
+	*ptype_or = pt_or;
+
+	return nb_rx;
+}
+
 /**@{@name Tx hardware descriptor states
  * @see rte_eth_tx_descriptor_status
  */
@@ -6692,7 +7375,11 @@ rte_eth_tx_burst(uint16_t port_id, uint16_t queue_id,
 	}
 #endif
 
-	nb_pkts = p->tx_pkt_burst(qd, tx_pkts, nb_pkts);
+	/* a PMD may provide a transmit function specialized per queue */
+	if (p->tx_queue_burst != NULL)
+		nb_pkts = p->tx_queue_burst[queue_id](qd, tx_pkts, nb_pkts);
+	else
+		nb_pkts = p->tx_pkt_burst(qd, tx_pkts, nb_pkts);
 
 	rte_ethdev_trace_tx_burst(port_id, queue_id, (void **)tx_pkts, nb_pkts);
 	return nb_pkts;
@@ -7033,6 +7720,189 @@ rte_eth_recycle_mbufs(uint16_t rx_port_id, uint16_t rx_queue_id,
 	return nb_mbufs;
 }
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Extract used mbufs from a transmit queue of an Ethernet device into a
+ * recycle cache.
+ *
+ * Together with rte_eth_recycle_rx_mbufs_inject(), this generalizes
+ * rte_eth_recycle_mbufs() to pipelines where intermediate stages run
+ * between the Rx and Tx bursts of the recycling port pair: used mbufs are
+ * extracted whenever the transmit queue has completed transmissions and
+ * are held in the cache until the receive queue asks for a refill.
+ *
+ * The cache must have been initialized for this transmit queue with
+ * rte_eth_recycle_cache_init(), which performs all conformance checks.
+ * Extraction and injection on the same cache must be done from the same
+ * thread, in order to avoid memory error rewriting.
+ *
+ * @param tx_port_id
+ *   Port identifying the transmit side.
+ * @param tx_queue_id
+ *   The index of the transmit queue identifying the transmit side.
+ *   The value must be in the range [0, nb_tx_queue - 1] previously supplied
+ *   to rte_eth_dev_configure().
+ * @param cache
+ *   A pointer to an initialized structure of type *rte_eth_recycle_cache*
+ *   which holds the recycled mbufs.
+ * @return
+ *   The number of mbufs moved into the cache.
+ */
+__rte_experimental
+static inline uint16_t
+rte_eth_recycle_tx_mbufs_extract(uint16_t tx_port_id, uint16_t tx_queue_id,
+		struct rte_eth_recycle_cache *cache)
+{
+	struct rte_eth_fp_ops *p;
+	void *qd;
+	uint16_t nb_mbufs;
+
+#ifdef RTE_ETHDEV_DEBUG_TX
+	if (tx_port_id >= RTE_MAX_ETHPORTS ||
+			tx_queue_id >= RTE_MAX_QUEUES_PER_PORT) {
+		RTE_ETHDEV_LOG_LINE(ERR,
+				"Invalid tx_port_id=%u or tx_queue_id=%u",
+				tx_port_id, tx_queue_id);
+		return 0;
+	}
+#endif
+
+	/* fetch pointer to Tx queue data */
+	p = &rte_eth_fp_ops[tx_port_id];
+	qd = p->txq.data[tx_queue_id];
+
+#ifdef RTE_ETHDEV_DEBUG_TX
+	RTE_ETH_VALID_PORTID_OR_ERR_RET(tx_port_id, 0);
+
+	if (qd == NULL) {
+		RTE_ETHDEV_LOG_LINE(ERR, "Invalid Tx queue_id=%u for port_id=%u",
+				tx_queue_id, tx_port_id);
+		return 0;
+	}
+#endif
+	if (p->recycle_tx_mbufs_reuse == NULL)
+		return 0;
+
+	/* The Tx driver sees the cache ring as the mbuf ring of an Rx queue
+	 * and copies used mbuf pointers to the free entries behind the cache
+	 * head.
+	 */
+	nb_mbufs = p->recycle_tx_mbufs_reuse(qd, &cache->cache_info);
+	if (nb_mbufs == 0)
+		return 0;
+
+	cache->head = (cache->head + nb_mbufs) & (cache->size - 1);
+	cache->nb_mbufs += nb_mbufs;
+
+	return nb_mbufs;
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Inject mbufs from a recycle cache into the mbuf ring of a receive queue
+ * of an Ethernet device, and replenish its descriptors.
+ *
+ * The receive queue may belong to a different port than the transmit
+ * queue the cache is extracted from.
+ * @see rte_eth_recycle_tx_mbufs_extract
+ *
+ * The cache must have been initialized for this receive queue with
+ * rte_eth_recycle_cache_init(), which performs all conformance checks.
+ * Extraction and injection on the same cache must be done from the same
+ * thread, in order to avoid memory error rewriting.
+ *
+ * @param rx_port_id
+ *   Port identifying the receive side.
+ * @param rx_queue_id
+ *   The index of the receive queue identifying the receive side.
+ *   The value must be in the range [0, nb_rx_queue - 1] previously supplied
+ *   to rte_eth_dev_configure().
+ * @param cache
+ *   A pointer to an initialized structure of type *rte_eth_recycle_cache*
+ *   which holds the recycled mbufs.
+ * @return
+ *   The number of mbufs moved into the Rx mbuf ring.
+ */
+__rte_experimental
+static inline uint16_t
+rte_eth_recycle_rx_mbufs_inject(uint16_t rx_port_id, uint16_t rx_queue_id,
+		struct rte_eth_recycle_cache *cache)
+{
+	struct rte_eth_recycle_rxq_info *rxq_info = &cache->rxq_info;
+	const uint16_t mask = cache->size - 1;
+	const uint16_t rx_mask = rxq_info->mbuf_ring_size - 1;
+	uint16_t refill_head, avail, nb_mbufs, read, i;
+	struct rte_eth_fp_ops *p;
+	struct rte_mbuf **rxep;
+	void *qd;
+
+#ifdef RTE_ETHDEV_DEBUG_RX
+	if (rx_port_id >= RTE_MAX_ETHPORTS ||
+			rx_queue_id >= RTE_MAX_QUEUES_PER_PORT) {
+		RTE_ETHDEV_LOG_LINE(ERR, "Invalid rx_port_id=%u or rx_queue_id=%u",
+				rx_port_id, rx_queue_id);
+		return 0;
+	}
+#endif
+
+	/* fetch pointer to Rx queue data */
+	p = &rte_eth_fp_ops[rx_port_id];
+	qd = p->rxq.data[rx_queue_id];
+
+#ifdef RTE_ETHDEV_DEBUG_RX
+	RTE_ETH_VALID_PORTID_OR_ERR_RET(rx_port_id, 0);
+
+	if (qd == NULL) {
+		RTE_ETHDEV_LOG_LINE(ERR, "Invalid Rx queue_id=%u for port_id=%u",
+				rx_queue_id, rx_port_id);
+		return 0;
+	}
+#endif
+	if (p->recycle_rx_descriptors_refill == NULL)
+		return 0;
+
+	refill_head = *rxq_info->refill_head;
+	avail = (*rxq_info->receive_tail - refill_head) & rx_mask;
+
+	nb_mbufs = cache->nb_mbufs;
+	if (rxq_info->refill_requirement != 0) {
+		/* The Rx driver refills in fixed chunks aligned with its
+		 * mbuf ring size.
+		 */
+		if (nb_mbufs < rxq_info->refill_requirement ||
+				avail < rxq_info->refill_requirement)
+			return 0;
+		nb_mbufs = rxq_info->refill_requirement;
+	} else {
+		/* The Rx mbuf ring must be refilled without wrapping around. */
+		nb_mbufs = RTE_MIN(nb_mbufs, avail);
+		nb_mbufs = RTE_MIN(nb_mbufs,
+			(uint16_t)(rxq_info->mbuf_ring_size - refill_head));
+		if (nb_mbufs == 0)
+			return 0;
+	}
+
+	/* Copy the oldest cached mbufs behind the refill head of the
+	 * Rx mbuf ring.
+	 */
+	rxep = rxq_info->mbuf_ring + refill_head;
+	read = (cache->tail + 1) & mask;
+	for (i = 0; i < nb_mbufs; i++)
+		rxep[i] = cache->mbuf_ring[(read + i) & mask];
+
+	cache->tail = (cache->tail + nb_mbufs) & mask;
+	cache->nb_mbufs -= nb_mbufs;
+
+	/* Replenish the Rx descriptors with the injected mbufs. */
+	p->recycle_rx_descriptors_refill(qd, nb_mbufs);
+
+	return nb_mbufs;
+}
+
 /**
  * @warning
  * @b EXPERIMENTAL: this API may change without prior notice
@@ -29,6 +29,18 @@ typedef uint16_t (*eth_rx_burst_t)(void *rxq,
 				   struct rte_mbuf **rx_pkts,
 				   uint16_t nb_pkts);
 
+/**
+ * @internal Retrieve input packets from multiple receive queues of an
+ * Ethernet device in one pass, so that the driver can check descriptor
+ * status for all queues before committing to a full burst receive.
+ * The number of packets read from queue i is stored in nb_rxq[i],
+ * the return value is the sum of these counts.
+ */
+typedef uint16_t (*eth_rx_burst_multi_t)(void **rxqs, uint16_t nb_queues,
+					 struct rte_mbuf **rx_pkts,
+					 uint16_t nb_pkts,
+					 uint16_t *nb_rxq);
+
 /**
  * @internal Send output packets on a transmit queue of an Ethernet device.
  */
@@ -101,7 +113,13 @@ struct __rte_cache_aligned rte_eth_fp_ops {
 	eth_rx_descriptor_status_t rx_descriptor_status;
 	/** Refill Rx descriptors with the recycling mbufs. */
 	eth_recycle_rx_descriptors_refill_t recycle_rx_descriptors_refill;
-	uintptr_t reserved1[2];
+	/** PMD multi-queue receive function. */
+	eth_rx_burst_multi_t rx_pkt_burst_multi;
+	/**
+	 * Per-queue PMD receive functions, indexed by queue id.
+	 * NULL when the PMD uses one receive function for all queues.
+	 */
+	const eth_rx_burst_t *rx_queue_burst;
 	/**@}*/
 
 	/**@{*/
@@ -121,7 +139,11 @@ struct __rte_cache_aligned rte_eth_fp_ops {
 	eth_recycle_tx_mbufs_reuse_t recycle_tx_mbufs_reuse;
 	/** Get the number of used Tx descriptors. */
 	eth_tx_queue_count_t tx_queue_count;
-	uintptr_t reserved2[1];
+	/**
+	 * Per-queue PMD transmit functions, indexed by queue id.
+	 * NULL when the PMD uses one transmit function for all queues.
+	 */
+	const eth_tx_burst_t *tx_queue_burst;
 	/**@}*/
 
 };
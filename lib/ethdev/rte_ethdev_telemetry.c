@@ -1523,6 +1523,45 @@ eth_dev_handle_port_regs(const char *cmd __rte_unused,
 	return eth_dev_get_port_regs(port_id, d, filter);
 }
 
+static int
+eth_dev_handle_port_tx_lease(const char *cmd __rte_unused,
+		const char *params, struct rte_tel_data *d)
+{
+	struct rte_eth_dev *eth_dev;
+	uint16_t port_id, qid;
+	char *end_param;
+	int ret;
+
+	ret = eth_dev_parse_port_params(params, &port_id, &end_param, false);
+	if (ret < 0)
+		return ret;
+
+	eth_dev = &rte_eth_devices[port_id];
+	rte_tel_data_start_dict(d);
+	for (qid = 0; qid < eth_dev->data->nb_tx_queues; qid++) {
+		struct rte_tel_data *q_data;
+		char q_name[16];
+
+		if (eth_dev->data->tx_lease_pools[qid] == NULL)
+			continue;
+
+		q_data = rte_tel_data_alloc();
+		if (q_data == NULL)
+			return -ENOMEM;
+		rte_tel_data_start_dict(q_data);
+		rte_tel_data_add_dict_string(q_data, "pool",
+			eth_dev->data->tx_lease_pools[qid]->name);
+		rte_tel_data_add_dict_uint(q_data, "leased",
+			eth_dev->data->tx_lease_allocs[qid]);
+		rte_tel_data_add_dict_uint(q_data, "violations",
+			eth_dev->data->tx_lease_violations[qid]);
+		snprintf(q_name, sizeof(q_name), "txq_%u", qid);
+		rte_tel_data_add_dict_container(d, q_name, q_data, 0);
+	}
+
+	return 0;
+}
+
 static int eth_dev_telemetry_do(const char *cmd, const char *params, void *arg,
 		struct rte_tel_data *d)
 {
@@ -1574,6 +1613,9 @@ RTE_INIT(ethdev_init_telemetry)
 	rte_telemetry_register_cmd_arg("/ethdev/tx_queue",
 			eth_dev_telemetry_do, eth_dev_handle_port_txq,
 			"Returns Tx queue info for a port. Parameters: int port_id, int queue_id (Optional if only one queue)");
+	rte_telemetry_register_cmd_arg("/ethdev/tx_lease",
+			eth_dev_telemetry_do, eth_dev_handle_port_tx_lease,
+			"Returns Tx mbuf lease pool counters for a port. Parameters: int port_id");
 	rte_telemetry_register_cmd_arg("/ethdev/dcb",
 			eth_dev_telemetry_do, eth_dev_handle_port_dcb,
 			"Returns DCB info for a port. Parameters: int port_id");
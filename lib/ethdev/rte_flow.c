@@ -14,6 +14,7 @@
 #include <rte_errno.h>
 #include <rte_branch_prediction.h>
 #include <rte_string_fns.h>
+#include <rte_malloc.h>
 #include <rte_mbuf_dyn.h>
 #include "rte_flow_driver.h"
 #include "rte_flow.h"
@@ -465,6 +466,39 @@ rte_flow_destroy(uint16_t port_id,
 				  NULL, rte_strerror(ENOSYS));
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_flow_destroy_bulk, 25.07)
+int
+rte_flow_destroy_bulk(uint16_t port_id,
+		      struct rte_flow * const flows[],
+		      unsigned int n,
+		      struct rte_flow_error *error)
+{
+	struct rte_eth_dev *dev = &rte_eth_devices[port_id];
+	const struct rte_flow_ops *ops = rte_flow_ops_get(port_id, error);
+	unsigned int i;
+	int ret;
+
+	if (unlikely(!ops))
+		return -rte_errno;
+	if (ops->destroy_bulk != NULL) {
+		fts_enter(dev);
+		ret = ops->destroy_bulk(dev, flows, n, error);
+		fts_exit(dev);
+		ret = flow_err(port_id, ret, error);
+
+		rte_flow_trace_destroy_bulk(port_id, flows, n, ret);
+
+		return ret;
+	}
+	/* fall back on per-rule destruction */
+	for (i = 0; i < n; i++) {
+		ret = rte_flow_destroy(port_id, flows[i], error);
+		if (ret != 0)
+			return ret;
+	}
+	return 0;
+}
+
 RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_flow_actions_update, 23.07)
 int
 rte_flow_actions_update(uint16_t port_id,
@@ -2206,6 +2240,179 @@ rte_flow_async_create_by_index_with_pattern(uint16_t port_id,
 	return flow;
 }
 
+/** One varying field of a compiled rule, resolved to its target bytes. */
+struct rte_flow_compiled_field {
+	uint8_t *dst;          /**< Target bytes inside the pattern copy. */
+	uint16_t value_offset; /**< Byte offset inside the flat value buffer. */
+	uint16_t size;         /**< Number of bytes to copy. */
+};
+
+struct rte_flow_compiled_rule {
+	struct rte_flow_template_table *table;
+	struct rte_flow_item *pattern;  /**< Private pattern copy. */
+	struct rte_flow_action *actions; /**< Private actions copy. */
+	uint8_t pattern_template_index;
+	uint8_t actions_template_index;
+	uint16_t nb_fields;
+	struct rte_flow_compiled_field fields[];
+};
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_flow_async_rule_compile, 25.07)
+struct rte_flow_compiled_rule *
+rte_flow_async_rule_compile(uint16_t port_id,
+			    struct rte_flow_template_table *template_table,
+			    const struct rte_flow_item pattern[],
+			    uint8_t pattern_template_index,
+			    const struct rte_flow_action actions[],
+			    uint8_t actions_template_index,
+			    const struct rte_flow_rule_field fields[],
+			    uint16_t nb_fields,
+			    struct rte_flow_error *error)
+{
+	struct rte_flow_compiled_rule *rule;
+	size_t base, pat_off, act_off;
+	uint16_t nb_items, i;
+	int pat_size, act_size;
+
+	if (!rte_eth_dev_is_valid_port(port_id)) {
+		rte_flow_error_set(error, ENODEV, RTE_FLOW_ERROR_TYPE_UNSPECIFIED, NULL,
+				   rte_strerror(ENODEV));
+		return NULL;
+	}
+	if (template_table == NULL || pattern == NULL || actions == NULL ||
+	    (fields == NULL && nb_fields != 0)) {
+		rte_flow_error_set(error, EINVAL, RTE_FLOW_ERROR_TYPE_UNSPECIFIED, NULL,
+				   rte_strerror(EINVAL));
+		return NULL;
+	}
+
+	pat_size = rte_flow_conv(RTE_FLOW_CONV_OP_PATTERN, NULL, 0, pattern, error);
+	if (pat_size < 0)
+		return NULL;
+	act_size = rte_flow_conv(RTE_FLOW_CONV_OP_ACTIONS, NULL, 0, actions, error);
+	if (act_size < 0)
+		return NULL;
+
+	base = sizeof(*rule) + nb_fields * sizeof(rule->fields[0]);
+	pat_off = RTE_ALIGN_CEIL(base, sizeof(double));
+	act_off = RTE_ALIGN_CEIL(pat_off + pat_size, sizeof(double));
+
+	rule = rte_zmalloc("rte_flow_compiled_rule", act_off + act_size, 0);
+	if (rule == NULL) {
+		rte_flow_error_set(error, ENOMEM, RTE_FLOW_ERROR_TYPE_UNSPECIFIED, NULL,
+				   rte_strerror(ENOMEM));
+		return NULL;
+	}
+	rule->table = template_table;
+	rule->pattern = (struct rte_flow_item *)((uint8_t *)rule + pat_off);
+	rule->actions = (struct rte_flow_action *)((uint8_t *)rule + act_off);
+	rule->pattern_template_index = pattern_template_index;
+	rule->actions_template_index = actions_template_index;
+	rule->nb_fields = nb_fields;
+
+	if (rte_flow_conv(RTE_FLOW_CONV_OP_PATTERN, rule->pattern, pat_size,
+			  pattern, error) < 0 ||
+	    rte_flow_conv(RTE_FLOW_CONV_OP_ACTIONS, rule->actions, act_size,
+			  actions, error) < 0)
+		goto err;
+
+	for (nb_items = 0;
+	     rule->pattern[nb_items].type != RTE_FLOW_ITEM_TYPE_END;
+	     nb_items++)
+		;
+
+	/* resolve the varying fields against the private pattern copy */
+	for (i = 0; i < nb_fields; i++) {
+		const struct rte_flow_item *item;
+		size_t spec_size;
+
+		if (fields[i].item_index >= nb_items || fields[i].size == 0) {
+			rte_flow_error_set(error, EINVAL,
+					   RTE_FLOW_ERROR_TYPE_UNSPECIFIED, NULL,
+					   "invalid varying field descriptor");
+			goto err;
+		}
+		item = &rule->pattern[fields[i].item_index];
+		if (item->spec == NULL) {
+			rte_flow_error_set(error, EINVAL,
+					   RTE_FLOW_ERROR_TYPE_ITEM_SPEC, NULL,
+					   "varying field requires an item spec");
+			goto err;
+		}
+		spec_size = (size_t)item->type < RTE_DIM(rte_flow_desc_item) ?
+			rte_flow_desc_item[item->type].size : 0;
+		if (spec_size != 0 &&
+		    (size_t)fields[i].spec_offset + fields[i].size > spec_size) {
+			rte_flow_error_set(error, EINVAL,
+					   RTE_FLOW_ERROR_TYPE_ITEM_SPEC, NULL,
+					   "varying field exceeds the item spec");
+			goto err;
+		}
+		rule->fields[i].dst = (uint8_t *)(uintptr_t)item->spec +
+			fields[i].spec_offset;
+		rule->fields[i].value_offset = fields[i].value_offset;
+		rule->fields[i].size = fields[i].size;
+	}
+
+	return rule;
+err:
+	rte_free(rule);
+	return NULL;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_flow_async_rule_insert, 25.07)
+struct rte_flow *
+rte_flow_async_rule_insert(uint16_t port_id,
+			   uint32_t queue_id,
+			   const struct rte_flow_op_attr *op_attr,
+			   struct rte_flow_compiled_rule *rule,
+			   const void *values,
+			   void *user_data,
+			   struct rte_flow_error *error)
+{
+	struct rte_eth_dev *dev = &rte_eth_devices[port_id];
+	const uint8_t *src = values;
+	struct rte_flow *flow;
+	uint16_t i;
+
+#ifdef RTE_FLOW_DEBUG
+	if (!rte_eth_dev_is_valid_port(port_id)) {
+		rte_flow_error_set(error, ENODEV, RTE_FLOW_ERROR_TYPE_UNSPECIFIED, NULL,
+				   rte_strerror(ENODEV));
+		return NULL;
+	}
+	if (dev->flow_fp_ops == NULL || dev->flow_fp_ops->async_create == NULL) {
+		rte_flow_error_set(error, ENOSYS, RTE_FLOW_ERROR_TYPE_UNSPECIFIED, NULL,
+				   rte_strerror(ENOSYS));
+		return NULL;
+	}
+#endif
+
+	for (i = 0; i < rule->nb_fields; i++)
+		rte_memcpy(rule->fields[i].dst, src + rule->fields[i].value_offset,
+			   rule->fields[i].size);
+
+	flow = dev->flow_fp_ops->async_create(dev, queue_id,
+					      op_attr, rule->table,
+					      rule->pattern, rule->pattern_template_index,
+					      rule->actions, rule->actions_template_index,
+					      user_data, error);
+
+	rte_flow_trace_async_create(port_id, queue_id, op_attr, rule->table,
+				    rule->pattern, rule->pattern_template_index,
+				    rule->actions, rule->actions_template_index,
+				    user_data, flow);
+
+	return flow;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_flow_compiled_rule_free, 25.07)
+void
+rte_flow_compiled_rule_free(struct rte_flow_compiled_rule *rule)
+{
+	rte_free(rule);
+}
+
 RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_flow_async_destroy, 22.03)
 int
 rte_flow_async_destroy(uint16_t port_id,
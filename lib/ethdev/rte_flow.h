@@ -4723,6 +4723,41 @@ rte_flow_destroy(uint16_t port_id,
 		 struct rte_flow *flow,
 		 struct rte_flow_error *error);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Destroy several flow rules on a given port in one call.
+ *
+ * The same restrictions as for rte_flow_destroy() apply to each handle.
+ * A typical use is destroying the rules reported aged-out by
+ * rte_flow_get_aged_flows() or rte_flow_get_q_aged_flows() without paying
+ * the per-call overhead for each rule.
+ *
+ * PMDs without native support fall back to destroying the rules one by
+ * one. Destruction stops at the first failure, leaving the remaining
+ * handles valid.
+ *
+ * @param port_id
+ *   Port identifier of Ethernet device.
+ * @param[in] flows
+ *   Array of flow rule handles to destroy.
+ * @param n
+ *   Number of entries in @p flows.
+ * @param[out] error
+ *   Perform verbose error reporting if not NULL. PMDs initialize this
+ *   structure in case of error only.
+ *
+ * @return
+ *   0 on success, a negative errno value otherwise and rte_errno is set.
+ */
+__rte_experimental
+int
+rte_flow_destroy_bulk(uint16_t port_id,
+		      struct rte_flow * const flows[],
+		      unsigned int n,
+		      struct rte_flow_error *error);
+
 /**
  * Update a flow rule with new actions on a given port.
  *
@@ -6256,6 +6291,141 @@ rte_flow_async_create_by_index_with_pattern(uint16_t port_id,
 					    void *user_data,
 					    struct rte_flow_error *error);
 
+/**
+ * Opaque type for compiled flow rules.
+ *
+ * @see rte_flow_async_rule_compile()
+ */
+struct rte_flow_compiled_rule;
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Descriptor of one varying field of a compiled flow rule.
+ *
+ * It maps a range of bytes inside the flat value buffer passed to
+ * rte_flow_async_rule_insert() onto a range of bytes inside the spec of
+ * one pattern item.
+ */
+struct rte_flow_rule_field {
+	uint16_t item_index;   /**< Index of the item in the pattern array. */
+	uint16_t spec_offset;  /**< Byte offset inside the item spec. */
+	uint16_t value_offset; /**< Byte offset inside the flat value buffer. */
+	uint16_t size;         /**< Number of bytes to copy. */
+};
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Compile a rule for repeated insertion into a template table.
+ *
+ * The pattern and actions are translated and validated once against the
+ * given templates, and a private copy of them is stored in the returned
+ * object together with the varying field map. Subsequent insertions via
+ * rte_flow_async_rule_insert() only patch the varying bytes and enqueue
+ * the creation, skipping all per-rule item parsing on the application
+ * side. This is intended for bulk insertion of many rules that differ
+ * only in a few field values, e.g. during failover convergence.
+ *
+ * A compiled rule holds mutable insertion state and thus must not be
+ * used from several threads concurrently; compile one object per
+ * insertion thread instead.
+ *
+ * @param port_id
+ *   Port identifier of Ethernet device.
+ * @param[in] template_table
+ *   Template table the rules will be inserted into.
+ * @param[in] pattern
+ *   List of pattern items to be used, holding the values shared by all
+ *   rules in the fields that are not part of @p fields.
+ *   The list order should match the order in the pattern template.
+ * @param pattern_template_index
+ *   Pattern template index in the table.
+ * @param[in] actions
+ *   List of actions to be used.
+ *   The list order should match the order in the actions template.
+ * @param actions_template_index
+ *   Actions template index in the table.
+ * @param[in] fields
+ *   Array of descriptors of the varying pattern fields.
+ * @param nb_fields
+ *   Number of elements in @p fields.
+ * @param[out] error
+ *   Perform verbose error reporting if not NULL.
+ *
+ * @return
+ *   A valid handle in case of success, NULL otherwise and rte_errno is set.
+ */
+__rte_experimental
+struct rte_flow_compiled_rule *
+rte_flow_async_rule_compile(uint16_t port_id,
+			    struct rte_flow_template_table *template_table,
+			    const struct rte_flow_item pattern[],
+			    uint8_t pattern_template_index,
+			    const struct rte_flow_action actions[],
+			    uint8_t actions_template_index,
+			    const struct rte_flow_rule_field fields[],
+			    uint16_t nb_fields,
+			    struct rte_flow_error *error);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Enqueue the creation of one rule from a compiled rule object.
+ *
+ * The varying fields of the compiled rule are patched from the flat
+ * @p values buffer according to the field map given at compile time,
+ * then the rule creation is enqueued like rte_flow_async_create().
+ *
+ * @param port_id
+ *   Port identifier of Ethernet device.
+ * @param queue_id
+ *   Flow queue used to insert the rule.
+ * @param[in] op_attr
+ *   Rule creation operation attributes.
+ * @param[in] rule
+ *   Compiled rule obtained from rte_flow_async_rule_compile().
+ * @param[in] values
+ *   Flat buffer holding the values of the varying fields.
+ * @param[in] user_data
+ *   The user data that will be returned on the completion events.
+ * @param[out] error
+ *   Perform verbose error reporting if not NULL.
+ *   PMDs initialize this structure in case of error only.
+ *
+ * @return
+ *   Handle on success, NULL otherwise and rte_errno is set.
+ *   The rule handle doesn't mean that the rule has been populated.
+ *   Only completion result indicates that if there was success or failure.
+ */
+__rte_experimental
+struct rte_flow *
+rte_flow_async_rule_insert(uint16_t port_id,
+			   uint32_t queue_id,
+			   const struct rte_flow_op_attr *op_attr,
+			   struct rte_flow_compiled_rule *rule,
+			   const void *values,
+			   void *user_data,
+			   struct rte_flow_error *error);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Free a compiled rule object.
+ *
+ * Rules already inserted from it are not affected.
+ *
+ * @param[in] rule
+ *   Compiled rule to be freed, NULL is allowed.
+ */
+__rte_experimental
+void
+rte_flow_compiled_rule_free(struct rte_flow_compiled_rule *rule);
+
 /**
  * @warning
  * @b EXPERIMENTAL: this API may change without prior notice.
@@ -56,6 +56,12 @@ struct rte_flow_ops {
 		(struct rte_eth_dev *,
 		 struct rte_flow *,
 		 struct rte_flow_error *);
+	/** See rte_flow_destroy_bulk(). */
+	int (*destroy_bulk)
+		(struct rte_eth_dev *,
+		 struct rte_flow * const [],
+		 unsigned int,
+		 struct rte_flow_error *);
 	/** See rte_flow_flush(). */
 	int (*flush)
 		(struct rte_eth_dev *,
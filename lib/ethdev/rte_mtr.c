@@ -235,6 +235,64 @@ rte_mtr_create(uint16_t port_id,
 	return ret;
 }
 
+/** MTR object pool pre-sizing */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_mtr_pool_configure, 25.07)
+int
+rte_mtr_pool_configure(uint16_t port_id,
+	uint32_t nb_mtrs,
+	struct rte_mtr_error *error)
+{
+	struct rte_eth_dev *dev = &rte_eth_devices[port_id];
+
+	return RTE_MTR_FUNC(port_id, pool_configure)(dev, nb_mtrs, error);
+}
+
+/** MTR object bulk create */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_mtr_create_bulk, 25.07)
+int
+rte_mtr_create_bulk(uint16_t port_id,
+	const uint32_t *mtr_ids,
+	struct rte_mtr_params *params,
+	uint32_t nb_mtrs,
+	int shared,
+	struct rte_mtr_error *error)
+{
+	struct rte_eth_dev *dev = &rte_eth_devices[port_id];
+	const struct rte_mtr_ops *ops = rte_mtr_ops_get(port_id, error);
+	struct rte_mtr_error rollback_error;
+	uint32_t i;
+	int ret;
+
+	if (ops == NULL)
+		return -rte_errno;
+
+	if (mtr_ids == NULL || params == NULL || nb_mtrs == 0)
+		return -rte_mtr_error_set(error, EINVAL,
+			RTE_MTR_ERROR_TYPE_UNSPECIFIED, NULL,
+			rte_strerror(EINVAL));
+
+	if (ops->create_bulk != NULL)
+		return ops->create_bulk(dev, mtr_ids, params, nb_mtrs,
+			shared, error);
+
+	if (ops->create == NULL || ops->destroy == NULL)
+		return -rte_mtr_error_set(error, ENOSYS,
+			RTE_MTR_ERROR_TYPE_UNSPECIFIED, NULL,
+			rte_strerror(ENOSYS));
+
+	for (i = 0; i < nb_mtrs; i++) {
+		ret = ops->create(dev, mtr_ids[i], &params[i], shared, error);
+		if (ret != 0) {
+			/* Keep the call atomic: undo the objects created. */
+			while (i-- > 0)
+				ops->destroy(dev, mtr_ids[i], &rollback_error);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
 /** MTR object destroy */
 RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_mtr_destroy, 17.11)
 int
@@ -252,6 +310,44 @@ rte_mtr_destroy(uint16_t port_id,
 	return ret;
 }
 
+/** MTR object bulk destroy */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_mtr_destroy_bulk, 25.07)
+int
+rte_mtr_destroy_bulk(uint16_t port_id,
+	const uint32_t *mtr_ids,
+	uint32_t nb_mtrs,
+	struct rte_mtr_error *error)
+{
+	struct rte_eth_dev *dev = &rte_eth_devices[port_id];
+	const struct rte_mtr_ops *ops = rte_mtr_ops_get(port_id, error);
+	uint32_t i;
+	int ret;
+
+	if (ops == NULL)
+		return -rte_errno;
+
+	if (mtr_ids == NULL || nb_mtrs == 0)
+		return -rte_mtr_error_set(error, EINVAL,
+			RTE_MTR_ERROR_TYPE_UNSPECIFIED, NULL,
+			rte_strerror(EINVAL));
+
+	if (ops->destroy_bulk != NULL)
+		return ops->destroy_bulk(dev, mtr_ids, nb_mtrs, error);
+
+	if (ops->destroy == NULL)
+		return -rte_mtr_error_set(error, ENOSYS,
+			RTE_MTR_ERROR_TYPE_UNSPECIFIED, NULL,
+			rte_strerror(ENOSYS));
+
+	for (i = 0; i < nb_mtrs; i++) {
+		ret = ops->destroy(dev, mtr_ids[i], error);
+		if (ret != 0)
+			return ret;
+	}
+
+	return 0;
+}
+
 /** MTR object meter enable */
 RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_mtr_meter_enable, 17.11)
 int
@@ -452,3 +548,47 @@ rte_mtr_stats_read(uint16_t port_id,
 
 	return ret;
 }
+
+/** MTR object stats bulk read */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_mtr_stats_read_bulk, 25.07)
+int
+rte_mtr_stats_read_bulk(uint16_t port_id,
+	uint32_t mtr_id_first,
+	uint32_t nb_mtrs,
+	struct rte_mtr_stats *stats,
+	uint64_t *stats_mask,
+	int clear,
+	struct rte_mtr_error *error)
+{
+	struct rte_eth_dev *dev = &rte_eth_devices[port_id];
+	const struct rte_mtr_ops *ops = rte_mtr_ops_get(port_id, error);
+	uint32_t i;
+	int ret;
+
+	if (ops == NULL)
+		return -rte_errno;
+
+	if (stats == NULL || nb_mtrs == 0)
+		return -rte_mtr_error_set(error, EINVAL,
+			RTE_MTR_ERROR_TYPE_UNSPECIFIED, NULL,
+			rte_strerror(EINVAL));
+
+	if (ops->stats_read_bulk != NULL)
+		return ops->stats_read_bulk(dev, mtr_id_first, nb_mtrs,
+			stats, stats_mask, clear, error);
+
+	if (ops->stats_read == NULL)
+		return -rte_mtr_error_set(error, ENOSYS,
+			RTE_MTR_ERROR_TYPE_UNSPECIFIED, NULL,
+			rte_strerror(ENOSYS));
+
+	for (i = 0; i < nb_mtrs; i++) {
+		ret = ops->stats_read(dev, mtr_id_first + i, &stats[i],
+			stats_mask != NULL ? &stats_mask[i] : NULL,
+			clear, error);
+		if (ret != 0)
+			return ret;
+	}
+
+	return 0;
+}
@@ -830,6 +830,69 @@ rte_mtr_create(uint16_t port_id,
 	int shared,
 	struct rte_mtr_error *error);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Pre-size the MTR object pool
+ *
+ * Hint the PMD about the number of MTR objects the application is going to
+ * use, so per-object resources can be allocated in one go rather than on
+ * every rte_mtr_create() call. Calling it is optional; it must be done
+ * before the first MTR object is created.
+ *
+ * @param[in] port_id
+ *   The port identifier of the Ethernet device.
+ * @param[in] nb_mtrs
+ *   Number of MTR objects the pool should accommodate.
+ * @param[out] error
+ *   Error details. Filled in only on error, when not NULL.
+ * @return
+ *   0 on success, non-zero error code otherwise.
+ */
+__rte_experimental
+int
+rte_mtr_pool_configure(uint16_t port_id,
+	uint32_t nb_mtrs,
+	struct rte_mtr_error *error);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * MTR object bulk create
+ *
+ * Create several MTR objects in one call. When the PMD does not provide a
+ * native bulk operation the objects are created one by one; in either case
+ * the call is atomic: on failure the MTR objects already created by it are
+ * destroyed and none of the requested IDs is left behind.
+ *
+ * @param[in] port_id
+ *   The port identifier of the Ethernet device.
+ * @param[in] mtr_ids
+ *   Array of *nb_mtrs* MTR object IDs, each needs to be unused by any of the
+ *   existing MTR objects created for the current port.
+ * @param[in] params
+ *   Array of *nb_mtrs* MTR object params. Needs to be pre-allocated and valid.
+ * @param[in] nb_mtrs
+ *   Number of MTR objects to create.
+ * @param[in] shared
+ *   Non-zero when these MTR objects can be shared by multiple flows, zero when
+ *   each MTR object can be used by a single flow.
+ * @param[out] error
+ *   Error details. Filled in only on error, when not NULL.
+ * @return
+ *   0 on success, non-zero error code otherwise.
+ */
+__rte_experimental
+int
+rte_mtr_create_bulk(uint16_t port_id,
+	const uint32_t *mtr_ids,
+	struct rte_mtr_params *params,
+	uint32_t nb_mtrs,
+	int shared,
+	struct rte_mtr_error *error);
+
 /**
  * MTR object destroy
  *
@@ -852,6 +915,34 @@ rte_mtr_destroy(uint16_t port_id,
 	uint32_t mtr_id,
 	struct rte_mtr_error *error);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * MTR object bulk destroy
+ *
+ * Delete several existing MTR objects in one call. The operation stops at
+ * the first MTR object that cannot be deleted (e.g. one that is still used
+ * by a flow); the objects before it stay deleted.
+ *
+ * @param[in] port_id
+ *   The port identifier of the Ethernet device.
+ * @param[in] mtr_ids
+ *   Array of *nb_mtrs* MTR object IDs, each needs to be valid.
+ * @param[in] nb_mtrs
+ *   Number of MTR objects to destroy.
+ * @param[out] error
+ *   Error details. Filled in only on error, when not NULL.
+ * @return
+ *   0 on success, non-zero error code otherwise.
+ */
+__rte_experimental
+int
+rte_mtr_destroy_bulk(uint16_t port_id,
+	const uint32_t *mtr_ids,
+	uint32_t nb_mtrs,
+	struct rte_mtr_error *error);
+
 /**
  * MTR object meter disable
  *
@@ -1129,6 +1220,50 @@ rte_mtr_stats_read(uint16_t port_id,
 	int clear,
 	struct rte_mtr_error *error);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * MTR object statistics counters bulk read
+ *
+ * Read the statistics counters of a contiguous range of MTR object IDs in
+ * one call, e.g. to poll all the meters of a subscriber group.
+ *
+ * @param[in] port_id
+ *   The port identifier of the Ethernet device.
+ * @param[in] mtr_id_first
+ *   First MTR object ID of the range. All *nb_mtrs* IDs starting from it
+ *   need to be valid.
+ * @param[in] nb_mtrs
+ *   Number of MTR objects to read.
+ * @param[out] stats
+ *   Array of *nb_mtrs* statistics counter structures, filled with the
+ *   current values of the counters enabled for each MTR object.
+ * @param[out] stats_mask
+ *   When non-NULL, an array of *nb_mtrs* masks of statistics counter types
+ *   currently enabled for each MTR object, indicating which of the counters
+ *   retrieved with the *stats* structures are valid.
+ * @param[in] clear
+ *   When this parameter has a non-zero value, the statistics counters are
+ *   cleared (i.e. set to zero) immediately after they have been read,
+ *   otherwise the statistics counters are left untouched.
+ * @param[out] error
+ *   Error details. Filled in only on error, when not NULL.
+ * @return
+ *   0 on success, non-zero error code otherwise.
+ *
+ * @see enum rte_mtr_stats_type
+ */
+__rte_experimental
+int
+rte_mtr_stats_read_bulk(uint16_t port_id,
+	uint32_t mtr_id_first,
+	uint32_t nb_mtrs,
+	struct rte_mtr_stats *stats,
+	uint64_t *stats_mask,
+	int clear,
+	struct rte_mtr_error *error);
+
 #ifdef __cplusplus
 }
 #endif
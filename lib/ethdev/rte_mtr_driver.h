@@ -82,6 +82,25 @@ typedef int (*rte_mtr_destroy_t)(struct rte_eth_dev *dev,
 	uint32_t mtr_id,
 	struct rte_mtr_error *error);
 
+/** @internal MTR object pool pre-sizing. */
+typedef int (*rte_mtr_pool_configure_t)(struct rte_eth_dev *dev,
+	uint32_t nb_mtrs,
+	struct rte_mtr_error *error);
+
+/** @internal MTR object bulk create. */
+typedef int (*rte_mtr_create_bulk_t)(struct rte_eth_dev *dev,
+	const uint32_t *mtr_ids,
+	struct rte_mtr_params *params,
+	uint32_t nb_mtrs,
+	int shared,
+	struct rte_mtr_error *error);
+
+/** @internal MTR object bulk destroy. */
+typedef int (*rte_mtr_destroy_bulk_t)(struct rte_eth_dev *dev,
+	const uint32_t *mtr_ids,
+	uint32_t nb_mtrs,
+	struct rte_mtr_error *error);
+
 /** @internal MTR object meter enable. */
 typedef int (*rte_mtr_meter_enable_t)(struct rte_eth_dev *dev,
 	uint32_t mtr_id,
@@ -150,6 +169,15 @@ typedef int (*rte_mtr_stats_read_t)(struct rte_eth_dev *dev,
 	int clear,
 	struct rte_mtr_error *error);
 
+/** @internal MTR object stats bulk read. */
+typedef int (*rte_mtr_stats_read_bulk_t)(struct rte_eth_dev *dev,
+	uint32_t mtr_id_first,
+	uint32_t nb_mtrs,
+	struct rte_mtr_stats *stats,
+	uint64_t *stats_mask,
+	int clear,
+	struct rte_mtr_error *error);
+
 struct rte_mtr_ops {
 	/** MTR capabilities get */
 	rte_mtr_capabilities_get_t capabilities_get;
@@ -213,6 +241,18 @@ struct rte_mtr_ops {
 
 	/** MTR meter policy get */
 	rte_mtr_meter_policy_get_t meter_policy_get;
+
+	/** MTR object pool pre-sizing */
+	rte_mtr_pool_configure_t pool_configure;
+
+	/** MTR object bulk create */
+	rte_mtr_create_bulk_t create_bulk;
+
+	/** MTR object bulk destroy */
+	rte_mtr_destroy_bulk_t destroy_bulk;
+
+	/** MTR object stats bulk read */
+	rte_mtr_stats_read_bulk_t stats_read_bulk;
 };
 
 /**
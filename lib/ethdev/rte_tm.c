@@ -355,6 +355,75 @@ int rte_tm_node_delete(uint16_t port_id,
 	return ret;
 }
 
+/* Apply a batch of node operations */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_tm_node_batch_apply, 25.07)
+int rte_tm_node_batch_apply(uint16_t port_id,
+	const struct rte_tm_node_op *ops,
+	uint32_t n_ops,
+	struct rte_tm_error *error)
+{
+	struct rte_eth_dev *dev = &rte_eth_devices[port_id];
+	const struct rte_tm_ops *tm_ops;
+	uint32_t i;
+	int ret;
+
+	tm_ops = rte_tm_ops_get(port_id, error);
+	if (tm_ops == NULL)
+		return -rte_errno;
+
+	if (ops == NULL && n_ops != 0)
+		return -rte_tm_error_set(error,
+			EINVAL,
+			RTE_TM_ERROR_TYPE_UNSPECIFIED,
+			NULL,
+			rte_strerror(EINVAL));
+
+	if (tm_ops->node_batch_apply != NULL) {
+		ret = tm_ops->node_batch_apply(dev, ops, n_ops, error);
+
+		rte_tm_trace_node_batch_apply(port_id, ops, n_ops, ret);
+
+		return ret;
+	}
+
+	/* No native support: apply the operations one by one, stopping at
+	 * the first failure. Atomicity is not provided on this path.
+	 */
+	ret = 0;
+	for (i = 0; i < n_ops; i++) {
+		const struct rte_tm_node_op *op = &ops[i];
+
+		switch (op->type) {
+		case RTE_TM_NODE_OP_ADD:
+			ret = rte_tm_node_add(port_id, op->node_id,
+				op->parent_node_id, op->priority, op->weight,
+				op->level_id, op->params, error);
+			break;
+		case RTE_TM_NODE_OP_DELETE:
+			ret = rte_tm_node_delete(port_id, op->node_id, error);
+			break;
+		case RTE_TM_NODE_OP_PARENT_UPDATE:
+			ret = rte_tm_node_parent_update(port_id, op->node_id,
+				op->parent_node_id, op->priority, op->weight,
+				error);
+			break;
+		default:
+			ret = -rte_tm_error_set(error,
+				EINVAL,
+				RTE_TM_ERROR_TYPE_UNSPECIFIED,
+				NULL,
+				rte_strerror(EINVAL));
+			break;
+		}
+		if (ret != 0)
+			break;
+	}
+
+	rte_tm_trace_node_batch_apply(port_id, ops, n_ops, ret);
+
+	return ret;
+}
+
 /* Suspend node */
 RTE_EXPORT_SYMBOL(rte_tm_node_suspend)
 int rte_tm_node_suspend(uint16_t port_id,
@@ -1677,6 +1677,105 @@ rte_tm_node_delete(uint16_t port_id,
 	uint32_t node_id,
 	struct rte_tm_error *error);
 
+/**
+ * Traffic manager batched node operation type
+ */
+enum rte_tm_node_op_type {
+	/** Add a new node (see rte_tm_node_add()). */
+	RTE_TM_NODE_OP_ADD = 0,
+
+	/** Delete an existing node (see rte_tm_node_delete()). */
+	RTE_TM_NODE_OP_DELETE,
+
+	/** Update the parent of an existing node
+	 * (see rte_tm_node_parent_update()).
+	 */
+	RTE_TM_NODE_OP_PARENT_UPDATE,
+};
+
+/**
+ * Traffic manager batched node operation
+ *
+ * Describes a single node operation within a batch handed over to
+ * rte_tm_node_batch_apply().
+ */
+struct rte_tm_node_op {
+	/** Operation type. */
+	enum rte_tm_node_op_type type;
+
+	/** Node ID. Subject of the operation for all operation types. */
+	uint32_t node_id;
+
+	/** Parent node ID. Valid for RTE_TM_NODE_OP_ADD and
+	 * RTE_TM_NODE_OP_PARENT_UPDATE, ignored otherwise.
+	 */
+	uint32_t parent_node_id;
+
+	/** Node priority. Valid for RTE_TM_NODE_OP_ADD and
+	 * RTE_TM_NODE_OP_PARENT_UPDATE, ignored otherwise.
+	 */
+	uint32_t priority;
+
+	/** Node weight. Valid for RTE_TM_NODE_OP_ADD and
+	 * RTE_TM_NODE_OP_PARENT_UPDATE, ignored otherwise.
+	 */
+	uint32_t weight;
+
+	/** Level ID that should be met by the node. Only valid for
+	 * RTE_TM_NODE_OP_ADD; assign RTE_TM_NODE_LEVEL_ID_ANY to disable the
+	 * level check, as for rte_tm_node_add().
+	 */
+	uint32_t level_id;
+
+	/** Node parameters. Only valid for RTE_TM_NODE_OP_ADD; needs to be
+	 * pre-allocated and valid for that operation type.
+	 */
+	const struct rte_tm_node_params *params;
+};
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Traffic manager batched node operations
+ *
+ * Apply a set of node add/delete/parent update operations to the hierarchy of
+ * the given port as a single batch. When the underlying device natively
+ * supports batched updates, the complete batch is validated and then applied
+ * atomically, so packet scheduling never observes a partially updated
+ * hierarchy and an invalid batch leaves the hierarchy unchanged. This enables
+ * hitless reconfiguration such as moving a subtree under a new parent by
+ * pairing delete and add operations in one batch.
+ *
+ * When native support is not available, the operations are applied one by one
+ * in batch order and the call stops at the first failing operation. In this
+ * case atomicity is not guaranteed: operations preceding the failed one
+ * remain applied.
+ *
+ * @param[in] port_id
+ *   The port identifier of the Ethernet device.
+ * @param[in] ops
+ *   Array of node operations, applied in order. Needs to be pre-allocated and
+ *   valid.
+ * @param[in] n_ops
+ *   Number of elements in the *ops* array.
+ * @param[out] error
+ *   Error details. Filled in only on error, when not NULL.
+ * @return
+ *   0 on success, non-zero error code otherwise.
+ *
+ * @see rte_tm_node_add()
+ * @see rte_tm_node_delete()
+ * @see rte_tm_node_parent_update()
+ * @see RTE_TM_UPDATE_NODE_ADD_DELETE
+ */
+__rte_experimental
+int
+rte_tm_node_batch_apply(uint16_t port_id,
+	const struct rte_tm_node_op *ops,
+	uint32_t n_ops,
+	struct rte_tm_error *error);
+
 /**
  * Traffic manager node suspend
  *
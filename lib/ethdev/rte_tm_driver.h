@@ -109,6 +109,12 @@ typedef int (*rte_tm_node_delete_t)(struct rte_eth_dev *dev,
 	uint32_t node_id,
 	struct rte_tm_error *error);
 
+/** @internal Traffic manager node batch apply */
+typedef int (*rte_tm_node_batch_apply_t)(struct rte_eth_dev *dev,
+	const struct rte_tm_node_op *ops,
+	uint32_t n_ops,
+	struct rte_tm_error *error);
+
 /** @internal Traffic manager node suspend */
 typedef int (*rte_tm_node_suspend_t)(struct rte_eth_dev *dev,
 	uint32_t node_id,
@@ -254,6 +260,8 @@ struct rte_tm_ops {
 	rte_tm_node_add_t node_add;
 	/** Traffic manager node delete */
 	rte_tm_node_delete_t node_delete;
+	/** Traffic manager node batch apply */
+	rte_tm_node_batch_apply_t node_batch_apply;
 	/** Traffic manager node suspend */
 	rte_tm_node_suspend_t node_suspend;
 	/** Traffic manager node resume */
@@ -530,6 +530,41 @@ typedef int (*eventdev_port_unlink_profile_t)(struct rte_eventdev *dev, void *po
 typedef int (*eventdev_port_unlinks_in_progress_t)(struct rte_eventdev *dev,
 		void *port);
 
+/**
+ * Reserve credits for new events on an event port.
+ *
+ * @param dev
+ *   Event device pointer
+ * @param port
+ *   Event port pointer
+ * @param nb_credits
+ *   Number of credits requested
+ *
+ * @return
+ *   Returns the number of credits actually reserved, which may be lower
+ *   than *nb_credits* when the device is close to its new event limit.
+ */
+typedef uint16_t (*eventdev_port_credits_reserve_t)(struct rte_eventdev *dev,
+		void *port, uint16_t nb_credits);
+
+/**
+ * Release credits previously reserved on an event port.
+ *
+ * @param dev
+ *   Event device pointer
+ * @param port
+ *   Event port pointer
+ * @param nb_credits
+ *   Number of credits to release
+ *
+ * @return
+ *   Returns the number of credits actually released, which may be lower
+ *   than *nb_credits* when part of the reservation was already spent on
+ *   enqueued events.
+ */
+typedef uint16_t (*eventdev_port_credits_release_t)(struct rte_eventdev *dev,
+		void *port, uint16_t nb_credits);
+
 /**
  * Converts nanoseconds to *timeout_ticks* value for rte_event_dequeue()
  *
@@ -1625,6 +1660,10 @@ struct eventdev_ops {
 	/**< Unlink event queues associated with a profile from an event port. */
 	eventdev_port_unlinks_in_progress_t port_unlinks_in_progress;
 	/**< Unlinks in progress on an event port. */
+	eventdev_port_credits_reserve_t port_credits_reserve;
+	/**< Reserve new event credits on an event port. */
+	eventdev_port_credits_release_t port_credits_release;
+	/**< Release reserved credits on an event port. */
 	eventdev_dequeue_timeout_ticks_t timeout_ticks;
 	/**< Converts ns to *timeout_ticks* value for rte_event_dequeue() */
 	eventdev_dump_t dump;
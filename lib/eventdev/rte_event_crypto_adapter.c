@@ -26,11 +26,18 @@
 #define CRYPTO_ADAPTER_MEM_NAME_LEN 32
 #define CRYPTO_ADAPTER_MAX_EV_ENQ_RETRIES 100
 
-/* MAX_OPS_IN_BUFFER contains size for  batch of dequeued events */
-#define MAX_OPS_IN_BUFFER BATCH_SIZE
+/* MAX_OPS_IN_BUFFER is the deepest burst that can be aggregated for a
+ * queue pair before it must be flushed to the cryptodev
+ */
+#define MAX_OPS_IN_BUFFER (BATCH_SIZE * 4)
+
+/* Default number of ops aggregated per queue pair before flushing them
+ * to the cryptodev, tunable via adapter runtime params
+ */
+#define DEFAULT_CDEV_BURST_SIZE BATCH_SIZE
 
 /* CRYPTO_ADAPTER_OPS_BUFFER_SZ to accommodate MAX_OPS_IN_BUFFER +
- * additional space for one batch
+ * additional space for one batch of dequeued events
  */
 #define CRYPTO_ADAPTER_OPS_BUFFER_SZ (MAX_OPS_IN_BUFFER + BATCH_SIZE)
 
@@ -69,6 +76,10 @@ struct __rte_cache_aligned event_crypto_adapter {
 	bool stop_enq_to_cryptodev;
 	/* Max crypto ops processed in any service function invocation */
 	uint32_t max_nb;
+	/* Number of ops aggregated per queue pair before flushing to cdev */
+	uint16_t cdev_burst_size;
+	/* Max time ops may be held back for aggregation, 0 to disable */
+	uint64_t aggr_max_latency_cycles;
 	/* Lock to serialize config updates with service function */
 	rte_spinlock_t lock;
 	/* Next crypto device to be processed */
@@ -127,6 +138,8 @@ struct __rte_cache_aligned crypto_queue_pair_info {
 	bool qp_enabled;
 	/* Circular buffer for batching crypto ops to cdev */
 	struct crypto_ops_circular_buffer cbuf;
+	/* Timestamp of the oldest op aggregated in the buffer */
+	uint64_t aggr_start_tsc;
 };
 
 static struct event_crypto_adapter **event_crypto_adapter;
@@ -210,16 +223,17 @@ eca_memzone_lookup(void)
 }
 
 static inline bool
-eca_circular_buffer_batch_ready(struct crypto_ops_circular_buffer *bufp)
+eca_circular_buffer_batch_ready(struct crypto_ops_circular_buffer *bufp,
+				uint16_t burst_size)
 {
-	return bufp->count >= BATCH_SIZE;
+	return bufp->count >= burst_size;
 }
 
 static inline bool
 eca_circular_buffer_space_for_batch(struct crypto_ops_circular_buffer *bufp)
 {
-	/* circular buffer can have atmost MAX_OPS_IN_BUFFER */
-	return (bufp->size - bufp->count) >= MAX_OPS_IN_BUFFER;
+	/* reserve space for one batch of dequeued events */
+	return (bufp->size - bufp->count) >= BATCH_SIZE;
 }
 
 static inline void
@@ -414,6 +428,7 @@ rte_event_crypto_adapter_create_ext(uint8_t id, uint8_t dev_id,
 
 	adapter->eventdev_id = dev_id;
 	adapter->socket_id = socket_id;
+	adapter->cdev_burst_size = DEFAULT_CDEV_BURST_SIZE;
 	adapter->conf_cb = conf_cb;
 	adapter->conf_arg = conf_arg;
 	adapter->mode = mode;
@@ -551,14 +566,20 @@ eca_enq_to_cryptodev(struct event_crypto_adapter *adapter, struct rte_event *ev,
 			rte_crypto_op_free(crypto_op);
 			continue;
 		}
+		if (adapter->aggr_max_latency_cycles != 0 &&
+				qp_info->cbuf.count == 0)
+			qp_info->aggr_start_tsc = rte_rdtsc();
 		eca_circular_buffer_add(&qp_info->cbuf, crypto_op);
 
-		if (eca_circular_buffer_batch_ready(&qp_info->cbuf)) {
+		if (eca_circular_buffer_batch_ready(&qp_info->cbuf,
+					adapter->cdev_burst_size)) {
 			ret = eca_circular_buffer_flush_to_cdev(&qp_info->cbuf,
 								cdev_id,
 								qp_id,
 								&nb_enqueued);
 			stats->crypto_enq_count += nb_enqueued;
+			if (nb_enqueued)
+				stats->crypto_enq_burst_count++;
 			n += nb_enqueued;
 
 			/**
@@ -595,10 +616,13 @@ eca_crypto_cdev_flush(struct event_crypto_adapter *adapter,
 		if (unlikely(curr_queue == NULL || !curr_queue->qp_enabled))
 			continue;
 
+		nb_enqueued = 0;
 		eca_circular_buffer_flush_to_cdev(&curr_queue->cbuf,
 						  cdev_id,
 						  qp,
 						  &nb_enqueued);
+		if (nb_enqueued)
+			adapter->crypto_stats.crypto_enq_burst_count++;
 		*nb_ops_flushed += curr_queue->cbuf.count;
 		nb += nb_enqueued;
 	}
@@ -631,6 +655,52 @@ eca_crypto_enq_flush(struct event_crypto_adapter *adapter)
 	return nb_enqueued;
 }
 
+/* Flush queue pairs whose aggregated ops exceeded the max hold time */
+static unsigned int
+eca_crypto_aggr_latency_flush(struct event_crypto_adapter *adapter)
+{
+	struct rte_event_crypto_adapter_stats *stats = &adapter->crypto_stats;
+	struct crypto_device_info *curr_dev;
+	struct crypto_queue_pair_info *curr_queue;
+	struct rte_cryptodev *dev;
+	uint64_t now = rte_rdtsc();
+	uint16_t nb_enqueued = 0;
+	uint16_t num_cdev = rte_cryptodev_count();
+	uint16_t n, qp;
+	uint8_t cdev_id;
+
+	for (cdev_id = 0; cdev_id < num_cdev; cdev_id++) {
+		curr_dev = &adapter->cdevs[cdev_id];
+		dev = rte_cryptodev_pmd_get_dev(cdev_id);
+
+		for (qp = 0; qp < dev->data->nb_queue_pairs; qp++) {
+
+			curr_queue = &curr_dev->qpairs[qp];
+			if (unlikely(curr_queue == NULL ||
+					!curr_queue->qp_enabled))
+				continue;
+
+			if (curr_queue->cbuf.count == 0 ||
+					now - curr_queue->aggr_start_tsc <
+					adapter->aggr_max_latency_cycles)
+				continue;
+
+			n = 0;
+			eca_circular_buffer_flush_to_cdev(&curr_queue->cbuf,
+							  cdev_id, qp, &n);
+			if (n)
+				stats->crypto_enq_burst_count++;
+			/* ops left by a partial flush restart the clock */
+			curr_queue->aggr_start_tsc = now;
+			nb_enqueued += n;
+		}
+	}
+
+	stats->crypto_enq_count += nb_enqueued;
+
+	return nb_enqueued;
+}
+
 static int
 eca_crypto_adapter_enq_run(struct event_crypto_adapter *adapter,
 			   unsigned int max_enq)
@@ -665,6 +735,9 @@ eca_crypto_adapter_enq_run(struct event_crypto_adapter *adapter,
 		nb_enqueued += eca_enq_to_cryptodev(adapter, ev, n);
 	}
 
+	if (adapter->aggr_max_latency_cycles != 0)
+		nb_enqueued += eca_crypto_aggr_latency_flush(adapter);
+
 	if ((++adapter->transmit_loop_count &
 		(CRYPTO_ENQ_FLUSH_THRESHOLD - 1)) == 0) {
 		nb_enqueued += eca_crypto_enq_flush(adapter);
@@ -1440,6 +1513,7 @@ rte_event_crypto_adapter_runtime_params_init(
 
 	memset(params, 0, sizeof(*params));
 	params->max_nb = DEFAULT_MAX_NB;
+	params->cdev_burst_size = DEFAULT_CDEV_BURST_SIZE;
 
 	return 0;
 }
@@ -1495,8 +1569,19 @@ rte_event_crypto_adapter_runtime_params_set(uint8_t id,
 	if (ret)
 		return ret;
 
+	if (params->cdev_burst_size > MAX_OPS_IN_BUFFER) {
+		RTE_EDEV_LOG_ERR("cdev burst size %" PRIu32 " exceeds max %d",
+				 params->cdev_burst_size, MAX_OPS_IN_BUFFER);
+		return -EINVAL;
+	}
+
 	rte_spinlock_lock(&adapter->lock);
 	adapter->max_nb = params->max_nb;
+	adapter->cdev_burst_size = params->cdev_burst_size ?
+			params->cdev_burst_size : DEFAULT_CDEV_BURST_SIZE;
+	adapter->aggr_max_latency_cycles =
+			(uint64_t)params->max_aggr_latency_us *
+			rte_get_tsc_hz() / US_PER_S;
 	rte_spinlock_unlock(&adapter->lock);
 
 	return 0;
@@ -1530,6 +1615,9 @@ rte_event_crypto_adapter_runtime_params_get(uint8_t id,
 		return ret;
 
 	params->max_nb = adapter->max_nb;
+	params->cdev_burst_size = adapter->cdev_burst_size;
+	params->max_aggr_latency_us = adapter->aggr_max_latency_cycles *
+			US_PER_S / rte_get_tsc_hz();
 
 	return 0;
 }
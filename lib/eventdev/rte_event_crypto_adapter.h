@@ -277,7 +277,25 @@ struct rte_event_crypto_adapter_runtime_params {
 	 * RTE_EVENT_CRYPTO_ADAPTER_CAP_INTERNAL_PORT_OP_FWD or
 	 * RTE_EVENT_CRYPTO_ADAPTER_CAP_INTERNAL_PORT_OP_NEW capability.
 	 */
-	uint32_t rsvd[15];
+	uint32_t cdev_burst_size;
+	/**< Number of crypto ops aggregated for a cryptodev queue pair
+	 * before they are enqueued to the cryptodev. Ops are binned per
+	 * queue pair, which preserves session affinity since a session is
+	 * processed on a single queue pair. 0 selects the default of 32;
+	 * the maximum is 128.
+	 *
+	 * This is valid only for devices without
+	 * RTE_EVENT_CRYPTO_ADAPTER_CAP_INTERNAL_PORT_OP_FWD or
+	 * RTE_EVENT_CRYPTO_ADAPTER_CAP_INTERNAL_PORT_OP_NEW capability.
+	 */
+	uint32_t max_aggr_latency_us;
+	/**< Upper bound on the time crypto ops may be held back waiting
+	 * for aggregation, in microseconds. Queue pairs holding ops older
+	 * than this are flushed even if cdev_burst_size has not been
+	 * reached. 0 disables the time-based flush, leaving partial bursts
+	 * to the adapter's periodic flush.
+	 */
+	uint32_t rsvd[13];
 	/**< Reserved fields for future expansion */
 };
 
@@ -400,6 +418,10 @@ struct rte_event_crypto_adapter_stats {
 	/**< Event enqueue retry count */
 	uint64_t event_enq_fail_count;
 	/**< Event enqueue fail count */
+	uint64_t crypto_enq_burst_count;
+	/**< Cryptodev enqueue burst count. The average achieved cryptodev
+	 * burst size is crypto_enq_count / crypto_enq_burst_count.
+	 */
 };
 
 /**
@@ -51,6 +51,12 @@ struct __rte_cache_aligned dma_vchan_info {
 
 	/* Circular buffer for batching DMA ops to dma_dev */
 	struct dma_ops_circular_buffer dma_buf;
+
+	/* Pending completion event vector, completion side (tqmap) only */
+	struct rte_event_vector *pend_vec;
+
+	/* Timestamp of the first completion aggregated in pend_vec */
+	uint64_t vec_start_tsc;
 };
 
 /* DMA device information */
@@ -144,6 +150,17 @@ struct __rte_cache_aligned event_dma_adapter {
 	/* Loop counter to flush dma ops */
 	uint16_t transmit_loop_count;
 
+	/* Mempool of rte_event_vector for completion aggregation,
+	 * NULL when completion vectorization is disabled
+	 */
+	struct rte_mempool *vector_mp;
+
+	/* Max completed ops carried per vector event */
+	uint16_t vector_sz;
+
+	/* Max time a partial vector may be held back */
+	uint64_t vector_timeout_cycles;
+
 	/* Per instance stats structure */
 	struct rte_event_dma_adapter_stats dma_stats;
 };
@@ -529,7 +546,13 @@ edma_enq_to_dma_dev(struct event_dma_adapter *adapter, struct rte_event *ev, uns
 		}
 		edma_circular_buffer_add(&vchan_qinfo->dma_buf, dma_op);
 
-		if (edma_circular_buffer_batch_ready(&vchan_qinfo->dma_buf)) {
+		/* Adapt the transfer batch size to vchan occupancy: while
+		 * the device is running dry, submit what is buffered right
+		 * away; once enough transfers are in flight to keep it
+		 * busy, aggregate full batches.
+		 */
+		if (edma_circular_buffer_batch_ready(&vchan_qinfo->dma_buf) ||
+		    adapter->dma_devs[dma_dev_id].tqmap[vchan].dma_buf.count < DMA_BATCH_SIZE) {
 			ret = edma_circular_buffer_flush_to_dma_dev(adapter, &vchan_qinfo->dma_buf,
 								    dma_dev_id, vchan,
 								    &nb_enqueued);
@@ -735,6 +758,112 @@ edma_ops_buffer_flush(struct event_dma_adapter *adapter)
 		;
 }
 
+/* Enqueue the vchan's pending completion vector as a single event */
+static inline void
+edma_vec_enqueue(struct event_dma_adapter *adapter, struct dma_vchan_info *tq)
+{
+	struct rte_event_dma_adapter_stats *stats = &adapter->dma_stats;
+	struct rte_event_vector *vec = tq->pend_vec;
+	struct rte_event_dma_adapter_op *op;
+	struct rte_event ev;
+	uint16_t nb_enqueued = 0;
+	uint8_t retry = 0;
+
+	if (vec == NULL || vec->nb_elem == 0)
+		return;
+
+	/* Scheduling attributes are taken from the first aggregated op */
+	op = vec->ptrs[0];
+	ev.event = op->event_meta;
+	ev.op = RTE_EVENT_OP_NEW;
+	ev.event_type = RTE_EVENT_TYPE_DMADEV_VECTOR;
+	ev.vec = vec;
+
+	do {
+		nb_enqueued = rte_event_enqueue_burst(adapter->eventdev_id,
+						      adapter->event_port_id, &ev, 1);
+	} while (retry++ < DMA_ADAPTER_MAX_EV_ENQ_RETRIES && nb_enqueued < 1);
+
+	tq->pend_vec = NULL;
+
+	if (nb_enqueued == 0) {
+		rte_mempool_put(adapter->vector_mp, vec);
+		stats->event_enq_fail_count += 1;
+		return;
+	}
+
+	stats->event_enq_count += 1;
+	stats->event_enq_retry_count += retry - 1;
+}
+
+/* Aggregate n completed ops from the vchan's transaction queue into
+ * vector events, emitting each vector as soon as it fills up.
+ */
+static inline void
+edma_vec_aggregate(struct event_dma_adapter *adapter, struct dma_vchan_info *tq, uint16_t n)
+{
+	struct dma_ops_circular_buffer *tq_buf = &tq->dma_buf;
+	struct rte_event_vector *vec;
+
+	while (n > 0) {
+		vec = tq->pend_vec;
+		if (vec == NULL) {
+			if (rte_mempool_get(adapter->vector_mp, (void **)&vec)) {
+				/* No vectors left, fall back to per-op events */
+				while (n-- > 0) {
+					edma_circular_buffer_add(&adapter->ebuf,
+								 tq_buf->op_buffer[tq_buf->head]);
+					tq_buf->head = (tq_buf->head + 1) % tq_buf->size;
+					tq_buf->count--;
+				}
+				return;
+			}
+			vec->nb_elem = 0;
+			vec->elem_offset = 0;
+			vec->attr_valid = 0;
+			tq->pend_vec = vec;
+			tq->vec_start_tsc = rte_rdtsc();
+		}
+
+		while (n > 0 && vec->nb_elem < adapter->vector_sz) {
+			vec->ptrs[vec->nb_elem++] = tq_buf->op_buffer[tq_buf->head];
+			tq_buf->head = (tq_buf->head + 1) % tq_buf->size;
+			tq_buf->count--;
+			n--;
+		}
+
+		if (vec->nb_elem >= adapter->vector_sz)
+			edma_vec_enqueue(adapter, tq);
+	}
+}
+
+/* Emit pending vectors that exceeded the vector timeout */
+static void
+edma_vec_timeout_flush(struct event_dma_adapter *adapter)
+{
+	struct dma_device_info *dev_info;
+	struct dma_vchan_info *tq;
+	uint64_t now = rte_rdtsc();
+	uint16_t num_dma_dev = rte_dma_count_avail();
+	int16_t dma_dev_id;
+	uint16_t vchan;
+
+	for (dma_dev_id = 0; dma_dev_id < num_dma_dev; dma_dev_id++) {
+		dev_info = &adapter->dma_devs[dma_dev_id];
+
+		for (vchan = 0; vchan < dev_info->num_vchanq; vchan++) {
+			tq = &dev_info->tqmap[vchan];
+			if (tq->pend_vec == NULL || tq->pend_vec->nb_elem == 0)
+				continue;
+
+			if (now - tq->vec_start_tsc < adapter->vector_timeout_cycles)
+				continue;
+
+			edma_vec_enqueue(adapter, tq);
+		}
+	}
+}
+
 static inline unsigned int
 edma_adapter_deq_run(struct event_dma_adapter *adapter, unsigned int max_deq)
 {
@@ -754,6 +883,9 @@ edma_adapter_deq_run(struct event_dma_adapter *adapter, unsigned int max_deq)
 	nb_deq = 0;
 	edma_ops_buffer_flush(adapter);
 
+	if (adapter->vector_mp != NULL && adapter->vector_timeout_cycles != 0)
+		edma_vec_timeout_flush(adapter);
+
 	num_dma_dev = rte_dma_count_avail();
 	do {
 		done = true;
@@ -778,6 +910,12 @@ edma_adapter_deq_run(struct event_dma_adapter *adapter, unsigned int max_deq)
 				done = false;
 				stats->dma_deq_count += n;
 
+				if (adapter->vector_mp != NULL) {
+					edma_vec_aggregate(adapter,
+							   &dev_info->tqmap[vchan], n);
+					goto check;
+				}
+
 				tq_buf = &dev_info->tqmap[vchan].dma_buf;
 
 				nb_enqueued = n;
@@ -1348,6 +1486,41 @@ rte_event_dma_adapter_runtime_params_get(uint8_t id,
 	return 0;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_event_dma_adapter_vector_config_set, 25.07)
+int
+rte_event_dma_adapter_vector_config_set(uint8_t id,
+		const struct rte_event_dma_adapter_vector_config *config)
+{
+	struct event_dma_adapter *adapter;
+
+	EVENT_DMA_ADAPTER_ID_VALID_OR_ERR_RET(id, -EINVAL);
+
+	adapter = edma_id_to_adapter(id);
+	if (adapter == NULL)
+		return -EINVAL;
+
+	if (config != NULL &&
+	    (config->vector_mp == NULL || config->vector_sz == 0)) {
+		RTE_EDEV_LOG_ERR("Invalid vector configuration");
+		return -EINVAL;
+	}
+
+	rte_spinlock_lock(&adapter->lock);
+	if (config == NULL) {
+		adapter->vector_mp = NULL;
+		adapter->vector_sz = 0;
+		adapter->vector_timeout_cycles = 0;
+	} else {
+		adapter->vector_mp = config->vector_mp;
+		adapter->vector_sz = config->vector_sz;
+		adapter->vector_timeout_cycles = config->vector_timeout_ns *
+				rte_get_tsc_hz() / NS_PER_S;
+	}
+	rte_spinlock_unlock(&adapter->lock);
+
+	return 0;
+}
+
 RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_event_dma_adapter_stats_get, 23.11)
 int
 rte_event_dma_adapter_stats_get(uint8_t id, struct rte_event_dma_adapter_stats *stats)
@@ -291,6 +291,27 @@ struct rte_event_dma_adapter_runtime_params {
 typedef int (*rte_event_dma_adapter_conf_cb)(uint8_t id, uint8_t evdev_id,
 					     struct rte_event_dma_adapter_conf *conf, void *arg);
 
+/**
+ * A structure to hold completion event vectorization configuration for an
+ * event DMA adapter instance.
+ *
+ * @see rte_event_dma_adapter_vector_config_set()
+ */
+struct rte_event_dma_adapter_vector_config {
+	struct rte_mempool *vector_mp;
+	/**< Pool of struct rte_event_vector, created with
+	 * rte_event_vector_pool_create() and sized for at least vector_sz
+	 * elements per vector.
+	 */
+	uint16_t vector_sz;
+	/**< Maximum number of completed DMA ops aggregated per vector event. */
+	uint64_t vector_timeout_ns;
+	/**< Maximum time a partially filled vector may be held back before it
+	 * is emitted, in nanoseconds. 0 means partial vectors are only
+	 * emitted when more completions arrive for the vchan.
+	 */
+};
+
 /**
  * A structure used to retrieve statistics for an event DMA adapter instance.
  */
@@ -539,6 +560,32 @@ __rte_experimental
 int rte_event_dma_adapter_runtime_params_get(uint8_t id,
 					     struct rte_event_dma_adapter_runtime_params *params);
 
+/**
+ * Configure completion event vectorization for an adapter instance.
+ *
+ * When configured, the adapter aggregates completed DMA ops per vchan and
+ * emits events of type RTE_EVENT_TYPE_DMADEV_VECTOR whose rte_event_vector
+ * carries an array of struct rte_event_dma_adapter_op pointers, instead of
+ * one event per completed op. The scheduling attributes of a vector event
+ * are taken from the event metadata of the first aggregated op. Vector
+ * events are enqueued with RTE_EVENT_OP_NEW.
+ *
+ * This function should be called before the adapter is started. It is only
+ * valid for adapters using the software transfer mechanism.
+ *
+ * @param id
+ *  Adapter identifier.
+ * @param config
+ *  Vectorization configuration, or NULL to disable vectorization.
+ *
+ * @return
+ *  - 0: Success.
+ *  - <0: Error code on failure.
+ */
+__rte_experimental
+int rte_event_dma_adapter_vector_config_set(uint8_t id,
+		const struct rte_event_dma_adapter_vector_config *config);
+
 /**
  * Retrieve statistics for an adapter
  *
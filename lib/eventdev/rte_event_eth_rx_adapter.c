@@ -119,6 +119,12 @@ struct __rte_cache_aligned event_eth_rx_adapter {
 	rte_spinlock_t rx_lock;
 	/* Max mbufs processed in any service function invocation */
 	uint32_t max_nb_rx;
+	/* Lower bound on max_nb_rx when the batching governor is enabled */
+	uint32_t gov_min_nb_rx;
+	/* Upper bound on max_nb_rx, zero when the governor is disabled */
+	uint32_t gov_max_nb_rx;
+	/* Event buffer flush threshold, adjusted by the batching governor */
+	uint16_t flush_threshold;
 	/* Receive queues that need to be polled */
 	struct eth_rx_poll_entry *eth_rx_poll;
 	/* Size of the eth_rx_poll array */
@@ -1027,6 +1033,44 @@ rxa_pkt_buf_available(struct eth_event_enqueue_buffer *buf)
 	return nb_req <= buf->head;
 }
 
+/* Event buffer flush threshold, clamped so that there is always room
+ * to buffer one more Rx burst before the next flush attempt.
+ */
+static __rte_always_inline uint16_t
+rxa_flush_threshold(struct event_eth_rx_adapter *rx_adapter,
+		    struct eth_event_enqueue_buffer *buf)
+{
+	return RTE_MIN(rx_adapter->flush_threshold,
+		       (uint16_t)(buf->events_size - BATCH_SIZE));
+}
+
+/* Feedback-driven adjustment of the adapter work budget and of the event
+ * buffer flush threshold. Exhausting the budget within a service
+ * invocation means the Rx queues are backlogged, so the batch is grown to
+ * amortize per-event enqueue costs. Harvesting less than one Rx burst
+ * means the adapter is underloaded, so both values shrink back toward
+ * their lower bounds to flush events, and bound their latency, sooner.
+ */
+static inline void
+rxa_gov_update(struct event_eth_rx_adapter *rx_adapter, uint32_t nb_rx)
+{
+	if (rx_adapter->gov_max_nb_rx == 0)
+		return;
+
+	if (nb_rx >= rx_adapter->max_nb_rx) {
+		rx_adapter->max_nb_rx = RTE_MIN(rx_adapter->max_nb_rx * 2,
+						rx_adapter->gov_max_nb_rx);
+		rx_adapter->flush_threshold =
+			RTE_MIN((uint32_t)rx_adapter->flush_threshold * 2,
+				(uint32_t)UINT16_MAX / 2);
+	} else if (nb_rx < BATCH_SIZE) {
+		rx_adapter->max_nb_rx = RTE_MAX(rx_adapter->max_nb_rx / 2,
+						rx_adapter->gov_min_nb_rx);
+		rx_adapter->flush_threshold =
+			RTE_MAX(rx_adapter->flush_threshold / 2, BATCH_SIZE);
+	}
+}
+
 /* Enqueue packets from  <port, q>  to event buffer */
 static inline uint32_t
 rxa_eth_rx(struct event_eth_rx_adapter *rx_adapter, uint16_t port_id,
@@ -1045,7 +1089,7 @@ rxa_eth_rx(struct event_eth_rx_adapter *rx_adapter, uint16_t port_id,
 	 * enough space in the enqueue buffer.
 	 */
 	while (rxa_pkt_buf_available(buf)) {
-		if (buf->count >= BATCH_SIZE)
+		if (buf->count >= rxa_flush_threshold(rx_adapter, buf))
 			nb_flushed +=
 				rxa_flush_event_buffer(rx_adapter, buf, stats);
 
@@ -1211,7 +1255,7 @@ rxa_intr_ring_dequeue(struct event_eth_rx_adapter *rx_adapter)
 	stats = &rx_adapter->stats;
 	ring_lock = &rx_adapter->intr_ring_lock;
 
-	if (buf->count >= BATCH_SIZE) {
+	if (buf->count >= rxa_flush_threshold(rx_adapter, buf)) {
 		uint16_t n;
 
 		n = rxa_flush_event_buffer(rx_adapter, buf, stats);
@@ -1300,6 +1344,7 @@ rxa_intr_ring_dequeue(struct event_eth_rx_adapter *rx_adapter)
 	}
 
 done:
+	rxa_gov_update(rx_adapter, nb_rx);
 	if (nb_rx > 0) {
 		rx_adapter->stats.rx_intr_packets += nb_rx;
 		work = true;
@@ -1313,7 +1358,9 @@ done:
  * packets to the event device.
  *
  * The receive code enqueues initially to a temporary buffer, the
- * temporary buffer is drained anytime it holds >= BATCH_SIZE packets
+ * temporary buffer is drained anytime it holds a flush threshold worth
+ * of packets (>= BATCH_SIZE by default, adjusted between the configured
+ * bounds when the batching governor is enabled)
  *
  * If there isn't space available in the temporary buffer, packets from the
  * Rx queue aren't dequeued from the eth device, this back pressures the
@@ -1346,7 +1393,7 @@ rxa_poll(struct event_eth_rx_adapter *rx_adapter)
 		/* Don't do a batch dequeue from the rx queue if there isn't
 		 * enough space in the enqueue buffer.
 		 */
-		if (buf->count >= BATCH_SIZE) {
+		if (buf->count >= rxa_flush_threshold(rx_adapter, buf)) {
 			uint16_t n;
 
 			n = rxa_flush_event_buffer(rx_adapter, buf, stats);
@@ -1376,6 +1423,9 @@ poll_next_entry:
 			wrr_pos = 0;
 	}
 
+	if (rx_adapter->wrr_len)
+		rxa_gov_update(rx_adapter, nb_rx);
+
 	if (nb_rx > 0)
 		work = true;
 
@@ -2454,6 +2504,11 @@ rxa_create(uint8_t id, uint8_t dev_id,
 	for (i = 0; i < RTE_MAX_ETHPORTS; i++)
 		rx_adapter->eth_devices[i].dev = &rte_eth_devices[i];
 
+	/* Batching governor bounds, zero bounds leave it disabled */
+	rx_adapter->gov_min_nb_rx = rxa_params->batch_min_nb_rx;
+	rx_adapter->gov_max_nb_rx = rxa_params->batch_max_nb_rx;
+	rx_adapter->flush_threshold = BATCH_SIZE;
+
 	/* Rx adapter event buffer allocation */
 	rx_adapter->use_queue_event_buf = rxa_params->use_queue_event_buf;
 
@@ -2503,9 +2558,23 @@ rxa_config_params_validate(struct rte_event_eth_rx_adapter_params *rxa_params,
 		RTE_EDEV_LOG_ERR("event buffer size needs to be configured "
 				 "as part of queue add");
 		return -EINVAL;
+	} else if (rxa_params->batch_max_nb_rx == 0 &&
+		   rxa_params->batch_min_nb_rx != 0) {
+		RTE_EDEV_LOG_ERR("batching governor needs a non-zero "
+				 "batch_max_nb_rx");
+		return -EINVAL;
+	} else if (rxa_params->batch_max_nb_rx != 0 &&
+		   rxa_params->batch_max_nb_rx < rxa_params->batch_min_nb_rx) {
+		RTE_EDEV_LOG_ERR("batch_max_nb_rx can't be less than "
+				 "batch_min_nb_rx");
+		return -EINVAL;
 	}
 
 	*temp_params = *rxa_params;
+	/* the governor never shrinks the work budget below one Rx burst */
+	if (temp_params->batch_max_nb_rx != 0 &&
+	    temp_params->batch_min_nb_rx < BATCH_SIZE)
+		temp_params->batch_min_nb_rx = BATCH_SIZE;
 	/* adjust event buff size with BATCH_SIZE used for fetching
 	 * packets from NIC rx queues to get full buffer utilization
 	 * and prevent unnecessary rollovers.
@@ -303,6 +303,23 @@ struct rte_event_eth_rx_adapter_params {
 	 */
 	bool use_queue_event_buf;
 	/**< flag to indicate that event buffer is separate for each queue */
+	uint32_t batch_min_nb_rx;
+	/**< Lower bound on the adapter work budget when the batching
+	 * governor is enabled. A zero value defaults to the Rx burst size
+	 * used by the adapter. Ignored when batch_max_nb_rx is zero.
+	 * @see batch_max_nb_rx
+	 */
+	uint32_t batch_max_nb_rx;
+	/**< Upper bound on the adapter work budget when the batching
+	 * governor is enabled. A non-zero value enables the governor: the
+	 * adapter then adjusts the max_nb_rx work budget and the event
+	 * buffer flush threshold between the configured bounds, based on
+	 * how much of the budget recent service invocations consumed.
+	 * Zero disables the governor and retains the fixed max_nb_rx
+	 * behavior.
+	 *
+	 * This is valid only for adapters that use a service function.
+	 */
 };
 
 /**
@@ -16,6 +16,7 @@
 #include <rte_errno.h>
 #include <rte_malloc.h>
 #include <rte_mempool.h>
+#include <rte_ring.h>
 #include <rte_common.h>
 #include <rte_timer.h>
 #include <rte_service_component.h>
@@ -524,6 +525,17 @@ rte_event_timer_remaining_ticks_get(
 
 #define EXP_TIM_BUF_SZ 128
 
+/* Per-lcore staging ring sizing and drain batch size used when arm/cancel
+ * requests are deferred to the adapter service
+ */
+#define STAGING_RING_SZ 8192
+#define STAGING_DRAIN_SZ 64
+
+/* The low bit of a staging ring entry distinguishes cancel requests from arm
+ * requests; timer objects come from a mempool and are suitably aligned.
+ */
+#define STAGING_CANCEL_REQ 0x1UL
+
 struct __rte_cache_aligned event_buffer {
 	size_t head;
 	size_t tail;
@@ -655,6 +667,14 @@ struct swtim {
 	struct rte_timer *expired_timers[EXP_TIM_BUF_SZ];
 	/* The number of timers that can be returned to a mempool */
 	size_t n_expired_timers;
+	/* Nonzero if arm/cancel requests are deferred to the service */
+	uint8_t deferred;
+	/* The number of lcores with a request staging ring */
+	uint16_t n_staging_lcores;
+	/* Lcores with a request staging ring */
+	uint16_t staging_lcores[RTE_MAX_LCORE];
+	/* Per-lcore rings used to stage deferred arm/cancel requests */
+	struct rte_ring *staging_ring[RTE_MAX_LCORE];
 };
 
 static inline struct swtim *
@@ -682,6 +702,22 @@ swtim_callback(struct rte_timer *tim)
 	sw = swtim_pmd_priv(adapter);
 	type = get_timer_type(adapter);
 
+	if (sw->deferred) {
+		enum rte_event_timer_state n_state = RTE_EVENT_TIMER_ARMED;
+
+		/* A deferred timer can be cancelled up until its cancel
+		 * request is drained from a staging ring; claim the expiry
+		 * here, or leave the timer object for the cancel request to
+		 * return to the mempool.
+		 */
+		if (evtim->impl_opaque[0] != (uintptr_t)tim ||
+		    !rte_atomic_compare_exchange_strong_explicit(&evtim->state,
+				&n_state, RTE_EVENT_TIMER_NOT_ARMED,
+				rte_memory_order_acq_rel,
+				rte_memory_order_relaxed))
+			return;
+	}
+
 	if (unlikely(sw->in_use[lcore].v == 0)) {
 		sw->in_use[lcore].v = 1;
 		n_lcores = rte_atomic_fetch_add_explicit(&sw->n_poll_lcores, 1,
@@ -704,6 +740,13 @@ swtim_callback(struct rte_timer *tim)
 						"reset timer with immediate "
 						"expiry value");
 			} else {
+				/* Reopen the claim taken above so the retried
+				 * expiry can claim the timer again
+				 */
+				if (sw->deferred)
+					rte_atomic_store_explicit(&evtim->state,
+							RTE_EVENT_TIMER_ARMED,
+							rte_memory_order_release);
 				sw->stats.evtim_retry_count++;
 				EVTIM_LOG_DBG("event buffer full, resetting "
 						"rte_timer with immediate "
@@ -850,6 +893,104 @@ check_destination_event_queue(struct rte_event_timer *evtim,
 	return -1;
 }
 
+/* Insert a staged timer into the timer list of the lcore running the adapter
+ * service. A timer cancelled while it was still staged is skipped here; the
+ * matching cancel request returns it to the mempool.
+ */
+static void
+swtim_staged_arm(struct swtim *sw, struct rte_timer *tim,
+		 unsigned int lcore_id)
+{
+	struct rte_event_timer *evtim = tim->arg;
+	enum rte_event_timer_state n_state;
+	uint64_t now, cycles;
+	int ret;
+
+	n_state = rte_atomic_load_explicit(&evtim->state,
+					   rte_memory_order_acquire);
+	if (n_state != RTE_EVENT_TIMER_ARMED ||
+	    evtim->impl_opaque[0] != (uintptr_t)tim)
+		return;
+
+	/* The absolute expiry deadline was latched in the timer object when
+	 * the arm request was staged.
+	 */
+	now = rte_get_timer_cycles();
+	cycles = tim->expire > now ? tim->expire - now : 0;
+
+	ret = rte_timer_alt_reset(sw->timer_data_id, tim, cycles, SINGLE,
+				  lcore_id, NULL, evtim);
+	if (unlikely(ret < 0)) {
+		rte_atomic_store_explicit(&evtim->state, RTE_EVENT_TIMER_ERROR,
+				rte_memory_order_release);
+		rte_mempool_put(sw->tim_pool, tim);
+	}
+}
+
+/* Complete a staged cancellation. The matching arm request was drained from
+ * the same staging ring earlier, so the timer is either pending in a timer
+ * list or was never inserted; in both cases it can be returned to the
+ * mempool here.
+ */
+static void
+swtim_staged_cancel(struct swtim *sw, struct rte_timer *tim)
+{
+	rte_timer_alt_stop(sw->timer_data_id, tim);
+	rte_mempool_put(sw->tim_pool, tim);
+}
+
+/* Commit staged arm requests and complete staged cancellations. All timer
+ * list manipulation for a deferred adapter happens here, in the context of
+ * the lcore running the adapter service, so the arm and cancel fast paths
+ * never contend on the timer list locks.
+ */
+static void
+swtim_staging_drain(struct swtim *sw)
+{
+	void *reqs[STAGING_DRAIN_SZ];
+	unsigned int lcore_id = rte_lcore_id();
+	uint16_t exp_state = 0;
+	unsigned int i, n;
+	int n_lcores;
+	uint16_t l;
+
+	if (lcore_id == LCORE_ID_ANY)
+		lcore_id = RTE_MAX_LCORE - 1;
+
+	/* All deferred timers are inserted into the timer list of the lcore
+	 * running the service; make sure it is polled.
+	 */
+	if (unlikely(rte_atomic_compare_exchange_strong_explicit(
+			&sw->in_use[lcore_id].v, &exp_state, 1,
+			rte_memory_order_relaxed, rte_memory_order_relaxed))) {
+		EVTIM_LOG_DBG("Adding lcore id = %u to list of lcores to poll",
+			      lcore_id);
+		n_lcores = rte_atomic_fetch_add_explicit(&sw->n_poll_lcores, 1,
+					     rte_memory_order_relaxed);
+		rte_atomic_store_explicit(&sw->poll_lcores[n_lcores], lcore_id,
+				rte_memory_order_relaxed);
+	}
+
+	for (l = 0; l < sw->n_staging_lcores; l++) {
+		struct rte_ring *r = sw->staging_ring[sw->staging_lcores[l]];
+
+		do {
+			n = rte_ring_dequeue_burst(r, reqs, STAGING_DRAIN_SZ,
+						   NULL);
+			for (i = 0; i < n; i++) {
+				struct rte_timer *tim = (struct rte_timer *)
+					((uintptr_t)reqs[i] &
+					 ~STAGING_CANCEL_REQ);
+
+				if ((uintptr_t)reqs[i] & STAGING_CANCEL_REQ)
+					swtim_staged_cancel(sw, tim);
+				else
+					swtim_staged_arm(sw, tim, lcore_id);
+			}
+		} while (n == STAGING_DRAIN_SZ);
+	}
+}
+
 static int
 swtim_service_func(void *arg)
 {
@@ -859,6 +1000,9 @@ swtim_service_func(void *arg)
 	uint16_t nb_evs_invalid = 0;
 	const uint64_t prior_enq_count = sw->stats.ev_enq_count;
 
+	if (sw->deferred)
+		swtim_staging_drain(sw);
+
 	if (swtim_did_tick(sw)) {
 		rte_timer_alt_manage(sw->timer_data_id,
 				     (unsigned int *)(uintptr_t)sw->poll_lcores,
@@ -918,6 +1062,58 @@ compute_msg_mempool_cache_size(uint64_t nb_requested, uint64_t nb_actual)
 	return cache_size;
 }
 
+static void
+swtim_staging_rings_free(struct swtim *sw)
+{
+	uint16_t i;
+
+	for (i = 0; i < sw->n_staging_lcores; i++) {
+		rte_ring_free(sw->staging_ring[sw->staging_lcores[i]]);
+		sw->staging_ring[sw->staging_lcores[i]] = NULL;
+	}
+
+	sw->n_staging_lcores = 0;
+}
+
+/* In deferred mode, each lcore that can arm timers gets a staging ring that
+ * carries its arm/cancel requests to the adapter service. Rings are created
+ * for all enabled lcores, plus the slot that non-EAL threads are mapped to.
+ */
+static int
+swtim_staging_rings_alloc(struct swtim *sw)
+{
+	struct rte_event_timer_adapter *adapter = sw->adapter;
+	char ring_name[RTE_RING_NAMESIZE];
+	unsigned int lcore_id, size;
+	struct rte_ring *r;
+
+	size = rte_align32pow2((uint32_t)RTE_MIN(
+			adapter->data->conf.nb_timers + 1,
+			(uint64_t)STAGING_RING_SZ));
+
+	for (lcore_id = 0; lcore_id < RTE_MAX_LCORE; lcore_id++) {
+		if (!rte_lcore_is_enabled(lcore_id) &&
+		    lcore_id != RTE_MAX_LCORE - 1)
+			continue;
+
+		snprintf(ring_name, sizeof(ring_name), "swtim_stg_%"PRIu8"_%u",
+			 adapter->data->id, lcore_id);
+		r = rte_ring_create(ring_name, size, adapter->data->socket_id,
+				    RING_F_SC_DEQ);
+		if (r == NULL) {
+			EVTIM_LOG_ERR("failed to create request staging ring "
+				      "for lcore %u", lcore_id);
+			swtim_staging_rings_free(sw);
+			return -ENOMEM;
+		}
+
+		sw->staging_ring[lcore_id] = r;
+		sw->staging_lcores[sw->n_staging_lcores++] = lcore_id;
+	}
+
+	return 0;
+}
+
 static int
 swtim_init(struct rte_event_timer_adapter *adapter)
 {
@@ -991,6 +1187,24 @@ swtim_init(struct rte_event_timer_adapter *adapter)
 
 	sw->adapter = adapter;
 
+	if (adapter->data->conf.flags & RTE_EVENT_TIMER_ADAPTER_F_DEFERRED_ARM) {
+		if (adapter->data->conf.flags &
+		    RTE_EVENT_TIMER_ADAPTER_F_PERIODIC) {
+			EVTIM_LOG_ERR("periodic timers cannot be combined "
+				      "with deferred arm mode");
+			rte_errno = ENOTSUP;
+			goto free_mempool;
+		}
+
+		ret = swtim_staging_rings_alloc(sw);
+		if (ret < 0) {
+			rte_errno = -ret;
+			goto free_mempool;
+		}
+
+		sw->deferred = 1;
+	}
+
 	/* Register a service component to run adapter logic */
 	memset(&service, 0, sizeof(service));
 	snprintf(service.name, RTE_SERVICE_NAME_MAX,
@@ -1006,7 +1220,7 @@ swtim_init(struct rte_event_timer_adapter *adapter)
 			      ret);
 
 		rte_errno = ENOSPC;
-		goto free_mempool;
+		goto free_rings;
 	}
 
 	EVTIM_LOG_DBG("registered service %s with id %"PRIu32, service.name,
@@ -1016,6 +1230,8 @@ swtim_init(struct rte_event_timer_adapter *adapter)
 	adapter->data->service_inited = 1;
 
 	return 0;
+free_rings:
+	swtim_staging_rings_free(sw);
 free_mempool:
 	rte_mempool_free(sw->tim_pool);
 free_alloc:
@@ -1040,6 +1256,12 @@ swtim_uninit(struct rte_event_timer_adapter *adapter)
 	int ret;
 	struct swtim *sw = swtim_pmd_priv(adapter);
 
+	/* Resolve any requests still sitting in staging rings so that the
+	 * timer objects they reference are accounted for below.
+	 */
+	if (sw->deferred)
+		swtim_staging_drain(sw);
+
 	/* Free outstanding timers */
 	rte_timer_stop_all(sw->timer_data_id,
 			   (unsigned int *)(uintptr_t)sw->poll_lcores,
@@ -1059,6 +1281,7 @@ swtim_uninit(struct rte_event_timer_adapter *adapter)
 		return ret;
 	}
 
+	swtim_staging_rings_free(sw);
 	rte_mempool_free(sw->tim_pool);
 	rte_free(sw);
 	adapter->data->adapter_priv = NULL;
@@ -1180,6 +1403,203 @@ swtim_remaining_ticks_get(const struct rte_event_timer_adapter *adapter,
 	return 0;
 }
 
+/* Validate and stage a burst of arm requests in the staging ring of the
+ * calling lcore; the adapter service commits them to the timer lists. The
+ * ring enqueue publishes the timer state and adapter specific data to the
+ * service with release ordering.
+ */
+static uint16_t
+swtim_stage_arm_burst(const struct rte_event_timer_adapter *adapter,
+		struct rte_event_timer **evtims,
+		uint16_t nb_evtims)
+{
+	int i, ret;
+	struct swtim *sw = swtim_pmd_priv(adapter);
+	uint32_t lcore_id = rte_lcore_id();
+	struct rte_timer *tim, *tims[nb_evtims];
+	struct rte_ring *staging_ring;
+	uint64_t cycles;
+	enum rte_event_timer_state n_state;
+
+#ifdef RTE_LIBRTE_EVENTDEV_DEBUG
+	/* Check that the service is running. */
+	if (rte_service_runstate_get(adapter->data->service_id) != 1) {
+		rte_errno = EINVAL;
+		return 0;
+	}
+#endif
+
+	/* Adjust lcore_id if non-EAL thread; such threads share the staging
+	 * ring of the highest lcore
+	 */
+	if (lcore_id == LCORE_ID_ANY)
+		lcore_id = RTE_MAX_LCORE - 1;
+
+	staging_ring = sw->staging_ring[lcore_id];
+
+	nb_evtims = RTE_MIN(nb_evtims,
+			    (uint16_t)rte_ring_free_count(staging_ring));
+	if (nb_evtims == 0) {
+		rte_errno = ENOSPC;
+		return 0;
+	}
+
+	ret = rte_mempool_get_bulk(sw->tim_pool, (void **)tims, nb_evtims);
+	if (ret < 0) {
+		rte_errno = ENOSPC;
+		return 0;
+	}
+
+	for (i = 0; i < nb_evtims; i++) {
+		n_state = rte_atomic_load_explicit(&evtims[i]->state, rte_memory_order_acquire);
+		if (n_state == RTE_EVENT_TIMER_ARMED) {
+			rte_errno = EALREADY;
+			break;
+		} else if (!(n_state == RTE_EVENT_TIMER_NOT_ARMED ||
+			     n_state == RTE_EVENT_TIMER_CANCELED)) {
+			rte_errno = EINVAL;
+			break;
+		}
+
+		if (unlikely(check_destination_event_queue(evtims[i],
+							   adapter) < 0)) {
+			rte_atomic_store_explicit(&evtims[i]->state,
+					RTE_EVENT_TIMER_ERROR,
+					rte_memory_order_relaxed);
+			rte_errno = EINVAL;
+			break;
+		}
+
+		ret = get_timeout_cycles(evtims[i], adapter, &cycles);
+		if (unlikely(ret == -1)) {
+			rte_atomic_store_explicit(&evtims[i]->state,
+					RTE_EVENT_TIMER_ERROR_TOOLATE,
+					rte_memory_order_relaxed);
+			rte_errno = EINVAL;
+			break;
+		} else if (unlikely(ret == -2)) {
+			rte_atomic_store_explicit(&evtims[i]->state,
+					RTE_EVENT_TIMER_ERROR_TOOEARLY,
+					rte_memory_order_relaxed);
+			rte_errno = EINVAL;
+			break;
+		}
+
+		tim = tims[i];
+		rte_timer_init(tim);
+
+		/* Latch the request in the timer object; the service computes
+		 * the relative expiry against this absolute deadline when it
+		 * commits the request.
+		 */
+		tim->arg = evtims[i];
+		tim->expire = rte_get_timer_cycles() + cycles;
+
+		evtims[i]->impl_opaque[0] = (uintptr_t)tim;
+		evtims[i]->impl_opaque[1] = (uintptr_t)adapter;
+
+		rte_atomic_store_explicit(&evtims[i]->state, RTE_EVENT_TIMER_ARMED,
+				rte_memory_order_release);
+
+		if (unlikely(rte_ring_enqueue(staging_ring, tim) != 0)) {
+			/* Only possible when non-EAL threads sharing the
+			 * fallback staging ring filled it concurrently; the
+			 * request was never published, so roll it back.
+			 */
+			rte_atomic_store_explicit(&evtims[i]->state, n_state,
+					rte_memory_order_release);
+			rte_errno = ENOSPC;
+			break;
+		}
+
+		EVTIM_LOG_DBG("staged an event timer arm request");
+	}
+
+	if (i < nb_evtims)
+		rte_mempool_put_bulk(sw->tim_pool,
+				     (void **)&tims[i], nb_evtims - i);
+
+	return i;
+}
+
+/* Validate and stage a burst of cancellations in the staging ring of the
+ * calling lcore. Per-lcore ordering guarantees the service drains the
+ * matching arm request first.
+ */
+static uint16_t
+swtim_stage_cancel_burst(const struct rte_event_timer_adapter *adapter,
+		struct rte_event_timer **evtims,
+		uint16_t nb_evtims)
+{
+	int i;
+	struct rte_timer *timp;
+	uint64_t opaque;
+	struct swtim *sw = swtim_pmd_priv(adapter);
+	uint32_t lcore_id = rte_lcore_id();
+	struct rte_ring *staging_ring;
+	enum rte_event_timer_state n_state;
+
+#ifdef RTE_LIBRTE_EVENTDEV_DEBUG
+	/* Check that the service is running. */
+	if (rte_service_runstate_get(adapter->data->service_id) != 1) {
+		rte_errno = EINVAL;
+		return 0;
+	}
+#endif
+
+	if (lcore_id == LCORE_ID_ANY)
+		lcore_id = RTE_MAX_LCORE - 1;
+
+	staging_ring = sw->staging_ring[lcore_id];
+
+	for (i = 0; i < nb_evtims; i++) {
+		/* Don't modify the event timer state in these cases */
+		/* ACQUIRE ordering guarantees the access of implementation
+		 * specific opaque data under the correct state.
+		 */
+		n_state = rte_atomic_load_explicit(&evtims[i]->state, rte_memory_order_acquire);
+		if (n_state == RTE_EVENT_TIMER_CANCELED) {
+			rte_errno = EALREADY;
+			break;
+		} else if (n_state != RTE_EVENT_TIMER_ARMED) {
+			rte_errno = EINVAL;
+			break;
+		}
+
+		if (unlikely(rte_ring_free_count(staging_ring) == 0)) {
+			rte_errno = ENOSPC;
+			break;
+		}
+
+		opaque = evtims[i]->impl_opaque[0];
+		timp = (struct rte_timer *)(uintptr_t)opaque;
+		RTE_ASSERT(timp != NULL);
+
+		/* Claim the timer; an expiry that raced ahead of us owns the
+		 * timer object instead, and the cancel fails.
+		 */
+		if (!rte_atomic_compare_exchange_strong_explicit(&evtims[i]->state,
+				&n_state, RTE_EVENT_TIMER_CANCELED,
+				rte_memory_order_acq_rel,
+				rte_memory_order_relaxed)) {
+			rte_errno = EAGAIN;
+			break;
+		}
+
+		/* Cannot fail in practice: only threads mapped to this
+		 * staging ring can have consumed the free slot observed
+		 * above, and a given timer is armed and cancelled from a
+		 * single thread.
+		 */
+		while (rte_ring_enqueue(staging_ring,
+				(void *)((uintptr_t)timp |
+					 STAGING_CANCEL_REQ)) != 0)
+			rte_pause();
+	}
+
+	return i;
+}
+
 static uint16_t
 __swtim_arm_burst(const struct rte_event_timer_adapter *adapter,
 		struct rte_event_timer **evtims,
@@ -1196,6 +1616,9 @@ __swtim_arm_burst(const struct rte_event_timer_adapter *adapter,
 	enum rte_event_timer_state n_state;
 	enum rte_timer_type type = SINGLE;
 
+	if (sw->deferred)
+		return swtim_stage_arm_burst(adapter, evtims, nb_evtims);
+
 #ifdef RTE_LIBRTE_EVENTDEV_DEBUG
 	/* Check that the service is running. */
 	if (rte_service_runstate_get(adapter->data->service_id) != 1) {
@@ -1322,6 +1745,9 @@ swtim_cancel_burst(const struct rte_event_timer_adapter *adapter,
 	struct swtim *sw = swtim_pmd_priv(adapter);
 	enum rte_event_timer_state n_state;
 
+	if (sw->deferred)
+		return swtim_stage_cancel_burst(adapter, evtims, nb_evtims);
+
 #ifdef RTE_LIBRTE_EVENTDEV_DEBUG
 	/* Check that the service is running. */
 	if (rte_service_runstate_get(adapter->data->service_id) != 1) {
@@ -156,6 +156,21 @@ enum rte_event_timer_adapter_clk_src {
  *
  * @see struct rte_event_timer_adapter_conf::flags
  */
+#define RTE_EVENT_TIMER_ADAPTER_F_DEFERRED_ARM	(1ULL << 3)
+/**< Flag to configure an event timer adapter to stage arm and cancel requests
+ * in per-lcore buffers which the adapter service commits to the timer backend
+ * in batches, instead of updating shared timer state from the calling thread.
+ * This removes contention from the arm and cancel fast paths at the cost of
+ * requests taking effect up to one adapter service iteration later.
+ *
+ * A given event timer must be armed and cancelled from the same thread, and a
+ * cancelled event timer structure must remain valid until the adapter service
+ * has run again. This mode is only supported by the software implementation
+ * of the adapter, and cannot be combined with
+ * RTE_EVENT_TIMER_ADAPTER_F_PERIODIC.
+ *
+ * @see struct rte_event_timer_adapter_conf::flags
+ */
 
 /**
  * Timer adapter configuration structure
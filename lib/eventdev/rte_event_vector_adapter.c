@@ -25,6 +25,7 @@
 #define DATA_MZ_NAME_FORMAT "vector_adapter_data_%d_%d_%d"
 #define MAX_VECTOR_SIZE	    1024
 #define MIN_VECTOR_SIZE	    1
+#define MAX_FLOW_SLOTS	    256
 #define MAX_VECTOR_NS	    1E9
 #define MIN_VECTOR_NS	    1E5
 #define SERVICE_RING_SZ	    1024
@@ -86,6 +87,14 @@ validate_conf(const struct rte_event_vector_adapter_conf *conf,
 		return rc;
 	}
 
+	if (conf->nb_flow_slots != 0 &&
+	    (conf->nb_flow_slots > info->max_flow_slots ||
+	     !rte_is_power_of_2(conf->nb_flow_slots))) {
+		EVVEC_LOG_DBG("invalid flow slot count %u, should be a power of 2 not exceeding %u",
+			      conf->nb_flow_slots, info->max_flow_slots);
+		return rc;
+	}
+
 	if (info->log2_sz && rte_is_power_of_2(conf->vector_sz) != 0) {
 		EVVEC_LOG_DBG("invalid vector size %u, should be a power of 2", conf->vector_sz);
 		return rc;
@@ -492,16 +501,25 @@ rte_event_vector_adapter_stats_reset(struct rte_event_vector_adapter *adapter)
 /* Software vector adapter implementation. */
 
 struct sw_vector_adapter_service_data;
+struct sw_vector_slot {
+	uint64_t timestamp;
+	uint32_t flow_id;
+	struct rte_event_vector *vector;
+};
+
 struct sw_vector_adapter_data {
 	uint8_t dev_id;
 	uint8_t port_id;
+	uint8_t flow_aware;
 	uint16_t vector_sz;
+	uint16_t nb_slots;
+	uint32_t slot_mask;
 	uint64_t timestamp;
 	uint64_t event_meta;
 	uint64_t vector_tmo_ticks;
 	uint64_t fallback_event_meta;
 	struct rte_mempool *vector_mp;
-	struct rte_event_vector *vector;
+	struct sw_vector_slot *slots;
 	rte_spinlock_t lock;
 	struct rte_event_vector_adapter *adapter;
 	struct rte_event_vector_adapter_stats stats;
@@ -523,23 +541,74 @@ sw_vector_adapter_priv(const struct rte_event_vector_adapter *adapter)
 }
 
 static int
-sw_vector_adapter_flush(struct sw_vector_adapter_data *sw)
+sw_vector_adapter_flush(struct sw_vector_adapter_data *sw, struct sw_vector_slot *slot)
 {
 	struct rte_event ev;
 
-	if (sw->vector == NULL)
+	if (slot->vector == NULL)
 		return -ENOBUFS;
 
 	ev.event = sw->event_meta;
-	ev.vec = sw->vector;
+	if (sw->flow_aware)
+		ev.flow_id = slot->flow_id;
+	ev.vec = slot->vector;
 	if (rte_event_enqueue_burst(sw->dev_id, sw->port_id, &ev, 1) != 1)
 		return -ENOSPC;
 
-	sw->vector = NULL;
-	sw->timestamp = 0;
+	slot->vector = NULL;
+	slot->timestamp = 0;
 	return 0;
 }
 
+static int
+sw_vector_adapter_in_progress(const struct sw_vector_adapter_data *sw)
+{
+	uint32_t i;
+
+	for (i = 0; i < sw->nb_slots; i++)
+		if (sw->slots[i].vector != NULL)
+			return 1;
+
+	return 0;
+}
+
+/* Recompute the cached timestamp of the oldest in-progress slot, the fast
+ * path only lowers it so a flushed slot may leave it stale until the next
+ * service scan.
+ */
+static void
+sw_vector_adapter_update_deadline(struct sw_vector_adapter_data *sw)
+{
+	uint64_t oldest = UINT64_MAX;
+	uint32_t i;
+
+	for (i = 0; i < sw->nb_slots; i++)
+		if (sw->slots[i].vector != NULL)
+			oldest = RTE_MIN(oldest, sw->slots[i].timestamp);
+	sw->timestamp = oldest;
+}
+
+static int
+sw_vector_adapter_flush_expired(struct sw_vector_adapter_data *sw, uint64_t now)
+{
+	struct sw_vector_slot *slot;
+	int rc = 0;
+	uint32_t i;
+
+	for (i = 0; i < sw->nb_slots; i++) {
+		slot = &sw->slots[i];
+		if (slot->vector == NULL || now - slot->timestamp < sw->vector_tmo_ticks)
+			continue;
+		if (sw_vector_adapter_flush(sw, slot) == -ENOSPC)
+			rc = -ENOSPC;
+		else
+			sw->stats.vectors_timedout++;
+	}
+	sw_vector_adapter_update_deadline(sw);
+
+	return rc;
+}
+
 static void
 sw_vector_adapter_process_pend_list(struct sw_vector_adapter_service_data *service_data)
 {
@@ -555,7 +624,7 @@ sw_vector_adapter_process_pend_list(struct sw_vector_adapter_service_data *servi
 			continue;
 
 		sw = service_data->pend[i];
-		if (sw->vector == NULL) {
+		if (!sw_vector_adapter_in_progress(sw)) {
 			service_data->pend[i] = NULL;
 			service_data->pend_list--;
 			continue;
@@ -563,7 +632,8 @@ sw_vector_adapter_process_pend_list(struct sw_vector_adapter_service_data *servi
 
 		rte_spinlock_lock(&sw->lock);
 		if (rte_get_tsc_cycles() - sw->timestamp >= sw->vector_tmo_ticks) {
-			if (sw_vector_adapter_flush(sw) != -ENOSPC) {
+			if (sw_vector_adapter_flush_expired(sw, rte_get_tsc_cycles()) != -ENOSPC &&
+			    !sw_vector_adapter_in_progress(sw)) {
 				service_data->pend[i] = NULL;
 				service_data->pend_list--;
 			}
@@ -606,7 +676,7 @@ sw_vector_adapter_service_func(void *arg)
 	n = rte_ring_dequeue_burst(service_data->ring, (void **)&sw, SERVICE_DEQ_SZ, NULL);
 	for (i = 0; i < n; i++) {
 
-		if (sw[i]->vector == NULL)
+		if (!sw_vector_adapter_in_progress(sw[i]))
 			continue;
 
 		if (rte_get_tsc_cycles() - sw[i]->timestamp < sw[i]->vector_tmo_ticks) {
@@ -616,10 +686,10 @@ sw_vector_adapter_service_func(void *arg)
 				sw_vector_adapter_add_to_pend_list(service_data, sw[i]);
 				continue;
 			}
-			if (sw_vector_adapter_flush(sw[i]) == -ENOSPC)
+			if (sw_vector_adapter_flush_expired(sw[i], rte_get_tsc_cycles()) ==
+				    -ENOSPC ||
+			    sw_vector_adapter_in_progress(sw[i]))
 				sw_vector_adapter_add_to_pend_list(service_data, sw[i]);
-			else
-				sw[i]->stats.vectors_timedout++;
 			rte_spinlock_unlock(&sw[i]->lock);
 		}
 	}
@@ -694,9 +764,12 @@ sw_vector_adapter_create(struct rte_event_vector_adapter *adapter)
 	char name[SW_VECTOR_ADAPTER_NAME];
 	struct sw_vector_adapter_data *sw;
 	struct rte_event ev;
+	uint16_t nb_slots;
 
+	nb_slots = RTE_MAX(adapter->data->conf.nb_flow_slots, 1);
 	snprintf(name, SW_VECTOR_ADAPTER_NAME, "sw_vector_%" PRIx32, adapter->data->id);
-	sw = rte_zmalloc_socket(name, sizeof(*sw), RTE_CACHE_LINE_SIZE, adapter->data->socket_id);
+	sw = rte_zmalloc_socket(name, sizeof(*sw) + nb_slots * sizeof(struct sw_vector_slot),
+				RTE_CACHE_LINE_SIZE, adapter->data->socket_id);
 	if (sw == NULL) {
 		EVVEC_LOG_ERR("failed to allocate space for private data");
 		rte_errno = ENOMEM;
@@ -713,6 +786,12 @@ sw_vector_adapter_create(struct rte_event_vector_adapter *adapter)
 	sw->vector_mp = adapter->data->conf.vector_mp;
 	sw->vector_tmo_ticks = NSEC2TICK(adapter->data->conf.vector_timeout_ns, rte_get_timer_hz());
 
+	sw->flow_aware = adapter->data->conf.nb_flow_slots != 0;
+	sw->nb_slots = nb_slots;
+	sw->slot_mask = nb_slots - 1;
+	sw->slots = (struct sw_vector_slot *)(sw + 1);
+	sw->timestamp = UINT64_MAX;
+
 	ev = adapter->data->conf.ev;
 	ev.op = RTE_EVENT_OP_NEW;
 	sw->event_meta = ev.event;
@@ -760,12 +839,17 @@ sw_vector_adapter_enqueue(struct rte_event_vector_adapter *adapter, uint64_t obj
 {
 	struct sw_vector_adapter_data *sw = sw_vector_adapter_priv(adapter);
 	uint16_t cnt = num_elem, n;
+	struct sw_vector_slot *slot;
+	uint32_t flow_id, i;
 	int ret;
 
 	rte_spinlock_lock(&sw->lock);
 	if (flags & RTE_EVENT_VECTOR_ENQ_FLUSH) {
-		sw_vector_adapter_flush(sw);
-		sw->stats.vectors_flushed++;
+		for (i = 0; i < sw->nb_slots; i++) {
+			if (sw_vector_adapter_flush(sw, &sw->slots[i]) == 0)
+				sw->stats.vectors_flushed++;
+		}
+		sw_vector_adapter_update_deadline(sw);
 		rte_spinlock_unlock(&sw->lock);
 		return 0;
 	}
@@ -775,15 +859,18 @@ sw_vector_adapter_enqueue(struct rte_event_vector_adapter *adapter, uint64_t obj
 		return 0;
 	}
 
-	if (flags & RTE_EVENT_VECTOR_ENQ_SOV && sw->vector != NULL) {
-		while (sw_vector_adapter_flush(sw) != 0)
+	flow_id = sw->flow_aware ? (uint32_t)(flags >> RTE_EVENT_VECTOR_ENQ_FLOW_SHIFT) : 0;
+	slot = &sw->slots[((flow_id * UINT32_C(0x9E3779B9)) >> 16) & sw->slot_mask];
+
+	if (flags & RTE_EVENT_VECTOR_ENQ_SOV && slot->vector != NULL) {
+		while (sw_vector_adapter_flush(sw, slot) != 0)
 			;
 		sw->stats.vectors_flushed++;
 	}
 
 	while (num_elem) {
-		if (sw->vector == NULL) {
-			ret = rte_mempool_get(sw->vector_mp, (void **)&sw->vector);
+		if (slot->vector == NULL) {
+			ret = rte_mempool_get(sw->vector_mp, (void **)&slot->vector);
 			if (ret) {
 				if (sw_vector_adapter_flush_single_event(sw, *objs) == 0) {
 					sw->stats.alloc_failures++;
@@ -794,32 +881,34 @@ sw_vector_adapter_enqueue(struct rte_event_vector_adapter *adapter, uint64_t obj
 				rte_errno = -ENOSPC;
 				goto done;
 			}
-			sw->vector->nb_elem = 0;
-			sw->vector->attr_valid = 0;
-			sw->vector->elem_offset = 0;
+			slot->vector->nb_elem = 0;
+			slot->vector->attr_valid = 0;
+			slot->vector->elem_offset = 0;
+			slot->flow_id = flow_id;
 		}
-		n = RTE_MIN(sw->vector_sz - sw->vector->nb_elem, num_elem);
-		memcpy(&sw->vector->u64s[sw->vector->nb_elem], objs, n * sizeof(uint64_t));
-		sw->vector->nb_elem += n;
+		n = RTE_MIN(sw->vector_sz - slot->vector->nb_elem, num_elem);
+		memcpy(&slot->vector->u64s[slot->vector->nb_elem], objs, n * sizeof(uint64_t));
+		slot->vector->nb_elem += n;
 		num_elem -= n;
 		objs += n;
 
-		if (sw->vector_sz == sw->vector->nb_elem) {
-			ret = sw_vector_adapter_flush(sw);
+		if (sw->vector_sz == slot->vector->nb_elem) {
+			ret = sw_vector_adapter_flush(sw, slot);
 			if (ret)
 				goto done;
 			sw->stats.vectorized++;
 		}
 	}
 
-	if (flags & RTE_EVENT_VECTOR_ENQ_EOV && sw->vector != NULL) {
-		while (sw_vector_adapter_flush(sw) != 0)
+	if (flags & RTE_EVENT_VECTOR_ENQ_EOV && slot->vector != NULL) {
+		while (sw_vector_adapter_flush(sw, slot) != 0)
 			;
 		sw->stats.vectors_flushed++;
 	}
 
-	if (sw->vector != NULL && sw->vector->nb_elem) {
-		sw->timestamp = rte_get_timer_cycles();
+	if (slot->vector != NULL && slot->vector->nb_elem) {
+		slot->timestamp = rte_get_timer_cycles();
+		sw->timestamp = RTE_MIN(sw->timestamp, slot->timestamp);
 		rte_ring_enqueue(sw->service_data->ring, sw);
 	}
 
@@ -861,4 +950,5 @@ static const struct rte_event_vector_adapter_info sw_info = {
 	.min_vector_timeout_ns = MIN_VECTOR_NS,
 	.max_vector_timeout_ns = MAX_VECTOR_NS,
 	.log2_sz = 0,
+	.max_flow_slots = MAX_FLOW_SLOTS,
 };
@@ -129,6 +129,18 @@ extern "C" {
  */
 #define RTE_EVENT_VECTOR_ENQ_FLUSH RTE_BIT64(2)
 /**< Flush any in-progress vector aggregation. */
+#define RTE_EVENT_VECTOR_ENQ_FLOW_SHIFT 32
+/**< Offset of the flow ID carried in the enqueue flags.
+ *  @see RTE_EVENT_VECTOR_ENQ_FLOW
+ */
+#define RTE_EVENT_VECTOR_ENQ_FLOW(flow_id)                                                         \
+	((uint64_t)(flow_id) << RTE_EVENT_VECTOR_ENQ_FLOW_SHIFT)
+/**< Set the flow ID associated with the enqueued objects. The vector adapter
+ *  hashes the flow ID to select the aggregation slot the objects are
+ *  aggregated into, all objects of an enqueue call share the flow ID.
+ *  Only used when the adapter is configured with a non-zero
+ *  rte_event_vector_adapter_conf::nb_flow_slots, ignored otherwise.
+ */
 
 /**
  * Vector adapter configuration structure
@@ -181,6 +193,22 @@ struct rte_event_vector_adapter_conf {
 	 * rte_event_vector container.
 	 * @see rte_event_vector_pool_create
 	 */
+	uint16_t nb_flow_slots;
+	/**<
+	 * Number of aggregation slots used for flow aware vectorization.
+	 * When zero, flow aware mode is disabled and all enqueued objects
+	 * are aggregated into a single in-progress vector.
+	 * When non-zero, should be a power of 2 within the limits of the
+	 * adapter and the flow ID supplied with #RTE_EVENT_VECTOR_ENQ_FLOW
+	 * is hashed to select the slot the objects are aggregated into,
+	 * producing vectors whose objects share an aggregation slot. The
+	 * flow_id of the emitted vector event is taken from the flow ID
+	 * that started the aggregation instead of
+	 * rte_event_vector_adapter_conf::ev, flow IDs hashing to the same
+	 * slot may share a vector.
+	 * @see RTE_EVENT_VECTOR_ENQ_FLOW
+	 * @see rte_event_vector_adapter_info::max_flow_slots
+	 */
 };
 
 /**
@@ -199,6 +227,11 @@ struct rte_event_vector_adapter_info {
 	/**< Maximum vector timeout configurable */
 	uint8_t log2_sz;
 	/**< True if the size configured should be in log2. */
+	uint16_t max_flow_slots;
+	/**< Maximum number of flow aggregation slots configurable,
+	 *  zero if flow aware mode is not supported.
+	 *  @see rte_event_vector_adapter_conf::nb_flow_slots
+	 */
 };
 
 /**
@@ -850,6 +850,50 @@ rte_event_port_quiesce(uint8_t dev_id, uint8_t port_id,
 		dev->dev_ops->port_quiesce(dev, dev->data->ports[port_id], release_cb, args);
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_event_port_credits_reserve, 25.07)
+uint16_t
+rte_event_port_credits_reserve(uint8_t dev_id, uint8_t port_id, uint16_t nb_credits)
+{
+	struct rte_eventdev *dev;
+
+	RTE_EVENTDEV_VALID_DEVID_OR_ERR_RET(dev_id, 0);
+	dev = &rte_eventdevs[dev_id];
+
+	if (!is_valid_port(dev, port_id)) {
+		RTE_EDEV_LOG_ERR("Invalid port_id=%" PRIu8, port_id);
+		return 0;
+	}
+
+	/* Grant any reservation when the PMD does not implement credit
+	 * reservation. Such devices perform their own admission control on
+	 * enqueue and do not benefit from prefetched credits.
+	 */
+	if (dev->dev_ops->port_credits_reserve == NULL)
+		return nb_credits;
+
+	return dev->dev_ops->port_credits_reserve(dev, dev->data->ports[port_id], nb_credits);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_event_port_credits_release, 25.07)
+uint16_t
+rte_event_port_credits_release(uint8_t dev_id, uint8_t port_id, uint16_t nb_credits)
+{
+	struct rte_eventdev *dev;
+
+	RTE_EVENTDEV_VALID_DEVID_OR_ERR_RET(dev_id, 0);
+	dev = &rte_eventdevs[dev_id];
+
+	if (!is_valid_port(dev, port_id)) {
+		RTE_EDEV_LOG_ERR("Invalid port_id=%" PRIu8, port_id);
+		return 0;
+	}
+
+	if (dev->dev_ops->port_credits_release == NULL)
+		return nb_credits;
+
+	return dev->dev_ops->port_credits_release(dev, dev->data->ports[port_id], nb_credits);
+}
+
 RTE_EXPORT_SYMBOL(rte_event_dev_attr_get)
 int
 rte_event_dev_attr_get(uint8_t dev_id, uint32_t attr_id,
@@ -1300,6 +1300,76 @@ void
 rte_event_port_quiesce(uint8_t dev_id, uint8_t port_id,
 		       rte_eventdev_port_flush_t release_cb, void *args);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Reserve credits for new events on an event port.
+ *
+ * Event devices implementing a shared credit pool charge the pool when
+ * @ref RTE_EVENT_OP_NEW events are enqueued. Producers enqueuing small bursts
+ * can amortize the resulting contention on the shared pool by reserving a
+ * batch of credits up front: subsequent enqueues of new events spend the
+ * reserved credits without touching the shared pool until the reservation
+ * is exhausted.
+ *
+ * The reservation is a hint. Event devices without a software managed credit
+ * pool grant any reservation and the function returns *nb_credits*. Devices
+ * with a credit pool may grant fewer credits than requested when the device
+ * is close to its new event limit; reserved credits count towards that limit
+ * until they are spent on enqueued events or returned with
+ * rte_event_port_credits_release().
+ *
+ * This function must be called by the thread associated with the event port,
+ * like the enqueue and dequeue functions.
+ *
+ * @param dev_id
+ *   The identifier of the device.
+ * @param port_id
+ *   The identifier of the event port.
+ * @param nb_credits
+ *   The number of credits to reserve.
+ *
+ * @return
+ *   The number of credits actually reserved. Zero is returned for an invalid
+ *   device or port identifier.
+ */
+__rte_experimental
+uint16_t
+rte_event_port_credits_reserve(uint8_t dev_id, uint8_t port_id,
+			       uint16_t nb_credits);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Release credits previously reserved on an event port.
+ *
+ * Returns unused credits reserved with rte_event_port_credits_reserve() to
+ * the shared credit pool. Producers should release the unspent part of a
+ * reservation before stopping or migrating away from an event port, as
+ * reserved credits count towards the device's new event limit.
+ *
+ * This function must be called by the thread associated with the event port,
+ * like the enqueue and dequeue functions.
+ *
+ * @param dev_id
+ *   The identifier of the device.
+ * @param port_id
+ *   The identifier of the event port.
+ * @param nb_credits
+ *   The number of credits to release.
+ *
+ * @return
+ *   The number of credits actually released, which may be lower than
+ *   *nb_credits* when part of the reservation was already spent on enqueued
+ *   events. Zero is returned for an invalid device or port identifier.
+ */
+__rte_experimental
+uint16_t
+rte_event_port_credits_release(uint8_t dev_id, uint8_t port_id,
+			       uint16_t nb_credits);
+
 /**
  * Port attribute id for the maximum size of a burst enqueue operation supported on a port.
  */
@@ -1611,6 +1681,9 @@ struct __rte_aligned(16) rte_event_vector {
 #define RTE_EVENT_TYPE_CRYPTODEV_VECTOR                                        \
 	(RTE_EVENT_TYPE_VECTOR | RTE_EVENT_TYPE_CRYPTODEV)
 /**< The event vector generated from cryptodev adapter. */
+#define RTE_EVENT_TYPE_DMADEV_VECTOR                                           \
+	(RTE_EVENT_TYPE_VECTOR | RTE_EVENT_TYPE_DMADEV)
+/**< The event vector generated from dmadev adapter. */
 
 #define RTE_EVENT_TYPE_MAX              0x10
 /**< Maximum number of event types */
@@ -6,7 +6,10 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include <rte_atomic.h>
+#include <rte_cycles.h>
 #include <rte_debug.h>
+#include <rte_dispatch.h>
 #include <rte_malloc.h>
 #include <rte_errno.h>
 #include <rte_vect.h>
@@ -95,11 +98,70 @@ get_vector_fn(enum rte_fib_dir24_8_nh_sz nh_sz, bool be_addr)
 	return NULL;
 }
 
+/* Lookups per micro-calibration run for the default lookup selection. */
+#define DIR24_8_CALIB_BURST	64
+#define DIR24_8_CALIB_ITER	16
+
+static uint64_t
+dir24_8_lookup_bench(const void *func, void *arg)
+{
+	rte_fib_lookup_fn_t fn = (rte_fib_lookup_fn_t)(uintptr_t)func;
+	struct dir24_8_tbl *dp = arg;
+	uint32_t ips[DIR24_8_CALIB_BURST];
+	uint64_t next_hops[DIR24_8_CALIB_BURST];
+	uint64_t start;
+	unsigned int i;
+
+	/* Spread the probe addresses over the whole tbl24. */
+	for (i = 0; i < DIR24_8_CALIB_BURST; i++)
+		ips[i] = i * 2654435761u;
+
+	start = rte_rdtsc();
+	for (i = 0; i < DIR24_8_CALIB_ITER; i++)
+		fn(dp, ips, next_hops, DIR24_8_CALIB_BURST);
+	return rte_rdtsc() - start;
+}
+
+/*
+ * Choose between the scalar and the vector implementation by measuring
+ * both on this table: the widest ISA is not always the fastest one
+ * (e.g. parts that downclock on AVX-512).
+ */
+static rte_fib_lookup_fn_t
+get_default_fn(struct dir24_8_tbl *dp, bool be_addr)
+{
+	rte_fib_lookup_fn_t scalar_fn, vector_fn;
+	int best;
+
+	scalar_fn = get_scalar_fn(dp->nh_sz, be_addr);
+	vector_fn = get_vector_fn(dp->nh_sz, be_addr);
+	if (vector_fn == NULL)
+		return scalar_fn;
+
+	const struct rte_dispatch_variant variants[] = {
+		{
+			.name = "scalar",
+			.func = (const void *)(uintptr_t)scalar_fn,
+			.simd_width = RTE_VECT_SIMD_DISABLED,
+		},
+		{
+			.name = "avx512",
+			.func = (const void *)(uintptr_t)vector_fn,
+			.simd_width = RTE_VECT_SIMD_512,
+		},
+	};
+
+	best = rte_dispatch_calibrate(variants, RTE_DIM(variants),
+		dir24_8_lookup_bench, dp);
+	if (best < 0)
+		return scalar_fn;
+	return (rte_fib_lookup_fn_t)(uintptr_t)variants[best].func;
+}
+
 rte_fib_lookup_fn_t
 dir24_8_get_lookup_fn(void *p, enum rte_fib_lookup_type type, bool be_addr)
 {
 	enum rte_fib_dir24_8_nh_sz nh_sz;
-	rte_fib_lookup_fn_t ret_fn;
 	struct dir24_8_tbl *dp = p;
 
 	if (dp == NULL)
@@ -117,8 +179,7 @@ dir24_8_get_lookup_fn(void *p, enum rte_fib_lookup_type type, bool be_addr)
 	case RTE_FIB_LOOKUP_DIR24_8_VECTOR_AVX512:
 		return get_vector_fn(nh_sz, be_addr);
 	case RTE_FIB_LOOKUP_DEFAULT:
-		ret_fn = get_vector_fn(nh_sz, be_addr);
-		return ret_fn != NULL ? ret_fn : get_scalar_fn(nh_sz, be_addr);
+		return get_default_fn(dp, be_addr);
 	default:
 		return NULL;
 	}
@@ -155,6 +216,59 @@ write_to_fib(void *ptr, uint64_t val, enum rte_fib_dir24_8_nh_sz size, int n)
 	}
 }
 
+#ifdef RTE_ARCH_X86_64
+/* Minimal range size in bytes for non-temporal stores to pay off */
+#define DIR24_8_NT_THRESH	(4 * RTE_CACHE_LINE_SIZE)
+
+static void
+write_to_fib_nt(void *ptr, uint64_t val, enum rte_fib_dir24_8_nh_sz size,
+	int n)
+{
+	const uint32_t esz = 1 << size;
+	uintptr_t p = (uintptr_t)ptr;
+	const uintptr_t end = p + ((size_t)n << size);
+	uint64_t pattern = val;
+	uint32_t i, head;
+
+	/* replicate the entry value across a 64-bit store */
+	for (i = esz; i < sizeof(uint64_t); i *= 2)
+		pattern |= pattern << (i * 8);
+
+	/*
+	 * The table is entry aligned, so the distance to the next 8-byte
+	 * boundary is always a whole number of entries.
+	 */
+	head = (uint32_t)(-p & (sizeof(uint64_t) - 1)) >> size;
+	write_to_fib((void *)p, val, size, head);
+	p += head << size;
+
+	/*
+	 * Stream the bulk of the range around the cache: a /16 install
+	 * rewrites 256 tbl24 entries and would otherwise evict part of the
+	 * readers' lookup working set.
+	 */
+	for (; p + sizeof(uint64_t) <= end; p += sizeof(uint64_t))
+		_mm_stream_si64((long long *)p, (long long)pattern);
+
+	write_to_fib((void *)p, val, size, (end - p) >> size);
+
+	/* make the streamed entries globally visible */
+	rte_wmb();
+}
+#endif /* RTE_ARCH_X86_64 */
+
+static void
+fib_write_range(struct dir24_8_tbl *dp, void *ptr, uint64_t val, int n)
+{
+#ifdef RTE_ARCH_X86_64
+	if (dp->nt_update && ((size_t)n << dp->nh_sz) >= DIR24_8_NT_THRESH) {
+		write_to_fib_nt(ptr, val, dp->nh_sz, n);
+		return;
+	}
+#endif
+	write_to_fib(ptr, val, dp->nh_sz, n);
+}
+
 static int
 tbl8_get_idx(struct dir24_8_tbl *dp)
 {
@@ -198,8 +312,8 @@ tbl8_alloc(struct dir24_8_tbl *dp, uint64_t nh)
 		((tbl8_idx * DIR24_8_TBL8_GRP_NUM_ENT) <<
 		dp->nh_sz);
 	/*Init tbl8 entries with nexthop from tbl24*/
-	write_to_fib((void *)tbl8_ptr, nh|
-		DIR24_8_EXT_ENT, dp->nh_sz,
+	fib_write_range(dp, (void *)tbl8_ptr, nh|
+		DIR24_8_EXT_ENT,
 		DIR24_8_TBL8_GRP_NUM_ENT);
 	dp->cur_tbl8s++;
 	return tbl8_idx;
@@ -336,13 +450,13 @@ install_to_fib(struct dir24_8_tbl *dp, uint32_t ledge, uint32_t redge,
 				(ledge & ~DIR24_8_TBL24_MASK)) <<
 				dp->nh_sz);
 			/*update tbl8 with new next hop*/
-			write_to_fib((void *)tbl8_ptr, (next_hop << 1)|
+			fib_write_range(dp, (void *)tbl8_ptr, (next_hop << 1)|
 				DIR24_8_EXT_ENT,
-				dp->nh_sz, ROUNDUP(ledge, 24) - ledge);
+				ROUNDUP(ledge, 24) - ledge);
 			tbl8_recycle(dp, ledge, tbl8_idx);
 		}
-		write_to_fib(get_tbl24_p(dp, ROUNDUP(ledge, 24), dp->nh_sz),
-			next_hop << 1, dp->nh_sz, len);
+		fib_write_range(dp, get_tbl24_p(dp, ROUNDUP(ledge, 24), dp->nh_sz),
+			next_hop << 1, len);
 		if (redge & ~DIR24_8_TBL24_MASK) {
 			tbl24_tmp = get_tbl24(dp, redge, dp->nh_sz);
 			if ((tbl24_tmp & DIR24_8_EXT_ENT) !=
@@ -361,9 +475,9 @@ install_to_fib(struct dir24_8_tbl *dp, uint32_t ledge, uint32_t redge,
 				((tbl8_idx * DIR24_8_TBL8_GRP_NUM_ENT) <<
 				dp->nh_sz);
 			/*update tbl8 with new next hop*/
-			write_to_fib((void *)tbl8_ptr, (next_hop << 1)|
+			fib_write_range(dp, (void *)tbl8_ptr, (next_hop << 1)|
 				DIR24_8_EXT_ENT,
-				dp->nh_sz, redge & ~DIR24_8_TBL24_MASK);
+				redge & ~DIR24_8_TBL24_MASK);
 			tbl8_recycle(dp, redge, tbl8_idx);
 		}
 	} else if ((redge - ledge) != 0) {
@@ -385,9 +499,9 @@ install_to_fib(struct dir24_8_tbl *dp, uint32_t ledge, uint32_t redge,
 			(ledge & ~DIR24_8_TBL24_MASK)) <<
 			dp->nh_sz);
 		/*update tbl8 with new next hop*/
-		write_to_fib((void *)tbl8_ptr, (next_hop << 1)|
+		fib_write_range(dp, (void *)tbl8_ptr, (next_hop << 1)|
 			DIR24_8_EXT_ENT,
-			dp->nh_sz, redge - ledge);
+			redge - ledge);
 		tbl8_recycle(dp, ledge, tbl8_idx);
 	}
 	return 0;
@@ -584,6 +698,7 @@ dir24_8_create(const char *name, int socket_id, struct rte_fib_conf *fib_conf)
 	dp->def_nh = def_nh;
 	dp->nh_sz = nh_sz;
 	dp->number_tbl8s = num_tbl8;
+	dp->nt_update = !!(fib_conf->flags & RTE_FIB_F_NON_TEMPORAL_UPDATE);
 
 	snprintf(mem_name, sizeof(mem_name), "TBL8_idxes_%p", dp);
 	dp->tbl8_idxes = rte_zmalloc_socket(mem_name,
@@ -99,10 +99,13 @@ init_dataplane(struct rte_fib *fib, __rte_unused int socket_id,
 	struct rte_fib_conf *conf)
 {
 	char dp_name[sizeof(void *)];
+	int ret;
 
 	snprintf(dp_name, sizeof(dp_name), "%p", fib);
 	switch (conf->type) {
 	case RTE_FIB_DUMMY:
+		if (conf->rcu != NULL)
+			return -ENOTSUP;
 		fib->dp = fib;
 		fib->lookup = dummy_lookup;
 		fib->modify = dummy_modify;
@@ -111,6 +114,14 @@ init_dataplane(struct rte_fib *fib, __rte_unused int socket_id,
 		fib->dp = dir24_8_create(dp_name, socket_id, conf);
 		if (fib->dp == NULL)
 			return -rte_errno;
+		if (conf->rcu != NULL) {
+			ret = dir24_8_rcu_qsbr_add(fib->dp, conf->rcu,
+				fib->name);
+			if (ret < 0) {
+				dir24_8_free(fib->dp);
+				return ret;
+			}
+		}
 		fib->lookup = dir24_8_get_lookup_fn(fib->dp,
 			RTE_FIB_LOOKUP_DEFAULT, !!(fib->flags & RTE_FIB_F_LOOKUP_NETWORK_ORDER));
 		fib->modify = dir24_8_modify;
@@ -353,6 +364,41 @@ rte_fib_select_lookup(struct rte_fib *fib,
 	}
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_fib_import_rib, 25.07)
+int
+rte_fib_import_rib(struct rte_fib *fib, struct rte_rib *rib)
+{
+	struct rte_rib_node *node;
+	uint32_t ip;
+	uint64_t nh;
+	uint8_t depth;
+	int ret;
+
+	if ((fib == NULL) || (rib == NULL))
+		return -EINVAL;
+
+	/* The subtree walk below skips its 0/0 root, copy it separately */
+	node = rte_rib_lookup_exact(rib, 0, 0);
+	if (node != NULL) {
+		rte_rib_get_nh(node, &nh);
+		ret = rte_fib_add(fib, 0, 0, nh);
+		if (ret < 0)
+			return ret;
+	}
+
+	node = NULL;
+	while ((node = rte_rib_get_nxt(rib, 0, 0, node,
+			RTE_RIB_GET_NXT_ALL)) != NULL) {
+		rte_rib_get_ip(node, &ip);
+		rte_rib_get_depth(node, &depth);
+		rte_rib_get_nh(node, &nh);
+		ret = rte_fib_add(fib, ip, depth, nh);
+		if (ret < 0)
+			return ret;
+	}
+	return 0;
+}
+
 RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_fib_rcu_qsbr_add, 24.11)
 int
 rte_fib_rcu_qsbr_add(struct rte_fib *fib, struct rte_fib_rcu_config *cfg)
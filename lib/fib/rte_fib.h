@@ -90,25 +90,16 @@ enum rte_fib_lookup_type {
 
 /** If set, fib lookup is expecting IPv4 address in network byte order */
 #define RTE_FIB_F_LOOKUP_NETWORK_ORDER 1
-#define RTE_FIB_ALLOWED_FLAGS (RTE_FIB_F_LOOKUP_NETWORK_ORDER)
+/**
+ * If set, large route installations use non-temporal stores where
+ * supported, so that rewriting wide tbl24/tbl8 ranges does not evict the
+ * lookup working set from the caches of concurrently running readers.
+ */
+#define RTE_FIB_F_NON_TEMPORAL_UPDATE 2
+#define RTE_FIB_ALLOWED_FLAGS (RTE_FIB_F_LOOKUP_NETWORK_ORDER | \
+		RTE_FIB_F_NON_TEMPORAL_UPDATE)
 
 /** FIB configuration structure */
-struct rte_fib_conf {
-	enum rte_fib_type type; /**< Type of FIB struct */
-	/** Default value returned on lookup if there is no route */
-	uint64_t default_nh;
-	int	max_routes;
-	/** Size of the node extension in the internal RIB struct */
-	unsigned int rib_ext_sz;
-	union {
-		struct {
-			enum rte_fib_dir24_8_nh_sz nh_sz;
-			uint32_t	num_tbl8;
-		} dir24_8;
-	};
-	unsigned int flags; /**< Optional feature flags from RTE_FIB_F_* **/
-};
-
 /** FIB RCU QSBR configuration structure. */
 struct rte_fib_rcu_config {
 	/** RCU QSBR variable. */
@@ -129,6 +120,27 @@ struct rte_fib_rcu_config {
 	uint32_t reclaim_max;
 };
 
+struct rte_fib_conf {
+	enum rte_fib_type type; /**< Type of FIB struct */
+	/** Default value returned on lookup if there is no route */
+	uint64_t default_nh;
+	int	max_routes;
+	/** Size of the node extension in the internal RIB struct */
+	unsigned int rib_ext_sz;
+	union {
+		struct {
+			enum rte_fib_dir24_8_nh_sz nh_sz;
+			uint32_t	num_tbl8;
+		} dir24_8;
+	};
+	unsigned int flags; /**< Optional feature flags from RTE_FIB_F_* **/
+	/** RCU configuration applied at create time, same semantics as
+	 * rte_fib_rcu_qsbr_add(). May be NULL, in which case RCU can still
+	 * be attached later with rte_fib_rcu_qsbr_add().
+	 */
+	struct rte_fib_rcu_config *rcu;
+};
+
 /**
  * Free an FIB object.
  *
@@ -260,6 +272,27 @@ rte_fib_get_rib(struct rte_fib *fib);
 int
 rte_fib_select_lookup(struct rte_fib *fib, enum rte_fib_lookup_type type);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Copy all routes from a standalone RIB into the FIB.
+ * Flattens a control plane RIB into the FIB dataplane struct, so that
+ * prefixes collected in a pointer based trie can be resolved with the
+ * FIB bulk lookup functions. Routes already present in the FIB are kept;
+ * on prefix collision the RIB next hop wins.
+ *
+ * @param fib
+ *   FIB object handle
+ * @param rib
+ *   RIB object handle to copy routes from
+ * @return
+ *   0 on success, negative value otherwise
+ */
+__rte_experimental
+int
+rte_fib_import_rib(struct rte_fib *fib, struct rte_rib *rib);
+
 /**
  * Associate RCU QSBR variable with a FIB object.
  *
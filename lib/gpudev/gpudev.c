@@ -1053,6 +1053,61 @@ rte_gpu_comm_populate_list_pkts(struct rte_gpu_comm_list *comm_list_item,
 	return 0;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_gpu_comm_populate_list_pkts_burst, 25.07)
+int
+rte_gpu_comm_populate_list_pkts_burst(struct rte_gpu_comm_list *comm_list,
+		uint32_t num_comm_items, struct rte_mbuf ***mbufs,
+		uint32_t *num_mbufs)
+{
+	struct rte_gpu_comm_list *item;
+	uint32_t idx_l;
+	uint32_t idx;
+
+	if (comm_list == NULL || num_comm_items == 0 || mbufs == NULL ||
+			num_mbufs == NULL) {
+		rte_errno = EINVAL;
+		return -rte_errno;
+	}
+
+	for (idx_l = 0; idx_l < num_comm_items; idx_l++) {
+		if (comm_list[idx_l].pkt_list == NULL || mbufs[idx_l] == NULL ||
+				num_mbufs[idx_l] > RTE_GPU_COMM_LIST_PKTS_MAX) {
+			rte_errno = EINVAL;
+			return -rte_errno;
+		}
+	}
+
+	for (idx_l = 0; idx_l < num_comm_items; idx_l++) {
+		item = &comm_list[idx_l];
+
+		for (idx = 0; idx < num_mbufs[idx_l]; idx++) {
+			/* support only unchained mbufs */
+			if (unlikely((mbufs[idx_l][idx]->nb_segs > 1) ||
+					(mbufs[idx_l][idx]->next != NULL) ||
+					(mbufs[idx_l][idx]->data_len !=
+						mbufs[idx_l][idx]->pkt_len))) {
+				rte_errno = ENOTSUP;
+				return -rte_errno;
+			}
+			item->pkt_list[idx].addr =
+					rte_pktmbuf_mtod_offset(mbufs[idx_l][idx], uintptr_t, 0);
+			item->pkt_list[idx].size = mbufs[idx_l][idx]->pkt_len;
+			item->mbufs[idx] = mbufs[idx_l][idx];
+		}
+
+		RTE_GPU_VOLATILE(item->num_pkts) = num_mbufs[idx_l];
+	}
+
+	/* One barrier makes the packet entries of all the lists visible. */
+	rte_gpu_wmb(comm_list[0].dev_id);
+
+	for (idx_l = 0; idx_l < num_comm_items; idx_l++)
+		RTE_GPU_VOLATILE(comm_list[idx_l].status_h[0]) =
+				RTE_GPU_COMM_LIST_READY;
+
+	return 0;
+}
+
 RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_gpu_comm_set_status, 21.11)
 int
 rte_gpu_comm_set_status(struct rte_gpu_comm_list *comm_list_item,
@@ -1083,6 +1138,24 @@ rte_gpu_comm_get_status(struct rte_gpu_comm_list *comm_list_item,
 	return 0;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_gpu_comm_get_status_burst, 25.07)
+int
+rte_gpu_comm_get_status_burst(struct rte_gpu_comm_list *comm_list,
+		uint32_t num_comm_items, enum rte_gpu_comm_list_status *status)
+{
+	uint32_t idx_l;
+
+	if (comm_list == NULL || num_comm_items == 0 || status == NULL) {
+		rte_errno = EINVAL;
+		return -rte_errno;
+	}
+
+	for (idx_l = 0; idx_l < num_comm_items; idx_l++)
+		status[idx_l] = RTE_GPU_VOLATILE(comm_list[idx_l].status_h[0]);
+
+	return 0;
+}
+
 RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_gpu_comm_cleanup_list, 21.11)
 int
 rte_gpu_comm_cleanup_list(struct rte_gpu_comm_list *comm_list_item)
@@ -683,6 +683,38 @@ __rte_experimental
 int rte_gpu_comm_populate_list_pkts(struct rte_gpu_comm_list *comm_list_item,
 		struct rte_mbuf **mbufs, uint32_t num_mbufs);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Populate the packets lists of multiple consecutive communication items
+ * with info from one list of mbufs per item.
+ * The packet entries and number of packets of all the items are made
+ * visible to the device with a single write memory barrier, then the
+ * status flag of every item is set to READY, so a persistent device
+ * kernel pays the doorbell cost once per burst of lists instead of
+ * once per list.
+ * On error no item of the burst is marked READY.
+ *
+ * @param comm_list
+ *   First communication list item of the burst to fill.
+ * @param num_comm_items
+ *   Number of consecutive communication items in the burst.
+ * @param mbufs
+ *   Array of num_comm_items lists of mbufs, one per communication item.
+ * @param num_mbufs
+ *   Array of num_comm_items numbers of mbufs, one per communication item.
+ *
+ * @return
+ *   0 on success, -rte_errno otherwise:
+ *   - EINVAL if invalid input params
+ *   - ENOTSUP if mbufs are chained (multiple segments)
+ */
+__rte_experimental
+int rte_gpu_comm_populate_list_pkts_burst(struct rte_gpu_comm_list *comm_list,
+		uint32_t num_comm_items, struct rte_mbuf ***mbufs,
+		uint32_t *num_mbufs);
+
 /**
  * @warning
  * @b EXPERIMENTAL: this API may change without prior notice.
@@ -723,6 +755,31 @@ __rte_experimental
 int rte_gpu_comm_get_status(struct rte_gpu_comm_list *comm_list_item,
 		enum rte_gpu_comm_list_status *status);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Get the status flag values of multiple consecutive communication
+ * list items in one call, so the CPU side of a persistent device
+ * kernel can drain several lists per iteration.
+ *
+ * @param comm_list
+ *   First communication list item of the burst to query.
+ *   Input parameter.
+ * @param num_comm_items
+ *   Number of consecutive communication items in the burst.
+ * @param status
+ *   Array of num_comm_items status flag values.
+ *   Output parameter.
+ *
+ * @return
+ *   0 on success, -rte_errno otherwise:
+ *   - EINVAL if invalid input params
+ */
+__rte_experimental
+int rte_gpu_comm_get_status_burst(struct rte_gpu_comm_list *comm_list,
+		uint32_t num_comm_items, enum rte_gpu_comm_list_status *status);
+
 /**
  * @warning
  * @b EXPERIMENTAL: this API may change without prior notice.
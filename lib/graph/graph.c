@@ -5,6 +5,7 @@
 #include <fnmatch.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <eal_export.h>
 #include <rte_common.h>
@@ -12,6 +13,7 @@
 #include <rte_errno.h>
 #include <rte_malloc.h>
 #include <rte_memzone.h>
+#include <rte_pause.h>
 #include <rte_spinlock.h>
 #include <rte_string_fns.h>
 
@@ -216,12 +218,19 @@ static void
 graph_cleanup(struct graph *graph)
 {
 	struct graph_node *graph_node;
+	uint16_t i;
 
 	while (!STAILQ_EMPTY(&graph->node_list)) {
 		graph_node = STAILQ_FIRST(&graph->node_list);
 		STAILQ_REMOVE_HEAD(&graph->node_list, next);
 		free(graph_node);
 	}
+
+	for (i = 0; i < graph->nb_pcap_node_patterns; i++)
+		free(graph->pcap_node_patterns[i]);
+	free(graph->pcap_node_patterns);
+	graph->pcap_node_patterns = NULL;
+	graph->nb_pcap_node_patterns = 0;
 }
 
 static int
@@ -280,7 +289,7 @@ graph_mem_fixup_node_ctx(struct rte_graph *graph)
 		if (node_db == NULL)
 			SET_ERR_JMP(ENOLINK, fail, "Node %s not found", name);
 
-		if (graph->pcap_enable) {
+		if (graph->pcap_enable && node->pcap_enable) {
 			node->process = graph_pcap_dispatch;
 			node->original_process = node_db->process;
 		} else
@@ -459,9 +468,27 @@ rte_graph_create(const char *name, struct rte_graph_param *prm)
 	graph->id = graph_next_free_id();
 	graph->parent_id = RTE_GRAPH_ID_INVALID;
 	graph->lcore_id = RTE_MAX_LCORE;
+	graph->defer_watermark = prm->rtc.defer_watermark;
+	graph->defer_flush_cycles = prm->rtc.defer_flush_cycles;
 	graph->num_pkt_to_capture = prm->num_pkt_to_capture;
+	graph->pcap_sample_rate = prm->pcap_sample_rate;
 	if (prm->pcap_filename)
 		rte_strscpy(graph->pcap_filename, prm->pcap_filename, RTE_GRAPH_PCAP_FILE_SZ);
+	if (prm->nb_pcap_node_patterns) {
+		graph->pcap_node_patterns = calloc(prm->nb_pcap_node_patterns,
+						   sizeof(*graph->pcap_node_patterns));
+		if (graph->pcap_node_patterns == NULL)
+			SET_ERR_JMP(ENOMEM, graph_cleanup,
+				    "Failed to alloc pcap node patterns");
+		for (i = 0; i < prm->nb_pcap_node_patterns; i++) {
+			graph->pcap_node_patterns[i] =
+				strdup(prm->pcap_node_patterns[i]);
+			if (graph->pcap_node_patterns[i] == NULL)
+				SET_ERR_JMP(ENOMEM, graph_cleanup,
+					    "Failed to dup pcap node pattern");
+			graph->nb_pcap_node_patterns++;
+		}
+	}
 
 	/* Allocate the Graph fast path memory and populate the data */
 	if (graph_fp_mem_create(graph))
@@ -569,6 +596,8 @@ graph_clone(struct graph *parent_graph, const char *name, struct rte_graph_param
 	graph->parent_id = parent_graph->id;
 	graph->lcore_id = parent_graph->lcore_id;
 	graph->socket = parent_graph->socket;
+	graph->defer_watermark = parent_graph->defer_watermark;
+	graph->defer_flush_cycles = parent_graph->defer_flush_cycles;
 	graph->id = graph_next_free_id();
 
 	/* Allocate the Graph fast path memory and populate the data */
@@ -620,6 +649,99 @@ fail:
 	return RTE_GRAPH_ID_INVALID;
 }
 
+/* Accumulate the node counters of the graph being replaced into the
+ * identically named nodes of its replacement.
+ */
+static void
+graph_stats_carry_over(struct rte_graph *from, struct rte_graph *to)
+{
+	struct rte_node *src, *dst;
+	rte_graph_off_t off;
+	rte_node_t count;
+	struct node *node_reg;
+	uint64_t *src_xstat, *dst_xstat;
+	uint16_t i;
+
+	rte_graph_foreach_node(count, off, to, dst) {
+		src = graph_node_name_to_ptr(from, dst->name);
+		if (src == NULL)
+			continue;
+
+		dst->total_cycles += src->total_cycles;
+		dst->total_calls += src->total_calls;
+		dst->total_objs += src->total_objs;
+		for (i = 0; i < RTE_GRAPH_PMU_MAX_EVENTS; i++)
+			dst->total_pmu[i] += src->total_pmu[i];
+
+		node_reg = node_from_name(dst->name);
+		if (node_reg == NULL || node_reg->xstats == NULL)
+			continue;
+		src_xstat = RTE_PTR_ADD(src, src->xstat_off);
+		dst_xstat = RTE_PTR_ADD(dst, dst->xstat_off);
+		for (i = 0; i < node_reg->xstats->nb_xstats; i++)
+			dst_xstat[i] += src_xstat[i];
+	}
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_graph_handle_init, 25.07)
+int
+rte_graph_handle_init(struct rte_graph_handle *handle, rte_graph_t id)
+{
+	struct graph *graph;
+
+	if (handle == NULL) {
+		rte_errno = EINVAL;
+		return -EINVAL;
+	}
+
+	graph = graph_from_id(id);
+	if (graph == NULL)
+		return -EINVAL;
+
+	rte_atomic_store_explicit(&handle->graph, (uintptr_t)graph->graph,
+				  rte_memory_order_relaxed);
+	rte_atomic_store_explicit(&handle->seen, (uintptr_t)graph->graph,
+				  rte_memory_order_relaxed);
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_graph_handle_swap, 25.07)
+rte_graph_t
+rte_graph_handle_swap(struct rte_graph_handle *handle, rte_graph_t id)
+{
+	struct rte_graph *old_graph, *new_graph;
+	struct graph *graph;
+	rte_graph_t old_id;
+
+	if (handle == NULL) {
+		rte_errno = EINVAL;
+		return RTE_GRAPH_ID_INVALID;
+	}
+
+	graph = graph_from_id(id);
+	if (graph == NULL)
+		return RTE_GRAPH_ID_INVALID;
+	new_graph = graph->graph;
+
+	old_graph = (struct rte_graph *)rte_atomic_load_explicit(&handle->graph,
+			rte_memory_order_relaxed);
+	old_id = old_graph->id;
+	if (old_graph == new_graph)
+		return old_id;
+
+	graph_stats_carry_over(old_graph, new_graph);
+
+	rte_atomic_store_explicit(&handle->graph, (uintptr_t)new_graph,
+				  rte_memory_order_release);
+
+	/* wait for the worker to leave the old graph at a walk boundary */
+	while (rte_atomic_load_explicit(&handle->seen,
+			rte_memory_order_acquire) != (uintptr_t)new_graph)
+		rte_pause();
+
+	return old_id;
+}
+
 RTE_EXPORT_SYMBOL(rte_graph_from_name)
 rte_graph_t
 rte_graph_from_name(const char *name)
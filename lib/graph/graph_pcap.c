@@ -3,13 +3,18 @@
  */
 
 #include <errno.h>
+#include <fnmatch.h>
 #include <pwd.h>
 #include <stdlib.h>
 #include <unistd.h>
 
+#include <rte_cycles.h>
 #include <rte_ethdev.h>
 #include <rte_mbuf.h>
 #include <rte_pcapng.h>
+#include <rte_ring.h>
+#include <rte_stdatomic.h>
+#include <rte_thread.h>
 
 #include "rte_graph_worker.h"
 
@@ -19,12 +24,20 @@
 #define GRAPH_PCAP_NUM_PACKETS	1024
 #define GRAPH_PCAP_PKT_POOL	"graph_pcap_pkt_pool"
 #define GRAPH_PCAP_FILE_NAME	"dpdk_graph_pcap_capture_XXXXXX.pcapng"
+#define GRAPH_PCAP_RING_NAME	"graph_pcap_ring"
+#define GRAPH_PCAP_RING_SZ	1024
+#define GRAPH_PCAP_WRITER_SLEEP_US	100
 
 /* For multi-process, packets are captured in separate files. */
 static rte_pcapng_t *pcapng_fd;
 static bool pcap_enable;
 struct rte_mempool *pkt_mp;
 
+/* Clones pending write, drained by the background writer thread. */
+static struct rte_ring *pcap_ring;
+static rte_thread_t pcap_writer_thread;
+static RTE_ATOMIC(bool) pcap_writer_run;
+
 void
 graph_pcap_enable(bool val)
 {
@@ -37,9 +50,51 @@ graph_pcap_is_enable(void)
 	return pcap_enable;
 }
 
+int
+graph_pcap_node_is_enable(struct graph *graph, const char *name)
+{
+	uint16_t i;
+
+	/* An empty pattern list enables capture on all nodes. */
+	if (graph->nb_pcap_node_patterns == 0)
+		return 1;
+
+	for (i = 0; i < graph->nb_pcap_node_patterns; i++)
+		if (fnmatch(graph->pcap_node_patterns[i], name, 0) == 0)
+			return 1;
+
+	return 0;
+}
+
+static void
+graph_pcap_ring_drain(void)
+{
+	struct rte_mbuf *mbufs[RTE_GRAPH_BURST_SIZE];
+	unsigned int n;
+
+	while ((n = rte_ring_dequeue_burst(pcap_ring, (void **)mbufs,
+					   RTE_GRAPH_BURST_SIZE, NULL)) > 0) {
+		if (pcapng_fd != NULL)
+			rte_pcapng_write_packets(pcapng_fd, mbufs, n);
+		rte_pktmbuf_free_bulk(mbufs, n);
+	}
+}
+
 void
 graph_pcap_exit(struct rte_graph *graph)
 {
+	if (rte_atomic_load_explicit(&pcap_writer_run, rte_memory_order_relaxed)) {
+		rte_atomic_store_explicit(&pcap_writer_run, false,
+					  rte_memory_order_relaxed);
+		rte_thread_join(pcap_writer_thread, NULL);
+	}
+
+	if (pcap_ring) {
+		graph_pcap_ring_drain();
+		rte_ring_free(pcap_ring);
+		pcap_ring = NULL;
+	}
+
 	if (rte_eal_process_type() == RTE_PROC_PRIMARY)
 		rte_mempool_free(pkt_mp);
 
@@ -137,9 +192,37 @@ error:
 	return -1;
 }
 
+static uint32_t
+graph_pcap_write_thread(void *arg __rte_unused)
+{
+	struct rte_mbuf *mbufs[RTE_GRAPH_BURST_SIZE];
+	unsigned int n;
+	ssize_t len;
+
+	while (rte_atomic_load_explicit(&pcap_writer_run,
+					rte_memory_order_relaxed)) {
+		n = rte_ring_dequeue_burst(pcap_ring, (void **)mbufs,
+					   RTE_GRAPH_BURST_SIZE, NULL);
+		if (n == 0) {
+			rte_delay_us_sleep(GRAPH_PCAP_WRITER_SLEEP_US);
+			continue;
+		}
+
+		/* write it to capture file */
+		len = rte_pcapng_write_packets(pcapng_fd, mbufs, n);
+		if (len <= 0)
+			graph_warn("Graph pcap write of %u packets failed.", n);
+		rte_pktmbuf_free_bulk(mbufs, n);
+	}
+
+	return 0;
+}
+
 int
 graph_pcap_mp_init(void)
 {
+	char ring_name[RTE_RING_NAMESIZE];
+
 	pkt_mp = rte_mempool_lookup(GRAPH_PCAP_PKT_POOL);
 	if (pkt_mp)
 		goto done;
@@ -155,6 +238,34 @@ graph_pcap_mp_init(void)
 	}
 
 done:
+	if (pcap_ring == NULL) {
+		/* For multi-process, each process drains its own ring. */
+		snprintf(ring_name, RTE_RING_NAMESIZE, "%s_%d",
+			 GRAPH_PCAP_RING_NAME, getpid());
+		/* Worker cores enqueue, the single writer thread dequeues. */
+		pcap_ring = rte_ring_create(ring_name, GRAPH_PCAP_RING_SZ,
+					    SOCKET_ID_ANY, RING_F_SC_DEQ);
+		if (pcap_ring == NULL) {
+			graph_err("Cannot create ring for graph pcap capture.");
+			return -1;
+		}
+	}
+
+	if (!rte_atomic_load_explicit(&pcap_writer_run,
+				      rte_memory_order_relaxed)) {
+		rte_atomic_store_explicit(&pcap_writer_run, true,
+					  rte_memory_order_relaxed);
+		if (rte_thread_create_internal_control(&pcap_writer_thread,
+						       "graph-pcap",
+						       graph_pcap_write_thread,
+						       NULL)) {
+			graph_err("Cannot create graph pcap writer thread.");
+			rte_atomic_store_explicit(&pcap_writer_run, false,
+						  rte_memory_order_relaxed);
+			return -1;
+		}
+	}
+
 	return 0;
 }
 
@@ -175,6 +286,12 @@ graph_pcap_init(struct graph *graph)
 	else
 		graph_data->nb_pkt_to_capture = GRAPH_PCAP_NUM_PACKETS;
 
+	/* User configured sampling rate, capture every packet by default. */
+	if (graph->pcap_sample_rate > 1)
+		graph_data->pcap_sample_rate = graph->pcap_sample_rate;
+	else
+		graph_data->pcap_sample_rate = 1;
+
 	/* All good. Now populate data for secondary process. */
 	rte_strscpy(graph_data->pcap_filename, graph->pcap_filename, RTE_GRAPH_PCAP_FILE_SZ);
 	graph_data->pcap_enable = 1;
@@ -194,10 +311,12 @@ graph_pcap_dispatch(struct rte_graph *graph,
 			      uint16_t nb_objs)
 {
 	struct rte_mbuf *mbuf_clones[RTE_GRAPH_BURST_SIZE];
+	uint32_t rate = graph->pcap_sample_rate;
 	char buffer[GRAPH_PCAP_BUF_SZ];
 	uint64_t i, num_packets;
 	struct rte_mbuf *mbuf;
-	ssize_t len;
+	unsigned int enq;
+	uint16_t n;
 
 	if (!nb_objs || (graph->nb_pkt_captured >= graph->nb_pkt_to_capture))
 		goto done;
@@ -209,8 +328,14 @@ graph_pcap_dispatch(struct rte_graph *graph,
 
 	snprintf(buffer, GRAPH_PCAP_BUF_SZ, "%s: %s", graph->name, node->name);
 
+	n = 0;
 	for (i = 0; i < num_packets; i++) {
 		struct rte_mbuf *mc;
+
+		/* Capture one packet out of every pcap_sample_rate. */
+		if (rate > 1 && (graph->pcap_sample_phase++ % rate) != 0)
+			continue;
+
 		mbuf = (struct rte_mbuf *)objs[i];
 
 		mc = rte_pcapng_copy(mbuf->port, 0, mbuf, pkt_mp, mbuf->pkt_len,
@@ -218,16 +343,15 @@ graph_pcap_dispatch(struct rte_graph *graph,
 		if (mc == NULL)
 			break;
 
-		mbuf_clones[i] = mc;
+		mbuf_clones[n++] = mc;
 	}
 
-	/* write it to capture file */
-	len = rte_pcapng_write_packets(pcapng_fd, mbuf_clones, i);
-	rte_pktmbuf_free_bulk(mbuf_clones, i);
-	if (len <= 0)
-		goto done;
+	/* Hand the clones off to the background writer thread. */
+	enq = rte_ring_enqueue_burst(pcap_ring, (void **)mbuf_clones, n, NULL);
+	if (enq < n)
+		rte_pktmbuf_free_bulk(&mbuf_clones[enq], n - enq);
 
-	graph->nb_pkt_captured += i;
+	graph->nb_pkt_captured += enq;
 
 done:
 	return node->original_process(graph, node, objs, nb_objs);
@@ -35,12 +35,33 @@ void graph_pcap_enable(bool val);
  */
 int graph_pcap_is_enable(void);
 
+/**
+ * @internal
+ *
+ * Check graph pcap trace is enabled for a given node.
+ *
+ * The function matches the node name against the pcap node patterns given at
+ * graph creation time. An empty pattern list enables capture on all nodes.
+ *
+ * @param graph
+ *   Pointer to graph structure.
+ * @param name
+ *   Node name.
+ *
+ * @return
+ *   - 1: Enable
+ *   - 0: Disable
+ */
+int graph_pcap_node_is_enable(struct graph *graph, const char *name);
+
 /**
  * @internal
  *
  * Initialise graph pcap trace functionality.
  *
- * The function invoked to allocate mempool.
+ * The function invoked to allocate mempool. A background writer thread and
+ * the ring feeding it are also created, so that packet capture does not
+ * block the graph walk.
  *
  * @return
  *   0 on success and -1 on failure.
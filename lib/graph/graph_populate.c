@@ -48,6 +48,10 @@ graph_fp_mem_calc_size(struct graph *graph)
 		sz = RTE_ALIGN(sz, RTE_CACHE_LINE_SIZE);
 		sz += sizeof(uint64_t) * graph_node->node->xstats->nb_xstats;
 	}
+	sz = RTE_ALIGN(sz, RTE_CACHE_LINE_SIZE);
+	graph->defer_objs_start = sz;
+	/* Deferred stream stash of size number of nodes */
+	sz += sizeof(rte_graph_off_t) * graph->node_count;
 
 	graph->mem_sz = sz;
 	return sz;
@@ -64,6 +68,10 @@ graph_header_popluate(struct graph *_graph)
 	graph->nb_nodes = _graph->node_count;
 	graph->cir_start = RTE_PTR_ADD(graph, _graph->cir_start);
 	graph->nodes_start = _graph->nodes_start;
+	graph->defer_watermark = _graph->defer_watermark;
+	graph->rtc.defer_cycles = _graph->defer_flush_cycles;
+	graph->rtc.n_deferred = 0;
+	graph->rtc.defer_objs = RTE_PTR_ADD(graph, _graph->defer_objs_start);
 	graph->socket = _graph->socket;
 	graph->id = _graph->id;
 	memcpy(graph->name, _graph->name, RTE_GRAPH_NAMESIZE);
@@ -86,7 +94,9 @@ graph_nodes_populate(struct graph *_graph)
 		memset(node, 0, sizeof(*node));
 		node->fence = RTE_GRAPH_FENCE;
 		node->off = off;
-		if (graph_pcap_is_enable()) {
+		if (graph_pcap_is_enable() &&
+		    graph_pcap_node_is_enable(_graph, graph_node->node->name)) {
+			node->pcap_enable = 1;
 			node->process = graph_pcap_dispatch;
 			node->original_process = graph_node->node->process;
 		} else
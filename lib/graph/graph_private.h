@@ -115,6 +115,12 @@ struct graph {
 	/**< Circular buffer start offset in graph reel. */
 	uint32_t cir_mask;
 	/**< Circular buffer mask for wrap around. */
+	uint32_t defer_objs_start;
+	/**< Deferred stream stash start offset in graph reel. */
+	uint16_t defer_watermark;
+	/**< Minimum stream occupancy to process a node, 0 to disable. */
+	uint64_t defer_flush_cycles;
+	/**< Maximum cycles a stream may stay deferred. */
 	rte_graph_t id;
 	/**< Graph identifier. */
 	rte_graph_t parent_id;
@@ -129,6 +135,12 @@ struct graph {
 	/**< Number of packets to be captured per core. */
 	char pcap_filename[RTE_GRAPH_PCAP_FILE_SZ];
 	/**< pcap file name/path. */
+	uint16_t nb_pcap_node_patterns;
+	/**< Number of pcap node patterns. */
+	char **pcap_node_patterns;
+	/**< Node patterns selecting the nodes to capture on. */
+	uint32_t pcap_sample_rate;
+	/**< Capture one packet out of every pcap_sample_rate packets. */
 	STAILQ_HEAD(gnode_list, graph_node) node_list;
 	/**< Nodes in a graph. */
 };
@@ -11,8 +11,16 @@
 #include <rte_errno.h>
 #include <rte_malloc.h>
 
+#ifdef RTE_LIB_PMU
+#include <rte_pmu.h>
+#endif
+
 #include "graph_private.h"
 
+/* PMU sampling state shared with the fast path */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_graph_pmu, 25.07)
+struct rte_graph_pmu_data rte_graph_pmu;
+
 /* Capture all graphs of cluster */
 struct cluster {
 	rte_graph_t nb_graphs;
@@ -45,7 +53,7 @@ struct __rte_cache_aligned rte_graph_cluster_stats {
 #define boarder_model_dispatch()                                                              \
 	fprintf(f, "+-------------------------------+---------------+--------" \
 		   "-------+---------------+---------------+---------------+" \
-		   "---------------+---------------+-" \
+		   "---------------+---------------+---------------+-" \
 		   "----------+\n")
 
 #define boarder()                                                              \
@@ -67,9 +75,9 @@ static inline void
 print_banner_dispatch(FILE *f)
 {
 	boarder_model_dispatch();
-	fprintf(f, "%-32s%-16s%-16s%-16s%-16s%-16s%-16s%-16s%-16s\n",
+	fprintf(f, "%-32s%-16s%-16s%-16s%-16s%-16s%-16s%-16s%-16s%-16s\n",
 		"|Node", "|calls",
-		"|objs", "|sched objs", "|sched fail",
+		"|objs", "|sched objs", "|sched fail", "|sched block",
 		"|realloc_count", "|objs/call", "|objs/sec(10E6)",
 		"|cycles/call|");
 	boarder_model_dispatch();
@@ -108,10 +116,11 @@ print_node(FILE *f, const struct rte_graph_cluster_node_stats *stat, bool dispat
 	if (dispatch) {
 		fprintf(f,
 			"|%-31s|%-15" PRIu64 "|%-15" PRIu64 "|%-15" PRIu64
-			"|%-15" PRIu64 "|%-15" PRIu64
+			"|%-15" PRIu64 "|%-15" PRIu64 "|%-15" PRIu64
 			"|%-15.3f|%-15.6f|%-11.4f|\n",
 			stat->name, calls, objs, stat->dispatch.sched_objs,
-			stat->dispatch.sched_fail, stat->realloc_count, objs_per_call,
+			stat->dispatch.sched_fail, stat->dispatch.sched_block,
+			stat->realloc_count, objs_per_call,
 			objs_per_sec, cycles_per_call);
 	} else {
 		fprintf(f,
@@ -130,9 +139,9 @@ print_xstat(FILE *f, const struct rte_graph_cluster_node_stats *stat, bool dispa
 	if (dispatch) {
 		for (i = 0; i < stat->xstat_cntrs; i++)
 			fprintf(f,
-				"|\t%-24s|%15s|%-15" PRIu64 "|%15s|%15s|%15s|%15s|%15s|%11.4s|\n",
+				"|\t%-24s|%15s|%-15" PRIu64 "|%15s|%15s|%15s|%15s|%15s|%15s|%11.4s|\n",
 				stat->xstat_desc[i], "", stat->xstat_count[i], "", "", "", "", "",
-				"");
+				"", "");
 	} else {
 		for (i = 0; i < stat->xstat_cntrs; i++)
 			fprintf(f,
@@ -141,6 +150,26 @@ print_xstat(FILE *f, const struct rte_graph_cluster_node_stats *stat, bool dispa
 	}
 }
 
+static inline void
+print_pmu(FILE *f, const struct rte_graph_cluster_node_stats *stat, bool dispatch)
+{
+	int i;
+
+	if (dispatch) {
+		for (i = 0; i < stat->pmu_cntrs; i++)
+			fprintf(f,
+				"|\t%-24s|%15s|%-15" PRIu64 "|%15s|%15s|%15s|%15s|%15s|%15s|%11.4s|\n",
+				rte_graph_pmu.event_name[i], "", stat->pmu_count[i], "", "", "",
+				"", "", "", "");
+	} else {
+		for (i = 0; i < stat->pmu_cntrs; i++)
+			fprintf(f,
+				"|\t%-24s|%15s|%-15" PRIu64 "|%15s|%15.3s|%15.6s|%11.4s|\n",
+				rte_graph_pmu.event_name[i], "", stat->pmu_count[i], "", "", "",
+				"");
+	}
+}
+
 static int
 graph_cluster_stats_cb(bool dispatch, bool is_first, bool is_last, void *cookie,
 		       const struct rte_graph_cluster_node_stats *stat)
@@ -153,6 +182,8 @@ graph_cluster_stats_cb(bool dispatch, bool is_first, bool is_last, void *cookie,
 		print_node(f, stat, dispatch);
 		if (stat->xstat_cntrs)
 			print_xstat(f, stat, dispatch);
+		if (stat->pmu_cntrs)
+			print_pmu(f, stat, dispatch);
 	}
 	if (unlikely(is_last)) {
 		if (dispatch)
@@ -464,7 +495,11 @@ cluster_node_arregate_stats(struct cluster_node *cluster, bool dispatch)
 {
 	uint64_t calls = 0, cycles = 0, objs = 0, realloc_count = 0;
 	struct rte_graph_cluster_node_stats *stat = &cluster->stat;
-	uint64_t sched_objs = 0, sched_fail = 0;
+	uint64_t sched_objs = 0, sched_fail = 0, sched_block = 0;
+	uint64_t pause_count = 0;
+	const uint8_t nb_pmu = rte_graph_pmu.enabled ?
+		rte_graph_pmu.nb_events : 0;
+	uint64_t pmu_count[RTE_GRAPH_PMU_MAX_EVENTS] = {0};
 	struct rte_node *node;
 	rte_node_t count;
 	uint64_t *xstat;
@@ -477,12 +512,17 @@ cluster_node_arregate_stats(struct cluster_node *cluster, bool dispatch)
 		if (dispatch) {
 			sched_objs += node->dispatch.total_sched_objs;
 			sched_fail += node->dispatch.total_sched_fail;
+			sched_block += node->dispatch.total_sched_block;
 		}
 
 		calls += node->total_calls;
 		objs += node->total_objs;
 		cycles += node->total_cycles;
 		realloc_count += node->realloc_count;
+		pause_count += node->total_pause;
+
+		for (i = 0; i < nb_pmu; i++)
+			pmu_count[i] += node->total_pmu[i];
 
 		if (node->xstat_off == 0)
 			continue;
@@ -498,10 +538,16 @@ cluster_node_arregate_stats(struct cluster_node *cluster, bool dispatch)
 	if (dispatch) {
 		stat->dispatch.sched_objs = sched_objs;
 		stat->dispatch.sched_fail = sched_fail;
+		stat->dispatch.sched_block = sched_block;
 	}
 
+	stat->pmu_cntrs = nb_pmu;
+	for (i = 0; i < nb_pmu; i++)
+		stat->pmu_count[i] = pmu_count[i];
+
 	stat->ts = rte_get_timer_cycles();
 	stat->realloc_count = realloc_count;
+	stat->pause_count = pause_count;
 }
 
 static inline void
@@ -559,8 +605,59 @@ rte_graph_cluster_stats_reset(struct rte_graph_cluster_stats *stat)
 		node->prev_objs = 0;
 		node->prev_cycles = 0;
 		node->realloc_count = 0;
+		node->pause_count = 0;
 		for (i = 0; i < node->xstat_cntrs; i++)
 			node->xstat_count[i] = 0;
+		for (i = 0; i < node->pmu_cntrs; i++)
+			node->pmu_count[i] = 0;
 		cluster = RTE_PTR_ADD(cluster, stat->cluster_node_size);
 	}
 }
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_graph_pmu_enable, 25.07)
+int
+rte_graph_pmu_enable(const char * const *events, uint8_t nb_events)
+{
+#ifdef RTE_LIB_PMU
+	uint8_t i;
+	int ret;
+
+	if (events == NULL || nb_events == 0 ||
+	    nb_events > RTE_GRAPH_PMU_MAX_EVENTS)
+		return -EINVAL;
+
+	ret = rte_pmu_init();
+	if (ret < 0)
+		return ret;
+
+	for (i = 0; i < nb_events; i++) {
+		ret = rte_pmu_add_event(events[i]);
+		if (ret < 0) {
+			rte_pmu_fini();
+			return ret;
+		}
+		rte_graph_pmu.event_index[i] = ret;
+		rte_strscpy(rte_graph_pmu.event_name[i], events[i],
+			    RTE_NODE_XSTAT_DESC_SIZE);
+	}
+	rte_graph_pmu.nb_events = nb_events;
+	rte_graph_pmu.enabled = 1;
+
+	return 0;
+#else
+	RTE_SET_USED(events);
+	RTE_SET_USED(nb_events);
+	return -ENOTSUP;
+#endif
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_graph_pmu_disable, 25.07)
+void
+rte_graph_pmu_disable(void)
+{
+	rte_graph_pmu.enabled = 0;
+	rte_graph_pmu.nb_events = 0;
+#ifdef RTE_LIB_PMU
+	rte_pmu_fini();
+#endif
+}
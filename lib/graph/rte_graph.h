@@ -21,7 +21,9 @@
 #include <stdbool.h>
 #include <stdio.h>
 
+#include <rte_branch_prediction.h>
 #include <rte_common.h>
+#include <rte_stdatomic.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +32,7 @@ extern "C" {
 #define RTE_GRAPH_NAMESIZE 64 /**< Max length of graph name. */
 #define RTE_NODE_NAMESIZE 64  /**< Max length of node name. */
 #define RTE_NODE_XSTAT_DESC_SIZE 64  /**< Max length of node xstat description. */
+#define RTE_GRAPH_PMU_MAX_EVENTS 4 /**< Max number of sampled PMU events. */
 #define RTE_GRAPH_PCAP_FILE_SZ 64 /**< Max length of pcap file name. */
 #define RTE_GRAPH_OFF_INVALID UINT32_MAX /**< Invalid graph offset. */
 #define RTE_NODE_ID_INVALID UINT32_MAX   /**< Invalid node id. */
@@ -163,10 +166,30 @@ struct rte_graph_param {
 	bool pcap_enable; /**< Pcap enable. */
 	uint64_t num_pkt_to_capture; /**< Number of packets to capture. */
 	char *pcap_filename; /**< Filename in which packets to be captured.*/
+	uint16_t nb_pcap_node_patterns;
+	/**< Number of pcap node patterns, zero to capture on all nodes. */
+	const char **pcap_node_patterns;
+	/**< Array of node patterns selecting the nodes to capture on,
+	 * based on shell pattern.
+	 */
+	uint32_t pcap_sample_rate;
+	/**< Capture one packet out of every pcap_sample_rate packets seen
+	 * by a node, zero or one to capture every packet.
+	 */
 
 	union {
 		struct {
-			uint64_t rsvd; /**< Reserved for rtc model. */
+			uint16_t defer_watermark;
+			/**< Minimum number of objects a pending stream must
+			 * accumulate before its node is processed, zero to
+			 * process nodes as soon as they have objects.
+			 * Used by rtc model.
+			 */
+			uint64_t defer_flush_cycles;
+			/**< Maximum number of cycles a pending stream may
+			 * stay below the watermark before it is processed
+			 * regardless of occupancy. Used by rtc model.
+			 */
 		} rtc;
 		struct {
 			uint32_t wq_size_max; /**< Maximum size of workqueue for dispatch model. */
@@ -218,11 +241,18 @@ struct __rte_cache_aligned rte_graph_cluster_node_stats {
 			/**< Previous number of scheduled objs for dispatch model. */
 			uint64_t sched_fail;
 			/**< Previous number of failed schedule objs for dispatch model. */
+			uint64_t sched_block;
+			/**< Number of blocked stream enqueues for dispatch model. */
 		} dispatch;
 	};
 
 	uint64_t realloc_count; /**< Realloc count. */
 
+	uint64_t pause_count; /**< Number of backpressure assertions. */
+
+	uint8_t pmu_cntrs; /**< Number of sampled PMU event counters. */
+	uint64_t pmu_count[RTE_GRAPH_PMU_MAX_EVENTS]; /**< Total count per PMU event. */
+
 	uint8_t xstat_cntrs;			      /**< Number of Node xstat counters. */
 	char (*xstat_desc)[RTE_NODE_XSTAT_DESC_SIZE]; /**< Names of the Node xstat counters. */
 	uint64_t *xstat_count;			      /**< Total stat count per each xstat. */
@@ -353,6 +383,96 @@ void rte_graph_model_mcore_dispatch_core_unbind(rte_graph_t id);
  */
 struct rte_graph *rte_graph_lookup(const char *name);
 
+/**
+ * Graph handle for hitless graph replacement.
+ *
+ * A handle holds the graph pointer a worker walks, so the control plane
+ * can replace the graph under a running worker at a walk-loop boundary.
+ * The worker dereferences the handle with rte_graph_handle_get() on every
+ * loop iteration instead of caching the graph pointer.
+ */
+struct __rte_cache_aligned rte_graph_handle {
+	/** Graph the worker should walk, written by the control plane. */
+	RTE_ATOMIC(uintptr_t) graph;
+	/** Last graph pointer observed by the worker. */
+	RTE_ATOMIC(uintptr_t) seen;
+};
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Initialize a graph handle with the given graph.
+ *
+ * @param handle
+ *   Graph handle to initialize.
+ * @param id
+ *   Graph id to attach to the handle.
+ *
+ * @return
+ *   0 on success, -EINVAL on invalid handle or graph id.
+ */
+__rte_experimental
+int rte_graph_handle_init(struct rte_graph_handle *handle, rte_graph_t id);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Atomically replace the graph attached to a handle.
+ *
+ * The basic node statistics of the old graph are carried over to the
+ * identically named nodes of the new graph, then the new graph is
+ * published and the call blocks until the worker walking the handle has
+ * picked it up at a walk-loop boundary, after which the old graph can be
+ * safely destroyed with rte_graph_destroy().
+ *
+ * The worker must be executing a rte_graph_handle_get() based walk loop,
+ * otherwise this function never returns.
+ *
+ * @param handle
+ *   Graph handle to update.
+ * @param id
+ *   Graph id of the replacement graph, built beforehand.
+ *
+ * @return
+ *   Graph id of the replaced graph on success, RTE_GRAPH_ID_INVALID on
+ *   invalid handle or graph id.
+ */
+__rte_experimental
+rte_graph_t rte_graph_handle_swap(struct rte_graph_handle *handle,
+				  rte_graph_t id);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Get the graph attached to a handle, acknowledging a pending swap.
+ *
+ * Must be called by the worker on every walk-loop iteration; the returned
+ * pointer is valid until the next call.
+ *
+ * @param handle
+ *   Graph handle attached to the worker.
+ *
+ * @return
+ *   Pointer to the graph to walk.
+ */
+__rte_experimental
+static __rte_always_inline struct rte_graph *
+rte_graph_handle_get(struct rte_graph_handle *handle)
+{
+	uintptr_t cur;
+
+	cur = rte_atomic_load_explicit(&handle->graph, rte_memory_order_acquire);
+	if (unlikely(cur != rte_atomic_load_explicit(&handle->seen,
+						     rte_memory_order_relaxed)))
+		rte_atomic_store_explicit(&handle->seen, cur,
+					  rte_memory_order_release);
+
+	return (struct rte_graph *)cur;
+}
+
 /**
  * Get maximum number of graph available.
  *
@@ -465,6 +585,37 @@ void rte_graph_cluster_stats_get(struct rte_graph_cluster_stats *stat,
  */
 void rte_graph_cluster_stats_reset(struct rte_graph_cluster_stats *stat);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Enable PMU event sampling around node dispatch.
+ *
+ * Each node's stats will additionally accumulate the delta of the given
+ * PMU events across its process function, reported per node through
+ * rte_graph_cluster_stats_get(). Sampling requires the PMU library and
+ * should be enabled before worker threads start walking the graph.
+ *
+ * @param events
+ *   Array of PMU event names, as accepted by rte_pmu_add_event().
+ * @param nb_events
+ *   Number of events, up to RTE_GRAPH_PMU_MAX_EVENTS.
+ *
+ * @return
+ *   0 on success, negative otherwise.
+ */
+__rte_experimental
+int rte_graph_pmu_enable(const char * const *events, uint8_t nb_events);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Disable PMU event sampling around node dispatch.
+ */
+__rte_experimental
+void rte_graph_pmu_disable(void);
+
 /**
  * Structure defines the number of xstats a given node has and each xstat
  * description.
@@ -2,10 +2,67 @@
  * Copyright(C) 2023 Intel Corporation
  */
 
+#include <rte_lcore.h>
+#include <rte_malloc.h>
+
 #include "graph_private.h"
 #include <eal_export.h>
 #include "rte_graph_model_mcore_dispatch.h"
 
+static void
+graph_sched_sq_destroy(struct rte_graph *graph)
+{
+	uint16_t sq;
+
+	for (sq = 0; sq < graph->dispatch.n_sq; sq++)
+		rte_ring_free(graph->dispatch.sq[sq]);
+	graph->dispatch.n_sq = 0;
+
+	rte_free(graph->dispatch.sq_map);
+	graph->dispatch.sq_map = NULL;
+	graph->dispatch.sq = NULL;
+}
+
+static int
+graph_sched_sq_create(struct graph *_graph, unsigned int sq_size,
+		      unsigned int flags)
+{
+	struct rte_graph *graph = _graph->graph;
+	char ring_name[RTE_RING_NAMESIZE];
+	unsigned int lcore_id;
+	struct rte_ring *sq;
+	uint16_t n_sq = 0;
+
+	graph->dispatch.sq_map = rte_zmalloc_socket(NULL,
+			sizeof(struct rte_ring *) * (RTE_MAX_LCORE + rte_lcore_count()),
+			RTE_CACHE_LINE_SIZE, graph->socket);
+	if (graph->dispatch.sq_map == NULL)
+		SET_ERR_JMP(ENOMEM, fail, "Failed to allocate graph submit ring map");
+	graph->dispatch.sq = graph->dispatch.sq_map + RTE_MAX_LCORE;
+
+	for (lcore_id = 0; lcore_id < RTE_MAX_LCORE; lcore_id++) {
+		if (!rte_lcore_is_enabled(lcore_id) || lcore_id == _graph->lcore_id)
+			continue;
+
+		snprintf(ring_name, sizeof(ring_name), "gr_sq_%u_%u",
+			 graph->id, lcore_id);
+		sq = rte_ring_create(ring_name, sq_size, graph->socket,
+				     flags | RING_F_SP_ENQ);
+		if (sq == NULL)
+			SET_ERR_JMP(EIO, fail, "Failed to allocate graph submit ring");
+
+		graph->dispatch.sq_map[lcore_id] = sq;
+		graph->dispatch.sq[n_sq++] = sq;
+		graph->dispatch.n_sq = n_sq;
+	}
+
+	return 0;
+
+fail:
+	graph_sched_sq_destroy(graph);
+	return -rte_errno;
+}
+
 int
 graph_sched_wq_create(struct graph *_graph, struct graph *_parent_graph,
 		       struct rte_graph_param *prm)
@@ -30,6 +87,14 @@ graph_sched_wq_create(struct graph *_graph, struct graph *_parent_graph,
 	if (graph->dispatch.wq == NULL)
 		SET_ERR_JMP(EIO, fail, "Failed to allocate graph WQ");
 
+	/* Contention-free cross-core handoff. The shared WQ remains as a
+	 * fallback for producers without a submit ring of their own.
+	 */
+	if (graph_sched_sq_create(_graph, wq_size, flags))
+		goto fail_sq;
+
+	/* Cover the shared WQ and all the submit rings */
+	wq_size = wq_size * (graph->dispatch.n_sq + 1);
 	if (prm->dispatch.mp_capacity > 0)
 		wq_size = (wq_size <= prm->dispatch.mp_capacity) ? wq_size :
 			prm->dispatch.mp_capacity;
@@ -55,6 +120,8 @@ graph_sched_wq_create(struct graph *_graph, struct graph *_parent_graph,
 	return 0;
 
 fail_mp:
+	graph_sched_sq_destroy(graph);
+fail_sq:
 	rte_ring_free(graph->dispatch.wq);
 	graph->dispatch.wq = NULL;
 fail:
@@ -69,6 +136,8 @@ graph_sched_wq_destroy(struct graph *_graph)
 	if (graph == NULL)
 		return;
 
+	graph_sched_sq_destroy(graph);
+
 	rte_ring_free(graph->dispatch.wq);
 	graph->dispatch.wq = NULL;
 
@@ -80,9 +149,17 @@ static __rte_always_inline bool
 __graph_sched_node_enqueue(struct rte_node *node, struct rte_graph *graph)
 {
 	struct graph_mcore_dispatch_wq_node *wq_node;
+	const unsigned int lcore_id = rte_lcore_id();
+	struct rte_ring *sq = NULL;
 	uint16_t off = 0;
 	uint16_t size;
 
+	/* Contention-free submit ring of this source lcore, shared WQ
+	 * fallback for producers without one.
+	 */
+	if (lcore_id != LCORE_ID_ANY && graph->dispatch.sq_map != NULL)
+		sq = graph->dispatch.sq_map[lcore_id];
+
 submit_again:
 	if (rte_mempool_get(graph->dispatch.mp, (void **)&wq_node) < 0)
 		goto fallback;
@@ -92,9 +169,18 @@ submit_again:
 	wq_node->nb_objs = size;
 	rte_memcpy(wq_node->objs, &node->objs[off], size * sizeof(void *));
 
-	while (rte_ring_mp_enqueue_bulk_elem(graph->dispatch.wq, (void *)&wq_node,
-					     sizeof(wq_node), 1, NULL) == 0)
-		rte_pause();
+	if (sq != NULL)
+		while (rte_ring_sp_enqueue_bulk_elem(sq, (void *)&wq_node,
+						     sizeof(wq_node), 1, NULL) == 0) {
+			node->dispatch.total_sched_block++;
+			rte_pause();
+		}
+	else
+		while (rte_ring_mp_enqueue_bulk_elem(graph->dispatch.wq, (void *)&wq_node,
+						     sizeof(wq_node), 1, NULL) == 0) {
+			node->dispatch.total_sched_block++;
+			rte_pause();
+		}
 
 	off += size;
 	node->dispatch.total_sched_objs += size;
@@ -129,23 +215,15 @@ __rte_graph_mcore_dispatch_sched_node_enqueue(struct rte_node *node,
 	return graph != NULL ? __graph_sched_node_enqueue(node, graph) : false;
 }
 
-RTE_EXPORT_SYMBOL(__rte_graph_mcore_dispatch_sched_wq_process)
-void
-__rte_graph_mcore_dispatch_sched_wq_process(struct rte_graph *graph)
+static __rte_always_inline void
+graph_sched_wq_nodes_process(struct rte_graph *graph,
+			     struct graph_mcore_dispatch_wq_node **wq_nodes,
+			     unsigned int n)
 {
-#define WQ_SZ 32
 	struct graph_mcore_dispatch_wq_node *wq_node;
-	struct rte_mempool *mp = graph->dispatch.mp;
-	struct rte_ring *wq = graph->dispatch.wq;
 	uint16_t idx, free_space;
 	struct rte_node *node;
-	unsigned int i, n;
-	struct graph_mcore_dispatch_wq_node *wq_nodes[WQ_SZ];
-
-	n = rte_ring_sc_dequeue_burst_elem(wq, wq_nodes, sizeof(wq_nodes[0]),
-					   RTE_DIM(wq_nodes), NULL);
-	if (n == 0)
-		return;
+	unsigned int i;
 
 	for (i = 0; i < n; i++) {
 		wq_node = wq_nodes[i];
@@ -166,7 +244,31 @@ __rte_graph_mcore_dispatch_sched_wq_process(struct rte_graph *graph)
 		node->idx = 0;
 	}
 
-	rte_mempool_put_bulk(mp, (void **)wq_nodes, n);
+	rte_mempool_put_bulk(graph->dispatch.mp, (void **)wq_nodes, n);
+}
+
+RTE_EXPORT_SYMBOL(__rte_graph_mcore_dispatch_sched_wq_process)
+void
+__rte_graph_mcore_dispatch_sched_wq_process(struct rte_graph *graph)
+{
+#define WQ_SZ 32
+	struct graph_mcore_dispatch_wq_node *wq_nodes[WQ_SZ];
+	struct rte_ring *wq = graph->dispatch.wq;
+	unsigned int n;
+	uint16_t sq;
+
+	for (sq = 0; sq < graph->dispatch.n_sq; sq++) {
+		n = rte_ring_sc_dequeue_burst_elem(graph->dispatch.sq[sq],
+						   wq_nodes, sizeof(wq_nodes[0]),
+						   RTE_DIM(wq_nodes), NULL);
+		if (n != 0)
+			graph_sched_wq_nodes_process(graph, wq_nodes, n);
+	}
+
+	n = rte_ring_sc_dequeue_burst_elem(wq, wq_nodes, sizeof(wq_nodes[0]),
+					   RTE_DIM(wq_nodes), NULL);
+	if (n != 0)
+		graph_sched_wq_nodes_process(graph, wq_nodes, n);
 }
 
 RTE_EXPORT_SYMBOL(rte_graph_model_mcore_dispatch_node_lcore_affinity_set)
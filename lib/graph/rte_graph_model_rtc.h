@@ -19,8 +19,25 @@ rte_graph_walk_rtc(struct rte_graph *graph)
 {
 	const rte_graph_off_t *cir_start = graph->cir_start;
 	const rte_node_t mask = graph->cir_mask;
+	const uint16_t watermark = graph->defer_watermark;
 	uint32_t head = graph->head;
+	uint64_t defer_cycles = 0;
 	struct rte_node *node;
+	uint32_t n_deferred;
+	uint64_t now = 0;
+
+	if (watermark) {
+		/* Re-enqueue the streams deferred by the previous walk so
+		 * that their occupancy and age are evaluated again.
+		 */
+		n_deferred = graph->rtc.n_deferred;
+		while (n_deferred--)
+			graph->cir_start[graph->tail++ & mask] =
+				graph->rtc.defer_objs[n_deferred];
+		graph->rtc.n_deferred = 0;
+		defer_cycles = graph->rtc.defer_cycles;
+		now = rte_rdtsc();
+	}
 
 	/*
 	 * Walk on the source node(s) ((cir_start - head) -> cir_start) and then
@@ -39,6 +56,23 @@ rte_graph_walk_rtc(struct rte_graph *graph)
 	 */
 	while (likely(head != graph->tail)) {
 		node = (struct rte_node *)RTE_PTR_ADD(graph, cir_start[(int32_t)head++]);
+		if (watermark && (int32_t)head > 0) {
+			/* Defer a low occupancy pending stream until it
+			 * reaches the watermark or ages past the flush bound.
+			 * Source nodes are never deferred.
+			 */
+			if (node->idx < watermark) {
+				if (node->defer_start == 0)
+					node->defer_start = now;
+				if (now - node->defer_start < defer_cycles) {
+					graph->rtc.defer_objs[graph->rtc.n_deferred++] =
+						node->off;
+					head = head & mask;
+					continue;
+				}
+			}
+			node->defer_start = 0;
+		}
 		__rte_node_process(graph, node);
 		head = likely((int32_t)head > 0) ? head & mask : head;
 	}
@@ -21,6 +21,9 @@
 #include <rte_prefetch.h>
 #include <rte_memcpy.h>
 #include <rte_memory.h>
+#ifdef RTE_LIB_PMU
+#include <rte_pmu.h>
+#endif
 
 #include "rte_graph.h"
 
@@ -57,8 +60,20 @@ struct __rte_cache_aligned rte_graph {
 	rte_graph_off_t nodes_start; /**< Offset at which node memory starts. */
 	uint8_t model;		     /**< graph model */
 	uint8_t reserved1;	     /**< Reserved for future use. */
-	uint16_t reserved2;	     /**< Reserved for future use. */
+	uint16_t defer_watermark;
+	/**< Minimum stream occupancy to process a node, 0 to disable deferral. */
+	uint32_t nb_paused;
+	/**< Number of nodes currently asserting backpressure. */
 	union {
+		/* Fast schedule area for rtc model */
+		struct {
+			alignas(RTE_CACHE_LINE_SIZE) uint64_t defer_cycles;
+				/**< Max cycles a stream may stay deferred. */
+			uint32_t n_deferred;
+				/**< Number of streams deferred by last walk. */
+			rte_graph_off_t *defer_objs;
+				/**< Offsets of the deferred stream nodes. */
+		} rtc; /** Only used by rtc model */
 		/* Fast schedule area for mcore dispatch model */
 		struct {
 			alignas(RTE_CACHE_LINE_SIZE) struct rte_graph_rq_head *rq;
@@ -68,6 +83,10 @@ struct __rte_cache_aligned rte_graph {
 			unsigned int lcore_id;  /**< The graph running Lcore. */
 			struct rte_ring *wq;    /**< The work-queue for pending streams. */
 			struct rte_mempool *mp; /**< The mempool for scheduling streams. */
+			struct rte_ring **sq_map;
+				/**< Per source lcore SPSC submit rings. */
+			struct rte_ring **sq;   /**< Dense list of the submit rings. */
+			uint16_t n_sq;          /**< Number of submit rings. */
 		} dispatch; /** Only used by dispatch model */
 	};
 	SLIST_ENTRY(rte_graph) next;   /* The next for rte_graph list */
@@ -80,6 +99,10 @@ struct __rte_cache_aligned rte_graph {
 	uint64_t nb_pkt_captured;
 	/** Number of packets to capture per core. */
 	uint64_t nb_pkt_to_capture;
+	/** Capture one packet out of every pcap_sample_rate packets. */
+	uint32_t pcap_sample_rate;
+	/** Running packet count used for pcap sampling. */
+	uint32_t pcap_sample_phase;
 	char pcap_filename[RTE_GRAPH_PCAP_FILE_SZ];  /**< Pcap filename. */
 	uint64_t fence;			/**< Fence. */
 };
@@ -97,6 +120,7 @@ struct __rte_cache_aligned rte_node {
 	rte_node_t parent_id;	/**< Parent Node identifier. */
 	rte_edge_t nb_edges;	/**< Number of edges from this node. */
 	uint32_t realloc_count;	/**< Number of times realloced. */
+	uint8_t pcap_enable;	/**< Capture packets flowing through this node. */
 
 	char parent[RTE_NODE_NAMESIZE];	/**< Parent node name. */
 	char name[RTE_NODE_NAMESIZE];	/**< Name of the node. */
@@ -110,12 +134,18 @@ struct __rte_cache_aligned rte_node {
 			unsigned int lcore_id;  /**< Node running lcore. */
 			uint64_t total_sched_objs; /**< Number of objects scheduled. */
 			uint64_t total_sched_fail; /**< Number of scheduled failure. */
+			uint64_t total_sched_block; /**< Number of blocked stream enqueues. */
 		} dispatch;
 	};
 
 	/** Fast path area cache line 1. */
 	alignas(RTE_CACHE_LINE_MIN_SIZE)
 	rte_graph_off_t xstat_off; /**< Offset to xstat counters. */
+	uint32_t bp_paused; /**< Node is asserting backpressure. */
+	uint64_t defer_start; /**< Cycle count at which the stream was first deferred. */
+	uint64_t total_pause; /**< Number of times backpressure was asserted. */
+	/** Accumulated delta per sampled PMU event. */
+	uint64_t total_pmu[RTE_GRAPH_PMU_MAX_EVENTS];
 
 	/** Fast path area cache line 2. */
 	__extension__ struct __rte_cache_aligned {
@@ -148,6 +178,22 @@ struct __rte_cache_aligned rte_node {
 static_assert(offsetof(struct rte_node, nodes) - offsetof(struct rte_node, ctx)
 	== RTE_CACHE_LINE_MIN_SIZE, "rte_node fast path area must fit in 64 bytes");
 
+/**
+ * @internal
+ *
+ * Graph PMU sampling state, configured via rte_graph_pmu_enable().
+ */
+struct rte_graph_pmu_data {
+	uint8_t enabled;   /**< Sample PMU events around node dispatch. */
+	uint8_t nb_events; /**< Number of configured events. */
+	/** PMU library event indexes. */
+	uint8_t event_index[RTE_GRAPH_PMU_MAX_EVENTS];
+	/** Names of the configured events. */
+	char event_name[RTE_GRAPH_PMU_MAX_EVENTS][RTE_NODE_XSTAT_DESC_SIZE];
+};
+
+extern struct rte_graph_pmu_data rte_graph_pmu;
+
 /**
  * @internal
  *
@@ -203,11 +249,26 @@ __rte_node_process(struct rte_graph *graph, struct rte_node *node)
 	rte_prefetch0(objs);
 
 	if (rte_graph_has_stats_feature()) {
+#if defined(RTE_LIB_PMU) && defined(ALLOW_EXPERIMENTAL_API)
+		uint64_t pmu_start[RTE_GRAPH_PMU_MAX_EVENTS];
+		const uint8_t nb_pmu = rte_graph_pmu.enabled ?
+			rte_graph_pmu.nb_events : 0;
+		uint8_t ev;
+
+		for (ev = 0; ev < nb_pmu; ev++)
+			pmu_start[ev] = rte_pmu_read(rte_graph_pmu.event_index[ev]);
+#endif
 		start = rte_rdtsc();
 		rc = node->process(graph, node, objs, node->idx);
 		node->total_cycles += rte_rdtsc() - start;
 		node->total_calls++;
 		node->total_objs += rc;
+#if defined(RTE_LIB_PMU) && defined(ALLOW_EXPERIMENTAL_API)
+		for (ev = 0; ev < nb_pmu; ev++)
+			node->total_pmu[ev] +=
+				rte_pmu_read(rte_graph_pmu.event_index[ev]) -
+				pmu_start[ev];
+#endif
 	} else {
 		node->process(graph, node, objs, node->idx);
 	}
@@ -611,6 +672,97 @@ rte_node_xstat_increment(struct rte_node *node, uint16_t xstat_id, uint64_t valu
 	}
 }
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Assert backpressure on a node.
+ *
+ * Called by a node whose downstream resource (Tx queue, ring, ...) is
+ * full, so that upstream producers consulting rte_node_next_paused()
+ * or rte_graph_has_backpressure() throttle before overflowing it.
+ * The assertion is counted in the pause_count node statistic.
+ *
+ * @param graph
+ *   Pointer to the graph the node belongs to.
+ * @param node
+ *   Pointer to the node.
+ */
+__rte_experimental
+static inline void
+rte_node_backpressure_set(struct rte_graph *graph, struct rte_node *node)
+{
+	if (node->bp_paused == 0) {
+		node->bp_paused = 1;
+		node->total_pause++;
+		graph->nb_paused++;
+	}
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Release the backpressure previously asserted on a node.
+ *
+ * @param graph
+ *   Pointer to the graph the node belongs to.
+ * @param node
+ *   Pointer to the node.
+ */
+__rte_experimental
+static inline void
+rte_node_backpressure_clear(struct rte_graph *graph, struct rte_node *node)
+{
+	if (node->bp_paused != 0) {
+		node->bp_paused = 0;
+		graph->nb_paused--;
+	}
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Test whether the downstream node of an edge is asserting backpressure.
+ *
+ * @param node
+ *   Current node pointer.
+ * @param next
+ *   Relative next node index.
+ *
+ * @return
+ *   True if the next node is paused, false otherwise.
+ */
+__rte_experimental
+static inline bool
+rte_node_next_paused(const struct rte_node *node, rte_edge_t next)
+{
+	return node->nodes[next]->bp_paused != 0;
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Test whether any node of the graph is asserting backpressure.
+ *
+ * Source nodes use this to throttle their intake while some stage of
+ * the pipeline is congested, without tracking the exact edge.
+ *
+ * @param graph
+ *   Graph pointer returned from rte_graph_lookup().
+ *
+ * @return
+ *   True if at least one node is paused, false otherwise.
+ */
+__rte_experimental
+static inline bool
+rte_graph_has_backpressure(const struct rte_graph *graph)
+{
+	return graph->nb_paused != 0;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -5,10 +5,75 @@
 #include <rte_malloc.h>
 #include <rte_mbuf.h>
 #include <rte_ethdev.h>
+#include <rte_hash_crc.h>
 
 #include "gro_tcp4.h"
 #include "gro_tcp_internal.h"
 
+/*
+ * Flow key signature for the hash index. struct tcp4_flow_key has no
+ * padding holes, so the key can be hashed as a flat byte array. The CRC
+ * computation uses the CPU CRC32 instructions where available.
+ */
+static inline uint32_t
+tcp4_flow_sig(const struct tcp4_flow_key *key)
+{
+	return rte_hash_crc(key, sizeof(*key), 0);
+}
+
+static inline struct gro_tcp4_hash_bucket *
+tcp4_flow_bucket(struct gro_tcp4_tbl *tbl, uint32_t sig)
+{
+	return &tbl->hash[sig & tbl->hash_bucket_mask];
+}
+
+static inline uint32_t
+tcp4_hash_lookup(struct gro_tcp4_tbl *tbl, uint32_t sig,
+		const struct tcp4_flow_key *key)
+{
+	struct gro_tcp4_hash_bucket *bkt = tcp4_flow_bucket(tbl, sig);
+	uint32_t i, flow_idx;
+
+	for (i = 0; i < GRO_TCP4_HASH_ENTRIES_PER_BUCKET; i++) {
+		flow_idx = bkt->flow_idx[i];
+		if (flow_idx != INVALID_ARRAY_INDEX && bkt->sig[i] == sig &&
+				is_same_tcp4_flow(tbl->flows[flow_idx].key,
+					*key))
+			return flow_idx;
+	}
+	return INVALID_ARRAY_INDEX;
+}
+
+static inline int
+tcp4_hash_add(struct gro_tcp4_tbl *tbl, uint32_t sig, uint32_t flow_idx)
+{
+	struct gro_tcp4_hash_bucket *bkt = tcp4_flow_bucket(tbl, sig);
+	uint32_t i;
+
+	for (i = 0; i < GRO_TCP4_HASH_ENTRIES_PER_BUCKET; i++) {
+		if (bkt->flow_idx[i] == INVALID_ARRAY_INDEX) {
+			bkt->sig[i] = sig;
+			bkt->flow_idx[i] = flow_idx;
+			return 0;
+		}
+	}
+	return -1;
+}
+
+static inline void
+tcp4_hash_del(struct gro_tcp4_tbl *tbl, uint32_t sig, uint32_t flow_idx)
+{
+	struct gro_tcp4_hash_bucket *bkt = tcp4_flow_bucket(tbl, sig);
+	uint32_t i;
+
+	for (i = 0; i < GRO_TCP4_HASH_ENTRIES_PER_BUCKET; i++) {
+		if (bkt->flow_idx[i] == flow_idx) {
+			bkt->flow_idx[i] = INVALID_ARRAY_INDEX;
+			return;
+		}
+	}
+}
+
 void *
 gro_tcp4_tbl_create(uint16_t socket_id,
 		uint16_t max_flow_num,
@@ -57,6 +122,28 @@ gro_tcp4_tbl_create(uint16_t socket_id,
 		tbl->flows[i].start_index = INVALID_ARRAY_INDEX;
 	tbl->max_flow_num = entries_num;
 
+	/*
+	 * Hash index over the flow array, sized for a load factor of at
+	 * most 50% so flow lookup cost stays flat at high flow counts.
+	 */
+	tbl->hash_bucket_mask = rte_align32pow2(RTE_MAX(entries_num * 2 /
+			GRO_TCP4_HASH_ENTRIES_PER_BUCKET, 1U)) - 1;
+	size = sizeof(struct gro_tcp4_hash_bucket) *
+		(tbl->hash_bucket_mask + 1);
+	tbl->hash = rte_zmalloc_socket(__func__,
+			size,
+			RTE_CACHE_LINE_SIZE,
+			socket_id);
+	if (tbl->hash == NULL) {
+		rte_free(tbl->flows);
+		rte_free(tbl->items);
+		rte_free(tbl);
+		return NULL;
+	}
+	for (i = 0; i <= tbl->hash_bucket_mask; i++)
+		memset(tbl->hash[i].flow_idx, 0xff,
+				sizeof(tbl->hash[i].flow_idx));
+
 	return tbl;
 }
 
@@ -68,6 +155,7 @@ gro_tcp4_tbl_destroy(void *tbl)
 	if (tcp_tbl) {
 		rte_free(tcp_tbl->items);
 		rte_free(tcp_tbl->flows);
+		rte_free(tcp_tbl->hash);
 	}
 	rte_free(tcp_tbl);
 }
@@ -125,6 +213,7 @@ gro_tcp4_reassemble(struct rte_mbuf *pkt,
 	struct tcp4_flow_key key;
 	uint32_t item_idx;
 	uint32_t i, max_flow_num, remaining_flow_num;
+	uint32_t sig = 0;
 	uint8_t find;
 	uint32_t item_start_idx;
 
@@ -174,17 +263,26 @@ gro_tcp4_reassemble(struct rte_mbuf *pkt,
 	ip_id = is_atomic ? 0 : rte_be_to_cpu_16(ipv4_hdr->packet_id);
 
 	/* Search for a matched flow. */
-	max_flow_num = tbl->max_flow_num;
-	remaining_flow_num = tbl->flow_num;
 	find = 0;
-	for (i = 0; i < max_flow_num && remaining_flow_num; i++) {
-		if (tbl->flows[i].start_index != INVALID_ARRAY_INDEX) {
-			if (is_same_tcp4_flow(tbl->flows[i].key, key)) {
-				find = 1;
-				item_start_idx = tbl->flows[i].start_index;
-				break;
+	if (tbl->hash != NULL) {
+		sig = tcp4_flow_sig(&key);
+		i = tcp4_hash_lookup(tbl, sig, &key);
+		if (i != INVALID_ARRAY_INDEX) {
+			find = 1;
+			item_start_idx = tbl->flows[i].start_index;
+		}
+	} else {
+		max_flow_num = tbl->max_flow_num;
+		remaining_flow_num = tbl->flow_num;
+		for (i = 0; i < max_flow_num && remaining_flow_num; i++) {
+			if (tbl->flows[i].start_index != INVALID_ARRAY_INDEX) {
+				if (is_same_tcp4_flow(tbl->flows[i].key, key)) {
+					find = 1;
+					item_start_idx = tbl->flows[i].start_index;
+					break;
+				}
+				remaining_flow_num--;
 			}
-			remaining_flow_num--;
 		}
 	}
 
@@ -217,8 +315,8 @@ gro_tcp4_reassemble(struct rte_mbuf *pkt,
 						is_atomic);
 		if (item_idx == INVALID_ARRAY_INDEX)
 			return -1;
-		if (insert_new_flow(tbl, &key, item_idx) ==
-			INVALID_ARRAY_INDEX) {
+		i = insert_new_flow(tbl, &key, item_idx);
+		if (i == INVALID_ARRAY_INDEX) {
 			/*
 			 * Fail to insert a new flow, so delete the
 			 * stored packet.
@@ -226,6 +324,17 @@ gro_tcp4_reassemble(struct rte_mbuf *pkt,
 			delete_tcp_item(tbl->items, item_idx, &tbl->item_num, INVALID_ARRAY_INDEX);
 			return -1;
 		}
+		if (tbl->hash != NULL && tcp4_hash_add(tbl, sig, i) < 0) {
+			/*
+			 * The hash bucket is full, so the flow can't be
+			 * indexed and later packets wouldn't find it.
+			 * Delete the flow and the stored packet.
+			 */
+			tbl->flows[i].start_index = INVALID_ARRAY_INDEX;
+			tbl->flow_num--;
+			delete_tcp_item(tbl->items, item_idx, &tbl->item_num, INVALID_ARRAY_INDEX);
+			return -1;
+		}
 		return 0;
 	}
 
@@ -274,8 +383,13 @@ gro_tcp4_tbl_timeout_flush(struct gro_tcp4_tbl *tbl,
 				j = delete_tcp_item(tbl->items, j,
 							&tbl->item_num, INVALID_ARRAY_INDEX);
 				tbl->flows[i].start_index = j;
-				if (j == INVALID_ARRAY_INDEX)
+				if (j == INVALID_ARRAY_INDEX) {
 					tbl->flow_num--;
+					if (tbl->hash != NULL)
+						tcp4_hash_del(tbl,
+							tcp4_flow_sig(&tbl->flows[i].key),
+							i);
+				}
 
 				if (unlikely(k == nb_out))
 					return k;
@@ -9,6 +9,8 @@
 
 #define GRO_TCP4_TBL_MAX_ITEM_NUM (1024UL * 1024UL)
 
+#define GRO_TCP4_HASH_ENTRIES_PER_BUCKET 8
+
 /* Header fields representing common fields in TCP flow */
 struct tcp4_flow_key {
 	struct cmn_tcp_key cmn_key;
@@ -25,6 +27,16 @@ struct gro_tcp4_flow {
 	uint32_t start_index;
 };
 
+/*
+ * A set-associative hash bucket indexing the flow array, so flow lookup
+ * is a signature compare over one bucket instead of a scan of the whole
+ * flow array. flow_idx[i] is INVALID_ARRAY_INDEX for a free entry.
+ */
+struct gro_tcp4_hash_bucket {
+	uint32_t sig[GRO_TCP4_HASH_ENTRIES_PER_BUCKET];
+	uint32_t flow_idx[GRO_TCP4_HASH_ENTRIES_PER_BUCKET];
+};
+
 /*
  * TCP/IPv4 reassembly table structure.
  */
@@ -41,6 +53,14 @@ struct gro_tcp4_tbl {
 	uint32_t max_item_num;
 	/* flow array size */
 	uint32_t max_flow_num;
+	/*
+	 * Hash index over the flow array, NULL if flows are matched by
+	 * scanning the flow array (the per-burst tables of
+	 * rte_gro_reassemble_burst(), where the array is small).
+	 */
+	struct gro_tcp4_hash_bucket *hash;
+	/* hash bucket number - 1, bucket number is a power of two */
+	uint32_t hash_bucket_mask;
 };
 
 /**
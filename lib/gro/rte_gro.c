@@ -2,10 +2,13 @@
  * Copyright(c) 2017 Intel Corporation
  */
 
+#include <sys/queue.h>
+
 #include <eal_export.h>
 #include <rte_malloc.h>
 #include <rte_cycles.h>
 #include <rte_ethdev.h>
+#include <rte_spinlock.h>
 
 #include "rte_gro.h"
 #include "gro_tcp4.h"
@@ -236,6 +239,8 @@ rte_gro_reassemble_burst(struct rte_mbuf **pkts,
 		tcp_tbl.item_num = 0;
 		tcp_tbl.max_flow_num = item_num;
 		tcp_tbl.max_item_num = item_num;
+		/* the flow array is small, match flows by scanning it */
+		tcp_tbl.hash = NULL;
 		do_tcp4_gro = 1;
 	}
 
@@ -480,6 +485,151 @@ rte_gro_timeout_flush(void *ctx,
 	return num;
 }
 
+/*
+ * State of GRO enabled on one RX queue through
+ * rte_gro_rx_callback_enable(). Owned by the control path; the RX
+ * callback only touches the context and the flush deadline.
+ */
+struct gro_rx_cb {
+	LIST_ENTRY(gro_rx_cb) next;
+	void *ctx;		/* queue-private GRO context */
+	uint64_t gro_types;
+	uint64_t timeout_cycles;
+	uint64_t flush_interval;
+	uint64_t next_flush;	/* TSC deadline of the next flush check */
+	const struct rte_eth_rxtx_callback *cb;
+	uint16_t port_id;
+	uint16_t queue_id;
+};
+
+static LIST_HEAD(, gro_rx_cb) gro_rx_cb_list =
+	LIST_HEAD_INITIALIZER(gro_rx_cb_list);
+static rte_spinlock_t gro_rx_cb_lock = RTE_SPINLOCK_INITIALIZER;
+
+static uint16_t
+gro_rx_callback(uint16_t port_id __rte_unused, uint16_t queue_id __rte_unused,
+		struct rte_mbuf **pkts, uint16_t nb_pkts, uint16_t max_pkts,
+		void *user_param)
+{
+	struct gro_rx_cb *qgro = user_param;
+	uint64_t current_time;
+	uint16_t nb;
+
+	nb = rte_gro_reassemble(pkts, nb_pkts, qgro->ctx);
+
+	/*
+	 * Walk the reassembly tables only when the flush deadline has
+	 * passed, so idle and merge-heavy polls pay a single branch.
+	 */
+	current_time = rte_rdtsc();
+	if (current_time < qgro->next_flush || nb >= max_pkts)
+		return nb;
+	qgro->next_flush = current_time + qgro->flush_interval;
+
+	return nb + rte_gro_timeout_flush(qgro->ctx, qgro->timeout_cycles,
+			qgro->gro_types, &pkts[nb], max_pkts - nb);
+}
+
+static struct gro_rx_cb *
+gro_rx_cb_lookup(uint16_t port_id, uint16_t queue_id)
+{
+	struct gro_rx_cb *qgro;
+
+	LIST_FOREACH(qgro, &gro_rx_cb_list, next) {
+		if (qgro->port_id == port_id && qgro->queue_id == queue_id)
+			return qgro;
+	}
+	return NULL;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_gro_rx_callback_enable, 25.07)
+int
+rte_gro_rx_callback_enable(uint16_t port_id, uint16_t queue_id,
+		const struct rte_gro_param *param, uint64_t timeout_cycles)
+{
+	struct gro_rx_cb *qgro;
+	int ret = 0;
+
+	if (param == NULL || timeout_cycles == 0 ||
+			!rte_eth_dev_is_valid_port(port_id))
+		return -EINVAL;
+
+	qgro = rte_zmalloc_socket(__func__, sizeof(*qgro),
+			RTE_CACHE_LINE_SIZE, param->socket_id);
+	if (qgro == NULL)
+		return -ENOMEM;
+
+	qgro->ctx = rte_gro_ctx_create(param);
+	if (qgro->ctx == NULL) {
+		rte_free(qgro);
+		return -ENOMEM;
+	}
+	qgro->gro_types = param->gro_types;
+	qgro->timeout_cycles = timeout_cycles;
+	/* Check at twice the timeout rate to bound the flush latency. */
+	qgro->flush_interval = RTE_MAX(timeout_cycles / 2, UINT64_C(1));
+	qgro->next_flush = rte_rdtsc() + qgro->flush_interval;
+	qgro->port_id = port_id;
+	qgro->queue_id = queue_id;
+
+	rte_spinlock_lock(&gro_rx_cb_lock);
+	if (gro_rx_cb_lookup(port_id, queue_id) != NULL) {
+		ret = -EEXIST;
+		goto fail;
+	}
+
+	qgro->cb = rte_eth_add_rx_callback(port_id, queue_id,
+			gro_rx_callback, qgro);
+	if (qgro->cb == NULL) {
+		ret = -rte_errno;
+		goto fail;
+	}
+	LIST_INSERT_HEAD(&gro_rx_cb_list, qgro, next);
+	rte_spinlock_unlock(&gro_rx_cb_lock);
+
+	return 0;
+
+fail:
+	rte_spinlock_unlock(&gro_rx_cb_lock);
+	rte_gro_ctx_destroy(qgro->ctx);
+	rte_free(qgro);
+	return ret;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_gro_rx_callback_disable, 25.07)
+int
+rte_gro_rx_callback_disable(uint16_t port_id, uint16_t queue_id)
+{
+	struct rte_mbuf *pkts[RTE_GRO_MAX_BURST_ITEM_NUM];
+	struct gro_rx_cb *qgro;
+	uint16_t nb;
+	int ret;
+
+	rte_spinlock_lock(&gro_rx_cb_lock);
+	qgro = gro_rx_cb_lookup(port_id, queue_id);
+	if (qgro == NULL) {
+		rte_spinlock_unlock(&gro_rx_cb_lock);
+		return -ENOENT;
+	}
+	LIST_REMOVE(qgro, next);
+	rte_spinlock_unlock(&gro_rx_cb_lock);
+
+	ret = rte_eth_remove_rx_callback(port_id, queue_id, qgro->cb);
+
+	/* Drop the packets still sitting in the reassembly tables. */
+	do {
+		nb = rte_gro_timeout_flush(qgro->ctx, 0, qgro->gro_types,
+				pkts, RTE_DIM(pkts));
+		if (nb > 0)
+			rte_pktmbuf_free_bulk(pkts, nb);
+	} while (nb > 0);
+
+	rte_gro_ctx_destroy(qgro->ctx);
+	rte_free(qgro);
+
+	return ret;
+}
+
 RTE_EXPORT_SYMBOL(rte_gro_get_pkt_count)
 uint64_t
 rte_gro_get_pkt_count(void *ctx)
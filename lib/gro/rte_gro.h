@@ -191,6 +191,60 @@ uint16_t rte_gro_timeout_flush(void *ctx,
  */
 uint64_t rte_gro_get_pkt_count(void *ctx);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice
+ *
+ * Enable GRO on one ethdev RX queue with a single call.
+ *
+ * This function creates a GRO context private to the queue and installs
+ * an RX callback that runs rte_gro_reassemble() on every received burst
+ * and flushes aged packets from the reassembly tables. The flush check
+ * is deadline based: the tables are only walked when half the timeout
+ * has elapsed since the previous flush, not on every burst.
+ *
+ * The queue must be polled from a single lcore, as required by
+ * rte_gro_reassemble() itself.
+ *
+ * @param port_id
+ *  The port identifier of the Ethernet device.
+ * @param queue_id
+ *  The index of the RX queue.
+ * @param param
+ *  Parameters of the queue GRO context, see rte_gro_ctx_create().
+ * @param timeout_cycles
+ *  Max TSC cycles a packet may stay in the reassembly tables.
+ *
+ * @return
+ *  0 on success, negative errno otherwise (-EEXIST if GRO is already
+ *  enabled on the queue).
+ */
+__rte_experimental
+int rte_gro_rx_callback_enable(uint16_t port_id, uint16_t queue_id,
+		const struct rte_gro_param *param, uint64_t timeout_cycles);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice
+ *
+ * Disable GRO previously enabled on an ethdev RX queue with
+ * rte_gro_rx_callback_enable(). Packets still held in the reassembly
+ * tables are freed. The application must guarantee the queue is not
+ * being polled when this function is called, as required by
+ * rte_eth_remove_rx_callback().
+ *
+ * @param port_id
+ *  The port identifier of the Ethernet device.
+ * @param queue_id
+ *  The index of the RX queue.
+ *
+ * @return
+ *  0 on success, negative errno otherwise (-ENOENT if GRO is not
+ *  enabled on the queue).
+ */
+__rte_experimental
+int rte_gro_rx_callback_disable(uint16_t port_id, uint16_t queue_id);
+
 #ifdef __cplusplus
 }
 #endif
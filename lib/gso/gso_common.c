@@ -37,6 +37,35 @@ free_gso_segment(struct rte_mbuf **pkts, uint16_t nb_pkts)
 		rte_pktmbuf_free(pkts[i]);
 }
 
+/* Number of indirect MBUFs taken from the pool per bulk allocation */
+#define GSO_PYLD_ALLOC_BULK 32
+
+/*
+ * Attach an indirect MBUF to a direct input segment like
+ * rte_pktmbuf_attach(), but don't touch the reference count of the
+ * input segment. The caller accounts for all attachments to an input
+ * segment with a single rte_mbuf_refcnt_update(), instead of one
+ * atomic update per payload chunk.
+ */
+static inline void
+pyld_segment_attach(struct rte_mbuf *mi, struct rte_mbuf *m)
+{
+	mi->priv_size = m->priv_size;
+	mi->ol_flags = m->ol_flags | RTE_MBUF_F_INDIRECT;
+
+	__rte_pktmbuf_copy_hdr(mi, m);
+
+	mi->data_off = m->data_off;
+	mi->data_len = m->data_len;
+	rte_mbuf_iova_set(mi, rte_mbuf_iova_get(m));
+	mi->buf_addr = m->buf_addr;
+	mi->buf_len = m->buf_len;
+
+	mi->next = NULL;
+	mi->pkt_len = mi->data_len;
+	mi->nb_segs = 1;
+}
+
 int
 gso_do_segment(struct rte_mbuf *pkt,
 		uint16_t pkt_hdr_offset,
@@ -46,29 +75,78 @@ gso_do_segment(struct rte_mbuf *pkt,
 		struct rte_mbuf **pkts_out,
 		uint16_t nb_pkts_out)
 {
+	struct rte_mbuf *pyld_bulk[GSO_PYLD_ALLOC_BULK];
 	struct rte_mbuf *pkt_in;
 	struct rte_mbuf *hdr_segment, *pyld_segment, *prev_segment;
+	uint32_t nb_segs, nb_pylds, attach_cnt, i;
 	uint16_t pkt_in_data_pos, segment_bytes_remaining;
-	uint16_t pyld_len, nb_segs;
-	bool more_in_pkt, more_out_segs;
+	uint16_t pyld_len, pyld_cnt, pyld_idx;
+	bool more_in_pkt, more_out_segs, batch_refcnt;
+
+	/*
+	 * Count the output segments and payload chunks first, so that the
+	 * MBUFs can be taken from the pools in bulk. One payload chunk is
+	 * needed per GSO segment, plus one more every time a segment spans
+	 * an input MBUF boundary.
+	 */
+	batch_refcnt = true;
+	for (pkt_in = pkt; pkt_in != NULL; pkt_in = pkt_in->next) {
+		if (!RTE_MBUF_DIRECT(pkt_in)) {
+			batch_refcnt = false;
+			break;
+		}
+	}
 
 	pkt_in = pkt;
 	nb_segs = 0;
+	nb_pylds = 0;
 	more_in_pkt = 1;
 	pkt_in_data_pos = pkt_hdr_offset;
 
 	while (more_in_pkt) {
-		if (unlikely(nb_segs >= nb_pkts_out)) {
-			free_gso_segment(pkts_out, nb_segs);
-			return -EINVAL;
-		}
+		nb_segs++;
+		segment_bytes_remaining = pyld_unit_size;
+		more_out_segs = 1;
+
+		while (more_out_segs && more_in_pkt) {
+			nb_pylds++;
+
+			pyld_len = segment_bytes_remaining;
+			if (pyld_len + pkt_in_data_pos > pkt_in->data_len)
+				pyld_len = pkt_in->data_len - pkt_in_data_pos;
 
-		/* Allocate a direct MBUF */
-		hdr_segment = rte_pktmbuf_alloc(direct_pool);
-		if (unlikely(hdr_segment == NULL)) {
-			free_gso_segment(pkts_out, nb_segs);
-			return -ENOMEM;
+			pkt_in_data_pos += pyld_len;
+			segment_bytes_remaining -= pyld_len;
+
+			if (pkt_in_data_pos == pkt_in->data_len) {
+				pkt_in = pkt_in->next;
+				pkt_in_data_pos = 0;
+				if (pkt_in == NULL)
+					more_in_pkt = 0;
+			}
+
+			if (segment_bytes_remaining == 0)
+				more_out_segs = 0;
 		}
+	}
+
+	if (unlikely(nb_segs > nb_pkts_out))
+		return -EINVAL;
+
+	/* Allocate all direct MBUFs at once */
+	if (unlikely(rte_pktmbuf_alloc_bulk(direct_pool, pkts_out,
+					nb_segs) != 0))
+		return -ENOMEM;
+
+	pkt_in = pkt;
+	more_in_pkt = 1;
+	pkt_in_data_pos = pkt_hdr_offset;
+	attach_cnt = 0;
+	pyld_cnt = 0;
+	pyld_idx = 0;
+
+	for (i = 0; i < nb_segs; i++) {
+		hdr_segment = pkts_out[i];
 		/* Fill the packet header */
 		hdr_segment_init(hdr_segment, pkt, pkt_hdr_offset);
 
@@ -77,15 +155,31 @@ gso_do_segment(struct rte_mbuf *pkt,
 		more_out_segs = 1;
 
 		while (more_out_segs && more_in_pkt) {
-			/* Allocate an indirect MBUF */
-			pyld_segment = rte_pktmbuf_alloc(indirect_pool);
-			if (unlikely(pyld_segment == NULL)) {
-				rte_pktmbuf_free(hdr_segment);
-				free_gso_segment(pkts_out, nb_segs);
-				return -ENOMEM;
+			/* Refill the bulk of indirect MBUFs */
+			if (pyld_idx == pyld_cnt) {
+				pyld_cnt = RTE_MIN(nb_pylds,
+						(uint32_t)GSO_PYLD_ALLOC_BULK);
+				if (unlikely(rte_pktmbuf_alloc_bulk(
+						indirect_pool, pyld_bulk,
+						pyld_cnt) != 0)) {
+					if (attach_cnt > 0)
+						rte_mbuf_refcnt_update(pkt_in,
+								attach_cnt);
+					free_gso_segment(pkts_out, nb_segs);
+					return -ENOMEM;
+				}
+				nb_pylds -= pyld_cnt;
+				pyld_idx = 0;
 			}
+			pyld_segment = pyld_bulk[pyld_idx++];
+
 			/* Attach to current MBUF segment of pkt */
-			rte_pktmbuf_attach(pyld_segment, pkt_in);
+			if (batch_refcnt) {
+				pyld_segment_attach(pyld_segment, pkt_in);
+				attach_cnt++;
+			} else {
+				rte_pktmbuf_attach(pyld_segment, pkt_in);
+			}
 
 			prev_segment->next = pyld_segment;
 			prev_segment = pyld_segment;
@@ -107,6 +201,11 @@ gso_do_segment(struct rte_mbuf *pkt,
 
 			/* Finish processing a MBUF segment of pkt */
 			if (pkt_in_data_pos == pkt_in->data_len) {
+				if (attach_cnt > 0) {
+					rte_mbuf_refcnt_update(pkt_in,
+							attach_cnt);
+					attach_cnt = 0;
+				}
 				pkt_in = pkt_in->next;
 				pkt_in_data_pos = 0;
 				if (pkt_in == NULL)
@@ -117,7 +216,6 @@ gso_do_segment(struct rte_mbuf *pkt,
 			if (segment_bytes_remaining == 0)
 				more_out_segs = 0;
 		}
-		pkts_out[nb_segs++] = hdr_segment;
 	}
 	return nb_segs;
 }
@@ -117,6 +117,11 @@ update_ipv4_header(struct rte_mbuf *pkt, uint16_t l3_offset, uint16_t id)
  * packet header, and the second is an indirect mbuf which points to a
  * section of data in the input packet.
  *
+ * The output MBUFs are taken from the pools in bulk, and the reference
+ * count of each input MBUF segment is raised with a single update that
+ * covers all the indirect MBUFs attached to it, rather than once per
+ * attachment.
+ *
  * @param pkt
  *  Packet to segment.
  * @param pkt_hdr_offset
@@ -27,6 +27,29 @@ compare_signatures_sparse(uint32_t *prim_hash_matches, uint32_t *sec_hash_matche
 
 	/* For match mask the first bit of every two bits indicates the match */
 	switch (sig_cmp_fn) {
+#if defined(__AVX512VL__) && defined(__AVX512BW__) && defined(__BMI2__) && \
+	RTE_HASH_BUCKET_ENTRIES <= 8
+	case RTE_HASH_COMPARE_AVX512: {
+		/*
+		 * Compare the signatures of both buckets in a single 256-bit
+		 * compare, producing a dense hit mask in a mask register
+		 * (primary bucket in the low byte, secondary in the high one)
+		 * instead of two compare+movemask+and sequences.
+		 */
+		__m256i both = _mm256_inserti128_si256(
+			_mm256_castsi128_si256(_mm_load_si128(
+				(__m128i const *)prim_bkt->sig_current)),
+			_mm_load_si128((__m128i const *)sec_bkt->sig_current),
+			1);
+		uint32_t hits = _mm256_cmpeq_epi16_mask(both,
+			_mm256_set1_epi16(sig));
+
+		/* Spread the dense bytes into the sparse hitmask format */
+		*prim_hash_matches = _pdep_u32(hits & 0xff, 0x5555);
+		*sec_hash_matches = _pdep_u32(hits >> 8, 0x5555);
+		break;
+	}
+#endif
 #if defined(__SSE2__) && RTE_HASH_BUCKET_ENTRIES <= 8
 	case RTE_HASH_COMPARE_SSE:
 		/* Compare all signatures in the bucket */
@@ -5,6 +5,7 @@
 
 #include <string.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <errno.h>
 #include <stdio.h>
 #include <sys/queue.h>
@@ -40,6 +41,7 @@ RTE_LOG_REGISTER_DEFAULT(hash_logtype, INFO);
 enum rte_hash_sig_compare_function {
 	RTE_HASH_COMPARE_SCALAR = 0,
 	RTE_HASH_COMPARE_SSE,
+	RTE_HASH_COMPARE_AVX512,
 	RTE_HASH_COMPARE_NEON,
 	RTE_HASH_COMPARE_SVE,
 };
@@ -65,6 +67,22 @@ enum rte_hash_sig_compare_function {
 		CURRENT_BKT != NULL;                                          \
 		CURRENT_BKT = CURRENT_BKT->next)
 
+/* Two filter bits per key, both derived from the short signature. */
+static inline uint16_t
+ext_bloom_mask(uint16_t sig)
+{
+	return (uint16_t)((1U << (sig & 0xF)) | (1U << ((sig >> 4) & 0xF)));
+}
+
+/* False positives possible, false negatives not. */
+static inline int
+ext_chain_may_contain(const struct rte_hash *h, uint32_t bkt_idx, uint16_t sig)
+{
+	uint16_t mask = ext_bloom_mask(sig);
+
+	return (h->ext_bloom[bkt_idx] & mask) == mask;
+}
+
 TAILQ_HEAD(rte_hash_list, rte_tailq_entry);
 
 static struct rte_tailq_elem rte_hash_tailq = {
@@ -178,6 +196,7 @@ rte_hash_create(const struct rte_hash_parameters *params)
 	unsigned int writer_takes_lock = 0;
 	unsigned int no_free_on_del = 0;
 	uint32_t *ext_bkt_to_free = NULL;
+	uint16_t *ext_bloom = NULL;
 	RTE_ATOMIC(uint32_t) *tbl_chng_cnt = NULL;
 	struct lcore_cache *local_free_slots = NULL;
 	unsigned int readwrite_concur_lf_support = 0;
@@ -358,6 +377,16 @@ rte_hash_create(const struct rte_hash_parameters *params)
 		for (i = 1; i <= num_buckets; i++)
 			rte_ring_sp_enqueue_elem(r_ext, &i, sizeof(uint32_t));
 
+		/* Per-bucket filter over the ext chain signatures. */
+		ext_bloom = rte_zmalloc_socket(NULL,
+				num_buckets * sizeof(uint16_t),
+				RTE_CACHE_LINE_SIZE, params->socket_id);
+		if (ext_bloom == NULL) {
+			HASH_LOG(ERR, "ext chain filter memory allocation "
+							"failed");
+			goto err_unlock;
+		}
+
 		if (readwrite_concur_lf_support) {
 			ext_bkt_to_free = rte_zmalloc(NULL, sizeof(uint32_t) *
 								num_key_slots, 0);
@@ -463,6 +492,7 @@ rte_hash_create(const struct rte_hash_parameters *params)
 	h->key_store = k;
 	h->free_slots = r;
 	h->ext_bkt_to_free = ext_bkt_to_free;
+	h->ext_bloom = ext_bloom;
 	h->tbl_chng_cnt = tbl_chng_cnt;
 	*h->tbl_chng_cnt = 0;
 	h->hw_trans_mem_support = hw_trans_mem_support;
@@ -475,6 +505,12 @@ rte_hash_create(const struct rte_hash_parameters *params)
 	h->readwrite_concur_lf_support = readwrite_concur_lf_support;
 
 #if defined(RTE_ARCH_X86)
+#if defined(__AVX512VL__) && defined(__AVX512BW__) && defined(__BMI2__)
+	if (rte_cpu_get_flag_enabled(RTE_CPUFLAG_AVX512VL) &&
+			rte_cpu_get_flag_enabled(RTE_CPUFLAG_AVX512BW))
+		h->sig_cmp_fn = RTE_HASH_COMPARE_AVX512;
+	else
+#endif
 	if (rte_cpu_get_flag_enabled(RTE_CPUFLAG_SSE2))
 		h->sig_cmp_fn = RTE_HASH_COMPARE_SSE;
 	else
@@ -525,6 +561,7 @@ err:
 	rte_free(k);
 	rte_free((void *)(uintptr_t)tbl_chng_cnt);
 	rte_free(ext_bkt_to_free);
+	rte_free(ext_bloom);
 	return NULL;
 }
 
@@ -571,7 +608,9 @@ rte_hash_free(struct rte_hash *h)
 	rte_free(h->buckets_ext);
 	rte_free((void *)(uintptr_t)h->tbl_chng_cnt);
 	rte_free(h->ext_bkt_to_free);
+	rte_free(h->ext_bloom);
 	rte_free(h->hash_rcu_cfg);
+	rte_free(h->frozen);
 	rte_free(h);
 	rte_free(te);
 }
@@ -684,11 +723,15 @@ rte_hash_reset(struct rte_hash *h)
 
 	if (h->dq) {
 		/* Reclaim all the resources */
-		rte_rcu_qsbr_dq_reclaim(h->dq, ~0, NULL, &pending, NULL);
+		rte_rcu_qsbr_dq_reclaim_burst(h->dq, ~0, NULL, &pending, NULL);
 		if (pending != 0)
 			HASH_LOG(ERR, "RCU reclaim all resources failed");
 	}
 
+	/* A reset table starts accepting updates again */
+	rte_free(h->frozen);
+	h->frozen = NULL;
+
 	memset(h->buckets, 0, h->num_buckets * sizeof(struct rte_hash_bucket));
 	memset(h->key_store, 0, h->key_entry_size * (h->entries + 1));
 	*h->tbl_chng_cnt = 0;
@@ -700,6 +743,7 @@ rte_hash_reset(struct rte_hash *h)
 	if (h->ext_table_support) {
 		memset(h->buckets_ext, 0, h->num_buckets *
 						sizeof(struct rte_hash_bucket));
+		memset(h->ext_bloom, 0, h->num_buckets * sizeof(uint16_t));
 		rte_ring_reset(h->free_ext_bkts);
 	}
 
@@ -728,6 +772,214 @@ rte_hash_reset(struct rte_hash *h)
 	__hash_rw_writer_unlock(h);
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_hash_resize, 25.07)
+int
+rte_hash_resize(struct rte_hash *h, uint32_t new_entries)
+{
+	char name[RTE_HASH_NAMESIZE];
+	struct rte_hash_parameters params;
+	struct rte_hash *new_h;
+	struct rte_hash old;
+	rte_rwlock_t *lock, *new_lock;
+	const struct rte_hash_key *key_slot;
+	uint32_t bucket_idx, idx, position, next, total;
+	uint8_t extra_flag = 0;
+	int ret = 0;
+
+	if (h == NULL || new_entries == 0)
+		return -EINVAL;
+
+	/*
+	 * Lock-free readers walk the bucket arrays without any lock, and RCU
+	 * reclamation references the current key store, so neither can
+	 * tolerate the arrays being swapped underneath them.
+	 */
+	if (h->readwrite_concur_lf_support || h->hash_rcu_cfg != NULL)
+		return -ENOTSUP;
+
+	/* A frozen table is read-only until rte_hash_unfreeze() */
+	if (h->frozen != NULL)
+		return -EBUSY;
+
+	/* Build a new table with the same properties but the new size. */
+	snprintf(name, sizeof(name), "RSZ_%.26s", h->name);
+
+	if (h->hw_trans_mem_support)
+		extra_flag |= RTE_HASH_EXTRA_FLAGS_TRANS_MEM_SUPPORT;
+	if (h->use_local_cache)
+		extra_flag |= RTE_HASH_EXTRA_FLAGS_MULTI_WRITER_ADD;
+	if (h->readwrite_concur_support)
+		extra_flag |= RTE_HASH_EXTRA_FLAGS_RW_CONCURRENCY;
+	if (h->ext_table_support)
+		extra_flag |= RTE_HASH_EXTRA_FLAGS_EXT_TABLE;
+	if (h->no_free_on_del)
+		extra_flag |= RTE_HASH_EXTRA_FLAGS_NO_FREE_ON_DEL;
+
+	memset(&params, 0, sizeof(params));
+	params.name = name;
+	params.entries = new_entries;
+	params.key_len = h->key_len;
+	params.hash_func = h->hash_func;
+	params.hash_func_init_val = h->hash_func_init_val;
+	params.socket_id = (int)rte_socket_id();
+	params.extra_flag = extra_flag;
+
+	new_h = rte_hash_create(&params);
+	if (new_h == NULL)
+		return -ENOMEM;
+
+	/* Preserve a comparison function set with rte_hash_set_cmp_func(). */
+	new_h->rte_hash_custom_cmp_eq = h->rte_hash_custom_cmp_eq;
+	new_h->cmp_jump_table_idx = h->cmp_jump_table_idx;
+
+	__hash_rw_writer_lock(h);
+
+	/*
+	 * Re-insert every key into the new table. The walk mirrors
+	 * rte_hash_iterate(), minus the locking: the writer lock is held, so
+	 * no entry can change underneath us.
+	 */
+	total = h->num_buckets * RTE_HASH_BUCKET_ENTRIES;
+	for (next = 0; next < total; next++) {
+		bucket_idx = next / RTE_HASH_BUCKET_ENTRIES;
+		idx = next % RTE_HASH_BUCKET_ENTRIES;
+		position = h->buckets[bucket_idx].key_idx[idx];
+		if (position == EMPTY_SLOT)
+			continue;
+		key_slot = (const struct rte_hash_key *)(
+			(const char *)h->key_store +
+			position * h->key_entry_size);
+		ret = rte_hash_add_key_data(new_h, key_slot->key,
+				key_slot->pdata);
+		if (ret < 0)
+			goto fail;
+	}
+	if (h->ext_table_support) {
+		for (next = 0; next < total; next++) {
+			bucket_idx = next / RTE_HASH_BUCKET_ENTRIES;
+			idx = next % RTE_HASH_BUCKET_ENTRIES;
+			position = h->buckets_ext[bucket_idx].key_idx[idx];
+			if (position == EMPTY_SLOT)
+				continue;
+			key_slot = (const struct rte_hash_key *)(
+				(const char *)h->key_store +
+				position * h->key_entry_size);
+			ret = rte_hash_add_key_data(new_h, key_slot->key,
+					key_slot->pdata);
+			if (ret < 0)
+				goto fail;
+		}
+	}
+
+	/*
+	 * Swap the table guts. The handle keeps its name, its lock (currently
+	 * held) and its tailq entry; the temporary table inherits the old
+	 * arrays and rings so that rte_hash_free() below releases them.
+	 */
+	lock = h->readwrite_lock;
+	new_lock = new_h->readwrite_lock;
+	old = *h;
+	*h = *new_h;
+	memcpy(h->name, old.name, sizeof(h->name));
+	h->readwrite_lock = lock;
+	*new_h = old;
+	new_h->readwrite_lock = new_lock;
+
+	__hash_rw_writer_unlock(h);
+
+	rte_hash_free(new_h);
+	return 0;
+
+fail:
+	__hash_rw_writer_unlock(h);
+	rte_hash_free(new_h);
+	return ret;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_hash_freeze, 25.07)
+int
+rte_hash_freeze(struct rte_hash *h)
+{
+	struct rte_hash_frozen *ft;
+	const struct rte_hash_key *key_slot;
+	uint32_t bucket_idx, idx, position, next, total, size, slot;
+	hash_sig_t sig;
+
+	if (h == NULL)
+		return -EINVAL;
+	if (h->frozen != NULL)
+		return 0;
+
+	__hash_rw_writer_lock(h);
+
+	/*
+	 * Size the flat table at twice the stored key count (at least one
+	 * bucket worth) so linear probe runs stay short.
+	 */
+	size = rte_align32pow2(rte_hash_count(h) * 2);
+	if (size < RTE_HASH_BUCKET_ENTRIES)
+		size = RTE_HASH_BUCKET_ENTRIES;
+
+	ft = rte_zmalloc_socket(NULL, sizeof(*ft) +
+			(size_t)size * sizeof(ft->entries[0]),
+			RTE_CACHE_LINE_SIZE, (int)rte_socket_id());
+	if (ft == NULL) {
+		__hash_rw_writer_unlock(h);
+		return -ENOMEM;
+	}
+	ft->mask = size - 1;
+
+	/*
+	 * Place every stored key at the slot indexed by its full hash,
+	 * resolving collisions by linear probing. The key store itself is
+	 * left in place, so the positions returned by lookups do not change.
+	 */
+	total = h->num_buckets * RTE_HASH_BUCKET_ENTRIES;
+	for (next = 0; next < (h->ext_table_support ? 2 * total : total);
+			next++) {
+		bucket_idx = (next % total) / RTE_HASH_BUCKET_ENTRIES;
+		idx = next % RTE_HASH_BUCKET_ENTRIES;
+		if (next < total)
+			position = h->buckets[bucket_idx].key_idx[idx];
+		else
+			position = h->buckets_ext[bucket_idx].key_idx[idx];
+		if (position == EMPTY_SLOT)
+			continue;
+		key_slot = (const struct rte_hash_key *)(
+			(const char *)h->key_store +
+			position * h->key_entry_size);
+		sig = rte_hash_hash(h, key_slot->key);
+		slot = sig & ft->mask;
+		while (ft->entries[slot].key_idx != EMPTY_SLOT)
+			slot = (slot + 1) & ft->mask;
+		ft->entries[slot].key_idx = position;
+		ft->entries[slot].sig = sig;
+	}
+
+	h->frozen = ft;
+
+	__hash_rw_writer_unlock(h);
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_hash_unfreeze, 25.07)
+int
+rte_hash_unfreeze(struct rte_hash *h)
+{
+	struct rte_hash_frozen *ft;
+
+	if (h == NULL)
+		return -EINVAL;
+
+	__hash_rw_writer_lock(h);
+	ft = h->frozen;
+	h->frozen = NULL;
+	__hash_rw_writer_unlock(h);
+
+	rte_free(ft);
+	return 0;
+}
+
 /*
  * Function called to enqueue back an index in the cache/ring,
  * as slot has not being used and it can be used in the
@@ -1078,6 +1330,10 @@ __rte_hash_add_key_with_hash(const struct rte_hash *h, const void *key,
 	int32_t ret_val;
 	struct rte_hash_bucket *last;
 
+	/* A frozen table is read-only until rte_hash_unfreeze() */
+	if (unlikely(h->frozen != NULL))
+		return -EBUSY;
+
 	short_sig = get_short_sig(sig);
 	prim_bucket_idx = get_prim_bucket_index(h, sig);
 	sec_bucket_idx = get_alt_bucket_index(h, prim_bucket_idx, short_sig);
@@ -1114,7 +1370,7 @@ __rte_hash_add_key_with_hash(const struct rte_hash *h, const void *key,
 	if (slot_id == EMPTY_SLOT) {
 		if (h->dq) {
 			__hash_rw_writer_lock(h);
-			ret = rte_rcu_qsbr_dq_reclaim(h->dq,
+			ret = rte_rcu_qsbr_dq_reclaim_burst(h->dq,
 					h->hash_rcu_cfg->max_reclaim_size,
 					NULL, NULL, NULL);
 			__hash_rw_writer_unlock(h);
@@ -1197,6 +1453,12 @@ __rte_hash_add_key_with_hash(const struct rte_hash *h, const void *key,
 		for (i = 0; i < RTE_HASH_BUCKET_ENTRIES; i++) {
 			/* Check if slot is available */
 			if (likely(cur_bkt->key_idx[i] == EMPTY_SLOT)) {
+				/* Publish the chain filter bits before the
+				 * key becomes visible to lock-free readers.
+				 */
+				if (cur_bkt != sec_bkt)
+					h->ext_bloom[sec_bucket_idx] |=
+						ext_bloom_mask(short_sig);
 				cur_bkt->sig_current[i] = short_sig;
 				/* Store to signature and key should not
 				 * leak after the store to key_idx. i.e.
@@ -1219,7 +1481,7 @@ __rte_hash_add_key_with_hash(const struct rte_hash *h, const void *key,
 						sizeof(uint32_t)) != 0 ||
 					ext_bkt_id == 0) {
 		if (h->dq) {
-			if (rte_rcu_qsbr_dq_reclaim(h->dq,
+			if (rte_rcu_qsbr_dq_reclaim_burst(h->dq,
 					h->hash_rcu_cfg->max_reclaim_size,
 					NULL, NULL, NULL) == 0) {
 				rte_ring_sc_dequeue_elem(h->free_ext_bkts,
@@ -1234,6 +1496,7 @@ __rte_hash_add_key_with_hash(const struct rte_hash *h, const void *key,
 	}
 
 	/* Use the first location of the new bucket */
+	h->ext_bloom[sec_bucket_idx] |= ext_bloom_mask(short_sig);
 	(h->buckets_ext[ext_bkt_id - 1]).sig_current[0] = short_sig;
 	/* Store to signature and key should not leak after
 	 * the store to key_idx. i.e. key_idx is the guard variable
@@ -1301,6 +1564,80 @@ rte_hash_add_key_data(const struct rte_hash *h, const void *key, void *data)
 		return ret;
 }
 
+static int
+add_bulk_order_cmp(const void *a, const void *b)
+{
+	const uint64_t va = *(const uint64_t *)a;
+	const uint64_t vb = *(const uint64_t *)b;
+
+	if (va < vb)
+		return -1;
+	return va > vb;
+}
+
+static int32_t
+__rte_hash_add_key_bulk(const struct rte_hash *h, const void **keys,
+		uint32_t num_keys, void *data[], int32_t *positions)
+{
+	hash_sig_t sig[RTE_HASH_LOOKUP_BULK_MAX];
+	uint64_t order[RTE_HASH_LOOKUP_BULK_MAX];
+	uint32_t base, n, i, j;
+	int32_t added = 0;
+	int32_t ret;
+
+	for (base = 0; base < num_keys; base += n) {
+		n = RTE_MIN(num_keys - base,
+				(uint32_t)RTE_HASH_LOOKUP_BULK_MAX);
+
+		/*
+		 * Hash the whole chunk up front, then insert in primary
+		 * bucket order so the bucket array is walked monotonically
+		 * instead of at one random cache line per key.
+		 */
+		for (i = 0; i < n; i++) {
+			sig[i] = rte_hash_hash(h, keys[base + i]);
+			order[i] = ((uint64_t)get_prim_bucket_index(h,
+					sig[i]) << 32) | i;
+		}
+		qsort(order, n, sizeof(order[0]), add_bulk_order_cmp);
+
+		for (i = 0; i < n; i++) {
+			j = (uint32_t)order[i];
+			if (i + 1 < n)
+				rte_prefetch0(&h->buckets[order[i + 1] >> 32]);
+			ret = __rte_hash_add_key_with_hash(h, keys[base + j],
+					sig[j],
+					data != NULL ? data[base + j] : 0);
+			if (positions != NULL)
+				positions[base + j] = ret;
+			if (ret >= 0)
+				added++;
+		}
+	}
+
+	return added;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_hash_add_key_bulk, 25.07)
+int32_t
+rte_hash_add_key_bulk(const struct rte_hash *h, const void **keys,
+		uint32_t num_keys, int32_t *positions)
+{
+	RETURN_IF_TRUE(((h == NULL) || (keys == NULL) || (num_keys == 0) ||
+			(positions == NULL)), -EINVAL);
+	return __rte_hash_add_key_bulk(h, keys, num_keys, NULL, positions);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_hash_add_key_data_bulk, 25.07)
+int32_t
+rte_hash_add_key_data_bulk(const struct rte_hash *h, const void **keys,
+		uint32_t num_keys, void *data[], int32_t *positions)
+{
+	RETURN_IF_TRUE(((h == NULL) || (keys == NULL) || (num_keys == 0) ||
+			(data == NULL)), -EINVAL);
+	return __rte_hash_add_key_bulk(h, keys, num_keys, data, positions);
+}
+
 /* Search one bucket to find the match key - uses rw lock */
 static inline int32_t
 search_one_bucket_l(const struct rte_hash *h, const void *key,
@@ -1399,12 +1736,22 @@ __rte_hash_lookup_with_hash_l(const struct rte_hash *h, const void *key,
 	bkt = &h->buckets[sec_bucket_idx];
 
 	/* Check if key is in secondary location */
-	FOR_EACH_BUCKET(cur_bkt, bkt) {
-		ret = search_one_bucket_l(h, key, short_sig,
-					data, cur_bkt);
-		if (ret != -1) {
-			__hash_rw_reader_unlock(h);
-			return ret;
+	ret = search_one_bucket_l(h, key, short_sig, data, bkt);
+	if (ret != -1) {
+		__hash_rw_reader_unlock(h);
+		return ret;
+	}
+
+	/* Walk the ext chain only when its filter may contain the key. */
+	if (bkt->next != NULL &&
+	    ext_chain_may_contain(h, sec_bucket_idx, short_sig)) {
+		FOR_EACH_BUCKET(cur_bkt, bkt->next) {
+			ret = search_one_bucket_l(h, key, short_sig,
+						data, cur_bkt);
+			if (ret != -1) {
+				__hash_rw_reader_unlock(h);
+				return ret;
+			}
 		}
 	}
 
@@ -1444,11 +1791,21 @@ __rte_hash_lookup_with_hash_lf(const struct rte_hash *h, const void *key,
 		bkt = &h->buckets[sec_bucket_idx];
 
 		/* Check if key is in secondary location */
-		FOR_EACH_BUCKET(cur_bkt, bkt) {
-			ret = search_one_bucket_lf(h, key, short_sig,
-						data, cur_bkt);
-			if (ret != -1)
-				return ret;
+		ret = search_one_bucket_lf(h, key, short_sig, data, bkt);
+		if (ret != -1)
+			return ret;
+
+		/* Walk the ext chain only when its filter may contain
+		 * the key.
+		 */
+		if (bkt->next != NULL &&
+		    ext_chain_may_contain(h, sec_bucket_idx, short_sig)) {
+			FOR_EACH_BUCKET(cur_bkt, bkt->next) {
+				ret = search_one_bucket_lf(h, key, short_sig,
+							data, cur_bkt);
+				if (ret != -1)
+					return ret;
+			}
 		}
 
 		/* The loads of sig_current in search_one_bucket
@@ -1470,10 +1827,46 @@ __rte_hash_lookup_with_hash_lf(const struct rte_hash *h, const void *key,
 	return -ENOENT;
 }
 
+/*
+ * Lookup in the flat table built by rte_hash_freeze(). The key set cannot
+ * change, so no locking or change-counter retry is needed: a linear probe
+ * runs from the slot indexed by the full hash until a match or a free slot.
+ */
+static inline int32_t
+__rte_hash_lookup_frozen(const struct rte_hash *h, const void *key,
+					hash_sig_t sig, void **data)
+{
+	const struct rte_hash_frozen *ft = h->frozen;
+	const struct rte_hash_key *k;
+	const struct rte_hash_frozen_entry *e;
+	uint32_t idx;
+
+	for (idx = sig & ft->mask; ; idx = (idx + 1) & ft->mask) {
+		e = &ft->entries[idx];
+		if (e->key_idx == EMPTY_SLOT)
+			return -ENOENT;
+		if (e->sig != sig)
+			continue;
+		k = (const struct rte_hash_key *)((const char *)h->key_store +
+				e->key_idx * h->key_entry_size);
+		if (rte_hash_cmp_eq(key, k->key, h) == 0) {
+			if (data != NULL)
+				*data = k->pdata;
+			/*
+			 * Return index where key is stored,
+			 * subtracting the first dummy index
+			 */
+			return e->key_idx - 1;
+		}
+	}
+}
+
 static inline int32_t
 __rte_hash_lookup_with_hash(const struct rte_hash *h, const void *key,
 					hash_sig_t sig, void **data)
 {
+	if (unlikely(h->frozen != NULL))
+		return __rte_hash_lookup_frozen(h, key, sig, data);
 	if (h->readwrite_concur_lf_support)
 		return __rte_hash_lookup_with_hash_lf(h, key, sig, data);
 	else
@@ -1545,32 +1938,36 @@ __hash_rcu_qsbr_free_resource(void *p, void *e, unsigned int n)
 {
 	void *key_data = NULL;
 	int ret;
+	unsigned int i;
 	struct rte_hash_key *keys, *k;
 	struct rte_hash *h = (struct rte_hash *)p;
-	struct __rte_hash_rcu_dq_entry rcu_dq_entry =
-			*((struct __rte_hash_rcu_dq_entry *)e);
+	const struct __rte_hash_rcu_dq_entry *entries = e;
 
-	RTE_SET_USED(n);
 	keys = h->key_store;
 
-	k = (struct rte_hash_key *) ((char *)keys +
-				rcu_dq_entry.key_idx * h->key_entry_size);
-	key_data = k->pdata;
-	if (h->hash_rcu_cfg->free_key_data_func)
-		h->hash_rcu_cfg->free_key_data_func(h->hash_rcu_cfg->key_data_ptr,
-						    key_data);
+	/* Batched reclamation passes all the entries of a burst in one call */
+	for (i = 0; i < n; i++) {
+		struct __rte_hash_rcu_dq_entry rcu_dq_entry = entries[i];
 
-	if (h->ext_table_support && rcu_dq_entry.ext_bkt_idx != EMPTY_SLOT)
-		/* Recycle empty ext bkt to free list. */
-		rte_ring_sp_enqueue_elem(h->free_ext_bkts,
-			&rcu_dq_entry.ext_bkt_idx, sizeof(uint32_t));
+		k = (struct rte_hash_key *) ((char *)keys +
+					rcu_dq_entry.key_idx * h->key_entry_size);
+		key_data = k->pdata;
+		if (h->hash_rcu_cfg->free_key_data_func)
+			h->hash_rcu_cfg->free_key_data_func(h->hash_rcu_cfg->key_data_ptr,
+							    key_data);
 
-	/* Return key indexes to free slot ring */
-	ret = free_slot(h, rcu_dq_entry.key_idx);
-	if (ret < 0) {
-		HASH_LOG(ERR,
-			"%s: could not enqueue free slots in global ring",
-				__func__);
+		if (h->ext_table_support && rcu_dq_entry.ext_bkt_idx != EMPTY_SLOT)
+			/* Recycle empty ext bkt to free list. */
+			rte_ring_sp_enqueue_elem(h->free_ext_bkts,
+				&rcu_dq_entry.ext_bkt_idx, sizeof(uint32_t));
+
+		/* Return key indexes to free slot ring */
+		ret = free_slot(h, rcu_dq_entry.key_idx);
+		if (ret < 0) {
+			HASH_LOG(ERR,
+				"%s: could not enqueue free slots in global ring",
+					__func__);
+		}
 	}
 }
 
@@ -1771,13 +2168,18 @@ __rte_hash_del_key_with_hash(const struct rte_hash *h, const void *key,
 {
 	uint32_t prim_bucket_idx, sec_bucket_idx;
 	struct rte_hash_bucket *prim_bkt, *sec_bkt, *prev_bkt, *last_bkt;
-	struct rte_hash_bucket *cur_bkt;
+	struct rte_hash_bucket *cur_bkt, *chain_root = NULL;
 	int pos;
 	int32_t ret, i;
 	uint16_t short_sig;
+	uint32_t chain_root_idx = 0;
 	uint32_t index = EMPTY_SLOT;
 	struct __rte_hash_rcu_dq_entry rcu_dq_entry;
 
+	/* A frozen table is read-only until rte_hash_unfreeze() */
+	if (unlikely(h->frozen != NULL))
+		return -EBUSY;
+
 	short_sig = get_short_sig(sig);
 	prim_bucket_idx = get_prim_bucket_index(h, sig);
 	sec_bucket_idx = get_alt_bucket_index(h, prim_bucket_idx, short_sig);
@@ -1790,6 +2192,8 @@ __rte_hash_del_key_with_hash(const struct rte_hash *h, const void *key,
 		__rte_hash_compact_ll(h, prim_bkt, pos);
 		last_bkt = prim_bkt->next;
 		prev_bkt = prim_bkt;
+		chain_root = prim_bkt;
+		chain_root_idx = prim_bucket_idx;
 		goto return_bkt;
 	}
 
@@ -1802,6 +2206,8 @@ __rte_hash_del_key_with_hash(const struct rte_hash *h, const void *key,
 			__rte_hash_compact_ll(h, cur_bkt, pos);
 			last_bkt = sec_bkt->next;
 			prev_bkt = sec_bkt;
+			chain_root = sec_bkt;
+			chain_root_idx = sec_bucket_idx;
 			goto return_bkt;
 		}
 	}
@@ -1847,6 +2253,21 @@ return_bkt:
 							sizeof(uint32_t));
 	}
 
+	/* Rebuild the chain filter from the remaining chain entries, which
+	 * also flushes the stale bits of the removed key.
+	 */
+	if (h->ext_bloom != NULL) {
+		uint16_t filter = 0;
+
+		FOR_EACH_BUCKET(cur_bkt, chain_root->next)
+			for (i = 0; i < RTE_HASH_BUCKET_ENTRIES; i++)
+				if (cur_bkt->key_idx[i] != EMPTY_SLOT)
+					filter |= ext_bloom_mask(
+						cur_bkt->sig_current[i]);
+
+		h->ext_bloom[chain_root_idx] = filter;
+	}
+
 return_key:
 	/* Using internal RCU QSBR */
 	if (h->hash_rcu_cfg) {
@@ -1948,6 +2369,7 @@ __bulk_lookup_l(const struct rte_hash *h, const void **keys,
 		uint64_t *hit_mask, void *data[])
 {
 	uint64_t hits = 0;
+	uint64_t ext_mask;
 	int32_t i;
 	int32_t ret;
 	struct rte_hash_bucket *cur_bkt, *next_bkt;
@@ -2088,11 +2510,26 @@ next_key:
 		return;
 	}
 
-	/* need to check ext buckets for match */
+	/* Prefetch the ext chains that may contain the missed keys. */
+	ext_mask = 0;
 	for (i = 0; i < num_keys; i++) {
 		if ((hits & (1ULL << i)) != 0)
 			continue;
 		next_bkt = secondary_bkt[i]->next;
+		if (next_bkt == NULL ||
+		    !ext_chain_may_contain(h,
+				(uint32_t)(secondary_bkt[i] - h->buckets),
+				sig[i]))
+			continue;
+		rte_prefetch0(next_bkt);
+		ext_mask |= 1ULL << i;
+	}
+
+	/* need to check ext buckets for match */
+	for (i = 0; i < num_keys; i++) {
+		if ((ext_mask & (1ULL << i)) == 0)
+			continue;
+		next_bkt = secondary_bkt[i]->next;
 		FOR_EACH_BUCKET(cur_bkt, next_bkt) {
 			if (data != NULL)
 				ret = search_one_bucket_l(h, keys[i],
@@ -2122,6 +2559,7 @@ __bulk_lookup_lf(const struct rte_hash *h, const void **keys,
 		uint64_t *hit_mask, void *data[])
 {
 	uint64_t hits = 0;
+	uint64_t ext_mask;
 	int32_t i;
 	int32_t ret;
 	struct rte_hash_bucket *cur_bkt, *next_bkt;
@@ -2281,10 +2719,28 @@ next_key:
 		}
 		/* need to check ext buckets for match */
 		if (h->ext_table_support) {
+			/* Prefetch the ext chains that may contain the
+			 * missed keys.
+			 */
+			ext_mask = 0;
 			for (i = 0; i < num_keys; i++) {
 				if ((hits & (1ULL << i)) != 0)
 					continue;
 				next_bkt = secondary_bkt[i]->next;
+				if (next_bkt == NULL ||
+				    !ext_chain_may_contain(h,
+						(uint32_t)(secondary_bkt[i] -
+							h->buckets),
+						sig[i]))
+					continue;
+				rte_prefetch0(next_bkt);
+				ext_mask |= 1ULL << i;
+			}
+
+			for (i = 0; i < num_keys; i++) {
+				if ((ext_mask & (1ULL << i)) == 0)
+					continue;
+				next_bkt = secondary_bkt[i]->next;
 				FOR_EACH_BUCKET(cur_bkt, next_bkt) {
 					if (data != NULL)
 						ret = search_one_bucket_lf(h,
@@ -2413,6 +2869,21 @@ __rte_hash_lookup_bulk(const struct rte_hash *h, const void **keys,
 			int32_t num_keys, int32_t *positions,
 			uint64_t *hit_mask, void *data[])
 {
+	if (unlikely(h->frozen != NULL)) {
+		uint64_t hits = 0;
+		int32_t i;
+
+		for (i = 0; i < num_keys; i++) {
+			positions[i] = __rte_hash_lookup_frozen(h, keys[i],
+					rte_hash_hash(h, keys[i]),
+					data != NULL ? &data[i] : NULL);
+			if (positions[i] >= 0)
+				hits |= 1ULL << i;
+		}
+		if (hit_mask != NULL)
+			*hit_mask = hits;
+		return;
+	}
 	if (h->readwrite_concur_lf_support)
 		__rte_hash_lookup_bulk_lf(h, keys, num_keys, positions,
 					  hit_mask, data);
@@ -2527,6 +2998,21 @@ __rte_hash_lookup_with_hash_bulk(const struct rte_hash *h, const void **keys,
 			hash_sig_t *prim_hash, int32_t num_keys,
 			int32_t *positions, uint64_t *hit_mask, void *data[])
 {
+	if (unlikely(h->frozen != NULL)) {
+		uint64_t hits = 0;
+		int32_t i;
+
+		for (i = 0; i < num_keys; i++) {
+			positions[i] = __rte_hash_lookup_frozen(h, keys[i],
+					prim_hash[i],
+					data != NULL ? &data[i] : NULL);
+			if (positions[i] >= 0)
+				hits |= 1ULL << i;
+		}
+		if (hit_mask != NULL)
+			*hit_mask = hits;
+		return;
+	}
 	if (h->readwrite_concur_lf_support)
 		__rte_hash_lookup_with_hash_bulk_lf(h, keys, prim_hash,
 				num_keys, positions, hit_mask, data);
@@ -212,8 +212,31 @@ struct __rte_cache_aligned rte_hash {
 	 * is piggy-backed to freeing of the key index.
 	 */
 	uint32_t *ext_bkt_to_free;
+	uint16_t *ext_bloom;
+	/**< Per-bucket filter summarizing the short signatures present in the
+	 * extendable bucket chain hanging off each bucket, so that negative
+	 * lookups skip the chain walk. Only allocated when the extendable
+	 * table is enabled. Deletes may leave stale bits (false positives)
+	 * until the next delete on the same chain rebuilds the filter.
+	 */
 	RTE_ATOMIC(uint32_t) *tbl_chng_cnt;
 	/**< Indicates if the hash table changed from last read. */
+	struct rte_hash_frozen *frozen;
+	/**< Flat read-only lookup table built by rte_hash_freeze(),
+	 * NULL while the table accepts updates.
+	 */
+};
+
+/** An entry of the flat table built by rte_hash_freeze(). */
+struct rte_hash_frozen_entry {
+	uint32_t key_idx;	/**< Index into the key store, EMPTY_SLOT if free. */
+	hash_sig_t sig;		/**< Full hash of the stored key. */
+};
+
+/** Flat, linearly probed lookup table over a frozen key set. */
+struct rte_hash_frozen {
+	uint32_t mask;		/**< Number of entries minus one (power of two). */
+	struct rte_hash_frozen_entry entries[];
 };
 
 struct queue_node {
@@ -195,6 +195,93 @@ rte_hash_find_existing(const char *name);
 void
 rte_hash_reset(struct rte_hash *h);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Resize the hash table in place, preserving all stored keys and their
+ * associated data.
+ *
+ * The resize rebuilds the table into a new internal bucket array and key
+ * store of the requested capacity and then swaps them under the writer
+ * lock, so the rte_hash handle stays valid. Readers of tables created
+ * with RTE_HASH_EXTRA_FLAGS_RW_CONCURRENCY and all writers are blocked
+ * for the duration of the rebuild.
+ *
+ * Key positions (as returned by rte_hash_add_key() and consumed by the
+ * _with_hash/_position APIs) are NOT preserved across a resize.
+ *
+ * Not supported on tables created with
+ * RTE_HASH_EXTRA_FLAGS_RW_CONCURRENCY_LF or with an RCU configuration
+ * attached, as their readers tolerate no swap of the bucket arrays.
+ *
+ * @param h
+ *   Hash table to resize.
+ * @param new_entries
+ *   New table capacity, with the same meaning as the entries field of
+ *   struct rte_hash_parameters.
+ * @return
+ *   - 0 if the table was resized
+ *   - -EINVAL if the parameters are invalid
+ *   - -ENOTSUP if the table uses lock-free concurrency or RCU
+ *   - -ENOMEM if the new table cannot be allocated
+ *   - -ENOSPC if the stored keys do not fit the new capacity; the
+ *     original table is left untouched
+ */
+__rte_experimental
+int
+rte_hash_resize(struct rte_hash *h, uint32_t new_entries);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Freeze the hash table into a flat, read-optimized layout.
+ *
+ * The current key set is compiled into an open-addressed table indexed by
+ * the full hash value, so most lookups touch a single cache line of index
+ * data instead of probing two cuckoo buckets, and run without taking the
+ * reader lock. All lookup APIs transparently use the frozen layout.
+ *
+ * A frozen table is read-only: add and delete calls fail with -EBUSY
+ * until rte_hash_unfreeze() is called. Key positions are preserved, and
+ * freezing an already frozen table is a no-op.
+ *
+ * This function must not be called while lookups are in flight on tables
+ * created with RTE_HASH_EXTRA_FLAGS_RW_CONCURRENCY_LF, as those readers
+ * do not take the reader lock held during the rebuild.
+ *
+ * @param h
+ *   Hash table to freeze.
+ * @return
+ *   - 0 if the table is frozen
+ *   - -EINVAL if the parameters are invalid
+ *   - -ENOMEM if the flat table cannot be allocated
+ */
+__rte_experimental
+int
+rte_hash_freeze(struct rte_hash *h);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Release the flat layout built by rte_hash_freeze() and return the table
+ * to its normal updatable mode. The stored keys are unaffected.
+ *
+ * Like rte_hash_freeze(), this must not be called while lookups are in
+ * flight on tables created with RTE_HASH_EXTRA_FLAGS_RW_CONCURRENCY_LF.
+ *
+ * @param h
+ *   Hash table to unfreeze.
+ * @return
+ *   - 0 if the table accepts updates again
+ *   - -EINVAL if the parameters are invalid
+ */
+__rte_experimental
+int
+rte_hash_unfreeze(struct rte_hash *h);
+
 /**
  * Return the number of keys in the hash table
  * @param h
@@ -320,6 +407,69 @@ rte_hash_add_key(const struct rte_hash *h, const void *key);
 int32_t
 rte_hash_add_key_with_hash(const struct rte_hash *h, const void *key, hash_sig_t sig);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Add a batch of keys to the hash table.
+ *
+ * All keys are hashed up front and inserted in primary bucket order, which
+ * makes bucket accesses sequential and is considerably faster than a loop
+ * of rte_hash_add_key() calls when loading a large table. This operation
+ * is not multi-thread safe and should only be called from one thread by
+ * default. Thread safety can be enabled by setting flag during table
+ * creation.
+ *
+ * @param h
+ *   Hash table to add the keys to.
+ * @param keys
+ *   Array of keys to add.
+ * @param num_keys
+ *   Number of keys in the keys array.
+ * @param positions
+ *   Output, one entry per key: the position where the key was stored, or a
+ *   negative error code with the same meaning as the rte_hash_add_key()
+ *   return value. Must not be NULL.
+ * @return
+ *   - The number of keys successfully added.
+ *   - -EINVAL if the parameters are invalid.
+ */
+__rte_experimental
+int32_t
+rte_hash_add_key_bulk(const struct rte_hash *h, const void **keys,
+		uint32_t num_keys, int32_t *positions);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Add a batch of key-data pairs to the hash table.
+ *
+ * Behaves as rte_hash_add_key_bulk(), storing data[i] with each key.
+ * This operation is not multi-thread safe and should only be called from
+ * one thread by default. Thread safety can be enabled by setting flag
+ * during table creation.
+ *
+ * @param h
+ *   Hash table to add the keys to.
+ * @param keys
+ *   Array of keys to add.
+ * @param num_keys
+ *   Number of keys in the keys array.
+ * @param data
+ *   Array of data to store with each key. Must not be NULL.
+ * @param positions
+ *   Output, one entry per key: the position where the key was stored, or a
+ *   negative error code. May be NULL if positions are not needed.
+ * @return
+ *   - The number of keys successfully added.
+ *   - -EINVAL if the parameters are invalid.
+ */
+__rte_experimental
+int32_t
+rte_hash_add_key_data_bulk(const struct rte_hash *h, const void **keys,
+		uint32_t num_keys, void *data[], int32_t *positions);
+
 /**
  * Remove a key from an existing hash table.
  * This operation is not multi-thread safe
@@ -14,6 +14,7 @@
 #include <rte_eal_memconfig.h>
 #include <rte_log.h>
 #include <rte_malloc.h>
+#include <rte_mbuf.h>
 
 RTE_LOG_REGISTER_SUFFIX(thash_logtype, thash, INFO);
 #define RTE_LOGTYPE_HASH thash_logtype
@@ -103,6 +104,58 @@ rte_thash_complete_matrix(uint64_t *matrixes, const uint8_t *rss_key, int size)
 	}
 }
 
+/* Number of tuple pointers gathered per rte_thash_gfni_bulk() call */
+#define THASH_MBUF_BULK_SZ	64
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_thash_mbuf_bulk, 25.07)
+int
+rte_thash_mbuf_bulk(const uint64_t *matrices, const uint8_t *rss_key,
+	uint16_t offset, uint16_t len, struct rte_mbuf **mbufs,
+	uint32_t *hashes, uint32_t num)
+{
+	uint32_t tmp_tuple[RTE_THASH_TUPLE_LEN_MAX / sizeof(uint32_t)];
+	uint32_t i, j;
+
+	if ((mbufs == NULL) || (hashes == NULL) ||
+			(len % sizeof(uint32_t) != 0) ||
+			(len > RTE_THASH_TUPLE_LEN_MAX))
+		return -EINVAL;
+
+	if (matrices != NULL && rte_thash_gfni_supported()) {
+		uint8_t *tuples[THASH_MBUF_BULK_SZ];
+		uint32_t n;
+
+		for (i = 0; i < num; i += n) {
+			n = RTE_MIN(num - i, (uint32_t)THASH_MBUF_BULK_SZ);
+			for (j = 0; j < n; j++)
+				tuples[j] = rte_pktmbuf_mtod_offset(
+					mbufs[i + j], uint8_t *, offset);
+
+			rte_thash_gfni_bulk(matrices, len, tuples,
+				&hashes[i], n);
+		}
+
+		return 0;
+	}
+
+	if (rss_key == NULL)
+		return -EINVAL;
+
+	for (i = 0; i < num; i++) {
+		const uint8_t *tuple = rte_pktmbuf_mtod_offset(mbufs[i],
+			const uint8_t *, offset);
+
+		for (j = 0; j < (len / sizeof(uint32_t)); j++)
+			tmp_tuple[j] = rte_be_to_cpu_32(
+				*(const unaligned_uint32_t *)&tuple[j * 4]);
+
+		hashes[i] = rte_softrss(tmp_tuple, len / sizeof(uint32_t),
+			rss_key);
+	}
+
+	return 0;
+}
+
 static inline uint32_t
 get_bit_lfsr(struct thash_lfsr *lfsr)
 {
@@ -261,6 +261,46 @@ void
 rte_thash_complete_matrix(uint64_t *matrixes, const uint8_t *rss_key,
 	int size);
 
+struct rte_mbuf;
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Calculate Toeplitz hashes for a burst of packets in one pass.
+ *
+ * For each mbuf the tuple of @p len bytes located @p offset bytes from
+ * the start of the packet data is hashed. The tuple must reside in the
+ * first segment. The GFNI bulk implementation is used when @p matrices
+ * is not NULL and GFNI is supported, otherwise the implementation falls
+ * back to rte_softrss() with @p rss_key.
+ *
+ * @param matrices
+ *  Pointer to the matrices generated from the RSS hash key using
+ *  rte_thash_complete_matrix(), or NULL to force the fallback.
+ * @param rss_key
+ *  Pointer to the RSS hash key the matrices were generated from.
+ *  Used only by the fallback, which may be NULL if GFNI is supported.
+ * @param offset
+ *  Offset of the tuple from the start of the packet data.
+ * @param len
+ *  Length of the tuple in bytes. Must be a multiple of 4 and not
+ *  bigger than RTE_THASH_TUPLE_LEN_MAX.
+ * @param mbufs
+ *  Array of the packets holding the tuples to be hashed.
+ * @param hashes
+ *  Array of uint32_t where to put the calculated Toeplitz hash values.
+ * @param num
+ *  Number of packets to hash.
+ * @return
+ *  0 on success, -EINVAL otherwise.
+ */
+__rte_experimental
+int
+rte_thash_mbuf_bulk(const uint64_t *matrices, const uint8_t *rss_key,
+	uint16_t offset, uint16_t len, struct rte_mbuf **mbufs,
+	uint32_t *hashes, uint32_t num);
+
 /** @internal Logarithm of minimum size of the RSS ReTa */
 #define	RTE_THASH_RETA_SZ_MIN	2U
 /** @internal Logarithm of maximum size of the RSS ReTa */
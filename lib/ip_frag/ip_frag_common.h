@@ -34,6 +34,9 @@ extern int ipfrag_logtype;
 #define IPV4_KEYLEN 1
 #define IPV6_KEYLEN 4
 
+/* seed for the hash functions */
+#define	PRIME_VALUE	0xeaad8405
+
 /* helper macros */
 #define	IP_FRAG_MBUF2DR(dr, mb)	((dr)->row[(dr)->cnt++] = (mb))
 
@@ -79,10 +79,23 @@ struct rte_ip_frag_tbl {
 	uint32_t bucket_entries; /* hash associativity. */
 	uint32_t nb_entries;     /* total size of the table. */
 	uint32_t nb_buckets;     /* num of associativity lines. */
+	uint32_t id;             /* table id, for telemetry. */
+	RTE_TAILQ_ENTRY(rte_ip_frag_tbl) next; /* list of all tables. */
 	struct ip_frag_pkt *last;     /* last used entry. */
 	struct ip_pkt_list lru;       /* LRU list for table entries. */
 	struct ip_frag_tbl_stat stat; /* statistics counters. */
 	struct ip_frag_pkt pkt[]; /* hash table. */
 };
 
+/*
+ * Set of independent fragmentation tables sharded by a flow hash.
+ * Each shard is meant to be owned by a single lcore, selected with the
+ * same hash that steers the flow's fragments to that lcore.
+ */
+struct rte_ip_frag_sharded_tbl {
+	uint32_t nb_shards;  /* number of shards, power of two. */
+	uint32_t shard_mask; /* nb_shards - 1. */
+	struct rte_ip_frag_tbl *shard[]; /* per-shard tables. */
+};
+
 #endif /* _IP_REASSEMBLY_H_ */
@@ -291,6 +291,160 @@ void
 rte_ip_frag_table_del_expired_entries(struct rte_ip_frag_tbl *tbl,
 	struct rte_ip_frag_death_row *dr, uint64_t tms);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Delete expired fragments, freeing their mbufs in bulk.
+ *
+ * Unlike rte_ip_frag_table_del_expired_entries(), this function does not
+ * use a death row: the mbufs of every expired entry are released straight
+ * away with rte_pktmbuf_free_bulk(), so the scan is not bounded by the
+ * death row space and always drains all expired entries.
+ *
+ * @param tbl
+ *   Table to delete expired fragments from
+ * @param tms
+ *   Current timestamp
+ * @return
+ *   Number of entries deleted from the table.
+ */
+__rte_experimental
+uint32_t
+rte_ip_frag_table_evict_expired(struct rte_ip_frag_tbl *tbl, uint64_t tms);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Create a set of independent fragmentation tables (shards).
+ *
+ * Each shard is a regular fragmentation table, created with the given
+ * parameters, and is selected by a flow hash with
+ * rte_ip_frag_sharded_table_get(). When the shard hash matches the one
+ * that steers the flow's fragments to its lcore (see
+ * rte_ipv4_frag_shard_hash() and rte_ipv6_frag_shard_hash()), each lcore
+ * only ever touches its own shards and no locking is needed.
+ *
+ * @param nb_shards
+ *   Number of shards, must be a power of two. Typically the number of
+ *   lcores doing reassembly, rounded up.
+ * @param bucket_num
+ *   Number of buckets in the hash table of each shard.
+ * @param bucket_entries
+ *   Number of entries per bucket (e.g. hash associativity).
+ *   Should be power of two.
+ * @param max_entries
+ *   Maximum number of entries that could be stored in each shard.
+ *   The value should be less or equal then bucket_num * bucket_entries.
+ * @param max_cycles
+ *   Maximum TTL in cycles for each fragmented packet.
+ * @param socket_id
+ *   The *socket_id* argument is the socket identifier in the case of
+ *   NUMA. The value can be *SOCKET_ID_ANY* if there is no NUMA constraints.
+ * @return
+ *   The pointer to the new set of tables, on success. NULL on error.
+ */
+__rte_experimental
+struct rte_ip_frag_sharded_tbl *
+rte_ip_frag_sharded_table_create(uint32_t nb_shards, uint32_t bucket_num,
+	uint32_t bucket_entries, uint32_t max_entries, uint64_t max_cycles,
+	int socket_id);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Free a set of sharded fragmentation tables.
+ *
+ * @param st
+ *   Set of tables to free.
+ */
+__rte_experimental
+void
+rte_ip_frag_sharded_table_destroy(struct rte_ip_frag_sharded_tbl *st);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Get the shard of a set of sharded fragmentation tables for a flow hash.
+ *
+ * All fragments of a datagram must map to the same shard, so the hash
+ * must not depend on header fields that are absent from non-first
+ * fragments (e.g. L4 ports). Use rte_ipv4_frag_shard_hash() or
+ * rte_ipv6_frag_shard_hash(), or an RSS hash computed over the IP
+ * addresses only.
+ *
+ * @param st
+ *   Set of tables to select the shard from.
+ * @param hash
+ *   Flow hash of the fragment.
+ * @return
+ *   The fragmentation table to use for the fragment.
+ */
+__rte_experimental
+struct rte_ip_frag_tbl *
+rte_ip_frag_sharded_table_get(struct rte_ip_frag_sharded_tbl *st,
+	uint32_t hash);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Delete expired fragments from all shards, freeing their mbufs in bulk.
+ *
+ * @param st
+ *   Set of tables to delete expired fragments from.
+ * @param tms
+ *   Current timestamp
+ * @return
+ *   Total number of entries deleted across all shards.
+ */
+__rte_experimental
+uint32_t
+rte_ip_frag_sharded_table_del_expired(struct rte_ip_frag_sharded_tbl *st,
+	uint64_t tms);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Compute the shard selection hash for an IPv4 fragment.
+ *
+ * The hash only covers the source and destination addresses, so all
+ * fragments of a datagram - including non-first fragments, which carry
+ * no L4 header - get the same value, and it is compatible with RSS
+ * configured over the IPv4 addresses.
+ *
+ * @param ip_hdr
+ *   Pointer to the IPv4 header of the fragment.
+ * @return
+ *   Flow hash for shard selection.
+ */
+__rte_experimental
+uint32_t
+rte_ipv4_frag_shard_hash(const struct rte_ipv4_hdr *ip_hdr);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Compute the shard selection hash for an IPv6 fragment.
+ *
+ * The hash only covers the source and destination addresses, so all
+ * fragments of a datagram get the same value, and it is compatible with
+ * RSS configured over the IPv6 addresses.
+ *
+ * @param ip_hdr
+ *   Pointer to the IPv6 header of the fragment.
+ * @return
+ *   Flow hash for shard selection.
+ */
+__rte_experimental
+uint32_t
+rte_ipv6_frag_shard_hash(const struct rte_ipv6_hdr *ip_hdr);
+
 /**@{@name Obsolete macros, kept here for compatibility reasons.
  * Will be deprecated/removed in future DPDK releases.
  */
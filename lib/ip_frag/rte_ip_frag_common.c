@@ -4,9 +4,17 @@
 
 #include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include <eal_export.h>
 #include <rte_log.h>
+#include <rte_jhash.h>
+#include <rte_hash_crc.h>
+#include <rte_mbuf.h>
+#include <rte_spinlock.h>
+#include <rte_tailq.h>
+#include <rte_telemetry.h>
 
 RTE_LOG_REGISTER_DEFAULT(ipfrag_logtype, INFO);
 
@@ -14,6 +22,12 @@ RTE_LOG_REGISTER_DEFAULT(ipfrag_logtype, INFO);
 
 #define	IP_FRAG_HASH_FNUM	2
 
+/* list of all tables, for telemetry */
+static rte_spinlock_t ip_frag_tbl_list_lock = RTE_SPINLOCK_INITIALIZER;
+static RTE_TAILQ_HEAD(, rte_ip_frag_tbl) ip_frag_tbl_list =
+	TAILQ_HEAD_INITIALIZER(ip_frag_tbl_list);
+static uint32_t ip_frag_tbl_next_id;
+
 /* free mbufs from death row */
 RTE_EXPORT_SYMBOL(rte_ip_frag_free_death_row)
 void
@@ -28,13 +42,7 @@ rte_ip_frag_free_death_row(struct rte_ip_frag_death_row *dr,
 	for (i = 0; i != k; i++)
 		rte_prefetch0(dr->row[i]);
 
-	for (i = 0; i != n - k; i++) {
-		rte_prefetch0(dr->row[i + k]);
-		rte_pktmbuf_free(dr->row[i]);
-	}
-
-	for (; i != n; i++)
-		rte_pktmbuf_free(dr->row[i]);
+	rte_pktmbuf_free_bulk(dr->row, n);
 
 	dr->cnt = 0;
 }
@@ -81,6 +89,12 @@ rte_ip_frag_table_create(uint32_t bucket_num, uint32_t bucket_entries,
 	tbl->entry_mask = (tbl->nb_entries - 1) & ~(tbl->bucket_entries  - 1);
 
 	TAILQ_INIT(&(tbl->lru));
+
+	rte_spinlock_lock(&ip_frag_tbl_list_lock);
+	tbl->id = ip_frag_tbl_next_id++;
+	TAILQ_INSERT_TAIL(&ip_frag_tbl_list, tbl, next);
+	rte_spinlock_unlock(&ip_frag_tbl_list_lock);
+
 	return tbl;
 }
 
@@ -91,6 +105,13 @@ rte_ip_frag_table_destroy(struct rte_ip_frag_tbl *tbl)
 {
 	struct ip_frag_pkt *fp;
 
+	if (tbl == NULL)
+		return;
+
+	rte_spinlock_lock(&ip_frag_tbl_list_lock);
+	TAILQ_REMOVE(&ip_frag_tbl_list, tbl, next);
+	rte_spinlock_unlock(&ip_frag_tbl_list_lock);
+
 	TAILQ_FOREACH(fp, &tbl->lru, lru) {
 		ip_frag_free_immediate(fp);
 	}
@@ -150,3 +171,226 @@ rte_ip_frag_table_del_expired_entries(struct rte_ip_frag_tbl *tbl,
 		} else
 			return;
 }
+
+/* delete expired fragments, freeing their mbufs in bulk */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_ip_frag_table_evict_expired, 25.07)
+uint32_t
+rte_ip_frag_table_evict_expired(struct rte_ip_frag_tbl *tbl, uint64_t tms)
+{
+	struct rte_mbuf *mb[RTE_IP_FRAG_DEATH_ROW_MBUF_LEN];
+	struct ip_frag_pkt *fp, *tfp;
+	uint64_t max_cycles;
+	uint32_t i, k, del_num;
+
+	max_cycles = tbl->max_cycles;
+	k = 0;
+	del_num = 0;
+
+	RTE_TAILQ_FOREACH_SAFE(fp, &tbl->lru, lru, tfp) {
+		if (max_cycles + fp->start >= tms)
+			break;
+
+		if (k + fp->last_idx > RTE_DIM(mb)) {
+			rte_pktmbuf_free_bulk(mb, k);
+			k = 0;
+		}
+		for (i = 0; i != fp->last_idx; i++) {
+			if (fp->frags[i].mb != NULL) {
+				mb[k++] = fp->frags[i].mb;
+				fp->frags[i].mb = NULL;
+			}
+		}
+		fp->last_idx = 0;
+
+		ip_frag_key_invalidate(&fp->key);
+		TAILQ_REMOVE(&tbl->lru, fp, lru);
+		tbl->use_entries--;
+		IP_FRAG_TBL_STAT_UPDATE(&tbl->stat, del_num, 1);
+		del_num++;
+	}
+
+	if (k != 0)
+		rte_pktmbuf_free_bulk(mb, k);
+
+	return del_num;
+}
+
+/* compute the shard selection hash for an IPv4 fragment */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_ipv4_frag_shard_hash, 25.07)
+uint32_t
+rte_ipv4_frag_shard_hash(const struct rte_ipv4_hdr *ip_hdr)
+{
+#if defined(RTE_ARCH_X86) || defined(RTE_ARCH_ARM64)
+	uint32_t v;
+
+	v = rte_hash_crc_4byte(ip_hdr->src_addr, PRIME_VALUE);
+	return rte_hash_crc_4byte(ip_hdr->dst_addr, v);
+#else
+	return rte_jhash_2words(ip_hdr->src_addr, ip_hdr->dst_addr,
+		PRIME_VALUE);
+#endif /* RTE_ARCH_X86 */
+}
+
+/* compute the shard selection hash for an IPv6 fragment */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_ipv6_frag_shard_hash, 25.07)
+uint32_t
+rte_ipv6_frag_shard_hash(const struct rte_ipv6_hdr *ip_hdr)
+{
+	const uint32_t *p;
+
+	p = (const uint32_t *)&ip_hdr->src_addr;
+
+#if defined(RTE_ARCH_X86) || defined(RTE_ARCH_ARM64)
+	uint32_t i, v;
+
+	v = PRIME_VALUE;
+	for (i = 0; i != 8; i++)
+		v = rte_hash_crc_4byte(p[i], v);
+	return v;
+#else
+	return rte_jhash_32b(p, 8, PRIME_VALUE);
+#endif /* RTE_ARCH_X86 */
+}
+
+/* create a set of sharded fragmentation tables */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_ip_frag_sharded_table_create, 25.07)
+struct rte_ip_frag_sharded_tbl *
+rte_ip_frag_sharded_table_create(uint32_t nb_shards, uint32_t bucket_num,
+	uint32_t bucket_entries, uint32_t max_entries, uint64_t max_cycles,
+	int socket_id)
+{
+	struct rte_ip_frag_sharded_tbl *st;
+	size_t sz;
+	uint32_t i;
+
+	if (nb_shards == 0 || rte_is_power_of_2(nb_shards) == 0) {
+		IP_FRAG_LOG_LINE(ERR, "%s: invalid number of shards",
+			__func__);
+		return NULL;
+	}
+
+	sz = sizeof(*st) + nb_shards * sizeof(st->shard[0]);
+	if ((st = rte_zmalloc_socket(__func__, sz, RTE_CACHE_LINE_SIZE,
+			socket_id)) == NULL) {
+		IP_FRAG_LOG_LINE(ERR,
+			"%s: allocation of %zu bytes at socket %d failed do",
+			__func__, sz, socket_id);
+		return NULL;
+	}
+
+	st->nb_shards = nb_shards;
+	st->shard_mask = nb_shards - 1;
+
+	for (i = 0; i != nb_shards; i++) {
+		st->shard[i] = rte_ip_frag_table_create(bucket_num,
+			bucket_entries, max_entries, max_cycles, socket_id);
+		if (st->shard[i] == NULL) {
+			rte_ip_frag_sharded_table_destroy(st);
+			return NULL;
+		}
+	}
+
+	return st;
+}
+
+/* free a set of sharded fragmentation tables */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_ip_frag_sharded_table_destroy, 25.07)
+void
+rte_ip_frag_sharded_table_destroy(struct rte_ip_frag_sharded_tbl *st)
+{
+	uint32_t i;
+
+	if (st == NULL)
+		return;
+
+	for (i = 0; i != st->nb_shards; i++)
+		rte_ip_frag_table_destroy(st->shard[i]);
+
+	rte_free(st);
+}
+
+/* get the shard for a flow hash */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_ip_frag_sharded_table_get, 25.07)
+struct rte_ip_frag_tbl *
+rte_ip_frag_sharded_table_get(struct rte_ip_frag_sharded_tbl *st,
+	uint32_t hash)
+{
+	return st->shard[hash & st->shard_mask];
+}
+
+/* delete expired fragments from all shards */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_ip_frag_sharded_table_del_expired, 25.07)
+uint32_t
+rte_ip_frag_sharded_table_del_expired(struct rte_ip_frag_sharded_tbl *st,
+	uint64_t tms)
+{
+	uint32_t i, del_num;
+
+	del_num = 0;
+	for (i = 0; i != st->nb_shards; i++)
+		del_num += rte_ip_frag_table_evict_expired(st->shard[i], tms);
+
+	return del_num;
+}
+
+static int
+ip_frag_handle_table_list(const char *cmd __rte_unused,
+	const char *params __rte_unused, struct rte_tel_data *d)
+{
+	struct rte_ip_frag_tbl *tbl;
+
+	rte_tel_data_start_array(d, RTE_TEL_UINT_VAL);
+
+	rte_spinlock_lock(&ip_frag_tbl_list_lock);
+	TAILQ_FOREACH(tbl, &ip_frag_tbl_list, next)
+		rte_tel_data_add_array_uint(d, tbl->id);
+	rte_spinlock_unlock(&ip_frag_tbl_list_lock);
+
+	return 0;
+}
+
+static int
+ip_frag_handle_table_info(const char *cmd __rte_unused, const char *params,
+	struct rte_tel_data *d)
+{
+	struct rte_ip_frag_tbl *tbl;
+	unsigned long id;
+	char *end;
+
+	if (params == NULL || strlen(params) == 0)
+		return -EINVAL;
+
+	id = strtoul(params, &end, 0);
+	if (*end != '\0')
+		return -EINVAL;
+
+	rte_spinlock_lock(&ip_frag_tbl_list_lock);
+	TAILQ_FOREACH(tbl, &ip_frag_tbl_list, next)
+		if (tbl->id == id)
+			break;
+	if (tbl == NULL) {
+		rte_spinlock_unlock(&ip_frag_tbl_list_lock);
+		return -ENOENT;
+	}
+
+	rte_tel_data_start_dict(d);
+	rte_tel_data_add_dict_uint(d, "id", tbl->id);
+	rte_tel_data_add_dict_uint(d, "use_entries", tbl->use_entries);
+	rte_tel_data_add_dict_uint(d, "max_entries", tbl->max_entries);
+	rte_tel_data_add_dict_uint(d, "nb_buckets", tbl->nb_buckets);
+	rte_tel_data_add_dict_uint(d, "bucket_entries", tbl->bucket_entries);
+	rte_tel_data_add_dict_uint(d, "nb_entries", tbl->nb_entries);
+	rte_spinlock_unlock(&ip_frag_tbl_list_lock);
+
+	return 0;
+}
+
+RTE_INIT(ip_frag_init_telemetry)
+{
+	rte_telemetry_register_cmd("/ipfrag/table_list",
+		ip_frag_handle_table_list,
+		"Returns the ids of all fragmentation tables. Takes no parameters");
+	rte_telemetry_register_cmd("/ipfrag/table_info",
+		ip_frag_handle_table_info,
+		"Returns occupancy of a fragmentation table. Parameters: table id");
+}
@@ -39,6 +39,7 @@ struct rte_ipsec_sad {
 	struct rte_hash	*hash[RTE_IPSEC_SAD_KEY_TYPE_MASK];
 	uint32_t keysize[RTE_IPSEC_SAD_KEY_TYPE_MASK];
 	uint32_t init_val;
+	uint32_t flags;
 	/* Array to track number of more specific rules
 	 * (spi_dip or spi_dip_sip). Used only in add/delete
 	 * as a helper struct.
@@ -134,6 +135,11 @@ rte_ipsec_sad_add(struct rte_ipsec_sad *sad,
 	 * value's two LSB's also indicating presence of rule with this SPI
 	 * in other tables.
 	 */
+	/* only SPI_ONLY rules are allowed in SPI_ONLY mode */
+	if ((sad->flags & RTE_IPSEC_SAD_FLAG_SPI_ONLY) != 0 &&
+			key_type != RTE_IPSEC_SAD_SPI_ONLY)
+		return -EINVAL;
+
 	switch (key_type) {
 	case(RTE_IPSEC_SAD_SPI_ONLY):
 		ret = rte_hash_lookup_with_hash_data(sad->hash[key_type],
@@ -225,6 +231,12 @@ rte_ipsec_sad_del(struct rte_ipsec_sad *sad,
 
 	if ((sad == NULL) || (key == NULL))
 		return -EINVAL;
+
+	/* only SPI_ONLY rules are allowed in SPI_ONLY mode */
+	if ((sad->flags & RTE_IPSEC_SAD_FLAG_SPI_ONLY) != 0 &&
+			key_type != RTE_IPSEC_SAD_SPI_ONLY)
+		return -EINVAL;
+
 	switch (key_type) {
 	case(RTE_IPSEC_SAD_SPI_ONLY):
 		ret = rte_hash_lookup_with_hash_data(sad->hash[key_type],
@@ -277,6 +289,13 @@ rte_ipsec_sad_create(const char *name, const struct rte_ipsec_sad_conf *conf)
 		return NULL;
 	}
 
+	/* SPI_ONLY mode keeps the SPI table exclusively */
+	if ((conf->flags & RTE_IPSEC_SAD_FLAG_SPI_ONLY) != 0 &&
+			conf->max_sa[RTE_IPSEC_SAD_SPI_ONLY] == 0) {
+		rte_errno = EINVAL;
+		return NULL;
+	}
+
 	ret = snprintf(sad_name, RTE_IPSEC_SAD_NAMESIZE, SAD_FORMAT, name);
 	if (ret < 0 || ret >= RTE_IPSEC_SAD_NAMESIZE) {
 		rte_errno = ENAMETOOLONG;
@@ -284,12 +303,16 @@ rte_ipsec_sad_create(const char *name, const struct rte_ipsec_sad_conf *conf)
 	}
 
 	/** Init SAD*/
-	sa_sum = RTE_MAX(MIN_HASH_ENTRIES,
-		conf->max_sa[RTE_IPSEC_SAD_SPI_ONLY]) +
-		RTE_MAX(MIN_HASH_ENTRIES,
-		conf->max_sa[RTE_IPSEC_SAD_SPI_DIP]) +
-		RTE_MAX(MIN_HASH_ENTRIES,
-		conf->max_sa[RTE_IPSEC_SAD_SPI_DIP_SIP]);
+	if (conf->flags & RTE_IPSEC_SAD_FLAG_SPI_ONLY)
+		sa_sum = RTE_MAX(MIN_HASH_ENTRIES,
+			conf->max_sa[RTE_IPSEC_SAD_SPI_ONLY]);
+	else
+		sa_sum = RTE_MAX(MIN_HASH_ENTRIES,
+			conf->max_sa[RTE_IPSEC_SAD_SPI_ONLY]) +
+			RTE_MAX(MIN_HASH_ENTRIES,
+			conf->max_sa[RTE_IPSEC_SAD_SPI_DIP]) +
+			RTE_MAX(MIN_HASH_ENTRIES,
+			conf->max_sa[RTE_IPSEC_SAD_SPI_DIP_SIP]);
 	sad = rte_zmalloc_socket(NULL, sizeof(*sad) +
 		(sizeof(struct hash_cnt) * sa_sum),
 		RTE_CACHE_LINE_SIZE, conf->socket_id);
@@ -298,6 +321,7 @@ rte_ipsec_sad_create(const char *name, const struct rte_ipsec_sad_conf *conf)
 		return NULL;
 	}
 	memcpy(sad->name, sad_name, sizeof(sad_name));
+	sad->flags = conf->flags;
 
 	hash_params.hash_func = DEFAULT_HASH_FUNC;
 	hash_params.hash_func_init_val = rte_rand();
@@ -318,6 +342,10 @@ rte_ipsec_sad_create(const char *name, const struct rte_ipsec_sad_conf *conf)
 		return NULL;
 	}
 
+	/* SPI_ONLY mode: no more specific tables */
+	if (conf->flags & RTE_IPSEC_SAD_FLAG_SPI_ONLY)
+		goto register_sad;
+
 	/** Init hash[RTE_IPSEC_SAD_SPI_DIP] for SPI + DIP */
 	snprintf(hash_name, sizeof(hash_name), "sad_2_%p", sad);
 	if (conf->flags & RTE_IPSEC_SAD_FLAG_IPV6)
@@ -352,6 +380,7 @@ rte_ipsec_sad_create(const char *name, const struct rte_ipsec_sad_conf *conf)
 		return NULL;
 	}
 
+register_sad:
 	sad_list = RTE_TAILQ_CAST(rte_ipsec_sad_tailq.head,
 			rte_ipsec_sad_list);
 	rte_mcfg_tailq_write_lock();
@@ -448,6 +477,36 @@ rte_ipsec_sad_destroy(struct rte_ipsec_sad *sad)
 	rte_free(te);
 }
 
+/*
+ * @internal helper function
+ * Lookup a batch of keys in the SPI_ONLY table exclusively
+ * (RTE_IPSEC_SAD_FLAG_SPI_ONLY mode): single hash probe per key,
+ * returned values carry no rule-presence bits to clear.
+ */
+static int
+__ipsec_sad_lookup_spi_only(const struct rte_ipsec_sad *sad,
+		const union rte_ipsec_sad_key *keys[], void *sa[], uint32_t n)
+{
+	hash_sig_t hash_sig[RTE_HASH_LOOKUP_BULK_MAX];
+	uint64_t mask;
+	uint32_t i;
+	int found = 0;
+
+	for (i = 0; i < n; i++) {
+		sa[i] = NULL;
+		hash_sig[i] = rte_hash_crc_4byte(keys[i]->v4.spi,
+			sad->init_val);
+	}
+
+	rte_hash_lookup_with_hash_bulk_data(sad->hash[RTE_IPSEC_SAD_SPI_ONLY],
+		(const void **)keys, hash_sig, n, &mask, sa);
+
+	for (i = 0; i < n; i++)
+		found += (sa[i] != NULL);
+
+	return found;
+}
+
 /*
  * @internal helper function
  * Lookup a batch of keys in three hash tables.
@@ -555,8 +614,12 @@ rte_ipsec_sad_lookup(const struct rte_ipsec_sad *sad,
 
 	do {
 		num = RTE_MIN(n - i, (uint32_t)RTE_HASH_LOOKUP_BULK_MAX);
-		found += __ipsec_sad_lookup(sad,
-			&keys[i], &sa[i], num);
+		if (sad->flags & RTE_IPSEC_SAD_FLAG_SPI_ONLY)
+			found += __ipsec_sad_lookup_spi_only(sad,
+				&keys[i], &sa[i], num);
+		else
+			found += __ipsec_sad_lookup(sad,
+				&keys[i], &sa[i], num);
 		i += num;
 	} while (i != n);
 
@@ -13,6 +13,10 @@
 #define WINDOW_BUCKET_MIN		2
 #define WINDOW_BUCKET_MAX		(INT16_MAX + 1)
 
+/* number of 64-bit summary words covering given number of buckets */
+#define WINDOW_SUMMARY_WORDS(nb)	\
+	(((nb) + WINDOW_BUCKET_SIZE - 1) >> WINDOW_BUCKET_BITS)
+
 #define IS_ESN(sa)	((sa)->sqn_mask == UINT64_MAX)
 
 #define	SQN_ATOMIC(sa)	((sa)->type & RTE_IPSEC_SATP_SQN_ATOM)
@@ -80,6 +84,73 @@ reconstruct_esn(uint64_t t, uint32_t sqn, uint32_t w)
 	return (uint64_t)th << 32 | sqn;
 }
 
+/**
+ * Two-level replay window (RTE_IPSEC_SATP_RWND_2LVL).
+ *
+ * A summary bitmap with one bit per window bucket is stored right after
+ * the window itself (rsn->window[nb_bucket]...). A bucket whose summary
+ * bit is clear is treated as all-zero, whatever its actual contents, so
+ * moving the window forward only has to clear summary bits: buckets are
+ * (re)initialized lazily, when the first bit is set in them again.
+ */
+
+/*
+ * clear summary bits [lo, hi), linear (non-wrapping) range.
+ */
+static inline void
+wnd_sum_clear(uint64_t sum[], uint32_t lo, uint32_t hi)
+{
+	uint32_t lw, hw;
+	uint64_t lmask, hmask;
+
+	lw = lo >> WINDOW_BUCKET_BITS;
+	hw = (hi - 1) >> WINDOW_BUCKET_BITS;
+	lmask = UINT64_MAX << (lo & WINDOW_BIT_LOC_MASK);
+	hmask = UINT64_MAX >>
+		(WINDOW_BIT_LOC_MASK - ((hi - 1) & WINDOW_BIT_LOC_MASK));
+
+	if (lw == hw)
+		sum[lw] &= ~(lmask & hmask);
+	else {
+		sum[lw] &= ~lmask;
+		for (lw++; lw != hw; lw++)
+			sum[lw] = 0;
+		sum[hw] &= ~hmask;
+	}
+}
+
+/*
+ * expire *cnt* buckets starting from *first* (modulo window size):
+ * clear their summary bits, leaving the bucket contents stale.
+ */
+static inline void
+wnd_sum_expire(struct replay_sqn *rsn, const struct rte_ipsec_sa *sa,
+	uint32_t first, uint32_t cnt)
+{
+	uint64_t *sum;
+	uint32_t nb;
+
+	sum = rsn->window + sa->replay.nb_bucket;
+	nb = sa->replay.nb_bucket;
+
+	/* window moved forward within the same bucket */
+	if (cnt == 0)
+		return;
+
+	if (cnt >= nb) {
+		memset(sum, 0, sa->replay.nb_summary * sizeof(sum[0]));
+		return;
+	}
+
+	first &= sa->replay.bucket_index_mask;
+	if (first + cnt <= nb)
+		wnd_sum_clear(sum, first, first + cnt);
+	else {
+		wnd_sum_clear(sum, first, nb);
+		wnd_sum_clear(sum, 0, first + cnt - nb);
+	}
+}
+
 /**
  * Perform the replay checking.
  *
@@ -111,6 +182,13 @@ esn_inb_check_sqn(const struct replay_sqn *rsn, const struct rte_ipsec_sa *sa,
 	bit = sqn & WINDOW_BIT_LOC_MASK;
 	bucket = (sqn >> WINDOW_BUCKET_BITS) & sa->replay.bucket_index_mask;
 
+	/* expired bucket, contents are stale */
+	if (sa->replay.nb_summary != 0 &&
+			(rsn->window[sa->replay.nb_bucket +
+				(bucket >> WINDOW_BUCKET_BITS)] &
+			(uint64_t)1 << (bucket & WINDOW_BIT_LOC_MASK)) == 0)
+		return 0;
+
 	/* already seen packet */
 	if (rsn->window[bucket] & ((uint64_t)1 << bit))
 		return -EINVAL;
@@ -171,10 +249,14 @@ esn_inb_update_sqn(struct replay_sqn *rsn, const struct rte_ipsec_sa *sa,
 		if (diff > sa->replay.nb_bucket)
 			diff = sa->replay.nb_bucket;
 
-		for (i = 0; i != diff; i++) {
-			new_bucket = (i + last_bucket + 1) &
-				sa->replay.bucket_index_mask;
-			rsn->window[new_bucket] = 0;
+		if (sa->replay.nb_summary != 0)
+			wnd_sum_expire(rsn, sa, last_bucket + 1, diff);
+		else {
+			for (i = 0; i != diff; i++) {
+				new_bucket = (i + last_bucket + 1) &
+					sa->replay.bucket_index_mask;
+				rsn->window[new_bucket] = 0;
+			}
 		}
 		rsn->sqn = sqn;
 	}
@@ -182,6 +264,18 @@ esn_inb_update_sqn(struct replay_sqn *rsn, const struct rte_ipsec_sa *sa,
 	bucket &= sa->replay.bucket_index_mask;
 	bit = (uint64_t)1 << (sqn & WINDOW_BIT_LOC_MASK);
 
+	if (sa->replay.nb_summary != 0) {
+		uint64_t *sum = rsn->window + sa->replay.nb_bucket;
+		uint64_t sb = (uint64_t)1 << (bucket & WINDOW_BIT_LOC_MASK);
+
+		/* first bit in an expired bucket: reinit it */
+		if ((sum[bucket >> WINDOW_BUCKET_BITS] & sb) == 0) {
+			sum[bucket >> WINDOW_BUCKET_BITS] |= sb;
+			rsn->window[bucket] = bit;
+			return 0;
+		}
+	}
+
 	/* already seen packet */
 	if (rsn->window[bucket] & bit)
 		return -EINVAL;
@@ -219,6 +313,24 @@ rsn_copy(const struct rte_ipsec_sa *sa, uint32_t dst, uint32_t src)
 	n = sa->replay.nb_bucket;
 
 	d->sqn = s->sqn;
+
+	/* two-level window: copy summary and live buckets only */
+	if (sa->replay.nb_summary != 0) {
+		uint32_t j, k;
+		uint64_t w;
+
+		for (i = 0; i != sa->replay.nb_summary; i++) {
+			w = s->window[n + i];
+			d->window[n + i] = w;
+			for (; w != 0; w &= w - 1) {
+				j = rte_ctz64(w);
+				k = i * WINDOW_BUCKET_SIZE + j;
+				d->window[k] = s->window[k];
+			}
+		}
+		return;
+	}
+
 	for (i = 0; i != n; i++)
 		d->window[i] = s->window[i];
 }
@@ -106,16 +106,78 @@ mbuf_cut_seg_ofs(struct rte_mbuf *mb, struct rte_mbuf *ms, uint32_t ofs,
 }
 
 /*
- * process packets using sync crypto engine.
+ * mark mbufs that sync crypto engine failed to process.
+ * expects *nb_fail* to be greater than zero.
+ */
+static inline void
+cpu_crypto_mark_failed(struct rte_mbuf *mb[], const int32_t st[],
+	uint32_t num, uint32_t nb_fail)
+{
+	uint32_t i;
+
+	for (i = 0; nb_fail != 0 && i != num; i++) {
+		if (st[i] != 0) {
+			mb[i]->ol_flags |= RTE_MBUF_F_RX_SEC_OFFLOAD_FAILED;
+			nb_fail--;
+		}
+	}
+}
+
+/*
+ * process single-segment packets using sync crypto engine.
+ * All iovec arrays are flat (one entry per packet), filled in one pass
+ * with no per-packet segment walk, and the whole burst is handed to the
+ * crypto engine with a single call.
+ */
+static inline void
+cpu_crypto_bulk_flat(const struct rte_ipsec_session *ss,
+	union rte_crypto_sym_ofs ofs, struct rte_mbuf *mb[],
+	struct rte_crypto_va_iova_ptr iv[],
+	struct rte_crypto_va_iova_ptr aad[],
+	struct rte_crypto_va_iova_ptr dgst[], const uint32_t l4ofs[],
+	const uint32_t clen[], uint32_t num)
+{
+	uint32_t i, n;
+	int32_t st[num];
+	struct rte_crypto_sgl vecpkt[num];
+	struct rte_crypto_vec vec[num];
+	struct rte_crypto_sym_vec symvec;
+
+	for (i = 0; i != num; i++) {
+		vec[i].base = rte_pktmbuf_mtod_offset(mb[i], void *, l4ofs[i]);
+		vec[i].iova = rte_pktmbuf_iova_offset(mb[i], l4ofs[i]);
+		vec[i].len = clen[i];
+		vec[i].tot_len = mb[i]->buf_len - rte_pktmbuf_headroom(mb[i]) -
+			l4ofs[i];
+		vecpkt[i].vec = &vec[i];
+		vecpkt[i].num = 1;
+	}
+
+	symvec.src_sgl = vecpkt;
+	symvec.iv = iv;
+	symvec.aad = aad;
+	symvec.digest = dgst;
+	symvec.status = st;
+	symvec.num = num;
+
+	n = rte_cryptodev_sym_cpu_crypto_process(ss->crypto.dev_id,
+		ss->crypto.ses, ofs, &symvec);
+
+	if (n != num)
+		cpu_crypto_mark_failed(mb, st, num, num - n);
+}
+
+/*
+ * process multi-segment packets using sync crypto engine.
  * expects *num* to be greater than zero.
  */
 static inline void
-cpu_crypto_bulk(const struct rte_ipsec_session *ss,
+cpu_crypto_bulk_sgl(const struct rte_ipsec_session *ss,
 	union rte_crypto_sym_ofs ofs, struct rte_mbuf *mb[],
 	struct rte_crypto_va_iova_ptr iv[],
 	struct rte_crypto_va_iova_ptr aad[],
-	struct rte_crypto_va_iova_ptr dgst[], uint32_t l4ofs[],
-	uint32_t clen[], uint32_t num)
+	struct rte_crypto_va_iova_ptr dgst[], const uint32_t l4ofs[],
+	const uint32_t clen[], uint32_t num)
 {
 	uint32_t i, j, n;
 	int32_t vcnt, vofs;
@@ -170,13 +232,40 @@ cpu_crypto_bulk(const struct rte_ipsec_session *ss,
 	n += rte_cryptodev_sym_cpu_crypto_process(ss->crypto.dev_id,
 		ss->crypto.ses, ofs, &symvec);
 
-	j = num - n;
-	for (i = 0; j != 0 && i != num; i++) {
-		if (st[i] != 0) {
-			mb[i]->ol_flags |= RTE_MBUF_F_RX_SEC_OFFLOAD_FAILED;
-			j--;
-		}
-	}
+	if (n != num)
+		cpu_crypto_mark_failed(mb, st, num, num - n);
+}
+
+/*
+ * process packets using sync crypto engine.
+ * expects *num* to be greater than zero.
+ */
+static inline void
+cpu_crypto_bulk(const struct rte_ipsec_session *ss,
+	union rte_crypto_sym_ofs ofs, struct rte_mbuf *mb[],
+	struct rte_crypto_va_iova_ptr iv[],
+	struct rte_crypto_va_iova_ptr aad[],
+	struct rte_crypto_va_iova_ptr dgst[], uint32_t l4ofs[],
+	uint32_t clen[], uint32_t num)
+{
+	uint32_t i, k;
+
+	/*
+	 * the flat path covers only packets whose data lies in one
+	 * segment, which is the common case; fall back to the generic
+	 * SGL path as soon as one packet needs a segment walk.
+	 */
+	k = 0;
+	for (i = 0; i != num; i++)
+		k += (mb[i]->nb_segs == 1 &&
+			l4ofs[i] + clen[i] <= mb[i]->data_len);
+
+	if (k == num)
+		cpu_crypto_bulk_flat(ss, ofs, mb, iv, aad, dgst, l4ofs,
+			clen, num);
+	else
+		cpu_crypto_bulk_sgl(ss, ofs, mb, iv, aad, dgst, l4ofs,
+			clen, num);
 }
 
 #endif /* _MISC_H_ */
@@ -69,6 +69,18 @@ struct rte_ipsec_sa_prm {
  */
 #define	RTE_IPSEC_SAFLAG_SQN_ATOM	(1ULL << 0)
 
+/**
+ * Use a two-level bitmap for the inbound anti-replay window.
+ * A summary bitmap with one bit per 64-bit window bucket is maintained
+ * on top of the window itself: buckets whose summary bit is clear are
+ * treated as empty without being touched. That makes the cost of moving
+ * the window forward proportional to the number of buckets / 64 instead
+ * of the number of buckets, and is recommended for large replay windows
+ * (several thousand entries and up), where the bucket-clearing loop
+ * otherwise dominates the inbound datapath.
+ */
+#define	RTE_IPSEC_SAFLAG_RWND_2LVL	(1ULL << 1)
+
 /**
  * SA type is an 64-bit value that contain the following information:
  * - IP version (IPv4/IPv6)
@@ -79,6 +91,7 @@ struct rte_ipsec_sa_prm {
  * - are SA SQN operations 'atomic'
  * - ESN enabled/disabled
  * - NAT-T UDP encapsulated (TUNNEL mode only)
+ * - replay window bitmap layout (one/two level)
  * ...
  */
 
@@ -91,7 +104,8 @@ enum {
 	RTE_SATP_LOG2_ESN,
 	RTE_SATP_LOG2_ECN,
 	RTE_SATP_LOG2_DSCP,
-	RTE_SATP_LOG2_NATT
+	RTE_SATP_LOG2_NATT,
+	RTE_SATP_LOG2_RWND
 };
 
 #define RTE_IPSEC_SATP_IPV_MASK		(1ULL << RTE_SATP_LOG2_IPV)
@@ -131,6 +145,10 @@ enum {
 #define RTE_IPSEC_SATP_NATT_DISABLE	(0ULL << RTE_SATP_LOG2_NATT)
 #define RTE_IPSEC_SATP_NATT_ENABLE	(1ULL << RTE_SATP_LOG2_NATT)
 
+#define RTE_IPSEC_SATP_RWND_MASK	(1ULL << RTE_SATP_LOG2_RWND)
+#define RTE_IPSEC_SATP_RWND_1LVL	(0ULL << RTE_SATP_LOG2_RWND)
+#define RTE_IPSEC_SATP_RWND_2LVL	(1ULL << RTE_SATP_LOG2_RWND)
+
 
 /**
  * get type of given SA
@@ -54,6 +54,12 @@ union rte_ipsec_sad_key {
 #define RTE_IPSEC_SAD_FLAG_IPV6			0x1
 /** Flag to support reader writer concurrency */
 #define RTE_IPSEC_SAD_FLAG_RW_CONCURRENCY	0x2
+/** Flag to create SAD that holds SPI_ONLY rules exclusively.
+ * The SPI+DIP and SPI+DIP+SIP tables are not allocated and lookup
+ * takes a single hash probe per key. Add/delete for the other
+ * key types fail with -EINVAL.
+ */
+#define RTE_IPSEC_SAD_FLAG_SPI_ONLY		0x4
 
 /** IPsec SAD configuration structure */
 struct rte_ipsec_sad_conf {
@@ -97,16 +97,29 @@ rte_ipsec_sa_type(const struct rte_ipsec_sa *sa)
  * structure that holds replay window and sequence number (RSN) information.
  */
 static size_t
-rsn_size(uint32_t nb_bucket)
+rsn_size(uint32_t nb_bucket, uint32_t nb_summary)
 {
 	size_t sz;
 	struct replay_sqn *rsn;
 
-	sz = sizeof(*rsn) + nb_bucket * sizeof(rsn->window[0]);
+	sz = sizeof(*rsn) + (nb_bucket + nb_summary) * sizeof(rsn->window[0]);
 	sz = RTE_ALIGN_CEIL(sz, RTE_CACHE_LINE_SIZE);
 	return sz;
 }
 
+/*
+ * number of summary words for the two-level replay window,
+ * zero when the one-level layout is used.
+ */
+static uint32_t
+replay_num_summary(uint64_t type, uint32_t nb_bucket)
+{
+	if (nb_bucket == 0 || (type & RTE_IPSEC_SATP_RWND_MASK) !=
+			RTE_IPSEC_SATP_RWND_2LVL)
+		return 0;
+	return WINDOW_SUMMARY_WORDS(nb_bucket);
+}
+
 /*
  * for given size, calculate required number of buckets.
  */
@@ -150,7 +163,7 @@ ipsec_sa_size(uint64_t type, uint32_t *wnd_sz, uint32_t *nb_bucket)
 	*wnd_sz = wsz;
 	*nb_bucket = n;
 
-	sz = rsn_size(n);
+	sz = rsn_size(n, replay_num_summary(type, n));
 	if ((type & RTE_IPSEC_SATP_SQN_MASK) == RTE_IPSEC_SATP_SQN_ATOM)
 		sz *= REPLAY_SQN_NUM;
 
@@ -246,6 +259,11 @@ fill_sa_type(const struct rte_ipsec_sa_prm *prm, uint64_t *type)
 	else
 		tp |= RTE_IPSEC_SATP_SQN_RAW;
 
+	if (prm->flags & RTE_IPSEC_SAFLAG_RWND_2LVL)
+		tp |= RTE_IPSEC_SATP_RWND_2LVL;
+	else
+		tp |= RTE_IPSEC_SATP_RWND_1LVL;
+
 	*type = tp;
 	return 0;
 }
@@ -519,11 +537,13 @@ fill_sa_replay(struct rte_ipsec_sa *sa, uint32_t wnd_sz, uint32_t nb_bucket,
 	sa->replay.win_sz = wnd_sz;
 	sa->replay.nb_bucket = nb_bucket;
 	sa->replay.bucket_index_mask = nb_bucket - 1;
+	sa->replay.nb_summary = replay_num_summary(sa->type, nb_bucket);
 	sa->sqn.inb.rsn[0] = (struct replay_sqn *)(sa + 1);
 	sa->sqn.inb.rsn[0]->sqn = sqn;
 	if ((sa->type & RTE_IPSEC_SATP_SQN_MASK) == RTE_IPSEC_SATP_SQN_ATOM) {
 		sa->sqn.inb.rsn[1] = (struct replay_sqn *)
-			((uintptr_t)sa->sqn.inb.rsn[0] + rsn_size(nb_bucket));
+			((uintptr_t)sa->sqn.inb.rsn[0] +
+			rsn_size(nb_bucket, sa->replay.nb_summary));
 		sa->sqn.inb.rsn[1]->sqn = sqn;
 	}
 }
@@ -87,6 +87,8 @@ struct __rte_cache_aligned rte_ipsec_sa {
 		uint32_t win_sz;
 		uint16_t nb_bucket;
 		uint16_t bucket_index_mask;
+		/* number of summary words, zero for one-level window */
+		uint16_t nb_summary;
 	} replay;
 	/* template for crypto op fields */
 	struct {
@@ -6,6 +6,7 @@
 
 #include <eal_export.h>
 #include <rte_string_fns.h>
+#include <rte_bitops.h>
 #include <rte_mbuf_dyn.h>
 #include <rte_log.h>
 #include <rte_cycles.h>
@@ -23,7 +24,9 @@
 static uint64_t
 latencystat_cycles_per_ns(void)
 {
-	return rte_get_timer_hz() / NS_PER_SEC;
+	uint64_t cycles = rte_get_timer_hz() / NS_PER_SEC;
+
+	return cycles != 0 ? cycles : 1;
 }
 
 RTE_LOG_REGISTER_DEFAULT(latencystat_logtype, INFO);
@@ -47,12 +50,40 @@ static uint64_t samp_intvl;
 static uint64_t timer_tsc;
 static uint64_t prev_tsc;
 
+/*
+ * Log-bucketed histogram of latency samples in TSC cycles. Each power-of-two
+ * major bucket is split into LAT_HIST_SUB_NB linear sub-buckets, giving a
+ * constant ~6% relative value resolution across the whole 64-bit range.
+ */
+#define LAT_HIST_SUB_BITS 4
+#define LAT_HIST_SUB_NB RTE_BIT32(LAT_HIST_SUB_BITS)
+#define LAT_HIST_NB_BUCKETS ((64 - LAT_HIST_SUB_BITS + 1) * LAT_HIST_SUB_NB)
+
+/* number of latency samples bucketed per inner loop in the Tx callback */
+#define LAT_BURST 32
+
+/*
+ * Per-(port,queue) latency histogram. Written only by the lcore polling the
+ * Tx queue, so no lock is taken on the data path; readers may see a sample
+ * count that is slightly out of step with the buckets, which is acceptable
+ * for statistics reporting.
+ */
+struct __rte_cache_aligned latency_hist {
+	uint16_t port_id;
+	uint16_t queue_id;
+	uint64_t nb_samples;
+	uint64_t sum_cycles;
+	uint64_t min_cycles;
+	uint64_t max_cycles;
+	float jitter; /**< Inter-packet delay variation EWMA, in cycles */
+	float prev_latency;
+	uint64_t bucket[LAT_HIST_NB_BUCKETS];
+};
+
+/* layout of the shared memzone: one histogram per active Tx queue */
 struct rte_latency_stats {
-	float min_latency; /**< Minimum latency in nano seconds */
-	float avg_latency; /**< Average latency in nano seconds */
-	float max_latency; /**< Maximum latency in nano seconds */
-	float jitter; /** Latency variation */
-	rte_spinlock_t lock; /** Latency calculation lock */
+	uint32_t nb_hists;
+	struct latency_hist hists[];
 };
 
 static struct rte_latency_stats *glob_stats;
@@ -64,36 +95,135 @@ struct rxtx_cbs {
 static struct rxtx_cbs rx_cbs[RTE_MAX_ETHPORTS][RTE_MAX_QUEUES_PER_PORT];
 static struct rxtx_cbs tx_cbs[RTE_MAX_ETHPORTS][RTE_MAX_QUEUES_PER_PORT];
 
-struct latency_stats_nameoff {
-	char name[RTE_ETH_XSTATS_NAME_SIZE];
-	unsigned int offset;
+static const char *lat_stats_strings[] = {
+	"min_latency_ns",
+	"avg_latency_ns",
+	"max_latency_ns",
+	"jitter_ns",
+	"p50_latency_ns",
+	"p99_latency_ns",
+	"p9999_latency_ns",
 };
 
-static const struct latency_stats_nameoff lat_stats_strings[] = {
-	{"min_latency_ns", offsetof(struct rte_latency_stats, min_latency)},
-	{"avg_latency_ns", offsetof(struct rte_latency_stats, avg_latency)},
-	{"max_latency_ns", offsetof(struct rte_latency_stats, max_latency)},
-	{"jitter_ns", offsetof(struct rte_latency_stats, jitter)},
-};
+#define NUM_LATENCY_STATS RTE_DIM(lat_stats_strings)
+
+static inline unsigned int
+lat_hist_bucket(uint64_t cycles)
+{
+	unsigned int msb;
+
+	if (cycles < LAT_HIST_SUB_NB)
+		return cycles;
+	msb = 63 - rte_clz64(cycles);
+	return ((msb - LAT_HIST_SUB_BITS + 1) << LAT_HIST_SUB_BITS) +
+		((cycles >> (msb - LAT_HIST_SUB_BITS)) & (LAT_HIST_SUB_NB - 1));
+}
+
+/* lower edge of a bucket, i.e. the smallest cycle count mapping to it */
+static uint64_t
+lat_hist_bucket_value(unsigned int bucket)
+{
+	unsigned int msb;
+
+	if (bucket < LAT_HIST_SUB_NB)
+		return bucket;
+	msb = (bucket >> LAT_HIST_SUB_BITS) + LAT_HIST_SUB_BITS - 1;
+	return (UINT64_C(1) << msb) +
+		((uint64_t)(bucket & (LAT_HIST_SUB_NB - 1)) <<
+			(msb - LAT_HIST_SUB_BITS));
+}
+
+/*
+ * Compute percentile values, in cycles, from the merged buckets of a set of
+ * histograms. The percentiles array holds targets scaled to 1/10000ths
+ * (5000 for p50) and must be sorted ascending; all targets are resolved in
+ * a single walk of the buckets.
+ */
+static void
+lat_hist_percentiles(const struct latency_hist *hists, uint32_t nb_hists,
+		const unsigned int *percentiles, uint64_t *values,
+		unsigned int nb_percentiles)
+{
+	uint64_t total = 0, cum = 0, rank;
+	unsigned int b, p = 0;
+	uint32_t h;
+
+	for (h = 0; h < nb_hists; h++)
+		total += hists[h].nb_samples;
+	if (total == 0) {
+		for (p = 0; p < nb_percentiles; p++)
+			values[p] = 0;
+		return;
+	}
+
+	for (b = 0; b < LAT_HIST_NB_BUCKETS && p < nb_percentiles; b++) {
+		for (h = 0; h < nb_hists; h++)
+			cum += hists[h].bucket[b];
+		rank = (total * percentiles[p] + 9999) / 10000;
+		while (p < nb_percentiles && cum >= rank) {
+			values[p++] = lat_hist_bucket_value(b);
+			if (p < nb_percentiles)
+				rank = (total * percentiles[p] + 9999) / 10000;
+		}
+	}
+	while (p < nb_percentiles)
+		values[p++] = lat_hist_bucket_value(LAT_HIST_NB_BUCKETS - 1);
+}
+
+static void
+rte_latencystats_fill_values(struct rte_metric_value *values)
+{
+	static const unsigned int percentiles[] = { 5000, 9900, 9999 };
+	uint64_t vals[NUM_LATENCY_STATS] = { 0 };
+	uint64_t nb = 0, sum = 0, min = 0, max = 0;
+	double jitter = 0;
+	const uint64_t cyc_per_ns = latencystat_cycles_per_ns();
+	uint32_t h;
+	unsigned int i;
 
-#define NUM_LATENCY_STATS (sizeof(lat_stats_strings) / \
-				sizeof(lat_stats_strings[0]))
+	for (h = 0; h < glob_stats->nb_hists; h++) {
+		const struct latency_hist *hist = &glob_stats->hists[h];
+
+		if (hist->nb_samples == 0)
+			continue;
+		if (min == 0 || hist->min_cycles < min)
+			min = hist->min_cycles;
+		if (hist->max_cycles > max)
+			max = hist->max_cycles;
+		sum += hist->sum_cycles;
+		jitter += (double)hist->jitter * hist->nb_samples;
+		nb += hist->nb_samples;
+	}
+
+	if (nb != 0) {
+		vals[0] = min / cyc_per_ns;
+		vals[1] = (sum / nb) / cyc_per_ns;
+		vals[2] = max / cyc_per_ns;
+		vals[3] = (uint64_t)floor(jitter / nb) / cyc_per_ns;
+		lat_hist_percentiles(glob_stats->hists, glob_stats->nb_hists,
+				percentiles, &vals[4], RTE_DIM(percentiles));
+		for (i = 4; i < NUM_LATENCY_STATS; i++)
+			vals[i] /= cyc_per_ns;
+	}
+
+	for (i = 0; i < NUM_LATENCY_STATS; i++) {
+		values[i].key = i;
+		values[i].value = vals[i];
+	}
+}
 
 RTE_EXPORT_SYMBOL(rte_latencystats_update)
 int32_t
 rte_latencystats_update(void)
 {
+	struct rte_metric_value metrics[NUM_LATENCY_STATS];
+	uint64_t values[NUM_LATENCY_STATS];
 	unsigned int i;
-	float *stats_ptr = NULL;
-	uint64_t values[NUM_LATENCY_STATS] = {0};
 	int ret;
 
-	for (i = 0; i < NUM_LATENCY_STATS; i++) {
-		stats_ptr = RTE_PTR_ADD(glob_stats,
-				lat_stats_strings[i].offset);
-		values[i] = (uint64_t)floor((*stats_ptr)/
-				latencystat_cycles_per_ns());
-	}
+	rte_latencystats_fill_values(metrics);
+	for (i = 0; i < NUM_LATENCY_STATS; i++)
+		values[i] = metrics[i].value;
 
 	ret = rte_metrics_update_values(RTE_METRICS_GLOBAL,
 					latency_stats_index,
@@ -104,21 +234,6 @@ rte_latencystats_update(void)
 	return ret;
 }
 
-static void
-rte_latencystats_fill_values(struct rte_metric_value *values)
-{
-	unsigned int i;
-	float *stats_ptr = NULL;
-
-	for (i = 0; i < NUM_LATENCY_STATS; i++) {
-		stats_ptr = RTE_PTR_ADD(glob_stats,
-				lat_stats_strings[i].offset);
-		values[i].key = i;
-		values[i].value = (uint64_t)floor((*stats_ptr)/
-						latencystat_cycles_per_ns());
-	}
-}
-
 static uint16_t
 add_time_stamps(uint16_t pid __rte_unused,
 		uint16_t qid __rte_unused,
@@ -152,33 +267,28 @@ add_time_stamps(uint16_t pid __rte_unused,
 	return nb_pkts;
 }
 
-static uint16_t
-calc_latency(uint16_t pid __rte_unused,
-		uint16_t qid __rte_unused,
-		struct rte_mbuf **pkts,
-		uint16_t nb_pkts,
-		void *_ __rte_unused)
+/* bucket a batch of latency deltas; the loops are kept simple and
+ * branch-free so the compiler can vectorize the bucket computation.
+ */
+static inline void
+lat_hist_record_burst(struct latency_hist *hist, const uint64_t *deltas,
+		unsigned int nb)
 {
+	uint16_t buckets[LAT_BURST];
+	float latency, jitter = hist->jitter;
+	float prev_latency = hist->prev_latency;
 	unsigned int i;
-	uint64_t now;
-	float latency;
-	static float prev_latency;
-	/*
-	 * Alpha represents degree of weighting decrease in EWMA,
-	 * a constant smoothing factor between 0 and 1. The value
-	 * is used below for measuring average latency.
-	 */
-	const float alpha = 0.2f;
-
-	now = rte_rdtsc();
 
-	rte_spinlock_lock(&glob_stats->lock);
-	for (i = 0; i < nb_pkts; i++) {
-		if (!(pkts[i]->ol_flags & timestamp_dynflag))
-			continue;
-
-		latency = now - *timestamp_dynfield(pkts[i]);
+	for (i = 0; i < nb; i++)
+		buckets[i] = lat_hist_bucket(deltas[i]);
 
+	for (i = 0; i < nb; i++) {
+		hist->bucket[buckets[i]]++;
+		hist->sum_cycles += deltas[i];
+		if (hist->min_cycles == 0 || deltas[i] < hist->min_cycles)
+			hist->min_cycles = deltas[i];
+		if (deltas[i] > hist->max_cycles)
+			hist->max_cycles = deltas[i];
 		/*
 		 * The jitter is calculated as statistical mean of interpacket
 		 * delay variation. The "jitter estimate" is computed by taking
@@ -190,24 +300,41 @@ calc_latency(uint16_t pid __rte_unused,
 		 * Reference: Calculated as per RFC 5481, sec 4.1,
 		 * RFC 3393 sec 4.5, RFC 1889 sec.
 		 */
-		glob_stats->jitter +=  (fabsf(prev_latency - latency)
-					- glob_stats->jitter)/16;
-		if (glob_stats->min_latency == 0)
-			glob_stats->min_latency = latency;
-		else if (latency < glob_stats->min_latency)
-			glob_stats->min_latency = latency;
-		else if (latency > glob_stats->max_latency)
-			glob_stats->max_latency = latency;
-		/*
-		 * The average latency is measured using exponential moving
-		 * average, i.e. using EWMA
-		 * https://en.wikipedia.org/wiki/Moving_average
-		 */
-		glob_stats->avg_latency +=
-			alpha * (latency - glob_stats->avg_latency);
+		latency = deltas[i];
+		jitter += (fabsf(prev_latency - latency) - jitter) / 16;
 		prev_latency = latency;
 	}
-	rte_spinlock_unlock(&glob_stats->lock);
+	hist->nb_samples += nb;
+	hist->jitter = jitter;
+	hist->prev_latency = prev_latency;
+}
+
+static uint16_t
+calc_latency(uint16_t pid __rte_unused,
+		uint16_t qid __rte_unused,
+		struct rte_mbuf **pkts,
+		uint16_t nb_pkts,
+		void *arg)
+{
+	struct latency_hist *hist = arg;
+	uint64_t deltas[LAT_BURST];
+	unsigned int i, nb_deltas = 0;
+	uint64_t now;
+
+	/* gather the whole burst's deltas first, then bucket them in bulk */
+	now = rte_rdtsc();
+	for (i = 0; i < nb_pkts; i++) {
+		if (!(pkts[i]->ol_flags & timestamp_dynflag))
+			continue;
+
+		deltas[nb_deltas++] = now - *timestamp_dynfield(pkts[i]);
+		if (nb_deltas == LAT_BURST) {
+			lat_hist_record_burst(hist, deltas, nb_deltas);
+			nb_deltas = 0;
+		}
+	}
+	if (nb_deltas != 0)
+		lat_hist_record_burst(hist, deltas, nb_deltas);
 
 	return nb_pkts;
 }
@@ -220,6 +347,7 @@ rte_latencystats_init(uint64_t app_samp_intvl,
 	unsigned int i;
 	uint16_t pid;
 	uint16_t qid;
+	uint32_t nb_hists = 0, hist_idx = 0;
 	struct rxtx_cbs *cbs = NULL;
 	const char *ptr_strings[NUM_LATENCY_STATS] = {0};
 	const struct rte_memzone *mz = NULL;
@@ -229,8 +357,20 @@ rte_latencystats_init(uint64_t app_samp_intvl,
 	if (rte_memzone_lookup(MZ_RTE_LATENCY_STATS))
 		return -EEXIST;
 
+	/* one histogram is kept per active Tx queue */
+	RTE_ETH_FOREACH_DEV(pid) {
+		struct rte_eth_dev_info dev_info;
+
+		ret = rte_eth_dev_info_get(pid, &dev_info);
+		if (ret != 0)
+			continue;
+		nb_hists += dev_info.nb_tx_queues;
+	}
+
 	/** Allocate stats in shared memory fo multi process support */
-	mz = rte_memzone_reserve(MZ_RTE_LATENCY_STATS, sizeof(*glob_stats),
+	mz = rte_memzone_reserve(MZ_RTE_LATENCY_STATS,
+					sizeof(*glob_stats) +
+					nb_hists * sizeof(struct latency_hist),
 					rte_socket_id(), flags);
 	if (mz == NULL) {
 		LATENCY_STATS_LOG(ERR, "Cannot reserve memory: %s:%d",
@@ -239,12 +379,13 @@ rte_latencystats_init(uint64_t app_samp_intvl,
 	}
 
 	glob_stats = mz->addr;
-	rte_spinlock_init(&glob_stats->lock);
+	memset(glob_stats, 0, sizeof(*glob_stats) +
+			nb_hists * sizeof(struct latency_hist));
 	samp_intvl = app_samp_intvl * latencystat_cycles_per_ns();
 
 	/** Register latency stats with stats library */
 	for (i = 0; i < NUM_LATENCY_STATS; i++)
-		ptr_strings[i] = lat_stats_strings[i].name;
+		ptr_strings[i] = lat_stats_strings[i];
 
 	latency_stats_index = rte_metrics_reg_names(ptr_strings,
 							NUM_LATENCY_STATS);
@@ -285,16 +426,26 @@ rte_latencystats_init(uint64_t app_samp_intvl,
 					"register Rx callback for pid=%d, "
 					"qid=%d", pid, qid);
 		}
-		for (qid = 0; qid < dev_info.nb_tx_queues; qid++) {
+		for (qid = 0; qid < dev_info.nb_tx_queues &&
+				hist_idx < nb_hists; qid++) {
+			struct latency_hist *hist =
+				&glob_stats->hists[hist_idx];
+
+			hist->port_id = pid;
+			hist->queue_id = qid;
 			cbs = &tx_cbs[pid][qid];
-			cbs->cb =  rte_eth_add_tx_callback(pid, qid,
-					calc_latency, user_cb);
-			if (!cbs->cb)
+			cbs->cb = rte_eth_add_tx_callback(pid, qid,
+					calc_latency, hist);
+			if (!cbs->cb) {
 				LATENCY_STATS_LOG(INFO, "Failed to "
 					"register Tx callback for pid=%d, "
 					"qid=%d", pid, qid);
+				continue;
+			}
+			hist_idx++;
 		}
 	}
+	glob_stats->nb_hists = hist_idx;
 	return 0;
 }
 
@@ -342,6 +493,7 @@ rte_latencystats_uninit(void)
 	/* free up the memzone */
 	mz = rte_memzone_lookup(MZ_RTE_LATENCY_STATS);
 	rte_memzone_free(mz);
+	glob_stats = NULL;
 
 	return 0;
 }
@@ -356,7 +508,7 @@ rte_latencystats_get_names(struct rte_metric_name *names, uint16_t size)
 		return NUM_LATENCY_STATS;
 
 	for (i = 0; i < NUM_LATENCY_STATS; i++)
-		strlcpy(names[i].name, lat_stats_strings[i].name,
+		strlcpy(names[i].name, lat_stats_strings[i],
 			sizeof(names[i].name));
 
 	return NUM_LATENCY_STATS;
@@ -385,3 +537,53 @@ rte_latencystats_get(struct rte_metric_value *values, uint16_t size)
 
 	return NUM_LATENCY_STATS;
 }
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_latencystats_queue_get, 25.07)
+int
+rte_latencystats_queue_get(uint16_t port_id, uint16_t queue_id,
+		struct rte_latency_queue_summary *summary)
+{
+	static const unsigned int percentiles[] = { 5000, 9900, 9999 };
+	const struct latency_hist *hist = NULL;
+	const uint64_t cyc_per_ns = latencystat_cycles_per_ns();
+	uint64_t vals[RTE_DIM(percentiles)];
+	uint32_t h;
+
+	if (summary == NULL)
+		return -EINVAL;
+
+	if (rte_eal_process_type() == RTE_PROC_SECONDARY) {
+		const struct rte_memzone *mz;
+		mz = rte_memzone_lookup(MZ_RTE_LATENCY_STATS);
+		if (mz == NULL)
+			return -ENOMEM;
+		glob_stats = mz->addr;
+	}
+	if (glob_stats == NULL)
+		return -EINVAL;
+
+	for (h = 0; h < glob_stats->nb_hists; h++)
+		if (glob_stats->hists[h].port_id == port_id &&
+				glob_stats->hists[h].queue_id == queue_id) {
+			hist = &glob_stats->hists[h];
+			break;
+		}
+	if (hist == NULL)
+		return -ENOENT;
+
+	memset(summary, 0, sizeof(*summary));
+	summary->nb_samples = hist->nb_samples;
+	if (hist->nb_samples == 0)
+		return 0;
+
+	summary->min_ns = hist->min_cycles / cyc_per_ns;
+	summary->avg_ns = (hist->sum_cycles / hist->nb_samples) / cyc_per_ns;
+	summary->max_ns = hist->max_cycles / cyc_per_ns;
+	summary->jitter_ns = (uint64_t)floorf(hist->jitter) / cyc_per_ns;
+	lat_hist_percentiles(hist, 1, percentiles, vals, RTE_DIM(percentiles));
+	summary->p50_ns = vals[0] / cyc_per_ns;
+	summary->p99_ns = vals[1] / cyc_per_ns;
+	summary->p9999_ns = vals[2] / cyc_per_ns;
+
+	return 0;
+}
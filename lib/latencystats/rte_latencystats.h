@@ -121,6 +121,47 @@ int rte_latencystats_get_names(struct rte_metric_name *names,
 int rte_latencystats_get(struct rte_metric_value *values,
 			uint16_t size);
 
+/**
+ * Summary of the latency histogram kept for one (port, Tx queue) pair.
+ * All values are in nano seconds.
+ */
+struct rte_latency_queue_summary {
+	uint64_t nb_samples; /**< Number of latency samples recorded */
+	uint64_t min_ns;     /**< Minimum latency */
+	uint64_t avg_ns;     /**< Average latency */
+	uint64_t max_ns;     /**< Maximum latency */
+	uint64_t jitter_ns;  /**< Latency variation, see RFC 5481 sec 4.1 */
+	uint64_t p50_ns;     /**< 50th percentile latency */
+	uint64_t p99_ns;     /**< 99th percentile latency */
+	uint64_t p9999_ns;   /**< 99.99th percentile latency */
+};
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Retrieve the latency summary, including percentiles, for one Tx queue.
+ *
+ * Latency samples are kept in a per-(port, queue) histogram written only
+ * by the lcore polling that queue, so this query never contends with the
+ * data path.
+ *
+ * @param port_id
+ *   The port identifier of the Ethernet device.
+ * @param queue_id
+ *   The index of the Tx queue.
+ * @param summary
+ *   Structure to be filled with the queue's latency summary.
+ * @return
+ *   0 on success.
+ *   -EINVAL if summary is NULL or latency stats are not initialized.
+ *   -ENOENT if no histogram is kept for the given port and queue.
+ *   -ENOMEM if the stats memory cannot be found (secondary process).
+ */
+__rte_experimental
+int rte_latencystats_queue_get(uint16_t port_id, uint16_t queue_id,
+			struct rte_latency_queue_summary *summary);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,256 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2025 Intel Corporation
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/queue.h>
+
+#include <eal_export.h>
+#include <rte_bitops.h>
+#include <rte_common.h>
+#include <rte_cycles.h>
+#include <rte_log.h>
+#include <rte_per_lcore.h>
+#include <rte_spinlock.h>
+#include <rte_stdatomic.h>
+
+#include "log_private.h"
+
+/*
+ * Deferred binary logging.
+ *
+ * Capture side: each logging thread owns a single-producer ring of raw
+ * records (format string pointer plus up to RTE_LOG_DEFERRED_ARGS_MAX
+ * argument words); rte_log_deferred() publishes a record with one
+ * release store and never formats, locks or performs I/O. Drain side:
+ * rte_log_deferred_drain() is the only consumer of every ring, so a
+ * plain lock serializing drain callers is all the synchronization the
+ * consumer index needs.
+ *
+ * The rings are allocated lazily on a thread's first deferred log call
+ * and linked into a global list so the drain can reach them; they are
+ * never freed, since the draining thread cannot know when a logging
+ * thread is gone. This library cannot spawn the draining thread itself
+ * (it has no dependency on the EAL threading layer), so the application
+ * is expected to call the drain from a control thread.
+ */
+
+#define LOG_DEFERRED_RING_MIN 8
+
+struct log_deferred_rec {
+	const char *fmt;    /* format string, must outlive the drain */
+	uint64_t when;      /* TSC at capture time */
+	uint32_t logtype;
+	uint8_t level;
+	uint8_t nargs;
+	uint64_t args[RTE_LOG_DEFERRED_ARGS_MAX];
+};
+
+struct log_deferred_ring {
+	TAILQ_ENTRY(log_deferred_ring) next;
+	uint32_t size;  /* number of records, power of two */
+	uint32_t mask;
+	RTE_ATOMIC(uint32_t) head; /* producer index */
+	RTE_ATOMIC(uint32_t) tail; /* consumer index */
+	RTE_ATOMIC(uint64_t) dropped;
+	struct log_deferred_rec recs[];
+};
+
+TAILQ_HEAD(log_deferred_ring_list, log_deferred_ring);
+
+static struct log_deferred_ring_list deferred_rings =
+	TAILQ_HEAD_INITIALIZER(deferred_rings);
+/* protects the ring list, the configured size and the drain */
+static rte_spinlock_t deferred_lock = RTE_SPINLOCK_INITIALIZER;
+
+static RTE_ATOMIC(bool) deferred_enabled;
+static uint32_t deferred_ring_size;
+
+static RTE_ATOMIC(uint64_t) deferred_enqueued;
+static RTE_ATOMIC(uint64_t) deferred_drained;
+
+static RTE_DEFINE_PER_LCORE(struct log_deferred_ring *, deferred_ring);
+
+static struct log_deferred_ring *
+log_deferred_ring_get(void)
+{
+	struct log_deferred_ring *r = RTE_PER_LCORE(deferred_ring);
+	uint32_t size;
+
+	if (likely(r != NULL))
+		return r;
+
+	rte_spinlock_lock(&deferred_lock);
+	size = deferred_ring_size;
+	rte_spinlock_unlock(&deferred_lock);
+	if (size == 0)
+		return NULL;
+
+	r = calloc(1, sizeof(*r) + (size_t)size * sizeof(r->recs[0]));
+	if (r == NULL)
+		return NULL;
+	r->size = size;
+	r->mask = size - 1;
+
+	rte_spinlock_lock(&deferred_lock);
+	TAILQ_INSERT_TAIL(&deferred_rings, r, next);
+	rte_spinlock_unlock(&deferred_lock);
+
+	RTE_PER_LCORE(deferred_ring) = r;
+	return r;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_log_deferred_enable, 25.07)
+int
+rte_log_deferred_enable(uint32_t ring_size)
+{
+	int ret = 0;
+
+	if (ring_size < LOG_DEFERRED_RING_MIN ||
+			!rte_is_power_of_2(ring_size))
+		return -EINVAL;
+
+	rte_spinlock_lock(&deferred_lock);
+	if (deferred_ring_size != 0 && deferred_ring_size != ring_size)
+		ret = -EBUSY;
+	else
+		deferred_ring_size = ring_size;
+	rte_spinlock_unlock(&deferred_lock);
+
+	if (ret == 0)
+		rte_atomic_store_explicit(&deferred_enabled, true,
+			rte_memory_order_release);
+	return ret;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_log_deferred_disable, 25.07)
+void
+rte_log_deferred_disable(void)
+{
+	rte_atomic_store_explicit(&deferred_enabled, false,
+		rte_memory_order_release);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_log_deferred, 25.07)
+int
+rte_log_deferred(uint32_t level, uint32_t logtype, unsigned int nargs,
+	const char *fmt, ...)
+{
+	struct log_deferred_ring *r;
+	struct log_deferred_rec *rec;
+	uint32_t head, tail;
+	unsigned int i;
+	va_list ap;
+
+	if (nargs > RTE_LOG_DEFERRED_ARGS_MAX)
+		return -E2BIG;
+	if (!rte_log_can_log(logtype, level))
+		return 0;
+
+	if (!rte_atomic_load_explicit(&deferred_enabled,
+			rte_memory_order_acquire) ||
+			(r = log_deferred_ring_get()) == NULL) {
+		/* fall back to the synchronous path */
+		char buf[LINE_MAX];
+		int ret;
+
+		va_start(ap, fmt);
+		ret = vsnprintf(buf, sizeof(buf), fmt, ap);
+		va_end(ap);
+		if (ret < 0)
+			return -EINVAL;
+		return rte_log(level, logtype, "%s\n", buf) < 0 ? -EINVAL : 0;
+	}
+
+	head = rte_atomic_load_explicit(&r->head, rte_memory_order_relaxed);
+	tail = rte_atomic_load_explicit(&r->tail, rte_memory_order_acquire);
+	if (head - tail >= r->size) {
+		rte_atomic_fetch_add_explicit(&r->dropped, 1,
+			rte_memory_order_relaxed);
+		return -ENOBUFS;
+	}
+
+	rec = &r->recs[head & r->mask];
+	rec->fmt = fmt;
+	rec->when = rte_rdtsc();
+	rec->logtype = logtype;
+	rec->level = (uint8_t)level;
+	rec->nargs = (uint8_t)nargs;
+	va_start(ap, fmt);
+	for (i = 0; i < nargs; i++)
+		rec->args[i] = va_arg(ap, uint64_t);
+	va_end(ap);
+
+	rte_atomic_store_explicit(&r->head, head + 1,
+		rte_memory_order_release);
+	rte_atomic_fetch_add_explicit(&deferred_enqueued, 1,
+		rte_memory_order_relaxed);
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_log_deferred_drain, 25.07)
+unsigned int
+rte_log_deferred_drain(void)
+{
+	struct log_deferred_ring *r;
+	unsigned int emitted = 0;
+	char buf[LINE_MAX];
+
+	rte_spinlock_lock(&deferred_lock);
+	TAILQ_FOREACH(r, &deferred_rings, next) {
+		uint32_t tail = rte_atomic_load_explicit(&r->tail,
+			rte_memory_order_relaxed);
+		uint32_t head = rte_atomic_load_explicit(&r->head,
+			rte_memory_order_acquire);
+
+		while (tail != head) {
+			const struct log_deferred_rec *rec =
+				&r->recs[tail & r->mask];
+
+			/*
+			 * Extra printf arguments beyond the conversions in
+			 * the format are evaluated and ignored, so always
+			 * passing all argument words is well defined.
+			 */
+			snprintf(buf, sizeof(buf), rec->fmt,
+				rec->args[0], rec->args[1],
+				rec->args[2], rec->args[3]);
+			rte_log(rec->level, rec->logtype,
+				"[%" PRIu64 "] %s\n", rec->when, buf);
+			emitted++;
+			tail++;
+			rte_atomic_store_explicit(&r->tail, tail,
+				rte_memory_order_release);
+		}
+	}
+	rte_spinlock_unlock(&deferred_lock);
+
+	rte_atomic_fetch_add_explicit(&deferred_drained, emitted,
+		rte_memory_order_relaxed);
+	return emitted;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_log_deferred_get_stats, 25.07)
+void
+rte_log_deferred_get_stats(struct rte_log_deferred_stats *stats)
+{
+	struct log_deferred_ring *r;
+	uint64_t dropped = 0;
+
+	stats->enqueued = rte_atomic_load_explicit(&deferred_enqueued,
+		rte_memory_order_relaxed);
+	stats->drained = rte_atomic_load_explicit(&deferred_drained,
+		rte_memory_order_relaxed);
+
+	rte_spinlock_lock(&deferred_lock);
+	TAILQ_FOREACH(r, &deferred_rings, next)
+		dropped += rte_atomic_load_explicit(&r->dropped,
+			rte_memory_order_relaxed);
+	rte_spinlock_unlock(&deferred_lock);
+	stats->dropped = dropped;
+}
@@ -516,6 +516,131 @@ RTE_INIT(__##type)							    \
 	RTE_LOG_REGISTER_IMPL(type,					      \
 		 RTE_STR(RTE_LOG_DEFAULT_LOGTYPE) "." RTE_STR(suffix), level)
 
+/** Maximum number of arguments a deferred log record can capture. */
+#define RTE_LOG_DEFERRED_ARGS_MAX 4
+
+/** Counters of the deferred logging mode. */
+struct rte_log_deferred_stats {
+	uint64_t enqueued; /**< Records captured into the rings. */
+	uint64_t drained;  /**< Records formatted and emitted. */
+	uint64_t dropped;  /**< Records lost to full rings. */
+};
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Enable the deferred logging mode.
+ *
+ * While enabled, rte_log_deferred() calls record the format string
+ * pointer and the raw argument words into a per-thread ring instead of
+ * formatting and writing synchronously; the cost on the logging thread
+ * is tens of nanoseconds. The records are formatted and emitted to the
+ * regular log stream by rte_log_deferred_drain(), which a control
+ * thread must call periodically. When a ring fills up before the next
+ * drain, further records from that thread are dropped and counted.
+ *
+ * @param ring_size
+ *   Capacity of each per-thread ring in records, a power of two of at
+ *   least 8. Rings are allocated lazily on a thread's first deferred
+ *   log call and keep their size until process exit.
+ * @return
+ *   0 on success, -EINVAL on an invalid ring size, -EBUSY if rings
+ *   were already created with a different size.
+ */
+__rte_experimental
+int rte_log_deferred_enable(uint32_t ring_size);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Disable the deferred logging mode. Subsequent rte_log_deferred()
+ * calls format and write synchronously again. Records still queued
+ * remain available to rte_log_deferred_drain().
+ */
+__rte_experimental
+void rte_log_deferred_disable(void);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Format and emit all queued deferred log records to the configured
+ * log stream, oldest first per ring. Each line is prefixed with the
+ * TSC value captured when the record was logged. Safe to call
+ * concurrently with logging threads; concurrent drain calls are
+ * serialized.
+ *
+ * @return
+ *   Number of records emitted.
+ */
+__rte_experimental
+unsigned int rte_log_deferred_drain(void);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Retrieve the aggregate counters of the deferred logging mode.
+ *
+ * @param stats
+ *   Structure the counters are written into.
+ */
+__rte_experimental
+void rte_log_deferred_get_stats(struct rte_log_deferred_stats *stats);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Record one log message for deferred formatting, usually via the
+ * RTE_LOG_DEFERRED_LINE() wrapper.
+ *
+ * The format string must be a string literal (or otherwise outlive the
+ * drain) and must not end with a newline; one is appended on emission.
+ * Every variadic argument is captured as a 64-bit word, so arguments
+ * must be cast to uint64_t and the matching conversions must use the
+ * PRIu64/PRId64/PRIx64 length modifiers. Strings and pointers cannot
+ * be captured by reference; format them at the callsite if needed.
+ *
+ * When the deferred mode is disabled, the message is formatted and
+ * written synchronously like RTE_LOG_LINE().
+ *
+ * @param level
+ *   Log level. A value between EMERG (1) and DEBUG (8).
+ * @param logtype
+ *   The log type, for example, RTE_LOGTYPE_EAL.
+ * @param nargs
+ *   Number of variadic arguments, at most RTE_LOG_DEFERRED_ARGS_MAX.
+ * @param fmt
+ *   The format string, as in printf().
+ * @return
+ *   0 on success, a negative errno value on failure (-ENOBUFS when the
+ *   ring is full, -E2BIG when nargs is too large).
+ */
+__rte_experimental
+int rte_log_deferred(uint32_t level, uint32_t logtype, unsigned int nargs,
+	const char *fmt, ...)
+	__rte_format_printf(4, 5);
+
+/** @internal Count the arguments of RTE_LOG_DEFERRED_LINE(). */
+#define __RTE_LOG_DEFERRED_NARGS(_0, _1, _2, _3, _4, N, ...) N
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Deferred counterpart of RTE_LOG_LINE(): records the message into the
+ * per-thread deferred ring when the deferred mode is enabled, formats
+ * and writes it synchronously otherwise. See rte_log_deferred() for
+ * the restrictions on the format string and arguments.
+ */
+#define RTE_LOG_DEFERRED_LINE(l, t, ...) \
+	rte_log_deferred(RTE_LOG_ ## l, RTE_LOGTYPE_ ## t, \
+		__RTE_LOG_DEFERRED_NARGS(__VA_ARGS__, 4, 3, 2, 1, 0), \
+		__VA_ARGS__)
+
 #ifdef __cplusplus
 }
 #endif
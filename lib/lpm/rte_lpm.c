@@ -66,6 +66,11 @@ struct __rte_lpm {
 	struct rte_rcu_qsbr *v;		/* RCU QSBR variable. */
 	enum rte_lpm_qsbr_mode rcu_mode;/* Blocking, defer queue. */
 	struct rte_rcu_qsbr_dq *dq;	/* RCU QSBR defer queue. */
+
+	/* Bulk update state. */
+	uint32_t tbl8_alloc_hint;	/* Next tbl8 group scan start. */
+	uint32_t *deferred_tbl8_frees;	/* Groups pending one grace period. */
+	uint32_t n_deferred_tbl8_frees;	/* Number of pending groups. */
 };
 
 /* Macro to enable/disable run-time checks. */
@@ -502,9 +507,17 @@ _tbl8_alloc(struct __rte_lpm *i_lpm)
 {
 	uint32_t group_idx; /* tbl8 group index. */
 	struct rte_lpm_tbl_entry *tbl8_entry;
+	uint32_t i;
 
-	/* Scan through tbl8 to find a free (i.e. INVALID) tbl8 group. */
-	for (group_idx = 0; group_idx < i_lpm->number_tbl8s; group_idx++) {
+	/*
+	 * Scan through tbl8 to find a free (i.e. INVALID) tbl8 group.
+	 * Start from the group following the last allocation so that
+	 * consecutive allocations do not rescan the occupied groups.
+	 */
+	for (i = 0; i < i_lpm->number_tbl8s; i++) {
+		group_idx = i_lpm->tbl8_alloc_hint + i;
+		if (group_idx >= i_lpm->number_tbl8s)
+			group_idx -= i_lpm->number_tbl8s;
 		tbl8_entry = &i_lpm->lpm.tbl8[group_idx *
 					RTE_LPM_TBL8_GROUP_NUM_ENTRIES];
 		/* If a free tbl8 group is found clean it and set as VALID. */
@@ -523,6 +536,10 @@ _tbl8_alloc(struct __rte_lpm *i_lpm)
 			rte_atomic_store_explicit(&tbl8_entry->val, new_tbl8_entry.val,
 					rte_memory_order_relaxed);
 
+			i_lpm->tbl8_alloc_hint = group_idx + 1;
+			if (i_lpm->tbl8_alloc_hint == i_lpm->number_tbl8s)
+				i_lpm->tbl8_alloc_hint = 0;
+
 			/* Return group index for allocated tbl8 group. */
 			return group_idx;
 		}
@@ -561,6 +578,16 @@ tbl8_free(struct __rte_lpm *i_lpm, uint32_t tbl8_group_start)
 		rte_atomic_store_explicit(&tbl8_entry->val, zero_tbl8_entry.val,
 				rte_memory_order_relaxed);
 	} else if (i_lpm->rcu_mode == RTE_LPM_QSBR_MODE_SYNC) {
+		if (i_lpm->deferred_tbl8_frees != NULL) {
+			/*
+			 * Bulk delete in progress, record the group so a
+			 * single grace period covers the whole batch.
+			 */
+			i_lpm->deferred_tbl8_frees[
+				i_lpm->n_deferred_tbl8_frees++] =
+					tbl8_group_start;
+			return 0;
+		}
 		/* Wait for quiescent state change. */
 		rte_rcu_qsbr_synchronize(i_lpm->v,
 			RTE_QSBR_THRID_INVALID);
@@ -820,23 +847,13 @@ add_depth_big(struct __rte_lpm *i_lpm, uint32_t ip_masked, uint8_t depth,
 	return 0;
 }
 
-/*
- * Add a route
- */
-RTE_EXPORT_SYMBOL(rte_lpm_add)
-int
-rte_lpm_add(struct rte_lpm *lpm, uint32_t ip, uint8_t depth,
+static int
+__lpm_add(struct __rte_lpm *i_lpm, uint32_t ip, uint8_t depth,
 		uint32_t next_hop)
 {
 	int32_t rule_index, status = 0;
-	struct __rte_lpm *i_lpm;
 	uint32_t ip_masked;
 
-	/* Check user arguments. */
-	if ((lpm == NULL) || (depth < 1) || (depth > RTE_LPM_MAX_DEPTH))
-		return -EINVAL;
-
-	i_lpm = container_of(lpm, struct __rte_lpm, lpm);
 	ip_masked = ip & depth_to_mask(depth);
 
 	/* Add the rule to the rule table. */
@@ -872,6 +889,112 @@ rte_lpm_add(struct rte_lpm *lpm, uint32_t ip, uint8_t depth,
 	return 0;
 }
 
+/*
+ * Add a route
+ */
+RTE_EXPORT_SYMBOL(rte_lpm_add)
+int
+rte_lpm_add(struct rte_lpm *lpm, uint32_t ip, uint8_t depth,
+		uint32_t next_hop)
+{
+	/* Check user arguments. */
+	if ((lpm == NULL) || (depth < 1) || (depth > RTE_LPM_MAX_DEPTH))
+		return -EINVAL;
+
+	return __lpm_add(container_of(lpm, struct __rte_lpm, lpm), ip, depth,
+			next_hop);
+}
+
+/*
+ * Build a permutation of the route indexes ordered by prefix length using
+ * a counting sort over the depths.
+ */
+static uint32_t *
+bulk_sort_routes(const struct rte_lpm_route *routes, uint32_t n,
+		bool ascending)
+{
+	uint32_t depth_count[RTE_LPM_MAX_DEPTH + 1] = {0};
+	uint32_t *order;
+	uint32_t i, pos;
+	uint8_t depth;
+
+	order = rte_malloc(NULL, n * sizeof(uint32_t), 0);
+	if (order == NULL)
+		return NULL;
+
+	for (i = 0; i < n; i++)
+		depth_count[routes[i].depth]++;
+
+	pos = 0;
+	if (ascending) {
+		for (depth = 1; depth <= RTE_LPM_MAX_DEPTH; depth++) {
+			uint32_t count = depth_count[depth];
+
+			depth_count[depth] = pos;
+			pos += count;
+		}
+	} else {
+		for (depth = RTE_LPM_MAX_DEPTH; depth >= 1; depth--) {
+			uint32_t count = depth_count[depth];
+
+			depth_count[depth] = pos;
+			pos += count;
+		}
+	}
+
+	for (i = 0; i < n; i++)
+		order[depth_count[routes[i].depth]++] = i;
+
+	return order;
+}
+
+/*
+ * Add a batch of routes, shortest prefixes first
+ */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_lpm_add_bulk, 25.07)
+int
+rte_lpm_add_bulk(struct rte_lpm *lpm, const struct rte_lpm_route *routes,
+		uint32_t n)
+{
+	struct __rte_lpm *i_lpm;
+	uint32_t *order;
+	uint32_t i;
+	int status = 0;
+
+	/* Check user arguments. */
+	if ((lpm == NULL) || (routes == NULL) || (n == 0))
+		return -EINVAL;
+
+	for (i = 0; i < n; i++)
+		if ((routes[i].depth < 1) ||
+				(routes[i].depth > RTE_LPM_MAX_DEPTH))
+			return -EINVAL;
+
+	i_lpm = container_of(lpm, struct __rte_lpm, lpm);
+
+	/*
+	 * Apply the routes in ascending prefix length order. A more specific
+	 * route then never has to rewrite entries expanded after it, so each
+	 * tbl24/tbl8 entry is written at most once per batch.
+	 */
+	order = bulk_sort_routes(routes, n, true);
+	if (order == NULL)
+		return -ENOMEM;
+
+	for (i = 0; i < n; i++) {
+		const struct rte_lpm_route *route = &routes[order[i]];
+
+		status = __lpm_add(i_lpm, route->ip, route->depth,
+				route->next_hop);
+		if (status < 0)
+			break;
+	}
+
+	rte_free(order);
+
+	return status;
+}
+
 /*
  * Look for a rule in the high-level rules table
  */
@@ -1178,26 +1301,13 @@ delete_depth_big(struct __rte_lpm *i_lpm, uint32_t ip_masked,
 	return status;
 }
 
-/*
- * Deletes a rule
- */
-RTE_EXPORT_SYMBOL(rte_lpm_delete)
-int
-rte_lpm_delete(struct rte_lpm *lpm, uint32_t ip, uint8_t depth)
+static int
+__lpm_delete(struct __rte_lpm *i_lpm, uint32_t ip, uint8_t depth)
 {
 	int32_t rule_to_delete_index, sub_rule_index;
-	struct __rte_lpm *i_lpm;
 	uint32_t ip_masked;
 	uint8_t sub_rule_depth;
-	/*
-	 * Check input arguments. Note: IP must be a positive integer of 32
-	 * bits in length therefore it need not be checked.
-	 */
-	if ((lpm == NULL) || (depth < 1) || (depth > RTE_LPM_MAX_DEPTH)) {
-		return -EINVAL;
-	}
 
-	i_lpm = container_of(lpm, struct __rte_lpm, lpm);
 	ip_masked = ip & depth_to_mask(depth);
 
 	/*
@@ -1237,6 +1347,117 @@ rte_lpm_delete(struct rte_lpm *lpm, uint32_t ip, uint8_t depth)
 	}
 }
 
+/*
+ * Deletes a rule
+ */
+RTE_EXPORT_SYMBOL(rte_lpm_delete)
+int
+rte_lpm_delete(struct rte_lpm *lpm, uint32_t ip, uint8_t depth)
+{
+	/*
+	 * Check input arguments. Note: IP must be a positive integer of 32
+	 * bits in length therefore it need not be checked.
+	 */
+	if ((lpm == NULL) || (depth < 1) || (depth > RTE_LPM_MAX_DEPTH)) {
+		return -EINVAL;
+	}
+
+	return __lpm_delete(container_of(lpm, struct __rte_lpm, lpm), ip,
+			depth);
+}
+
+/*
+ * Invalidate the tbl8 groups whose free was deferred during a bulk delete,
+ * after a single grace period has covered all of them.
+ */
+static void
+bulk_delete_flush_tbl8(struct __rte_lpm *i_lpm)
+{
+	struct rte_lpm_tbl_entry zero_tbl8_entry = {0};
+	uint32_t i;
+
+	if (i_lpm->n_deferred_tbl8_frees != 0) {
+		/* One quiescent state change covers the whole batch. */
+		rte_rcu_qsbr_synchronize(i_lpm->v, RTE_QSBR_THRID_INVALID);
+
+		for (i = 0; i < i_lpm->n_deferred_tbl8_frees; i++) {
+			struct rte_lpm_tbl_entry *tbl8_entry =
+				&i_lpm->lpm.tbl8[i_lpm->deferred_tbl8_frees[i]];
+			rte_atomic_store_explicit(&tbl8_entry->val,
+					zero_tbl8_entry.val,
+					rte_memory_order_relaxed);
+		}
+	}
+
+	rte_free(i_lpm->deferred_tbl8_frees);
+	i_lpm->deferred_tbl8_frees = NULL;
+	i_lpm->n_deferred_tbl8_frees = 0;
+}
+
+/*
+ * Delete a batch of routes, longest prefixes first
+ */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_lpm_delete_bulk, 25.07)
+int
+rte_lpm_delete_bulk(struct rte_lpm *lpm, const struct rte_lpm_route *routes,
+		uint32_t n)
+{
+	struct __rte_lpm *i_lpm;
+	uint32_t *order;
+	uint32_t i;
+	int status = 0;
+
+	/* Check user arguments. */
+	if ((lpm == NULL) || (routes == NULL) || (n == 0))
+		return -EINVAL;
+
+	for (i = 0; i < n; i++)
+		if ((routes[i].depth < 1) ||
+				(routes[i].depth > RTE_LPM_MAX_DEPTH))
+			return -EINVAL;
+
+	i_lpm = container_of(lpm, struct __rte_lpm, lpm);
+
+	/*
+	 * Delete the routes in descending prefix length order so that the
+	 * covering rules a deleted route falls back to are still present.
+	 */
+	order = bulk_sort_routes(routes, n, false);
+	if (order == NULL)
+		return -ENOMEM;
+
+	/*
+	 * In sync RCU mode defer the tbl8 group invalidations so the batch
+	 * pays for a single grace period instead of one per freed group. At
+	 * most one group is freed per deleted route. If the allocation fails
+	 * fall back to the unbatched per-route synchronization.
+	 */
+	if (i_lpm->v != NULL && i_lpm->rcu_mode == RTE_LPM_QSBR_MODE_SYNC) {
+		i_lpm->deferred_tbl8_frees = rte_malloc(NULL,
+				RTE_MIN(n, i_lpm->number_tbl8s) *
+				sizeof(uint32_t), 0);
+		i_lpm->n_deferred_tbl8_frees = 0;
+	}
+
+	for (i = 0; i < n; i++) {
+		const struct rte_lpm_route *route = &routes[order[i]];
+
+		status = __lpm_delete(i_lpm, route->ip, route->depth);
+		if (status < 0)
+			break;
+	}
+
+	if (i_lpm->deferred_tbl8_frees != NULL)
+		bulk_delete_flush_tbl8(i_lpm);
+	else if (i_lpm->dq != NULL)
+		/* Reclaim the groups queued by the batch in one call. */
+		rte_rcu_qsbr_dq_reclaim(i_lpm->dq, n, NULL, NULL, NULL);
+
+	rte_free(order);
+
+	return status;
+}
+
 /*
  * Delete all rules from the LPM table.
  */
@@ -1257,6 +1478,9 @@ rte_lpm_delete_all(struct rte_lpm *lpm)
 	memset(i_lpm->lpm.tbl8, 0, sizeof(i_lpm->lpm.tbl8[0])
 			* RTE_LPM_TBL8_GROUP_NUM_ENTRIES * i_lpm->number_tbl8s);
 
+	/* Restart the tbl8 allocation scan from the beginning. */
+	i_lpm->tbl8_alloc_hint = 0;
+
 	/* Delete all rules form the rules table. */
 	memset(i_lpm->rules_tbl, 0, sizeof(i_lpm->rules_tbl[0]) * i_lpm->max_rules);
 }
@@ -233,6 +233,39 @@ int rte_lpm_rcu_qsbr_add(struct rte_lpm *lpm, struct rte_lpm_rcu_config *cfg);
 int
 rte_lpm_add(struct rte_lpm *lpm, uint32_t ip, uint8_t depth, uint32_t next_hop);
 
+/** Single route for the bulk update API. */
+struct rte_lpm_route {
+	uint32_t ip;       /**< Network address of the route. */
+	uint32_t next_hop; /**< Next hop, unused by rte_lpm_delete_bulk(). */
+	uint8_t depth;     /**< Prefix length of the route. */
+};
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Add a batch of rules to the LPM table.
+ *
+ * The routes are applied in ascending prefix length order, so the table
+ * entry expansions are done in a single pass regardless of the order of
+ * the input array. Adding an already present rule updates its next hop,
+ * same as rte_lpm_add().
+ *
+ * @param lpm
+ *   LPM object handle
+ * @param routes
+ *   Array of routes to be added to the LPM table
+ * @param n
+ *   Number of routes in the array
+ * @return
+ *   0 on success, negative value otherwise. On failure, the routes
+ *   applied before the failing one remain in the table.
+ */
+__rte_experimental
+int
+rte_lpm_add_bulk(struct rte_lpm *lpm, const struct rte_lpm_route *routes,
+		uint32_t n);
+
 /**
  * Check if a rule is present in the LPM table,
  * and provide its next hop if it is.
@@ -267,6 +300,35 @@ uint32_t *next_hop);
 int
 rte_lpm_delete(struct rte_lpm *lpm, uint32_t ip, uint8_t depth);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Delete a batch of rules from the LPM table.
+ *
+ * The routes are removed in descending prefix length order, so covering
+ * rules are still in place when the entries of a deleted route are
+ * re-pointed at them. When the LPM table uses the RCU QSBR sync mode, a
+ * single grace period is awaited for all the tbl8 groups freed by the
+ * batch instead of one per deleted route; in defer queue mode the queued
+ * groups are reclaimed once at the end of the batch.
+ *
+ * @param lpm
+ *   LPM object handle
+ * @param routes
+ *   Array of routes to be deleted from the LPM table, the next_hop
+ *   field is ignored
+ * @param n
+ *   Number of routes in the array
+ * @return
+ *   0 on success, negative value otherwise. On failure, the routes
+ *   deleted before the failing one stay removed from the table.
+ */
+__rte_experimental
+int
+rte_lpm_delete_bulk(struct rte_lpm *lpm, const struct rte_lpm_route *routes,
+		uint32_t n);
+
 /**
  * Delete all rules from the LPM table.
  *
@@ -17,6 +17,7 @@
 #include <rte_string_fns.h>
 #include <rte_errno.h>
 #include <rte_hash.h>
+#include <rte_prefetch.h>
 #include <assert.h>
 #include <rte_jhash.h>
 #include <rte_tailq.h>
@@ -943,6 +944,9 @@ rte_lpm6_lookup(const struct rte_lpm6 *lpm, const struct rte_ipv6_addr *ip,
 	return status;
 }
 
+/* Number of lookups walked in lockstep by rte_lpm6_lookup_bulk_func() */
+#define LPM6_LOOKUP_BULK_CHUNK 8
+
 /*
  * Looks up a group of IP addresses
  */
@@ -952,9 +956,9 @@ rte_lpm6_lookup_bulk_func(const struct rte_lpm6 *lpm,
 		struct rte_ipv6_addr *ips,
 		int32_t *next_hops, unsigned int n)
 {
-	unsigned int i;
-	const struct rte_lpm6_tbl_entry *tbl;
+	const struct rte_lpm6_tbl_entry *tbl[LPM6_LOOKUP_BULK_CHUNK];
 	const struct rte_lpm6_tbl_entry *tbl_next = NULL;
+	unsigned int i, j, sz, active;
 	uint32_t tbl24_index, next_hop;
 	uint8_t first_byte;
 	int status;
@@ -963,27 +967,46 @@ rte_lpm6_lookup_bulk_func(const struct rte_lpm6 *lpm,
 	if ((lpm == NULL) || (ips == NULL) || (next_hops == NULL))
 		return -EINVAL;
 
-	for (i = 0; i < n; i++) {
-		first_byte = LOOKUP_FIRST_BYTE;
-		tbl24_index = (ips[i].a[0] << BYTES2_SIZE) |
-				(ips[i].a[1] << BYTE_SIZE) | ips[i].a[2];
+	for (i = 0; i < n; i += sz) {
+		sz = RTE_MIN(n - i, (unsigned int)LPM6_LOOKUP_BULK_CHUNK);
 
-		/* Calculate pointer to the first entry to be inspected */
-		tbl = &lpm->tbl24[tbl24_index];
+		/* Prefetch the tbl24 entry of every lane in the chunk. */
+		for (j = 0; j < sz; j++) {
+			tbl24_index = (ips[i + j].a[0] << BYTES2_SIZE) |
+					(ips[i + j].a[1] << BYTE_SIZE) |
+					ips[i + j].a[2];
+			tbl[j] = &lpm->tbl24[tbl24_index];
+			rte_prefetch0(tbl[j]);
+		}
 
+		/*
+		 * Inspect one level of every unresolved lane per pass, so
+		 * the tbl8 entry prefetched for the next level has time to
+		 * arrive in cache before it is inspected.
+		 */
+		first_byte = LOOKUP_FIRST_BYTE;
 		do {
-			/* Continue inspecting following levels
-			 * until success or failure
-			 */
-			status = lookup_step(lpm, tbl, &tbl_next, &ips[i],
-					first_byte++, &next_hop);
-			tbl = tbl_next;
-		} while (status == 1);
-
-		if (status < 0)
-			next_hops[i] = -1;
-		else
-			next_hops[i] = (int32_t)next_hop;
+			active = 0;
+			for (j = 0; j < sz; j++) {
+				if (tbl[j] == NULL)
+					continue;
+				status = lookup_step(lpm, tbl[j], &tbl_next,
+						&ips[i + j], first_byte,
+						&next_hop);
+				if (status == 1) {
+					tbl[j] = tbl_next;
+					rte_prefetch0(tbl_next);
+					active++;
+					continue;
+				}
+				if (status < 0)
+					next_hops[i + j] = -1;
+				else
+					next_hops[i + j] = (int32_t)next_hop;
+				tbl[j] = NULL;
+			}
+			first_byte++;
+		} while (active != 0);
 	}
 
 	return 0;
@@ -14,6 +14,7 @@
 #include <rte_common.h>
 #include <rte_log.h>
 #include <rte_branch_prediction.h>
+#include <rte_prefetch.h>
 #include <rte_mempool.h>
 #include <rte_mbuf.h>
 #include <rte_mbuf_pool_ops.h>
@@ -491,7 +492,7 @@ __rte_pktmbuf_free_seg_via_array(struct rte_mbuf *m,
  * Size of the array holding mbufs from the same mempool pending to be freed
  * in bulk.
  */
-#define RTE_PKTMBUF_FREE_PENDING_SZ 64
+#define RTE_PKTMBUF_FREE_PENDING_SZ 128
 
 /* Free a bulk of packet mbufs back into their original mempools. */
 RTE_EXPORT_SYMBOL(rte_pktmbuf_free_bulk)
@@ -505,10 +506,17 @@ void rte_pktmbuf_free_bulk(struct rte_mbuf **mbufs, unsigned int count)
 		if (unlikely(m == NULL))
 			continue;
 
+		/* hide the header fetch of the next packet in the burst */
+		if (idx + 1 < count && mbufs[idx + 1] != NULL)
+			rte_prefetch0(mbufs[idx + 1]);
+
 		__rte_mbuf_sanity_check(m, 1);
 
 		do {
 			m_next = m->next;
+			/* start pulling in the next segment of the chain */
+			if (m_next != NULL)
+				rte_prefetch0(m_next);
 			__rte_pktmbuf_free_seg_via_array(m,
 					pending, &nb_pending,
 					RTE_PKTMBUF_FREE_PENDING_SZ);
@@ -560,6 +568,74 @@ rte_pktmbuf_clone(struct rte_mbuf *md, struct rte_mempool *mp)
 	return mc;
 }
 
+/* Creates shallow copies of mbuf in bulk */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_pktmbuf_clone_bulk, 25.07)
+int
+rte_pktmbuf_clone_bulk(struct rte_mbuf *md, struct rte_mempool *mp,
+	struct rte_mbuf **mc, unsigned int count)
+{
+	struct rte_mbuf *mi;
+	unsigned int i;
+
+	if (unlikely(count > INT16_MAX))
+		return -EINVAL;
+	if (unlikely(count == 0))
+		return 0;
+
+	/* multi-segment sources take the segment-wise path */
+	if (unlikely(md->next != NULL)) {
+		for (i = 0; i < count; i++) {
+			mc[i] = rte_pktmbuf_clone(md, mp);
+			if (unlikely(mc[i] == NULL)) {
+				rte_pktmbuf_free_bulk(mc, i);
+				return -ENOMEM;
+			}
+		}
+		return 0;
+	}
+
+	if (unlikely(rte_pktmbuf_alloc_bulk(mp, mc, count) != 0))
+		return -ENOMEM;
+
+	/* one reference counter addition covers all the clones */
+	if (RTE_MBUF_HAS_EXTBUF(md))
+		rte_mbuf_ext_refcnt_update(md->shinfo, count);
+	else
+		rte_mbuf_refcnt_update(rte_mbuf_from_indirect(md), count);
+
+	/* same per-mbuf initialization as rte_pktmbuf_attach(),
+	 * with the reference counter update factored out above
+	 */
+	for (i = 0; i < count; i++) {
+		mi = mc[i];
+
+		if (RTE_MBUF_HAS_EXTBUF(md)) {
+			mi->ol_flags = md->ol_flags;
+			mi->shinfo = md->shinfo;
+		} else {
+			mi->priv_size = md->priv_size;
+			mi->ol_flags = md->ol_flags | RTE_MBUF_F_INDIRECT;
+		}
+
+		__rte_pktmbuf_copy_hdr(mi, md);
+
+		mi->data_off = md->data_off;
+		mi->data_len = md->data_len;
+		rte_mbuf_iova_set(mi, rte_mbuf_iova_get(md));
+		mi->buf_addr = md->buf_addr;
+		mi->buf_len = md->buf_len;
+
+		mi->next = NULL;
+		mi->pkt_len = mi->data_len;
+		mi->nb_segs = 1;
+
+		__rte_mbuf_sanity_check(mi, 1);
+	}
+	__rte_mbuf_sanity_check(md, 0);
+
+	return 0;
+}
+
 /* convert multi-segment mbuf to single mbuf */
 RTE_EXPORT_SYMBOL(__rte_pktmbuf_linearize)
 int
@@ -16,7 +16,9 @@
  * New fields and flags should fit in the "dynamic space".
  */
 
+#include <assert.h>
 #include <stdalign.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include <rte_byteorder.h>
@@ -673,6 +675,29 @@ struct __rte_cache_aligned rte_mbuf {
 	uint32_t dynfield1[9]; /**< Reserved for dynamic fields. */
 };
 
+/*
+ * The layout of the first cache line is part of the fast path contract:
+ * every field needed to receive, forward and free a non-segmented packet
+ * must stay within it, and vector PMDs additionally rely on the position
+ * of the rearm/descriptor field groups. Enforce this at build time so a
+ * field addition cannot silently push the hot set into the second cache
+ * line. When the build is configured to use only virtual addresses as
+ * IOVA (RTE_IOVA_IN_MBUF is 0), the next pointer moves up as well and
+ * even segmented packets can be forwarded touching one cache line only.
+ */
+static_assert(offsetof(struct rte_mbuf, rearm_data) % sizeof(uint64_t) == 0,
+	"rearm_data must be 8-byte aligned");
+static_assert(offsetof(struct rte_mbuf, pool) + sizeof(struct rte_mempool *) <=
+	RTE_CACHE_LINE_MIN_SIZE,
+	"RX fast path fields must fit into the first cache line");
+#if RTE_IOVA_IN_MBUF
+static_assert(offsetof(struct rte_mbuf, rearm_data) == 16,
+	"rearm_data must immediately follow the buffer address fields");
+#else
+static_assert(offsetof(struct rte_mbuf, next) < RTE_CACHE_LINE_MIN_SIZE,
+	"next must be in the first cache line when RTE_IOVA_IN_MBUF is 0");
+#endif
+
 /**
  * Function typedef of callback to free externally attached buffer.
  */
@@ -226,6 +226,30 @@ static int mbuf_dynfield_cmp(const struct rte_mbuf_dynfield *params1,
 	return 0;
 }
 
+/* Find the best free place for a field in [start, end): we search the
+ * lowest value of shm->free_space[offset]: the zones containing room
+ * for larger fields are kept for later. Assume tailq is locked.
+ */
+static size_t
+find_best_offset(const struct rte_mbuf_dynfield *params,
+		size_t start, size_t end)
+{
+	unsigned int best_zone = UINT_MAX;
+	size_t offset, best = SIZE_MAX;
+
+	for (offset = start; offset < end; offset++) {
+		if (offset + params->size > end)
+			break;
+		if (check_offset(offset, params->size, params->align) == 0 &&
+				shm->free_space[offset] < best_zone) {
+			best_zone = shm->free_space[offset];
+			best = offset;
+		}
+	}
+
+	return best;
+}
+
 /* assume tailq is locked */
 static int
 __rte_mbuf_dynfield_register_offset(const struct rte_mbuf_dynfield *params,
@@ -234,7 +258,6 @@ __rte_mbuf_dynfield_register_offset(const struct rte_mbuf_dynfield *params,
 	struct mbuf_dynfield_list *mbuf_dynfield_list;
 	struct mbuf_dynfield_elt *mbuf_dynfield = NULL;
 	struct rte_tailq_entry *te = NULL;
-	unsigned int best_zone = UINT_MAX;
 	size_t i, offset;
 	int ret;
 
@@ -260,19 +283,20 @@ __rte_mbuf_dynfield_register_offset(const struct rte_mbuf_dynfield *params,
 	}
 
 	if (req == SIZE_MAX) {
-		/* Find the best place to put this field: we search the
-		 * lowest value of shm->free_space[offset]: the zones
-		 * containing room for larger fields are kept for later.
-		 */
-		for (offset = 0;
-		     offset < sizeof(struct rte_mbuf);
-		     offset++) {
-			if (check_offset(offset, params->size,
-						params->align) == 0 &&
-					shm->free_space[offset] < best_zone) {
-				best_zone = shm->free_space[offset];
-				req = offset;
-			}
+		if (params->flags & RTE_MBUF_DYNFIELD_FLAG_HOT) {
+			req = find_best_offset(params, 0,
+					RTE_CACHE_LINE_MIN_SIZE);
+		} else {
+			req = find_best_offset(params,
+					RTE_CACHE_LINE_MIN_SIZE,
+					sizeof(struct rte_mbuf));
+			/* the first cache line is kept for hot fields,
+			 * only spill into it when nothing else fits.
+			 */
+			if (req == SIZE_MAX &&
+					!(params->flags & RTE_MBUF_DYNFIELD_FLAG_COLD))
+				req = find_best_offset(params, 0,
+						RTE_CACHE_LINE_MIN_SIZE);
 		}
 		if (req == SIZE_MAX) {
 			rte_errno = ENOENT;
@@ -342,10 +366,29 @@ rte_mbuf_dynfield_register_offset(const struct rte_mbuf_dynfield *params,
 		rte_errno = EINVAL;
 		return -1;
 	}
-	if (params->flags != 0) {
+	if ((params->flags & ~(RTE_MBUF_DYNFIELD_FLAG_HOT |
+			RTE_MBUF_DYNFIELD_FLAG_COLD)) != 0) {
+		rte_errno = EINVAL;
+		return -1;
+	}
+	if ((params->flags & RTE_MBUF_DYNFIELD_FLAG_HOT) &&
+			(params->flags & RTE_MBUF_DYNFIELD_FLAG_COLD)) {
 		rte_errno = EINVAL;
 		return -1;
 	}
+	if (req != SIZE_MAX) {
+		/* an explicit offset must match the placement class */
+		if ((params->flags & RTE_MBUF_DYNFIELD_FLAG_HOT) &&
+				req + params->size > RTE_CACHE_LINE_MIN_SIZE) {
+			rte_errno = EINVAL;
+			return -1;
+		}
+		if ((params->flags & RTE_MBUF_DYNFIELD_FLAG_COLD) &&
+				req < RTE_CACHE_LINE_MIN_SIZE) {
+			rte_errno = EINVAL;
+			return -1;
+		}
+	}
 
 	rte_mcfg_tailq_write_lock();
 	ret = __rte_mbuf_dynfield_register_offset(params, req);
@@ -555,10 +598,11 @@ void rte_mbuf_dyn_dump(FILE *out)
 		mbuf_dynfield_tailq.head, mbuf_dynfield_list);
 	TAILQ_FOREACH(te, mbuf_dynfield_list, next) {
 		dynfield = (struct mbuf_dynfield_elt *)te->data;
-		fprintf(out, "  name=%s offset=%zd size=%zd align=%zd flags=%x\n",
+		fprintf(out, "  name=%s offset=%zd size=%zd align=%zd flags=%x cacheline=%zu\n",
 			dynfield->params.name, dynfield->offset,
 			dynfield->params.size, dynfield->params.align,
-			dynfield->params.flags);
+			dynfield->params.flags,
+			dynfield->offset / RTE_CACHE_LINE_MIN_SIZE);
 	}
 	fprintf(out, "Reserved flags:\n");
 	mbuf_dynflag_list = RTE_TAILQ_CAST(
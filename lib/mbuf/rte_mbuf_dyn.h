@@ -27,6 +27,13 @@
  * selected in priority. Else, a specific field offset or flag bit
  * number can be requested through the API.
  *
+ * A dynamic field can additionally carry a placement class: fields
+ * registered with RTE_MBUF_DYNFIELD_FLAG_HOT are guaranteed to land in
+ * the first cache line of the mbuf (and the free bytes there are kept
+ * for them), while RTE_MBUF_DYNFIELD_FLAG_COLD fields never take
+ * first-cache-line space. This makes the placement of latency-critical
+ * fields independent of the registration order.
+ *
  * The typical use case is when a specific offload feature requires to
  * register a dedicated offload field in the mbuf structure, and adding
  * a static field or flag is not justified.
@@ -79,6 +86,33 @@ extern "C" {
  */
 #define RTE_MBUF_DYN_NAMESIZE 64
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this flag may change, or be removed, without prior notice.
+ *
+ * Place the dynamic field in the first cache line of the mbuf.
+ *
+ * The bytes of the first cache line that are not used by static mbuf
+ * fields are kept for fields registered with this flag: automatic
+ * placement of unflagged fields only spills into the first cache line
+ * when no other zone fits. The registration fails with ENOENT if no
+ * first-cache-line zone can hold the field, whatever the registration
+ * order.
+ */
+#define RTE_MBUF_DYNFIELD_FLAG_HOT (1U << 0)
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this flag may change, or be removed, without prior notice.
+ *
+ * Never place the dynamic field in the first cache line of the mbuf.
+ *
+ * Use it for fields that are not touched in the fast path, so that the
+ * first-cache-line zones stay available for fields registered with
+ * RTE_MBUF_DYNFIELD_FLAG_HOT.
+ */
+#define RTE_MBUF_DYNFIELD_FLAG_COLD (1U << 1)
+
 /**
  * Structure describing the parameters of a mbuf dynamic field.
  */
@@ -86,7 +120,7 @@ struct rte_mbuf_dynfield {
 	char name[RTE_MBUF_DYN_NAMESIZE]; /**< Name of the field. */
 	size_t size;        /**< The number of bytes to reserve. */
 	size_t align;       /**< The alignment constraint (power of 2). */
-	unsigned int flags; /**< Reserved for future use, must be 0. */
+	unsigned int flags; /**< Placement flags (RTE_MBUF_DYNFIELD_FLAG_*). */
 };
 
 /**
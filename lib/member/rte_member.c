@@ -212,6 +212,54 @@ rte_member_add(const struct rte_member_setsum *setsum, const void *key,
 	}
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_member_add_bulk, 25.07)
+int
+rte_member_add_bulk(const struct rte_member_setsum *setsum,
+			const void **keys, uint32_t num_keys,
+			const member_set_t *set_ids)
+{
+	uint32_t i;
+	int ret;
+
+	if (setsum == NULL || keys == NULL || num_keys == 0)
+		return -EINVAL;
+
+	switch (setsum->type) {
+	case RTE_MEMBER_TYPE_HT:
+	case RTE_MEMBER_TYPE_VBF:
+		if (set_ids == NULL)
+			return -EINVAL;
+		for (i = 0; i < num_keys; i++) {
+			ret = rte_member_add(setsum, keys[i], set_ids[i]);
+			if (ret < 0)
+				return ret;
+		}
+		return 0;
+	case RTE_MEMBER_TYPE_SKETCH:
+		return rte_member_add_sketch_bulk(setsum, keys, num_keys);
+	default:
+		return -EINVAL;
+	}
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_member_merge, 25.07)
+int
+rte_member_merge(const struct rte_member_setsum *setsum,
+			const struct rte_member_setsum *src)
+{
+	if (setsum == NULL || src == NULL || setsum->type != src->type)
+		return -EINVAL;
+
+	switch (setsum->type) {
+	case RTE_MEMBER_TYPE_VBF:
+		return rte_member_merge_vbf(setsum, src);
+	case RTE_MEMBER_TYPE_SKETCH:
+		return rte_member_merge_sketch(setsum, src);
+	default:
+		return -ENOTSUP;
+	}
+}
+
 RTE_EXPORT_SYMBOL(rte_member_add_byte_count)
 int
 rte_member_add_byte_count(const struct rte_member_setsum *setsum,
@@ -489,6 +489,69 @@ int
 rte_member_add(const struct rte_member_setsum *setsum, const void *key,
 			member_set_t set_id);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Insert a burst of keys into set-summary (SS).
+ *
+ * For sketch mode the whole burst is hashed before any counter is
+ * updated, which amortizes the hash computation and hides the counter
+ * cache misses; for the other modes this behaves as a loop of
+ * rte_member_add() calls.
+ *
+ * @param setsum
+ *   Pointer of a set-summary.
+ * @param keys
+ *   Array of keys to be added.
+ * @param num_keys
+ *   Number of keys in the keys array.
+ * @param set_ids
+ *   Array of set ids associated with each key, with the same semantics
+ *   as the rte_member_add() set_id parameter. Ignored in sketch mode and
+ *   may then be NULL.
+ * @return
+ *   Return -EINVAL for invalid parameters, otherwise 0. The insertion
+ *   stops at the first key that fails with the error code of that key's
+ *   rte_member_add() call.
+ */
+__rte_experimental
+int
+rte_member_add_bulk(const struct rte_member_setsum *setsum,
+			const void **keys, uint32_t num_keys,
+			const member_set_t *set_ids);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Fold one set-summary into another.
+ *
+ * For sketch mode, the counters of the source sketch are added
+ * element-wise into the destination and the source top-k candidates are
+ * re-ranked against the merged counters.
+ * For vBF mode, the source bit array is OR-ed into the destination, the
+ * natural union of bloom filters.
+ * In both cases the summaries must have been created with the same
+ * parameters (in particular the same hash seeds). The typical use is
+ * per-lcore write replicas that are folded into a shared query summary
+ * periodically to avoid cross-core write contention; the fold period
+ * bounds how stale the shared summary may be.
+ * The source set-summary is left unmodified.
+ *
+ * @param setsum
+ *   Pointer of the destination set-summary.
+ * @param src
+ *   Pointer of the source set-summary.
+ * @return
+ *   Return -EINVAL if the summaries are not identically parameterized,
+ *   -ENOTSUP for HT mode, otherwise 0.
+ */
+__rte_experimental
+int
+rte_member_merge(const struct rte_member_setsum *setsum,
+			const struct rte_member_setsum *src);
+
 /**
  * Add the packet byte size into the sketch.
  *
@@ -228,8 +228,16 @@ rte_member_create_sketch(struct rte_member_setsum *ss,
 		goto error_runtime;
 	}
 
+	/*
+	 * Derive the per-row seeds deterministically from the user supplied
+	 * seeds, so that sketches created with the same parameters hash
+	 * identically and can be folded together with rte_member_merge().
+	 */
 	for (i = 0; i < ss->num_row; i++)
-		ss->hash_seeds[i] = rte_rand();
+		ss->hash_seeds[i] = ((uint64_t)MEMBER_HASH_FUNC(&i, sizeof(i),
+					params->prim_hash_seed) << 32) |
+				MEMBER_HASH_FUNC(&i, sizeof(i),
+					params->sec_hash_seed);
 
 	if (params->extra_flag & RTE_MEMBER_SKETCH_ALWAYS_BOUNDED)
 		ss->always_bounded = 1;
@@ -515,6 +523,121 @@ rte_member_add_sketch(const struct rte_member_setsum *ss,
 	return 0;
 }
 
+/* Number of keys hashed ahead of the counter updates by the bulk add. */
+#define SKETCH_BULK_CHUNK 32
+
+/*
+ * Add a burst of packets into the sketch. The whole chunk is hashed
+ * before any counter is touched, so the counter loads are all in flight
+ * while the next key is being hashed.
+ */
+int
+rte_member_add_sketch_bulk(const struct rte_member_setsum *ss,
+			   const void **keys,
+			   uint32_t num_keys)
+{
+	struct sketch_runtime *runtime_var = ss->runtime_var;
+	uint64_t *count_array = ss->table;
+	uint32_t col[SKETCH_BULK_CHUNK][ss->num_row];
+	uint32_t base, n, i, cur_row;
+
+	/*
+	 * If sketch is measured by byte count,
+	 * the rte_member_add_sketch_byte_count routine should be used.
+	 */
+	if (ss->count_byte == 1) {
+		MEMBER_LOG(ERR, "Sketch is Byte Mode, "
+			"should use rte_member_add_byte_count()!");
+		return -EINVAL;
+	}
+
+	/*
+	 * Once sampling has started the update is stateful (the geometric
+	 * skip runs across rows and packets), so the batch cannot be
+	 * reordered; use the per-packet path instead.
+	 */
+	if (ss->sample_rate != 1 &&
+	    !(ss->always_bounded && !runtime_var->converged)) {
+		for (i = 0; i < num_keys; i++)
+			rte_member_add_sketch(ss, keys[i], 0);
+		return 0;
+	}
+
+	for (base = 0; base < num_keys; base += n) {
+		n = RTE_MIN(num_keys - base, (uint32_t)SKETCH_BULK_CHUNK);
+
+		/* hash the whole chunk first and prefetch the counters */
+		for (i = 0; i < n; i++) {
+			for (cur_row = 0; cur_row < ss->num_row; cur_row++) {
+				col[i][cur_row] = MEMBER_HASH_FUNC(
+					keys[base + i], ss->key_len,
+					ss->hash_seeds[cur_row]) % ss->num_col;
+				rte_prefetch0(&count_array[cur_row *
+					ss->num_col + col[i][cur_row]]);
+			}
+		}
+
+		for (i = 0; i < n; i++) {
+			for (cur_row = 0; cur_row < ss->num_row; cur_row++)
+				count_array[cur_row * ss->num_col +
+						col[i][cur_row]] += 1;
+
+			if (ss->always_bounded && !runtime_var->converged &&
+			    !((++runtime_var->pkt_cnt) & (INTERVAL - 1)))
+				should_converge(ss);
+		}
+
+		for (i = 0; i < n; i++)
+			heap_update(ss, keys[base + i]);
+
+		/* sampling may have kicked in mid-burst */
+		if (ss->sample_rate != 1 && runtime_var->converged) {
+			for (i = base + n; i < num_keys; i++)
+				rte_member_add_sketch(ss, keys[i], 0);
+			return 0;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Fold the counters and top-k candidates of one sketch into another.
+ * Count-min tables merge by element-wise addition, provided both sketches
+ * hash identically, i.e. were created with the same parameters.
+ */
+int
+rte_member_merge_sketch(const struct rte_member_setsum *ss,
+			const struct rte_member_setsum *src)
+{
+	struct sketch_runtime *runtime_var = ss->runtime_var;
+	struct sketch_runtime *src_runtime = src->runtime_var;
+	uint64_t *table = ss->table;
+	const uint64_t *src_table = src->table;
+	uint32_t i;
+
+	if (ss->num_row != src->num_row || ss->num_col != src->num_col ||
+	    ss->key_len != src->key_len ||
+	    ss->count_byte != src->count_byte ||
+	    memcmp(ss->hash_seeds, src->hash_seeds,
+			sizeof(uint64_t) * ss->num_row) != 0) {
+		MEMBER_LOG(ERR, "Sketch merge needs identically "
+			"parameterized sketches");
+		return -EINVAL;
+	}
+
+	for (i = 0; i < ss->num_row * ss->num_col; i++)
+		table[i] += src_table[i];
+
+	/* re-rank the source top-k candidates against the merged counters */
+	for (i = 0; i < src_runtime->heap.size; i++)
+		heap_update(ss, src_runtime->heap.elem[i].key);
+
+	runtime_var->pkt_cnt += src_runtime->pkt_cnt;
+
+	return 0;
+}
+
 /*
  * Add the byte count of the packet into the sketch.
  * Sketch value is meatured by byte count numbers in this mode.
@@ -33,6 +33,15 @@ rte_member_add_sketch(const struct rte_member_setsum *setsum,
 		      const void *key,
 		      member_set_t set_id);
 
+int
+rte_member_add_sketch_bulk(const struct rte_member_setsum *ss,
+			   const void **keys,
+			   uint32_t num_keys);
+
+int
+rte_member_merge_sketch(const struct rte_member_setsum *ss,
+			const struct rte_member_setsum *src);
+
 int
 rte_member_add_sketch_byte_count(const struct rte_member_setsum *ss,
 				 const void *key, uint32_t byte_count);
@@ -307,6 +307,35 @@ rte_member_add_vbf(const struct rte_member_setsum *ss,
 	return 0;
 }
 
+/*
+ * Fold one vBF into another. Bloom filters of identical geometry union
+ * by bit-wise OR, so per-lcore write replicas can be folded into a
+ * shared query filter without any per-bit arithmetic.
+ */
+int
+rte_member_merge_vbf(const struct rte_member_setsum *ss,
+		const struct rte_member_setsum *src)
+{
+	uint32_t *vbf = ss->table;
+	const uint32_t *src_vbf = src->table;
+	uint32_t i;
+
+	if (ss->num_set != src->num_set || ss->bits != src->bits ||
+	    ss->num_hashes != src->num_hashes ||
+	    ss->key_len != src->key_len ||
+	    ss->prim_hash_seed != src->prim_hash_seed ||
+	    ss->sec_hash_seed != src->sec_hash_seed) {
+		MEMBER_LOG(ERR, "vBF merge needs identically "
+			"parameterized vBFs");
+		return -EINVAL;
+	}
+
+	for (i = 0; i < (ss->num_set * ss->bits) >> 5; i++)
+		vbf[i] |= src_vbf[i];
+
+	return 0;
+}
+
 void
 rte_member_free_vbf(struct rte_member_setsum *ss)
 {
@@ -40,6 +40,10 @@ int
 rte_member_add_vbf(const struct rte_member_setsum *setsum,
 		const void *key, member_set_t set_id);
 
+int
+rte_member_merge_vbf(const struct rte_member_setsum *setsum,
+		const struct rte_member_setsum *src);
+
 void
 rte_member_free_vbf(struct rte_member_setsum *ss);
 
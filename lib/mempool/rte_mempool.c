@@ -24,6 +24,7 @@
 #include <rte_eal.h>
 #include <rte_eal_memconfig.h>
 #include <rte_errno.h>
+#include <rte_ptr_compress.h>
 #include <rte_string_fns.h>
 #include <rte_tailq.h>
 #include <rte_eal_paging.h>
@@ -161,10 +162,21 @@ get_min_page_size(int socket_id)
 }
 
 
+/*
+ * Context passed to mempool_add_elem() while populating a memory chunk,
+ * used to record the chunk object layout needed by
+ * rte_mempool_get_obj_by_idx().
+ */
+struct mempool_populate_ctx {
+	struct rte_mempool_memhdr *memhdr;
+	void *prev_obj;
+};
+
 static void
-mempool_add_elem(struct rte_mempool *mp, __rte_unused void *opaque,
+mempool_add_elem(struct rte_mempool *mp, void *opaque,
 		 void *obj, rte_iova_t iova)
 {
+	struct mempool_populate_ctx *ctx = opaque;
 	struct rte_mempool_objhdr *hdr;
 
 	/* set mempool ptr in header */
@@ -174,6 +186,20 @@ mempool_add_elem(struct rte_mempool *mp, __rte_unused void *opaque,
 	STAILQ_INSERT_TAIL(&mp->elt_list, hdr, next);
 	mp->populated_size++;
 
+	if (ctx != NULL) {
+		struct rte_mempool_memhdr *memhdr = ctx->memhdr;
+
+		/* track whether objects stay evenly spaced in the chunk */
+		if (memhdr->nb_objs == 0)
+			memhdr->first_obj = obj;
+		else if (obj != RTE_PTR_ADD(ctx->prev_obj,
+				mp->header_size + mp->elt_size +
+				mp->trailer_size))
+			memhdr->uniform = 0;
+		ctx->prev_obj = obj;
+		memhdr->nb_objs++;
+	}
+
 #ifdef RTE_LIBRTE_MEMPOOL_DEBUG
 	hdr->cookie = RTE_MEMPOOL_HEADER_COOKIE2;
 	rte_mempool_get_trailer(obj)->cookie = RTE_MEMPOOL_TRAILER_COOKIE;
@@ -347,6 +373,7 @@ rte_mempool_populate_iova(struct rte_mempool *mp, char *vaddr,
 	memhdr->len = len;
 	memhdr->free_cb = free_cb;
 	memhdr->opaque = opaque;
+	memhdr->uniform = 1;
 
 	if (mp->flags & RTE_MEMPOOL_F_NO_CACHE_ALIGN)
 		off = RTE_PTR_ALIGN_CEIL(vaddr, 8) - vaddr;
@@ -358,10 +385,12 @@ rte_mempool_populate_iova(struct rte_mempool *mp, char *vaddr,
 		goto fail;
 	}
 
+	struct mempool_populate_ctx ctx = { .memhdr = memhdr };
+
 	i = rte_mempool_ops_populate(mp, mp->size - mp->populated_size,
 		(char *)vaddr + off,
 		(iova == RTE_BAD_IOVA) ? RTE_BAD_IOVA : (iova + off),
-		len - off, mempool_add_elem, NULL);
+		len - off, mempool_add_elem, &ctx);
 
 	/* not enough room to store one object */
 	if (i == 0) {
@@ -388,6 +417,31 @@ fail:
 	return ret;
 }
 
+/* Return the address of an object from its index, computed from the
+ * per-chunk layout recorded at populate time.
+ */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_mempool_get_obj_by_idx, 25.07)
+void *
+rte_mempool_get_obj_by_idx(const struct rte_mempool *mp, uint32_t idx)
+{
+	struct rte_mempool_memhdr *memhdr;
+	size_t total_elt_sz;
+
+	total_elt_sz = mp->header_size + mp->elt_size + mp->trailer_size;
+
+	STAILQ_FOREACH(memhdr, &mp->mem_list, next) {
+		if (idx < memhdr->nb_objs) {
+			if (!memhdr->uniform)
+				return NULL;
+			return RTE_PTR_ADD(memhdr->first_obj,
+					(size_t)idx * total_elt_sz);
+		}
+		idx -= memhdr->nb_objs;
+	}
+
+	return NULL;
+}
+
 static rte_iova_t
 get_iova(void *addr)
 {
@@ -751,6 +805,7 @@ rte_mempool_free(struct rte_mempool *mp)
 	rte_mempool_trace_free(mp);
 	rte_mempool_free_memchunks(mp);
 	rte_mempool_ops_free(mp);
+	rte_free(mp->exchange);
 	rte_memzone_free(mp->mz);
 }
 
@@ -961,6 +1016,16 @@ rte_mempool_create_empty(const char *name, unsigned n, unsigned elt_size,
 					   cache_size);
 	}
 
+	/* Allocate the cross-lcore handoff slot on demand. */
+	if (flags & RTE_MEMPOOL_F_EXCHANGE) {
+		mp->exchange = rte_zmalloc_socket(NULL, sizeof(*mp->exchange),
+				RTE_CACHE_LINE_SIZE, socket_id);
+		if (mp->exchange == NULL) {
+			rte_errno = ENOMEM;
+			goto exit_unlock;
+		}
+	}
+
 	te->data = mp;
 
 	rte_mcfg_tailq_write_lock();
@@ -1026,6 +1091,12 @@ rte_mempool_avail_count(const struct rte_mempool *mp)
 
 	count = rte_mempool_ops_get_count(mp);
 
+	/* a batch parked in the exchange slot is still available */
+	if (mp->exchange != NULL &&
+	    rte_atomic_load_explicit(&mp->exchange->state,
+			rte_memory_order_acquire) == RTE_MEMPOOL_XCHG_FULL)
+		count += mp->exchange->len;
+
 	if (mp->cache_size == 0)
 		return count;
 
@@ -1452,6 +1523,33 @@ size_t rte_mempool_get_obj_alignment(const struct rte_mempool *mp)
 		return RTE_MEMPOOL_ALIGN;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_mempool_ptr_compress_params, 25.07)
+int rte_mempool_ptr_compress_params(const struct rte_mempool *mp,
+		void **ptr_base, uint8_t *bit_shift)
+{
+	struct rte_mempool_mem_range_info mem_range;
+	unsigned int bits_needed;
+	size_t alignment;
+	int ret;
+
+	if (ptr_base == NULL || bit_shift == NULL)
+		return -EINVAL;
+
+	ret = rte_mempool_get_mem_range(mp, &mem_range);
+	if (ret < 0)
+		return ret;
+
+	alignment = rte_mempool_get_obj_alignment(mp);
+
+	*ptr_base = mem_range.start;
+	*bit_shift = RTE_PTR_COMPRESS_BIT_SHIFT_FROM_ALIGNMENT(alignment);
+	bits_needed =
+		RTE_PTR_COMPRESS_BITS_NEEDED_FOR_POINTER_WITHIN_RANGE(mem_range.length);
+
+	/* the shift cannot drop more bits than the offsets have */
+	return bits_needed > *bit_shift ? (int)(bits_needed - *bit_shift) : 1;
+}
+
 struct mempool_callback_data {
 	TAILQ_ENTRY(mempool_callback_data) callbacks;
 	rte_mempool_event_callback *func;
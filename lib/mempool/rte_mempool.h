@@ -113,6 +113,27 @@ struct __rte_cache_aligned rte_mempool_cache {
 	alignas(RTE_CACHE_LINE_SIZE) void *objs[RTE_MEMPOOL_CACHE_MAX_SIZE * 2];
 };
 
+/** Exchange slot is free. */
+#define RTE_MEMPOOL_XCHG_EMPTY	0
+/** Exchange slot is being filled or drained. */
+#define RTE_MEMPOOL_XCHG_BUSY	1
+/** Exchange slot holds a batch. */
+#define RTE_MEMPOOL_XCHG_FULL	2
+
+/**
+ * A lock-free handoff slot used to pass spilled cache batches directly
+ * between lcore caches, bypassing the backend ring. See
+ * RTE_MEMPOOL_F_EXCHANGE.
+ */
+struct __rte_cache_aligned rte_mempool_exchange {
+	/** Slot state, RTE_MEMPOOL_XCHG_*. */
+	RTE_ATOMIC(uint32_t) state;
+	/** Number of objects in the slot. */
+	uint32_t len;
+	/** Handed-off objects. */
+	alignas(RTE_CACHE_LINE_SIZE) void *objs[RTE_MEMPOOL_CACHE_MAX_SIZE];
+};
+
 /**
  * A structure that stores the size of mempool elements.
  */
@@ -211,6 +232,12 @@ struct rte_mempool_memhdr {
 	size_t len;              /**< length of the chunk */
 	rte_mempool_memchunk_free_cb_t *free_cb; /**< Free callback */
 	void *opaque;            /**< Argument passed to the free callback */
+	void *first_obj;         /**< Address of the first object in the chunk */
+	uint32_t nb_objs;        /**< Number of objects populated in the chunk */
+	/** Non-zero if the chunk objects are evenly spaced, which allows
+	 * index based object lookup without walking the element list.
+	 */
+	uint8_t uniform;
 };
 
 /**
@@ -256,6 +283,8 @@ struct __rte_cache_aligned rte_mempool {
 	int32_t ops_index;
 
 	struct rte_mempool_cache *local_cache; /**< Per-lcore local cache */
+	/** Cross-lcore batch handoff slot, see RTE_MEMPOOL_F_EXCHANGE. */
+	struct rte_mempool_exchange *exchange;
 
 	uint32_t populated_size;         /**< Number of populated objects. */
 	struct rte_mempool_objhdr_list elt_list; /**< List of objects in pool */
@@ -310,6 +339,14 @@ struct __rte_cache_aligned rte_mempool {
 #define MEMPOOL_F_NO_IOVA_CONTIG	RTE_MEMPOOL_F_NO_IOVA_CONTIG
 /** Internal: no object from the pool can be used for device IO (DMA). */
 #define RTE_MEMPOOL_F_NON_IO		0x0040
+/**
+ * Pass spilled cache batches between lcores through a lock-free handoff
+ * slot, bypassing the backend. Helps pools where some lcores mostly free
+ * objects (their caches sit full) while others mostly allocate (their
+ * caches sit empty), e.g. separate RX and TX lcores sharing one mbuf
+ * pool.
+ */
+#define RTE_MEMPOOL_F_EXCHANGE		0x0080
 
 /**
  * This macro lists all the mempool flags an application may request.
@@ -319,6 +356,7 @@ struct __rte_cache_aligned rte_mempool {
 	| RTE_MEMPOOL_F_SP_PUT \
 	| RTE_MEMPOOL_F_SC_GET \
 	| RTE_MEMPOOL_F_NO_IOVA_CONTIG \
+	| RTE_MEMPOOL_F_EXCHANGE \
 	)
 
 /**
@@ -1270,6 +1308,29 @@ int rte_mempool_populate_anon(struct rte_mempool *mp);
 uint32_t rte_mempool_obj_iter(struct rte_mempool *mp,
 	rte_mempool_obj_cb_t *obj_cb, void *obj_cb_arg);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Get the address of a mempool object from its index.
+ *
+ * Object indexes follow the populate order: the n-th object added to
+ * the pool has index n - 1. Within each memory chunk whose objects were
+ * laid out evenly spaced (the common case with the default populate
+ * ops), the lookup is a multiply and add on the chunk base address,
+ * without dereferencing any object header.
+ *
+ * @param mp
+ *   A pointer to an initialized mempool.
+ * @param idx
+ *   Index of the object, in the [0, populated_size) range.
+ * @return
+ *   The address of the object, or NULL if the index is out of range or
+ *   the chunk holding it was populated with unevenly spaced objects.
+ */
+__rte_experimental
+void *rte_mempool_get_obj_by_idx(const struct rte_mempool *mp, uint32_t idx);
+
 /**
  * Call a function for each mempool memory chunk
  *
@@ -1370,6 +1431,69 @@ rte_mempool_cache_flush(struct rte_mempool_cache *cache,
 	cache->len = 0;
 }
 
+/**
+ * @internal Try to deposit a batch into the exchange slot.
+ * @return
+ *   Non-zero if the batch was handed off, 0 if the slot was occupied.
+ */
+static __rte_always_inline int
+__rte_mempool_xchg_put(struct rte_mempool_exchange *xchg,
+		void * const *obj_table, unsigned int n)
+{
+	uint32_t state = RTE_MEMPOOL_XCHG_EMPTY;
+
+	if (n > RTE_MEMPOOL_CACHE_MAX_SIZE)
+		return 0;
+	if (rte_atomic_load_explicit(&xchg->state,
+			rte_memory_order_relaxed) != RTE_MEMPOOL_XCHG_EMPTY)
+		return 0;
+	if (!rte_atomic_compare_exchange_strong_explicit(&xchg->state, &state,
+			RTE_MEMPOOL_XCHG_BUSY, rte_memory_order_acquire,
+			rte_memory_order_relaxed))
+		return 0;
+
+	rte_memcpy(xchg->objs, obj_table, sizeof(void *) * n);
+	xchg->len = n;
+	rte_atomic_store_explicit(&xchg->state, RTE_MEMPOOL_XCHG_FULL,
+			rte_memory_order_release);
+	return 1;
+}
+
+/**
+ * @internal Try to take the batch held in the exchange slot.
+ * Takes all-or-nothing: the slot is left untouched if it holds more
+ * than *max* objects.
+ * @return
+ *   The number of objects copied to obj_table, 0 if nothing was taken.
+ */
+static __rte_always_inline unsigned int
+__rte_mempool_xchg_get(struct rte_mempool_exchange *xchg, void **obj_table,
+		unsigned int max)
+{
+	uint32_t state = RTE_MEMPOOL_XCHG_FULL;
+	unsigned int n;
+
+	if (rte_atomic_load_explicit(&xchg->state,
+			rte_memory_order_relaxed) != RTE_MEMPOOL_XCHG_FULL)
+		return 0;
+	if (!rte_atomic_compare_exchange_strong_explicit(&xchg->state, &state,
+			RTE_MEMPOOL_XCHG_BUSY, rte_memory_order_acquire,
+			rte_memory_order_relaxed))
+		return 0;
+
+	n = xchg->len;
+	if (n > max) {
+		/* batch too big for the caller, put it back */
+		rte_atomic_store_explicit(&xchg->state, RTE_MEMPOOL_XCHG_FULL,
+				rte_memory_order_release);
+		return 0;
+	}
+	rte_memcpy(obj_table, xchg->objs, sizeof(void *) * n);
+	rte_atomic_store_explicit(&xchg->state, RTE_MEMPOOL_XCHG_EMPTY,
+			rte_memory_order_release);
+	return n;
+}
+
 /**
  * @internal Put several objects back in the mempool; used internally.
  * @param mp
@@ -1403,6 +1527,28 @@ rte_mempool_do_generic_put(struct rte_mempool *mp, void * const *obj_table,
 		/* Sufficient room in the cache for the objects. */
 		cache_objs = &cache->objs[cache->len];
 		cache->len += n;
+	} else if (n <= cache->size) {
+		/*
+		 * The cache ran over its flush threshold. Spill only the
+		 * excess above the nominal cache size to the backend, not the
+		 * whole cache: spilling everything (up to 1.5 * size objects)
+		 * in one synchronous call causes a latency spike in the
+		 * packet path, while spilling ~n objects per overflowing put
+		 * amortizes the same work over subsequent puts.
+		 * The objects are taken from the top of the cache, so no
+		 * compaction of the remaining entries is needed.
+		 */
+		uint32_t spill = cache->len + n - cache->size;
+
+		cache->len -= spill;
+		/* offer the batch to a starving lcore before the backend */
+		if (mp->exchange == NULL ||
+				!__rte_mempool_xchg_put(mp->exchange,
+					&cache->objs[cache->len], spill))
+			rte_mempool_ops_enqueue_bulk(mp,
+					&cache->objs[cache->len], spill);
+		cache_objs = &cache->objs[cache->len];
+		cache->len += n;
 	} else if (n <= cache->flushthresh) {
 		/*
 		 * The cache is big enough for the objects, but - as detected by
@@ -1576,15 +1722,31 @@ rte_mempool_do_generic_get(struct rte_mempool *mp, void **obj_table,
 	if (unlikely(remaining > RTE_MEMPOOL_CACHE_MAX_SIZE))
 		goto driver_dequeue;
 
+	/*
+	 * Grab a batch handed off by an overflowing lcore, if any. Only
+	 * attempted when the cache was fully drained (len == 0 above), so a
+	 * backend failure below cannot clobber entries that the rollback in
+	 * driver_dequeue needs intact.
+	 */
+	index = 0;
+	if (mp->exchange != NULL && len == 0)
+		index = __rte_mempool_xchg_get(mp->exchange, cache->objs,
+				cache->size + remaining);
+
 	/* Fill the cache from the backend; fetch size + remaining objects. */
-	ret = rte_mempool_ops_dequeue_bulk(mp, cache->objs,
-			cache->size + remaining);
+	if (index != cache->size + remaining)
+		ret = rte_mempool_ops_dequeue_bulk(mp, &cache->objs[index],
+				cache->size + remaining - index);
+	else
+		ret = 0;
 	if (unlikely(ret < 0)) {
 		/*
 		 * We are buffer constrained, and not able to fetch all that.
 		 * Do not fill the cache, just satisfy the remaining part of
-		 * the request directly from the backend.
+		 * the request directly from the backend, keeping the objects
+		 * taken from the exchange slot in the cache.
 		 */
+		cache->len = index;
 		goto driver_dequeue;
 	}
 
@@ -1609,11 +1771,12 @@ driver_dequeue:
 
 	if (unlikely(ret < 0)) {
 		if (likely(cache != NULL)) {
-			cache->len = n - remaining;
+			cache->len += n - remaining;
 			/*
 			 * No further action is required to roll the first part
 			 * of the request back into the cache, as objects in
-			 * the cache are intact.
+			 * the cache (including any batch taken from the
+			 * exchange slot above) are intact.
 			 */
 		}
 
@@ -1977,6 +2140,32 @@ __rte_experimental
 size_t
 rte_mempool_get_obj_alignment(const struct rte_mempool *mp);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Derive the pointer compression parameters covering all objects of
+ * the mempool, for use with the rte_ptr_compress_*_shift() family of
+ * functions (see rte_ptr_compress.h).
+ *
+ * @param[in] mp
+ *   Pointer to an initialized mempool.
+ * @param[out] ptr_base
+ *   Pointer to be used as the base for calculating offsets.
+ * @param[out] bit_shift
+ *   Number of bits that may be dropped from the offsets thanks to
+ *   the alignment of the mempool objects.
+ * @return
+ *   The number of bits needed to store the shifted offset of any object
+ *   in the mempool (e.g. a value of at most 16 means 16-bit compression
+ *   can be used), or -EINVAL if mempool is not valid or not populated
+ *   or an output pointer is NULL.
+ **/
+__rte_experimental
+int
+rte_mempool_ptr_compress_params(const struct rte_mempool *mp,
+	void **ptr_base, uint8_t *bit_shift);
+
 /**
  * @internal Get page size used for mempool object allocation.
  * This function is internal to mempool library and mempool drivers.
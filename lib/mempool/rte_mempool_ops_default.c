@@ -90,6 +90,13 @@ check_obj_bounds(char *obj, size_t pg_sz, size_t elt_sz)
 	return 0;
 }
 
+/* Number of objects enqueued to the backend in one call while
+ * populating. Enqueuing one object at a time made populating (and thus
+ * restarting applications with multi-gigabyte pools) pay the backend
+ * enqueue overhead once per object.
+ */
+#define MEMPOOL_POPULATE_BATCH_SIZE 64
+
 RTE_EXPORT_SYMBOL(rte_mempool_op_populate_helper)
 int
 rte_mempool_op_populate_helper(struct rte_mempool *mp, unsigned int flags,
@@ -100,7 +107,8 @@ rte_mempool_op_populate_helper(struct rte_mempool *mp, unsigned int flags,
 	char *va = vaddr;
 	size_t total_elt_sz, pg_sz;
 	size_t off;
-	unsigned int i;
+	unsigned int i, nb_batch;
+	void *objs[MEMPOOL_POPULATE_BATCH_SIZE];
 	void *obj;
 	int ret;
 
@@ -114,6 +122,7 @@ rte_mempool_op_populate_helper(struct rte_mempool *mp, unsigned int flags,
 		off = total_elt_sz - (((uintptr_t)(va - 1) % total_elt_sz) + 1);
 	else
 		off = 0;
+	nb_batch = 0;
 	for (i = 0; i < max_objs; i++) {
 		/* avoid objects to cross page boundaries */
 		if (check_obj_bounds(va + off, pg_sz, total_elt_sz) < 0) {
@@ -131,9 +140,15 @@ rte_mempool_op_populate_helper(struct rte_mempool *mp, unsigned int flags,
 		obj = va + off;
 		obj_cb(mp, obj_cb_arg, obj,
 		       (iova == RTE_BAD_IOVA) ? RTE_BAD_IOVA : (iova + off));
-		rte_mempool_ops_enqueue_bulk(mp, &obj, 1);
+		objs[nb_batch++] = obj;
+		if (nb_batch == MEMPOOL_POPULATE_BATCH_SIZE) {
+			rte_mempool_ops_enqueue_bulk(mp, objs, nb_batch);
+			nb_batch = 0;
+		}
 		off += mp->elt_size + mp->trailer_size;
 	}
+	if (nb_batch != 0)
+		rte_mempool_ops_enqueue_bulk(mp, objs, nb_batch);
 
 	return i;
 }
@@ -18,6 +18,8 @@
 
 #include <stdint.h>
 
+#include <rte_compat.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -200,6 +202,39 @@ rte_meter_srtcm_color_blind_check(struct rte_meter_srtcm *m,
 	uint64_t time,
 	uint32_t pkt_len);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * srTCM color blind traffic metering for a burst of packets. Functionally
+ * equivalent to calling rte_meter_srtcm_color_blind_check() once per packet
+ * with the same time stamp for all packets of the burst, but the token
+ * buckets are brought up to date only once, so the cost of reading the time
+ * and of the bucket update arithmetic is paid per burst instead of per
+ * packet.
+ *
+ * @param m
+ *    Handle to srTCM instance
+ * @param p
+ *    srTCM profile specified at srTCM object creation time
+ * @param time
+ *    Current CPU time stamp (measured in CPU cycles)
+ * @param pkt_len
+ *    Array of lengths of the IP packets of the burst (measured in bytes)
+ * @param pkt_color
+ *    Output array of colors assigned to the packets of the burst
+ * @param n_pkts
+ *    Number of packets in the burst
+ */
+__rte_experimental
+static inline void
+rte_meter_srtcm_color_blind_check_bulk(struct rte_meter_srtcm *m,
+	struct rte_meter_srtcm_profile *p,
+	uint64_t time,
+	const uint32_t *pkt_len,
+	enum rte_color *pkt_color,
+	uint32_t n_pkts);
+
 /**
  * srTCM color aware traffic metering
  *
@@ -243,6 +278,39 @@ rte_meter_trtcm_color_blind_check(struct rte_meter_trtcm *m,
 	uint64_t time,
 	uint32_t pkt_len);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * trTCM color blind traffic metering for a burst of packets. Functionally
+ * equivalent to calling rte_meter_trtcm_color_blind_check() once per packet
+ * with the same time stamp for all packets of the burst, but the token
+ * buckets are brought up to date only once, so the cost of reading the time
+ * and of the bucket update arithmetic is paid per burst instead of per
+ * packet.
+ *
+ * @param m
+ *    Handle to trTCM instance
+ * @param p
+ *    trTCM profile specified at trTCM object creation time
+ * @param time
+ *    Current CPU time stamp (measured in CPU cycles)
+ * @param pkt_len
+ *    Array of lengths of the IP packets of the burst (measured in bytes)
+ * @param pkt_color
+ *    Output array of colors assigned to the packets of the burst
+ * @param n_pkts
+ *    Number of packets in the burst
+ */
+__rte_experimental
+static inline void
+rte_meter_trtcm_color_blind_check_bulk(struct rte_meter_trtcm *m,
+	struct rte_meter_trtcm_profile *p,
+	uint64_t time,
+	const uint32_t *pkt_len,
+	enum rte_color *pkt_color,
+	uint32_t n_pkts);
+
 /**
  * trTCM color aware traffic metering
  *
@@ -434,6 +502,49 @@ rte_meter_srtcm_color_blind_check(struct rte_meter_srtcm *m,
 	return RTE_COLOR_RED;
 }
 
+__rte_experimental
+static inline void
+rte_meter_srtcm_color_blind_check_bulk(struct rte_meter_srtcm *m,
+	struct rte_meter_srtcm_profile *p,
+	uint64_t time,
+	const uint32_t *pkt_len,
+	enum rte_color *pkt_color,
+	uint32_t n_pkts)
+{
+	uint64_t time_diff, n_periods, tc, te;
+	uint32_t i;
+
+	/* Bucket update, once for the entire burst */
+	time_diff = time - m->time;
+	n_periods = time_diff / p->cir_period;
+	m->time += n_periods * p->cir_period;
+
+	/* Put the tokens overflowing from tc into te bucket */
+	tc = m->tc + n_periods * p->cir_bytes_per_period;
+	te = m->te;
+	if (tc > p->cbs) {
+		te += (tc - p->cbs);
+		if (te > p->ebs)
+			te = p->ebs;
+		tc = p->cbs;
+	}
+
+	/* Color logic */
+	for (i = 0; i < n_pkts; i++) {
+		if (tc >= pkt_len[i]) {
+			tc -= pkt_len[i];
+			pkt_color[i] = RTE_COLOR_GREEN;
+		} else if (te >= pkt_len[i]) {
+			te -= pkt_len[i];
+			pkt_color[i] = RTE_COLOR_YELLOW;
+		} else
+			pkt_color[i] = RTE_COLOR_RED;
+	}
+
+	m->tc = tc;
+	m->te = te;
+}
+
 static inline enum rte_color
 rte_meter_srtcm_color_aware_check(struct rte_meter_srtcm *m,
 	struct rte_meter_srtcm_profile *p,
@@ -518,6 +629,52 @@ rte_meter_trtcm_color_blind_check(struct rte_meter_trtcm *m,
 	return RTE_COLOR_GREEN;
 }
 
+__rte_experimental
+static inline void
+rte_meter_trtcm_color_blind_check_bulk(struct rte_meter_trtcm *m,
+	struct rte_meter_trtcm_profile *p,
+	uint64_t time,
+	const uint32_t *pkt_len,
+	enum rte_color *pkt_color,
+	uint32_t n_pkts)
+{
+	uint64_t time_diff_tc, time_diff_tp, n_periods_tc, n_periods_tp, tc, tp;
+	uint32_t i;
+
+	/* Bucket update, once for the entire burst */
+	time_diff_tc = time - m->time_tc;
+	time_diff_tp = time - m->time_tp;
+	n_periods_tc = time_diff_tc / p->cir_period;
+	n_periods_tp = time_diff_tp / p->pir_period;
+	m->time_tc += n_periods_tc * p->cir_period;
+	m->time_tp += n_periods_tp * p->pir_period;
+
+	tc = m->tc + n_periods_tc * p->cir_bytes_per_period;
+	if (tc > p->cbs)
+		tc = p->cbs;
+
+	tp = m->tp + n_periods_tp * p->pir_bytes_per_period;
+	if (tp > p->pbs)
+		tp = p->pbs;
+
+	/* Color logic */
+	for (i = 0; i < n_pkts; i++) {
+		if (tp < pkt_len[i]) {
+			pkt_color[i] = RTE_COLOR_RED;
+		} else if (tc < pkt_len[i]) {
+			tp -= pkt_len[i];
+			pkt_color[i] = RTE_COLOR_YELLOW;
+		} else {
+			tc -= pkt_len[i];
+			tp -= pkt_len[i];
+			pkt_color[i] = RTE_COLOR_GREEN;
+		}
+	}
+
+	m->tc = tc;
+	m->tp = tp;
+}
+
 static inline enum rte_color
 rte_meter_trtcm_color_aware_check(struct rte_meter_trtcm *m,
 	struct rte_meter_trtcm_profile *p,
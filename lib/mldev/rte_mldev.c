@@ -22,6 +22,10 @@ static struct rte_ml_dev_global ml_dev_globals = {
 struct rte_ml_op_pool_private {
 	uint16_t user_size;
 	/*< Size of private user data with each operation. */
+	uint32_t staging_size;
+	/*< Size of the staging buffer with each operation, 0 if none. */
+	uint32_t staging_off;
+	/*< Offset of the staging buffer from the start of the operation. */
 };
 
 RTE_EXPORT_INTERNAL_SYMBOL(rte_ml_dev_pmd_get_dev)
@@ -846,6 +850,66 @@ rte_ml_op_pool_create(const char *name, unsigned int nb_elts, unsigned int cache
 	return mp;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_ml_op_pool_create_staging, 25.07)
+struct rte_mempool *
+rte_ml_op_pool_create_staging(const char *name, unsigned int nb_elts, unsigned int cache_size,
+			      uint16_t user_size, uint32_t staging_size, int socket_id)
+{
+	struct rte_ml_op_pool_private *priv;
+	struct rte_mempool *mp;
+	unsigned int staging_off;
+	unsigned int elt_size;
+
+	/* Staging area is a quantized input target, keep it cache aligned. */
+	staging_off = RTE_ALIGN_CEIL(sizeof(struct rte_ml_op) + user_size, RTE_CACHE_LINE_SIZE);
+	elt_size = staging_off + staging_size;
+
+	/* lookup mempool in case already allocated */
+	mp = rte_mempool_lookup(name);
+	if (mp != NULL) {
+		priv = (struct rte_ml_op_pool_private *)rte_mempool_get_priv(mp);
+		if (mp->elt_size != elt_size || mp->cache_size < cache_size || mp->size < nb_elts ||
+		    priv->user_size < user_size || priv->staging_size < staging_size) {
+			RTE_MLDEV_LOG(ERR,
+				      "Mempool %s already exists but with incompatible parameters",
+				      name);
+			return NULL;
+		}
+		return mp;
+	}
+
+	mp = rte_mempool_create(name, nb_elts, elt_size, cache_size,
+				sizeof(struct rte_ml_op_pool_private), NULL, NULL, ml_op_init, NULL,
+				socket_id, 0);
+	if (mp == NULL) {
+		RTE_MLDEV_LOG(ERR, "Failed to create mempool %s", name);
+		return NULL;
+	}
+
+	priv = (struct rte_ml_op_pool_private *)rte_mempool_get_priv(mp);
+	priv->user_size = user_size;
+	priv->staging_size = staging_size;
+	priv->staging_off = staging_off;
+
+	return mp;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_ml_op_staging_addr, 25.07)
+void *
+rte_ml_op_staging_addr(struct rte_ml_op *op)
+{
+	struct rte_ml_op_pool_private *priv;
+
+	if (op == NULL || op->mempool == NULL)
+		return NULL;
+
+	priv = (struct rte_ml_op_pool_private *)rte_mempool_get_priv(op->mempool);
+	if (priv->staging_size == 0)
+		return NULL;
+
+	return (char *)op + priv->staging_off;
+}
+
 RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_ml_op_pool_free, 22.11)
 void
 rte_ml_op_pool_free(struct rte_mempool *mempool)
@@ -890,6 +954,63 @@ rte_ml_enqueue_burst(int16_t dev_id, uint16_t qp_id, struct rte_ml_op **ops, uin
 	return dev->enqueue_burst(dev, qp_id, ops, nb_ops);
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_ml_enqueue_burst_quantize, 25.07)
+uint16_t
+rte_ml_enqueue_burst_quantize(int16_t dev_id, uint16_t qp_id, uint16_t model_id,
+			      struct rte_ml_op **ops, struct rte_ml_buff_seg ***dbuffers,
+			      uint16_t nb_ops)
+{
+	struct rte_ml_dev *dev;
+	uint16_t i;
+
+#ifdef RTE_LIBRTE_ML_DEV_DEBUG
+	if (!rte_ml_dev_is_valid_dev(dev_id)) {
+		RTE_MLDEV_LOG(ERR, "Invalid dev_id = %d", dev_id);
+		rte_errno = -EINVAL;
+		return 0;
+	}
+
+	dev = rte_ml_dev_pmd_get_dev(dev_id);
+	if (dev->enqueue_burst == NULL) {
+		rte_errno = -ENOTSUP;
+		return 0;
+	}
+
+	if (ops == NULL || dbuffers == NULL) {
+		RTE_MLDEV_LOG(ERR, "Dev %d, ops and dbuffers cannot be NULL", dev_id);
+		rte_errno = -EINVAL;
+		return 0;
+	}
+
+	if (qp_id >= dev->data->nb_queue_pairs) {
+		RTE_MLDEV_LOG(ERR, "Invalid qp_id %u", qp_id);
+		rte_errno = -EINVAL;
+		return 0;
+	}
+#else
+	dev = rte_ml_dev_pmd_get_dev(dev_id);
+#endif
+
+	if (dev->dev_ops->io_quantize == NULL) {
+		rte_errno = -ENOTSUP;
+		return 0;
+	}
+
+	/* Quantize each input straight into the input segments of its op,
+	 * which the enqueue consumes in place: one pass over the input data
+	 * instead of a quantize pass followed by a staging copy.
+	 */
+	for (i = 0; i < nb_ops; i++) {
+		if (dev->dev_ops->io_quantize(dev, model_id, dbuffers[i], ops[i]->input) != 0)
+			break;
+	}
+
+	if (i == 0)
+		return 0;
+
+	return dev->enqueue_burst(dev, qp_id, ops, i);
+}
+
 RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_ml_dequeue_burst, 22.11)
 uint16_t
 rte_ml_dequeue_burst(int16_t dev_id, uint16_t qp_id, struct rte_ml_op **ops, uint16_t nb_ops)
@@ -520,6 +520,49 @@ __rte_experimental
 uint16_t
 rte_ml_enqueue_burst(int16_t dev_id, uint16_t qp_id, struct rte_ml_op **ops, uint16_t nb_ops);
 
+/**
+ * Quantize input data and enqueue a burst of ML inferences in one pass.
+ *
+ * For each operation, the dequantized input in *dbuffers* is quantized directly
+ * into the input segments of the operation, which the enqueue then consumes in
+ * place. Compared to a separate rte_ml_io_quantize() pass into an intermediate
+ * buffer followed by rte_ml_enqueue_burst(), the input data is read once instead
+ * of twice, which matters for models whose cost is dominated by input movement.
+ *
+ * The input segments of each operation must point to memory the device can
+ * consume, such as the staging area carried by operations allocated from a pool
+ * created with rte_ml_op_pool_create_staging().
+ *
+ * As the enqueue is asynchronous, quantization of the next burst overlaps with
+ * inference of the burst in flight when the caller alternates between two sets
+ * of operations.
+ *
+ * @param dev_id
+ *   The identifier of the device.
+ * @param qp_id
+ *   The index of the queue pair which inferences are to be enqueued for processing.
+ * The value must be in the range [0, nb_queue_pairs - 1] previously supplied to
+ * *rte_ml_dev_configure*.
+ * @param model_id
+ *   Identifier for the model to quantize for.
+ * @param ops
+ *   The address of an array of *nb_ops* pointers to *rte_ml_op* structures which contain the
+ * ML inferences to be processed.
+ * @param dbuffers
+ *   The address of an array of *nb_ops* dequantized input buffers, one per operation.
+ * @param nb_ops
+ *   The number of operations to process.
+ *
+ * @return
+ *   The number of inference operations actually quantized and enqueued to the ML device.
+ * Operations past the first quantization failure are not enqueued.
+ */
+__rte_experimental
+uint16_t
+rte_ml_enqueue_burst_quantize(int16_t dev_id, uint16_t qp_id, uint16_t model_id,
+			      struct rte_ml_op **ops, struct rte_ml_buff_seg ***dbuffers,
+			      uint16_t nb_ops);
+
 /**
  * Dequeue a burst of processed ML inferences operations from a queue on the ML device.
  * The dequeued operations are stored in *rte_ml_op* structures whose pointers are supplied
@@ -1566,6 +1609,50 @@ struct rte_mempool *
 rte_ml_op_pool_create(const char *name, unsigned int nb_elts, unsigned int cache_size,
 		      uint16_t user_size, int socket_id);
 
+/**
+ * Create an ML operation pool whose elements carry a staging buffer
+ *
+ * Each operation is followed by a cache line aligned staging area of
+ * *staging_size* bytes, retrievable with rte_ml_op_staging_addr(). The area is
+ * intended as the quantized input target of rte_ml_enqueue_burst_quantize(),
+ * so the staging buffer lives and travels with the operation itself.
+ *
+ * @param name
+ *   ML operations pool name
+ * @param nb_elts
+ *   Number of elements in pool
+ * @param cache_size
+ *   Number of elements to cache on lcore, see
+ *   *rte_mempool_create* for further details about cache size
+ * @param user_size
+ *   Size of private data to allocate for user with each operation
+ * @param staging_size
+ *   Size of the staging buffer to allocate with each operation
+ * @param socket_id
+ *   Socket to identifier allocate memory on
+ * @return
+ *  - On success pointer to mempool
+ *  - On failure NULL
+ */
+__rte_experimental
+struct rte_mempool *
+rte_ml_op_pool_create_staging(const char *name, unsigned int nb_elts, unsigned int cache_size,
+			      uint16_t user_size, uint32_t staging_size, int socket_id);
+
+/**
+ * Get the address of the staging buffer of an ML operation
+ *
+ * @param op
+ *   Operation allocated from a pool created with rte_ml_op_pool_create_staging().
+ *
+ * @return
+ *  - Address of the staging buffer of the operation
+ *  - NULL if the pool of the operation carries no staging buffers
+ */
+__rte_experimental
+void *
+rte_ml_op_staging_addr(struct rte_ml_op *op);
+
 /**
  * Free an ML operation pool
  *
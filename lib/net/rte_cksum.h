@@ -99,6 +99,66 @@ rte_raw_cksum(const void *buf, size_t len)
 	return __rte_raw_cksum_reduce(sum);
 }
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Compute the checksum delta between an old and a new version of a data
+ * range, for incremental checksum update as per RFC 1624.
+ *
+ * Both buffers must start at the same (even or odd) offset within the
+ * checksummed data.
+ *
+ * @param old_data
+ *   Pointer to the data being replaced.
+ * @param new_data
+ *   Pointer to the replacement data.
+ * @param len
+ *   Length of the data ranges.
+ * @return
+ *   The folded checksum delta, to be passed to rte_cksum_update().
+ */
+__rte_experimental
+static inline uint16_t
+rte_cksum_delta(const void *old_data, const void *new_data, size_t len)
+{
+	uint32_t sum;
+
+	/* in one's complement arithmetic the sum of ~m equals ~sum(m) */
+	sum = (uint16_t)~__rte_raw_cksum_reduce(__rte_raw_cksum(old_data, len, 0));
+	sum += __rte_raw_cksum_reduce(__rte_raw_cksum(new_data, len, 0));
+
+	return __rte_raw_cksum_reduce(sum);
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Incrementally update a complemented checksum (as stored in a protocol
+ * header) after part of the checksummed data was rewritten.
+ * Implements equation 3 of RFC 1624, which is safe with regard to the
+ * +0/-0 ambiguity of one's complement arithmetic.
+ *
+ * @param cksum
+ *   The current complemented checksum.
+ * @param delta
+ *   The checksum delta returned by rte_cksum_delta().
+ * @return
+ *   The updated complemented checksum.
+ */
+__rte_experimental
+static inline uint16_t
+rte_cksum_update(uint16_t cksum, uint16_t delta)
+{
+	uint32_t sum;
+
+	sum = (uint16_t)~cksum;
+	sum += delta;
+
+	return (uint16_t)~__rte_raw_cksum_reduce(sum);
+}
+
 /**
  * Compute the raw (non complemented) checksum of a packet.
  *
@@ -163,6 +163,53 @@ rte_ipv4_cksum(const struct rte_ipv4_hdr *ipv4_hdr)
 	return (uint16_t)~cksum;
 }
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Incrementally update the checksum of an IPv4 header after some of its
+ * fields were rewritten, e.g. after address rewrite by a NAT stage.
+ *
+ * @param ipv4_hdr
+ *   The pointer to the contiguous IPv4 header, with hdr_checksum still
+ *   holding the value matching the old field contents.
+ * @param delta
+ *   The checksum delta of the rewritten fields, see rte_cksum_delta().
+ */
+__rte_experimental
+static inline void
+rte_ipv4_cksum_update(struct rte_ipv4_hdr *ipv4_hdr, uint16_t delta)
+{
+	ipv4_hdr->hdr_checksum = rte_cksum_update(ipv4_hdr->hdr_checksum, delta);
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Process the IPv4 checksums of a burst of IPv4 headers.
+ *
+ * The checksum fields must be set to 0 by the caller.
+ *
+ * @param ipv4_hdrs
+ *   Array of pointers to contiguous IPv4 headers.
+ * @param cksums
+ *   Array of complemented checksums filled by this function, one per
+ *   header, to be set in the IP packets.
+ * @param nb
+ *   Number of headers in the burst.
+ */
+__rte_experimental
+static inline void
+rte_ipv4_cksum_burst(const struct rte_ipv4_hdr *const ipv4_hdrs[],
+		uint16_t cksums[], uint16_t nb)
+{
+	uint16_t i;
+
+	for (i = 0; i != nb; i++)
+		cksums[i] = rte_ipv4_cksum(ipv4_hdrs[i]);
+}
+
 /**
  * @warning
  * @b EXPERIMENTAL: this API may change without prior notice.
@@ -20,6 +20,7 @@
 #include <rte_gtp.h>
 #include <rte_net.h>
 #include <rte_os_shim.h>
+#include <rte_prefetch.h>
 
 /* get l3 packet type from ip6 next protocol */
 static uint32_t
@@ -605,3 +606,64 @@ l3:
 
 	return pkt_type;
 }
+
+/* parse a burst of mbufs, fast-pathing plain Ether/IPv4/TCP|UDP frames */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_net_get_ptype_bulk, 25.07)
+uint32_t rte_net_get_ptype_bulk(struct rte_mbuf *const pkts[],
+	uint32_t ptypes[], uint16_t nb_pkts, uint32_t layers)
+{
+	const uint32_t fast_layers = (layers & RTE_PTYPE_L2_MASK) != 0 &&
+		(layers & RTE_PTYPE_L3_MASK) != 0 &&
+		(layers & RTE_PTYPE_L4_MASK) != 0;
+	const uint32_t min_len = sizeof(struct rte_ether_hdr) +
+		sizeof(struct rte_ipv4_hdr) + sizeof(struct rte_tcp_hdr);
+	uint32_t common = RTE_PTYPE_ALL_MASK;
+	uint16_t i;
+
+	if (nb_pkts == 0)
+		return 0;
+
+	for (i = 0; i != nb_pkts; i++) {
+		const struct rte_mbuf *m = pkts[i];
+
+		/* stay ahead of the serial dependent header loads */
+		if (i + 3 < nb_pkts)
+			rte_prefetch0(rte_pktmbuf_mtod(pkts[i + 3], void *));
+
+		if (likely(fast_layers && m->data_len >= min_len)) {
+			const struct rte_ether_hdr *eh =
+				rte_pktmbuf_mtod(m, const struct rte_ether_hdr *);
+			const struct rte_ipv4_hdr *ip4h =
+				RTE_PTR_ADD(eh, sizeof(*eh));
+			uint32_t l4;
+			int fast;
+
+			/*
+			 * branch-free check of the dominant case: untagged
+			 * Ethernet, IPv4 without options, not a fragment,
+			 * TCP or UDP on top. Everything else - VLAN tags,
+			 * IP options, tunnels, IPv6 - takes the slow path.
+			 */
+			l4 = ptype_l4(ip4h->next_proto_id) &
+				(RTE_PTYPE_L4_TCP | RTE_PTYPE_L4_UDP);
+			fast = (eh->ether_type ==
+					rte_cpu_to_be_16(RTE_ETHER_TYPE_IPV4)) &
+				(ip4h->version_ihl == RTE_IPV4_VHL_DEF) &
+				((ip4h->fragment_offset &
+					rte_cpu_to_be_16(RTE_IPV4_HDR_OFFSET_MASK |
+						RTE_IPV4_HDR_MF_FLAG)) == 0) &
+				(l4 != 0);
+			if (likely(fast)) {
+				ptypes[i] = RTE_PTYPE_L2_ETHER |
+					RTE_PTYPE_L3_IPV4 | l4;
+				common &= ptypes[i];
+				continue;
+			}
+		}
+
+		ptypes[i] = rte_net_get_ptype(m, NULL, layers);
+		common &= ptypes[i];
+	}
+
+	return common;
+}
@@ -85,6 +85,37 @@ rte_net_skip_ip6_ext(uint16_t proto, const struct rte_mbuf *m, uint32_t *off,
 uint32_t rte_net_get_ptype(const struct rte_mbuf *m,
 	struct rte_net_hdr_lens *hdr_lens, uint32_t layers);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Parse a burst of Ethernet packets to get their packet types.
+ *
+ * Plain Ether/IPv4/TCP and Ether/IPv4/UDP frames without IP options are
+ * classified on a branch-free fast path with the headers of upcoming
+ * packets prefetched; all other frames (VLAN, IPv6, fragments, tunnels,
+ * multi-segment headers) fall back to rte_net_get_ptype(). No header
+ * lengths are returned - use rte_net_get_ptype() when those are needed.
+ *
+ * @param pkts
+ *   Array of packet mbufs to be parsed.
+ * @param ptypes
+ *   Array filled with the packet type of each packet.
+ * @param nb_pkts
+ *   Number of packets in the burst.
+ * @param layers
+ *   List of layers to parse, see rte_net_get_ptype(). The fast path is
+ *   only taken when L2, L3 and L4 parsing is requested.
+ * @return
+ *   The bitwise AND of all returned packet types: a summary of what the
+ *   burst has in common. If the whole burst is homogeneous, this equals
+ *   the packet type of every packet, so pipelines can take a
+ *   burst-specialized path after a single comparison.
+ */
+__rte_experimental
+uint32_t rte_net_get_ptype_bulk(struct rte_mbuf *const pkts[],
+	uint32_t ptypes[], uint16_t nb_pkts, uint32_t layers);
+
 /**
  * Prepare pseudo header checksum
  *
@@ -19,14 +19,25 @@ ethdev_rx_node_process_inline(struct rte_graph *graph, struct rte_node *node,
 {
 	uint16_t count, next_index;
 	uint16_t port, queue;
+	uint16_t nb_burst;
 
 	port = ctx->port_id;
 	queue = ctx->queue_id;
 	next_index = ctx->cls_next;
 
+	/*
+	 * Reduce the poll size while some downstream node is asserting
+	 * backpressure, instead of stopping: the trickle keeps the
+	 * congested node running so it can release the backpressure,
+	 * while the bulk of the burst is absorbed by the Rx ring.
+	 */
+	nb_burst = RTE_GRAPH_BURST_SIZE;
+	if (unlikely(rte_graph_has_backpressure(graph)))
+		nb_burst = RTE_GRAPH_BURST_SIZE / 8;
+
 	/* Get pkts from port */
 	count = rte_eth_rx_burst(port, queue, (struct rte_mbuf **)node->objs,
-				 RTE_GRAPH_BURST_SIZE);
+				 nb_burst);
 
 	if (!count)
 		return 0;
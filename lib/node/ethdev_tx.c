@@ -28,8 +28,12 @@ ethdev_tx_node_process(struct rte_graph *graph, struct rte_node *node,
 
 	/* Redirect unsent pkts to drop node */
 	if (count != nb_objs) {
+		/* Tx queue is full, throttle the upstream intake */
+		rte_node_backpressure_set(graph, node);
 		rte_node_enqueue(graph, node, ETHDEV_TX_NEXT_PKT_DROP,
 				 &objs[count], nb_objs - count);
+	} else {
+		rte_node_backpressure_clear(graph, node);
 	}
 
 	return count;
@@ -206,7 +206,7 @@ ip4_rewrite_node_process(struct rte_graph *graph, struct rte_node *node,
 	}
 
 	while (n_left_from > 0) {
-		uint16_t chksum;
+		uint8_t old_ttl, new_ttl;
 
 		mbuf0 = pkts[0];
 
@@ -220,11 +220,12 @@ ip4_rewrite_node_process(struct rte_graph *graph, struct rte_node *node,
 		next0 = nh[node_mbuf_priv1(mbuf0, dyn)->nh].tx_node;
 		ip0 = (struct rte_ipv4_hdr *)((uint8_t *)d0 +
 					      sizeof(struct rte_ether_hdr));
-		chksum = node_mbuf_priv1(mbuf0, dyn)->cksum +
-			 rte_cpu_to_be_16(0x0100);
-		chksum += chksum >= 0xffff;
-		ip0->hdr_checksum = chksum;
-		ip0->time_to_live = node_mbuf_priv1(mbuf0, dyn)->ttl - 1;
+		old_ttl = node_mbuf_priv1(mbuf0, dyn)->ttl;
+		new_ttl = old_ttl - 1;
+		ip0->hdr_checksum = rte_cksum_update(
+			node_mbuf_priv1(mbuf0, dyn)->cksum,
+			rte_cksum_delta(&old_ttl, &new_ttl, sizeof(old_ttl)));
+		ip0->time_to_live = new_ttl;
 
 		if (unlikely(next_index ^ next0)) {
 			/* Copy things successfully speculated till now */
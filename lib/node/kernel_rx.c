@@ -117,12 +117,15 @@ kernel_rx_node_do(struct rte_graph *graph, struct rte_node *node, kernel_rx_node
 
 	fd = rx->sock;
 	if (fd > 0) {
+		struct mmsghdr msgs[KERN_RX_CACHE_COUNT];
+		struct iovec iovs[KERN_RX_CACHE_COUNT];
 		struct rte_mbuf **mbufs;
-		uint16_t len = 0, count = 0;
-		int nb_cnt, i;
+		uint16_t len, count = 0;
+		int nb_cnt, nb_rcv, i;
 
-		nb_cnt = (node->size >= RTE_GRAPH_BURST_SIZE) ? RTE_GRAPH_BURST_SIZE : node->size;
+		nb_cnt = (node->size >= KERN_RX_CACHE_COUNT) ? KERN_RX_CACHE_COUNT : node->size;
 
+		/* receive one burst of datagrams in a single syscall */
 		mbufs = (struct rte_mbuf **)node->objs;
 		for (i = 0; i < nb_cnt; i++) {
 			struct rte_mbuf *m = alloc_rx_mbuf(ctx);
@@ -130,22 +133,43 @@ kernel_rx_node_do(struct rte_graph *graph, struct rte_node *node, kernel_rx_node
 			if (!m)
 				break;
 
-			len = read(fd, rte_pktmbuf_mtod(m, char *), rte_pktmbuf_tailroom(m));
+			iovs[i].iov_base = rte_pktmbuf_mtod(m, char *);
+			iovs[i].iov_len = rte_pktmbuf_tailroom(m);
+			memset(&msgs[i], 0, sizeof(msgs[i]));
+			msgs[i].msg_hdr.msg_iov = &iovs[i];
+			msgs[i].msg_hdr.msg_iovlen = 1;
+
+			mbufs[i] = m;
+		}
+		nb_cnt = i;
+		if (nb_cnt == 0) {
+			node_dbg("kernel_rx", "rx_mbuf array is empty");
+			return 0;
+		}
+
+		nb_rcv = recvmmsg(fd, msgs, nb_cnt, MSG_DONTWAIT, NULL);
+		if (nb_rcv < 0)
+			nb_rcv = 0;
+
+		for (i = 0; i < nb_rcv; i++) {
+			struct rte_mbuf *m = mbufs[i];
+
+			len = msgs[i].msg_len;
 			if (len == 0 || len == 0xFFFF) {
 				rte_pktmbuf_free(m);
-				if (rx->idx <= 0)
-					node_dbg("kernel_rx", "rx_mbuf array is empty");
-				rx->idx--;
-				break;
+				continue;
 			}
-			*mbufs++ = m;
 
 			m->port = node->id;
 			rte_pktmbuf_data_len(m) = len;
 
-			count++;
+			mbufs[count++] = m;
 		}
 
+		/* free the mbufs recvmmsg() did not fill */
+		if (nb_rcv < nb_cnt)
+			rte_pktmbuf_free_bulk(&mbufs[nb_rcv], nb_cnt - nb_rcv);
+
 		if (count) {
 			recv_pkt_parse(node->objs, count);
 			node->idx = count;
@@ -7,83 +7,115 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
+#include <rte_cycles.h>
 #include <rte_debug.h>
 #include <rte_ethdev.h>
 #include <rte_graph.h>
 #include <rte_graph_worker.h>
 #include <rte_ip.h>
+#include <rte_malloc.h>
 
 #include "kernel_tx_priv.h"
 #include "node_private.h"
 
-static __rte_always_inline void
-kernel_tx_process_mbuf(struct rte_node *node, struct rte_mbuf **mbufs, uint16_t cnt)
+/* Send all pending packets to the kernel in a single sendmmsg() call */
+static void
+kernel_tx_flush(kernel_tx_node_ctx_t *ctx)
 {
-	kernel_tx_node_ctx_t *ctx = (kernel_tx_node_ctx_t *)node->ctx;
-	struct sockaddr_in sin = {0};
+	kernel_tx_info_t *tx = ctx->tx_info;
+	struct sockaddr_in sins[KERNEL_TX_BURST];
+	struct mmsghdr msgs[KERNEL_TX_BURST];
+	struct iovec iovs[KERNEL_TX_BURST];
 	struct rte_ipv4_hdr *ip4;
-	size_t len;
-	char *buf;
-	int i;
+	uint16_t i, n = tx->n_pend;
+	struct rte_mbuf *m;
+	int rc;
+
+	if (n == 0)
+		return;
+
+	memset(msgs, 0, n * sizeof(msgs[0]));
+	for (i = 0; i < n; i++) {
+		m = tx->pend[i];
+		ip4 = rte_pktmbuf_mtod(m, struct rte_ipv4_hdr *);
+
+		iovs[i].iov_base = ip4;
+		iovs[i].iov_len = rte_pktmbuf_data_len(m);
 
-	for (i = 0; i < cnt; i++) {
-		ip4 = rte_pktmbuf_mtod(mbufs[i], struct rte_ipv4_hdr *);
-		len = rte_pktmbuf_data_len(mbufs[i]);
-		buf = (char *)ip4;
+		memset(&sins[i], 0, sizeof(sins[i]));
+		sins[i].sin_family = AF_INET;
+		sins[i].sin_addr.s_addr = ip4->dst_addr;
 
-		sin.sin_family = AF_INET;
-		sin.sin_port = 0;
-		sin.sin_addr.s_addr = ip4->dst_addr;
+		msgs[i].msg_hdr.msg_name = &sins[i];
+		msgs[i].msg_hdr.msg_namelen = sizeof(sins[i]);
+		msgs[i].msg_hdr.msg_iov = &iovs[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+	}
 
-		if (sendto(ctx->sock, buf, len, 0, (struct sockaddr *)&sin, sizeof(sin)) < 0)
+	i = 0;
+	while (i < n) {
+		rc = sendmmsg(ctx->sock, &msgs[i], n - i, 0);
+		if (rc < 0) {
 			node_err("kernel_tx", "Unable to send packets: %s", strerror(errno));
+			break;
+		}
+		i += rc;
 	}
+
+	rte_pktmbuf_free_bulk(tx->pend, n);
+	tx->n_pend = 0;
 }
 
 static uint16_t
 kernel_tx_node_process(struct rte_graph *graph __rte_unused, struct rte_node *node, void **objs,
 			 uint16_t nb_objs)
 {
+	kernel_tx_node_ctx_t *ctx = (kernel_tx_node_ctx_t *)node->ctx;
 	struct rte_mbuf **pkts = (struct rte_mbuf **)objs;
+	kernel_tx_info_t *tx = ctx->tx_info;
 	uint16_t obj_left = nb_objs;
-
-#define PREFETCH_CNT 4
-
-	while (obj_left >= 12) {
-		/* Prefetch next-next mbufs */
-		rte_prefetch0(pkts[8]);
-		rte_prefetch0(pkts[9]);
-		rte_prefetch0(pkts[10]);
-		rte_prefetch0(pkts[11]);
-
-		/* Prefetch next mbuf data */
-		rte_prefetch0(rte_pktmbuf_mtod_offset(pkts[4], void *, pkts[4]->l2_len));
-		rte_prefetch0(rte_pktmbuf_mtod_offset(pkts[5], void *, pkts[5]->l2_len));
-		rte_prefetch0(rte_pktmbuf_mtod_offset(pkts[6], void *, pkts[6]->l2_len));
-		rte_prefetch0(rte_pktmbuf_mtod_offset(pkts[7], void *, pkts[7]->l2_len));
-
-		kernel_tx_process_mbuf(node, pkts, PREFETCH_CNT);
-
-		obj_left -= PREFETCH_CNT;
-		pkts += PREFETCH_CNT;
-	}
+	uint16_t n;
 
 	while (obj_left > 0) {
-		kernel_tx_process_mbuf(node, pkts, 1);
+		if (tx->n_pend == 0)
+			tx->first_cycles = rte_get_tsc_cycles();
+
+		n = RTE_MIN(obj_left, (uint16_t)(KERNEL_TX_BURST - tx->n_pend));
+		memcpy(&tx->pend[tx->n_pend], pkts, n * sizeof(pkts[0]));
+		tx->n_pend += n;
+		pkts += n;
+		obj_left -= n;
 
-		obj_left--;
-		pkts++;
+		if (tx->n_pend == KERNEL_TX_BURST)
+			kernel_tx_flush(ctx);
 	}
 
-	rte_pktmbuf_free_bulk((struct rte_mbuf **)objs, nb_objs);
+	/* flush a partial batch once the accumulation window has passed,
+	 * so slow-path floods amortize the syscall without adding more
+	 * than the window worth of latency to a trickle of punts
+	 */
+	if (tx->n_pend != 0 &&
+	    rte_get_tsc_cycles() - tx->first_cycles >= tx->accum_cycles)
+		kernel_tx_flush(ctx);
 
 	return nb_objs;
 }
 
 static int
-kernel_tx_node_init(const struct rte_graph *graph __rte_unused, struct rte_node *node)
+kernel_tx_node_init(const struct rte_graph *graph, struct rte_node *node)
 {
 	kernel_tx_node_ctx_t *ctx = (kernel_tx_node_ctx_t *)node->ctx;
+	kernel_tx_info_t *tx_info;
+
+	tx_info = rte_zmalloc_socket("kernel_tx_info", sizeof(kernel_tx_info_t),
+				     RTE_CACHE_LINE_SIZE, graph->socket);
+	if (!tx_info) {
+		node_err("kernel_tx", "Kernel tx_info is NULL");
+		return -ENOMEM;
+	}
+	tx_info->accum_cycles =
+		(rte_get_tsc_hz() * KERNEL_TX_ACCUM_USEC) / US_PER_S;
+	ctx->tx_info = tx_info;
 
 	ctx->sock = socket(AF_INET, SOCK_RAW, IPPROTO_RAW);
 	if (ctx->sock < 0)
@@ -97,6 +129,13 @@ kernel_tx_node_fini(const struct rte_graph *graph __rte_unused, struct rte_node
 {
 	kernel_tx_node_ctx_t *ctx = (kernel_tx_node_ctx_t *)node->ctx;
 
+	if (ctx->tx_info) {
+		if (ctx->sock >= 0)
+			kernel_tx_flush(ctx);
+		rte_free(ctx->tx_info);
+		ctx->tx_info = NULL;
+	}
+
 	if (ctx->sock >= 0) {
 		close(ctx->sock);
 		ctx->sock = -1;
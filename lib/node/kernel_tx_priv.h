@@ -5,9 +5,23 @@
 #ifndef __KERNEL_TX_PRIV_H__
 #define __KERNEL_TX_PRIV_H__
 
+/* Packets sent to the kernel in one sendmmsg() call */
+#define KERNEL_TX_BURST 64
+/* Accumulation window before a partial batch is flushed, in us */
+#define KERNEL_TX_ACCUM_USEC 50
+
+/* Pending packets accumulated across process() invocations */
+typedef struct kernel_tx_info {
+	struct rte_mbuf *pend[KERNEL_TX_BURST];
+	uint16_t n_pend;
+	uint64_t first_cycles; /* TSC when the oldest pending packet arrived */
+	uint64_t accum_cycles; /* accumulation window in TSC cycles */
+} kernel_tx_info_t;
+
 /* kernel_tx node context structure. */
 typedef struct kernel_tx_node_ctx {
 	int sock;
+	kernel_tx_info_t *tx_info;
 } kernel_tx_node_ctx_t;
 
 /* Get the pointer to kernel_tx node register structure */
@@ -6,6 +6,7 @@
 
 #include <rte_graph.h>
 #include <rte_graph_worker.h>
+#include <rte_vect.h>
 
 #include "pkt_cls_priv.h"
 #include "node_private.h"
@@ -41,9 +42,54 @@ static const alignas(RTE_CACHE_LINE_SIZE) uint8_t p_nxt[256] = {
 		PKT_CLS_NEXT_IP6_LOOKUP,
 };
 
-static uint16_t
-pkt_cls_node_process(struct rte_graph *graph, struct rte_node *node,
-		     void **objs, uint16_t nb_objs)
+#if defined(RTE_ARCH_X86)
+/* Non-zero if any of the next eight l2l3 types differs from last_type. */
+static __rte_always_inline int
+pkt_cls_ptype_mismatch_x8(struct rte_mbuf **pkts, uint8_t last_type)
+{
+	const __m128i mask = _mm_set1_epi32(RTE_PTYPE_L2_MASK |
+					    RTE_PTYPE_L3_MASK);
+	const __m128i spec = _mm_set1_epi32(last_type);
+	__m128i t0, t1, cmp;
+
+	t0 = _mm_set_epi32(pkts[3]->packet_type, pkts[2]->packet_type,
+			   pkts[1]->packet_type, pkts[0]->packet_type);
+	t1 = _mm_set_epi32(pkts[7]->packet_type, pkts[6]->packet_type,
+			   pkts[5]->packet_type, pkts[4]->packet_type);
+	cmp = _mm_and_si128(
+		_mm_cmpeq_epi32(_mm_and_si128(t0, mask), spec),
+		_mm_cmpeq_epi32(_mm_and_si128(t1, mask), spec));
+
+	return _mm_movemask_epi8(cmp) != 0xFFFF;
+}
+#elif defined(__ARM_NEON)
+/* Non-zero if any of the next eight l2l3 types differs from last_type. */
+static __rte_always_inline int
+pkt_cls_ptype_mismatch_x8(struct rte_mbuf **pkts, uint8_t last_type)
+{
+	const uint32x4_t mask = vdupq_n_u32(RTE_PTYPE_L2_MASK |
+					    RTE_PTYPE_L3_MASK);
+	const uint32x4_t spec = vdupq_n_u32(last_type);
+	uint32x4_t t0, t1, cmp;
+
+	t0 = vdupq_n_u32(pkts[0]->packet_type);
+	t0 = vsetq_lane_u32(pkts[1]->packet_type, t0, 1);
+	t0 = vsetq_lane_u32(pkts[2]->packet_type, t0, 2);
+	t0 = vsetq_lane_u32(pkts[3]->packet_type, t0, 3);
+	t1 = vdupq_n_u32(pkts[4]->packet_type);
+	t1 = vsetq_lane_u32(pkts[5]->packet_type, t1, 1);
+	t1 = vsetq_lane_u32(pkts[6]->packet_type, t1, 2);
+	t1 = vsetq_lane_u32(pkts[7]->packet_type, t1, 3);
+	cmp = vandq_u32(vceqq_u32(vandq_u32(t0, mask), spec),
+			vceqq_u32(vandq_u32(t1, mask), spec));
+
+	return vminvq_u32(cmp) != UINT32_MAX;
+}
+#endif
+
+static __rte_always_inline uint16_t
+pkt_cls_node_process_impl(struct rte_graph *graph, struct rte_node *node,
+			  void **objs, uint16_t nb_objs, const int vec)
 {
 	struct rte_mbuf *mbuf0, *mbuf1, *mbuf2, *mbuf3, **pkts;
 	uint8_t l0, l1, l2, l3, last_type;
@@ -72,6 +118,38 @@ pkt_cls_node_process(struct rte_graph *graph, struct rte_node *node,
 	/* Get stream for the speculated next node */
 	to_next = rte_node_next_stream_get(graph, node,
 					   next_index, nb_objs);
+
+	if (vec) {
+#if defined(__ARM_NEON) || defined(RTE_ARCH_X86)
+		/*
+		 * Verify the speculation eight packets at a time with one
+		 * SIMD compare. A mismatch drops to the scalar loop below,
+		 * which sorts out the offenders and re-speculates.
+		 */
+		while (n_left_from >= 8) {
+#if RTE_GRAPH_BURST_SIZE > 64
+			if (likely(n_left_from > 15)) {
+				rte_prefetch0(pkts[8]);
+				rte_prefetch0(pkts[9]);
+				rte_prefetch0(pkts[10]);
+				rte_prefetch0(pkts[11]);
+				rte_prefetch0(pkts[12]);
+				rte_prefetch0(pkts[13]);
+				rte_prefetch0(pkts[14]);
+				rte_prefetch0(pkts[15]);
+			}
+#endif
+			if (unlikely(pkt_cls_ptype_mismatch_x8(pkts,
+							       last_type)))
+				break;
+
+			last_spec += 8;
+			pkts += 8;
+			n_left_from -= 8;
+		}
+#endif
+	}
+
 	while (n_left_from >= 4) {
 #if RTE_GRAPH_BURST_SIZE > 64
 		if (likely(n_left_from > 7)) {
@@ -221,11 +299,41 @@ pkt_cls_node_process(struct rte_graph *graph, struct rte_node *node,
 	return nb_objs;
 }
 
+static uint16_t
+pkt_cls_node_process(struct rte_graph *graph, struct rte_node *node,
+		     void **objs, uint16_t nb_objs)
+{
+	return pkt_cls_node_process_impl(graph, node, objs, nb_objs, 0);
+}
+
+#if defined(__ARM_NEON) || defined(RTE_ARCH_X86)
+static uint16_t
+pkt_cls_node_process_vec(struct rte_graph *graph, struct rte_node *node,
+			 void **objs, uint16_t nb_objs)
+{
+	return pkt_cls_node_process_impl(graph, node, objs, nb_objs, 1);
+}
+#endif
+
+static int
+pkt_cls_node_init(const struct rte_graph *graph __rte_unused,
+		  struct rte_node *node __rte_unused)
+{
+#if defined(__ARM_NEON) || defined(RTE_ARCH_X86)
+	if (rte_vect_get_max_simd_bitwidth() >= RTE_VECT_SIMD_128)
+		node->process = pkt_cls_node_process_vec;
+#endif
+
+	return 0;
+}
+
 /* Packet Classification Node */
 struct rte_node_register pkt_cls_node = {
 	.process = pkt_cls_node_process,
 	.name = "pkt_cls",
 
+	.init = pkt_cls_node_init,
+
 	.nb_edges = PKT_CLS_NEXT_MAX,
 	.next_nodes = {
 		/* Pkt drop node starts at '0' */
@@ -52,6 +52,26 @@ __rte_experimental
 int rte_node_ip6_route_add(const struct rte_ipv6_addr *ip, uint8_t depth, uint16_t next_hop,
 			   enum rte_node_ip6_lookup_next next_node);
 
+/**
+ * Add IPv6 route to the FIB backed lookup node (ip6_lookup_fib).
+ *
+ * @param ip
+ *   IPv6 address of route to be added.
+ * @param depth
+ *   Depth of the rule to be added.
+ * @param next_hop
+ *   Next hop id of the rule result to be added.
+ * @param next_node
+ *   Next node to redirect traffic to.
+ *
+ * @return
+ *   0 on success, negative otherwise.
+ */
+__rte_experimental
+int rte_node_ip6_fib_route_add(const struct rte_ipv6_addr *ip, uint8_t depth,
+			       uint16_t next_hop,
+			       enum rte_node_ip6_lookup_next next_node);
+
 /**
  * Add a next hop's rewrite data.
  *
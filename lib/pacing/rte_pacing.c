@@ -0,0 +1,340 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2025 Intel Corporation
+ */
+
+#include <eal_export.h>
+#include <rte_common.h>
+#include <rte_cycles.h>
+#include <rte_errno.h>
+#include <rte_ethdev.h>
+#include <rte_log.h>
+#include <rte_malloc.h>
+#include <rte_mbuf_dyn.h>
+
+#include "rte_pacing.h"
+
+RTE_LOG_REGISTER_DEFAULT(pacing_logtype, INFO);
+#define RTE_LOGTYPE_PACING pacing_logtype
+#define PACING_LOG(level, ...) \
+	RTE_LOG_LINE(level, PACING, "" __VA_ARGS__)
+
+/** Nanoseconds per second */
+#define NS_PER_SEC UINT64_C(1000000000)
+
+/** Transmit burst size used when releasing packets to the device */
+#define PACING_TX_BURST 32
+/** Default staging capacity when max_staged_pkts is zero */
+#define PACING_DEF_MAX_STAGED 4096
+
+/** Name of the dynamic field chaining staged packets per wheel slot */
+#define PACING_DYNFIELD_CHAIN_NAME "rte_pacing_dynfield_chain"
+
+static int timestamp_dynfield_offset = -1;
+static uint64_t timestamp_dynflag;
+static int chain_dynfield_offset = -1;
+
+struct pacing_ctx {
+	uint16_t port_id;
+	uint16_t queue_id;
+	uint64_t resolution_ns;
+	uint32_t nb_slots;
+	uint32_t slot_mask;
+	uint32_t max_staged;
+	/** Number of packets held, in the wheel plus the ready list */
+	uint32_t nb_staged;
+	/** Absolute index of the next wheel slot to drain */
+	uint64_t head_slot;
+	/** Per-slot chain heads and tails, indexed by slot & slot_mask */
+	struct rte_mbuf **heads;
+	struct rte_mbuf **tails;
+	/** Due packets not yet accepted by the device */
+	struct rte_mbuf *ready_head;
+	struct rte_mbuf *ready_tail;
+};
+
+static inline uint64_t *
+pacing_timestamp(struct rte_mbuf *pkt)
+{
+	return RTE_MBUF_DYNFIELD(pkt, timestamp_dynfield_offset, uint64_t *);
+}
+
+static inline struct rte_mbuf **
+pacing_chain(struct rte_mbuf *pkt)
+{
+	return RTE_MBUF_DYNFIELD(pkt, chain_dynfield_offset,
+			struct rte_mbuf **);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_pacing_time_ns, 25.07)
+uint64_t
+rte_pacing_time_ns(void)
+{
+	uint64_t cycles = rte_get_tsc_cycles();
+	uint64_t hz = rte_get_tsc_hz();
+
+	return cycles / hz * NS_PER_SEC + cycles % hz * NS_PER_SEC / hz;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_pacing_ctx_create, 25.07)
+void *
+rte_pacing_ctx_create(const struct rte_pacing_param *param)
+{
+	static const struct rte_mbuf_dynfield chain_dynfield_desc = {
+		.name = PACING_DYNFIELD_CHAIN_NAME,
+		.size = sizeof(struct rte_mbuf *),
+		.align = alignof(struct rte_mbuf *),
+	};
+	struct pacing_ctx *ctx;
+	uint32_t nb_slots;
+	int offset;
+
+	if (param == NULL || param->resolution_ns == 0 ||
+			param->horizon_ns < param->resolution_ns ||
+			!rte_eth_dev_is_valid_port(param->port_id)) {
+		rte_errno = EINVAL;
+		return NULL;
+	}
+
+	if (rte_mbuf_dyn_tx_timestamp_register(&timestamp_dynfield_offset,
+			&timestamp_dynflag) != 0) {
+		PACING_LOG(ERR, "Cannot register mbuf field/flag for timestamp");
+		return NULL;
+	}
+
+	offset = rte_mbuf_dynfield_register(&chain_dynfield_desc);
+	if (offset < 0) {
+		PACING_LOG(ERR, "Cannot register mbuf field for packet chaining");
+		return NULL;
+	}
+	chain_dynfield_offset = offset;
+
+	/* one slot per resolution step up to the horizon, plus the
+	 * current slot, rounded up for cheap index masking
+	 */
+	nb_slots = rte_align32pow2(
+			param->horizon_ns / param->resolution_ns + 1);
+
+	ctx = rte_zmalloc_socket(__func__, sizeof(*ctx),
+			RTE_CACHE_LINE_SIZE, param->socket_id);
+	if (ctx == NULL) {
+		rte_errno = ENOMEM;
+		return NULL;
+	}
+
+	ctx->heads = rte_zmalloc_socket(__func__,
+			2 * nb_slots * sizeof(struct rte_mbuf *),
+			RTE_CACHE_LINE_SIZE, param->socket_id);
+	if (ctx->heads == NULL) {
+		rte_free(ctx);
+		rte_errno = ENOMEM;
+		return NULL;
+	}
+	ctx->tails = ctx->heads + nb_slots;
+
+	ctx->port_id = param->port_id;
+	ctx->queue_id = param->queue_id;
+	ctx->resolution_ns = param->resolution_ns;
+	ctx->nb_slots = nb_slots;
+	ctx->slot_mask = nb_slots - 1;
+	ctx->max_staged = param->max_staged_pkts != 0 ?
+			param->max_staged_pkts : PACING_DEF_MAX_STAGED;
+	ctx->head_slot = rte_pacing_time_ns() / param->resolution_ns;
+
+	return ctx;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_pacing_ctx_destroy, 25.07)
+void
+rte_pacing_ctx_destroy(void *ctx)
+{
+	struct pacing_ctx *pacing_ctx = ctx;
+	struct rte_mbuf *pkt, *next;
+	uint32_t i;
+
+	if (pacing_ctx == NULL)
+		return;
+
+	for (i = 0; i < pacing_ctx->nb_slots; i++) {
+		for (pkt = pacing_ctx->heads[i]; pkt != NULL; pkt = next) {
+			next = *pacing_chain(pkt);
+			rte_pktmbuf_free(pkt);
+		}
+	}
+	for (pkt = pacing_ctx->ready_head; pkt != NULL; pkt = next) {
+		next = *pacing_chain(pkt);
+		rte_pktmbuf_free(pkt);
+	}
+
+	rte_free(pacing_ctx->heads);
+	rte_free(pacing_ctx);
+}
+
+/* Append a chain of packets to the ready list */
+static inline void
+pacing_ready_append(struct pacing_ctx *ctx, struct rte_mbuf *head,
+		struct rte_mbuf *tail)
+{
+	if (ctx->ready_head == NULL)
+		ctx->ready_head = head;
+	else
+		*pacing_chain(ctx->ready_tail) = head;
+	ctx->ready_tail = tail;
+	*pacing_chain(tail) = NULL;
+}
+
+/* Move due wheel slots to the ready list and transmit the ready list */
+static uint16_t
+pacing_release(struct pacing_ctx *ctx)
+{
+	struct rte_mbuf *burst[PACING_TX_BURST];
+	uint64_t cur_slot = rte_pacing_time_ns() / ctx->resolution_ns;
+	uint16_t sent_total = 0;
+	uint64_t n_due;
+	uint64_t k;
+
+	if (cur_slot >= ctx->head_slot) {
+		/* every slot holds departures within the horizon, so at
+		 * most one wheel turn can become due at once
+		 */
+		n_due = RTE_MIN(cur_slot - ctx->head_slot + 1,
+				(uint64_t)ctx->nb_slots);
+		for (k = 0; k < n_due; k++) {
+			uint32_t idx = (ctx->head_slot + k) & ctx->slot_mask;
+
+			if (ctx->heads[idx] == NULL)
+				continue;
+			pacing_ready_append(ctx, ctx->heads[idx],
+					ctx->tails[idx]);
+			ctx->heads[idx] = NULL;
+			ctx->tails[idx] = NULL;
+		}
+		ctx->head_slot = cur_slot + 1;
+	}
+
+	while (ctx->ready_head != NULL) {
+		uint16_t nb_tx, sent, i;
+
+		nb_tx = 0;
+		while (nb_tx < PACING_TX_BURST && ctx->ready_head != NULL) {
+			burst[nb_tx++] = ctx->ready_head;
+			ctx->ready_head = *pacing_chain(ctx->ready_head);
+		}
+		if (ctx->ready_head == NULL)
+			ctx->ready_tail = NULL;
+
+		sent = rte_eth_tx_burst(ctx->port_id, ctx->queue_id,
+				burst, nb_tx);
+		ctx->nb_staged -= sent;
+		sent_total += sent;
+		if (sent < nb_tx) {
+			/* device full: put the tail back in order */
+			for (i = nb_tx; i > sent; i--) {
+				*pacing_chain(burst[i - 1]) = ctx->ready_head;
+				ctx->ready_head = burst[i - 1];
+			}
+			if (ctx->ready_tail == NULL)
+				ctx->ready_tail = burst[nb_tx - 1];
+			break;
+		}
+	}
+
+	return sent_total;
+}
+
+/* Insert a packet into the wheel slot of its departure time */
+static inline void
+pacing_stage(struct pacing_ctx *ctx, struct rte_mbuf *pkt, uint64_t ts)
+{
+	uint64_t slot = ts / ctx->resolution_ns;
+	uint64_t max_slot = ctx->head_slot + ctx->nb_slots - 1;
+	uint32_t idx;
+
+	/*
+	 * Departures before the wheel head go to the head slot: the
+	 * remainder of the current resolution slot is already behind
+	 * head_slot and must not alias a full horizon away. Departures
+	 * past the horizon are released at the horizon.
+	 */
+	if (slot < ctx->head_slot)
+		slot = ctx->head_slot;
+	else if (slot > max_slot)
+		slot = max_slot;
+	idx = slot & ctx->slot_mask;
+
+	*pacing_chain(pkt) = NULL;
+	if (ctx->heads[idx] == NULL)
+		ctx->heads[idx] = pkt;
+	else
+		*pacing_chain(ctx->tails[idx]) = pkt;
+	ctx->tails[idx] = pkt;
+	ctx->nb_staged++;
+}
+
+/* Transmit immediate packets, keeping what the device refused */
+static inline void
+pacing_send_now(struct pacing_ctx *ctx, struct rte_mbuf **pkts,
+		uint16_t nb_pkts)
+{
+	uint16_t sent, i;
+
+	sent = rte_eth_tx_burst(ctx->port_id, ctx->queue_id, pkts, nb_pkts);
+	for (i = sent; i < nb_pkts; i++) {
+		pacing_ready_append(ctx, pkts[i], pkts[i]);
+		ctx->nb_staged++;
+	}
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_pacing_tx_burst, 25.07)
+uint16_t
+rte_pacing_tx_burst(void *ctx, struct rte_mbuf **tx_pkts, uint16_t nb_pkts)
+{
+	struct pacing_ctx *pacing_ctx = ctx;
+	struct rte_mbuf *imm[PACING_TX_BURST];
+	uint16_t nb_imm = 0;
+	uint16_t accepted;
+	uint64_t now;
+
+	pacing_release(pacing_ctx);
+
+	now = rte_pacing_time_ns();
+	for (accepted = 0; accepted < nb_pkts; accepted++) {
+		struct rte_mbuf *pkt = tx_pkts[accepted];
+		uint64_t ts;
+
+		if ((pkt->ol_flags & timestamp_dynflag) != 0)
+			ts = *pacing_timestamp(pkt);
+		else
+			ts = 0;
+
+		if (ts <= now) {
+			imm[nb_imm++] = pkt;
+			if (nb_imm == PACING_TX_BURST) {
+				pacing_send_now(pacing_ctx, imm, nb_imm);
+				nb_imm = 0;
+			}
+			continue;
+		}
+
+		if (pacing_ctx->nb_staged >= pacing_ctx->max_staged)
+			break;
+		pacing_stage(pacing_ctx, pkt, ts);
+	}
+	if (nb_imm > 0)
+		pacing_send_now(pacing_ctx, imm, nb_imm);
+
+	return accepted;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_pacing_flush, 25.07)
+uint16_t
+rte_pacing_flush(void *ctx)
+{
+	return pacing_release(ctx);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_pacing_get_pkt_count, 25.07)
+uint32_t
+rte_pacing_get_pkt_count(void *ctx)
+{
+	return ((struct pacing_ctx *)ctx)->nb_staged;
+}
@@ -0,0 +1,173 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2025 Intel Corporation
+ */
+
+#ifndef _RTE_PACING_H_
+#define _RTE_PACING_H_
+
+/**
+ * @file
+ * Interface to software packet pacing library
+ *
+ * The pacing library implements earliest-departure-time (EDT) transmit
+ * pacing in software, on top of rte_eth_tx_burst(), for devices without
+ * the RTE_ETH_TX_OFFLOAD_SEND_ON_TIMESTAMP capability.
+ *
+ * Applications mark packets with an absolute departure time in the
+ * timestamp mbuf dynamic field and set the Tx timestamp dynamic flag,
+ * exactly as they would for hardware pacing. Marked packets handed to
+ * rte_pacing_tx_burst() are staged in a per-context timing wheel and
+ * released to the device once their departure time is reached; unmarked
+ * packets and packets already due are transmitted immediately.
+ *
+ * Departure times are expressed in nanoseconds in the time reference
+ * returned by rte_pacing_time_ns().
+ */
+
+#include <stdint.h>
+#include <rte_mbuf.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Structure used to create a pacing context.
+ */
+struct rte_pacing_param {
+	/** Port to transmit released packets on. */
+	uint16_t port_id;
+	/** Tx queue to transmit released packets on. */
+	uint16_t queue_id;
+	/**
+	 * Width of one timing wheel slot in nanoseconds. Departure times
+	 * are honored with this granularity.
+	 */
+	uint64_t resolution_ns;
+	/**
+	 * Furthest future departure time accepted, relative to the current
+	 * time. Packets with a later departure time are released at the
+	 * horizon instead.
+	 */
+	uint64_t horizon_ns;
+	/**
+	 * Maximum number of packets held by the context at any time.
+	 * 0 means a default capacity.
+	 */
+	uint32_t max_staged_pkts;
+	/** Socket index for allocating the context and timing wheel. */
+	int socket_id;
+};
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Create a pacing context for one transmit queue.
+ *
+ * This function registers the timestamp mbuf dynamic field and the Tx
+ * timestamp dynamic flag if they are not registered yet.
+ *
+ * A context is not multi-thread safe: as with rte_eth_tx_burst() on the
+ * underlying queue, all calls on one context must come from one thread.
+ *
+ * @param param
+ *   Applicable parameters of the pacing context.
+ * @return
+ *   - Pointer to the pacing context.
+ *   - NULL on error, with rte_errno set.
+ */
+__rte_experimental
+void *rte_pacing_ctx_create(const struct rte_pacing_param *param);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Destroy a pacing context. Packets still held by the context are freed,
+ * not transmitted.
+ *
+ * @param ctx
+ *   Pacing context to destroy. If NULL, no operation is performed.
+ */
+__rte_experimental
+void rte_pacing_ctx_destroy(void *ctx);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Send a burst of packets with departure-time pacing.
+ *
+ * Packets carrying the Tx timestamp dynamic flag and a departure time in
+ * the future are staged in the timing wheel; other packets are
+ * transmitted right away on the queue of the context. Due staged packets
+ * are released before the new burst is processed.
+ *
+ * The context takes ownership of every accepted packet: it is either
+ * transmitted or held until due. Packets are only refused when the
+ * staging capacity is exhausted; refused packets at the tail of the burst
+ * remain owned by the caller, as with rte_eth_tx_burst().
+ *
+ * @param ctx
+ *   Pacing context.
+ * @param tx_pkts
+ *   Address of an array of *nb_pkts* pointers to *rte_mbuf* structures.
+ * @param nb_pkts
+ *   Maximum number of packets to process.
+ * @return
+ *   The number of packets accepted by the context.
+ */
+__rte_experimental
+uint16_t rte_pacing_tx_burst(void *ctx, struct rte_mbuf **tx_pkts,
+		uint16_t nb_pkts);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Release due packets from the timing wheel to the device.
+ *
+ * Needs to be called periodically when the application has nothing to
+ * transmit, otherwise staged packets are only released by the next
+ * rte_pacing_tx_burst() call.
+ *
+ * @param ctx
+ *   Pacing context.
+ * @return
+ *   The number of packets transmitted.
+ */
+__rte_experimental
+uint16_t rte_pacing_flush(void *ctx);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Get the current time in the reference used for departure times.
+ *
+ * @return
+ *   Current time in nanoseconds.
+ */
+__rte_experimental
+uint64_t rte_pacing_time_ns(void);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice
+ *
+ * Get the number of packets currently held by a pacing context.
+ *
+ * @param ctx
+ *   Pacing context.
+ * @return
+ *   The number of staged packets.
+ */
+__rte_experimental
+uint32_t rte_pacing_get_pkt_count(void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTE_PACING_H_ */
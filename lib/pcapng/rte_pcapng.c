@@ -11,6 +11,7 @@
 #include <unistd.h>
 
 #ifndef RTE_EXEC_ENV_WINDOWS
+#include <aio.h>
 #include <net/if.h>
 #include <sys/uio.h>
 #endif
@@ -681,6 +682,333 @@ rte_pcapng_write_packets(rte_pcapng_t *self,
 	return total + ret;
 }
 
+
+/*
+ * Batched writer: enhanced packet blocks for a whole burst are laid out
+ * in one contiguous staging buffer and flushed with a single system
+ * call, overlapped with block building via POSIX asynchronous I/O.
+ */
+struct pcapng_writer_buf {
+	uint8_t *data;
+	uint32_t used;
+	bool in_flight;
+#ifndef RTE_EXEC_ENV_WINDOWS
+	struct aiocb acb;
+#endif
+};
+
+struct rte_pcapng_writer {
+	rte_pcapng_t *pcapng;
+	uint32_t buf_size;
+	unsigned int cur;	/* staging buffer being filled */
+	struct pcapng_writer_buf buf[2];
+};
+
+/* Wait for a previously started flush of this buffer to finish. */
+static int
+pcapng_writer_complete(struct pcapng_writer_buf *b, int fd)
+{
+	ssize_t done;
+
+	if (!b->in_flight)
+		return 0;
+
+#ifndef RTE_EXEC_ENV_WINDOWS
+	const struct aiocb *list[1] = { &b->acb };
+	int err;
+
+	while ((err = aio_error(&b->acb)) == EINPROGRESS)
+		aio_suspend(list, 1, NULL);
+	if (err != 0) {
+		rte_errno = err;
+		return -1;
+	}
+	done = aio_return(&b->acb);
+
+	/* finish any partial write synchronously */
+	while (done >= 0 && (size_t)done < b->used) {
+		ssize_t ret = write(fd, b->data + done, b->used - done);
+
+		if (ret < 0) {
+			rte_errno = errno;
+			return -1;
+		}
+		done += ret;
+	}
+#else
+	RTE_SET_USED(fd);
+	done = b->used;
+#endif
+	b->in_flight = false;
+	b->used = 0;
+	return done < 0 ? -1 : 0;
+}
+
+/* Start writing out a staging buffer without waiting for it. */
+static int
+pcapng_writer_start_flush(struct rte_pcapng_writer *w,
+			  struct pcapng_writer_buf *b)
+{
+	int fd = w->pcapng->outfd;
+
+	if (b->used == 0 || b->in_flight)
+		return 0;
+
+#ifndef RTE_EXEC_ENV_WINDOWS
+	memset(&b->acb, 0, sizeof(b->acb));
+	b->acb.aio_fildes = fd;
+	b->acb.aio_buf = b->data;
+	b->acb.aio_nbytes = b->used;
+
+	if (aio_write(&b->acb) == 0) {
+		b->in_flight = true;
+		return 0;
+	}
+	/* fall back to a blocking write if async submission failed */
+#endif
+	{
+		uint32_t off = 0;
+
+		while (off < b->used) {
+			ssize_t ret = write(fd, b->data + off, b->used - off);
+
+			if (ret < 0) {
+				rte_errno = errno;
+				return -1;
+			}
+			off += ret;
+		}
+		b->used = 0;
+	}
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_pcapng_writer_create, 25.07)
+rte_pcapng_writer_t *
+rte_pcapng_writer_create(rte_pcapng_t *self, uint32_t buf_size)
+{
+	struct rte_pcapng_writer *w;
+	unsigned int i;
+
+	if (self == NULL ||
+	    buf_size < sizeof(struct pcapng_enhance_packet_block) +
+			RTE_ETHER_MAX_LEN + 8 * sizeof(uint32_t)) {
+		rte_errno = EINVAL;
+		return NULL;
+	}
+
+	w = calloc(1, sizeof(*w));
+	if (w == NULL) {
+		rte_errno = ENOMEM;
+		return NULL;
+	}
+
+	w->pcapng = self;
+	w->buf_size = buf_size;
+	for (i = 0; i < RTE_DIM(w->buf); i++) {
+		w->buf[i].data = malloc(buf_size);
+		if (w->buf[i].data == NULL) {
+			free(w->buf[0].data);
+			free(w);
+			rte_errno = ENOMEM;
+			return NULL;
+		}
+	}
+	return w;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_pcapng_writer_flush, 25.07)
+int
+rte_pcapng_writer_flush(rte_pcapng_writer_t *w)
+{
+	return pcapng_writer_start_flush(w, &w->buf[w->cur]);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_pcapng_writer_destroy, 25.07)
+int
+rte_pcapng_writer_destroy(rte_pcapng_writer_t *w)
+{
+	int ret = 0;
+	unsigned int i;
+
+	if (w == NULL)
+		return 0;
+
+	if (rte_pcapng_writer_flush(w) < 0)
+		ret = -1;
+	for (i = 0; i < RTE_DIM(w->buf); i++) {
+		if (pcapng_writer_complete(&w->buf[i],
+					   w->pcapng->outfd) < 0)
+			ret = -1;
+		free(w->buf[i].data);
+	}
+	free(w);
+	return ret;
+}
+
+/* Copy a byte range of a possibly segmented mbuf into the staging buffer. */
+static void
+pcapng_copy_range(uint8_t *dst, const struct rte_mbuf *m,
+		  uint32_t off, uint32_t len)
+{
+	while (m != NULL && off >= m->data_len) {
+		off -= m->data_len;
+		m = m->next;
+	}
+	while (m != NULL && len > 0) {
+		uint32_t n = RTE_MIN(len, (uint32_t)m->data_len - off);
+
+		rte_memcpy(dst, rte_pktmbuf_mtod_offset(m, const void *, off),
+			   n);
+		dst += n;
+		len -= n;
+		off = 0;
+		m = m->next;
+	}
+}
+
+/* Copy mbuf data into the staging buffer, restoring offloaded VLAN tags. */
+static void
+pcapng_stage_data(uint8_t *dst, const struct rte_mbuf *m, uint32_t caplen,
+		  const uint16_t *tag_proto, const uint16_t *tag_tci,
+		  unsigned int nb_tags)
+{
+	unsigned int i;
+
+	if (nb_tags == 0) {
+		pcapng_copy_range(dst, m, 0, caplen);
+		return;
+	}
+
+	/* destination and source addresses, then the tags */
+	pcapng_copy_range(dst, m, 0, 2 * RTE_ETHER_ADDR_LEN);
+	dst += 2 * RTE_ETHER_ADDR_LEN;
+	for (i = 0; i < nb_tags; i++) {
+		const uint16_t proto = rte_cpu_to_be_16(tag_proto[i]);
+		const uint16_t tci = rte_cpu_to_be_16(tag_tci[i]);
+
+		memcpy(dst, &proto, sizeof(proto));
+		memcpy(dst + sizeof(proto), &tci, sizeof(tci));
+		dst += sizeof(struct rte_vlan_hdr);
+	}
+	pcapng_copy_range(dst, m, 2 * RTE_ETHER_ADDR_LEN,
+			  caplen - 2 * RTE_ETHER_ADDR_LEN);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_pcapng_write_burst, 25.07)
+ssize_t
+rte_pcapng_write_burst(rte_pcapng_writer_t *w, uint16_t queue,
+		       enum rte_pcapng_direction direction,
+		       struct rte_mbuf * const *pkts, uint16_t nb_pkts,
+		       uint32_t length)
+{
+	rte_pcapng_t *self = w->pcapng;
+	const uint64_t cycles = rte_get_tsc_cycles();
+	const uint64_t timestamp = pcapng_timestamp(self, cycles);
+	const uint16_t optlen = pcapng_optlen(sizeof(uint32_t)) +
+		pcapng_optlen(sizeof(uint32_t));
+	uint32_t flags;
+	ssize_t total = 0;
+	unsigned int i;
+
+	switch (direction) {
+	case RTE_PCAPNG_DIRECTION_IN:
+		flags = PCAPNG_IFB_INBOUND;
+		break;
+	case RTE_PCAPNG_DIRECTION_OUT:
+		flags = PCAPNG_IFB_OUTBOUND;
+		break;
+	default:
+		flags = 0;
+	}
+
+	for (i = 0; i < nb_pkts; i++) {
+		const struct rte_mbuf *m = pkts[i];
+		struct pcapng_enhance_packet_block *epb;
+		struct pcapng_writer_buf *b;
+		struct pcapng_option *opt;
+		uint16_t tag_proto[2], tag_tci[2];
+		unsigned int nb_tags = 0;
+		uint32_t orig_len, caplen, datalen, block_len, queue32;
+		uint8_t *out;
+
+		orig_len = rte_pktmbuf_pkt_len(m);
+		caplen = RTE_MIN(orig_len, length);
+
+		/* Expand any offloaded VLAN information */
+		if (caplen >= sizeof(struct rte_ether_hdr)) {
+			if ((direction == RTE_PCAPNG_DIRECTION_IN &&
+			     (m->ol_flags & RTE_MBUF_F_RX_QINQ_STRIPPED)) ||
+			    (direction == RTE_PCAPNG_DIRECTION_OUT &&
+			     (m->ol_flags & RTE_MBUF_F_TX_QINQ))) {
+				tag_proto[nb_tags] = RTE_ETHER_TYPE_QINQ;
+				tag_tci[nb_tags++] = m->vlan_tci_outer;
+			}
+			if ((direction == RTE_PCAPNG_DIRECTION_IN &&
+			     (m->ol_flags & RTE_MBUF_F_RX_VLAN_STRIPPED)) ||
+			    (direction == RTE_PCAPNG_DIRECTION_OUT &&
+			     (m->ol_flags & RTE_MBUF_F_TX_VLAN))) {
+				tag_proto[nb_tags] = RTE_ETHER_TYPE_VLAN;
+				tag_tci[nb_tags++] = m->vlan_tci;
+			}
+		}
+
+		datalen = caplen + nb_tags * sizeof(struct rte_vlan_hdr);
+		block_len = sizeof(*epb) + RTE_ALIGN(datalen, sizeof(uint32_t))
+			+ optlen + sizeof(uint32_t);
+
+		if (unlikely(block_len > w->buf_size)) {
+			rte_errno = EMSGSIZE;
+			return -1;
+		}
+		if (unlikely(self->port_index[m->port] > RTE_MAX_ETHPORTS)) {
+			rte_errno = EINVAL;
+			return -1;
+		}
+
+		b = &w->buf[w->cur];
+		if (b->used + block_len > w->buf_size) {
+			/* flip buffers; start flushing the full one */
+			if (pcapng_writer_start_flush(w, b) < 0)
+				return -1;
+			w->cur ^= 1;
+			b = &w->buf[w->cur];
+			if (pcapng_writer_complete(b, self->outfd) < 0)
+				return -1;
+		}
+
+		out = b->data + b->used;
+		epb = (struct pcapng_enhance_packet_block *)out;
+		epb->block_type = PCAPNG_ENHANCED_PACKET_BLOCK;
+		epb->block_length = block_len;
+		epb->interface_id = self->port_index[m->port];
+		epb->timestamp_hi = timestamp >> 32;
+		epb->timestamp_lo = (uint32_t)timestamp;
+		epb->capture_length = datalen;
+		epb->original_length = orig_len +
+			nb_tags * sizeof(struct rte_vlan_hdr);
+
+		out += sizeof(*epb);
+		pcapng_stage_data(out, m, caplen, tag_proto, tag_tci, nb_tags);
+		memset(out + datalen, 0,
+		       RTE_ALIGN(datalen, sizeof(uint32_t)) - datalen);
+		out += RTE_ALIGN(datalen, sizeof(uint32_t));
+
+		opt = (struct pcapng_option *)out;
+		opt = pcapng_add_option(opt, PCAPNG_EPB_FLAGS,
+					&flags, sizeof(flags));
+		queue32 = queue;
+		opt = pcapng_add_option(opt, PCAPNG_EPB_QUEUE,
+					&queue32, sizeof(queue32));
+		memcpy(opt, &block_len, sizeof(uint32_t));
+
+		b->used += block_len;
+		total += block_len;
+	}
+
+	return total;
+}
+
 /* Create new pcapng writer handle */
 RTE_EXPORT_SYMBOL(rte_pcapng_fdopen)
 rte_pcapng_t *
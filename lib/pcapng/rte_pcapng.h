@@ -167,6 +167,105 @@ ssize_t
 rte_pcapng_write_packets(rte_pcapng_t *self,
 			 struct rte_mbuf *pkts[], uint16_t nb_pkts);
 
+/* Opaque handle for the batched staging writer. */
+typedef struct rte_pcapng_writer rte_pcapng_writer_t;
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Create a batched writer on top of an open capture file.
+ *
+ * The writer lays out enhanced packet blocks for whole bursts of
+ * original mbufs in a contiguous staging buffer and writes full
+ * buffers with a single system call, started asynchronously where the
+ * platform supports it so that block building overlaps the disk write.
+ * It is an alternative to the rte_pcapng_copy() plus
+ * rte_pcapng_write_packets() pair that needs no mempool clone per
+ * packet. A writer must only be used from one thread.
+ *
+ * @param self
+ *  The handle to the packet capture file.
+ * @param buf_size
+ *  Size in bytes of each of the two staging buffers. Must be large
+ *  enough to hold at least one maximum sized packet block.
+ * @return
+ *  Handle to the writer, or NULL on error (rte_errno is set).
+ */
+__rte_experimental
+rte_pcapng_writer_t *
+rte_pcapng_writer_create(rte_pcapng_t *self, uint32_t buf_size);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Stage a burst of original mbufs as enhanced packet blocks.
+ *
+ * Packet data is copied into the staging buffer, so the mbufs may be
+ * freed or reused as soon as this function returns. Offloaded VLAN
+ * tags are restored like rte_pcapng_copy() does; the per-packet
+ * comment and RSS hash options are not recorded. Full staging buffers
+ * are flushed automatically.
+ *
+ * @param w
+ *  The handle to the batched writer.
+ * @param queue
+ *  The queue the packets came from, recorded in each block.
+ * @param direction
+ *  The direction of the packets, recorded in each block.
+ * @param pkts
+ *  The address of an array of *nb_pkts* pointers to *rte_mbuf*
+ *  structures. The originating port is taken from each mbuf and must
+ *  have been added with rte_pcapng_add_interface().
+ * @param nb_pkts
+ *  The number of packets to stage.
+ * @param length
+ *  The upper limit on bytes to capture of each packet.
+ * @return
+ *  The number of block bytes staged, -1 on failure (rte_errno is set).
+ */
+__rte_experimental
+ssize_t
+rte_pcapng_write_burst(rte_pcapng_writer_t *w, uint16_t queue,
+		       enum rte_pcapng_direction direction,
+		       struct rte_mbuf * const *pkts, uint16_t nb_pkts,
+		       uint32_t length);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Start writing out whatever is currently staged.
+ *
+ * The write is started asynchronously; it completes at the latest when
+ * the writer is destroyed.
+ *
+ * @param w
+ *  The handle to the batched writer.
+ * @return
+ *  0 on success, -1 on failure (rte_errno is set).
+ */
+__rte_experimental
+int
+rte_pcapng_writer_flush(rte_pcapng_writer_t *w);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Flush remaining staged blocks, wait for outstanding writes and
+ * release the writer. The underlying capture file stays open.
+ *
+ * @param w
+ *  The handle to the batched writer. May be NULL.
+ * @return
+ *  0 on success, -1 if a write failed (rte_errno is set).
+ */
+__rte_experimental
+int
+rte_pcapng_writer_destroy(rte_pcapng_writer_t *w);
+
 /**
  * Write an Interface statistics block.
  * For statistics, use 0 if don't know or care to report it.
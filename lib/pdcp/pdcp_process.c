@@ -618,29 +618,45 @@ pdcp_post_process_ul(const struct rte_pdcp_entity *entity,
 	return nb_success;
 }
 
-static inline int
-pdcp_sn_count_get(const uint32_t rx_deliv, int32_t rsn, uint32_t *count,
-		  const enum rte_security_pdcp_sn_size sn_size)
+/* maximum number of PDUs classified per bulk SN state pass */
+#define PDCP_SN_BULK_NUM 64
+
+/*
+ * Derive counts for a burst of received SNs against one entity state.
+ *
+ * An SN below the RX_DELIV window belongs to the next HFN, an SN at or
+ * above the upper edge to the previous one. The adjustment is computed
+ * branchless as a -1/0/+1 delta from two compares, so the loop
+ * vectorizes over the packed SN array. HFN over/underflow is only
+ * possible when the burst-constant RX_DELIV HFN sits at a limit, and is
+ * reported per PDU in the returned bitmask.
+ *
+ * Expects *num* not to exceed PDCP_SN_BULK_NUM.
+ */
+static inline uint64_t
+pdcp_sn_count_get_bulk(const uint32_t rx_deliv, const int32_t rsn[], uint32_t count[],
+		       const uint16_t num, const enum rte_security_pdcp_sn_size sn_size)
 {
 	const uint32_t rx_deliv_sn = pdcp_sn_from_count_get(rx_deliv, sn_size);
 	const uint32_t window_sz = pdcp_window_size_get(sn_size);
-	uint32_t rhfn;
-
-	rhfn = pdcp_hfn_from_count_get(rx_deliv, sn_size);
-
-	if (rsn < (int32_t)(rx_deliv_sn - window_sz)) {
-		if (unlikely(rhfn == pdcp_hfn_max(sn_size)))
-			return -ERANGE;
-		rhfn += 1;
-	} else if ((uint32_t)rsn >= (rx_deliv_sn + window_sz)) {
-		if (unlikely(rhfn == PDCP_HFN_MIN))
-			return -ERANGE;
-		rhfn -= 1;
-	}
+	const uint32_t rhfn = pdcp_hfn_from_count_get(rx_deliv, sn_size);
+	const int32_t lo = (int32_t)(rx_deliv_sn - window_sz);
+	const uint32_t hi = rx_deliv_sn + window_sz;
+	const uint32_t inc_err = (rhfn == pdcp_hfn_max(sn_size));
+	const uint32_t dec_err = (rhfn == PDCP_HFN_MIN);
+	uint64_t err_mask = 0;
+	uint16_t i;
 
-	*count = pdcp_count_from_hfn_sn_get(rhfn, rsn, sn_size);
+	for (i = 0; i < num; i++) {
+		const uint32_t inc = rsn[i] < lo;
+		const uint32_t dec = (uint32_t)rsn[i] >= hi;
+		const uint32_t hfn = rhfn + inc - dec;
 
-	return 0;
+		count[i] = pdcp_count_from_hfn_sn_get(hfn, rsn[i], sn_size);
+		err_mask |= (uint64_t)((inc & inc_err) | (dec & dec_err)) << i;
+	}
+
+	return err_mask;
 }
 
 static inline uint16_t
@@ -653,10 +669,11 @@ pdcp_pre_process_uplane_sn_12_dl_flags(const struct rte_pdcp_entity *entity,
 	struct rte_pdcp_up_data_pdu_sn_12_hdr *pdu_hdr;
 	uint16_t nb_cop, nb_prep = 0, nb_err = 0;
 	rte_pdcp_dynfield_t *mb_dynfield;
+	uint32_t count[PDCP_SN_BULK_NUM];
+	int32_t rsn[PDCP_SN_BULK_NUM];
+	uint64_t skip_mask;
 	struct rte_mbuf *mb;
-	int32_t rsn = 0;
-	uint32_t count;
-	int i;
+	uint16_t ofs, n, i;
 
 	const uint8_t data_offset = en_priv->hdr_sz + en_priv->aad_sz + en_priv->cipher_skip_sz;
 
@@ -665,29 +682,36 @@ pdcp_pre_process_uplane_sn_12_dl_flags(const struct rte_pdcp_entity *entity,
 
 	const uint32_t rx_deliv = en_priv->state.rx_deliv;
 
-	for (i = 0; i < nb_cop; i++) {
-		mb = in_mb[i];
-		pdu_hdr = rte_pktmbuf_mtod(mb, struct rte_pdcp_up_data_pdu_sn_12_hdr *);
+	for (ofs = 0; ofs < nb_cop; ofs += n) {
+		n = RTE_MIN(nb_cop - ofs, PDCP_SN_BULK_NUM);
 
-		/* Check for PDU type */
-		if (likely(pdu_hdr->d_c == RTE_PDCP_PDU_TYPE_DATA)) {
-			rsn = ((pdu_hdr->sn_11_8 << 8) | (pdu_hdr->sn_7_0));
-		} else {
+		/* Extract SNs for the chunk, flagging non-data PDUs */
+		skip_mask = 0;
+		for (i = 0; i < n; i++) {
+			pdu_hdr = rte_pktmbuf_mtod(in_mb[ofs + i],
+						   struct rte_pdcp_up_data_pdu_sn_12_hdr *);
+			rsn[i] = ((pdu_hdr->sn_11_8 << 8) | (pdu_hdr->sn_7_0));
 			/** NOTE: Control PDU not handled.*/
-			in_mb[nb_err++] = mb;
-			continue;
+			skip_mask |= (uint64_t)(pdu_hdr->d_c != RTE_PDCP_PDU_TYPE_DATA) << i;
 		}
 
-		if (unlikely(pdcp_sn_count_get(rx_deliv, rsn, &count,
-					       RTE_SECURITY_PDCP_SN_SIZE_12))) {
-			in_mb[nb_err++] = mb;
-			continue;
-		}
+		/* Derive counts for the whole chunk before any crypto dispatch */
+		skip_mask |= pdcp_sn_count_get_bulk(rx_deliv, rsn, count, n,
+						    RTE_SECURITY_PDCP_SN_SIZE_12);
 
-		cop_prepare(en_priv, mb, cop[nb_prep++], data_offset, count, is_integ_protected);
+		for (i = 0; i < n; i++) {
+			mb = in_mb[ofs + i];
+			if (unlikely(skip_mask & UINT64_C(1) << i)) {
+				in_mb[nb_err++] = mb;
+				continue;
+			}
 
-		mb_dynfield = pdcp_dynfield(mb);
-		*mb_dynfield = count;
+			cop_prepare(en_priv, mb, cop[nb_prep++], data_offset, count[i],
+				    is_integ_protected);
+
+			mb_dynfield = pdcp_dynfield(mb);
+			*mb_dynfield = count[i];
+		}
 	}
 
 	if (unlikely(nb_err))
@@ -722,10 +746,11 @@ pdcp_pre_process_uplane_sn_18_dl_flags(const struct rte_pdcp_entity *entity,
 	struct rte_pdcp_up_data_pdu_sn_18_hdr *pdu_hdr;
 	uint16_t nb_cop, nb_prep = 0, nb_err = 0;
 	rte_pdcp_dynfield_t *mb_dynfield;
+	uint32_t count[PDCP_SN_BULK_NUM];
+	int32_t rsn[PDCP_SN_BULK_NUM];
+	uint64_t skip_mask;
 	struct rte_mbuf *mb;
-	int32_t rsn = 0;
-	uint32_t count;
-	int i;
+	uint16_t ofs, n, i;
 
 	const uint8_t data_offset = en_priv->hdr_sz + en_priv->aad_sz + en_priv->cipher_skip_sz;
 	nb_cop = rte_crypto_op_bulk_alloc(en_priv->cop_pool, RTE_CRYPTO_OP_TYPE_SYMMETRIC, cop,
@@ -733,30 +758,37 @@ pdcp_pre_process_uplane_sn_18_dl_flags(const struct rte_pdcp_entity *entity,
 
 	const uint32_t rx_deliv = en_priv->state.rx_deliv;
 
-	for (i = 0; i < nb_cop; i++) {
-		mb = in_mb[i];
-		pdu_hdr = rte_pktmbuf_mtod(mb, struct rte_pdcp_up_data_pdu_sn_18_hdr *);
+	for (ofs = 0; ofs < nb_cop; ofs += n) {
+		n = RTE_MIN(nb_cop - ofs, PDCP_SN_BULK_NUM);
 
-		/* Check for PDU type */
-		if (likely(pdu_hdr->d_c == RTE_PDCP_PDU_TYPE_DATA)) {
-			rsn = ((pdu_hdr->sn_17_16 << 16) | (pdu_hdr->sn_15_8 << 8) |
-			       (pdu_hdr->sn_7_0));
-		} else {
+		/* Extract SNs for the chunk, flagging non-data PDUs */
+		skip_mask = 0;
+		for (i = 0; i < n; i++) {
+			pdu_hdr = rte_pktmbuf_mtod(in_mb[ofs + i],
+						   struct rte_pdcp_up_data_pdu_sn_18_hdr *);
+			rsn[i] = ((pdu_hdr->sn_17_16 << 16) | (pdu_hdr->sn_15_8 << 8) |
+				  (pdu_hdr->sn_7_0));
 			/** NOTE: Control PDU not handled.*/
-			in_mb[nb_err++] = mb;
-			continue;
+			skip_mask |= (uint64_t)(pdu_hdr->d_c != RTE_PDCP_PDU_TYPE_DATA) << i;
 		}
 
-		if (unlikely(pdcp_sn_count_get(rx_deliv, rsn, &count,
-					       RTE_SECURITY_PDCP_SN_SIZE_18))) {
-			in_mb[nb_err++] = mb;
-			continue;
-		}
+		/* Derive counts for the whole chunk before any crypto dispatch */
+		skip_mask |= pdcp_sn_count_get_bulk(rx_deliv, rsn, count, n,
+						    RTE_SECURITY_PDCP_SN_SIZE_18);
+
+		for (i = 0; i < n; i++) {
+			mb = in_mb[ofs + i];
+			if (unlikely(skip_mask & UINT64_C(1) << i)) {
+				in_mb[nb_err++] = mb;
+				continue;
+			}
 
-		cop_prepare(en_priv, mb, cop[nb_prep++], data_offset, count, is_integ_protected);
+			cop_prepare(en_priv, mb, cop[nb_prep++], data_offset, count[i],
+				    is_integ_protected);
 
-		mb_dynfield = pdcp_dynfield(mb);
-		*mb_dynfield = count;
+			mb_dynfield = pdcp_dynfield(mb);
+			*mb_dynfield = count[i];
+		}
 	}
 
 	if (unlikely(nb_err))
@@ -790,10 +822,11 @@ pdcp_pre_process_cplane_sn_12_dl(const struct rte_pdcp_entity *entity, struct rt
 	struct rte_pdcp_cp_data_pdu_sn_12_hdr *pdu_hdr;
 	uint16_t nb_cop, nb_prep = 0, nb_err = 0;
 	rte_pdcp_dynfield_t *mb_dynfield;
+	uint32_t count[PDCP_SN_BULK_NUM];
+	int32_t rsn[PDCP_SN_BULK_NUM];
+	uint64_t skip_mask;
 	struct rte_mbuf *mb;
-	uint32_t count;
-	int32_t rsn;
-	int i;
+	uint16_t ofs, n, i;
 
 	const uint8_t data_offset = en_priv->hdr_sz + en_priv->aad_sz + en_priv->cipher_skip_sz;
 
@@ -802,20 +835,32 @@ pdcp_pre_process_cplane_sn_12_dl(const struct rte_pdcp_entity *entity, struct rt
 
 	const uint32_t rx_deliv = en_priv->state.rx_deliv;
 
-	for (i = 0; i < nb_cop; i++) {
-		mb = in_mb[i];
-		pdu_hdr = rte_pktmbuf_mtod(mb, struct rte_pdcp_cp_data_pdu_sn_12_hdr *);
-		rsn = ((pdu_hdr->sn_11_8 << 8) | (pdu_hdr->sn_7_0));
-		if (unlikely(pdcp_sn_count_get(rx_deliv, rsn, &count,
-					       RTE_SECURITY_PDCP_SN_SIZE_12))) {
-			in_mb[nb_err++] = mb;
-			continue;
+	for (ofs = 0; ofs < nb_cop; ofs += n) {
+		n = RTE_MIN(nb_cop - ofs, PDCP_SN_BULK_NUM);
+
+		/* Extract SNs for the chunk */
+		for (i = 0; i < n; i++) {
+			pdu_hdr = rte_pktmbuf_mtod(in_mb[ofs + i],
+						   struct rte_pdcp_cp_data_pdu_sn_12_hdr *);
+			rsn[i] = ((pdu_hdr->sn_11_8 << 8) | (pdu_hdr->sn_7_0));
 		}
 
-		cop_prepare(en_priv, mb, cop[nb_prep++], data_offset, count, true);
+		/* Derive counts for the whole chunk before any crypto dispatch */
+		skip_mask = pdcp_sn_count_get_bulk(rx_deliv, rsn, count, n,
+						   RTE_SECURITY_PDCP_SN_SIZE_12);
 
-		mb_dynfield = pdcp_dynfield(mb);
-		*mb_dynfield = count;
+		for (i = 0; i < n; i++) {
+			mb = in_mb[ofs + i];
+			if (unlikely(skip_mask & UINT64_C(1) << i)) {
+				in_mb[nb_err++] = mb;
+				continue;
+			}
+
+			cop_prepare(en_priv, mb, cop[nb_prep++], data_offset, count[i], true);
+
+			mb_dynfield = pdcp_dynfield(mb);
+			*mb_dynfield = count[i];
+		}
 	}
 
 	if (unlikely(nb_err))
@@ -47,6 +47,8 @@ struct pdump_request {
 
 	const struct rte_bpf_prm *prm;
 	uint32_t snaplen;
+	uint32_t sample_rate;
+	uint64_t capture_bytes;
 };
 
 struct pdump_response {
@@ -62,6 +64,12 @@ static struct pdump_rxtx_cbs {
 	const struct rte_bpf *filter;
 	enum pdump_version ver;
 	uint32_t snaplen;
+	uint32_t sample_rate;
+	uint64_t capture_bytes;
+	/* written only by the lcore polling the queue */
+	uint64_t samp_count;
+	uint64_t bytes_captured;
+	bool zero_copy;
 } rx_cbs[RTE_MAX_ETHPORTS][RTE_MAX_QUEUES_PER_PORT],
 tx_cbs[RTE_MAX_ETHPORTS][RTE_MAX_QUEUES_PER_PORT];
 
@@ -83,7 +91,7 @@ static void
 pdump_copy(uint16_t port_id, uint16_t queue,
 	   enum rte_pcapng_direction direction,
 	   struct rte_mbuf **pkts, uint16_t nb_pkts,
-	   const struct pdump_rxtx_cbs *cbs,
+	   struct pdump_rxtx_cbs *cbs,
 	   struct rte_pdump_stats *stats)
 {
 	unsigned int i;
@@ -95,6 +103,14 @@ pdump_copy(uint16_t port_id, uint16_t queue,
 	struct rte_mbuf *p;
 	uint64_t rcs[nb_pkts];
 
+	/* the bytes cap is checked before doing any per-packet work */
+	if (cbs->capture_bytes != 0 &&
+	    cbs->bytes_captured >= cbs->capture_bytes) {
+		rte_atomic_fetch_add_explicit(&stats->sampled, nb_pkts,
+				rte_memory_order_relaxed);
+		return;
+	}
+
 	if (cbs->filter)
 		rte_bpf_exec_burst(cbs->filter, (void **)pkts, rcs, nb_pkts);
 
@@ -113,11 +129,31 @@ pdump_copy(uint16_t port_id, uint16_t queue,
 			continue;
 		}
 
+		/* sampling decisions are made before any clone is taken */
+		if (cbs->sample_rate > 1 &&
+		    cbs->samp_count++ % cbs->sample_rate != 0) {
+			rte_atomic_fetch_add_explicit(&stats->sampled,
+					1, rte_memory_order_relaxed);
+			continue;
+		}
+		if (cbs->capture_bytes != 0) {
+			if (cbs->bytes_captured >= cbs->capture_bytes) {
+				rte_atomic_fetch_add_explicit(&stats->sampled,
+						1, rte_memory_order_relaxed);
+				continue;
+			}
+			cbs->bytes_captured += rte_pktmbuf_pkt_len(pkts[i]);
+		}
+
 		/*
 		 * If using pcapng then want to wrap packets
-		 * otherwise a simple copy.
+		 * otherwise a simple copy; with zero-copy the original
+		 * mbuf is shared with the consumer via its reference count.
 		 */
-		if (cbs->ver == V2)
+		if (cbs->zero_copy) {
+			rte_pktmbuf_refcnt_update(pkts[i], 1);
+			p = pkts[i];
+		} else if (cbs->ver == V2)
 			p = rte_pcapng_copy(port_id, queue,
 					    pkts[i], mp, cbs->snaplen,
 					    direction, NULL);
@@ -146,7 +182,7 @@ pdump_rx(uint16_t port, uint16_t queue,
 	struct rte_mbuf **pkts, uint16_t nb_pkts,
 	uint16_t max_pkts __rte_unused, void *user_params)
 {
-	const struct pdump_rxtx_cbs *cbs = user_params;
+	struct pdump_rxtx_cbs *cbs = user_params;
 	struct rte_pdump_stats *stats = &pdump_stats->rx[port][queue];
 
 	pdump_copy(port, queue, RTE_PCAPNG_DIRECTION_IN,
@@ -158,7 +194,7 @@ static uint16_t
 pdump_tx(uint16_t port, uint16_t queue,
 		struct rte_mbuf **pkts, uint16_t nb_pkts, void *user_params)
 {
-	const struct pdump_rxtx_cbs *cbs = user_params;
+	struct pdump_rxtx_cbs *cbs = user_params;
 	struct rte_pdump_stats *stats = &pdump_stats->tx[port][queue];
 
 	pdump_copy(port, queue, RTE_PCAPNG_DIRECTION_OUT,
@@ -167,11 +203,9 @@ pdump_tx(uint16_t port, uint16_t queue,
 }
 
 static int
-pdump_register_rx_callbacks(enum pdump_version ver,
+pdump_register_rx_callbacks(const struct pdump_request *p,
 			    uint16_t end_q, uint16_t port, uint16_t queue,
-			    struct rte_ring *ring, struct rte_mempool *mp,
-			    struct rte_bpf *filter,
-			    uint16_t operation, uint32_t snaplen)
+			    struct rte_bpf *filter)
 {
 	uint16_t qid;
 
@@ -179,18 +213,23 @@ pdump_register_rx_callbacks(enum pdump_version ver,
 	for (; qid < end_q; qid++) {
 		struct pdump_rxtx_cbs *cbs = &rx_cbs[port][qid];
 
-		if (operation == ENABLE) {
+		if (p->op == ENABLE) {
 			if (cbs->cb) {
 				PDUMP_LOG_LINE(ERR,
 					"rx callback for port=%d queue=%d, already exists",
 					port, qid);
 				return -EEXIST;
 			}
-			cbs->ver = ver;
-			cbs->ring = ring;
-			cbs->mp = mp;
-			cbs->snaplen = snaplen;
+			cbs->ver = p->ver;
+			cbs->ring = p->ring;
+			cbs->mp = p->mp;
+			cbs->snaplen = p->snaplen;
 			cbs->filter = filter;
+			cbs->sample_rate = p->sample_rate;
+			cbs->capture_bytes = p->capture_bytes;
+			cbs->samp_count = 0;
+			cbs->bytes_captured = 0;
+			cbs->zero_copy = (p->flags & RTE_PDUMP_FLAG_ZEROCOPY) != 0;
 
 			cbs->cb = rte_eth_add_first_rx_callback(port, qid,
 								pdump_rx, cbs);
@@ -202,7 +241,7 @@ pdump_register_rx_callbacks(enum pdump_version ver,
 			}
 
 			memset(&pdump_stats->rx[port][qid], 0, sizeof(struct rte_pdump_stats));
-		} else if (operation == DISABLE) {
+		} else if (p->op == DISABLE) {
 			int ret;
 
 			if (cbs->cb == NULL) {
@@ -226,11 +265,9 @@ pdump_register_rx_callbacks(enum pdump_version ver,
 }
 
 static int
-pdump_register_tx_callbacks(enum pdump_version ver,
+pdump_register_tx_callbacks(const struct pdump_request *p,
 			    uint16_t end_q, uint16_t port, uint16_t queue,
-			    struct rte_ring *ring, struct rte_mempool *mp,
-			    struct rte_bpf *filter,
-			    uint16_t operation, uint32_t snaplen)
+			    struct rte_bpf *filter)
 {
 
 	uint16_t qid;
@@ -239,18 +276,23 @@ pdump_register_tx_callbacks(enum pdump_version ver,
 	for (; qid < end_q; qid++) {
 		struct pdump_rxtx_cbs *cbs = &tx_cbs[port][qid];
 
-		if (operation == ENABLE) {
+		if (p->op == ENABLE) {
 			if (cbs->cb) {
 				PDUMP_LOG_LINE(ERR,
 					"tx callback for port=%d queue=%d, already exists",
 					port, qid);
 				return -EEXIST;
 			}
-			cbs->ver = ver;
-			cbs->ring = ring;
-			cbs->mp = mp;
-			cbs->snaplen = snaplen;
+			cbs->ver = p->ver;
+			cbs->ring = p->ring;
+			cbs->mp = p->mp;
+			cbs->snaplen = p->snaplen;
 			cbs->filter = filter;
+			cbs->sample_rate = p->sample_rate;
+			cbs->capture_bytes = p->capture_bytes;
+			cbs->samp_count = 0;
+			cbs->bytes_captured = 0;
+			cbs->zero_copy = (p->flags & RTE_PDUMP_FLAG_ZEROCOPY) != 0;
 
 			cbs->cb = rte_eth_add_tx_callback(port, qid, pdump_tx,
 								cbs);
@@ -261,7 +303,7 @@ pdump_register_tx_callbacks(enum pdump_version ver,
 				return rte_errno;
 			}
 			memset(&pdump_stats->tx[port][qid], 0, sizeof(struct rte_pdump_stats));
-		} else if (operation == DISABLE) {
+		} else if (p->op == DISABLE) {
 			int ret;
 
 			if (cbs->cb == NULL) {
@@ -292,9 +334,6 @@ set_pdump_rxtx_cbs(const struct pdump_request *p)
 	int ret = 0;
 	struct rte_bpf *filter = NULL;
 	uint32_t flags;
-	uint16_t operation;
-	struct rte_ring *ring;
-	struct rte_mempool *mp;
 
 	/* Check for possible DPDK version mismatch */
 	if (!(p->ver == V1 || p->ver == V2)) {
@@ -319,11 +358,8 @@ set_pdump_rxtx_cbs(const struct pdump_request *p)
 		}
 	}
 
-	flags = p->flags;
-	operation = p->op;
+	flags = p->flags & RTE_PDUMP_FLAG_RXTX;
 	queue = p->queue;
-	ring = p->ring;
-	mp = p->mp;
 
 	ret = rte_eth_dev_get_port_by_name(p->device, &port);
 	if (ret < 0) {
@@ -368,9 +404,8 @@ set_pdump_rxtx_cbs(const struct pdump_request *p)
 	/* register RX callback */
 	if (flags & RTE_PDUMP_FLAG_RX) {
 		end_q = (queue == RTE_PDUMP_ALL_QUEUES) ? nb_rx_q : queue + 1;
-		ret = pdump_register_rx_callbacks(p->ver, end_q, port, queue,
-						  ring, mp, filter,
-						  operation, p->snaplen);
+		ret = pdump_register_rx_callbacks(p, end_q, port, queue,
+						  filter);
 		if (ret < 0)
 			return ret;
 	}
@@ -378,9 +413,8 @@ set_pdump_rxtx_cbs(const struct pdump_request *p)
 	/* register TX callback */
 	if (flags & RTE_PDUMP_FLAG_TX) {
 		end_q = (queue == RTE_PDUMP_ALL_QUEUES) ? nb_tx_q : queue + 1;
-		ret = pdump_register_tx_callbacks(p->ver, end_q, port, queue,
-						  ring, mp, filter,
-						  operation, p->snaplen);
+		ret = pdump_register_tx_callbacks(p, end_q, port, queue,
+						  filter);
 		if (ret < 0)
 			return ret;
 	}
@@ -456,8 +490,17 @@ rte_pdump_uninit(void)
 }
 
 static int
-pdump_validate_ring_mp(struct rte_ring *ring, struct rte_mempool *mp)
+pdump_validate_ring_mp(struct rte_ring *ring, struct rte_mempool *mp,
+		       uint16_t queue, uint32_t flags)
 {
+	/*
+	 * With one queue and one direction there is exactly one producing
+	 * lcore, so a single-producer/single-consumer capture ring is safe
+	 * and avoids the compare-and-set on the shared enqueue path.
+	 */
+	bool single_src = queue != RTE_PDUMP_ALL_QUEUES &&
+		(flags & RTE_PDUMP_FLAG_RXTX) != RTE_PDUMP_FLAG_RXTX;
+
 	if (ring == NULL || mp == NULL) {
 		PDUMP_LOG_LINE(ERR, "NULL ring or mempool");
 		rte_errno = EINVAL;
@@ -471,10 +514,11 @@ pdump_validate_ring_mp(struct rte_ring *ring, struct rte_mempool *mp)
 		rte_errno = EINVAL;
 		return -1;
 	}
-	if (rte_ring_is_prod_single(ring) || rte_ring_is_cons_single(ring)) {
+	if ((rte_ring_is_prod_single(ring) || rte_ring_is_cons_single(ring)) &&
+	    !single_src) {
 		PDUMP_LOG_LINE(ERR,
-			  "ring with SP or SC set is not valid for pdump,"
-			  "must have MP and MC set");
+			  "ring with SP or SC set is only valid for pdump"
+			  " on a single queue and direction");
 		rte_errno = EINVAL;
 		return -1;
 	}
@@ -492,8 +536,18 @@ pdump_validate_flags(uint32_t flags)
 		return -1;
 	}
 
+	/* zero-copy shares raw mbufs, which pcapng output cannot wrap */
+	if ((flags & RTE_PDUMP_FLAG_ZEROCOPY) &&
+	    (flags & RTE_PDUMP_FLAG_PCAPNG)) {
+		PDUMP_LOG_LINE(ERR,
+			"zero-copy capture not supported with pcapng format");
+		rte_errno = ENOTSUP;
+		return -1;
+	}
+
 	/* mask off the flags we know about */
-	if (flags & ~(RTE_PDUMP_FLAG_RXTX | RTE_PDUMP_FLAG_PCAPNG)) {
+	if (flags & ~(RTE_PDUMP_FLAG_RXTX | RTE_PDUMP_FLAG_PCAPNG |
+			RTE_PDUMP_FLAG_ZEROCOPY)) {
 		PDUMP_LOG_LINE(ERR,
 			  "unknown flags: %#x", flags);
 		rte_errno = ENOTSUP;
@@ -528,6 +582,7 @@ pdump_validate_port(uint16_t port, char *name)
 static int
 pdump_prepare_client_request(const char *device, uint16_t queue,
 			     uint32_t flags, uint32_t snaplen,
+			     uint32_t sample_rate, uint64_t capture_bytes,
 			     uint16_t operation,
 			     struct rte_ring *ring,
 			     struct rte_mempool *mp,
@@ -549,7 +604,7 @@ pdump_prepare_client_request(const char *device, uint16_t queue,
 	memset(req, 0, sizeof(*req));
 
 	req->ver = (flags & RTE_PDUMP_FLAG_PCAPNG) ? V2 : V1;
-	req->flags = flags & RTE_PDUMP_FLAG_RXTX;
+	req->flags = flags & (RTE_PDUMP_FLAG_RXTX | RTE_PDUMP_FLAG_ZEROCOPY);
 	req->op = operation;
 	req->queue = queue;
 	rte_strscpy(req->device, device, sizeof(req->device));
@@ -559,6 +614,8 @@ pdump_prepare_client_request(const char *device, uint16_t queue,
 		req->mp = mp;
 		req->prm = prm;
 		req->snaplen = snaplen;
+		req->sample_rate = sample_rate;
+		req->capture_bytes = capture_bytes;
 	}
 
 	rte_strscpy(mp_req.name, PDUMP_MP, RTE_MP_MAX_NAME_LEN);
@@ -589,6 +646,7 @@ pdump_prepare_client_request(const char *device, uint16_t queue,
 static int
 pdump_enable(uint16_t port, uint16_t queue,
 	     uint32_t flags, uint32_t snaplen,
+	     uint32_t sample_rate, uint64_t capture_bytes,
 	     struct rte_ring *ring, struct rte_mempool *mp,
 	     const struct rte_bpf_prm *prm)
 {
@@ -598,7 +656,7 @@ pdump_enable(uint16_t port, uint16_t queue,
 	ret = pdump_validate_port(port, name);
 	if (ret < 0)
 		return ret;
-	ret = pdump_validate_ring_mp(ring, mp);
+	ret = pdump_validate_ring_mp(ring, mp, queue, flags);
 	if (ret < 0)
 		return ret;
 	ret = pdump_validate_flags(flags);
@@ -609,6 +667,7 @@ pdump_enable(uint16_t port, uint16_t queue,
 		snaplen = UINT32_MAX;
 
 	return pdump_prepare_client_request(name, queue, flags, snaplen,
+					    sample_rate, capture_bytes,
 					    ENABLE, ring, mp, prm);
 }
 
@@ -619,7 +678,7 @@ rte_pdump_enable(uint16_t port, uint16_t queue, uint32_t flags,
 		 struct rte_mempool *mp,
 		 void *filter __rte_unused)
 {
-	return pdump_enable(port, queue, flags, 0,
+	return pdump_enable(port, queue, flags, 0, 0, 0,
 			    ring, mp, NULL);
 }
 
@@ -631,20 +690,21 @@ rte_pdump_enable_bpf(uint16_t port, uint16_t queue,
 		     struct rte_mempool *mp,
 		     const struct rte_bpf_prm *prm)
 {
-	return pdump_enable(port, queue, flags, snaplen,
+	return pdump_enable(port, queue, flags, snaplen, 0, 0,
 			    ring, mp, prm);
 }
 
 static int
 pdump_enable_by_deviceid(const char *device_id, uint16_t queue,
 			 uint32_t flags, uint32_t snaplen,
+			 uint32_t sample_rate, uint64_t capture_bytes,
 			 struct rte_ring *ring,
 			 struct rte_mempool *mp,
 			 const struct rte_bpf_prm *prm)
 {
 	int ret;
 
-	ret = pdump_validate_ring_mp(ring, mp);
+	ret = pdump_validate_ring_mp(ring, mp, queue, flags);
 	if (ret < 0)
 		return ret;
 	ret = pdump_validate_flags(flags);
@@ -655,9 +715,24 @@ pdump_enable_by_deviceid(const char *device_id, uint16_t queue,
 		snaplen = UINT32_MAX;
 
 	return pdump_prepare_client_request(device_id, queue, flags, snaplen,
+					    sample_rate, capture_bytes,
 					    ENABLE, ring, mp, prm);
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_pdump_enable_bpf_sampled, 25.07)
+int
+rte_pdump_enable_bpf_sampled(uint16_t port_id, uint16_t queue,
+			     uint32_t flags, uint32_t snaplen,
+			     uint32_t sample_rate, uint64_t capture_bytes,
+			     struct rte_ring *ring,
+			     struct rte_mempool *mp,
+			     const struct rte_bpf_prm *prm)
+{
+	return pdump_enable(port_id, queue, flags, snaplen,
+			    sample_rate, capture_bytes,
+			    ring, mp, prm);
+}
+
 RTE_EXPORT_SYMBOL(rte_pdump_enable_by_deviceid)
 int
 rte_pdump_enable_by_deviceid(char *device_id, uint16_t queue,
@@ -666,7 +741,7 @@ rte_pdump_enable_by_deviceid(char *device_id, uint16_t queue,
 			     struct rte_mempool *mp,
 			     void *filter __rte_unused)
 {
-	return pdump_enable_by_deviceid(device_id, queue, flags, 0,
+	return pdump_enable_by_deviceid(device_id, queue, flags, 0, 0, 0,
 					ring, mp, NULL);
 }
 
@@ -678,7 +753,7 @@ rte_pdump_enable_bpf_by_deviceid(const char *device_id, uint16_t queue,
 				 struct rte_mempool *mp,
 				 const struct rte_bpf_prm *prm)
 {
-	return pdump_enable_by_deviceid(device_id, queue, flags, snaplen,
+	return pdump_enable_by_deviceid(device_id, queue, flags, snaplen, 0, 0,
 					ring, mp, prm);
 }
 
@@ -696,7 +771,7 @@ rte_pdump_disable(uint16_t port, uint16_t queue, uint32_t flags)
 	if (ret < 0)
 		return ret;
 
-	ret = pdump_prepare_client_request(name, queue, flags, 0,
+	ret = pdump_prepare_client_request(name, queue, flags, 0, 0, 0,
 					   DISABLE, NULL, NULL, NULL);
 
 	return ret;
@@ -713,7 +788,7 @@ rte_pdump_disable_by_deviceid(char *device_id, uint16_t queue,
 	if (ret < 0)
 		return ret;
 
-	ret = pdump_prepare_client_request(device_id, queue, flags, 0,
+	ret = pdump_prepare_client_request(device_id, queue, flags, 0, 0, 0,
 					   DISABLE, NULL, NULL, NULL);
 
 	return ret;
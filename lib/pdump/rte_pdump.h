@@ -29,6 +29,14 @@ enum {
 	RTE_PDUMP_FLAG_RXTX = (RTE_PDUMP_FLAG_RX|RTE_PDUMP_FLAG_TX),
 
 	RTE_PDUMP_FLAG_PCAPNG = 4, /* format for pcapng */
+
+	/*
+	 * Share the original mbufs with the capture consumer through their
+	 * reference count instead of cloning them. The consumer must treat
+	 * the mbufs as read-only and free them when done. Not compatible
+	 * with RTE_PDUMP_FLAG_PCAPNG.
+	 */
+	RTE_PDUMP_FLAG_ZEROCOPY = 8,
 };
 
 /**
@@ -113,6 +121,55 @@ rte_pdump_enable_bpf(uint16_t port_id, uint16_t queue,
 		     struct rte_mempool *mp,
 		     const struct rte_bpf_prm *prm);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Enables packet capturing on given port and queue with filtering
+ * and sampling.
+ *
+ * Sampling decisions are taken before any packet is cloned, so
+ * sampled-out packets cost no mempool allocation or copy. When the
+ * capture targets a single queue and a single direction, the ring may
+ * be created with the single-producer and single-consumer flags to
+ * avoid the shared enqueue path.
+ *
+ * @param port_id
+ *  The Ethernet port on which packet capturing should be enabled.
+ * @param queue
+ *  The queue on the Ethernet port which packet capturing
+ *  should be enabled. Pass UINT16_MAX to enable packet capturing on all
+ *  queues of a given port.
+ * @param flags
+ *  Pdump library flags that specify direction and packet format.
+ * @param snaplen
+ *  The upper limit on bytes to copy.
+ *  Passing UINT32_MAX means capture all the possible data.
+ * @param sample_rate
+ *  Capture one packet in every *sample_rate* matching packets.
+ *  Passing 0 or 1 captures every matching packet.
+ * @param capture_bytes
+ *  Stop capturing on the queue once this many packet bytes have been
+ *  captured. Passing 0 means no limit.
+ * @param ring
+ *  The ring on which captured packets will be enqueued for user.
+ * @param mp
+ *  The mempool on to which original packets will be mirrored or duplicated.
+ * @param prm
+ *  Use BPF program to run to filter packes (can be NULL)
+ *
+ * @return
+ *    0 on success, -1 on error, rte_errno is set accordingly.
+ */
+__rte_experimental
+int
+rte_pdump_enable_bpf_sampled(uint16_t port_id, uint16_t queue,
+			     uint32_t flags, uint32_t snaplen,
+			     uint32_t sample_rate, uint64_t capture_bytes,
+			     struct rte_ring *ring,
+			     struct rte_mempool *mp,
+			     const struct rte_bpf_prm *prm);
+
 /**
  * Disables packet capturing on given port and queue.
  *
@@ -229,8 +286,9 @@ struct rte_pdump_stats {
 	RTE_ATOMIC(uint64_t) filtered; /**< Number of packets rejected by filter. */
 	RTE_ATOMIC(uint64_t) nombuf;   /**< Number of mbuf allocation failures. */
 	RTE_ATOMIC(uint64_t) ringfull; /**< Number of missed packets due to ring full. */
+	RTE_ATOMIC(uint64_t) sampled;  /**< Number of packets skipped by sampling. */
 
-	uint64_t reserved[4]; /**< Reserved and pad to cache line */
+	uint64_t reserved[3]; /**< Reserved and pad to cache line */
 };
 
 /**
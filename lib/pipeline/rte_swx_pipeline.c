@@ -13960,8 +13960,14 @@ instruction_group_list_create(struct rte_swx_pipeline *p)
 	for (i = 0; i < p->n_instructions; i++) {
 		struct instruction *instr = &p->instructions[i];
 
-		/* Check for thread yield instructions. */
-		if (!instruction_does_thread_yield(instr))
+		/* Check for thread yield instructions. The extern object/function call
+		 * instructions also yield, but they do not delimit the groups, as the generated
+		 * code inlines them as a busy-wait loop (similar to the action code generation,
+		 * see action_instr_extern_obj_codegen()).
+		 */
+		if (!instruction_does_thread_yield(instr) ||
+		    (instr->type == INSTR_EXTERN_OBJ) ||
+		    (instr->type == INSTR_EXTERN_FUNC))
 			continue;
 
 		/* If the current group contains at least one instruction, then finalize it (with
@@ -14135,6 +14141,24 @@ pipeline_instr_does_tx_codegen(struct rte_swx_pipeline *p __rte_unused,
 		instr_pos);
 }
 
+static void
+pipeline_instr_extern_obj_codegen(uint32_t instr_pos,
+				  FILE *f)
+{
+	fprintf(f,
+		"while (!__instr_extern_obj_exec(p, t, &pipeline_instructions[%u]));\n",
+		instr_pos);
+}
+
+static void
+pipeline_instr_extern_func_codegen(uint32_t instr_pos,
+				   FILE *f)
+{
+	fprintf(f,
+		"while (!__instr_extern_func_exec(p, t, &pipeline_instructions[%u]));\n",
+		instr_pos);
+}
+
 static int
 pipeline_instr_jmp_codegen(struct rte_swx_pipeline *p,
 			   struct instruction_group_list *igl,
@@ -14466,6 +14490,18 @@ instruction_group_list_codegen(struct instruction_group_list *igl,
 				continue;
 			}
 
+			/* Extern object call instruction type. */
+			if (instr->type == INSTR_EXTERN_OBJ) {
+				pipeline_instr_extern_obj_codegen(j, f);
+				continue;
+			}
+
+			/* Extern function call instruction type. */
+			if (instr->type == INSTR_EXTERN_FUNC) {
+				pipeline_instr_extern_func_codegen(j, f);
+				continue;
+			}
+
 			/* Jump instruction type. */
 			if (instruction_is_jmp(instr)) {
 				pipeline_instr_jmp_codegen(p, igl, j, instr, data, f);
@@ -6,6 +6,7 @@
 #include <ctype.h>
 #include <dirent.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <sys/mman.h>
 #include <sys/queue.h>
@@ -14,7 +15,9 @@
 
 #include <eal_export.h>
 #include <rte_bitops.h>
+#include <rte_string_fns.h>
 #include <rte_tailq.h>
+#include <rte_telemetry.h>
 #include <rte_log.h>
 
 #include "rte_pmu.h"
@@ -408,6 +411,41 @@ rte_pmu_add_event(const char *name)
 	return event->index;
 }
 
+static int
+pmu_telemetry_sample_stats(const char *cmd __rte_unused, const char *params __rte_unused,
+			   struct rte_tel_data *d)
+{
+	char name[RTE_TEL_MAX_STRING_LEN];
+	struct rte_pmu_event *event;
+	uint64_t total, nb_samples;
+	unsigned int i;
+	char *p;
+
+	rte_tel_data_start_dict(d);
+
+	TAILQ_FOREACH(event, &rte_pmu.event_list, next) {
+		total = 0;
+		for (i = 0; i < RTE_DIM(rte_pmu.sample_stats); i++)
+			total += rte_pmu.sample_stats[i].count[event->index];
+
+		/* dictionary keys are restricted to [a-zA-Z0-9_] */
+		strlcpy(name, event->name, sizeof(name));
+		for (p = name; *p != '\0'; p++) {
+			if (!isalnum(*p))
+				*p = '_';
+		}
+
+		rte_tel_data_add_dict_uint(d, name, total);
+	}
+
+	nb_samples = 0;
+	for (i = 0; i < RTE_DIM(rte_pmu.sample_stats); i++)
+		nb_samples += rte_pmu.sample_stats[i].nb_samples;
+	rte_tel_data_add_dict_uint(d, "nb_samples", nb_samples);
+
+	return 0;
+}
+
 RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_pmu_init, 25.07)
 int
 rte_pmu_init(void)
@@ -431,6 +469,9 @@ rte_pmu_init(void)
 
 	TAILQ_INIT(&rte_pmu.event_list);
 	rte_pmu.initialized = 1;
+
+	rte_telemetry_register_cmd("/pmu/sample_stats", pmu_telemetry_sample_stats,
+				   "Returns total sampled event counts. Takes no parameters");
 out:
 	if (ret) {
 		free(rte_pmu.name);
@@ -468,4 +509,5 @@ rte_pmu_fini(void)
 	free(rte_pmu.name);
 	rte_pmu.name = NULL;
 	rte_pmu.num_group_events = 0;
+	memset(rte_pmu.sample_stats, 0, sizeof(rte_pmu.sample_stats));
 }
@@ -60,11 +60,22 @@ struct __rte_cache_aligned rte_pmu_event_group {
 	bool enabled; /**< true if group was enabled on particular lcore */
 };
 
+/**
+ * Per-lcore accumulator for sampled event deltas.
+ * @see RTE_PMU_SAMPLE_START, RTE_PMU_SAMPLE_STOP
+ */
+struct __rte_cache_aligned rte_pmu_sample_stats {
+	uint64_t start[RTE_MAX_NUM_GROUP_EVENTS]; /**< values at sample start */
+	uint64_t count[RTE_MAX_NUM_GROUP_EVENTS]; /**< accumulated deltas */
+	uint64_t nb_samples; /**< number of start/stop samples taken */
+};
+
 /**
  * A PMU state container.
  */
 struct rte_pmu {
 	struct rte_pmu_event_group event_groups[RTE_MAX_LCORE]; /**< event groups */
+	struct rte_pmu_sample_stats sample_stats[RTE_MAX_LCORE]; /**< sample accumulators */
 	unsigned int num_group_events; /**< number of events in a group */
 	unsigned int initialized; /**< initialization counter */
 	char *name; /**< name of core PMU listed under /sys/bus/event_source/devices */
@@ -233,6 +244,117 @@ rte_pmu_read(unsigned int index)
 	return __rte_pmu_read_userpage(group->mmap_pages[index]);
 }
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Read all hardware counters of the event group in one pass.
+ *
+ * The per-call setup done by rte_pmu_read() (lcore lookup, group
+ * enable check) is paid once for the whole group instead of once per
+ * event, which makes this suitable for wrapping around a burst.
+ * Carries the same constraints as rte_pmu_read().
+ *
+ * @param values
+ *   Array of at least RTE_MAX_NUM_GROUP_EVENTS entries receiving the
+ *   counter values, indexed as returned by rte_pmu_add_event().
+ * @return
+ *   The number of events read, 0 in case of errors or lack of support.
+ */
+__rte_experimental
+static __rte_always_inline unsigned int
+rte_pmu_read_group(uint64_t values[])
+{
+	unsigned int lcore_id = rte_lcore_id();
+	struct rte_pmu_event_group *group;
+	unsigned int i, n;
+
+	if (unlikely(!rte_pmu.initialized))
+		return 0;
+
+	/* non-EAL threads are not supported */
+	if (unlikely(lcore_id >= RTE_MAX_LCORE))
+		return 0;
+
+	group = &rte_pmu.event_groups[lcore_id];
+	if (unlikely(!group->enabled)) {
+		if (__rte_pmu_enable_group(group))
+			return 0;
+	}
+
+	n = rte_pmu.num_group_events;
+	for (i = 0; i < n; i++)
+		values[i] = __rte_pmu_read_userpage(group->mmap_pages[i]);
+
+	return n;
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Take the starting snapshot of the event group for this lcore.
+ *
+ * @see RTE_PMU_SAMPLE_START
+ */
+__rte_experimental
+static __rte_always_inline void
+rte_pmu_sample_start(void)
+{
+	unsigned int lcore_id = rte_lcore_id();
+
+	if (unlikely(lcore_id >= RTE_MAX_LCORE))
+		return;
+
+	rte_pmu_read_group(rte_pmu.sample_stats[lcore_id].start);
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Accumulate event deltas since the last rte_pmu_sample_start() into
+ * this lcore's sample statistics.
+ *
+ * The accumulated totals are exported by the /pmu/sample_stats
+ * telemetry command.
+ *
+ * @see RTE_PMU_SAMPLE_STOP
+ */
+__rte_experimental
+static __rte_always_inline void
+rte_pmu_sample_stop(void)
+{
+	uint64_t now[RTE_MAX_NUM_GROUP_EVENTS];
+	struct rte_pmu_sample_stats *stats;
+	unsigned int lcore_id = rte_lcore_id();
+	unsigned int i, n;
+
+	if (unlikely(lcore_id >= RTE_MAX_LCORE))
+		return;
+
+	n = rte_pmu_read_group(now);
+	stats = &rte_pmu.sample_stats[lcore_id];
+	for (i = 0; i < n; i++)
+		stats->count[i] += now[i] - stats->start[i];
+	if (n != 0)
+		stats->nb_samples++;
+}
+
+/**
+ * Convenience wrappers for sampling a section of code, typically the
+ * processing of one burst:
+ *
+ * RTE_PMU_SAMPLE_START();
+ * nb_rx = rte_eth_rx_burst(...);
+ * ... process burst ...
+ * RTE_PMU_SAMPLE_STOP();
+ *
+ * The deltas accumulate per lcore and are read out via telemetry.
+ */
+#define RTE_PMU_SAMPLE_START() rte_pmu_sample_start()
+#define RTE_PMU_SAMPLE_STOP() rte_pmu_sample_stop()
+
 #ifdef __cplusplus
 }
 #endif
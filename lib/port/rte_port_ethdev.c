@@ -5,9 +5,11 @@
 #include <stdint.h>
 
 #include <eal_export.h>
+#include <rte_cycles.h>
 #include <rte_mbuf.h>
 #include <rte_ethdev.h>
 #include <rte_malloc.h>
+#include <rte_prefetch.h>
 
 #include "rte_port_ethdev.h"
 
@@ -77,6 +79,26 @@ rte_port_ethdev_reader_rx(void *port, struct rte_mbuf **pkts, uint32_t n_pkts)
 	return rx_pkt_cnt;
 }
 
+static int
+rte_port_ethdev_reader_prefetch_rx(void *port, struct rte_mbuf **pkts,
+		uint32_t n_pkts)
+{
+	struct rte_port_ethdev_reader *p =
+		port;
+	uint16_t rx_pkt_cnt, i;
+
+	rx_pkt_cnt = rte_eth_rx_burst(p->port_id, p->queue_id, pkts, n_pkts);
+
+	/* Prefetch the mbuf headers, so that they are already in cache when the
+	 * packet processing stages of the current pipeline run touch them.
+	 */
+	for (i = 0; i < rx_pkt_cnt; i++)
+		rte_prefetch0(pkts[i]);
+
+	RTE_PORT_ETHDEV_READER_STATS_PKTS_IN_ADD(p, rx_pkt_cnt);
+	return rx_pkt_cnt;
+}
+
 static int
 rte_port_ethdev_reader_free(void *port)
 {
@@ -285,6 +307,191 @@ static int rte_port_ethdev_writer_stats_read(void *port,
 	return 0;
 }
 
+/*
+ * Port ETHDEV Writer Coalesce
+ */
+#ifdef RTE_PORT_STATS_COLLECT
+
+#define RTE_PORT_ETHDEV_WRITER_COALESCE_STATS_PKTS_IN_ADD(port, val) \
+	port->stats.n_pkts_in += val
+#define RTE_PORT_ETHDEV_WRITER_COALESCE_STATS_PKTS_DROP_ADD(port, val) \
+	port->stats.n_pkts_drop += val
+
+#else
+
+#define RTE_PORT_ETHDEV_WRITER_COALESCE_STATS_PKTS_IN_ADD(port, val)
+#define RTE_PORT_ETHDEV_WRITER_COALESCE_STATS_PKTS_DROP_ADD(port, val)
+
+#endif
+
+struct rte_port_ethdev_writer_coalesce {
+	struct rte_port_out_stats stats;
+
+	struct rte_mbuf *tx_buf[RTE_PORT_ETHDEV_WRITER_COALESCE_TX_BURST_SZ_MAX +
+		RTE_PORT_IN_BURST_SIZE_MAX];
+	uint64_t n_coalesce_cycles;
+	uint64_t coalesce_start;
+	uint32_t tx_burst_sz;
+	uint32_t tx_buf_count;
+	uint16_t queue_id;
+	uint16_t port_id;
+};
+
+static void *
+rte_port_ethdev_writer_coalesce_create(void *params, int socket_id)
+{
+	struct rte_port_ethdev_writer_coalesce_params *conf =
+			params;
+	struct rte_port_ethdev_writer_coalesce *port;
+
+	/* Check input parameters */
+	if ((conf == NULL) ||
+		(conf->tx_burst_sz == 0) ||
+		(conf->tx_burst_sz > RTE_PORT_ETHDEV_WRITER_COALESCE_TX_BURST_SZ_MAX) ||
+		(!rte_is_power_of_2(conf->tx_burst_sz))) {
+		PORT_LOG(ERR, "%s: Invalid input parameters", __func__);
+		return NULL;
+	}
+
+	/* Memory allocation */
+	port = rte_zmalloc_socket("PORT", sizeof(*port),
+			RTE_CACHE_LINE_SIZE, socket_id);
+	if (port == NULL) {
+		PORT_LOG(ERR, "%s: Failed to allocate port", __func__);
+		return NULL;
+	}
+
+	/* Initialization */
+	port->port_id = conf->port_id;
+	port->queue_id = conf->queue_id;
+	port->tx_burst_sz = conf->tx_burst_sz;
+	port->tx_buf_count = 0;
+
+	/*
+	 * When n_coalesce_cycles is 0 it means that there is no limit on the
+	 * time packets can spend in the buffer, so the buffer is only flushed
+	 * when full or on the explicit flush operation. To limit the number of
+	 * branches in fast path, we use UINT64_MAX instead of branching.
+	 */
+	port->n_coalesce_cycles = (conf->n_coalesce_cycles == 0) ?
+		UINT64_MAX : conf->n_coalesce_cycles;
+	port->coalesce_start = rte_get_tsc_cycles();
+
+	return port;
+}
+
+static inline void
+send_burst_coalesce(struct rte_port_ethdev_writer_coalesce *p)
+{
+	uint32_t nb_tx;
+
+	nb_tx = rte_eth_tx_burst(p->port_id, p->queue_id,
+			 p->tx_buf, p->tx_buf_count);
+
+	RTE_PORT_ETHDEV_WRITER_COALESCE_STATS_PKTS_DROP_ADD(p,
+		p->tx_buf_count - nb_tx);
+	for ( ; nb_tx < p->tx_buf_count; nb_tx++)
+		rte_pktmbuf_free(p->tx_buf[nb_tx]);
+
+	p->tx_buf_count = 0;
+	p->coalesce_start = rte_get_tsc_cycles();
+}
+
+static int
+rte_port_ethdev_writer_coalesce_tx(void *port, struct rte_mbuf *pkt)
+{
+	struct rte_port_ethdev_writer_coalesce *p =
+		port;
+
+	p->tx_buf[p->tx_buf_count++] = pkt;
+	RTE_PORT_ETHDEV_WRITER_COALESCE_STATS_PKTS_IN_ADD(p, 1);
+	if (p->tx_buf_count >= p->tx_burst_sz)
+		send_burst_coalesce(p);
+
+	return 0;
+}
+
+static int
+rte_port_ethdev_writer_coalesce_tx_bulk(void *port,
+		struct rte_mbuf **pkts,
+		uint64_t pkts_mask)
+{
+	struct rte_port_ethdev_writer_coalesce *p =
+		port;
+	uint32_t tx_buf_count = p->tx_buf_count;
+	uint64_t expr = pkts_mask & (pkts_mask + 1);
+
+	if (expr == 0) {
+		uint64_t n_pkts = rte_popcount64(pkts_mask);
+		uint32_t i;
+
+		for (i = 0; i < n_pkts; i++)
+			p->tx_buf[tx_buf_count + i] = pkts[i];
+
+		RTE_PORT_ETHDEV_WRITER_COALESCE_STATS_PKTS_IN_ADD(p, n_pkts);
+		tx_buf_count += n_pkts;
+	} else {
+		for ( ; pkts_mask; ) {
+			uint32_t pkt_index = rte_ctz64(pkts_mask);
+			uint64_t pkt_mask = 1LLU << pkt_index;
+			struct rte_mbuf *pkt = pkts[pkt_index];
+
+			p->tx_buf[tx_buf_count++] = pkt;
+			RTE_PORT_ETHDEV_WRITER_COALESCE_STATS_PKTS_IN_ADD(p, 1);
+			pkts_mask &= ~pkt_mask;
+		}
+	}
+
+	p->tx_buf_count = tx_buf_count;
+	if ((tx_buf_count >= p->tx_burst_sz) ||
+		(tx_buf_count && (rte_get_tsc_cycles() - p->coalesce_start >=
+		p->n_coalesce_cycles)))
+		send_burst_coalesce(p);
+
+	return 0;
+}
+
+static int
+rte_port_ethdev_writer_coalesce_flush(void *port)
+{
+	struct rte_port_ethdev_writer_coalesce *p =
+		port;
+
+	if (p->tx_buf_count > 0)
+		send_burst_coalesce(p);
+
+	return 0;
+}
+
+static int
+rte_port_ethdev_writer_coalesce_free(void *port)
+{
+	if (port == NULL) {
+		PORT_LOG(ERR, "%s: Port is NULL", __func__);
+		return -EINVAL;
+	}
+
+	rte_port_ethdev_writer_coalesce_flush(port);
+	rte_free(port);
+
+	return 0;
+}
+
+static int rte_port_ethdev_writer_coalesce_stats_read(void *port,
+		struct rte_port_out_stats *stats, int clear)
+{
+	struct rte_port_ethdev_writer_coalesce *p =
+		port;
+
+	if (stats != NULL)
+		memcpy(stats, &p->stats, sizeof(p->stats));
+
+	if (clear)
+		memset(&p->stats, 0, sizeof(p->stats));
+
+	return 0;
+}
+
 /*
  * Port ETHDEV Writer Nodrop
  */
@@ -509,6 +716,14 @@ struct rte_port_in_ops rte_port_ethdev_reader_ops = {
 	.f_stats = rte_port_ethdev_reader_stats_read,
 };
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_port_ethdev_reader_prefetch_ops, 25.07)
+struct rte_port_in_ops rte_port_ethdev_reader_prefetch_ops = {
+	.f_create = rte_port_ethdev_reader_create,
+	.f_free = rte_port_ethdev_reader_free,
+	.f_rx = rte_port_ethdev_reader_prefetch_rx,
+	.f_stats = rte_port_ethdev_reader_stats_read,
+};
+
 RTE_EXPORT_SYMBOL(rte_port_ethdev_writer_ops)
 struct rte_port_out_ops rte_port_ethdev_writer_ops = {
 	.f_create = rte_port_ethdev_writer_create,
@@ -519,6 +734,16 @@ struct rte_port_out_ops rte_port_ethdev_writer_ops = {
 	.f_stats = rte_port_ethdev_writer_stats_read,
 };
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_port_ethdev_writer_coalesce_ops, 25.07)
+struct rte_port_out_ops rte_port_ethdev_writer_coalesce_ops = {
+	.f_create = rte_port_ethdev_writer_coalesce_create,
+	.f_free = rte_port_ethdev_writer_coalesce_free,
+	.f_tx = rte_port_ethdev_writer_coalesce_tx,
+	.f_tx_bulk = rte_port_ethdev_writer_coalesce_tx_bulk,
+	.f_flush = rte_port_ethdev_writer_coalesce_flush,
+	.f_stats = rte_port_ethdev_writer_coalesce_stats_read,
+};
+
 RTE_EXPORT_SYMBOL(rte_port_ethdev_writer_nodrop_ops)
 struct rte_port_out_ops rte_port_ethdev_writer_nodrop_ops = {
 	.f_create = rte_port_ethdev_writer_nodrop_create,
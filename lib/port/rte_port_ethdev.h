@@ -33,6 +33,12 @@ struct rte_port_ethdev_reader_params {
 /** ethdev_reader port operations */
 extern struct rte_port_in_ops rte_port_ethdev_reader_ops;
 
+/** ethdev_reader_prefetch port operations. Same as ethdev_reader, with the
+ * mbuf headers of the received packets prefetched into cache before the burst
+ * is handed over to the pipeline. Uses the ethdev_reader port parameters.
+ */
+extern struct rte_port_in_ops rte_port_ethdev_reader_prefetch_ops;
+
 /** ethdev_writer port parameters */
 struct rte_port_ethdev_writer_params {
 	/** NIC RX port ID */
@@ -49,6 +55,34 @@ struct rte_port_ethdev_writer_params {
 /** ethdev_writer port operations */
 extern struct rte_port_out_ops rte_port_ethdev_writer_ops;
 
+/** ethdev_writer_coalesce maximum burst size to NIC TX queue */
+#define RTE_PORT_ETHDEV_WRITER_COALESCE_TX_BURST_SZ_MAX \
+	(2 * RTE_PORT_IN_BURST_SIZE_MAX)
+
+/** ethdev_writer_coalesce port parameters */
+struct rte_port_ethdev_writer_coalesce_params {
+	/** NIC RX port ID */
+	uint16_t port_id;
+
+	/** NIC RX queue ID */
+	uint16_t queue_id;
+
+	/** Recommended burst size to NIC TX queue. Can be bigger than the input
+	burst size, in which case packets from successive pipeline runs are
+	chained into a single larger TX burst. The actual burst size can be
+	bigger or smaller than this value. */
+	uint32_t tx_burst_sz;
+
+	/** Maximum number of CPU cycles packets are held in the buffer before
+	a TX burst is forced, 0 for no limit. Evaluated on burst boundaries,
+	so single packet writes rely on the buffer getting full or on the
+	explicit port flush operation. */
+	uint64_t n_coalesce_cycles;
+};
+
+/** ethdev_writer_coalesce port operations */
+extern struct rte_port_out_ops rte_port_ethdev_writer_coalesce_ops;
+
 /** ethdev_writer_nodrop port parameters */
 struct rte_port_ethdev_writer_nodrop_params {
 	/** NIC RX port ID */
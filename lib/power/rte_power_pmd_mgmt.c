@@ -12,10 +12,15 @@
 #include <rte_malloc.h>
 #include <rte_ethdev.h>
 #include <rte_power_intrinsics.h>
+#include <rte_power_uncore.h>
+#include <rte_spinlock.h>
 
 #include "rte_power_pmd_mgmt.h"
 #include "power_common.h"
 
+#define POWER_SYSFILE_TRANSITION_LATENCY \
+		"/sys/devices/system/cpu/cpu%u/cpufreq/cpuinfo_transition_latency"
+
 unsigned int emptypoll_max;
 unsigned int pause_duration;
 unsigned int scale_freq_min[RTE_MAX_LCORE];
@@ -55,6 +60,9 @@ struct queue_list_entry {
 	uint64_t n_empty_polls;
 	uint64_t n_sleeps;
 	const struct rte_eth_rxtx_callback *cb;
+	/** Poll/empty poll counters for the current governor window */
+	uint64_t gov_polls;
+	uint64_t gov_empty;
 };
 
 struct pmd_core_cfg {
@@ -73,6 +81,244 @@ struct pmd_core_cfg {
 };
 static RTE_LCORE_VAR_HANDLE(struct pmd_core_cfg, lcore_cfgs);
 
+/** How often (in polls) the governor checks whether the window elapsed. */
+#define GOVERNOR_POLL_CHECK 64
+/** Consecutive idle windows required before stepping down. */
+#define GOVERNOR_IDLE_WINDOWS 2
+/** Upper bound on the number of core frequency steps. */
+#define GOVERNOR_MAX_FREQS 64
+/** Frequency transition cost assumed when sysfs does not report one, in ns. */
+#define GOVERNOR_DEFAULT_TRANSITION_NS 50000
+
+struct governor_state {
+	struct rte_power_pmd_mgmt_governor_params params;
+	/** params.interval_us converted to TSC cycles */
+	uint64_t interval_tsc;
+	/** TSC timestamp at which the current window started */
+	uint64_t window_start;
+	/** poll counter used to limit TSC reads to 1 in GOVERNOR_POLL_CHECK */
+	uint64_t n_polls;
+	/** current distance from the maximum core frequency, in steps */
+	uint32_t cur_step;
+	/** deepest step the latency budget allows */
+	uint32_t max_step;
+	/** number of uncore frequency indexes of (uncore_pkg, uncore_die) */
+	uint32_t uncore_nb_freqs;
+	/** consecutive windows in which all queues were idle */
+	uint32_t idle_windows;
+	bool enabled;
+};
+
+static struct governor_state governors[RTE_MAX_LCORE];
+/* serializes uncore frequency updates between lcore governors */
+static rte_spinlock_t governor_uncore_lock = RTE_SPINLOCK_INITIALIZER;
+
+/*
+ * The uncore is shared between all lcores on a die, so each governor only
+ * votes for the uncore frequency step it can tolerate and the shallowest
+ * (i.e. highest frequency) vote wins.
+ */
+static void
+governor_apply_uncore(struct governor_state *gov)
+{
+	const struct rte_power_pmd_mgmt_governor_params *prm = &gov->params;
+	uint32_t vote, step;
+	unsigned int i;
+
+	rte_spinlock_lock(&governor_uncore_lock);
+
+	vote = UINT32_MAX;
+	for (i = 0; i < RTE_MAX_LCORE; i++) {
+		const struct governor_state *cur = &governors[i];
+
+		if (!cur->enabled || !cur->params.manage_uncore)
+			continue;
+		if (cur->params.uncore_pkg != prm->uncore_pkg ||
+				cur->params.uncore_die != prm->uncore_die)
+			continue;
+
+		/* scale the core step to the uncore frequency range */
+		step = cur->max_step == 0 ? 0 :
+			cur->cur_step * (cur->uncore_nb_freqs - 1) / cur->max_step;
+		vote = RTE_MIN(vote, step);
+	}
+
+	if (vote != UINT32_MAX)
+		rte_power_set_uncore_freq(prm->uncore_pkg, prm->uncore_die, vote);
+
+	rte_spinlock_unlock(&governor_uncore_lock);
+}
+
+static void
+governor_evaluate(struct pmd_core_cfg *cfg, struct governor_state *gov,
+		const uint64_t now)
+{
+	struct queue_list_entry *qle;
+	unsigned int min_ratio = 100;
+
+	/* combine all queues - the busiest one governs the whole lcore */
+	TAILQ_FOREACH(qle, &cfg->head, next) {
+		if (qle->gov_polls != 0) {
+			const unsigned int ratio =
+				qle->gov_empty * 100 / qle->gov_polls;
+
+			min_ratio = RTE_MIN(min_ratio, ratio);
+		}
+		qle->gov_polls = 0;
+		qle->gov_empty = 0;
+	}
+	gov->window_start = now;
+
+	if (min_ratio < gov->params.busy_percent) {
+		/* traffic is back - restore full speed right away */
+		gov->idle_windows = 0;
+		if (gov->cur_step != 0) {
+			gov->cur_step = 0;
+			rte_power_freq_max(rte_lcore_id());
+			if (gov->params.manage_uncore)
+				governor_apply_uncore(gov);
+		}
+	} else if (min_ratio > gov->params.idle_percent) {
+		/* all queues idle - step down slowly to avoid flapping */
+		if (++gov->idle_windows < GOVERNOR_IDLE_WINDOWS)
+			return;
+		gov->idle_windows = 0;
+		if (gov->cur_step >= gov->max_step)
+			return;
+		gov->cur_step++;
+		rte_power_freq_down(rte_lcore_id());
+		if (gov->params.manage_uncore)
+			governor_apply_uncore(gov);
+	} else {
+		gov->idle_windows = 0;
+	}
+}
+
+static uint16_t
+clb_scale_governor(uint16_t port_id __rte_unused, uint16_t qidx __rte_unused,
+		struct rte_mbuf **pkts __rte_unused, uint16_t nb_rx,
+		uint16_t max_pkts __rte_unused, void *arg)
+{
+	struct queue_list_entry *queue_conf = arg;
+	struct governor_state *gov = &governors[rte_lcore_id()];
+	uint64_t now;
+
+	queue_conf->gov_polls++;
+	if (nb_rx == 0)
+		queue_conf->gov_empty++;
+
+	/* amortize the TSC read over many polls */
+	if (likely(++gov->n_polls % GOVERNOR_POLL_CHECK != 0))
+		return nb_rx;
+
+	now = rte_rdtsc();
+	if (now - gov->window_start >= gov->interval_tsc)
+		governor_evaluate(RTE_LCORE_VAR(lcore_cfgs), gov, now);
+
+	return nb_rx;
+}
+
+static int check_scale(unsigned int lcore);
+
+/*
+ * Estimate the wakeup penalty of running 'step' frequency steps below
+ * maximum as one cpufreq transition per step, and cap the scaling depth
+ * so the estimate stays within the configured latency budget.
+ */
+static uint32_t
+governor_max_step(unsigned int lcore_id, uint32_t latency_budget_us)
+{
+	uint32_t freqs[GOVERNOR_MAX_FREQS];
+	uint32_t nb_freqs, max_step, transition_ns = 0;
+	uint32_t cpu_id;
+	FILE *f;
+
+	nb_freqs = rte_power_freqs(lcore_id, freqs, RTE_DIM(freqs));
+	if (nb_freqs <= 1)
+		return 0;
+	max_step = nb_freqs - 1;
+
+	if (latency_budget_us == 0)
+		return max_step;
+
+	if (power_get_lcore_mapped_cpu_id(lcore_id, &cpu_id) < 0)
+		cpu_id = lcore_id;
+	if (open_core_sysfs_file(&f, "r", POWER_SYSFILE_TRANSITION_LATENCY,
+			cpu_id) == 0) {
+		if (read_core_sysfs_u32(f, &transition_ns) < 0)
+			transition_ns = 0;
+		fclose(f);
+	}
+	if (transition_ns == 0)
+		transition_ns = GOVERNOR_DEFAULT_TRANSITION_NS;
+
+	return RTE_MIN(max_step,
+			(uint32_t)(latency_budget_us * 1000ULL / transition_ns));
+}
+
+static int
+governor_enable(unsigned int lcore_id)
+{
+	struct governor_state *gov = &governors[lcore_id];
+	int ret;
+
+	ret = check_scale(lcore_id);
+	if (ret < 0)
+		return ret;
+
+	if (gov->params.manage_uncore) {
+		ret = rte_power_uncore_init(gov->params.uncore_pkg,
+				gov->params.uncore_die);
+		if (ret < 0) {
+			POWER_LOG(ERR, "Cannot init uncore on pkg %u die %u",
+					gov->params.uncore_pkg, gov->params.uncore_die);
+			rte_power_exit(lcore_id);
+			return ret;
+		}
+		ret = rte_power_uncore_get_num_freqs(gov->params.uncore_pkg,
+				gov->params.uncore_die);
+		if (ret <= 0) {
+			rte_power_uncore_exit(gov->params.uncore_pkg,
+					gov->params.uncore_die);
+			rte_power_exit(lcore_id);
+			return ret < 0 ? ret : -ENOTSUP;
+		}
+		gov->uncore_nb_freqs = ret;
+	}
+
+	gov->interval_tsc = gov->params.interval_us *
+			(rte_get_timer_hz() / US_PER_S);
+	gov->max_step = governor_max_step(lcore_id, gov->params.latency_budget_us);
+	gov->cur_step = 0;
+	gov->idle_windows = 0;
+	gov->n_polls = 0;
+	gov->window_start = rte_rdtsc();
+
+	/* start from a known state - maximum frequency */
+	rte_power_freq_max(lcore_id);
+	gov->enabled = true;
+	if (gov->params.manage_uncore)
+		governor_apply_uncore(gov);
+
+	return 0;
+}
+
+static void
+governor_disable(unsigned int lcore_id)
+{
+	struct governor_state *gov = &governors[lcore_id];
+
+	gov->enabled = false;
+	rte_power_freq_max(lcore_id);
+	rte_power_exit(lcore_id);
+	if (gov->params.manage_uncore) {
+		rte_power_uncore_freq_max(gov->params.uncore_pkg,
+				gov->params.uncore_die);
+		rte_power_uncore_exit(gov->params.uncore_pkg,
+				gov->params.uncore_die);
+	}
+}
+
 static void
 init_lcore_cfgs(void)
 {
@@ -583,6 +829,16 @@ rte_power_ethdev_pmgmt_queue_enable(unsigned int lcore_id, uint16_t port_id,
 
 		clb = clb_pause;
 		break;
+	case RTE_POWER_MGMT_TYPE_SCALE_GOVERNOR:
+		clb = clb_scale_governor;
+
+		/* we only have to check this when enabling first queue */
+		if (lcore_cfg->pwr_mgmt_state != PMD_MGMT_DISABLED)
+			break;
+		ret = governor_enable(lcore_id);
+		if (ret < 0)
+			goto end;
+		break;
 	default:
 		POWER_LOG(DEBUG, "Invalid power management type");
 		ret = -EINVAL;
@@ -679,6 +935,12 @@ rte_power_ethdev_pmgmt_queue_disable(unsigned int lcore_id,
 			rte_power_exit(lcore_id);
 		}
 		break;
+	case RTE_POWER_MGMT_TYPE_SCALE_GOVERNOR:
+		rte_eth_remove_rx_callback(port_id, queue_id, queue_cfg->cb);
+		/* disable power library on this lcore if this was last queue */
+		if (lcore_cfg->pwr_mgmt_state == PMD_MGMT_DISABLED)
+			governor_disable(lcore_id);
+		break;
 	}
 	/*
 	 * the API doc mandates that the user stops all processing on affected
@@ -765,6 +1027,48 @@ rte_power_pmd_mgmt_set_scaling_freq_max(unsigned int lcore, unsigned int max)
 	return 0;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_power_pmd_mgmt_governor_set_params, 25.07)
+int
+rte_power_pmd_mgmt_governor_set_params(unsigned int lcore,
+		const struct rte_power_pmd_mgmt_governor_params *params)
+{
+	if (lcore >= RTE_MAX_LCORE || params == NULL) {
+		POWER_LOG(ERR, "Invalid lcore ID or params");
+		return -EINVAL;
+	}
+
+	if (params->interval_us == 0 || params->busy_percent > 100 ||
+			params->idle_percent > 100 ||
+			params->busy_percent >= params->idle_percent) {
+		POWER_LOG(ERR, "Invalid governor thresholds");
+		return -EINVAL;
+	}
+
+	if (governors[lcore].enabled) {
+		POWER_LOG(ERR, "Governor is enabled on lcore %u", lcore);
+		return -EBUSY;
+	}
+
+	governors[lcore].params = *params;
+
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_power_pmd_mgmt_governor_get_params, 25.07)
+int
+rte_power_pmd_mgmt_governor_get_params(unsigned int lcore,
+		struct rte_power_pmd_mgmt_governor_params *params)
+{
+	if (lcore >= RTE_MAX_LCORE || params == NULL) {
+		POWER_LOG(ERR, "Invalid lcore ID or params");
+		return -EINVAL;
+	}
+
+	*params = governors[lcore].params;
+
+	return 0;
+}
+
 RTE_EXPORT_SYMBOL(rte_power_pmd_mgmt_get_scaling_freq_min)
 int
 rte_power_pmd_mgmt_get_scaling_freq_min(unsigned int lcore)
@@ -807,5 +1111,10 @@ RTE_INIT(rte_power_ethdev_pmgmt_init) {
 	for (i = 0; i < RTE_MAX_LCORE; i++) {
 		scale_freq_min[i] = 0;
 		scale_freq_max[i] = UINT32_MAX;
+
+		/* governor defaults: 10ms window, no uncore, no latency cap */
+		governors[i].params.interval_us = 10 * 1000;
+		governors[i].params.busy_percent = 50;
+		governors[i].params.idle_percent = 95;
 	}
 }
@@ -10,6 +10,7 @@
  * RTE PMD Power Management
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include <rte_log.h>
@@ -29,6 +30,41 @@ enum rte_power_pmd_mgmt_type {
 	RTE_POWER_MGMT_TYPE_PAUSE,
 	/** Use frequency scaling when traffic is low */
 	RTE_POWER_MGMT_TYPE_SCALE,
+	/**
+	 * Use a closed-loop governor scaling core and uncore frequency
+	 * together, driven by empty-poll ratios of all queues on the lcore.
+	 */
+	RTE_POWER_MGMT_TYPE_SCALE_GOVERNOR,
+};
+
+/**
+ * Tunables for the RTE_POWER_MGMT_TYPE_SCALE_GOVERNOR management type.
+ */
+struct rte_power_pmd_mgmt_governor_params {
+	/** Evaluation window length, in microseconds. */
+	uint32_t interval_us;
+	/**
+	 * Scale up (to maximum frequency) when the empty poll ratio of the
+	 * busiest queue on the lcore drops below this percentage.
+	 */
+	uint8_t busy_percent;
+	/**
+	 * Scale down one frequency step when the empty poll ratios of all
+	 * queues on the lcore stay above this percentage for two
+	 * consecutive windows.
+	 */
+	uint8_t idle_percent;
+	/**
+	 * Maximum acceptable wakeup penalty, in microseconds, used to limit
+	 * how deep the governor may scale. Zero means no limit.
+	 */
+	uint32_t latency_budget_us;
+	/** Also scale uncore frequency of (uncore_pkg, uncore_die). */
+	bool manage_uncore;
+	/** Package whose uncore frequency is managed. */
+	unsigned int uncore_pkg;
+	/** Die whose uncore frequency is managed. */
+	unsigned int uncore_die;
 };
 
 /**
@@ -169,6 +205,49 @@ rte_power_pmd_mgmt_set_scaling_freq_max(unsigned int lcore, unsigned int max);
 int
 rte_power_pmd_mgmt_get_scaling_freq_min(unsigned int lcore);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Set the frequency governor tunables for an lcore.
+ *
+ * Must be called before enabling the RTE_POWER_MGMT_TYPE_SCALE_GOVERNOR
+ * management type on any queue polled by this lcore; defaults are used
+ * otherwise.
+ *
+ * @param lcore
+ *   The ID of the lcore to configure the governor for.
+ * @param params
+ *   The governor tunables.
+ * @return
+ *   0 on success
+ *   -EINVAL on invalid lcore or tunable values
+ *   -EBUSY if the governor is currently enabled on this lcore
+ */
+__rte_experimental
+int
+rte_power_pmd_mgmt_governor_set_params(unsigned int lcore,
+		const struct rte_power_pmd_mgmt_governor_params *params);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Get the current frequency governor tunables of an lcore.
+ *
+ * @param lcore
+ *   The ID of the lcore to get the governor tunables for.
+ * @param params
+ *   Structure to be filled with the governor tunables.
+ * @return
+ *   0 on success
+ *   <0 on error
+ */
+__rte_experimental
+int
+rte_power_pmd_mgmt_governor_get_params(unsigned int lcore,
+		struct rte_power_pmd_mgmt_governor_params *params);
+
 /**
  * Get the current configured max frequency used for frequency scaling.
  *
@@ -10,11 +10,18 @@
  * by the user of this library.
  */
 
+#include <stdbool.h>
+
 #include <rte_ring.h>
 #include <rte_ring_elem.h>
 
 #include "rte_rcu_qsbr.h"
 
+/* Number of resources dequeued from the defer queue in one go by the
+ * batched reclamation API.
+ */
+#define __RTE_QSBR_RECLAIM_BURST 32
+
 /* Defer queue structure.
  * This structure holds the defer queue. The defer queue is used to
  * hold the deleted entries from the data structure that are not
@@ -29,6 +36,12 @@ struct rte_rcu_qsbr_dq {
 	/**< Size (in bytes) of data, including the token, stored on the
 	 *   defer queue.
 	 */
+	uint32_t flags;
+	/**< Flags the queue was created with. */
+	uint32_t service_id;
+	/**< ID of the reclamation service, if one is registered. */
+	bool service_registered;
+	/**< Whether a reclamation service is registered for this queue. */
 	uint32_t trigger_reclaim_limit;
 	/**< Trigger automatic reclamation after the defer queue
 	 *   has at least these many resources waiting.
@@ -16,6 +16,8 @@
 #include <rte_malloc.h>
 #include <rte_errno.h>
 #include <rte_ring_elem.h>
+#include <rte_service_component.h>
+#include <rte_string_fns.h>
 
 #include "rte_rcu_qsbr.h"
 #include "rcu_qsbr_pvt.h"
@@ -308,10 +310,12 @@ rte_rcu_qsbr_dq_create(const struct rte_rcu_qsbr_dq_parameters *params)
 	dq->v = params->v;
 	dq->size = params->size;
 	dq->esize = __RTE_QSBR_TOKEN_SIZE + params->esize;
+	dq->flags = params->flags;
 	dq->trigger_reclaim_limit = params->trigger_reclaim_limit;
 	dq->max_reclaim_size = params->max_reclaim_size;
 	dq->free_fn = params->free_fn;
 	dq->p = params->p;
+	dq->service_registered = false;
 
 	return dq;
 }
@@ -427,6 +431,172 @@ rte_rcu_qsbr_dq_reclaim(struct rte_rcu_qsbr_dq *dq, unsigned int n,
 	return 0;
 }
 
+/* Reclaim resources from the defer queue, freeing them in batches. */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_rcu_qsbr_dq_reclaim_burst, 25.07)
+int
+rte_rcu_qsbr_dq_reclaim_burst(struct rte_rcu_qsbr_dq *dq, unsigned int n,
+			unsigned int *freed, unsigned int *pending,
+			unsigned int *available)
+{
+	__rte_rcu_qsbr_dq_elem_t *dq_elem;
+	uint32_t elem_sz, cnt, deq, take;
+
+	if (dq == NULL || n == 0) {
+		RCU_LOG(ERR, "Invalid input parameter");
+		rte_errno = EINVAL;
+
+		return 1;
+	}
+
+	elem_sz = dq->esize - __RTE_QSBR_TOKEN_SIZE;
+	cnt = 0;
+
+	char *data = alloca(dq->esize * __RTE_QSBR_RECLAIM_BURST);
+	char *elems = alloca(elem_sz * __RTE_QSBR_RECLAIM_BURST);
+	/* Check reader threads quiescent state and reclaim resources */
+	while (cnt < n) {
+		uint32_t burst = RTE_MIN(n - cnt,
+				(unsigned int)__RTE_QSBR_RECLAIM_BURST);
+
+		deq = rte_ring_dequeue_burst_elem_start(dq->r, data,
+					dq->esize, burst, available);
+		if (deq == 0)
+			break;
+
+		/* Find out how large a prefix of this burst has its grace
+		 * period over. Tokens may be enqueued slightly out of order,
+		 * so each one has to be checked, but checks against already
+		 * acknowledged tokens are cheap.
+		 */
+		for (take = 0; take < deq; take++) {
+			dq_elem = (__rte_rcu_qsbr_dq_elem_t *)
+					(data + take * dq->esize);
+			if (rte_rcu_qsbr_check(dq->v, dq_elem->token,
+					false) != 1)
+				break;
+
+			/* Compact the resources into one contiguous array
+			 * for the free function.
+			 */
+			memcpy(elems + take * elem_sz, dq_elem->elem, elem_sz);
+		}
+
+		/* Only the entries whose grace period is over leave the ring */
+		rte_ring_dequeue_elem_finish(dq->r, take);
+		if (take == 0)
+			break;
+
+		RCU_LOG(INFO, "Reclaimed %u resources in one batch", take);
+
+		dq->free_fn(dq->p, elems, take);
+
+		cnt += take;
+		/* Grace period of the next entry is not over yet */
+		if (take < deq)
+			break;
+	}
+
+	RCU_LOG(INFO, "Reclaimed %u resources", cnt);
+
+	if (freed != NULL)
+		*freed = cnt;
+	if (pending != NULL)
+		*pending = rte_ring_count(dq->r);
+
+	return 0;
+}
+
+/* Service function running the batched reclaim on a service lcore. */
+static int32_t
+rcu_qsbr_dq_service_run(void *args)
+{
+	struct rte_rcu_qsbr_dq *dq = args;
+
+	return rte_rcu_qsbr_dq_reclaim_burst(dq, dq->max_reclaim_size,
+				NULL, NULL, NULL) == 0 ? 0 : -EINVAL;
+}
+
+/* Register a service to reclaim resources from the defer queue. */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_rcu_qsbr_dq_service_register, 25.07)
+int
+rte_rcu_qsbr_dq_service_register(struct rte_rcu_qsbr_dq *dq,
+			uint32_t *service_id)
+{
+	struct rte_service_spec service;
+	int ret;
+
+	if (dq == NULL || dq->service_registered) {
+		RCU_LOG(ERR, "Invalid input parameter");
+		rte_errno = EINVAL;
+
+		return 1;
+	}
+
+	/* Reclamation needs a valid batch size even when automatic
+	 * reclamation in enqueue is turned off.
+	 */
+	if (dq->max_reclaim_size == 0) {
+		RCU_LOG(ERR, "Invalid max_reclaim_size for service reclaim");
+		rte_errno = EINVAL;
+
+		return 1;
+	}
+
+	memset(&service, 0, sizeof(service));
+	strlcpy(service.name, dq->r->name, sizeof(service.name));
+	service.callback = rcu_qsbr_dq_service_run;
+	service.callback_userdata = dq;
+	service.socket_id = SOCKET_ID_ANY;
+	/* Ring dequeue is HTS, so reclamation from multiple service cores
+	 * is safe unless the queue was created multi-thread unsafe.
+	 */
+	if ((dq->flags & RTE_RCU_QSBR_DQ_MT_UNSAFE) == 0)
+		service.capabilities = RTE_SERVICE_CAP_MT_SAFE;
+
+	ret = rte_service_component_register(&service, &dq->service_id);
+	if (ret != 0) {
+		RCU_LOG(ERR, "Reclamation service register failed");
+		rte_errno = -ret;
+
+		return 1;
+	}
+
+	rte_service_component_runstate_set(dq->service_id, 1);
+	dq->service_registered = true;
+
+	if (service_id != NULL)
+		*service_id = dq->service_id;
+
+	return 0;
+}
+
+/* Unregister the reclamation service of a defer queue. */
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_rcu_qsbr_dq_service_unregister, 25.07)
+int
+rte_rcu_qsbr_dq_service_unregister(struct rte_rcu_qsbr_dq *dq)
+{
+	int ret;
+
+	if (dq == NULL || !dq->service_registered) {
+		RCU_LOG(ERR, "Invalid input parameter");
+		rte_errno = EINVAL;
+
+		return 1;
+	}
+
+	rte_service_component_runstate_set(dq->service_id, 0);
+	ret = rte_service_component_unregister(dq->service_id);
+	if (ret != 0) {
+		RCU_LOG(ERR, "Reclamation service unregister failed");
+		rte_errno = -ret;
+
+		return 1;
+	}
+	dq->service_registered = false;
+
+	return 0;
+}
+
 /* Delete a defer queue. */
 RTE_EXPORT_SYMBOL(rte_rcu_qsbr_dq_delete)
 int
@@ -440,6 +610,10 @@ rte_rcu_qsbr_dq_delete(struct rte_rcu_qsbr_dq *dq)
 		return 0;
 	}
 
+	if (dq->service_registered &&
+	    rte_rcu_qsbr_dq_service_unregister(dq) != 0)
+		return 1;
+
 	/* Reclaim all the resources */
 	rte_rcu_qsbr_dq_reclaim(dq, ~0, NULL, &pending, NULL);
 	if (pending != 0) {
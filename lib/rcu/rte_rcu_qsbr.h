@@ -121,9 +121,12 @@ struct __rte_cache_aligned rte_rcu_qsbr {
  * @param p
  *   Pointer provided while creating the defer queue
  * @param e
- *   Pointer to the resource data stored on the defer queue
+ *   Pointer to the resource data stored on the defer queue. When 'n' is
+ *   larger than 1, this is a contiguous array of 'n' resources, each of
+ *   the element size provided when the defer queue was created.
  * @param n
- *   Number of resources to free. Currently, this is set to 1.
+ *   Number of resources to free. rte_rcu_qsbr_dq_reclaim() always sets
+ *   this to 1, rte_rcu_qsbr_dq_reclaim_burst() passes whole batches.
  *
  * @return
  *   None
@@ -799,6 +802,97 @@ int
 rte_rcu_qsbr_dq_reclaim(struct rte_rcu_qsbr_dq *dq, unsigned int n,
 	unsigned int *freed, unsigned int *pending, unsigned int *available);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Free resources from the defer queue, in batches.
+ *
+ * Unlike rte_rcu_qsbr_dq_reclaim(), resources are dequeued from the defer
+ * queue in bursts and the free function is called once per burst, with a
+ * contiguous array of resources whose grace period is over. This allows
+ * the free function to use bulk APIs, such as rte_mempool_put_bulk(), and
+ * reduces the number of ring operations when reclaiming a backlog.
+ *
+ * The registered free function must be able to handle more than one
+ * resource per call.
+ *
+ * This API is multi-thread safe.
+ *
+ * @param dq
+ *   Defer queue to free entries from.
+ * @param n
+ *   Maximum number of resources to free.
+ * @param freed
+ *   Number of resources that were freed.
+ * @param pending
+ *   Number of resources pending on the defer queue. This number might not
+ *   be accurate if multi-thread safety is configured.
+ * @param available
+ *   Number of resources that can be added to the defer queue.
+ *   This number might not be accurate if multi-thread safety is configured.
+ * @return
+ *   On successful reclamation of at least 1 resource - 0
+ *   On error - 1 with rte_errno set to
+ *   - EINVAL - NULL parameters are passed
+ */
+__rte_experimental
+int
+rte_rcu_qsbr_dq_reclaim_burst(struct rte_rcu_qsbr_dq *dq, unsigned int n,
+	unsigned int *freed, unsigned int *pending, unsigned int *available);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Register a service that reclaims resources from the defer queue.
+ *
+ * The service calls rte_rcu_qsbr_dq_reclaim_burst() with the
+ * 'max_reclaim_size' configured for the queue each time it runs, so
+ * reclamation can be offloaded to service cores instead of being done
+ * opportunistically on the writer's enqueue path. The registered free
+ * function must be able to handle more than one resource per call.
+ *
+ * The caller is responsible for mapping the service to service lcores
+ * using its ID, see rte_service_map_lcore_set().
+ *
+ * @param dq
+ *   Defer queue to reclaim resources from.
+ * @param service_id
+ *   Location to store the ID of the registered service. Can be NULL.
+ * @return
+ *   On success - 0
+ *   On error - 1 with rte_errno set to
+ *   - EINVAL - dq is NULL, a service is already registered, or the queue
+ *		was created with 'max_reclaim_size' of 0.
+ *   - ENOMEM - no free service slots
+ */
+__rte_experimental
+int
+rte_rcu_qsbr_dq_service_register(struct rte_rcu_qsbr_dq *dq,
+	uint32_t *service_id);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Unregister the reclamation service of a defer queue.
+ *
+ * The service must be unmapped from all service lcores before this is
+ * called. rte_rcu_qsbr_dq_delete() unregisters the service automatically.
+ *
+ * @param dq
+ *   Defer queue the service was registered for.
+ * @return
+ *   On success - 0
+ *   On error - 1 with rte_errno set to
+ *   - EINVAL - dq is NULL or no service is registered
+ *   - EBUSY - the service is still mapped to a service lcore
+ */
+__rte_experimental
+int
+rte_rcu_qsbr_dq_service_unregister(struct rte_rcu_qsbr_dq *dq);
+
 /**
  * Delete a defer queue.
  *
@@ -1543,6 +1543,119 @@ rte_regexdev_dequeue_burst(uint8_t dev_id, uint16_t qp_id,
 	return (*dev->dequeue)(dev, qp_id, ops, nb_ops);
 }
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Extract the matches of a dequeued burst into structure-of-arrays
+ * (SoA) output buffers.
+ *
+ * The matches reported by the RegEx device are embedded per-op as an
+ * array of *rte_regexdev_match* structures. This helper scatters them
+ * into separate *rule_id*, *group_id*, *start_offset* and *len* arrays
+ * so the application can post-filter a whole burst with vectorized
+ * code (e.g. masking out rule groups) instead of walking each op's
+ * match array one tuple at a time.
+ *
+ * Matches are written in op order; *nb_op_matches[i]* receives the
+ * number of entries written for *ops[i]* so the caller can map entries
+ * back to ops. Extraction stops once *max_matches* entries have been
+ * written; the remaining per-op counts are set to zero.
+ *
+ * @param ops
+ *   The address of an array of *nb_ops* pointers to dequeued
+ *   *rte_regex_ops* structures.
+ * @param nb_ops
+ *   The number of operations in the *ops* array.
+ * @param[out] rule_id
+ *   Array of at least *max_matches* entries to receive the rule
+ *   identifier of each match.
+ * @param[out] group_id
+ *   Array of at least *max_matches* entries to receive the group
+ *   identifier of each match. May be NULL if not needed.
+ * @param[out] start_offset
+ *   Array of at least *max_matches* entries to receive the starting
+ *   byte position of each match.
+ * @param[out] len
+ *   Array of at least *max_matches* entries to receive the length of
+ *   each match in bytes.
+ * @param[out] nb_op_matches
+ *   Array of *nb_ops* entries to receive the number of matches
+ *   extracted for each op.
+ * @param max_matches
+ *   The capacity of the *rule_id*, *group_id*, *start_offset* and
+ *   *len* arrays.
+ *
+ * @return
+ *   The total number of matches written to the output arrays.
+ */
+__rte_experimental
+static inline uint16_t
+rte_regexdev_ops_extract_matches(struct rte_regex_ops **ops, uint16_t nb_ops,
+				 uint32_t *rule_id, uint32_t *group_id,
+				 uint16_t *start_offset, uint16_t *len,
+				 uint16_t *nb_op_matches, uint16_t max_matches)
+{
+	uint16_t total = 0;
+	uint16_t i, j, nb;
+
+	for (i = 0; i < nb_ops; i++) {
+		nb = ops[i]->nb_matches;
+		if (nb > (uint16_t)(max_matches - total))
+			nb = max_matches - total;
+		for (j = 0; j < nb; j++) {
+			const struct rte_regexdev_match *m =
+				&ops[i]->matches[j];
+
+			rule_id[total + j] = m->rule_id;
+			if (group_id != NULL)
+				group_id[total + j] = m->group_id;
+			start_offset[total + j] = m->start_offset;
+			len[total + j] = m->len;
+		}
+		nb_op_matches[i] = nb;
+		total += nb;
+	}
+	return total;
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Re-arm a burst of previously used ops for a new enqueue.
+ *
+ * Clears the response fields written by the RegEx device on the
+ * previous scan and attaches a new source mbuf to each op, keeping the
+ * request fields (*req_flags*, group identifiers, *user_id*) intact.
+ * This lets an application recycle a fixed working set of ops across
+ * bursts without re-initializing the request half of each structure.
+ *
+ * @param ops
+ *   The address of an array of *nb_ops* pointers to *rte_regex_ops*
+ *   structures to re-arm.
+ * @param mbufs
+ *   The address of an array of *nb_ops* pointers to the source mbufs
+ *   to scan, one per op.
+ * @param nb_ops
+ *   The number of operations to re-arm.
+ */
+__rte_experimental
+static inline void
+rte_regexdev_ops_rearm(struct rte_regex_ops **ops, struct rte_mbuf **mbufs,
+		       uint16_t nb_ops)
+{
+	uint16_t i;
+
+	for (i = 0; i < nb_ops; i++) {
+		ops[i]->rsp_flags = 0;
+		ops[i]->nb_actual_matches = 0;
+		ops[i]->nb_matches = 0;
+		ops[i]->cross_buf_id = 0;
+		ops[i]->mbuf = mbufs[i];
+	}
+}
+
 #ifdef __cplusplus
 }
 #endif
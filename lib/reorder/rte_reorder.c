@@ -7,6 +7,7 @@
 #include <sys/queue.h>
 
 #include <eal_export.h>
+#include <rte_bitops.h>
 #include <rte_string_fns.h>
 #include <rte_log.h>
 #include <rte_mbuf.h>
@@ -56,8 +57,69 @@ struct __rte_cache_aligned rte_reorder_buffer {
 
 	struct cir_buffer ready_buf; /**< temp buffer for dequeued entries */
 	struct cir_buffer order_buf; /**< buffer used to reorder entries */
+	uint64_t *ready_mask; /**< one bit per order_buf slot, set when filled */
 };
 
+/* Mark/unmark an order buffer slot in the ready bitmap */
+static inline void
+reorder_mask_set(struct rte_reorder_buffer *b, unsigned int pos)
+{
+	b->ready_mask[pos >> 6] |= UINT64_C(1) << (pos & 63);
+}
+
+static inline void
+reorder_mask_clear(struct rte_reorder_buffer *b, unsigned int pos)
+{
+	b->ready_mask[pos >> 6] &= ~(UINT64_C(1) << (pos & 63));
+}
+
+/* Clear [pos, pos + len) in the ready bitmap, a word at a time. The range
+ * must not wrap past the end of the order buffer.
+ */
+static inline void
+reorder_mask_clear_run(struct rte_reorder_buffer *b, unsigned int pos,
+		unsigned int len)
+{
+	while (len > 0) {
+		unsigned int bit = pos & 63;
+		unsigned int n = RTE_MIN(len, 64 - bit);
+		uint64_t m = (n == 64) ? UINT64_MAX : (UINT64_C(1) << n) - 1;
+
+		b->ready_mask[pos >> 6] &= ~(m << bit);
+		pos += n;
+		len -= n;
+	}
+}
+
+/* Length of the run of consecutively filled order buffer slots starting at
+ * pos, found by scanning the ready bitmap a word at a time. The result is
+ * capped at max and does not cross the physical end of the buffer, so the
+ * run can be copied out with a single memcpy.
+ */
+static inline unsigned int
+reorder_ready_run(const struct rte_reorder_buffer *b, unsigned int pos,
+		unsigned int max)
+{
+	unsigned int run = 0;
+
+	max = RTE_MIN(max, b->order_buf.size - pos);
+
+	while (run < max) {
+		unsigned int idx = pos + run;
+		unsigned int avail = 64 - (idx & 63);
+		uint64_t bits = ~(b->ready_mask[idx >> 6] >> (idx & 63));
+		unsigned int t = (bits == 0) ? 64 : rte_ctz64(bits);
+
+		if (t == 0)
+			break;
+		run += RTE_MIN(t, max - run);
+		if (t < avail)
+			break;
+	}
+
+	return run;
+}
+
 static void
 rte_reorder_free_mbufs(struct rte_reorder_buffer *b);
 
@@ -65,7 +127,8 @@ RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_reorder_memory_footprint_get, 23.07)
 unsigned int
 rte_reorder_memory_footprint_get(unsigned int size)
 {
-	return sizeof(struct rte_reorder_buffer) + (2 * size * sizeof(struct rte_mbuf *));
+	return sizeof(struct rte_reorder_buffer) + (2 * size * sizeof(struct rte_mbuf *)) +
+		(RTE_ALIGN_CEIL(size, 64) / 8);
 }
 
 RTE_EXPORT_SYMBOL(rte_reorder_init)
@@ -122,6 +185,8 @@ rte_reorder_init(struct rte_reorder_buffer *b, unsigned int bufsize,
 	b->ready_buf.entries = (void *)&b[1];
 	b->order_buf.entries = RTE_PTR_ADD(&b[1],
 			size * sizeof(b->ready_buf.entries[0]));
+	b->ready_mask = RTE_PTR_ADD(b->order_buf.entries,
+			size * sizeof(b->order_buf.entries[0]));
 
 	return b;
 }
@@ -340,6 +405,7 @@ rte_reorder_fill_overflow(struct rte_reorder_buffer *b, unsigned n)
 					order_buf->entries[order_buf->head];
 
 			order_buf->entries[order_buf->head] = NULL;
+			reorder_mask_clear(b, order_buf->head);
 			order_head_adv++;
 
 			order_buf->head = (order_buf->head + 1) & order_buf->mask;
@@ -405,6 +471,7 @@ rte_reorder_insert(struct rte_reorder_buffer *b, struct rte_mbuf *mbuf)
 	if (offset < b->order_buf.size) {
 		position = (order_buf->head + offset) & order_buf->mask;
 		order_buf->entries[position] = mbuf;
+		reorder_mask_set(b, position);
 	} else if (offset < 2 * b->order_buf.size) {
 		if (rte_reorder_fill_overflow(b, offset + 1 - order_buf->size)
 				< (offset + 1 - order_buf->size)) {
@@ -415,6 +482,7 @@ rte_reorder_insert(struct rte_reorder_buffer *b, struct rte_mbuf *mbuf)
 		offset = *rte_reorder_seqn(mbuf) - b->min_seqn;
 		position = (order_buf->head + offset) & order_buf->mask;
 		order_buf->entries[position] = mbuf;
+		reorder_mask_set(b, position);
 	} else {
 		/* Put in handling for enqueue straight to output */
 		rte_errno = ERANGE;
@@ -423,6 +491,48 @@ rte_reorder_insert(struct rte_reorder_buffer *b, struct rte_mbuf *mbuf)
 	return 0;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_reorder_insert_bulk, 25.07)
+unsigned int
+rte_reorder_insert_bulk(struct rte_reorder_buffer *b, struct rte_mbuf **mbufs,
+		unsigned int n)
+{
+	uint32_t ref;
+	unsigned int i, j;
+
+	if (b == NULL || mbufs == NULL) {
+		rte_errno = EINVAL;
+		return 0;
+	}
+	if (n == 0)
+		return 0;
+
+	/*
+	 * Sort the burst by sequence number (in place, insertion sort - bursts
+	 * are small), so the window shifts at most once per call and the
+	 * inserts walk the order buffer in a single forward pass. The keys are
+	 * offsets from a common reference to keep the comparison wrap-safe.
+	 */
+	ref = b->is_initialized ? b->min_seqn : *rte_reorder_seqn(mbufs[0]);
+
+	for (i = 1; i < n; i++) {
+		struct rte_mbuf *m = mbufs[i];
+		uint32_t key = *rte_reorder_seqn(m) - ref;
+
+		for (j = i; j > 0 &&
+				(*rte_reorder_seqn(mbufs[j - 1]) - ref) > key;
+				j--)
+			mbufs[j] = mbufs[j - 1];
+		mbufs[j] = m;
+	}
+
+	for (i = 0; i < n; i++) {
+		if (rte_reorder_insert(b, mbufs[i]) != 0)
+			break;
+	}
+
+	return i;
+}
+
 RTE_EXPORT_SYMBOL(rte_reorder_drain)
 unsigned int
 rte_reorder_drain(struct rte_reorder_buffer *b, struct rte_mbuf **mbufs,
@@ -442,14 +552,26 @@ rte_reorder_drain(struct rte_reorder_buffer *b, struct rte_mbuf **mbufs,
 
 	/*
 	 * If requested number of buffers not fetched from ready buffer, fetch
-	 * remaining buffers from order buffer
+	 * remaining buffers from order buffer. The ready bitmap gives the
+	 * length of each run of consecutively filled slots, so whole runs are
+	 * copied out at once instead of checking entries one by one.
 	 */
-	while ((drain_cnt < max_mbufs) &&
-			(order_buf->entries[order_buf->head] != NULL)) {
-		mbufs[drain_cnt++] = order_buf->entries[order_buf->head];
-		order_buf->entries[order_buf->head] = NULL;
-		b->min_seqn++;
-		order_buf->head = (order_buf->head + 1) & order_buf->mask;
+	while (drain_cnt < max_mbufs) {
+		unsigned int run = reorder_ready_run(b, order_buf->head,
+				max_mbufs - drain_cnt);
+
+		if (run == 0)
+			break;
+
+		memcpy(&mbufs[drain_cnt], &order_buf->entries[order_buf->head],
+				run * sizeof(order_buf->entries[0]));
+		memset(&order_buf->entries[order_buf->head], 0,
+				run * sizeof(order_buf->entries[0]));
+		reorder_mask_clear_run(b, order_buf->head, run);
+
+		drain_cnt += run;
+		b->min_seqn += run;
+		order_buf->head = (order_buf->head + run) & order_buf->mask;
 	}
 
 	return drain_cnt;
@@ -527,6 +649,7 @@ rte_reorder_drain_up_to_seqn(struct rte_reorder_buffer *b, struct rte_mbuf **mbu
 			continue;
 		mbufs[drain_cnt++] = order_buf->entries[position];
 		order_buf->entries[position] = NULL;
+		reorder_mask_clear(b, position);
 	}
 	b->min_seqn += i;
 	order_buf->head = (order_buf->head + i) & order_buf->mask;
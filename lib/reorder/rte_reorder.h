@@ -148,6 +148,33 @@ rte_reorder_reset(struct rte_reorder_buffer *b);
 int
 rte_reorder_insert(struct rte_reorder_buffer *b, struct rte_mbuf *mbuf);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice
+ *
+ * Insert a burst of mbufs into the reorder buffer.
+ *
+ * The burst is first sorted in place by sequence number, so the reorder
+ * window is shifted at most once per call and the entries are placed in a
+ * single forward pass; prefer this over per-mbuf rte_reorder_insert() calls
+ * when packets arrive in bursts.
+ *
+ * @param b
+ *   Reorder buffer where the mbufs have to be inserted.
+ * @param mbufs
+ *   Array of mbufs to insert; reordered (sorted) in place by this call.
+ * @param n
+ *   The number of elements in the mbufs array.
+ * @return
+ *   Number of mbufs inserted, in sorted order, from the start of the array.
+ *   On partial insertion, rte_errno is set by the failing insert as for
+ *   rte_reorder_insert() and the remaining mbufs are left to the caller.
+ */
+__rte_experimental
+unsigned int
+rte_reorder_insert_bulk(struct rte_reorder_buffer *b, struct rte_mbuf **mbufs,
+		unsigned int n);
+
 /**
  * Fetch reordered buffers
  *
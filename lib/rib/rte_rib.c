@@ -12,6 +12,7 @@
 #include <rte_errno.h>
 #include <rte_malloc.h>
 #include <rte_mempool.h>
+#include <rte_prefetch.h>
 #include <rte_string_fns.h>
 #include <rte_tailq.h>
 
@@ -122,6 +123,60 @@ rte_rib_lookup(struct rte_rib *rib, uint32_t ip)
 	return prev;
 }
 
+/* Number of lookups walked in lockstep by rte_rib_lookup_bulk() */
+#define RIB_LOOKUP_BULK_CHUNK	8
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_rib_lookup_bulk, 25.07)
+int
+rte_rib_lookup_bulk(struct rte_rib *rib, const uint32_t *ips,
+	struct rte_rib_node **nodes, unsigned int n)
+{
+	struct rte_rib_node *cur[RIB_LOOKUP_BULK_CHUNK];
+	unsigned int i, j, sz, active;
+
+	if (unlikely(rib == NULL || ips == NULL || nodes == NULL)) {
+		rte_errno = EINVAL;
+		return -EINVAL;
+	}
+
+	for (i = 0; i < n; i += sz) {
+		sz = RTE_MIN(n - i, (unsigned int)RIB_LOOKUP_BULK_CHUNK);
+		for (j = 0; j < sz; j++) {
+			cur[j] = rib->tree;
+			nodes[i + j] = NULL;
+			if (cur[j] != NULL)
+				rte_prefetch0(cur[j]);
+		}
+		/*
+		 * Descend all lanes of the chunk one level per pass, so a
+		 * node prefetched on the previous pass has time to arrive
+		 * in cache before it is dereferenced.
+		 */
+		do {
+			active = 0;
+			for (j = 0; j < sz; j++) {
+				uint32_t ip = ips[i + j];
+
+				if (cur[j] == NULL)
+					continue;
+				if (!is_covered(ip, cur[j]->ip,
+						cur[j]->depth)) {
+					cur[j] = NULL;
+					continue;
+				}
+				if (is_valid_node(cur[j]))
+					nodes[i + j] = cur[j];
+				cur[j] = get_nxt_node(cur[j], ip);
+				if (cur[j] != NULL) {
+					rte_prefetch0(cur[j]);
+					active++;
+				}
+			}
+		} while (active != 0);
+	}
+	return 0;
+}
+
 RTE_EXPORT_SYMBOL(rte_rib_lookup_parent)
 struct rte_rib_node *
 rte_rib_lookup_parent(struct rte_rib_node *ent)
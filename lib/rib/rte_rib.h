@@ -77,6 +77,34 @@ rte_rib_depth_to_mask(uint8_t depth)
 struct rte_rib_node *
 rte_rib_lookup(struct rte_rib *rib, uint32_t ip);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Lookup multiple IPs into the RIB structure.
+ * Equivalent to calling rte_rib_lookup() for every element of ips, but
+ * traverses the trie for several addresses in lockstep with node
+ * prefetching to hide the pointer chasing latency.
+ *
+ * @param rib
+ *  RIB object handle
+ * @param ips
+ *  array of IPs to be looked up in the RIB
+ * @param nodes
+ *  array of pointers to struct rte_rib_node filled by the lookup.
+ *  nodes[i] points to the best matched route for ips[i]
+ *  or is NULL if there is no matched route
+ * @param n
+ *  number of elements in ips (and nodes) array to lookup
+ * @return
+ *  0 on success
+ *  -EINVAL on failure with rte_errno indicating reason for failure
+ */
+__rte_experimental
+int
+rte_rib_lookup_bulk(struct rte_rib *rib, const uint32_t *ips,
+	struct rte_rib_node **nodes, unsigned int n);
+
 /**
  * Lookup less specific route into the RIB structure
  *
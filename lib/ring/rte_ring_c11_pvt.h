@@ -19,6 +19,15 @@
  * For more information please refer to <rte_ring.h>.
  */
 
+/*
+ * Cap (in rte_pause() iterations) on the exponential backoff performed
+ * between failed CAS attempts on the head index. Without any backoff,
+ * back-to-back retries from many lcores keep the head cache line in
+ * constant contention and dequeue throughput collapses once more than
+ * a dozen consumers spin on the same ring.
+ */
+#define __RTE_RING_HEAD_BACKOFF_MAX 64
+
 /**
  * @internal This function updates tail values.
  */
@@ -75,7 +84,8 @@ __rte_ring_headtail_move_head(struct rte_ring_headtail *d,
 {
 	uint32_t stail;
 	int success;
-	unsigned int max = n;
+	unsigned int i, max = n;
+	unsigned int backoff = 1;
 
 	*old_head = rte_atomic_load_explicit(&d->head,
 			rte_memory_order_relaxed);
@@ -111,12 +121,25 @@ __rte_ring_headtail_move_head(struct rte_ring_headtail *d,
 		if (is_st) {
 			d->head = *new_head;
 			success = 1;
-		} else
+		} else {
 			/* on failure, *old_head is updated */
 			success = rte_atomic_compare_exchange_strong_explicit(
 					&d->head, old_head, *new_head,
 					rte_memory_order_relaxed,
 					rte_memory_order_relaxed);
+			if (unlikely(success == 0)) {
+				/*
+				 * Back off progressively longer after each
+				 * failed CAS, so that under heavy contention
+				 * one thread makes progress while the others
+				 * stay off the cache line.
+				 */
+				for (i = 0; i != backoff; i++)
+					rte_pause();
+				backoff = RTE_MIN(backoff * 2,
+						(unsigned int)__RTE_RING_HEAD_BACKOFF_MAX);
+			}
+		}
 	} while (unlikely(success == 0));
 	return n;
 }
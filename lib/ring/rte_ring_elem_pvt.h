@@ -123,6 +123,32 @@ __rte_ring_enqueue_elems_128(void *ring_table, const void *obj_table,
 	}
 }
 
+/* Copy path for elements whose size is a multiple of 16B: the ring
+ * content is contiguous except for at most one wrap-around point, so
+ * each segment can be handed to memcpy as a single large copy, which
+ * the compiler expands with the widest vector loads/stores available
+ * for the target. This beats the normalized 32-bit scalar loop roughly
+ * in proportion to the vector width once esize exceeds a cache line.
+ */
+static __rte_always_inline void
+__rte_ring_enqueue_elems_seg(void *ring_table, const void *obj_table,
+	uint32_t size, uint32_t idx, uint32_t esize, uint32_t n)
+{
+	uint8_t *ring = (uint8_t *)ring_table;
+	const uint8_t *obj = (const uint8_t *)obj_table;
+	uint32_t nf;
+
+	if (likely(idx + n <= size)) {
+		memcpy(ring + (size_t)idx * esize, obj, (size_t)n * esize);
+	} else {
+		/* Number of elements fitting before the wrap-around point */
+		nf = size - idx;
+		memcpy(ring + (size_t)idx * esize, obj, (size_t)nf * esize);
+		memcpy(ring, obj + (size_t)nf * esize,
+			(size_t)(n - nf) * esize);
+	}
+}
+
 /* the actual enqueue of elements on the ring.
  * Placed here since identical code needed in both
  * single and multi producer enqueue functions.
@@ -140,6 +166,9 @@ __rte_ring_do_enqueue_elems(void *ring_table, const void *obj_table,
 	else if (esize == 16)
 		__rte_ring_enqueue_elems_128(ring_table, obj_table, size,
 				idx, num);
+	else if ((esize & 0xf) == 0)
+		__rte_ring_enqueue_elems_seg(ring_table, obj_table, size,
+				idx, esize, num);
 	else {
 		uint32_t scale, nr_idx, nr_num, nr_size;
 
@@ -261,6 +290,26 @@ __rte_ring_dequeue_elems_128(void *obj_table, const void *ring_table,
 	}
 }
 
+/* Counterpart of __rte_ring_enqueue_elems_seg for the dequeue side. */
+static __rte_always_inline void
+__rte_ring_dequeue_elems_seg(void *obj_table, const void *ring_table,
+	uint32_t size, uint32_t idx, uint32_t esize, uint32_t n)
+{
+	uint8_t *obj = (uint8_t *)obj_table;
+	const uint8_t *ring = (const uint8_t *)ring_table;
+	uint32_t nf;
+
+	if (likely(idx + n <= size)) {
+		memcpy(obj, ring + (size_t)idx * esize, (size_t)n * esize);
+	} else {
+		/* Number of elements fitting before the wrap-around point */
+		nf = size - idx;
+		memcpy(obj, ring + (size_t)idx * esize, (size_t)nf * esize);
+		memcpy(obj + (size_t)nf * esize, ring,
+			(size_t)(n - nf) * esize);
+	}
+}
+
 /* the actual dequeue of elements from the ring.
  * Placed here since identical code needed in both
  * single and multi producer enqueue functions.
@@ -278,6 +327,9 @@ __rte_ring_do_dequeue_elems(void *obj_table, const void *ring_table,
 	else if (esize == 16)
 		__rte_ring_dequeue_elems_128(obj_table, ring_table, size,
 				idx, num);
+	else if ((esize & 0xf) == 0)
+		__rte_ring_dequeue_elems_seg(obj_table, ring_table, size,
+				idx, esize, num);
 	else {
 		uint32_t scale, nr_idx, nr_num, nr_size;
 
@@ -12,12 +12,18 @@
 
 #include <rte_stdatomic.h>
 
+#ifdef RTE_RING_WAIT_BACKOFF
+#include <rte_wait_backoff.h>
+#endif
+
 /**
  * @file rte_ring_hts_elem_pvt.h
  * It is not recommended to include this file directly,
  * include <rte_ring.h> instead.
  * Contains internal helper functions for head/tail sync (HTS) ring mode.
  * For more information please refer to <rte_ring_hts.h>.
+ * Defining RTE_RING_WAIT_BACKOFF before inclusion switches the head
+ * wait loop to the adaptive backoff helpers of <rte_wait_backoff.h>.
  */
 
 /**
@@ -44,10 +50,22 @@ static __rte_always_inline void
 __rte_ring_hts_head_wait(const struct rte_ring_hts_headtail *ht,
 		union __rte_ring_hts_pos *p)
 {
+#ifdef RTE_RING_WAIT_BACKOFF
+	struct rte_wait_backoff wb;
+
+	rte_wait_backoff_init(&wb, NULL);
+	while (p->pos.head != p->pos.tail) {
+		rte_wait_backoff_until_change(&wb,
+			(volatile void *)(uintptr_t)&ht->ht.raw, p->raw,
+			UINT64_MAX, sizeof(p->raw));
+		p->raw = rte_atomic_load_explicit(&ht->ht.raw, rte_memory_order_acquire);
+	}
+#else
 	while (p->pos.head != p->pos.tail) {
 		rte_pause();
 		p->raw = rte_atomic_load_explicit(&ht->ht.raw, rte_memory_order_acquire);
 	}
+#endif
 }
 
 /**
@@ -0,0 +1,153 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2025 Intel Corporation
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <eal_export.h>
+#include <rte_errno.h>
+#include <rte_lcore.h>
+#include <rte_malloc.h>
+#include <rte_string_fns.h>
+
+#include "rte_ring.h"
+#include "rte_ring_numa.h"
+
+/*
+ * Return the index of the shard local to the calling thread, or 0 for
+ * threads without a known socket (e.g. unregistered non-EAL threads).
+ */
+static inline uint32_t
+local_shard(const struct rte_ring_numa *nr)
+{
+	int socket = rte_socket_id();
+
+	if (socket == SOCKET_ID_ANY || socket >= RTE_MAX_NUMA_NODES)
+		return 0;
+	return nr->shard_idx[socket];
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_ring_numa_create, 25.07)
+struct rte_ring_numa *
+rte_ring_numa_create(const char *name, unsigned int count, unsigned int flags)
+{
+	char sname[RTE_RING_NAMESIZE];
+	struct rte_ring_numa *nr;
+	uint32_t i, nb_sockets;
+	int rc, socket;
+
+	nb_sockets = rte_socket_count();
+	if (nb_sockets == 0 || nb_sockets > RTE_MAX_NUMA_NODES) {
+		rte_errno = EINVAL;
+		return NULL;
+	}
+
+	nr = rte_zmalloc(NULL, sizeof(*nr), RTE_CACHE_LINE_SIZE);
+	if (nr == NULL) {
+		rte_errno = ENOMEM;
+		return NULL;
+	}
+
+	if (strlcpy(nr->name, name, sizeof(nr->name)) >= sizeof(nr->name)) {
+		rte_free(nr);
+		rte_errno = ENAMETOOLONG;
+		return NULL;
+	}
+
+	for (i = 0; i < nb_sockets; i++) {
+		socket = rte_socket_id_by_idx(i);
+		rc = snprintf(sname, sizeof(sname), "%s_s%u", name, i);
+		if (rc < 0 || rc >= (int)sizeof(sname)) {
+			rte_errno = ENAMETOOLONG;
+			goto fail;
+		}
+		nr->shards[i] = rte_ring_create(sname, count, socket, flags);
+		if (nr->shards[i] == NULL)
+			goto fail;
+		if (socket >= 0 && socket < RTE_MAX_NUMA_NODES)
+			nr->shard_idx[socket] = i;
+	}
+	nr->nb_shards = nb_sockets;
+
+	return nr;
+
+fail:
+	while (i-- != 0)
+		rte_ring_free(nr->shards[i]);
+	rte_free(nr);
+	return NULL;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_ring_numa_free, 25.07)
+void
+rte_ring_numa_free(struct rte_ring_numa *nr)
+{
+	uint32_t i;
+
+	if (nr == NULL)
+		return;
+
+	for (i = 0; i < nr->nb_shards; i++)
+		rte_ring_free(nr->shards[i]);
+	rte_free(nr);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_ring_numa_enqueue_burst, 25.07)
+unsigned int
+rte_ring_numa_enqueue_burst(struct rte_ring_numa *nr, void * const *obj_table,
+	unsigned int n, unsigned int *free_space)
+{
+	uint32_t i, idx, total;
+	unsigned int rc;
+
+	idx = local_shard(nr);
+	total = 0;
+
+	/* local shard first, then walk the remote ones only on overflow */
+	for (i = 0; i < nr->nb_shards && total != n; i++) {
+		rc = rte_ring_enqueue_burst(nr->shards[idx],
+			obj_table + total, n - total, free_space);
+		total += rc;
+		if (++idx == nr->nb_shards)
+			idx = 0;
+	}
+
+	return total;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_ring_numa_dequeue_burst, 25.07)
+unsigned int
+rte_ring_numa_dequeue_burst(struct rte_ring_numa *nr, void **obj_table,
+	unsigned int n, unsigned int *available)
+{
+	uint32_t i, idx, total;
+	unsigned int rc;
+
+	idx = local_shard(nr);
+	total = 0;
+
+	/* local shard first, steal from remote shards only when it is dry */
+	for (i = 0; i < nr->nb_shards && total != n; i++) {
+		rc = rte_ring_dequeue_burst(nr->shards[idx],
+			obj_table + total, n - total, available);
+		total += rc;
+		if (++idx == nr->nb_shards)
+			idx = 0;
+	}
+
+	return total;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_ring_numa_count, 25.07)
+unsigned int
+rte_ring_numa_count(const struct rte_ring_numa *nr)
+{
+	uint32_t i;
+	unsigned int count = 0;
+
+	for (i = 0; i < nr->nb_shards; i++)
+		count += rte_ring_count(nr->shards[i]);
+
+	return count;
+}
@@ -0,0 +1,153 @@
+/* SPDX-License-Identifier: BSD-3-Clause
+ * Copyright(c) 2025 Intel Corporation
+ */
+
+#ifndef _RTE_RING_NUMA_H_
+#define _RTE_RING_NUMA_H_
+
+/**
+ * @file
+ * RTE NUMA-sharded ring.
+ *
+ * A thin composite on top of rte_ring for handoffs that cross NUMA
+ * boundaries: one sub-ring is created per detected NUMA node, allocated
+ * on that node's memory. Enqueue and dequeue prefer the sub-ring local
+ * to the calling lcore's socket and fall back to the remote shards only
+ * when the local one is full (enqueue) or empty (dequeue), so in the
+ * common case both sides of a handoff touch socket-local memory only.
+ *
+ * Note that sharding relaxes ordering: objects enqueued from different
+ * sockets may be dequeued in a different interleaving than a single ring
+ * would produce. Per-shard FIFO order is preserved.
+ */
+
+#include <rte_ring.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * NUMA-sharded ring structure.
+ *
+ * All data-path state lives in the per-node sub-rings; this structure
+ * itself is read-only after creation.
+ */
+struct rte_ring_numa {
+	/** Name of the sharded ring. */
+	char name[RTE_RING_NAMESIZE];
+	/** Number of sub-rings (detected NUMA nodes at creation time). */
+	uint32_t nb_shards;
+	/** Map from socket id to shard index, local-first lookup helper. */
+	uint8_t shard_idx[RTE_MAX_NUMA_NODES];
+	/** Per-node sub-rings. */
+	struct rte_ring *shards[RTE_MAX_NUMA_NODES];
+};
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Create a NUMA-sharded ring.
+ *
+ * One sub-ring of *count* usable elements is created per NUMA node with
+ * memory detected at the time of the call, each allocated on its node.
+ *
+ * @param name
+ *   The name of the ring. Sub-rings are named after it, so it has to
+ *   leave room for a short suffix within RTE_RING_NAMESIZE.
+ * @param count
+ *   The number of elements of each sub-ring (must be a power of 2,
+ *   unless RING_F_EXACT_SZ is set in flags).
+ * @param flags
+ *   Ring creation flags, as accepted by rte_ring_create().
+ * @return
+ *   On success, the pointer to the new allocated sharded ring. NULL on
+ *   error with rte_errno set appropriately, see rte_ring_create() for
+ *   the possible error values.
+ */
+__rte_experimental
+struct rte_ring_numa *
+rte_ring_numa_create(const char *name, unsigned int count, unsigned int flags);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * De-allocate all memory used by the sharded ring.
+ *
+ * @param nr
+ *   Sharded ring to free.
+ *   If NULL then, the function does nothing.
+ */
+__rte_experimental
+void
+rte_ring_numa_free(struct rte_ring_numa *nr);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Enqueue several objects on the sharded ring, local shard first.
+ *
+ * @param nr
+ *   A pointer to the sharded ring structure.
+ * @param obj_table
+ *   A pointer to a table of void * pointers (objects).
+ * @param n
+ *   The number of objects to add to the ring from the obj_table.
+ * @param free_space
+ *   If non-NULL, returns the amount of space in the shard the last
+ *   object was enqueued to, after the enqueue operation has finished.
+ * @return
+ *   - n: Actual number of objects enqueued.
+ */
+__rte_experimental
+unsigned int
+rte_ring_numa_enqueue_burst(struct rte_ring_numa *nr, void * const *obj_table,
+	unsigned int n, unsigned int *free_space);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Dequeue several objects from the sharded ring, local shard first.
+ *
+ * @param nr
+ *   A pointer to the sharded ring structure.
+ * @param obj_table
+ *   A pointer to a table of void * pointers (objects) that will be filled.
+ * @param n
+ *   The number of objects to dequeue from the ring to the obj_table.
+ * @param available
+ *   If non-NULL, returns the number of remaining ring entries in the
+ *   shard the last object was dequeued from, after the dequeue has
+ *   finished.
+ * @return
+ *   - Actual number of objects dequeued.
+ */
+__rte_experimental
+unsigned int
+rte_ring_numa_dequeue_burst(struct rte_ring_numa *nr, void **obj_table,
+	unsigned int n, unsigned int *available);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Return the number of entries in all shards of a sharded ring.
+ *
+ * @param nr
+ *   A pointer to the sharded ring structure.
+ * @return
+ *   The number of entries in the sharded ring.
+ */
+__rte_experimental
+unsigned int
+rte_ring_numa_count(const struct rte_ring_numa *nr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTE_RING_NUMA_H_ */
@@ -25,9 +25,14 @@
  * to avoid copying of the data to temporary area (for ex: array of mbufs
  * on the stack).
  *
- * Note that currently these APIs are available only for two sync modes:
+ * Note that currently these APIs are available only for three sync modes:
  * 1) Single Producer/Single Consumer (RTE_RING_SYNC_ST)
  * 2) Serialized Producer/Serialized Consumer (RTE_RING_SYNC_MT_HTS).
+ * 3) Multi Producer/Multi Consumer (RTE_RING_SYNC_MT), with the
+ *    restriction that the operation has to be completed with the
+ *    _commit_ flavor of the finish functions, passing the same
+ *    rte_ring_zc_data that the _start_ function filled in, and that
+ *    the whole reservation has to be committed (no partial commit).
  * It is user's responsibility to create/init ring with appropriate sync
  * modes selected.
  *
@@ -92,6 +97,13 @@ struct __rte_cache_aligned rte_ring_zc_data {
 	 * will give the number of elements available at ptr2.
 	 */
 	unsigned int n1;
+	/* @internal Head index at reservation time. Filled in by the _start_
+	 * functions and consumed by the _commit_ functions to complete the
+	 * operation on RTE_RING_SYNC_MT rings.
+	 */
+	uint32_t head;
+	/* @internal Total number of reserved elements. */
+	uint32_t nr;
 };
 
 static __rte_always_inline void
@@ -136,6 +148,9 @@ __rte_ring_do_enqueue_zc_elem_start(struct rte_ring *r, unsigned int esize,
 		n = __rte_ring_hts_move_prod_head(r, n, behavior, &head, &free);
 		break;
 	case RTE_RING_SYNC_MT:
+		n = __rte_ring_move_prod_head(r, RTE_RING_SYNC_MT, n,
+			behavior, &head, &next, &free);
+		break;
 	case RTE_RING_SYNC_MT_RTS:
 	default:
 		/* unsupported mode, shouldn't be here */
@@ -147,6 +162,8 @@ __rte_ring_do_enqueue_zc_elem_start(struct rte_ring *r, unsigned int esize,
 
 	__rte_ring_get_elem_addr(r, head, esize, n, &zcd->ptr1,
 		&zcd->n1, &zcd->ptr2);
+	zcd->head = head;
+	zcd->nr = n;
 
 	if (free_space != NULL)
 		*free_space = free - n;
@@ -323,6 +340,61 @@ rte_ring_enqueue_zc_finish(struct rte_ring *r, unsigned int n)
 	rte_ring_enqueue_zc_elem_finish(r, n);
 }
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Complete enqueuing several objects on the ring.
+ * Unlike rte_ring_enqueue_zc_elem_finish, this function also supports
+ * multi-producer (RTE_RING_SYNC_MT) rings. For them the commit waits for
+ * preceding producers to complete, then publishes the whole reservation,
+ * so *n* has to be equal to the value returned by the _start_ function.
+ *
+ * @param r
+ *   A pointer to the ring structure.
+ * @param zcd
+ *   Structure filled in by the corresponding _start_ function.
+ * @param n
+ *   The number of objects to add to the ring.
+ */
+static __rte_always_inline void
+rte_ring_enqueue_zc_elem_commit(struct rte_ring *r,
+	const struct rte_ring_zc_data *zcd, unsigned int n)
+{
+	if (r->prod.sync_type == RTE_RING_SYNC_MT) {
+		/* partial commit would leave a permanent gap in the tail
+		 * sequence and deadlock the producers that reserved after us.
+		 */
+		RTE_ASSERT(n == zcd->nr);
+		__rte_ring_update_tail(&r->prod, zcd->head, zcd->head + n,
+			0, 1);
+	} else
+		rte_ring_enqueue_zc_elem_finish(r, n);
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Complete enqueuing several pointers to objects on the ring.
+ * Unlike rte_ring_enqueue_zc_finish, this function also supports
+ * multi-producer (RTE_RING_SYNC_MT) rings, see
+ * rte_ring_enqueue_zc_elem_commit for the restrictions that apply.
+ *
+ * @param r
+ *   A pointer to the ring structure.
+ * @param zcd
+ *   Structure filled in by the corresponding _start_ function.
+ * @param n
+ *   The number of pointers to objects to add to the ring.
+ */
+static __rte_always_inline void
+rte_ring_enqueue_zc_commit(struct rte_ring *r,
+	const struct rte_ring_zc_data *zcd, unsigned int n)
+{
+	rte_ring_enqueue_zc_elem_commit(r, zcd, n);
+}
+
 /**
  * @internal This function moves cons head value and copies up to *n*
  * objects from the ring to the user provided obj_table.
@@ -344,6 +416,9 @@ __rte_ring_do_dequeue_zc_elem_start(struct rte_ring *r,
 			&head, &avail);
 		break;
 	case RTE_RING_SYNC_MT:
+		n = __rte_ring_move_cons_head(r, RTE_RING_SYNC_MT, n,
+			behavior, &head, &next, &avail);
+		break;
 	case RTE_RING_SYNC_MT_RTS:
 	default:
 		/* unsupported mode, shouldn't be here */
@@ -355,6 +430,8 @@ __rte_ring_do_dequeue_zc_elem_start(struct rte_ring *r,
 
 	__rte_ring_get_elem_addr(r, head, esize, n, &zcd->ptr1,
 		&zcd->n1, &zcd->ptr2);
+	zcd->head = head;
+	zcd->nr = n;
 
 	if (available != NULL)
 		*available = avail - n;
@@ -529,6 +606,61 @@ rte_ring_dequeue_zc_finish(struct rte_ring *r, unsigned int n)
 	rte_ring_dequeue_elem_finish(r, n);
 }
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Complete dequeuing several objects from the ring.
+ * Unlike rte_ring_dequeue_zc_elem_finish, this function also supports
+ * multi-consumer (RTE_RING_SYNC_MT) rings. For them the commit waits for
+ * preceding consumers to complete, then releases the whole reservation,
+ * so *n* has to be equal to the value returned by the _start_ function.
+ *
+ * @param r
+ *   A pointer to the ring structure.
+ * @param zcd
+ *   Structure filled in by the corresponding _start_ function.
+ * @param n
+ *   The number of objects to remove from the ring.
+ */
+static __rte_always_inline void
+rte_ring_dequeue_zc_elem_commit(struct rte_ring *r,
+	const struct rte_ring_zc_data *zcd, unsigned int n)
+{
+	if (r->cons.sync_type == RTE_RING_SYNC_MT) {
+		/* partial commit would leave a permanent gap in the tail
+		 * sequence and deadlock the consumers that reserved after us.
+		 */
+		RTE_ASSERT(n == zcd->nr);
+		__rte_ring_update_tail(&r->cons, zcd->head, zcd->head + n,
+			0, 0);
+	} else
+		rte_ring_dequeue_zc_elem_finish(r, n);
+}
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Complete dequeuing several pointers to objects from the ring.
+ * Unlike rte_ring_dequeue_zc_finish, this function also supports
+ * multi-consumer (RTE_RING_SYNC_MT) rings, see
+ * rte_ring_dequeue_zc_elem_commit for the restrictions that apply.
+ *
+ * @param r
+ *   A pointer to the ring structure.
+ * @param zcd
+ *   Structure filled in by the corresponding _start_ function.
+ * @param n
+ *   The number of pointers to objects to remove from the ring.
+ */
+static __rte_always_inline void
+rte_ring_dequeue_zc_commit(struct rte_ring *r,
+	const struct rte_ring_zc_data *zcd, unsigned int n)
+{
+	rte_ring_dequeue_zc_elem_commit(r, zcd, n);
+}
+
 #ifdef __cplusplus
 }
 #endif
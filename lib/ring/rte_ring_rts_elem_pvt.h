@@ -10,12 +10,18 @@
 #ifndef _RTE_RING_RTS_ELEM_PVT_H_
 #define _RTE_RING_RTS_ELEM_PVT_H_
 
+#ifdef RTE_RING_WAIT_BACKOFF
+#include <rte_wait_backoff.h>
+#endif
+
 /**
  * @file rte_ring_rts_elem_pvt.h
  * It is not recommended to include this file directly,
  * include <rte_ring.h> instead.
  * Contains internal helper functions for Relaxed Tail Sync (RTS) ring mode.
  * For more information please refer to <rte_ring_rts.h>.
+ * Defining RTE_RING_WAIT_BACKOFF before inclusion switches the head
+ * wait loop to the adaptive backoff helpers of <rte_wait_backoff.h>.
  */
 
 /**
@@ -58,10 +64,25 @@ __rte_ring_rts_head_wait(const struct rte_ring_rts_headtail *ht,
 
 	max = ht->htd_max;
 
+#ifdef RTE_RING_WAIT_BACKOFF
+	struct rte_wait_backoff wb;
+
+	rte_wait_backoff_init(&wb, NULL);
+	while (h->val.pos - ht->tail.val.pos > max) {
+		/* the distance shrinks when the stale tail advances */
+		rte_wait_backoff_until_change(&wb,
+			(volatile void *)(uintptr_t)&ht->tail.raw,
+			rte_atomic_load_explicit(&ht->tail.raw,
+				rte_memory_order_relaxed),
+			UINT64_MAX, sizeof(ht->tail.raw));
+		h->raw = rte_atomic_load_explicit(&ht->head.raw, rte_memory_order_acquire);
+	}
+#else
 	while (h->val.pos - ht->tail.val.pos > max) {
 		rte_pause();
 		h->raw = rte_atomic_load_explicit(&ht->head.raw, rte_memory_order_acquire);
 	}
+#endif
 }
 
 /**
@@ -3,12 +3,29 @@
  */
 
 #include <inttypes.h>
+#include <stdalign.h>
+#include <sys/queue.h>
 
 #include <eal_export.h>
+#include <rte_eal_memconfig.h>
+#include <rte_errno.h>
+#include <rte_malloc.h>
+#include <rte_memzone.h>
 #include <rte_string_fns.h>
+#include <rte_tailq.h>
 
 #include "soring.h"
 
+/* prefix of the memzones reserved by rte_soring_create() */
+#define SORING_MZ_PREFIX "SORG_"
+
+TAILQ_HEAD(rte_soring_list, rte_tailq_entry);
+
+static struct rte_tailq_elem rte_soring_tailq = {
+	.name = RTE_TAILQ_SORING_NAME,
+};
+EAL_REGISTER_TAILQ(rte_soring_tailq)
+
 RTE_LOG_REGISTER_DEFAULT(soring_logtype, INFO);
 
 static uint32_t
@@ -201,3 +218,142 @@ rte_soring_init(struct rte_soring *r, const struct rte_soring_param *prm)
 
 	return 0;
 }
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_soring_create, 25.07)
+struct rte_soring *
+rte_soring_create(const struct rte_soring_param *prm, int socket_id)
+{
+	char mz_name[RTE_MEMZONE_NAMESIZE];
+	struct rte_soring *r;
+	struct rte_tailq_entry *te;
+	const struct rte_memzone *mz;
+	struct rte_soring_list *soring_list;
+	ssize_t size;
+	int rc;
+
+	if (prm == NULL || prm->name == NULL) {
+		rte_errno = EINVAL;
+		return NULL;
+	}
+
+	size = rte_soring_get_memsize(prm);
+	if (size < 0) {
+		rte_errno = -size;
+		return NULL;
+	}
+
+	rc = snprintf(mz_name, sizeof(mz_name), "%s%s",
+		SORING_MZ_PREFIX, prm->name);
+	if (rc < 0 || rc >= (int)sizeof(mz_name)) {
+		rte_errno = ENAMETOOLONG;
+		return NULL;
+	}
+
+	te = rte_zmalloc("SORING_TAILQ_ENTRY", sizeof(*te), 0);
+	if (te == NULL) {
+		SORING_LOG(ERR, "Cannot reserve memory for tailq");
+		rte_errno = ENOMEM;
+		return NULL;
+	}
+
+	soring_list = RTE_TAILQ_CAST(rte_soring_tailq.head, rte_soring_list);
+
+	rte_mcfg_tailq_write_lock();
+
+	/* rte_memzone_reserve_aligned() sets rte_errno on failure */
+	mz = rte_memzone_reserve_aligned(mz_name, size, socket_id, 0,
+			alignof(typeof(*r)));
+	if (mz != NULL) {
+		r = mz->addr;
+		/* parameters were already checked by get_memsize above */
+		(void)rte_soring_init(r, prm);
+		r->memzone = mz;
+
+		te->data = (void *)r;
+		TAILQ_INSERT_TAIL(soring_list, te, next);
+	} else {
+		r = NULL;
+		SORING_LOG(ERR, "Cannot reserve memory");
+		rte_free(te);
+	}
+	rte_mcfg_tailq_write_unlock();
+
+	return r;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_soring_free, 25.07)
+void
+rte_soring_free(struct rte_soring *r)
+{
+	struct rte_soring_list *soring_list;
+	struct rte_tailq_entry *te;
+
+	if (r == NULL)
+		return;
+
+	/*
+	 * Soring was not created with rte_soring_create(),
+	 * therefore, there is no memzone to free.
+	 */
+	if (r->memzone == NULL) {
+		SORING_LOG(ERR,
+			"Cannot free soring, not created with rte_soring_create()");
+		return;
+	}
+
+	soring_list = RTE_TAILQ_CAST(rte_soring_tailq.head, rte_soring_list);
+	rte_mcfg_tailq_write_lock();
+
+	/* find out tailq entry */
+	TAILQ_FOREACH(te, soring_list, next) {
+		if (te->data == (void *)r)
+			break;
+	}
+
+	if (te == NULL) {
+		rte_mcfg_tailq_write_unlock();
+		return;
+	}
+
+	TAILQ_REMOVE(soring_list, te, next);
+
+	rte_mcfg_tailq_write_unlock();
+
+	if (rte_memzone_free(r->memzone) != 0)
+		SORING_LOG(ERR, "Cannot free memory");
+
+	rte_free(te);
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_soring_lookup, 25.07)
+struct rte_soring *
+rte_soring_lookup(const char *name)
+{
+	struct rte_tailq_entry *te;
+	struct rte_soring *r = NULL;
+	struct rte_soring_list *soring_list;
+
+	if (name == NULL) {
+		rte_errno = EINVAL;
+		return NULL;
+	}
+
+	soring_list = RTE_TAILQ_CAST(rte_soring_tailq.head, rte_soring_list);
+
+	rte_mcfg_tailq_read_lock();
+
+	TAILQ_FOREACH(te, soring_list, next) {
+		r = (struct rte_soring *)te->data;
+		if (strncmp(name, r->name, RTE_SORING_NAMESIZE) == 0)
+			break;
+	}
+
+	rte_mcfg_tailq_read_unlock();
+
+	if (te == NULL) {
+		rte_errno = ENOENT;
+		return NULL;
+	}
+
+	return r;
+}
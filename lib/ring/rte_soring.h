@@ -35,6 +35,12 @@ extern "C" {
 /** max possible number of elements in the soring */
 #define RTE_SORING_ELEM_MAX	(RTE_BIT32(RTE_SORING_ST_BIT) - 1)
 
+/** The maximum length of a soring name. */
+#define RTE_SORING_NAMESIZE	RTE_RING_NAMESIZE
+
+/** tailq name used by rte_soring_create() to register sorings */
+#define RTE_TAILQ_SORING_NAME "RTE_SORING"
+
 struct rte_soring_param {
 	/** expected name of the soring */
 	const char *name;
@@ -112,6 +118,73 @@ __rte_experimental
 int
 rte_soring_init(struct rte_soring *r,  const struct rte_soring_param *prm);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Create a new soring named *prm->name* in memory.
+ *
+ * This function reserves a memzone large enough to hold the soring
+ * structure, its elements and optional metadata, initializes it with
+ * rte_soring_init() and registers it under its name, so that it can
+ * later be found with rte_soring_lookup(). Compared with
+ * rte_soring_get_memsize() plus rte_soring_init() this is one
+ * allocation and makes the soring visible to secondary processes.
+ *
+ * @param prm
+ *   Pointer to the structure that contains soring creation parameters.
+ * @param socket_id
+ *   The *socket_id* argument is the socket identifier in case of
+ *   NUMA. The value can be *SOCKET_ID_ANY* if there is no NUMA
+ *   constraint for the reserved zone.
+ * @return
+ *   On success, the pointer to the new allocated soring. NULL on error with
+ *   rte_errno set appropriately. Possible errno values include:
+ *    - EINVAL - invalid parameter values
+ *    - ENAMETOOLONG - soring name is too long
+ *    - ENOSPC - the maximum number of memzones has already been allocated
+ *    - EEXIST - a memzone with the same name already exists
+ *    - ENOMEM - no appropriate memory area found in which to create memzone
+ */
+__rte_experimental
+struct rte_soring *
+rte_soring_create(const struct rte_soring_param *prm, int socket_id);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * De-allocate all memory used by the soring.
+ *
+ * The soring must have been created with rte_soring_create(); sorings
+ * initialized over caller-provided memory with rte_soring_init() are
+ * not freeable through this function.
+ *
+ * @param r
+ *   Soring to free.
+ *   If NULL then, the function does nothing.
+ */
+__rte_experimental
+void
+rte_soring_free(struct rte_soring *r);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Search for a soring based on its name.
+ *
+ * @param name
+ *   The name of the soring.
+ * @return
+ *   The pointer to the soring matching the name, or NULL if not found,
+ *   with rte_errno set appropriately. Possible rte_errno values include:
+ *    - ENOENT - required entry not available to return.
+ */
+__rte_experimental
+struct rte_soring *
+rte_soring_lookup(const char *name);
+
 /**
  * @warning
  * @b EXPERIMENTAL: this API may change without prior notice.
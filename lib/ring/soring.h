@@ -133,6 +133,9 @@ struct  __rte_cache_aligned rte_soring {
 	struct __rte_ring_headtail cons;
 
 	char name[RTE_RING_NAMESIZE];  /**< Name of the ring. */
+
+	/** Memzone, if any, containing the soring. */
+	const struct rte_memzone *memzone;
 };
 
 #endif /* _SORING_H_ */
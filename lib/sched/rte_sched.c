@@ -16,6 +16,7 @@
 #include <rte_mbuf.h>
 #include <rte_bitmap.h>
 #include <rte_reciprocal.h>
+#include <rte_stdatomic.h>
 
 #include "rte_sched.h"
 #include "rte_sched_log.h"
@@ -39,9 +40,15 @@
  */
 #define RTE_SCHED_TIME_SHIFT		      8
 
+/* Maximum lag (in frames of port MTU size) a sharded port dequeue is allowed
+ * to catch up on the shared link byte clock in one shot
+ */
+#define RTE_SCHED_LINK_TIME_MAX_LAG_FRAMES    64
+
 struct rte_sched_pipe_profile {
 	/* Token bucket (TB) */
 	uint64_t tb_period;
+	struct rte_reciprocal_u64 tb_period_inv;
 	uint64_t tb_credits_per_period;
 	uint64_t tb_size;
 
@@ -97,6 +104,7 @@ enum grinder_state {
 struct rte_sched_subport_profile {
 	/* Token bucket (TB) */
 	uint64_t tb_period;
+	struct rte_reciprocal_u64 tb_period_inv;
 	uint64_t tb_credits_per_period;
 	uint64_t tb_size;
 
@@ -239,6 +247,10 @@ struct __rte_cache_aligned rte_sched_port {
 	uint32_t n_pkts_out;
 	uint32_t subport_id;
 
+	/* Shared link byte clock, only used when the port is sharded */
+	alignas(RTE_CACHE_LINE_SIZE) RTE_ATOMIC(uint64_t) link_time;
+	uint64_t link_epoch_cycles;
+
 	/* Large data structures */
 	struct rte_sched_subport_profile *subport_profiles;
 	alignas(RTE_CACHE_LINE_SIZE) struct rte_sched_subport *subports[0];
@@ -710,6 +722,7 @@ rte_sched_pipe_profile_convert(struct rte_sched_subport *subport,
 			&dst->tb_period);
 	}
 
+	dst->tb_period_inv = rte_reciprocal_value_u64(dst->tb_period);
 	dst->tb_size = src->tb_size;
 
 	/* Traffic Classes */
@@ -765,6 +778,7 @@ rte_sched_subport_profile_convert(struct rte_sched_subport_profile_params *src,
 			&dst->tb_period);
 	}
 
+	dst->tb_period_inv = rte_reciprocal_value_u64(dst->tb_period);
 	dst->tb_size = src->tb_size;
 
 	/* Traffic Classes */
@@ -1016,6 +1030,10 @@ rte_sched_port_config(struct rte_sched_port_params *params)
 	port->n_pkts_out = 0;
 	port->subport_id = 0;
 
+	/* Shared link byte clock */
+	port->link_time = 0;
+	port->link_epoch_cycles = port->time_cpu_cycles;
+
 	return port;
 }
 
@@ -2310,13 +2328,15 @@ grinder_credits_update(struct rte_sched_port *port,
 	uint32_t i;
 
 	/* Subport TB */
-	n_periods = (port->time - subport->tb_time) / sp->tb_period;
+	n_periods = rte_reciprocal_divide_u64(port->time - subport->tb_time,
+		&sp->tb_period_inv);
 	subport->tb_credits += n_periods * sp->tb_credits_per_period;
 	subport->tb_credits = RTE_MIN(subport->tb_credits, sp->tb_size);
 	subport->tb_time += n_periods * sp->tb_period;
 
 	/* Pipe TB */
-	n_periods = (port->time - pipe->tb_time) / params->tb_period;
+	n_periods = rte_reciprocal_divide_u64(port->time - pipe->tb_time,
+		&params->tb_period_inv);
 	pipe->tb_credits += n_periods * params->tb_credits_per_period;
 	pipe->tb_credits = RTE_MIN(pipe->tb_credits, params->tb_size);
 	pipe->tb_time += n_periods * params->tb_period;
@@ -2349,13 +2369,15 @@ grinder_credits_update_with_tc_ov(struct rte_sched_port *port,
 	uint32_t i;
 
 	/* Subport TB */
-	n_periods = (port->time - subport->tb_time) / sp->tb_period;
+	n_periods = rte_reciprocal_divide_u64(port->time - subport->tb_time,
+		&sp->tb_period_inv);
 	subport->tb_credits += n_periods * sp->tb_credits_per_period;
 	subport->tb_credits = RTE_MIN(subport->tb_credits, sp->tb_size);
 	subport->tb_time += n_periods * sp->tb_period;
 
 	/* Pipe TB */
-	n_periods = (port->time - pipe->tb_time) / params->tb_period;
+	n_periods = rte_reciprocal_divide_u64(port->time - pipe->tb_time,
+		&params->tb_period_inv);
 	pipe->tb_credits += n_periods * params->tb_credits_per_period;
 	pipe->tb_credits = RTE_MIN(pipe->tb_credits, params->tb_size);
 	pipe->tb_time += n_periods * params->tb_period;
@@ -2560,6 +2582,27 @@ grinder_pcache_populate(struct rte_sched_subport *subport,
 	grinder->pcache_w += (w[3] != 0);
 }
 
+static inline void
+grinder_pcache_prefetch(struct rte_sched_subport *subport, uint32_t pos)
+{
+	struct rte_sched_grinder *grinder = subport->grinder + pos;
+	struct rte_sched_pipe *pipe;
+	uint32_t qindex;
+
+	if (grinder->pcache_r == grinder->pcache_w)
+		return;
+
+	/* Pull the state of the next cached pipe into cache one full grinder
+	 * rotation ahead of its installment in this grinder
+	 */
+	qindex = grinder->pcache_qindex[grinder->pcache_r];
+	pipe = subport->pipe + (qindex >> 4);
+
+	rte_prefetch0(pipe);
+	rte_prefetch0(((const uint8_t *)pipe) + RTE_CACHE_LINE_SIZE);
+	rte_prefetch0(subport->queue + qindex);
+}
+
 static inline void
 grinder_tccache_populate(struct rte_sched_subport *subport,
 	uint32_t pos, uint32_t qindex, uint16_t qmask)
@@ -2671,6 +2714,8 @@ grinder_next_pipe(struct rte_sched_port *port,
 		grinder->pcache_r = 1;
 	}
 
+	grinder_pcache_prefetch(subport, pos);
+
 	/* Install new pipe in the grinder */
 	grinder->pindex = pipe_qindex >> 4;
 	grinder->subport = subport;
@@ -2768,6 +2813,7 @@ grinder_prefetch_pipe(struct rte_sched_subport *subport, uint32_t pos)
 	struct rte_sched_grinder *grinder = subport->grinder + pos;
 
 	rte_prefetch0(grinder->pipe);
+	rte_prefetch0(((const uint8_t *)grinder->pipe) + RTE_CACHE_LINE_SIZE);
 	rte_prefetch0(grinder->queue[0]);
 }
 
@@ -3015,4 +3061,138 @@ rte_sched_port_dequeue(struct rte_sched_port *port, struct rte_mbuf **pkts, uint
 	return count;
 }
 
+struct rte_sched_shard {
+	/* Parent port this shard was carved out of */
+	struct rte_sched_port *parent;
+
+	/* First subport (parent port numbering) owned by this shard */
+	uint32_t subport_id_first;
+
+	/* The shard owning subport 0 propagates its byte clock back to the
+	 * parent port, where the enqueue side congestion management reads it
+	 */
+	int is_clock_master;
+
+	/* Private view of the parent port, restricted to the subport range
+	 * owned by this shard. Must be last: the subports[] flexible array
+	 * of the embedded port extends past the end of this structure.
+	 */
+	alignas(RTE_CACHE_LINE_SIZE) struct rte_sched_port port;
+};
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_sched_port_shard_create, 25.07)
+struct rte_sched_shard *
+rte_sched_port_shard_create(struct rte_sched_port *port,
+	uint32_t subport_id,
+	uint32_t n_subports,
+	int socket)
+{
+	struct rte_sched_shard *shard;
+	uint32_t size, i;
+
+	/* Check user parameters */
+	if (port == NULL) {
+		SCHED_LOG(ERR, "%s: Incorrect value for parameter port", __func__);
+		return NULL;
+	}
+
+	if (n_subports == 0 ||
+		subport_id >= port->n_subports_per_port ||
+		n_subports > port->n_subports_per_port - subport_id) {
+		SCHED_LOG(ERR, "%s: Incorrect value for subport range", __func__);
+		return NULL;
+	}
+
+	size = sizeof(struct rte_sched_shard) +
+		n_subports * sizeof(struct rte_sched_subport *);
+
+	shard = rte_zmalloc_socket("qos_sched_shard", size, RTE_CACHE_LINE_SIZE,
+		socket);
+	if (shard == NULL) {
+		SCHED_LOG(ERR, "%s: Memory allocation fails", __func__);
+		return NULL;
+	}
+
+	shard->parent = port;
+	shard->subport_id_first = subport_id;
+	shard->is_clock_master = (subport_id == 0);
+
+	/* Private port view: the grinder machinery runs unmodified on it */
+	memcpy(&shard->port, port, sizeof(struct rte_sched_port));
+	shard->port.n_subports_per_port = n_subports;
+	shard->port.subport_id = 0;
+	shard->port.pkts_out = NULL;
+	shard->port.n_pkts_out = 0;
+
+	for (i = 0; i < n_subports; i++)
+		shard->port.subports[i] = port->subports[subport_id + i];
+
+	return shard;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_sched_port_shard_dequeue, 25.07)
+int
+rte_sched_port_shard_dequeue(struct rte_sched_shard *shard,
+	struct rte_mbuf **pkts,
+	uint32_t n_pkts)
+{
+	struct rte_sched_port *parent = shard->parent;
+	uint64_t link_time, link_capacity, lag_max, bytes;
+	uint64_t cycles = rte_get_tsc_cycles();
+	uint32_t i, count;
+
+	/* Link admission: the shared link byte clock must not run ahead of
+	 * the wall clock converted to bytes at the configured port rate
+	 */
+	if (cycles < parent->link_epoch_cycles)
+		cycles = parent->link_epoch_cycles;
+
+	link_capacity = rte_reciprocal_divide(
+		(cycles - parent->link_epoch_cycles) << RTE_SCHED_TIME_SHIFT,
+		parent->inv_cycles_per_byte);
+
+	link_time = rte_atomic_load_explicit(&parent->link_time,
+		rte_memory_order_relaxed);
+	if (link_time >= link_capacity)
+		return 0;
+
+	/* Clamp the lag accumulated over idle periods, so that the link
+	 * does not burst unbounded when traffic resumes. Best effort: on
+	 * CAS failure another shard has just advanced the clock.
+	 */
+	lag_max = (uint64_t)parent->mtu * RTE_SCHED_LINK_TIME_MAX_LAG_FRAMES;
+	if (link_capacity - link_time > lag_max)
+		rte_atomic_compare_exchange_strong_explicit(&parent->link_time,
+			&link_time, link_capacity - lag_max,
+			rte_memory_order_relaxed, rte_memory_order_relaxed);
+
+	count = rte_sched_port_dequeue(&shard->port, pkts, n_pkts);
+
+	/* Charge the scheduled packets against the shared link */
+	for (i = 0, bytes = 0; i < count; i++)
+		bytes += pkts[i]->pkt_len + parent->frame_overhead;
+
+	if (bytes)
+		rte_atomic_fetch_add_explicit(&parent->link_time, bytes,
+			rte_memory_order_relaxed);
+
+	/* Propagate the byte clock back to the parent port, where the
+	 * enqueue side congestion management (RED/PIE) reads it
+	 */
+	if (shard->is_clock_master) {
+		parent->time_cpu_cycles = shard->port.time_cpu_cycles;
+		parent->time_cpu_bytes = shard->port.time_cpu_bytes;
+		parent->time = shard->port.time;
+	}
+
+	return count;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_sched_port_shard_free, 25.07)
+void
+rte_sched_port_shard_free(struct rte_sched_shard *shard)
+{
+	rte_free(shard);
+}
+
 RTE_LOG_REGISTER_DEFAULT(sched_logtype, INFO);
@@ -594,6 +594,89 @@ rte_sched_port_dequeue(struct rte_sched_port *port, struct rte_mbuf **pkts, uint
 int
 rte_sched_subport_tc_ov_config(struct rte_sched_port *port, uint32_t subport_id, bool tc_ov_enable);
 
+/*
+ * Sharded port dequeue
+ */
+
+/**
+ * Port scheduler shard: private dequeue context for a contiguous range of
+ * subports of a port scheduler instance, allowing different lcores to run
+ * the dequeue operation for disjoint subport ranges of the same port in
+ * parallel. The shards share the port output rate through a lock-free link
+ * byte clock maintained on the parent port.
+ */
+struct rte_sched_shard;
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Hierarchical scheduler port shard create. Carves the contiguous subport
+ * range [subport_id, subport_id + n_subports) out of an already configured
+ * port scheduler instance. The ranges owned by the shards of one port must
+ * not overlap. Once any shard exists, rte_sched_port_dequeue() must no
+ * longer be called on the parent port; packets are dequeued through
+ * rte_sched_port_shard_dequeue() instead, with each shard serviced by a
+ * single lcore. The enqueue operation still runs on the parent port, with
+ * each subport fed by no more than one lcore at a time.
+ *
+ * @param port
+ *   Handle to port scheduler instance
+ * @param subport_id
+ *   First subport owned by this shard
+ * @param n_subports
+ *   Number of subports owned by this shard
+ * @param socket
+ *   CPU socket ID where the shard context should be allocated
+ * @return
+ *   Handle to port scheduler shard upon success, NULL otherwise
+ */
+__rte_experimental
+struct rte_sched_shard *
+rte_sched_port_shard_create(struct rte_sched_port *port,
+	uint32_t subport_id,
+	uint32_t n_subports,
+	int socket);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Hierarchical scheduler port shard dequeue. Reads up to n_pkts from the
+ * subport range owned by the shard and stores them in the pkts array. The
+ * output rate configured on the parent port is enforced across all shards
+ * of the port, at the granularity of one dequeue burst.
+ *
+ * @param shard
+ *   Handle to port scheduler shard
+ * @param pkts
+ *   Pre-allocated packet descriptor array where the packets dequeued
+ *   from the shard should be stored, with at least n_pkts entries
+ * @param n_pkts
+ *   Number of packets to dequeue from the shard
+ * @return
+ *   Number of packets successfully dequeued and placed in the pkts array
+ */
+__rte_experimental
+int
+rte_sched_port_shard_dequeue(struct rte_sched_shard *shard,
+	struct rte_mbuf **pkts,
+	uint32_t n_pkts);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Hierarchical scheduler port shard free. The parent port and its subports
+ * are not affected.
+ *
+ * @param shard
+ *   Handle to port scheduler shard
+ */
+__rte_experimental
+void
+rte_sched_port_shard_free(struct rte_sched_shard *shard);
+
 #ifdef __cplusplus
 }
 #endif
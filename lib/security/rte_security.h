@@ -1067,6 +1067,59 @@ rte_security_set_pkt_metadata(void *instance,
 	return __rte_security_set_pkt_metadata(instance, sess, mb, params);
 }
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice
+ *
+ * Updates a burst of buffers with device-specific defined metadata
+ *
+ * Performs the same operation as rte_security_set_pkt_metadata() on
+ * every mbuf of the burst, with the instance flags check and the
+ * session metadata template loaded once for the whole burst: on the
+ * fast path each packet costs a single dynamic field store and no
+ * function pointer call.
+ *
+ * @param	instance	security instance
+ * @param	sess		security session, common to all packets
+ * @param	mb		array of packet mbufs to set metadata on.
+ * @param	nb_pkts		number of packets in the array
+ * @param	params		device-specific defined parameters
+ *				required for metadata, common to all packets
+ *
+ * @return
+ *  Number of successfully updated packets, taken in order from the
+ *  start of the array. Smaller than *nb_pkts* only if the PMD callback
+ *  failed for a packet.
+ */
+__rte_experimental
+static inline uint16_t
+rte_security_set_pkt_metadata_bulk(void *instance,
+				   void *sess,
+				   struct rte_mbuf *mb[], uint16_t nb_pkts,
+				   void *params)
+{
+	uint16_t i;
+
+	/* Fast Path */
+	if (rte_security_ctx_flags_get(instance) & RTE_SEC_CTX_F_FAST_SET_MDATA) {
+		const rte_security_dynfield_t fdata = (rte_security_dynfield_t)
+			rte_security_session_fast_mdata_get(sess);
+
+		for (i = 0; i < nb_pkts; i++)
+			*rte_security_dynfield(mb[i]) = fdata;
+
+		return nb_pkts;
+	}
+
+	/* Jump to PMD specific function pointer for each packet */
+	for (i = 0; i < nb_pkts; i++)
+		if (__rte_security_set_pkt_metadata(instance, sess, mb[i],
+						    params) != 0)
+			break;
+
+	return i;
+}
+
 /**
  * Attach a session to a symmetric crypto operation
  *
@@ -57,6 +57,19 @@ struct rte_stack_lf {
 	alignas(RTE_CACHE_LINE_SIZE) struct rte_stack_lf_elem elems[];
 };
 
+/** The number of objects a per-lcore bucket can hold. */
+#define RTE_STACK_LF_BUCKET_SIZE 64
+
+/* Per-lcore bucket of objects buffering pushes and pops so that only bucket
+ * spills and refills touch the shared lock-free lists.
+ */
+struct __rte_cache_aligned rte_stack_lf_bucket {
+	/** Number of objects in the bucket. */
+	RTE_ATOMIC(uint32_t) len;
+	/** Bucket object table, index 0 is the bottom. */
+	void *objs[RTE_STACK_LF_BUCKET_SIZE];
+};
+
 /* Structure containing the LIFO, its current length, and a lock for mutual
  * exclusion.
  */
@@ -76,6 +89,10 @@ struct __rte_cache_aligned rte_stack {
 	const struct rte_memzone *memzone;
 	uint32_t capacity; /**< Usable size of the stack. */
 	uint32_t flags; /**< Flags supplied at creation. */
+	/** Offset of the per-lcore bucket array from the stack base,
+	 * only set with RTE_STACK_F_LF_BUCKETS.
+	 */
+	size_t bucket_off;
 	union {
 		struct rte_stack_lf stack_lf; /**< Lock-free LIFO structure. */
 		struct rte_stack_std stack_std;	/**< LIFO structure. */
@@ -88,6 +105,19 @@ struct __rte_cache_aligned rte_stack {
  */
 #define RTE_STACK_F_LF 0x0001
 
+/**
+ * The lock-free stack buffers objects in per-lcore buckets, and only spills
+ * full buckets to (and refills empty ones from) the shared stack top, so
+ * that lcores do not contend on the top-of-stack pointer for every
+ * operation. Must be combined with RTE_STACK_F_LF. Objects held in a bucket
+ * can only be popped by the lcore that pushed them, so such a stack is best
+ * suited for pools of interchangeable objects (e.g. as a mempool handler).
+ * Note that the buckets provide storage in addition to *count*, and
+ * rte_stack_free_count() is inaccurate if more than *count* objects are
+ * pushed.
+ */
+#define RTE_STACK_F_LF_BUCKETS 0x0002
+
 #include "rte_stack_std.h"
 #include "rte_stack_lf.h"
 
@@ -113,7 +143,9 @@ rte_stack_push(struct rte_stack *s, void * const *obj_table, unsigned int n)
 	RTE_ASSERT(s != NULL);
 	RTE_ASSERT(obj_table != NULL);
 
-	if (s->flags & RTE_STACK_F_LF)
+	if (s->flags & RTE_STACK_F_LF_BUCKETS)
+		return __rte_stack_lf_bucket_push(s, obj_table, n);
+	else if (s->flags & RTE_STACK_F_LF)
 		return __rte_stack_lf_push(s, obj_table, n);
 	else
 		return __rte_stack_std_push(s, obj_table, n);
@@ -137,7 +169,9 @@ rte_stack_pop(struct rte_stack *s, void **obj_table, unsigned int n)
 	RTE_ASSERT(s != NULL);
 	RTE_ASSERT(obj_table != NULL);
 
-	if (s->flags & RTE_STACK_F_LF)
+	if (s->flags & RTE_STACK_F_LF_BUCKETS)
+		return __rte_stack_lf_bucket_pop(s, obj_table, n);
+	else if (s->flags & RTE_STACK_F_LF)
 		return __rte_stack_lf_pop(s, obj_table, n);
 	else
 		return __rte_stack_std_pop(s, obj_table, n);
@@ -156,7 +190,9 @@ rte_stack_count(struct rte_stack *s)
 {
 	RTE_ASSERT(s != NULL);
 
-	if (s->flags & RTE_STACK_F_LF)
+	if (s->flags & RTE_STACK_F_LF_BUCKETS)
+		return __rte_stack_lf_bucket_count(s);
+	else if (s->flags & RTE_STACK_F_LF)
 		return __rte_stack_lf_count(s);
 	else
 		return __rte_stack_std_count(s);
@@ -197,6 +233,9 @@ rte_stack_free_count(struct rte_stack *s)
  *    - RTE_STACK_F_LF: If this flag is set, the stack uses lock-free
  *      variants of the push and pop functions. Otherwise, it achieves
  *      thread-safety using a lock.
+ *    - RTE_STACK_F_LF_BUCKETS: If this flag is set, the lock-free stack
+ *      buffers objects in per-lcore buckets to reduce contention on the
+ *      shared stack top. Only valid in combination with RTE_STACK_F_LF.
  * @return
  *   On success, the pointer to the new allocated stack. NULL on error with
  *    rte_errno set appropriately. Possible errno values include:
@@ -204,6 +243,7 @@ rte_stack_free_count(struct rte_stack *s)
  *    - EEXIST - a stack with the same name already exists
  *    - ENOMEM - insufficient memory to create the stack
  *    - ENAMETOOLONG - name size exceeds RTE_STACK_NAMESIZE
+ *    - EINVAL - invalid flags combination
  *    - ENOTSUP - platform does not support given flags combination.
  */
 struct rte_stack *
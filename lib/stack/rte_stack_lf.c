@@ -2,6 +2,8 @@
  * Copyright(c) 2019 Intel Corporation
  */
 
+#include <string.h>
+
 #include "rte_stack.h"
 
 void
@@ -29,3 +31,24 @@ rte_stack_lf_get_memsize(unsigned int count)
 
 	return sz;
 }
+
+void
+rte_stack_lf_bucket_init(struct rte_stack *s, unsigned int count)
+{
+	rte_stack_lf_init(s, count);
+
+	/* Record where the buckets live so the push/pop fast path can
+	 * locate them without recomputing the element area size.
+	 */
+	s->bucket_off = rte_stack_lf_get_memsize(count);
+
+	memset(RTE_PTR_ADD(s, s->bucket_off), 0,
+	       RTE_MAX_LCORE * sizeof(struct rte_stack_lf_bucket));
+}
+
+ssize_t
+rte_stack_lf_bucket_get_memsize(unsigned int count)
+{
+	return rte_stack_lf_get_memsize(count) +
+		RTE_MAX_LCORE * sizeof(struct rte_stack_lf_bucket);
+}
@@ -5,6 +5,8 @@
 #ifndef _RTE_STACK_LF_H_
 #define _RTE_STACK_LF_H_
 
+#include <rte_lcore.h>
+
 #if !(defined(RTE_ARCH_X86_64) || defined(RTE_ARCH_ARM64))
 #include "rte_stack_lf_stubs.h"
 #else
@@ -112,4 +114,181 @@ rte_stack_lf_init(struct rte_stack *s, unsigned int count);
 ssize_t
 rte_stack_lf_get_memsize(unsigned int count);
 
+/**
+ * @internal Initialize the per-lcore buckets of a lock-free stack.
+ *
+ * @param s
+ *   A pointer to the stack structure.
+ * @param count
+ *   The size of the stack.
+ */
+void
+rte_stack_lf_bucket_init(struct rte_stack *s, unsigned int count);
+
+/**
+ * @internal Return the memory required for a lock-free stack with per-lcore
+ * buckets.
+ *
+ * @param count
+ *   The size of the stack.
+ * @return
+ *   The bytes to allocate for the stack.
+ */
+ssize_t
+rte_stack_lf_bucket_get_memsize(unsigned int count);
+
+/**
+ * @internal Return the per-lcore bucket array of a lock-free stack. The
+ * buckets are laid out after the linked-list elements in the same memzone,
+ * at the offset recorded when the stack was initialized.
+ *
+ * @param s
+ *   A pointer to the stack structure.
+ * @return
+ *   A pointer to the first of RTE_MAX_LCORE buckets.
+ */
+static __rte_always_inline struct rte_stack_lf_bucket *
+__rte_stack_lf_buckets(struct rte_stack *s)
+{
+	return (struct rte_stack_lf_bucket *)RTE_PTR_ADD(s, s->bucket_off);
+}
+
+/**
+ * @internal Push several objects on the bucketed lock-free stack (MT-safe).
+ *
+ * The objects go into the calling lcore's bucket; a full bucket is first
+ * spilled to the shared stack in a single push, so the shared top-of-stack
+ * is touched only once per RTE_STACK_LF_BUCKET_SIZE objects in the common
+ * case.
+ *
+ * @param s
+ *   A pointer to the stack structure.
+ * @param obj_table
+ *   A pointer to a table of void * pointers (objects).
+ * @param n
+ *   The number of objects to push on the stack from the obj_table.
+ * @return
+ *   Actual number of objects enqueued.
+ */
+static __rte_always_inline unsigned int
+__rte_stack_lf_bucket_push(struct rte_stack *s,
+			   void * const *obj_table,
+			   unsigned int n)
+{
+	unsigned int lcore_id = rte_lcore_id();
+	struct rte_stack_lf_bucket *b;
+	unsigned int i;
+	uint32_t len;
+
+	if (unlikely(lcore_id == LCORE_ID_ANY))
+		return __rte_stack_lf_push(s, obj_table, n);
+
+	b = &__rte_stack_lf_buckets(s)[lcore_id];
+
+	len = rte_atomic_load_explicit(&b->len, rte_memory_order_relaxed);
+
+	if (unlikely(n > RTE_STACK_LF_BUCKET_SIZE)) {
+		/* The push cannot fit in the bucket; spill the bucket first
+		 * so the stack keeps this lcore's LIFO ordering.
+		 */
+		if (len != 0) {
+			if (unlikely(__rte_stack_lf_push(s, b->objs, len) == 0))
+				return 0;
+
+			rte_atomic_store_explicit(&b->len, 0,
+						  rte_memory_order_relaxed);
+		}
+
+		return __rte_stack_lf_push(s, obj_table, n);
+	}
+
+	if (len + n > RTE_STACK_LF_BUCKET_SIZE) {
+		/* Spill the whole bucket, bottom first so the shared stack
+		 * pops it back in LIFO order.
+		 */
+		if (unlikely(__rte_stack_lf_push(s, b->objs, len) == 0))
+			return 0;
+
+		len = 0;
+	}
+
+	for (i = 0; i < n; i++)
+		b->objs[len + i] = obj_table[i];
+
+	rte_atomic_store_explicit(&b->len, len + n, rte_memory_order_relaxed);
+
+	return n;
+}
+
+/**
+ * @internal Pop several objects from the bucketed lock-free stack (MT-safe).
+ *
+ * The objects are served from the calling lcore's bucket; only the remainder
+ * of a request exceeding the bucket contents is popped from the shared
+ * stack.
+ *
+ * @param s
+ *   A pointer to the stack structure.
+ * @param obj_table
+ *   A pointer to a table of void * pointers (objects).
+ * @param n
+ *   The number of objects to pull from the stack.
+ * @return
+ *   - Actual number of objects popped.
+ */
+static __rte_always_inline unsigned int
+__rte_stack_lf_bucket_pop(struct rte_stack *s, void **obj_table,
+			  unsigned int n)
+{
+	unsigned int lcore_id = rte_lcore_id();
+	struct rte_stack_lf_bucket *b;
+	unsigned int i, m;
+	uint32_t len;
+
+	if (unlikely(lcore_id == LCORE_ID_ANY))
+		return __rte_stack_lf_pop(s, obj_table, n);
+
+	b = &__rte_stack_lf_buckets(s)[lcore_id];
+
+	len = rte_atomic_load_explicit(&b->len, rte_memory_order_relaxed);
+
+	m = RTE_MIN(n, len);
+
+	/* Pop the remainder from the shared stack first, so that a failure
+	 * leaves the bucket untouched.
+	 */
+	if (n != m &&
+	    unlikely(__rte_stack_lf_pop(s, &obj_table[m], n - m) == 0))
+		return 0;
+
+	for (i = 0; i < m; i++)
+		obj_table[i] = b->objs[len - i - 1];
+
+	rte_atomic_store_explicit(&b->len, len - m, rte_memory_order_relaxed);
+
+	return n;
+}
+
+/**
+ * @internal Return the number of used entries in a bucketed lock-free stack.
+ *
+ * @param s
+ *   A pointer to the stack structure.
+ * @return
+ *   The number of used entries in the stack.
+ */
+static __rte_always_inline unsigned int
+__rte_stack_lf_bucket_count(struct rte_stack *s)
+{
+	struct rte_stack_lf_bucket *buckets = __rte_stack_lf_buckets(s);
+	unsigned int count = __rte_stack_lf_count(s);
+	unsigned int i;
+
+	for (i = 0; i < RTE_MAX_LCORE; i++)
+		count += rte_atomic_load_explicit(&buckets[i].len,
+						  rte_memory_order_relaxed);
+
+	return count;
+}
+
 #endif /* _RTE_STACK_LF_H_ */
@@ -579,6 +579,68 @@ rte_swx_table_learner_add(void *table,
 	return 1;
 }
 
+/* Default number of buckets examined per expiry sweep invocation. */
+#define TABLE_EXPIRE_N_BUCKETS_DEFAULT 64
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_swx_table_learner_expire, 25.07)
+uint32_t
+rte_swx_table_learner_expire(void *table,
+			     uint64_t input_time,
+			     uint32_t n_buckets_max,
+			     uint32_t *position,
+			     size_t *entry_ids,
+			     uint32_t n_entry_ids_max)
+{
+	struct table *t = table;
+	uint32_t time_hi = (uint32_t)(input_time >> 32);
+	uint32_t n_entry_ids = 0;
+	size_t bucket_id;
+	uint32_t n;
+
+	if (!t || !position || !entry_ids)
+		return 0;
+
+	if (!n_buckets_max)
+		n_buckets_max = TABLE_EXPIRE_N_BUCKETS_DEFAULT;
+
+	bucket_id = *position & t->params.bucket_mask;
+
+	for (n = 0; n < n_buckets_max; n++) {
+		struct table_bucket *b;
+		uint32_t i, mask = 0;
+
+		/* Make sure the entry_ids array can absorb a full bucket, so that a bucket is
+		 * never left partially reported.
+		 */
+		if (n_entry_ids_max - n_entry_ids < TABLE_KEYS_PER_BUCKET)
+			break;
+
+		b = table_bucket_get(t, bucket_id);
+
+		/* Per-key expiry flags computed branch-free over the bucket time array, which is
+		 * laid out as a contiguous vector of 32-bit timestamps. A key is expired when its
+		 * time is non-zero (i.e. the position is occupied) and not in the future.
+		 */
+		for (i = 0; i < TABLE_KEYS_PER_BUCKET; i++)
+			mask |= (uint32_t)((b->time[i] - 1) < time_hi) << i;
+
+		if (mask)
+			for (i = 0; i < TABLE_KEYS_PER_BUCKET; i++)
+				if (mask & (1U << i)) {
+					/* Expire the key. */
+					b->time[i] = 0;
+
+					entry_ids[n_entry_ids++] = table_entry_id_get(t, b, i);
+				}
+
+		bucket_id = (bucket_id + 1) & t->params.bucket_mask;
+	}
+
+	*position = (uint32_t)bucket_id;
+
+	return n_entry_ids;
+}
+
 RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_swx_table_learner_delete, 21.11)
 void
 rte_swx_table_learner_delete(void *table __rte_unused,
@@ -306,6 +306,53 @@ void
 rte_swx_table_learner_delete(void *table,
 			     void *mailbox);
 
+/**
+ * Learner table expiry sweep
+ *
+ * Incrementally sweep the table buckets and expire the keys whose timeout elapsed before
+ * *input_time*. Without sweeping, an expired key lingers in its table position until a subsequent
+ * add operation hashing to the same bucket reclaims it, so under scan traffic the table slowly
+ * fills up with dead keys. The sweep proactively frees these positions and reports the expired
+ * entries, so the application can release any per-entry state of its own.
+ *
+ * The sweep is budgeted: each invocation examines at most *n_buckets_max* buckets starting from
+ * the *position* cursor, which is advanced in circular fashion, so a full table sweep can be
+ * spread over many invocations with bounded cost per invocation. The per-bucket key timestamps
+ * are laid out as a contiguous array, so the expiry comparison is done branch-free across all the
+ * keys of a bucket.
+ *
+ * This operation updates the table and must not run concurrently with the add or delete
+ * operations on the same table, unless externally synchronized. Each expired entry is reported
+ * exactly once.
+ *
+ * @param[in] table
+ *   Table handle.
+ * @param[in] input_time
+ *   Current time measured in CPU clock cycles.
+ * @param[in] n_buckets_max
+ *   Sweep budget, i.e. the maximum number of table buckets to examine during the current
+ *   invocation. When zero, an implementation-specific default budget is used.
+ * @param[in,out] position
+ *   Sweep cursor. Must be set to zero before the first invocation on the current table. On
+ *   return, it holds the position the next invocation is to resume from.
+ * @param[out] entry_ids
+ *   Array of size *n_entry_ids_max* to be filled in with the IDs of the expired entries.
+ * @param[in] n_entry_ids_max
+ *   Size of the *entry_ids* array.
+ * @return
+ *   Number of expired entries written to the *entry_ids* array. When equal to
+ *   *n_entry_ids_max*, more expired entries may be immediately available and the sweep should be
+ *   re-invoked before its regular cadence.
+ */
+__rte_experimental
+uint32_t
+rte_swx_table_learner_expire(void *table,
+			     uint64_t input_time,
+			     uint32_t n_buckets_max,
+			     uint32_t *position,
+			     size_t *entry_ids,
+			     uint32_t n_entry_ids_max);
+
 /**
  * Learner table free
  *
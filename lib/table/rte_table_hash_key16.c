@@ -10,6 +10,7 @@
 #include <rte_common.h>
 #include <rte_malloc.h>
 #include <rte_log.h>
+#include <rte_vect.h>
 
 #include "rte_table_hash.h"
 #include "rte_lru.h"
@@ -89,6 +90,20 @@ struct rte_table_hash {
 	alignas(RTE_CACHE_LINE_SIZE) uint8_t memory[];
 };
 
+#ifdef RTE_ARCH_X86_64
+
+static int
+keycmp(void *a, void *b, void *b_mask)
+{
+	__m128i a_128 = _mm_loadu_si128((__m128i *)a);
+	__m128i b_128 = _mm_and_si128(_mm_loadu_si128((__m128i *)b),
+		_mm_loadu_si128((__m128i *)b_mask));
+
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(a_128, b_128)) != 0xFFFF;
+}
+
+#else
+
 static int
 keycmp(void *a, void *b, void *b_mask)
 {
@@ -98,6 +113,8 @@ keycmp(void *a, void *b, void *b_mask)
 		(a64[1] != (b64[1] & b_mask64[1]));
 }
 
+#endif
+
 static void
 keycpy(void *dst, void *src, void *src_mask)
 {
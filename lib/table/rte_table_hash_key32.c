@@ -10,6 +10,7 @@
 #include <rte_common.h>
 #include <rte_malloc.h>
 #include <rte_log.h>
+#include <rte_vect.h>
 
 #include "rte_table_hash.h"
 #include "rte_lru.h"
@@ -89,6 +90,34 @@ struct rte_table_hash {
 	alignas(RTE_CACHE_LINE_SIZE) uint8_t memory[];
 };
 
+#if defined(RTE_ARCH_X86_64) && defined(__AVX2__)
+
+static int
+keycmp(void *a, void *b, void *b_mask)
+{
+	__m256i a_256 = _mm256_loadu_si256((__m256i *)a);
+	__m256i b_256 = _mm256_and_si256(_mm256_loadu_si256((__m256i *)b),
+		_mm256_loadu_si256((__m256i *)b_mask));
+
+	return _mm256_movemask_epi8(_mm256_cmpeq_epi8(a_256, b_256)) != -1;
+}
+
+#elif defined(RTE_ARCH_X86_64)
+
+static int
+keycmp(void *a, void *b, void *b_mask)
+{
+	__m128i *a_128 = a, *b_128 = b, *b_mask_128 = b_mask;
+	__m128i lo = _mm_cmpeq_epi8(_mm_loadu_si128(&a_128[0]),
+		_mm_and_si128(_mm_loadu_si128(&b_128[0]), _mm_loadu_si128(&b_mask_128[0])));
+	__m128i hi = _mm_cmpeq_epi8(_mm_loadu_si128(&a_128[1]),
+		_mm_and_si128(_mm_loadu_si128(&b_128[1]), _mm_loadu_si128(&b_mask_128[1])));
+
+	return _mm_movemask_epi8(_mm_and_si128(lo, hi)) != 0xFFFF;
+}
+
+#else
+
 static int
 keycmp(void *a, void *b, void *b_mask)
 {
@@ -100,6 +129,8 @@ keycmp(void *a, void *b, void *b_mask)
 		(a64[3] != (b64[3] & b_mask64[3]));
 }
 
+#endif
+
 static void
 keycpy(void *dst, void *src, void *src_mask)
 {
@@ -414,6 +414,81 @@ __rte_experimental
 int
 rte_telemetry_register_cmd_arg(const char *cmd, telemetry_arg_cb fn, void *arg, const char *help);
 
+/**
+ * Describes a single 64-bit counter within a counter block registered
+ * with rte_telemetry_register_counters().
+ */
+struct rte_tel_counter_desc {
+	const char *name;
+	/**< Name of the counter, used as the dictionary key when the block
+	 * is reported. Subject to the same character restrictions as
+	 * dictionary keys, see rte_tel_data_start_dict().
+	 */
+	uint32_t offset;
+	/**< Byte offset of the counter from the block base address. The
+	 * counter at that offset must be an 8-byte aligned uint64_t.
+	 */
+};
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Register a block of 64-bit counters for direct export via telemetry.
+ *
+ * Unlike a command callback, a registered counter block is read by the
+ * telemetry thread directly from the given memory using relaxed atomic
+ * 64-bit loads, without calling back into the owning library. Data-path
+ * threads can therefore update the counters with plain or relaxed
+ * stores and will never contend with a telemetry read. The block is
+ * reported by the "/counters" command with the block name as parameter;
+ * "/counters" without parameters lists the registered block names.
+ *
+ * The memory holding the counters and the counter names must remain
+ * valid until the block is unregistered; the descriptor array itself
+ * is copied and may be transient.
+ *
+ * @param name
+ *   Name uniquely identifying the block, e.g. "mempool_mbuf_pool".
+ * @param base
+ *   Base address of the counter block.
+ * @param counters
+ *   Array of *nb_counters* descriptors, one per exported counter.
+ * @param nb_counters
+ *   The number of counters in the block. Must not exceed
+ *   RTE_TEL_MAX_DICT_ENTRIES.
+ *
+ * @return
+ *   0 on success.
+ * @return
+ *   -EINVAL for invalid parameters.
+ * @return
+ *   -EEXIST if a block with the same name is already registered.
+ * @return
+ *   -ENOMEM for mem allocation failure.
+ */
+__rte_experimental
+int
+rte_telemetry_register_counters(const char *name, const void *base,
+		const struct rte_tel_counter_desc *counters, uint16_t nb_counters);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Unregister a counter block previously registered with
+ * rte_telemetry_register_counters().
+ *
+ * @param name
+ *   Name of the block to unregister.
+ *
+ * @return
+ *   0 on success, -ENOENT if no block with that name is registered.
+ */
+__rte_experimental
+int
+rte_telemetry_unregister_counters(const char *name);
+
 /**
  * @internal
  * Free a container that has memory allocated.
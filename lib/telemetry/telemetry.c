@@ -129,6 +129,115 @@ rte_telemetry_register_cmd_arg(const char *cmd, telemetry_arg_cb fn, void *arg,
 	return register_cmd(cmd, help, NULL, fn, arg);
 }
 
+struct counter_entry {
+	char name[RTE_TEL_MAX_STRING_LEN];
+	uint32_t offset;
+};
+
+struct counter_block {
+	char name[MAX_CMD_LEN];
+	const void *base;
+	struct counter_entry *counters;
+	uint16_t nb_counters;
+};
+
+/* list of counter blocks registered for direct export */
+static struct counter_block *counter_blocks;
+static int num_counter_blocks;
+/* Used when accessing or modifying list of counter blocks */
+static rte_spinlock_t counter_sl = RTE_SPINLOCK_INITIALIZER;
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_telemetry_register_counters, 25.07)
+int
+rte_telemetry_register_counters(const char *name, const void *base,
+		const struct rte_tel_counter_desc *counters, uint16_t nb_counters)
+{
+	struct counter_block *new_blocks, *blk;
+	struct counter_entry *entries;
+	const char *namep;
+	uint16_t i;
+	int j;
+
+	if (name == NULL || base == NULL || counters == NULL ||
+			nb_counters == 0 || nb_counters > RTE_TEL_MAX_DICT_ENTRIES ||
+			strlen(name) == 0 || strlen(name) >= MAX_CMD_LEN)
+		return -EINVAL;
+
+	for (namep = name; *namep != '\0'; namep++)
+		if (!isalnum(*namep) && *namep != '_')
+			return -EINVAL;
+
+	for (i = 0; i < nb_counters; i++) {
+		if (counters[i].name == NULL ||
+				strlen(counters[i].name) >= RTE_TEL_MAX_STRING_LEN ||
+				(counters[i].offset & (sizeof(uint64_t) - 1)) != 0)
+			return -EINVAL;
+	}
+
+	entries = calloc(nb_counters, sizeof(*entries));
+	if (entries == NULL)
+		return -ENOMEM;
+	for (i = 0; i < nb_counters; i++) {
+		strlcpy(entries[i].name, counters[i].name, RTE_TEL_MAX_STRING_LEN);
+		entries[i].offset = counters[i].offset;
+	}
+
+	rte_spinlock_lock(&counter_sl);
+	for (j = 0; j < num_counter_blocks; j++) {
+		if (strcmp(name, counter_blocks[j].name) == 0) {
+			rte_spinlock_unlock(&counter_sl);
+			free(entries);
+			return -EEXIST;
+		}
+	}
+	new_blocks = realloc(counter_blocks,
+			sizeof(counter_blocks[0]) * (num_counter_blocks + 1));
+	if (new_blocks == NULL) {
+		rte_spinlock_unlock(&counter_sl);
+		free(entries);
+		return -ENOMEM;
+	}
+	counter_blocks = new_blocks;
+
+	blk = &counter_blocks[num_counter_blocks];
+	strlcpy(blk->name, name, MAX_CMD_LEN);
+	blk->base = base;
+	blk->counters = entries;
+	blk->nb_counters = nb_counters;
+	num_counter_blocks++;
+	rte_spinlock_unlock(&counter_sl);
+
+	return 0;
+}
+
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_telemetry_unregister_counters, 25.07)
+int
+rte_telemetry_unregister_counters(const char *name)
+{
+	struct counter_entry *entries = NULL;
+	int i;
+
+	if (name == NULL)
+		return -ENOENT;
+
+	rte_spinlock_lock(&counter_sl);
+	for (i = 0; i < num_counter_blocks; i++) {
+		if (strcmp(name, counter_blocks[i].name) != 0)
+			continue;
+		entries = counter_blocks[i].counters;
+		memmove(counter_blocks + i, counter_blocks + i + 1,
+			sizeof(struct counter_block) * (num_counter_blocks - i - 1));
+		num_counter_blocks--;
+		break;
+	}
+	rte_spinlock_unlock(&counter_sl);
+
+	if (entries == NULL)
+		return -ENOENT;
+	free(entries);
+	return 0;
+}
+
 #ifndef RTE_EXEC_ENV_WINDOWS
 
 static int
@@ -145,6 +254,46 @@ list_commands(const char *cmd __rte_unused, const char *params __rte_unused,
 	return 0;
 }
 
+static int
+counters_read(const char *cmd __rte_unused, const char *params,
+		struct rte_tel_data *d)
+{
+	const struct counter_block *blk = NULL;
+	uint16_t j;
+	int i;
+
+	rte_spinlock_lock(&counter_sl);
+	if (params == NULL || strlen(params) == 0) {
+		/* no block requested, list the registered block names */
+		rte_tel_data_start_array(d, RTE_TEL_STRING_VAL);
+		for (i = 0; i < num_counter_blocks; i++)
+			rte_tel_data_add_array_string(d, counter_blocks[i].name);
+		rte_spinlock_unlock(&counter_sl);
+		return 0;
+	}
+	for (i = 0; i < num_counter_blocks; i++)
+		if (strcmp(params, counter_blocks[i].name) == 0) {
+			blk = &counter_blocks[i];
+			break;
+		}
+	if (blk == NULL) {
+		rte_spinlock_unlock(&counter_sl);
+		return -1;
+	}
+	/* read the live counters directly, no callback into the library */
+	rte_tel_data_start_dict(d);
+	for (j = 0; j < blk->nb_counters; j++) {
+		const RTE_ATOMIC(uint64_t) *ctr = (const RTE_ATOMIC(uint64_t) *)
+			(const void *)((const char *)blk->base +
+				blk->counters[j].offset);
+
+		rte_tel_data_add_dict_uint(d, blk->counters[j].name,
+			rte_atomic_load_explicit(ctr, rte_memory_order_relaxed));
+	}
+	rte_spinlock_unlock(&counter_sl);
+	return 0;
+}
+
 static int
 json_info(const char *cmd __rte_unused, const char *params __rte_unused,
 		struct rte_tel_data *d)
@@ -613,6 +762,8 @@ telemetry_v2_init(void)
 			"Returns DPDK Telemetry information. Takes no parameters");
 	rte_telemetry_register_cmd("/help", command_help,
 			"Returns help text for a command. Parameters: string command");
+	rte_telemetry_register_cmd("/counters", counters_read,
+			"Returns a registered counter block, read directly from memory. Parameters: string block name, or none to list blocks");
 	v2_socket.fn = client_handler;
 	if (strlcpy(spath, get_socket_path(socket_dir, 2), sizeof(spath)) >= sizeof(spath)) {
 		TMTY_LOG_LINE(ERR, "Error with socket binding, path too long");
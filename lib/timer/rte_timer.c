@@ -19,6 +19,7 @@
 #include <rte_random.h>
 #include <rte_pause.h>
 #include <rte_memzone.h>
+#include <rte_malloc.h>
 
 #include "rte_timer.h"
 
@@ -60,6 +61,46 @@ static struct rte_timer_data *rte_timer_data_arr;
 static const uint32_t default_data_id;
 static uint32_t rte_timer_subsystem_initialized;
 
+/*
+ * Hierarchical timing wheel backend, selectable per timer data instance with
+ * rte_timer_data_wheel_enable(). Each lcore owns a wheel of WHEEL_LEVELS
+ * levels of WHEEL_SLOTS_PER_LEVEL slots; a slot at level l spans
+ * 2^(WHEEL_LEVEL_BITS * l) wheel ticks, and a tick is 2^res_shift timer
+ * cycles. Arming and disarming a timer are O(1) slot list operations, and
+ * rte_timer_alt_manage_bulk() expires whole slots at a time, so the cost of
+ * a manage call no longer grows with the number of pending timers the way
+ * the skiplist walk does.
+ *
+ * Pending timers are doubly linked within a slot through the first two
+ * sl_next[] entries of the handle: sl_next[0] is the next pointer and
+ * sl_next[1] points back at the previous link. A NULL sl_next[1] means the
+ * timer is not linked in any slot.
+ *
+ * The wheels live in process-local memory, so unlike the default skiplist
+ * instance, a wheel-enabled timer data instance cannot be shared with
+ * secondary processes.
+ */
+#define WHEEL_LEVEL_BITS 8
+#define WHEEL_SLOTS_PER_LEVEL (1 << WHEEL_LEVEL_BITS)
+#define WHEEL_SLOT_MASK (WHEEL_SLOTS_PER_LEVEL - 1)
+#define WHEEL_LEVELS 4
+#define WHEEL_SPAN_BITS (WHEEL_LEVEL_BITS * WHEEL_LEVELS)
+#define WHEEL_EXPIRE_BURST 64
+
+struct __rte_cache_aligned wheel_lcore {
+	struct rte_timer *slot[WHEEL_LEVELS][WHEEL_SLOTS_PER_LEVEL];
+	/**< heads of the per-slot pending timer lists */
+	uint64_t time;        /**< current wheel time, in wheel ticks */
+	uint32_t nb_pending;  /**< number of timers linked in the slots */
+};
+
+struct timer_wheel {
+	unsigned int res_shift;  /**< log2 of timer cycles per wheel tick */
+	struct wheel_lcore lcore[RTE_MAX_LCORE];
+};
+
+static struct timer_wheel *timer_wheels[RTE_MAX_DATA_ELS];
+
 /* when debug is enabled, store some statistics */
 #ifdef RTE_LIBRTE_TIMER_DEBUG
 #define __TIMER_STAT_ADD(priv_timer, name, n) do {			\
@@ -78,6 +119,13 @@ timer_data_valid(uint32_t id)
 		(rte_timer_data_arr[id].internal_flags & FL_ALLOCATED);
 }
 
+/* return the timing wheel of an instance, or NULL for skiplist instances */
+static inline struct timer_wheel *
+timer_data_wheel(const struct rte_timer_data *timer_data)
+{
+	return timer_wheels[timer_data - rte_timer_data_arr];
+}
+
 /* validate ID and retrieve timer data pointer, or return error value */
 #define TIMER_DATA_VALID_GET_OR_ERR_RET(id, timer_data, retval) do {	\
 	if (id >= RTE_MAX_DATA_ELS || !timer_data_valid(id))		\
@@ -117,11 +165,54 @@ rte_timer_data_dealloc(uint32_t id)
 	struct rte_timer_data *timer_data;
 	TIMER_DATA_VALID_GET_OR_ERR_RET(id, timer_data, -EINVAL);
 
+	rte_free(timer_wheels[id]);
+	timer_wheels[id] = NULL;
+
 	timer_data->internal_flags &= ~(FL_ALLOCATED);
 
 	return 0;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_timer_data_wheel_enable, 25.07)
+int
+rte_timer_data_wheel_enable(uint32_t timer_data_id, uint64_t resolution_cycles)
+{
+	struct timer_wheel *wheel;
+	uint64_t cur_tick;
+	unsigned int lcore_id;
+
+	if (timer_data_id >= RTE_MAX_DATA_ELS ||
+	    !timer_data_valid(timer_data_id))
+		return -EINVAL;
+
+	/* the default instance keeps the skiplist so that the semantics of
+	 * rte_timer_manage() and rte_timer_next_ticks() are unchanged
+	 */
+	if (timer_data_id == default_data_id || resolution_cycles == 0)
+		return -EINVAL;
+
+	if (timer_wheels[timer_data_id] != NULL)
+		return -EALREADY;
+
+	wheel = rte_zmalloc("rte_timer_wheel", sizeof(*wheel),
+			    RTE_CACHE_LINE_SIZE);
+	if (wheel == NULL)
+		return -ENOMEM;
+
+	/* round the resolution up to a power of two cycles, so that cycle
+	 * counts convert to wheel ticks with a plain shift
+	 */
+	wheel->res_shift = rte_log2_u64(rte_align64pow2(resolution_cycles));
+
+	cur_tick = rte_get_timer_cycles() >> wheel->res_shift;
+	for (lcore_id = 0; lcore_id < RTE_MAX_LCORE; lcore_id++)
+		wheel->lcore[lcore_id].time = cur_tick;
+
+	timer_wheels[timer_data_id] = wheel;
+
+	return 0;
+}
+
 /* Init the timer library. Allocate an array of timer data structs in shared
  * memory, and allocate the zeroth entry for use with original timer
  * APIs. Since the intersection of the sets of lcore ids in primary and
@@ -469,6 +560,173 @@ timer_del(struct rte_timer *tim, union rte_timer_status prev_status,
 		rte_spinlock_unlock(&priv_timer[prev_owner].list_lock);
 }
 
+/* round an expiry time up to a wheel tick, so timers never fire early */
+static inline uint64_t
+wheel_tick(uint64_t expire, unsigned int res_shift)
+{
+	return (expire + (1ULL << res_shift) - 1) >> res_shift;
+}
+
+/* link a timer at the head of a wheel slot list */
+static void
+wheel_slot_insert(struct rte_timer **head, struct rte_timer *tim)
+{
+	tim->sl_next[0] = *head;
+	if (*head != NULL)
+		(*head)->sl_next[1] = (struct rte_timer *)&tim->sl_next[0];
+	*head = tim;
+	tim->sl_next[1] = (struct rte_timer *)head;
+}
+
+/* unlink a timer from its wheel slot list */
+static void
+wheel_slot_remove(struct rte_timer *tim)
+{
+	struct rte_timer **pprev = (struct rte_timer **)tim->sl_next[1];
+
+	*pprev = tim->sl_next[0];
+	if (tim->sl_next[0] != NULL)
+		tim->sl_next[0]->sl_next[1] = tim->sl_next[1];
+	tim->sl_next[1] = NULL;
+}
+
+/* call with the destination lcore list lock held as necessary
+ * add the timer in the slot its expiry time falls into
+ * timer must not be linked in any slot
+ */
+static void
+wheel_add(struct timer_wheel *wheel, unsigned int tim_lcore,
+	  struct rte_timer *tim)
+{
+	struct wheel_lcore *wl = &wheel->lcore[tim_lcore];
+	uint64_t exp = wheel_tick(tim->expire, wheel->res_shift);
+	uint64_t delta;
+	unsigned int lvl;
+
+	/* already due timers go into the current slot, where the next
+	 * manage call picks them up
+	 */
+	if (exp <= wl->time)
+		exp = wl->time;
+
+	/* timers beyond the wheel span park in the top level and go around
+	 * again when the wheel reaches them
+	 */
+	if (exp - wl->time >= 1ULL << WHEEL_SPAN_BITS)
+		exp = wl->time + (1ULL << WHEEL_SPAN_BITS) - 1;
+
+	delta = exp - wl->time;
+	for (lvl = 0; lvl < WHEEL_LEVELS - 1; lvl++)
+		if (delta < 1ULL << (WHEEL_LEVEL_BITS * (lvl + 1)))
+			break;
+
+	wheel_slot_insert(&wl->slot[lvl][(exp >> (WHEEL_LEVEL_BITS * lvl)) &
+			WHEEL_SLOT_MASK], tim);
+}
+
+/*
+ * del from wheel, lock if needed
+ * timer must be in config state
+ */
+static void
+wheel_del(struct timer_wheel *wheel, struct rte_timer *tim,
+	  union rte_timer_status prev_status, int local_is_locked,
+	  struct priv_timer *priv_timer)
+{
+	unsigned int lcore_id = rte_lcore_id();
+	unsigned int prev_owner = prev_status.owner;
+
+	/* if timer is pending on another core, we need to lock the
+	 * list; if it is on local core, we need to lock if we are not
+	 * called from the manage function */
+	if (prev_owner != lcore_id || !local_is_locked)
+		rte_spinlock_lock(&priv_timer[prev_owner].list_lock);
+
+	/* the manage function may already have unlinked this timer from
+	 * its slot while collecting expired timers
+	 */
+	if (tim->sl_next[1] != NULL) {
+		wheel_slot_remove(tim);
+		wheel->lcore[prev_owner].nb_pending--;
+	}
+
+	if (prev_owner != lcore_id || !local_is_locked)
+		rte_spinlock_unlock(&priv_timer[prev_owner].list_lock);
+}
+
+/* move the timers of a level-0 slot that are due to the expired list */
+static struct rte_timer *
+wheel_expire_slot(struct wheel_lcore *wl, struct rte_timer **head,
+		  uint64_t now_tick, unsigned int res_shift,
+		  struct rte_timer *exp_list)
+{
+	struct rte_timer *tim, *next_tim;
+
+	for (tim = *head; tim != NULL; tim = next_tim) {
+		next_tim = tim->sl_next[0];
+
+		/* the slot is shared with timers one wheel turn away */
+		if (wheel_tick(tim->expire, res_shift) > now_tick)
+			continue;
+
+		wheel_slot_remove(tim);
+		wl->nb_pending--;
+		tim->sl_next[0] = exp_list;
+		exp_list = tim;
+	}
+
+	return exp_list;
+}
+
+/* reinsert the timers of an upper level slot one level down */
+static void
+wheel_cascade(struct timer_wheel *wheel, unsigned int tim_lcore,
+	      unsigned int lvl)
+{
+	struct wheel_lcore *wl = &wheel->lcore[tim_lcore];
+	struct rte_timer **head = &wl->slot[lvl][(wl->time >>
+			(WHEEL_LEVEL_BITS * lvl)) & WHEEL_SLOT_MASK];
+	struct rte_timer *tim;
+
+	while ((tim = *head) != NULL) {
+		wheel_slot_remove(tim);
+		wheel_add(wheel, tim_lcore, tim);
+	}
+}
+
+/* call with the lcore list lock held
+ * advance the wheel to the current time and return the list of expired
+ * timers, linked through sl_next[0]
+ */
+static struct rte_timer *
+wheel_expire(struct timer_wheel *wheel, unsigned int tim_lcore,
+	     uint64_t now_tick)
+{
+	struct wheel_lcore *wl = &wheel->lcore[tim_lcore];
+	struct rte_timer *exp_list = NULL;
+	unsigned int lvl;
+
+	while (wl->time <= now_tick) {
+		exp_list = wheel_expire_slot(wl,
+				&wl->slot[0][wl->time & WHEEL_SLOT_MASK],
+				now_tick, wheel->res_shift, exp_list);
+
+		if (wl->time == now_tick)
+			break;
+		wl->time++;
+
+		/* refill lower levels on their period boundaries */
+		for (lvl = 1; lvl < WHEEL_LEVELS; lvl++) {
+			if ((wl->time &
+			     ((1ULL << (WHEEL_LEVEL_BITS * lvl)) - 1)) != 0)
+				break;
+			wheel_cascade(wheel, tim_lcore, lvl);
+		}
+	}
+
+	return exp_list;
+}
+
 /* Reset and start the timer associated with the timer handle (private func) */
 static int
 __rte_timer_reset(struct rte_timer *tim, uint64_t expire,
@@ -481,6 +739,7 @@ __rte_timer_reset(struct rte_timer *tim, uint64_t expire,
 	int ret;
 	unsigned lcore_id = rte_lcore_id();
 	struct priv_timer *priv_timer = timer_data->priv_timer;
+	struct timer_wheel *wheel = timer_data_wheel(timer_data);
 
 	/* round robin for tim_lcore */
 	if (tim_lcore == (unsigned)LCORE_ID_ANY) {
@@ -510,7 +769,12 @@ __rte_timer_reset(struct rte_timer *tim, uint64_t expire,
 
 	/* remove it from list */
 	if (prev_status.state == RTE_TIMER_PENDING) {
-		timer_del(tim, prev_status, local_is_locked, priv_timer);
+		if (wheel != NULL)
+			wheel_del(wheel, tim, prev_status, local_is_locked,
+				  priv_timer);
+		else
+			timer_del(tim, prev_status, local_is_locked,
+				  priv_timer);
 		__TIMER_STAT_ADD(priv_timer, pending, -1);
 	}
 
@@ -527,7 +791,11 @@ __rte_timer_reset(struct rte_timer *tim, uint64_t expire,
 		rte_spinlock_lock(&priv_timer[tim_lcore].list_lock);
 
 	__TIMER_STAT_ADD(priv_timer, pending, 1);
-	timer_add(tim, tim_lcore, priv_timer);
+	if (wheel != NULL) {
+		wheel_add(wheel, tim_lcore, tim);
+		wheel->lcore[tim_lcore].nb_pending++;
+	} else
+		timer_add(tim, tim_lcore, priv_timer);
 
 	/* update state: as we are in CONFIG state, only us can modify
 	 * the state so we don't need to use cmpset() here */
@@ -611,7 +879,12 @@ __rte_timer_stop(struct rte_timer *tim,
 
 	/* remove it from list */
 	if (prev_status.state == RTE_TIMER_PENDING) {
-		timer_del(tim, prev_status, 0, priv_timer);
+		struct timer_wheel *wheel = timer_data_wheel(timer_data);
+
+		if (wheel != NULL)
+			wheel_del(wheel, tim, prev_status, 0, priv_timer);
+		else
+			timer_del(tim, prev_status, 0, priv_timer);
 		__TIMER_STAT_ADD(priv_timer, pending, -1);
 	}
 
@@ -825,6 +1098,10 @@ rte_timer_alt_manage(uint32_t timer_data_id,
 
 	TIMER_DATA_VALID_GET_OR_ERR_RET(timer_data_id, data, -EINVAL);
 
+	/* wheel instances are managed with rte_timer_alt_manage_bulk() */
+	if (timer_data_wheel(data) != NULL)
+		return -ENOTSUP;
+
 	/* timer manager only runs on EAL thread with valid lcore_id */
 	assert(this_lcore < RTE_MAX_LCORE);
 
@@ -984,6 +1261,132 @@ rte_timer_alt_manage(uint32_t timer_data_id,
 	return 0;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_timer_alt_manage_bulk, 25.07)
+int
+rte_timer_alt_manage_bulk(uint32_t timer_data_id, unsigned int *poll_lcores,
+			  int nb_poll_lcores, rte_timer_manage_bulk_cb_t f,
+			  void *f_arg)
+{
+	unsigned int default_poll_lcores[] = {rte_lcore_id()};
+	struct rte_timer *expired[WHEEL_EXPIRE_BURST];
+	struct rte_timer *rearm[WHEEL_EXPIRE_BURST];
+	struct rte_timer *tim, *next_tim, *exp_list;
+	unsigned int this_lcore = rte_lcore_id();
+	struct rte_timer_data *data;
+	struct timer_wheel *wheel;
+	struct priv_timer *privp;
+	struct wheel_lcore *wl;
+	uint64_t now_tick;
+	uint32_t poll_lcore;
+	int i;
+
+	TIMER_DATA_VALID_GET_OR_ERR_RET(timer_data_id, data, -EINVAL);
+
+	wheel = timer_data_wheel(data);
+	if (wheel == NULL)
+		return -ENOTSUP;
+
+	/* timer manager only runs on EAL thread with valid lcore_id */
+	assert(this_lcore < RTE_MAX_LCORE);
+
+	__TIMER_STAT_ADD(data->priv_timer, manage, 1);
+
+	if (poll_lcores == NULL) {
+		poll_lcores = default_poll_lcores;
+		nb_poll_lcores = RTE_DIM(default_poll_lcores);
+	}
+
+	for (i = 0; i < nb_poll_lcores; i++) {
+		poll_lcore = poll_lcores[i];
+		privp = &data->priv_timer[poll_lcore];
+		wl = &wheel->lcore[poll_lcore];
+
+		now_tick = rte_get_timer_cycles() >> wheel->res_shift;
+
+		/* optimize for the case where the wheel is empty and current */
+		if (wl->nb_pending == 0 && wl->time == now_tick)
+			continue;
+
+		rte_spinlock_lock(&privp->list_lock);
+		if (wl->nb_pending == 0) {
+			/* nothing to cascade, jump straight to current time */
+			wl->time = now_tick;
+			rte_spinlock_unlock(&privp->list_lock);
+			continue;
+		}
+		exp_list = wheel_expire(wheel, poll_lcore, now_tick);
+		rte_spinlock_unlock(&privp->list_lock);
+
+		/* run the expired timers in bursts */
+		while (exp_list != NULL) {
+			unsigned int nb_exp = 0, nb_rearm = 0;
+			unsigned int j;
+
+			for (tim = exp_list;
+			     tim != NULL && nb_exp < WHEEL_EXPIRE_BURST;
+			     tim = next_tim) {
+				next_tim = tim->sl_next[0];
+
+				/* another core is trying to re-config this
+				 * one, it is no longer ours to run
+				 */
+				if (timer_set_running_state(tim) != 0)
+					continue;
+
+				expired[nb_exp++] = tim;
+				if (tim->period != 0)
+					rearm[nb_rearm++] = tim;
+			}
+			exp_list = tim;
+
+			/* cheap rearm: periodic timers go back on the wheel
+			 * in one lock round trip for the whole burst
+			 */
+			if (nb_rearm != 0) {
+				rte_spinlock_lock(&privp->list_lock);
+				for (j = 0; j < nb_rearm; j++) {
+					tim = rearm[j];
+					tim->expire += tim->period;
+					wheel_add(wheel, poll_lcore, tim);
+					wl->nb_pending++;
+				}
+				rte_spinlock_unlock(&privp->list_lock);
+			}
+
+			/* hand ownership back before running the callback,
+			 * so that it may freely reset or stop any timer,
+			 * including the expired ones
+			 */
+			for (j = 0; j < nb_exp; j++) {
+				union rte_timer_status status;
+
+				tim = expired[j];
+				if (tim->period != 0) {
+					status.state = RTE_TIMER_PENDING;
+					status.owner = (int16_t)poll_lcore;
+				} else {
+					status.state = RTE_TIMER_STOP;
+					status.owner = RTE_TIMER_NO_OWNER;
+					__TIMER_STAT_ADD(data->priv_timer,
+							 pending, -1);
+				}
+				/* The "RELEASE" ordering guarantees the
+				 * memory operations above the status update
+				 * are observed before the update by all
+				 * threads
+				 */
+				rte_atomic_store_explicit(&tim->status.u32,
+					status.u32, rte_memory_order_release);
+			}
+
+			if (nb_exp != 0)
+				f(expired, nb_exp, f_arg);
+		}
+	}
+
+	return 0;
+}
+
 /* Walk pending lists, stopping timers and calling user-specified function */
 RTE_EXPORT_SYMBOL(rte_timer_stop_all)
 int
@@ -996,13 +1399,39 @@ rte_timer_stop_all(uint32_t timer_data_id, unsigned int *walk_lcores,
 	uint32_t walk_lcore;
 	struct rte_timer *tim, *next_tim;
 	struct rte_timer_data *timer_data;
+	struct timer_wheel *wheel;
 
 	TIMER_DATA_VALID_GET_OR_ERR_RET(timer_data_id, timer_data, -EINVAL);
 
+	wheel = timer_data_wheel(timer_data);
+
 	for (i = 0; i < nb_walk_lcores; i++) {
 		walk_lcore = walk_lcores[i];
 		priv_timer = &timer_data->priv_timer[walk_lcore];
 
+		if (wheel != NULL) {
+			struct wheel_lcore *wl = &wheel->lcore[walk_lcore];
+			unsigned int lvl, slot;
+
+			for (lvl = 0; lvl < WHEEL_LEVELS; lvl++) {
+				for (slot = 0; slot < WHEEL_SLOTS_PER_LEVEL;
+				     slot++) {
+					for (tim = wl->slot[lvl][slot];
+					     tim != NULL;
+					     tim = next_tim) {
+						next_tim = tim->sl_next[0];
+
+						__rte_timer_stop(tim,
+								 timer_data);
+
+						if (f)
+							f(tim, f_arg);
+					}
+				}
+			}
+			continue;
+		}
+
 		for (tim = priv_timer->pending_head.sl_next[0];
 		     tim != NULL;
 		     tim = next_tim) {
@@ -464,6 +464,100 @@ int
 rte_timer_alt_manage(uint32_t timer_data_id, unsigned int *poll_lcores,
 		     int n_poll_lcores, rte_timer_alt_manage_cb_t f);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Switch a timer data instance from the default skiplist backend to a
+ * hierarchical timing wheel backend.
+ *
+ * With the wheel backend, arming and disarming a timer are constant time
+ * operations, and expired timers are handed to the application in bulk by
+ * rte_timer_alt_manage_bulk(), so the cost of a manage call does not grow
+ * with the number of pending timers. In exchange, expiry is quantized to
+ * the wheel resolution, and timers can fire up to one resolution step
+ * late.
+ *
+ * This function must be called directly after rte_timer_data_alloc(),
+ * before any timer is armed on the instance. The default timer data
+ * instance cannot be switched, so the behavior of rte_timer_manage() is
+ * unaffected. Timers on a wheel instance must be managed with
+ * rte_timer_alt_manage_bulk(); rte_timer_alt_manage() returns -ENOTSUP
+ * for such an instance. The wheel state is process-local, so a wheel
+ * instance cannot be shared with secondary processes.
+ *
+ * @param timer_data_id
+ *   An identifier indicating which instance of timer data should be
+ *   switched to the timing wheel backend.
+ * @param resolution_cycles
+ *   The expiry resolution of the wheel, in timer cycles (see
+ *   rte_get_timer_hz()). The value is rounded up to a power of two
+ *   cycles. Smaller values give more accurate expiry but make catching up
+ *   after a long gap between manage calls more expensive.
+ * @return
+ *   - 0: success
+ *   - -EINVAL: invalid timer_data_id, the default instance, or a zero
+ *     resolution
+ *   - -EALREADY: the instance already uses the timing wheel backend
+ *   - -ENOMEM: unable to allocate memory for the wheels
+ */
+__rte_experimental
+int
+rte_timer_data_wheel_enable(uint32_t timer_data_id,
+			    uint64_t resolution_cycles);
+
+/**
+ * Callback function type for rte_timer_alt_manage_bulk().
+ */
+typedef void (*rte_timer_manage_bulk_cb_t)(struct rte_timer **tims,
+					   unsigned int nb_timers, void *arg);
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change without prior notice.
+ *
+ * Manage a timing wheel timer data instance and execute the specified
+ * callback function for batches of expired timers. This function is the
+ * equivalent of rte_timer_alt_manage() for instances switched with
+ * rte_timer_data_wheel_enable(); callback functions of individual timers
+ * are ignored.
+ *
+ * Unlike rte_timer_manage(), the timers passed to the callback are no
+ * longer in the RUNNING state when it executes: a one-shot timer has
+ * already been stopped and a periodic timer has already been rearmed for
+ * its next period. The callback may therefore freely reset or stop any
+ * timer, including the expired ones. In return, a one-shot timer handle
+ * may already have been rearmed by another lcore by the time the callback
+ * sees it.
+ *
+ * @see rte_timer_alt_manage()
+ *
+ * @param timer_data_id
+ *   An identifier indicating which instance of timer data should be used
+ *   for this operation.
+ * @param poll_lcores
+ *   An array of lcore ids identifying the timer lists that should be
+ *   processed. NULL is allowed - if NULL, the timer list corresponding to
+ *   the lcore calling this routine is processed.
+ * @param n_poll_lcores
+ *   The size of the poll_lcores array. If 'poll_lcores' is NULL, this
+ *   parameter is ignored.
+ * @param f
+ *   The callback function which should be called for each batch of
+ *   expired timers.
+ * @param f_arg
+ *   An arbitrary argument that will be passed to f.
+ * @return
+ *   - 0: success
+ *   - -EINVAL: invalid timer_data_id
+ *   - -ENOTSUP: the instance does not use the timing wheel backend
+ */
+__rte_experimental
+int
+rte_timer_alt_manage_bulk(uint32_t timer_data_id, unsigned int *poll_lcores,
+			  int n_poll_lcores, rte_timer_manage_bulk_cb_t f,
+			  void *f_arg);
+
 /**
  * Callback function type for rte_timer_stop_all().
  */
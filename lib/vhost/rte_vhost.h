@@ -959,6 +959,37 @@ int rte_vhost_vring_call(int vid, uint16_t vring_idx);
  */
 int rte_vhost_vring_call_nonblock(int vid, uint16_t vring_idx);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Enable guest notification coalescing on a virtqueue.
+ *
+ * When enabled, a guest notification requested by the ring is not injected
+ * immediately if one was sent recently; it is held back so that subsequent
+ * bursts share a single guest wakeup, and delivered no later than
+ * max_delay_us after the first held-back request. The effective hold window
+ * adapts to the observed notification request rate, so low-rate traffic is
+ * notified with minimal added latency. Held notifications are flushed by
+ * the datapath and by rte_vhost_vring_call().
+ *
+ * The number of coalesced notifications is reported by the
+ * "guest_notifications_coalesced" virtqueue statistic.
+ *
+ * @param vid
+ *  vhost device ID
+ * @param queue_id
+ *  virtio queue index
+ * @param max_delay_us
+ *  maximum time a notification may be held back, in microseconds.
+ *  0 disables coalescing and flushes any pending notification.
+ * @return
+ *  0 on success, -1 on failure
+ */
+__rte_experimental
+int rte_vhost_notify_guest_coalesce(int vid, uint16_t queue_id,
+		uint32_t max_delay_us);
+
 /**
  * Get vhost RX queue avail count.
  *
@@ -1042,6 +1073,51 @@ int
 rte_vhost_get_vring_base_from_inflight(int vid,
 	uint16_t queue_id, uint16_t *last_avail_idx, uint16_t *last_used_idx);
 
+/**
+ * Incremental snapshot of the migration-relevant state of a virtqueue.
+ *
+ * last_avail_idx and last_used_idx carry the wrap counters in bit 15 for
+ * packed rings, matching rte_vhost_get_vring_base().
+ */
+struct rte_vhost_vring_snapshot {
+	uint16_t last_avail_idx;
+	uint16_t last_used_idx;
+	/** Descriptors handed to the backend but not yet marked used. */
+	uint16_t nr_inflight;
+};
+
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Capture the migration-relevant state of a virtqueue without stopping it.
+ *
+ * Unlike rte_vhost_get_vring_base(), this function may be called
+ * periodically while the queue keeps processing packets, so the device
+ * state can be transferred incrementally and the final quiesce only has
+ * to reconcile the delta since the last snapshot. The indexes are read
+ * without serializing against the data path; each field is individually
+ * consistent, and any in-between progress is covered by the final
+ * rte_vhost_get_vring_base() call after the queue is stopped.
+ *
+ * The inflight descriptor count is derived from the inflight tracking
+ * region when VHOST_USER_PROTOCOL_F_INFLIGHT_SHMFD is negotiated, and is
+ * reported as zero otherwise.
+ *
+ * @param vid
+ *  vhost device ID
+ * @param queue_id
+ *  vhost queue index
+ * @param snapshot
+ *  snapshot structure to fill
+ * @return
+ *  0 on success, -1 on failure
+ */
+__rte_experimental
+int
+rte_vhost_vring_snapshot(int vid, uint16_t queue_id,
+	struct rte_vhost_vring_snapshot *snapshot);
+
 /**
  * Set last_avail/used_idx of the vhost virtqueue
  *
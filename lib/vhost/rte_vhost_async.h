@@ -266,6 +266,34 @@ rte_vhost_async_try_dequeue_burst(int vid, uint16_t queue_id,
 	struct rte_mempool *mbuf_pool, struct rte_mbuf **pkts, uint16_t count,
 	int *nr_inflight, int16_t dma_id, uint16_t vchan_id);
 
+/**
+ * @warning
+ * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
+ *
+ * Poll completions on a DMA vChannel used by the Vhost asynchronous data
+ * path and mark the packets whose copies have finished as complete. This
+ * allows completion polling to be offloaded to a service core, so that
+ * lcores calling rte_vhost_poll_enqueue_completed() or
+ * rte_vhost_async_try_dequeue_burst() find copies already completed
+ * instead of blocking on the DMA device.
+ *
+ * This function is safe to call concurrently with data path threads using
+ * the same DMA vChannel.
+ *
+ * @param dma_id
+ *  the identifier of DMA device
+ * @param vchan_id
+ *  the identifier of virtual DMA channel
+ * @param max_copies
+ *  maximum number of copy completions to poll
+ * @return
+ *  Number of completed copies
+ */
+__rte_experimental
+uint16_t
+rte_vhost_async_dma_completed_poll(int16_t dma_id, uint16_t vchan_id,
+	uint16_t max_copies);
+
 /**
  * @warning
  * @b EXPERIMENTAL: this API may change, or be removed, without prior notice.
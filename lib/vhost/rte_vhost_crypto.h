@@ -91,7 +91,8 @@ rte_vhost_crypto_set_zero_copy(int vid, enum rte_vhost_crypto_zero_copy option);
 /**
  * Fetch a number of vring descriptors from virt-queue and translate to DPDK
  * crypto operations. After this function is executed, the user can enqueue
- * the processed ops to the target cryptodev.
+ * the processed ops to the target cryptodev. The returned ops are grouped
+ * by crypto session, which helps PMDs process the burst.
  *
  * @param vid
  *  The identifier of the vhost device.
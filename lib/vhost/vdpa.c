@@ -8,12 +8,14 @@
  * Device specific vhost lib
  */
 
+#include <string.h>
 #include <sys/queue.h>
 
 #include <dev_driver.h>
 #include <eal_export.h>
 #include <rte_class.h>
 #include <rte_malloc.h>
+#include <rte_prefetch.h>
 #include <rte_spinlock.h>
 #include <rte_tailq.h>
 
@@ -151,19 +153,82 @@ rte_vdpa_unregister_device(struct rte_vdpa_device *dev)
 	return ret;
 }
 
+/* Used entries relayed per IOTLB acquisition and dirty-log sync. */
+#define VDPA_RELAY_BURST_SZ 32
+
+/* Walk one completed descriptor chain and log its writeable buffers. */
+static int
+vdpa_relay_used_entry(struct virtio_net *dev, struct vhost_virtqueue *vq,
+		uint16_t desc_id)
+	__rte_requires_shared_capability(&vq->iotlb_lock)
+{
+	struct vring_desc *desc_ring = vq->desc;
+	struct vring_desc *idesc = NULL;
+	uint32_t nr_descs = vq->size;
+	struct vring_desc desc;
+	uint64_t dlen;
+
+	if (unlikely(desc_id >= vq->size))
+		return -1;
+
+	if (vq->desc[desc_id].flags & VRING_DESC_F_INDIRECT) {
+		dlen = vq->desc[desc_id].len;
+		nr_descs = dlen / sizeof(struct vring_desc);
+		if (unlikely(nr_descs > vq->size))
+			return -1;
+
+		desc_ring = (struct vring_desc *)(uintptr_t)
+			vhost_iova_to_vva(dev, vq,
+					vq->desc[desc_id].addr, &dlen,
+					VHOST_ACCESS_RO);
+		if (unlikely(!desc_ring))
+			return -1;
+
+		if (unlikely(dlen < vq->desc[desc_id].len)) {
+			idesc = vhost_alloc_copy_ind_table(dev, vq,
+					vq->desc[desc_id].addr,
+					vq->desc[desc_id].len);
+			if (unlikely(!idesc))
+				return -1;
+
+			desc_ring = idesc;
+		}
+
+		desc_id = 0;
+	}
+
+	/* dirty page logging for DMA writeable buffer */
+	do {
+		if (unlikely(desc_id >= vq->size))
+			goto fail;
+		if (unlikely(nr_descs-- == 0))
+			goto fail;
+		desc = desc_ring[desc_id];
+		if (desc.flags & VRING_DESC_F_WRITE)
+			vhost_log_cache_write_iova(dev, vq, desc.addr,
+						   desc.len);
+		desc_id = desc.next;
+	} while (desc.flags & VRING_DESC_F_NEXT);
+
+	if (unlikely(idesc))
+		free_ind_table(idesc);
+
+	return 0;
+
+fail:
+	if (unlikely(idesc))
+		free_ind_table(idesc);
+	return -1;
+}
+
 RTE_EXPORT_INTERNAL_SYMBOL(rte_vdpa_relay_vring_used)
 int
 rte_vdpa_relay_vring_used(int vid, uint16_t qid, void *vring_m)
 {
 	struct virtio_net *dev = get_device(vid);
-	uint16_t idx, idx_m, desc_id;
+	uint16_t idx, idx_m, burst, i;
 	struct vhost_virtqueue *vq;
-	struct vring_desc desc;
-	struct vring_desc *desc_ring;
-	struct vring_desc *idesc = NULL;
 	struct vring *s_vring;
-	uint64_t dlen;
-	uint32_t nr_descs;
 	int ret;
 
 	if (!dev || !vring_m)
@@ -183,69 +248,42 @@ rte_vdpa_relay_vring_used(int vid, uint16_t qid, void *vring_m)
 	vq->used->flags = s_vring->used->flags;
 
 	while (idx != idx_m) {
-		/* copy used entry, used ring logging is not covered here */
-		vq->used->ring[idx & (vq->size - 1)] =
-			s_vring->used->ring[idx & (vq->size - 1)];
-
-		desc_id = vq->used->ring[idx & (vq->size - 1)].id;
-		desc_ring = vq->desc;
-		nr_descs = vq->size;
-
-		if (unlikely(desc_id >= vq->size))
-			return -1;
-
-		if (vq->desc[desc_id].flags & VRING_DESC_F_INDIRECT) {
-			dlen = vq->desc[desc_id].len;
-			nr_descs = dlen / sizeof(struct vring_desc);
-			if (unlikely(nr_descs > vq->size))
-				return -1;
+		uint16_t pos = idx & (vq->size - 1);
 
-			vhost_user_iotlb_rd_lock(vq);
-			desc_ring = (struct vring_desc *)(uintptr_t)
-				vhost_iova_to_vva(dev, vq,
-						vq->desc[desc_id].addr, &dlen,
-						VHOST_ACCESS_RO);
-			vhost_user_iotlb_rd_unlock(vq);
-			if (unlikely(!desc_ring))
-				return -1;
+		burst = RTE_MIN((uint16_t)(idx_m - idx),
+				(uint16_t)VDPA_RELAY_BURST_SZ);
+		burst = RTE_MIN(burst, (uint16_t)(vq->size - pos));
 
-			if (unlikely(dlen < vq->desc[desc_id].len)) {
-				vhost_user_iotlb_rd_lock(vq);
-				idesc = vhost_alloc_copy_ind_table(dev, vq,
-						vq->desc[desc_id].addr,
-						vq->desc[desc_id].len);
-				vhost_user_iotlb_rd_unlock(vq);
-				if (unlikely(!idesc))
-					return -1;
+		/* copy used entries, used ring logging is not covered here */
+		memcpy(&vq->used->ring[pos], &s_vring->used->ring[pos],
+			burst * sizeof(vq->used->ring[0]));
 
-				desc_ring = idesc;
-			}
+		/* prefetch the chain heads walked below */
+		for (i = 0; i < burst; i++) {
+			uint16_t desc_id = vq->used->ring[pos + i].id;
 
-			desc_id = 0;
+			if (likely(desc_id < vq->size))
+				rte_prefetch0(&vq->desc[desc_id]);
 		}
 
-		/* dirty page logging for DMA writeable buffer */
-		do {
-			if (unlikely(desc_id >= vq->size))
-				goto fail;
-			if (unlikely(nr_descs-- == 0))
-				goto fail;
-			desc = desc_ring[desc_id];
-			if (desc.flags & VRING_DESC_F_WRITE) {
-				vhost_user_iotlb_rd_lock(vq);
-				vhost_log_write_iova(dev, vq, desc.addr,
-						     desc.len);
+		/*
+		 * One IOTLB acquisition per burst; the chain walks go
+		 * through the dirty-page log cache, which is flushed
+		 * once per burst instead of per descriptor.
+		 */
+		vhost_user_iotlb_rd_lock(vq);
+		for (i = 0; i < burst; i++) {
+			if (unlikely(vdpa_relay_used_entry(dev, vq,
+					vq->used->ring[pos + i].id) < 0)) {
 				vhost_user_iotlb_rd_unlock(vq);
+				vhost_log_cache_sync(dev, vq);
+				return -1;
 			}
-			desc_id = desc.next;
-		} while (desc.flags & VRING_DESC_F_NEXT);
-
-		if (unlikely(idesc)) {
-			free_ind_table(idesc);
-			idesc = NULL;
 		}
+		vhost_user_iotlb_rd_unlock(vq);
+		vhost_log_cache_sync(dev, vq);
 
-		idx++;
+		idx += burst;
 	}
 
 	/* used idx is the synchronization point for the split vring */
@@ -255,12 +293,12 @@ rte_vdpa_relay_vring_used(int vid, uint16_t qid, void *vring_m)
 	if (dev->features & (1ULL << VIRTIO_RING_F_EVENT_IDX))
 		vring_used_event(s_vring) = idx_m;
 
-	return ret;
+	if (dev->flags & VIRTIO_DEV_STATS_ENABLED) {
+		vq->stats.vdpa_relay_calls++;
+		vq->stats.vdpa_relay_used_entries += (uint16_t)ret;
+	}
 
-fail:
-	if (unlikely(idesc))
-		free_ind_table(idesc);
-	return -1;
+	return ret;
 }
 
 RTE_EXPORT_SYMBOL(rte_vdpa_get_queue_num)
@@ -52,11 +52,16 @@ static const struct vhost_vq_stats_name_off vhost_vq_stat_strings[] = {
 		stats.guest_notifications_error)},
 	{"guest_notifications_suppressed", offsetof(struct vhost_virtqueue,
 		stats.guest_notifications_suppressed)},
+	{"guest_notifications_coalesced", offsetof(struct vhost_virtqueue,
+		stats.guest_notifications_coalesced)},
 	{"iotlb_hits",             offsetof(struct vhost_virtqueue, stats.iotlb_hits)},
 	{"iotlb_misses",           offsetof(struct vhost_virtqueue, stats.iotlb_misses)},
 	{"inflight_submitted",     offsetof(struct vhost_virtqueue, stats.inflight_submitted)},
 	{"inflight_completed",     offsetof(struct vhost_virtqueue, stats.inflight_completed)},
 	{"mbuf_alloc_failed",      offsetof(struct vhost_virtqueue, stats.mbuf_alloc_failed)},
+	{"vdpa_relay_calls",       offsetof(struct vhost_virtqueue, stats.vdpa_relay_calls)},
+	{"vdpa_relay_used_entries", offsetof(struct vhost_virtqueue,
+		stats.vdpa_relay_used_entries)},
 };
 
 #define VHOST_NB_VQ_STATS RTE_DIM(vhost_vq_stat_strings)
@@ -146,6 +151,27 @@ vhost_log_page(uint8_t *log_base, uint64_t page)
 	vhost_set_bit(page % 8, &log_base[page / 8]);
 }
 
+/*
+ * Atomically OR a whole bitmap word into the dirty log.
+ */
+static __rte_always_inline void
+vhost_log_word(struct virtio_net *dev, uint32_t offset, unsigned long val)
+{
+	unsigned long *log_base = (unsigned long *)(uintptr_t)dev->log_base;
+
+#if defined(RTE_TOOLCHAIN_GCC) && (GCC_VERSION < 70100)
+	/*
+	 * '__sync' builtins are deprecated, but 'rte_atomic' ones
+	 * are sub-optimized in older GCC versions.
+	 */
+	__sync_fetch_and_or(log_base + offset, val);
+#else
+	rte_atomic_fetch_or_explicit(
+		(unsigned long __rte_atomic *)(log_base + offset),
+		val, rte_memory_order_relaxed);
+#endif
+}
+
 void
 __vhost_log_write(struct virtio_net *dev, uint64_t addr, uint64_t len)
 {
@@ -190,7 +216,6 @@ __vhost_log_write_iova(struct virtio_net *dev, struct vhost_virtqueue *vq,
 void
 __vhost_log_cache_sync(struct virtio_net *dev, struct vhost_virtqueue *vq)
 {
-	unsigned long *log_base;
 	int i;
 
 	if (unlikely(!dev->log_base))
@@ -202,22 +227,10 @@ __vhost_log_cache_sync(struct virtio_net *dev, struct vhost_virtqueue *vq)
 
 	rte_atomic_thread_fence(rte_memory_order_release);
 
-	log_base = (unsigned long *)(uintptr_t)dev->log_base;
-
 	for (i = 0; i < vq->log_cache_nb_elem; i++) {
 		struct log_cache_entry *elem = vq->log_cache + i;
 
-#if defined(RTE_TOOLCHAIN_GCC) && (GCC_VERSION < 70100)
-		/*
-		 * '__sync' builtins are deprecated, but 'rte_atomic' ones
-		 * are sub-optimized in older GCC versions.
-		 */
-		__sync_fetch_and_or(log_base + elem->offset, elem->val);
-#else
-		rte_atomic_fetch_or_explicit(
-			(unsigned long __rte_atomic *)(log_base + elem->offset),
-			elem->val, rte_memory_order_relaxed);
-#endif
+		vhost_log_word(dev, elem->offset, elem->val);
 	}
 
 	rte_atomic_thread_fence(rte_memory_order_release);
@@ -226,26 +239,35 @@ __vhost_log_cache_sync(struct virtio_net *dev, struct vhost_virtqueue *vq)
 }
 
 static __rte_always_inline void
-vhost_log_cache_page(struct virtio_net *dev, struct vhost_virtqueue *vq,
-			uint64_t page)
+vhost_log_cache_word(struct virtio_net *dev, struct vhost_virtqueue *vq,
+			uint32_t offset, unsigned long val)
 {
-	uint32_t bit_nr = page % (sizeof(unsigned long) << 3);
-	uint32_t offset = page / (sizeof(unsigned long) << 3);
 	int i;
 
 	if (unlikely(!vq->log_cache)) {
 		/* No logging cache allocated, write dirty log map directly */
 		rte_atomic_thread_fence(rte_memory_order_release);
-		vhost_log_page((uint8_t *)(uintptr_t)dev->log_base, page);
+		vhost_log_word(dev, offset, val);
 
 		return;
 	}
 
+	/* sequential writes usually land in the last touched word */
+	if (vq->log_cache_nb_elem > 0) {
+		struct log_cache_entry *last =
+				vq->log_cache + vq->log_cache_nb_elem - 1;
+
+		if (last->offset == offset) {
+			last->val |= val;
+			return;
+		}
+	}
+
 	for (i = 0; i < vq->log_cache_nb_elem; i++) {
 		struct log_cache_entry *elem = vq->log_cache + i;
 
 		if (elem->offset == offset) {
-			elem->val |= (1UL << bit_nr);
+			elem->val |= val;
 			return;
 		}
 	}
@@ -256,13 +278,13 @@ vhost_log_cache_page(struct virtio_net *dev, struct vhost_virtqueue *vq,
 		 * so write the dirty log map directly.
 		 */
 		rte_atomic_thread_fence(rte_memory_order_release);
-		vhost_log_page((uint8_t *)(uintptr_t)dev->log_base, page);
+		vhost_log_word(dev, offset, val);
 
 		return;
 	}
 
 	vq->log_cache[i].offset = offset;
-	vq->log_cache[i].val = (1UL << bit_nr);
+	vq->log_cache[i].val = val;
 	vq->log_cache_nb_elem++;
 }
 
@@ -270,7 +292,8 @@ void
 __vhost_log_cache_write(struct virtio_net *dev, struct vhost_virtqueue *vq,
 			uint64_t addr, uint64_t len)
 {
-	uint64_t page;
+	uint32_t bits_per_word = sizeof(unsigned long) << 3;
+	uint64_t page, last_page;
 
 	if (unlikely(!dev->log_base || !len))
 		return;
@@ -278,10 +301,27 @@ __vhost_log_cache_write(struct virtio_net *dev, struct vhost_virtqueue *vq,
 	if (unlikely(dev->log_size <= ((addr + len - 1) / VHOST_LOG_PAGE / 8)))
 		return;
 
+	/*
+	 * Coalesce the dirtied page range into whole bitmap words, so that
+	 * a large contiguous write costs one cache lookup per word of the
+	 * bitmap rather than one per page.
+	 */
 	page = addr / VHOST_LOG_PAGE;
-	while (page * VHOST_LOG_PAGE < addr + len) {
-		vhost_log_cache_page(dev, vq, page);
-		page += 1;
+	last_page = (addr + len - 1) / VHOST_LOG_PAGE;
+	while (page <= last_page) {
+		uint32_t bit_lo = page % bits_per_word;
+		uint64_t word_last = RTE_MIN(last_page,
+				page - bit_lo + bits_per_word - 1);
+		uint32_t bit_hi = word_last % bits_per_word;
+		unsigned long val;
+
+		if (bit_hi - bit_lo == bits_per_word - 1)
+			val = ~0UL;
+		else
+			val = ((2UL << bit_hi) - 1) & ~((1UL << bit_lo) - 1);
+
+		vhost_log_cache_word(dev, vq, page / bits_per_word, val);
+		page = word_last + 1;
 	}
 }
 
@@ -592,6 +632,7 @@ vring_invalidate(struct virtio_net *dev __rte_unused, struct vhost_virtqueue *vq
 	vq->avail = NULL;
 	vq->used = NULL;
 	vq->log_guest_addr = 0;
+	memset(vq->gpa_cache, 0, sizeof(vq->gpa_cache));
 
 	vhost_user_iotlb_wr_unlock(vq);
 }
@@ -1420,6 +1461,44 @@ out_unlock:
 	return ret;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_vhost_notify_guest_coalesce, 25.07)
+int
+rte_vhost_notify_guest_coalesce(int vid, uint16_t queue_id,
+		uint32_t max_delay_us)
+{
+	struct virtio_net *dev;
+	struct vhost_virtqueue *vq;
+
+	dev = get_device(vid);
+	if (!dev)
+		return -1;
+
+	if (queue_id >= VHOST_MAX_VRING)
+		return -1;
+
+	vq = dev->virtqueue[queue_id];
+	if (!vq)
+		return -1;
+
+	rte_rwlock_write_lock(&vq->access_lock);
+
+	vq->kick_coalesce_cycles = (uint64_t)max_delay_us *
+			rte_get_tsc_hz() / US_PER_S;
+	vq->kick_interval_ewma = 0;
+	vq->kick_last_req_tsc = rte_rdtsc();
+	vq->kick_last_sent_tsc = vq->kick_last_req_tsc;
+
+	/* flush any notification held back under the previous setting */
+	if (vq->access_ok)
+		vhost_vring_kick_flush(dev, vq, true);
+	else
+		vq->kick_pending = false;
+
+	rte_rwlock_write_unlock(&vq->access_lock);
+
+	return 0;
+}
+
 RTE_EXPORT_SYMBOL(rte_vhost_avail_entries)
 uint16_t
 rte_vhost_avail_entries(int vid, uint16_t queue_id)
@@ -1786,6 +1865,61 @@ rte_vhost_get_vring_base_from_inflight(int vid,
 	return 0;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_vhost_vring_snapshot, 25.07)
+int
+rte_vhost_vring_snapshot(int vid, uint16_t queue_id,
+		struct rte_vhost_vring_snapshot *snapshot)
+{
+	struct vhost_virtqueue *vq;
+	struct virtio_net *dev = get_device(vid);
+	uint16_t nr_inflight = 0;
+	uint16_t i;
+
+	if (dev == NULL || snapshot == NULL)
+		return -1;
+
+	if (queue_id >= VHOST_MAX_VRING)
+		return -1;
+
+	vq = dev->virtqueue[queue_id];
+	if (!vq)
+		return -1;
+
+	if (vq_is_packed(dev)) {
+		struct rte_vhost_inflight_info_packed *inflight_packed;
+
+		snapshot->last_avail_idx = (vq->avail_wrap_counter << 15) |
+					   vq->last_avail_idx;
+		snapshot->last_used_idx = (vq->used_wrap_counter << 15) |
+					  vq->last_used_idx;
+
+		inflight_packed = vq->inflight_packed;
+		if (inflight_packed) {
+			for (i = 0; i < inflight_packed->desc_num; i++) {
+				if (inflight_packed->desc[i].inflight)
+					nr_inflight++;
+			}
+		}
+	} else {
+		struct rte_vhost_inflight_info_split *inflight_split;
+
+		snapshot->last_avail_idx = vq->last_avail_idx;
+		snapshot->last_used_idx = vq->last_used_idx;
+
+		inflight_split = vq->inflight_split;
+		if (inflight_split) {
+			for (i = 0; i < inflight_split->desc_num; i++) {
+				if (inflight_split->desc[i].inflight)
+					nr_inflight++;
+			}
+		}
+	}
+
+	snapshot->nr_inflight = nr_inflight;
+
+	return 0;
+}
+
 RTE_EXPORT_SYMBOL(rte_vhost_extern_callback_register)
 int
 rte_vhost_extern_callback_register(int vid,
@@ -47,7 +47,7 @@
 
 #define BUF_VECTOR_MAX 256
 
-#define VHOST_LOG_CACHE_NR 32
+#define VHOST_LOG_CACHE_NR 128
 
 #define MAX_PKT_BURST 32
 
@@ -153,6 +153,10 @@ struct virtqueue_stats {
 	uint64_t inflight_completed;
 	uint64_t mbuf_alloc_failed;
 	uint64_t guest_notifications_suppressed;
+	uint64_t guest_notifications_coalesced;
+	/* vDPA SW relay counters, updated during live migration. */
+	uint64_t vdpa_relay_calls;
+	uint64_t vdpa_relay_used_entries;
 	/* Counters below are atomic, and should be incremented as such. */
 	RTE_ATOMIC(uint64_t) guest_notifications;
 	RTE_ATOMIC(uint64_t) guest_notifications_offloaded;
@@ -282,6 +286,21 @@ struct vhost_reconnect_data {
 	struct vhost_reconnect_vring vring[VHOST_MAX_VRING];
 };
 
+#define VHOST_GPA_CACHE_NB_ENTRIES	8
+#define VHOST_GPA_CACHE_SHIFT		12
+
+/**
+ * Per-virtqueue GPA->HVA translation cache entry, holding the bounds of
+ * the last guest memory region hit for a given GPA page slot. It
+ * short-circuits the linear region scan for guests with many memory
+ * regions. Invalidated when the memory table changes.
+ */
+struct vhost_gpa_cache_entry {
+	uint64_t gpa_start;
+	uint64_t size;
+	uint64_t hva_start;
+};
+
 /**
  * Structure contains variables relevant to RX/TX virtqueues.
  */
@@ -339,6 +358,9 @@ struct __rte_cache_aligned vhost_virtqueue {
 
 	rte_rwlock_t	iotlb_lock;
 
+	/* GPA->HVA translation cache, only used without VIRTIO_F_IOMMU_PLATFORM */
+	struct vhost_gpa_cache_entry gpa_cache[VHOST_GPA_CACHE_NB_ENTRIES];
+
 	/* Used to notify the guest (trigger interrupt) */
 	int			callfd;
 	/* Currently unused as polling mode is enabled */
@@ -364,6 +386,15 @@ struct __rte_cache_aligned vhost_virtqueue {
 	struct virtqueue_stats	stats;
 
 	RTE_ATOMIC(bool) irq_pending;
+
+	/* Guest notification coalescing, protected by vq->access_lock */
+	uint64_t	kick_coalesce_cycles; /* max hold time, 0 = disabled */
+	uint64_t	kick_interval_ewma;
+	uint64_t	kick_last_req_tsc;
+	uint64_t	kick_last_sent_tsc;
+	uint64_t	kick_deadline_tsc;
+	bool		kick_pending;
+
 	struct vhost_reconnect_vring *reconnect_log;
 };
 
@@ -913,13 +944,48 @@ uint64_t translate_log_addr(struct virtio_net *dev, struct vhost_virtqueue *vq,
 void vring_invalidate(struct virtio_net *dev, struct vhost_virtqueue *vq)
 	__rte_requires_capability(&vq->access_lock);
 
+static __rte_always_inline uint64_t
+vhost_gpa_cache_lookup(struct vhost_virtqueue *vq, struct rte_vhost_memory *mem,
+			uint64_t gpa, uint64_t *len)
+{
+	struct vhost_gpa_cache_entry *e;
+	struct rte_vhost_mem_region *r;
+	uint32_t i;
+
+	e = &vq->gpa_cache[(gpa >> VHOST_GPA_CACHE_SHIFT) &
+			(VHOST_GPA_CACHE_NB_ENTRIES - 1)];
+	if (likely(gpa - e->gpa_start < e->size)) {
+		if (unlikely(*len > e->gpa_start + e->size - gpa))
+			*len = e->gpa_start + e->size - gpa;
+
+		return gpa - e->gpa_start + e->hva_start;
+	}
+
+	for (i = 0; i < mem->nregions; i++) {
+		r = &mem->regions[i];
+		if (gpa - r->guest_phys_addr < r->size) {
+			e->gpa_start = r->guest_phys_addr;
+			e->size = r->size;
+			e->hva_start = r->host_user_addr;
+
+			if (unlikely(*len > r->guest_phys_addr + r->size - gpa))
+				*len = r->guest_phys_addr + r->size - gpa;
+
+			return gpa - r->guest_phys_addr + r->host_user_addr;
+		}
+	}
+	*len = 0;
+
+	return 0;
+}
+
 static __rte_always_inline uint64_t
 vhost_iova_to_vva(struct virtio_net *dev, struct vhost_virtqueue *vq,
 			uint64_t iova, uint64_t *len, uint8_t perm)
 	__rte_requires_shared_capability(&vq->iotlb_lock)
 {
 	if (!(dev->features & (1ULL << VIRTIO_F_IOMMU_PLATFORM)))
-		return rte_vhost_va_from_guest_pa(dev->mem, iova, len);
+		return vhost_gpa_cache_lookup(vq, dev->mem, iova, len);
 
 	return __vhost_iova_to_vva(dev, vq, iova, len, perm);
 }
@@ -980,12 +1046,82 @@ vhost_vring_inject_irq(struct virtio_net *dev, struct vhost_virtqueue *vq)
 		dev->notify_ops->guest_notified(dev->vid);
 }
 
+/*
+ * Guest notification coalescing: instead of injecting an interrupt for
+ * every burst that requests one, hold the notification back for a bounded
+ * time so that subsequent bursts piggy-back on a single guest wakeup. The
+ * effective hold window adapts to the observed request rate, so sparse
+ * traffic is still notified with minimal added latency.
+ */
+static __rte_always_inline void
+vhost_vring_kick_flush(struct virtio_net *dev, struct vhost_virtqueue *vq,
+		bool force)
+{
+	if (!vq->kick_pending)
+		return;
+
+	if (!force && rte_rdtsc() < vq->kick_deadline_tsc)
+		return;
+
+	vq->kick_pending = false;
+	vq->kick_last_sent_tsc = rte_rdtsc();
+	vhost_vring_inject_irq(dev, vq);
+}
+
+static __rte_always_inline void
+vhost_vring_kick_guest(struct virtio_net *dev, struct vhost_virtqueue *vq)
+{
+	uint64_t now, window;
+
+	if (likely(vq->kick_coalesce_cycles == 0)) {
+		vhost_vring_inject_irq(dev, vq);
+		return;
+	}
+
+	now = rte_rdtsc();
+
+	/* track how often the ring requests notifications (EWMA, 1/8 gain) */
+	vq->kick_interval_ewma -= vq->kick_interval_ewma >> 3;
+	vq->kick_interval_ewma += (now - vq->kick_last_req_tsc) >> 3;
+	vq->kick_last_req_tsc = now;
+
+	/*
+	 * Requests arriving further apart than the configured window gain
+	 * nothing from coalescing, so shrink the window to the observed
+	 * request interval to keep the added latency proportionate.
+	 */
+	window = RTE_MIN(vq->kick_coalesce_cycles, vq->kick_interval_ewma);
+
+	if (vq->kick_pending) {
+		if (now >= vq->kick_deadline_tsc) {
+			vq->kick_pending = false;
+			vq->kick_last_sent_tsc = now;
+			vhost_vring_inject_irq(dev, vq);
+		} else {
+			vq->stats.guest_notifications_coalesced++;
+		}
+		return;
+	}
+
+	if (now - vq->kick_last_sent_tsc >= window) {
+		vq->kick_last_sent_tsc = now;
+		vhost_vring_inject_irq(dev, vq);
+	} else {
+		vq->kick_pending = true;
+		vq->kick_deadline_tsc = vq->kick_last_sent_tsc + window;
+		vq->stats.guest_notifications_coalesced++;
+	}
+}
+
 static __rte_always_inline void
 vhost_vring_call_split(struct virtio_net *dev, struct vhost_virtqueue *vq)
 {
 	/* Flush used->idx update before we read avail->flags. */
 	rte_atomic_thread_fence(rte_memory_order_seq_cst);
 
+	if (unlikely(vq->kick_pending))
+		vhost_vring_kick_flush(dev, vq, false);
+
 	/* Don't kick guest if we don't reach index specified by guest. */
 	if (dev->features & (1ULL << VIRTIO_RING_F_EVENT_IDX)) {
 		uint16_t old = vq->signalled_used;
@@ -1001,11 +1137,11 @@ vhost_vring_call_split(struct virtio_net *dev, struct vhost_virtqueue *vq)
 
 		if (vhost_need_event(vhost_used_event(vq), new, old) ||
 				unlikely(!signalled_used_valid))
-			vhost_vring_inject_irq(dev, vq);
+			vhost_vring_kick_guest(dev, vq);
 	} else {
 		/* Kick the guest if necessary. */
 		if (!(vq->avail->flags & VRING_AVAIL_F_NO_INTERRUPT))
-			vhost_vring_inject_irq(dev, vq);
+			vhost_vring_kick_guest(dev, vq);
 	}
 }
 
@@ -1018,6 +1154,9 @@ vhost_vring_call_packed(struct virtio_net *dev, struct vhost_virtqueue *vq)
 	/* Flush used desc update. */
 	rte_atomic_thread_fence(rte_memory_order_seq_cst);
 
+	if (unlikely(vq->kick_pending))
+		vhost_vring_kick_flush(dev, vq, false);
+
 	if (!(dev->features & (1ULL << VIRTIO_RING_F_EVENT_IDX))) {
 		if (vq->driver_event->flags !=
 				VRING_EVENT_F_DISABLE)
@@ -1057,7 +1196,7 @@ vhost_vring_call_packed(struct virtio_net *dev, struct vhost_virtqueue *vq)
 		kick = true;
 kick:
 	if (kick)
-		vhost_vring_inject_irq(dev, vq);
+		vhost_vring_kick_guest(dev, vq);
 }
 
 static __rte_always_inline void
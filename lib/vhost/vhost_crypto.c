@@ -1974,6 +1974,36 @@ rte_vhost_crypto_set_zero_copy(int vid, enum rte_vhost_crypto_zero_copy option)
 	return 0;
 }
 
+static __rte_always_inline uintptr_t
+vhost_crypto_op_session(const struct rte_crypto_op *op)
+{
+	if (op->type == RTE_CRYPTO_OP_TYPE_ASYMMETRIC)
+		return (uintptr_t)op->asym->session;
+	return (uintptr_t)op->sym->session;
+}
+
+/*
+ * Group the ops of a burst by session before handing them to the
+ * application: crypto PMDs process back-to-back ops sharing a session
+ * faster, and the used ring entries are addressed by descriptor index,
+ * so the guest does not depend on the submission order.
+ */
+static __rte_always_inline void
+vhost_crypto_sort_by_session(struct rte_crypto_op **ops, uint16_t n)
+{
+	uint16_t i, j;
+
+	for (i = 1; i < n; i++) {
+		struct rte_crypto_op *op = ops[i];
+		uintptr_t key = vhost_crypto_op_session(op);
+
+		for (j = i; j > 0 &&
+		     vhost_crypto_op_session(ops[j - 1]) > key; j--)
+			ops[j] = ops[j - 1];
+		ops[j] = op;
+	}
+}
+
 RTE_EXPORT_SYMBOL(rte_vhost_crypto_fetch_requests)
 uint16_t
 rte_vhost_crypto_fetch_requests(int vid, uint32_t qid,
@@ -2095,6 +2125,9 @@ rte_vhost_crypto_fetch_requests(int vid, uint32_t qid,
 
 	}
 
+	if (i > 1)
+		vhost_crypto_sort_by_session(ops, i);
+
 	vq->last_used_idx += i;
 
 out_unlock:
@@ -107,8 +107,25 @@ vhost_async_dma_transfer_one(struct virtio_net *dev, struct vhost_virtqueue *vq,
 		return -1;
 
 	for (i = 0; i < nr_segs; i++) {
-		copy_idx = rte_dma_copy(dma_id, vchan_id, (rte_iova_t)iov[i].src_addr,
-				(rte_iova_t)iov[i].dst_addr, iov[i].len, RTE_DMA_OP_FLAG_LLC);
+		rte_iova_t src_addr = (rte_iova_t)iov[i].src_addr;
+		rte_iova_t dst_addr = (rte_iova_t)iov[i].dst_addr;
+		uint32_t len = iov[i].len;
+
+		/**
+		 * Coalesce segments contiguous in both source and
+		 * destination address space into one larger copy, to
+		 * save descriptors and per-operation overhead on the
+		 * DMA device.
+		 */
+		while (i + 1 < nr_segs &&
+				src_addr + len == (rte_iova_t)iov[i + 1].src_addr &&
+				dst_addr + len == (rte_iova_t)iov[i + 1].dst_addr) {
+			len += iov[i + 1].len;
+			i++;
+		}
+
+		copy_idx = rte_dma_copy(dma_id, vchan_id, src_addr,
+				dst_addr, len, RTE_DMA_OP_FLAG_LLC);
 		/**
 		 * Since all memory is pinned and DMA vChannel
 		 * ring has enough space, failure should be a
@@ -190,7 +207,7 @@ vhost_async_dma_check_completed(struct virtio_net *dev, int16_t dma_id, uint16_t
 	 */
 	nr_copies = rte_dma_completed(dma_id, vchan_id, max_pkts, &last_idx, &has_error);
 	if (unlikely(!vhost_async_dma_complete_log && has_error)) {
-		VHOST_DATA_LOG(dev->ifname, ERR,
+		VHOST_DATA_LOG(dev ? dev->ifname : "dma", ERR,
 			"DMA completion failure on channel %d:%u",
 			dma_id, vchan_id);
 		vhost_async_dma_complete_log = true;
@@ -387,11 +404,24 @@ vhost_flush_dequeue_shadow_packed(struct virtio_net *dev,
 	vhost_log_cache_sync(dev, vq);
 }
 
+/**
+ * Deferred used-flag writeback for the head descriptor of a burst. The
+ * guest processes used descriptors in ring order, so holding back the
+ * first descriptor's flags keeps the whole burst invisible until a single
+ * release store publishes it at the end of the burst.
+ */
+struct used_flags_hold {
+	uint16_t *addr;
+	uint16_t flags;
+	uint16_t idx;
+};
+
 static __rte_always_inline void
 vhost_flush_enqueue_batch_packed(struct virtio_net *dev,
 				 struct vhost_virtqueue *vq,
 				 uint64_t *lens,
-				 uint16_t *ids)
+				 uint16_t *ids,
+				 struct used_flags_hold *hold)
 {
 	uint16_t i;
 	uint16_t flags;
@@ -410,8 +440,18 @@ vhost_flush_enqueue_batch_packed(struct virtio_net *dev,
 
 	rte_atomic_thread_fence(rte_memory_order_release);
 
-	vhost_for_each_try_unroll(i, 0, PACKED_BATCH_SIZE) {
-		desc_base[i].flags = flags;
+	if (hold != NULL && hold->addr == NULL) {
+		/* Hold back the burst head flag, write the rest now. */
+		hold->addr = &desc_base[0].flags;
+		hold->flags = flags;
+		hold->idx = last_used_idx;
+		vhost_for_each_try_unroll(i, 1, PACKED_BATCH_SIZE) {
+			desc_base[i].flags = flags;
+		}
+	} else {
+		vhost_for_each_try_unroll(i, 0, PACKED_BATCH_SIZE) {
+			desc_base[i].flags = flags;
+		}
 	}
 
 	vhost_log_cache_used_vring(dev, vq, last_used_idx *
@@ -1556,7 +1596,8 @@ virtio_dev_rx_batch_packed_copy(struct virtio_net *dev,
 			   struct vhost_virtqueue *vq,
 			   struct rte_mbuf **pkts,
 			   uint64_t *desc_addrs,
-			   uint64_t *lens)
+			   uint64_t *lens,
+			   struct used_flags_hold *hold)
 	__rte_requires_shared_capability(&vq->iotlb_lock)
 {
 	uint32_t buf_offset = sizeof(struct virtio_net_hdr_mrg_rxbuf);
@@ -1598,13 +1639,14 @@ virtio_dev_rx_batch_packed_copy(struct virtio_net *dev,
 	vhost_for_each_try_unroll(i, 0, PACKED_BATCH_SIZE)
 		ids[i] = descs[avail_idx + i].id;
 
-	vhost_flush_enqueue_batch_packed(dev, vq, lens, ids);
+	vhost_flush_enqueue_batch_packed(dev, vq, lens, ids, hold);
 }
 
 static __rte_always_inline int
 virtio_dev_rx_sync_batch_packed(struct virtio_net *dev,
 			   struct vhost_virtqueue *vq,
-			   struct rte_mbuf **pkts)
+			   struct rte_mbuf **pkts,
+			   struct used_flags_hold *hold)
 	__rte_requires_shared_capability(&vq->iotlb_lock)
 {
 	uint64_t desc_addrs[PACKED_BATCH_SIZE];
@@ -1618,7 +1660,7 @@ virtio_dev_rx_sync_batch_packed(struct virtio_net *dev,
 		vhost_flush_enqueue_shadow_packed(dev, vq);
 	}
 
-	virtio_dev_rx_batch_packed_copy(dev, vq, pkts, desc_addrs, lens);
+	virtio_dev_rx_batch_packed_copy(dev, vq, pkts, desc_addrs, lens, hold);
 
 	return 0;
 }
@@ -1656,14 +1698,23 @@ virtio_dev_rx_packed(struct virtio_net *dev,
 	__rte_requires_shared_capability(&vq->access_lock)
 	__rte_requires_shared_capability(&vq->iotlb_lock)
 {
+	struct used_flags_hold hold = { 0 };
 	uint32_t pkt_idx = 0;
 
 	do {
+		uint16_t prefetch_idx;
+
 		rte_prefetch0(&vq->desc_packed[vq->last_avail_idx]);
 
+		/* Prefetch descriptors two batches ahead of the walk. */
+		prefetch_idx = vq->last_avail_idx + 2 * PACKED_BATCH_SIZE;
+		if (prefetch_idx >= vq->size)
+			prefetch_idx -= vq->size;
+		rte_prefetch0(&vq->desc_packed[prefetch_idx]);
+
 		if (count - pkt_idx >= PACKED_BATCH_SIZE) {
 			if (!virtio_dev_rx_sync_batch_packed(dev, vq,
-							&pkts[pkt_idx])) {
+							&pkts[pkt_idx], &hold)) {
 				pkt_idx += PACKED_BATCH_SIZE;
 				continue;
 			}
@@ -1680,6 +1731,16 @@ virtio_dev_rx_packed(struct virtio_net *dev,
 		vhost_flush_enqueue_shadow_packed(dev, vq);
 	}
 
+	if (hold.addr != NULL) {
+		/* Publish the whole burst with a single guest-visible store. */
+		rte_atomic_store_explicit((unsigned short __rte_atomic *)hold.addr,
+			hold.flags, rte_memory_order_release);
+		vhost_log_cache_used_vring(dev, vq, hold.idx *
+					   sizeof(struct vring_packed_desc),
+					   sizeof(struct vring_packed_desc));
+		vhost_log_cache_sync(dev, vq);
+	}
+
 	if (pkt_idx)
 		vhost_vring_call_packed(dev, vq);
 
@@ -1709,6 +1770,10 @@ virtio_dev_rx(struct virtio_net *dev, struct vhost_virtqueue *vq,
 	if (unlikely(!vq->enabled))
 		goto out_access_unlock;
 
+	/* honor the deadline of a held-back kick even on an empty poll */
+	if (unlikely(vq->kick_pending))
+		vhost_vring_kick_flush(dev, vq, false);
+
 	vhost_user_iotlb_rd_lock(vq);
 
 	if (unlikely(!vq->access_ok)) {
@@ -2387,6 +2452,10 @@ rte_vhost_poll_enqueue_completed(int vid, uint16_t queue_id,
 		goto out;
 	}
 
+	/* honor the deadline of a held-back kick even on an empty poll */
+	if (unlikely(vq->kick_pending))
+		vhost_vring_kick_flush(dev, vq, false);
+
 	n_pkts_cpl = vhost_poll_enqueue_completed(dev, vq, pkts, count, dma_id, vchan_id);
 
 	vhost_queue_stats_update(dev, vq, pkts, n_pkts_cpl);
@@ -2539,6 +2608,10 @@ virtio_dev_rx_async_submit(struct virtio_net *dev, struct vhost_virtqueue *vq,
 	if (unlikely(!vq->enabled || !vq->async))
 		goto out_access_unlock;
 
+	/* honor the deadline of a held-back kick even on an empty poll */
+	if (unlikely(vq->kick_pending))
+		vhost_vring_kick_flush(dev, vq, false);
+
 	vhost_user_iotlb_rd_lock(vq);
 
 	if (unlikely(!vq->access_ok)) {
@@ -2572,6 +2645,27 @@ out_no_unlock:
 	return nb_tx;
 }
 
+RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_vhost_async_dma_completed_poll, 25.07)
+uint16_t
+rte_vhost_async_dma_completed_poll(int16_t dma_id, uint16_t vchan_id,
+		uint16_t max_copies)
+{
+	if (unlikely(dma_id < 0 || dma_id >= RTE_DMADEV_DEFAULT_MAX)) {
+		VHOST_DATA_LOG("dma", ERR, "%s: invalid dma id %d.",
+			__func__, dma_id);
+		return 0;
+	}
+
+	if (unlikely(!dma_copy_track[dma_id].vchans ||
+				!dma_copy_track[dma_id].vchans[vchan_id].pkts_cmpl_flag_addr)) {
+		VHOST_DATA_LOG("dma", ERR, "%s: invalid channel %d:%u.",
+			__func__, dma_id, vchan_id);
+		return 0;
+	}
+
+	return vhost_async_dma_check_completed(NULL, dma_id, vchan_id, max_copies);
+}
+
 RTE_EXPORT_EXPERIMENTAL_SYMBOL(rte_vhost_submit_enqueue_burst, 20.08)
 uint16_t
 rte_vhost_submit_enqueue_burst(int vid, uint16_t queue_id,
@@ -3630,6 +3724,10 @@ rte_vhost_dequeue_burst(int vid, uint16_t queue_id,
 	if (unlikely(!vq->enabled))
 		goto out_access_unlock;
 
+	/* honor the deadline of a held-back kick even on an empty poll */
+	if (unlikely(vq->kick_pending))
+		vhost_vring_kick_flush(dev, vq, false);
+
 	vhost_user_iotlb_rd_lock(vq);
 
 	if (unlikely(!vq->access_ok)) {
@@ -4254,6 +4352,10 @@ rte_vhost_async_try_dequeue_burst(int vid, uint16_t queue_id,
 	if (unlikely(vq->enabled == 0))
 		goto out_access_unlock;
 
+	/* honor the deadline of a held-back kick even on an empty poll */
+	if (unlikely(vq->kick_pending))
+		vhost_vring_kick_flush(dev, vq, false);
+
 	if (unlikely(!vq->async)) {
 		VHOST_DATA_LOG(dev->ifname, ERR, "%s: async not registered for queue id %d.",
 			__func__, queue_id);